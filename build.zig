@@ -20,6 +20,26 @@ pub fn build(b: *std.Build) void {
 
     b.installArtifact(exe);
 
+    // Embeddable runtime: static library with the C API in
+    // include/zig_wasm_cpython.h (see src/capi.zig)
+    const lib = b.addLibrary(.{
+        .linkage = .static,
+        .name = "zig_wasm_cpython",
+        .root_module = b.createModule(.{
+            .root_source_file = b.path("src/capi.zig"),
+            .target = target,
+            .optimize = optimize,
+            .link_libc = true,
+            .imports = &.{
+                .{ .name = "zware", .module = zware_mod },
+            },
+        }),
+        .use_llvm = true,
+    });
+    lib.installHeader(b.path("include/zig_wasm_cpython.h"), "zig_wasm_cpython.h");
+
+    b.installArtifact(lib);
+
     const run_step = b.step("run", "Run the app");
 
     const run_cmd = b.addRunArtifact(exe);
@@ -31,6 +51,22 @@ pub fn build(b: *std.Build) void {
         run_cmd.addArgs(args);
     }
 
+    // Standard library bytecode (compile_library.py --stdlib), which the
+    // runtime loads in place of the sources. Needs a host Python 3.13:
+    //   zig build stdlib-bytecode -Dpython-lib=/path/to/cpython/Lib
+    const stdlib_step = b.step("stdlib-bytecode", "Precompile the standard library into compiled_libs/stdlib");
+    const python = b.option([]const u8, "python", "Host Python 3.13 for stdlib-bytecode") orelse "python3";
+    const stdlib_optimize = b.option(u2, "stdlib-optimize", "Bytecode optimization level for stdlib-bytecode (0-2)") orelse 2;
+    if (b.option([]const u8, "python-lib", "CPython Lib/ directory for stdlib-bytecode")) |python_lib| {
+        const compile_stdlib = b.addSystemCommand(&.{ python, "compile_library.py", "--stdlib", python_lib });
+        compile_stdlib.addArgs(&.{ "--optimize", b.fmt("{d}", .{stdlib_optimize}) });
+        compile_stdlib.setCwd(b.path("."));
+        compile_stdlib.has_side_effects = true;
+        stdlib_step.dependOn(&compile_stdlib.step);
+    } else {
+        stdlib_step.dependOn(&b.addFail("stdlib-bytecode needs -Dpython-lib=<CPython Lib/ directory>").step);
+    }
+
     const exe_tests = b.addTest(.{
         .root_module = exe.root_module,
     });
@@ -6,18 +6,71 @@ Compiles Python libraries to bytecode with dependency tracking and incremental c
 
 Usage:
     python3 compile_library.py ../impacket --name impacket --with-deps
+    python3 compile_library.py --stdlib ../cpython-wasi/Lib
+
+--stdlib compiles the whole standard library into compiled_libs/stdlib/.
+The runtime loads those .pyc files in place of the sources, so the guest
+never compiles a stdlib module. Bytecode must come from the guest's
+Python version, so run this with a host Python 3.13.
+
+Files are compiled on a process pool (--jobs). A file is recompiled only
+when its content changed: unchanged size and mtime skip it without
+reading it, otherwise its BLAKE2 hash is compared with the manifest's.
+--with-deps finds the packages a library imports and compiles those too,
+transitively. Every run ends with a report of compiled, skipped and
+failed files and where the time went (--report writes it as JSON).
+
+Each library is also written as one pack, compiled_libs/<name>.zpack,
+holding all its code objects and an index of module names. The runtime
+loads a library's pack in place of its .pyc tree when there is one, and
+the guest imports from it through src/python/monkey_patches/zpack_importer.py
+(whose docstring describes the format).
 """
 
+import ast
+import importlib.machinery
+import importlib.util
 import py_compile
 import os
 import sys
 import json
 import hashlib
+import marshal
+import struct
+import time
+from concurrent.futures import ProcessPoolExecutor
 from pathlib import Path
 
 COMPILED_LIBS_DIR = Path(__file__).parent / "compiled_libs"
 MANIFEST_FILE = COMPILED_LIBS_DIR / ".manifest.json"
 
+# Python version of the WASI guest; .pyc magic numbers change between
+# minor versions, so the host compiler must match
+GUEST_VERSION = (3, 13)
+
+# Where the guest finds the standard library (tracebacks show these paths)
+GUEST_STDLIB_PATH = "/vfs/usr/local/lib/python3.13"
+
+# Directories the runtime never loads (see shouldSkipDirectory in
+# src/python/stdlib_loader.zig)
+STDLIB_SKIP_DIRS = {
+    '__pycache__', '.git', 'test', 'tests', 'ensurepip', 'idlelib',
+    'tkinter', 'turtle', 'turtledemo', '.pytest_cache', '.mypy_cache',
+    'node_modules', 'site-packages',
+}
+
+LIBRARY_SKIP_DIRS = {'__pycache__', 'test', 'tests', 'examples'}
+
+# Slowest files listed in the report
+REPORT_SLOWEST = 5
+
+# Pack header; bump with any change to the layout zpack_importer.py reads
+PACK_MAGIC = b"ZPK1"
+PACK_FLAG_PACKAGE = 1
+
+# Size of the .pyc header in front of the marshalled code object
+PYC_HEADER_SIZE = 16
+
 def load_manifest():
     if MANIFEST_FILE.exists():
         with open(MANIFEST_FILE, 'r') as f:
@@ -31,127 +84,302 @@ def save_manifest(manifest):
 
 def get_file_hash(path):
     with open(path, 'rb') as f:
-        return hashlib.md5(f.read()).hexdigest()
+        return hashlib.blake2b(f.read(), digest_size=16).hexdigest()
+
+def _compile_one(src_file, pyc_file, dfile, optimize):
+    """Compile one file (runs in a pool worker); returns (error, seconds)"""
+    start = time.perf_counter()
+    try:
+        py_compile.compile(src_file, cfile=pyc_file, dfile=dfile, optimize=optimize, doraise=True)
+        error = None
+    except Exception as e:
+        error = str(e)
+    return error, time.perf_counter() - start
 
-def compile_lib(source_dir, lib_name, force=False):
+def compile_lib(source_dir, lib_name, force=False, jobs=None):
     source = Path(source_dir).absolute()
-    
+
     if not source.exists():
         print(f"Error: {source} not found")
-        return 0, 0, 0
-    
+        return None
+
     # Check for package subdirectory
     if (source / lib_name).is_dir():
         source = source / lib_name
-    
+
+    report = compile_tree(source, lib_name, skip_dirs=LIBRARY_SKIP_DIRS, force=force, jobs=jobs)
+    report["pack_modules"] = write_pack(lib_name)
+    return report
+
+def write_pack(lib_name):
+    """Pack the library's compiled .pyc tree into compiled_libs/lib_name.zpack;
+    returns the number of modules packed"""
+    target = COMPILED_LIBS_DIR / lib_name
+    modules = {}
+    for root, dirs, names in os.walk(target):
+        dirs.sort()
+        rel_path = Path(root).relative_to(target)
+        package = ".".join((lib_name,) + rel_path.parts)
+        for fname in sorted(names):
+            if not fname.endswith('.pyc'):
+                continue
+            data = (Path(root) / fname).read_bytes()[PYC_HEADER_SIZE:]
+            if fname == "__init__.pyc":
+                modules[package] = (PACK_FLAG_PACKAGE, data)
+            else:
+                modules[f"{package}.{fname[:-4]}"] = (0, data)
+        # A directory without __init__ imports as a namespace package from
+        # the .pyc tree; with no tree it needs an (empty) entry of its own
+        if package not in modules:
+            init = compile("", f"{package}/__init__.py", "exec")
+            modules[package] = (PACK_FLAG_PACKAGE, marshal.dumps(init))
+
+    index = bytearray()
+    blobs = bytearray()
+    entries = []
+    for name, (flags, data) in modules.items():
+        entries.append((name.encode('utf-8'), flags, len(blobs), len(data)))
+        blobs += data
+    header_size = 12 + sum(2 + len(name) + 9 for name, _, _, _ in entries)
+    for name, flags, offset, length in entries:
+        index += struct.pack('<H', len(name)) + name
+        index += struct.pack('<BII', flags, header_size + offset, length)
+
+    pack_file = COMPILED_LIBS_DIR / f"{lib_name}.zpack"
+    tmp_file = pack_file.with_suffix(".zpack.tmp")
+    tmp_file.write_bytes(PACK_MAGIC + importlib.util.MAGIC_NUMBER +
+                         struct.pack('<I', len(entries)) + index + blobs)
+    tmp_file.replace(pack_file)
+    print(f"Packed {len(entries)} modules into {pack_file.name}")
+    return len(entries)
+
+def compile_stdlib(lib_dir, optimize=2, force=False, jobs=None):
+    if sys.version_info[:2] != GUEST_VERSION:
+        print(f"Error: the guest runs Python {GUEST_VERSION[0]}.{GUEST_VERSION[1]}; "
+              f"compile with that version (this is {sys.version_info[0]}.{sys.version_info[1]})")
+        return None
+
+    source = Path(lib_dir).absolute()
+    if not (source / "os.py").exists():
+        print(f"Error: {source} is not a standard library directory")
+        return None
+
+    return compile_tree(source, "stdlib", skip_dirs=STDLIB_SKIP_DIRS,
+                        dfile_prefix=GUEST_STDLIB_PATH, optimize=optimize, force=force, jobs=jobs)
+
+def compile_tree(source, lib_name, skip_dirs, dfile_prefix=None, optimize=2, force=False, jobs=None):
+    """Compile every .py under source to a sourceless .pyc in
+    compiled_libs/lib_name; returns the library's report"""
     target = COMPILED_LIBS_DIR / lib_name
     target.mkdir(parents=True, exist_ok=True)
-    
+
     manifest = load_manifest()
     if lib_name not in manifest:
         manifest[lib_name] = {"files": {}}
-    
+
     lib_data = manifest[lib_name]
-    
+    # Bytecode from another optimization level or Python version is stale
+    magic = importlib.util.MAGIC_NUMBER.hex()
+    if lib_data.get("optimize", 2) != optimize or lib_data.get("magic", magic) != magic:
+        lib_data["files"] = {}
+    lib_data["optimize"] = optimize
+    lib_data["magic"] = magic
+    files = lib_data["files"]
+
     print(f"\n{'='*70}")
     print(f"Library: {lib_name}")
     print(f"Source:  {source}")
     print(f"Target:  {target}")
     print(f"{'='*70}\n")
-    
-    compiled, skipped, failed = 0, 0, 0
-    
-    for root, dirs, files in os.walk(source):
-        # Skip tests and examples
-        dirs[:] = [d for d in dirs if d not in ('__pycache__', 'test', 'tests', 'examples')]
-        
+
+    report = {"library": lib_name, "compiled": 0, "skipped": 0, "failed": 0, "failures": {}}
+
+    # Find what changed
+    scan_start = time.perf_counter()
+    stale = []
+    for root, dirs, names in os.walk(source):
+        dirs[:] = [d for d in dirs if d not in skip_dirs]
+
         root_path = Path(root)
         rel_path = root_path.relative_to(source)
         target_dir = target / rel_path
-        target_dir.mkdir(parents=True, exist_ok=True)
-        
-        for fname in files:
+
+        for fname in names:
             if not fname.endswith('.py'):
                 continue
-            
+
             src_file = root_path / fname
             rel_file = str(rel_path / fname)
-            pyc_file = target_dir / fname.replace('.py', '.pyc')
-            
-            # Check if compilation needed
-            current_hash = get_file_hash(src_file)
-            if not force and rel_file in lib_data["files"]:
-                if lib_data["files"][rel_file] == current_hash and pyc_file.exists():
-                    skipped += 1
+            pyc_file = target_dir / (fname[:-3] + '.pyc')
+
+            st = src_file.stat()
+            entry = files.get(rel_file)
+            # Entries from older manifests are bare MD5 strings
+            if not isinstance(entry, dict):
+                entry = None
+            if not force and entry is not None and pyc_file.exists():
+                if entry["size"] == st.st_size and entry["mtime_ns"] == st.st_mtime_ns:
+                    report["skipped"] += 1
                     continue
-            
-            # Compile
-            try:
-                py_compile.compile(
-                    str(src_file),
-                    cfile=str(pyc_file),
-                    dfile=rel_file,
-                    optimize=2,
-                    doraise=True
-                )
-                lib_data["files"][rel_file] = current_hash
-                print(f"  ✓ {rel_file}")
-                compiled += 1
-            except Exception as e:
-                print(f"  ✗ {rel_file}: {e}")
-                failed += 1
-    
+                current_hash = get_file_hash(src_file)
+                if entry["hash"] == current_hash:
+                    # Touched but unchanged
+                    files[rel_file] = {"hash": current_hash, "size": st.st_size, "mtime_ns": st.st_mtime_ns}
+                    report["skipped"] += 1
+                    continue
+            else:
+                current_hash = get_file_hash(src_file)
+
+            target_dir.mkdir(parents=True, exist_ok=True)
+            stale.append((rel_file, src_file, pyc_file, current_hash, st))
+    report["scan_seconds"] = time.perf_counter() - scan_start
+
+    # Compile
+    compile_start = time.perf_counter()
+    timings = []
+    if stale:
+        with ProcessPoolExecutor(max_workers=jobs) as pool:
+            futures = [
+                pool.submit(_compile_one, str(src_file), str(pyc_file),
+                            f"{dfile_prefix}/{rel_file}" if dfile_prefix else rel_file, optimize)
+                for rel_file, src_file, pyc_file, _, _ in stale
+            ]
+            for (rel_file, _, _, current_hash, st), future in zip(stale, futures):
+                error, seconds = future.result()
+                timings.append((seconds, rel_file))
+                if error is None:
+                    files[rel_file] = {"hash": current_hash, "size": st.st_size, "mtime_ns": st.st_mtime_ns}
+                    print(f"  ✓ {rel_file}")
+                    report["compiled"] += 1
+                else:
+                    files.pop(rel_file, None)
+                    print(f"  ✗ {rel_file}: {error}")
+                    report["failures"][rel_file] = error
+                    report["failed"] += 1
+    report["compile_seconds"] = time.perf_counter() - compile_start
+    report["slowest"] = [{"file": f, "seconds": s} for s, f in sorted(timings, reverse=True)[:REPORT_SLOWEST]]
+
     manifest[lib_name] = lib_data
     save_manifest(manifest)
-    
-    print(f"\nCompiled: {compiled}, Skipped: {skipped}, Failed: {failed}\n")
-    return compiled, skipped, failed
-
-def compile_deps(req_file):
-    if not req_file.exists():
-        return
-    
-    print(f"\nProcessing dependencies from {req_file}...\n")
-    
-    with open(req_file, 'r') as f:
-        for line in f:
-            line = line.strip()
-            if not line or line.startswith('#') or ';sys_platform' in line:
+
+    print(f"\nCompiled: {report['compiled']}, Skipped: {report['skipped']}, Failed: {report['failed']} "
+          f"(scan {report['scan_seconds']:.2f}s, compile {report['compile_seconds']:.2f}s)\n")
+    return report
+
+def find_imports(source):
+    """Top-level names of the modules imported anywhere under source"""
+    names = set()
+    for root, dirs, files in os.walk(source):
+        dirs[:] = [d for d in dirs if d not in LIBRARY_SKIP_DIRS]
+        for fname in files:
+            if not fname.endswith('.py'):
                 continue
-            
-            pkg = line.split('>=')[0].split('==')[0].split('<')[0].split('>')[0].strip()
-            print(f"Dependency: {pkg}")
-            
-            # Search for package
-            for base in ["/usr/lib/python3.13", "/usr/local/lib/python3.13", 
-                         str(Path.home() / ".local/lib/python3.13")]:
-                pkg_path = Path(base) / "site-packages" / pkg
-                if pkg_path.exists():
-                    compile_lib(pkg_path.parent, pkg)
-                    break
-            else:
-                print(f"  ⚠ Not found\n")
+            try:
+                tree = ast.parse(Path(root, fname).read_bytes())
+            except (SyntaxError, ValueError):
+                # Reported when compiled
+                continue
+            for node in ast.walk(tree):
+                if isinstance(node, ast.Import):
+                    names.update(alias.name.partition('.')[0] for alias in node.names)
+                elif isinstance(node, ast.ImportFrom) and node.level == 0 and node.module:
+                    names.add(node.module.partition('.')[0])
+    return names
+
+def find_package(name):
+    """Directory holding the installed package name, or None"""
+    spec = importlib.machinery.PathFinder.find_spec(name)
+    if spec is None or not spec.submodule_search_locations:
+        return None
+    return Path(list(spec.submodule_search_locations)[0])
+
+def compile_deps(source, lib_name, force=False, jobs=None):
+    """Compile the packages source imports, and theirs in turn; returns
+    their reports"""
+    reports = []
+    done = {lib_name}
+    pending = [Path(source)]
+
+    while pending:
+        for name in sorted(find_imports(pending.pop())):
+            if name in done or name in sys.stdlib_module_names or name.startswith('_'):
+                continue
+            done.add(name)
+
+            pkg_path = find_package(name)
+            if pkg_path is None:
+                # Optional imports and single-file modules land here too
+                print(f"Dependency: {name}\n  ⚠ No installed package found\n")
+                continue
+
+            print(f"Dependency: {name} ({pkg_path})")
+            report = compile_lib(pkg_path.parent, name, force, jobs)
+            if report is not None:
+                reports.append(report)
+                pending.append(pkg_path)
+    return reports
+
+def print_report(reports, elapsed):
+    print(f"\n{'='*70}")
+    print("Build report")
+    print(f"{'='*70}")
+    print(f"  {'Library':<24} {'Compiled':>9} {'Skipped':>9} {'Failed':>7} {'Time':>9}")
+    for r in reports:
+        seconds = r["scan_seconds"] + r["compile_seconds"]
+        print(f"  {r['library']:<24} {r['compiled']:>9} {r['skipped']:>9} {r['failed']:>7} {seconds:>8.2f}s")
+    totals = [sum(r[k] for r in reports) for k in ("compiled", "skipped", "failed")]
+    print(f"  {'Total':<24} {totals[0]:>9} {totals[1]:>9} {totals[2]:>7} {elapsed:>8.2f}s")
+
+    slowest = sorted(((s["seconds"], r["library"], s["file"]) for r in reports for s in r["slowest"]),
+                     reverse=True)[:REPORT_SLOWEST]
+    if slowest:
+        print("\n  Slowest files:")
+        for seconds, library, fname in slowest:
+            print(f"    {seconds:7.3f}s  {library}/{fname}")
 
 if __name__ == "__main__":
     import argparse
-    
+
     parser = argparse.ArgumentParser()
-    parser.add_argument("library_path", type=Path)
+    parser.add_argument("library_path", type=Path, nargs="?")
     parser.add_argument("--name", help="Library name")
-    parser.add_argument("--with-deps", action="store_true")
+    parser.add_argument("--with-deps", action="store_true",
+                        help="Also compile the installed packages the library imports")
     parser.add_argument("--force", action="store_true")
-    
+    parser.add_argument("--stdlib", type=Path, metavar="LIB_DIR",
+                        help="Compile the standard library in LIB_DIR instead")
+    parser.add_argument("--optimize", type=int, choices=(0, 1, 2), default=2,
+                        help="Optimization level for --stdlib: 1 strips asserts (-O), 2 also docstrings (-OO)")
+    parser.add_argument("--jobs", "-j", type=int, default=None,
+                        help="Compiler processes (default: one per CPU)")
+    parser.add_argument("--report", type=Path, metavar="FILE",
+                        help="Also write the build report to FILE as JSON")
+
     args = parser.parse_args()
-    
-    lib_path = args.library_path.absolute()
-    lib_name = args.name or lib_path.name
-    
-    compile_lib(lib_path, lib_name, args.force)
-    
-    if args.with_deps:
-        req_file = lib_path / "requirements.txt"
-        compile_deps(req_file)
-    
+    start = time.perf_counter()
+
+    if args.stdlib:
+        reports = [compile_stdlib(args.stdlib, args.optimize, args.force, args.jobs)]
+    elif args.library_path is None:
+        parser.error("library_path is required unless --stdlib is given")
+    else:
+        lib_path = args.library_path.absolute()
+        lib_name = args.name or lib_path.name
+
+        reports = [compile_lib(lib_path, lib_name, args.force, args.jobs)]
+
+        if args.with_deps and reports[0] is not None:
+            source = lib_path / lib_name if (lib_path / lib_name).is_dir() else lib_path
+            reports += compile_deps(source, lib_name, args.force, args.jobs)
+
+    if reports[0] is None:
+        sys.exit(1)
+    elapsed = time.perf_counter() - start
+    print_report(reports, elapsed)
+    if args.report:
+        args.report.write_text(json.dumps({"elapsed_seconds": elapsed, "libraries": reports}, indent=2))
+
     print(f"\n{'='*70}")
     print(f"Done! Compiled libraries in: {COMPILED_LIBS_DIR}")
     print(f"{'='*70}\n")
+    sys.exit(1 if any(r["failed"] for r in reports) else 0)
@@ -0,0 +1,70 @@
+#!/usr/bin/env python3
+"""
+Minimal client for `zig_wasm_cpython --serve <socket>` (runs on the host).
+
+    ./zig-out/bin/zig_wasm_cpython --serve /tmp/pyjobs.sock &
+    python3 examples/serve_client.py /tmp/pyjobs.sock
+
+The frame formats are documented in src/server.zig and src/python/hostjob.py.
+"""
+
+import socket
+import struct
+import sys
+import time
+
+KIND_SCRIPT = 1
+KIND_CALL = 2
+FLAG_RESET = 1
+
+STATUS_NAMES = {0: 'ok', 1: 'exception', 2: 'timeout', 3: 'bad request', 4: 'runtime failure'}
+
+
+def _recv_exact(sock, n):
+    data = bytearray()
+    while len(data) < n:
+        chunk = sock.recv(n - len(data))
+        if not chunk:
+            raise ConnectionError('server closed the connection')
+        data += chunk
+    return bytes(data)
+
+
+def run_job(sock, kind, target, data=b'', timeout_ms=0, reset=False):
+    target = target.encode('utf-8')
+    payload = struct.pack('<BBI', kind, FLAG_RESET if reset else 0, timeout_ms)
+    payload += struct.pack('<I', len(target)) + target
+    payload += struct.pack('<I', len(data)) + data
+    sock.sendall(struct.pack('<I', len(payload)) + payload)
+
+    (length,) = struct.unpack('<I', _recv_exact(sock, 4))
+    reply = _recv_exact(sock, length)
+    status, elapsed_ns = struct.unpack_from('<BQ', reply, 0)
+    fields, offset = [], 9
+    for _ in range(3):
+        (n,) = struct.unpack_from('<I', reply, offset)
+        fields.append(reply[offset + 4:offset + 4 + n])
+        offset += 4 + n
+    return status, elapsed_ns, *fields
+
+
+def main():
+    path = sys.argv[1] if len(sys.argv) > 1 else '/tmp/pyjobs.sock'
+    with socket.socket(socket.AF_UNIX, socket.SOCK_STREAM) as sock:
+        sock.connect(path)
+
+        status, elapsed, out, err, result = run_job(
+            sock, KIND_SCRIPT, "print('hello from the guest')\nRESULT = INPUT[::-1]", b'abc')
+        print(STATUS_NAMES[status], f'{elapsed / 1e6:.2f} ms', out, result)
+
+        status, elapsed, out, err, result = run_job(sock, KIND_CALL, 'binascii:hexlify', b'abc')
+        print(STATUS_NAMES[status], f'{elapsed / 1e6:.2f} ms', result)
+
+        start = time.perf_counter()
+        for i in range(200):
+            run_job(sock, KIND_SCRIPT, 'RESULT = str(len(INPUT))', b'x' * i)
+        print(f'200 small jobs: {time.perf_counter() - start:.2f} s')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,106 @@
+/*
+ * zig_wasm_cpython.h - C API for the embeddable Python WASM runtime
+ *
+ * Link against libzig_wasm_cpython.a (built by `zig build`). A runtime owns
+ * the CPython WASI interpreter, its virtual filesystem and all host
+ * functions. Create it once, compile Python callables once, then call them
+ * as often as needed:
+ *
+ *     zwc_runtime* rt;
+ *     zwc_runtime_new(NULL, &rt);
+ *
+ *     const char src[] = "def upper(b):\n    return b.upper()\n";
+ *     uint32_t fn;
+ *     zwc_compile(rt, src, sizeof(src) - 1, "upper", 5, &fn);
+ *
+ *     uint8_t* out; size_t out_len;
+ *     if (zwc_call(rt, fn, (const uint8_t*)"abc", 3, &out, &out_len) == ZWC_OK) {
+ *         ...
+ *         zwc_buffer_free(out, out_len);
+ *     }
+ *
+ *     zwc_release(rt, fn);
+ *     zwc_runtime_free(rt);
+ *
+ * Runtimes are independent interpreters; several may exist at once, each
+ * used by one thread at a time. Calls on a runtime must not run
+ * concurrently.
+ */
+
+#ifndef ZIG_WASM_CPYTHON_H
+#define ZIG_WASM_CPYTHON_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Status codes returned by the zwc_* functions */
+#define ZWC_OK                   0
+#define ZWC_PYTHON_EXCEPTION     1 /* Python raised; see zwc_last_error */
+#define ZWC_SCRIPT_FAILED        2 /* zwc_run_string failed; Python printed the error */
+#define ZWC_INVALID_ARGUMENT     3
+#define ZWC_OUT_OF_MEMORY        4
+#define ZWC_HOSTCALL_UNAVAILABLE 5 /* Interpreter built without _hostcall */
+#define ZWC_RUNTIME_ERROR        6
+#define ZWC_DEADLINE_EXCEEDED    7 /* Interrupted by zwc_set_deadline's limits */
+
+typedef struct zwc_runtime zwc_runtime;
+
+/* Relative paths resolve against the executable's directory. The libraries
+ * loaded are those compile_library.py recorded in compiled_libs/. */
+typedef struct zwc_options {
+    const char* python_lib_path;    /* CPython Lib/ directory, or NULL */
+    const char* compiled_libs_path; /* compiled_libs/ directory, or NULL */
+    int debug;                      /* Verbose logging */
+} zwc_options;
+
+/* Create a runtime and initialize Python; options may be NULL */
+int zwc_runtime_new(const zwc_options* options, zwc_runtime** out);
+
+/* Finalize Python and free the runtime */
+void zwc_runtime_free(zwc_runtime* runtime);
+
+/*
+ * Limit the wall-clock and CPU time (on the calling thread, Linux only) of
+ * every later run, compile and call; 0 means no limit. A call that runs
+ * past a limit is interrupted and returns ZWC_DEADLINE_EXCEEDED. Returns
+ * ZWC_HOSTCALL_UNAVAILABLE if the interpreter or OS cannot enforce it.
+ */
+int zwc_set_deadline(zwc_runtime* runtime, uint32_t wall_ms, uint32_t cpu_ms);
+
+/* Add a file to the virtual filesystem (visible to Python under /vfs) */
+int zwc_add_file(zwc_runtime* runtime, const char* path, const uint8_t* data, size_t len);
+
+/* Run source in __main__, like PyRun_SimpleString */
+int zwc_run_string(zwc_runtime* runtime, const char* code, size_t len);
+
+/* Exec source in a fresh namespace and keep the callable bound to name */
+int zwc_compile(zwc_runtime* runtime,
+                const char* source, size_t source_len,
+                const char* name, size_t name_len,
+                uint32_t* callable);
+
+/*
+ * Call a compiled callable with a bytes argument. It must return a
+ * bytes-like object; the copy in *out is freed with zwc_buffer_free.
+ */
+int zwc_call(zwc_runtime* runtime, uint32_t callable,
+             const uint8_t* input, size_t input_len,
+             uint8_t** out, size_t* out_len);
+
+void zwc_buffer_free(uint8_t* buffer, size_t len);
+
+/* Drop a compiled callable */
+void zwc_release(zwc_runtime* runtime, uint32_t callable);
+
+/* Message of the last Python exception (not NUL-terminated) */
+const char* zwc_last_error(zwc_runtime* runtime, size_t* len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZIG_WASM_CPYTHON_H */
@@ -0,0 +1,136 @@
+// C ABI for the Embeddable Runtime
+//
+// Thin wrapper over runtime.zig for hosts written in C or anything with a
+// C FFI. Declarations are in include/zig_wasm_cpython.h; build.zig installs
+// them with the zig_wasm_cpython static library.
+//
+// Functions return a ZWC_* status code. Results are written through out
+// parameters; buffers returned by zwc_call are freed with zwc_buffer_free.
+
+const std = @import("std");
+const runtime_mod = @import("runtime.zig");
+const Runtime = runtime_mod.Runtime;
+
+/// Status codes, mirrored in zig_wasm_cpython.h
+const Status = enum(c_int) {
+    ok = 0,
+    /// Python raised; see zwc_last_error
+    python_exception = 1,
+    /// Script run with zwc_run_string failed (Python printed the error)
+    script_failed = 2,
+    invalid_argument = 3,
+    out_of_memory = 4,
+    /// The interpreter lacks the _hostcall extension
+    hostcall_unavailable = 5,
+    /// Any other runtime or VM failure
+    runtime_error = 6,
+    /// The call ran past the runtime's deadline and was interrupted
+    deadline_exceeded = 7,
+};
+
+fn toStatus(err: anyerror) c_int {
+    const status: Status = switch (err) {
+        error.PythonException => .python_exception,
+        error.ScriptFailed => .script_failed,
+        error.InvalidCallable, error.InputTooLarge => .invalid_argument,
+        error.OutOfMemory, error.GuestOutOfMemory => .out_of_memory,
+        error.HostcallUnavailable, error.DeadlinesUnavailable => .hostcall_unavailable,
+        error.DeadlineExceeded => .deadline_exceeded,
+        else => .runtime_error,
+    };
+    return @intFromEnum(status);
+}
+
+const ok: c_int = @intFromEnum(Status.ok);
+
+/// Mirrors struct zwc_options; NULL fields take the defaults
+const Options = extern struct {
+    python_lib_path: ?[*:0]const u8,
+    compiled_libs_path: ?[*:0]const u8,
+    debug: c_int,
+};
+
+const allocator = std.heap.c_allocator;
+
+/// struct zwc_runtime, the C view of a Runtime
+const Handle = opaque {};
+
+fn unwrap(handle: *Handle) *Runtime {
+    return @ptrCast(@alignCast(handle));
+}
+
+export fn zwc_runtime_new(options: ?*const Options, out: ?**Handle) c_int {
+    const out_ptr = out orelse return @intFromEnum(Status.invalid_argument);
+
+    var runtime_options = runtime_mod.Options{};
+    if (options) |opts| {
+        if (opts.python_lib_path) |path| runtime_options.python_lib_path = std.mem.span(path);
+        if (opts.compiled_libs_path) |path| runtime_options.compiled_libs_path = std.mem.span(path);
+        runtime_options.debug = opts.debug != 0;
+    }
+
+    const runtime = Runtime.init(allocator, runtime_options) catch |err| return toStatus(err);
+    out_ptr.* = @ptrCast(runtime);
+    return ok;
+}
+
+export fn zwc_runtime_free(handle: ?*Handle) void {
+    if (handle) |h| unwrap(h).deinit();
+}
+
+export fn zwc_set_deadline(handle: *Handle, wall_ms: u32, cpu_ms: u32) c_int {
+    unwrap(handle).setDeadline(.{ .wall_ms = wall_ms, .cpu_ms = cpu_ms }) catch |err| return toStatus(err);
+    return ok;
+}
+
+export fn zwc_add_file(handle: *Handle, path: [*:0]const u8, data: [*]const u8, len: usize) c_int {
+    unwrap(handle).vfs.createFile(std.mem.span(path), data[0..len]) catch |err| return toStatus(err);
+    return ok;
+}
+
+export fn zwc_run_string(handle: *Handle, code: [*]const u8, len: usize) c_int {
+    unwrap(handle).runString(code[0..len]) catch |err| return toStatus(err);
+    return ok;
+}
+
+export fn zwc_compile(
+    handle: *Handle,
+    source: [*]const u8,
+    source_len: usize,
+    name: [*]const u8,
+    name_len: usize,
+    out: *u32,
+) c_int {
+    out.* = unwrap(handle).compile(source[0..source_len], name[0..name_len]) catch |err| return toStatus(err);
+    return ok;
+}
+
+export fn zwc_call(
+    handle: *Handle,
+    callable: u32,
+    input: ?[*]const u8,
+    input_len: usize,
+    out: *?[*]u8,
+    out_len: *usize,
+) c_int {
+    const in: []const u8 = if (input) |ptr| ptr[0..input_len] else &.{};
+    const result = unwrap(handle).call(callable, in, allocator) catch |err| return toStatus(err);
+    out.* = result.ptr;
+    out_len.* = result.len;
+    return ok;
+}
+
+export fn zwc_buffer_free(buffer: ?[*]u8, len: usize) void {
+    if (buffer) |ptr| allocator.free(ptr[0..len]);
+}
+
+export fn zwc_release(handle: *Handle, callable: u32) void {
+    unwrap(handle).release(callable);
+}
+
+/// Last Python exception message; valid until the next call that raises
+export fn zwc_last_error(handle: *Handle, len: *usize) [*]const u8 {
+    const message = unwrap(handle).lastError();
+    len.* = message.len;
+    return message.ptr;
+}
@@ -0,0 +1,1186 @@
+// Deflate Codec
+//
+// Streaming DEFLATE (RFC 1951) encoder and decoder backing the host-side
+// zlib module. Both directions keep their entire state in the struct so the
+// guest can feed data in arbitrary chunks:
+// - Inflate decodes one unit (block header, symbol, stored run) at a time and
+//   rewinds to the last complete unit when the input runs out mid-unit
+// - Deflate runs greedy LZ77 over a 32 KiB window and emits fixed-Huffman
+//   blocks (stored blocks at level 0)
+// - zlib (RFC 1950) and gzip (RFC 1952) framing is selected with CPython's
+//   wbits convention
+//
+// std.compress.flate only offers a pull-based decoder over std.Io.Reader,
+// which cannot suspend when a chunk ends mid-symbol, so the codec lives here.
+
+const std = @import("std");
+const Allocator = std.mem.Allocator;
+const ArrayListUnmanaged = std.ArrayListUnmanaged;
+
+/// Size of the LZ77 history window (the deflate maximum)
+pub const window_size = 32768;
+
+const max_match = 258;
+const min_match = 3;
+
+/// Error types for codec operations
+pub const CodecError = error{
+    /// Bad wbits/level, or the stream was used after it finished
+    InvalidArgument,
+    /// Corrupt or truncated compressed data
+    InvalidData,
+    /// Trailer checksum or length did not match the decoded data
+    BadChecksum,
+    /// zlib stream requires a preset dictionary (not supported)
+    NeedDictionary,
+    OutOfMemory,
+};
+
+/// Framing around the raw deflate stream
+pub const Container = enum {
+    raw,
+    zlib,
+    gzip,
+    /// Decompression only: detect zlib or gzip from the first two bytes
+    auto,
+
+    /// Map CPython's wbits argument to a container
+    pub fn fromWbits(wbits: i32) CodecError!Container {
+        if (wbits >= -15 and wbits <= -8) return .raw;
+        if (wbits == 0 or (wbits >= 8 and wbits <= 15)) return .zlib;
+        if (wbits >= 24 and wbits <= 31) return .gzip;
+        if (wbits >= 40 and wbits <= 47) return .auto;
+        return error.InvalidArgument;
+    }
+};
+
+/// Flush modes, numbered like zlib's Z_* constants
+pub const Flush = enum {
+    none,
+    sync,
+    full,
+    finish,
+
+    pub fn fromZlib(mode: i32) CodecError!Flush {
+        return switch (mode) {
+            0 => .none,
+            1, 2, 5, 6 => .sync, // Z_PARTIAL_FLUSH, Z_SYNC_FLUSH, Z_BLOCK, Z_TREES
+            3 => .full,
+            4 => .finish,
+            else => error.InvalidArgument,
+        };
+    }
+};
+
+// ============================================================================
+// Checksums
+// ============================================================================
+
+/// CRC-32 (ISO-HDLC, as used by gzip and zlib.crc32) continuing from `value`
+pub fn crc32(value: u32, data: []const u8) u32 {
+    var crc = ~value;
+    for (data) |byte| {
+        crc = crc_table[@as(u8, @truncate(crc)) ^ byte] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+const crc_table = blk: {
+    @setEvalBranchQuota(10000);
+    var table: [256]u32 = undefined;
+    for (&table, 0..) |*entry, i| {
+        var crc: u32 = i;
+        for (0..8) |_| {
+            crc = if (crc & 1 != 0) 0xedb88320 ^ (crc >> 1) else crc >> 1;
+        }
+        entry.* = crc;
+    }
+    break :blk table;
+};
+
+/// Adler-32 (as used by zlib framing and zlib.adler32) continuing from `value`
+pub fn adler32(value: u32, data: []const u8) u32 {
+    const base = 65521;
+    // Largest n such that 255n(n+1)/2 + (n+1)(base-1) fits in a u32
+    const nmax = 5552;
+
+    var a: u32 = value & 0xffff;
+    var b: u32 = value >> 16;
+    var rest = data;
+    while (rest.len > 0) {
+        const n = @min(rest.len, nmax);
+        for (rest[0..n]) |byte| {
+            a += byte;
+            b += a;
+        }
+        a %= base;
+        b %= base;
+        rest = rest[n..];
+    }
+    return (b << 16) | a;
+}
+
+// ============================================================================
+// Static Tables (RFC 1951 section 3.2.5)
+// ============================================================================
+
+const length_base = [29]u16{ 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+const length_extra = [29]u5{ 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+const dist_base = [30]u16{ 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+const dist_extra = [30]u5{ 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+const code_length_order = [19]u8{ 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+
+fn reverseBits(code: u32, len: u5) u32 {
+    var result: u32 = 0;
+    var value = code;
+    for (0..len) |_| {
+        result = (result << 1) | (value & 1);
+        value >>= 1;
+    }
+    return result;
+}
+
+/// Code lengths of the fixed literal/length alphabet
+const fixed_lit_lengths = blk: {
+    var lengths: [288]u8 = undefined;
+    for (&lengths, 0..) |*len, symbol| {
+        len.* = if (symbol < 144) 8 else if (symbol < 256) 9 else if (symbol < 280) 7 else 8;
+    }
+    break :blk lengths;
+};
+
+/// Bit-reversed fixed literal/length codes, ready for an LSB-first writer
+const fixed_lit_codes = blk: {
+    @setEvalBranchQuota(20000);
+    var codes: [288]u16 = undefined;
+    for (&codes, 0..) |*code, symbol| {
+        const canonical: u32 = if (symbol < 144)
+            0x30 + symbol
+        else if (symbol < 256)
+            0x190 + (symbol - 144)
+        else if (symbol < 280)
+            symbol - 256
+        else
+            0xc0 + (symbol - 280);
+        code.* = reverseBits(canonical, fixed_lit_lengths[symbol]);
+    }
+    break :blk codes;
+};
+
+/// Length (3..258) to length-code index (0..28)
+const length_code_index = blk: {
+    var table: [max_match + 1]u8 = undefined;
+    var code: usize = 0;
+    for (min_match..max_match + 1) |len| {
+        while (code + 1 < length_base.len and length_base[code + 1] <= len) code += 1;
+        table[len] = code;
+    }
+    // 258 has its own code rather than being 227 + 31
+    table[max_match] = 28;
+    break :blk table;
+};
+
+fn distanceCodeIndex(distance: u32) usize {
+    var index: usize = dist_base.len - 1;
+    while (dist_base[index] > distance) index -= 1;
+    return index;
+}
+
+// ============================================================================
+// Bit Reader
+// ============================================================================
+
+/// Reads LSB-first bits from a byte slice without consuming on failure
+const BitReader = struct {
+    bytes: []const u8,
+    /// Absolute bit position
+    pos: usize,
+
+    fn available(self: *const BitReader) usize {
+        return self.bytes.len * 8 - self.pos;
+    }
+
+    /// Return the next n (<= 16) bits, zero-padded past the end of input
+    fn peek(self: *const BitReader, n: u5) u32 {
+        const byte = self.pos >> 3;
+        var window: u32 = 0;
+        var i: usize = 0;
+        while (i < 3 and byte + i < self.bytes.len) : (i += 1) {
+            window |= @as(u32, self.bytes[byte + i]) << @intCast(i * 8);
+        }
+        return (window >> @intCast(self.pos & 7)) & ((@as(u32, 1) << n) - 1);
+    }
+
+    fn bits(self: *BitReader, n: u5) error{NeedInput}!u32 {
+        if (n > self.available()) return error.NeedInput;
+        const value = self.peek(n);
+        self.pos += n;
+        return value;
+    }
+
+    fn skip(self: *BitReader, n: usize) error{NeedInput}!void {
+        if (n > self.available()) return error.NeedInput;
+        self.pos += n;
+    }
+
+    fn bitAt(self: *const BitReader, offset: usize) error{NeedInput}!u32 {
+        const p = self.pos + offset;
+        if (p >= self.bytes.len * 8) return error.NeedInput;
+        return (self.bytes[p >> 3] >> @intCast(p & 7)) & 1;
+    }
+
+    fn alignToByte(self: *BitReader) void {
+        self.pos = (self.pos + 7) & ~@as(usize, 7);
+    }
+
+    /// Read one whole byte (caller guarantees byte alignment)
+    fn byte(self: *BitReader) error{NeedInput}!u8 {
+        return @intCast(try self.bits(8));
+    }
+};
+
+// ============================================================================
+// Huffman Decoding
+// ============================================================================
+
+const fast_bits = 9;
+
+/// Canonical Huffman decoder with a direct lookup table for short codes
+const Huffman = struct {
+    /// Number of codes of each length
+    counts: [16]u16,
+    /// Symbols ordered by code
+    symbols: [288]u16,
+    /// (symbol << 4) | length for codes up to fast_bits long; 0 = use slow path
+    fast: [1 << fast_bits]u16,
+
+    fn build(self: *Huffman, lengths: []const u8) CodecError!void {
+        @memset(&self.counts, 0);
+        for (lengths) |len| self.counts[len] += 1;
+        self.counts[0] = 0;
+
+        // Over-subscribed codes are corrupt; incomplete ones are legal
+        // (e.g. a block with a single distance code)
+        var left: i32 = 1;
+        for (1..16) |len| {
+            left <<= 1;
+            left -= self.counts[len];
+            if (left < 0) return error.InvalidData;
+        }
+
+        var offsets: [16]u16 = undefined;
+        offsets[1] = 0;
+        for (1..15) |len| offsets[len + 1] = offsets[len] + self.counts[len];
+        for (lengths, 0..) |len, symbol| {
+            if (len != 0) {
+                self.symbols[offsets[len]] = @intCast(symbol);
+                offsets[len] += 1;
+            }
+        }
+
+        @memset(&self.fast, 0);
+        var code: u32 = 0;
+        var index: usize = 0;
+        for (1..fast_bits + 1) |len| {
+            for (0..self.counts[len]) |_| {
+                const entry: u16 = (self.symbols[index] << 4) | @as(u16, @intCast(len));
+                var slot = reverseBits(code, @intCast(len));
+                while (slot < self.fast.len) : (slot += @as(u32, 1) << @intCast(len)) {
+                    self.fast[slot] = entry;
+                }
+                code += 1;
+                index += 1;
+            }
+            code <<= 1;
+        }
+    }
+
+    /// Decode one symbol, leaving the reader untouched if the code is incomplete
+    fn decode(self: *const Huffman, br: *BitReader) (CodecError || error{NeedInput})!u16 {
+        const entry = self.fast[br.peek(fast_bits)];
+        if (entry != 0) {
+            try br.skip(entry & 0xf);
+            return entry >> 4;
+        }
+
+        // Codes longer than fast_bits: walk the canonical code one bit at a time
+        var code: i32 = 0;
+        var first: i32 = 0;
+        var index: i32 = 0;
+        var len: usize = 1;
+        while (len < 16) : (len += 1) {
+            code |= @intCast(try br.bitAt(len - 1));
+            const count: i32 = self.counts[len];
+            if (code - count < first) {
+                try br.skip(len);
+                return self.symbols[@intCast(index + (code - first))];
+            }
+            index += count;
+            first += count;
+            first <<= 1;
+            code <<= 1;
+        }
+        return error.InvalidData;
+    }
+};
+
+// ============================================================================
+// Inflate
+// ============================================================================
+
+/// Outcome of feeding input to a decoder
+pub const FeedResult = struct {
+    /// Bytes of the supplied input that were consumed
+    consumed: usize,
+    /// True once the end of the stream (including any trailer) was reached
+    finished: bool,
+};
+
+/// Streaming decompressor
+pub const Inflate = struct {
+    allocator: Allocator,
+    container: Container,
+    state: State,
+
+    /// Input carried over from the previous feed (an incomplete unit)
+    input: ArrayListUnmanaged(u8),
+    /// Bit offset into input[0] where decoding resumes
+    bit_offset: usize,
+
+    /// Decompressed bytes waiting to be read
+    output: ArrayListUnmanaged(u8),
+    /// Prefix of output already folded into checksum
+    checksum_pos: usize,
+    checksum: u32,
+
+    /// Last window_size bytes of output for back-references
+    window: [window_size]u8,
+    total_out: u64,
+
+    final_block: bool,
+    use_fixed: bool,
+    stored_remaining: u32,
+    /// Back-reference still being copied when output hit its limit
+    copy_length: u32,
+    copy_distance: u32,
+
+    lit: Huffman,
+    dist: Huffman,
+    fixed_lit: Huffman,
+    fixed_dist: Huffman,
+
+    const State = enum {
+        header,
+        block_header,
+        stored,
+        codes,
+        trailer,
+        done,
+    };
+
+    const Stop = enum {
+        need_input,
+        output_full,
+        done,
+    };
+
+    pub fn init(allocator: Allocator, container: Container) CodecError!*Inflate {
+        const self = allocator.create(Inflate) catch return error.OutOfMemory;
+        self.* = .{
+            .allocator = allocator,
+            .container = container,
+            .state = .header,
+            .input = .empty,
+            .bit_offset = 0,
+            .output = .empty,
+            .checksum_pos = 0,
+            .checksum = 0,
+            .window = undefined,
+            .total_out = 0,
+            .final_block = false,
+            .use_fixed = false,
+            .stored_remaining = 0,
+            .copy_length = 0,
+            .copy_distance = 0,
+            .lit = undefined,
+            .dist = undefined,
+            .fixed_lit = undefined,
+            .fixed_dist = undefined,
+        };
+
+        try self.fixed_lit.build(&fixed_lit_lengths);
+        try self.fixed_dist.build(&([_]u8{5} ** 30));
+        return self;
+    }
+
+    pub fn deinit(self: *Inflate) void {
+        self.input.deinit(self.allocator);
+        self.output.deinit(self.allocator);
+        self.allocator.destroy(self);
+    }
+
+    /// Deep copy, including pending input and output
+    pub fn clone(self: *const Inflate) CodecError!*Inflate {
+        const copy = self.allocator.create(Inflate) catch return error.OutOfMemory;
+        copy.* = self.*;
+        copy.input = self.input.clone(self.allocator) catch {
+            self.allocator.destroy(copy);
+            return error.OutOfMemory;
+        };
+        copy.output = self.output.clone(self.allocator) catch {
+            copy.input.deinit(self.allocator);
+            self.allocator.destroy(copy);
+            return error.OutOfMemory;
+        };
+        return copy;
+    }
+
+    /// Whether the end of the stream has been reached
+    pub fn isFinished(self: *const Inflate) bool {
+        return self.state == .done;
+    }
+
+    /// Number of decompressed bytes waiting to be read
+    pub fn pending(self: *const Inflate) usize {
+        return self.output.items.len;
+    }
+
+    /// Move up to buf.len pending bytes into buf
+    pub fn read(self: *Inflate, buf: []u8) usize {
+        const n = drainPending(&self.output, buf);
+        self.checksum_pos = self.output.items.len;
+        return n;
+    }
+
+    /// Decode as much of `data` as possible.
+    /// Stops early once `max_output` bytes are pending (0 = no limit); the
+    /// unconsumed remainder must be fed again later.
+    pub fn feed(self: *Inflate, data: []const u8, max_output: usize) CodecError!FeedResult {
+        if (self.state == .done) {
+            return .{ .consumed = 0, .finished = true };
+        }
+
+        const carried = self.input.items.len;
+        self.input.appendSlice(self.allocator, data) catch return error.OutOfMemory;
+
+        const limit = if (max_output == 0) std.math.maxInt(usize) else max_output;
+        var br = BitReader{ .bytes = self.input.items, .pos = self.bit_offset };
+
+        const stop = try self.run(&br, limit);
+        self.foldChecksum();
+
+        const cp_byte = br.pos >> 3;
+        const partial_bit = br.pos & 7;
+
+        if (stop == .need_input) {
+            // Everything was taken; keep the incomplete unit for next time
+            self.keepInput(cp_byte, self.input.items.len, partial_bit);
+            return .{ .consumed = data.len, .finished = false };
+        }
+
+        // Hand back input that was never looked at. Bytes carried from an
+        // earlier feed were already reported as consumed, so they stay.
+        const used = @max(cp_byte + @intFromBool(partial_bit != 0), carried);
+        self.keepInput(cp_byte, used, partial_bit);
+        return .{ .consumed = used - carried, .finished = stop == .done };
+    }
+
+    fn keepInput(self: *Inflate, start: usize, end: usize, bit_offset: usize) void {
+        const kept = end - start;
+        std.mem.copyForwards(u8, self.input.items[0..kept], self.input.items[start..end]);
+        self.input.shrinkRetainingCapacity(kept);
+        self.bit_offset = if (kept == 0) 0 else bit_offset;
+    }
+
+    fn run(self: *Inflate, br: *BitReader, limit: usize) CodecError!Stop {
+        while (true) {
+            if (self.copy_length > 0) {
+                if (self.output.items.len >= limit) return .output_full;
+                try self.drainCopy(limit);
+                continue;
+            }
+            if (self.state == .done) return .done;
+            if (self.output.items.len >= limit) return .output_full;
+
+            const checkpoint = br.pos;
+            self.step(br, limit) catch |err| switch (err) {
+                error.NeedInput => {
+                    br.pos = checkpoint;
+                    return .need_input;
+                },
+                else => |e| return e,
+            };
+        }
+    }
+
+    /// Decode one atomic unit. All reads happen before any state changes so
+    /// that a NeedInput part-way through can simply be rewound.
+    fn step(self: *Inflate, br: *BitReader, limit: usize) (CodecError || error{NeedInput})!void {
+        switch (self.state) {
+            .header => try self.readHeader(br),
+            .block_header => try self.readBlockHeader(br),
+            .stored => {
+                if (self.stored_remaining == 0) {
+                    self.endBlock();
+                    return;
+                }
+                const available = br.bytes.len - (br.pos >> 3);
+                const room = limit - self.output.items.len;
+                const n = @min(@min(self.stored_remaining, available), room);
+                if (n == 0) return error.NeedInput;
+                const start = br.pos >> 3;
+                try self.emitSlice(br.bytes[start..][0..n]);
+                br.pos += n * 8;
+                self.stored_remaining -= @intCast(n);
+            },
+            .codes => try self.decodeSymbol(br),
+            .trailer => try self.readTrailer(br),
+            .done => {},
+        }
+    }
+
+    fn readHeader(self: *Inflate, br: *BitReader) (CodecError || error{NeedInput})!void {
+        var container = self.container;
+        if (container == .auto) {
+            if (br.available() < 16) return error.NeedInput;
+            container = if (br.peek(16) == 0x8b1f) .gzip else .zlib;
+        }
+
+        switch (container) {
+            .raw, .auto => {},
+            .zlib => {
+                const cmf = try br.byte();
+                const flg = try br.byte();
+                if ((@as(u16, cmf) << 8 | flg) % 31 != 0) return error.InvalidData;
+                if (cmf & 0x0f != 8 or cmf >> 4 > 7) return error.InvalidData;
+                if (flg & 0x20 != 0) return error.NeedDictionary;
+                self.checksum = 1;
+            },
+            .gzip => {
+                if (try br.byte() != 0x1f or try br.byte() != 0x8b) return error.InvalidData;
+                if (try br.byte() != 8) return error.InvalidData;
+                const flags = try br.byte();
+                try br.skip(6 * 8); // mtime, xfl, os
+                if (flags & 0x04 != 0) { // FEXTRA
+                    const xlen = try br.bits(16);
+                    try br.skip(@as(usize, xlen) * 8);
+                }
+                if (flags & 0x08 != 0) while (try br.byte() != 0) {}; // FNAME
+                if (flags & 0x10 != 0) while (try br.byte() != 0) {}; // FCOMMENT
+                if (flags & 0x02 != 0) try br.skip(16); // FHCRC
+                self.checksum = 0;
+            },
+        }
+
+        self.container = container;
+        self.state = .block_header;
+    }
+
+    fn readBlockHeader(self: *Inflate, br: *BitReader) (CodecError || error{NeedInput})!void {
+        const final_block = try br.bits(1) == 1;
+        switch (try br.bits(2)) {
+            0 => {
+                br.alignToByte();
+                const len = try br.bits(16);
+                const nlen = try br.bits(16);
+                if (len != ~nlen & 0xffff) return error.InvalidData;
+                self.stored_remaining = len;
+                self.state = .stored;
+            },
+            1 => {
+                self.use_fixed = true;
+                self.state = .codes;
+            },
+            2 => {
+                try self.readDynamicTables(br);
+                self.use_fixed = false;
+                self.state = .codes;
+            },
+            else => return error.InvalidData,
+        }
+        self.final_block = final_block;
+    }
+
+    fn readDynamicTables(self: *Inflate, br: *BitReader) (CodecError || error{NeedInput})!void {
+        const hlit = try br.bits(5) + 257;
+        const hdist = try br.bits(5) + 1;
+        const hclen = try br.bits(4) + 4;
+        if (hlit > 286 or hdist > 30) return error.InvalidData;
+
+        var cl_lengths = [_]u8{0} ** 19;
+        for (code_length_order[0..hclen]) |symbol| {
+            cl_lengths[symbol] = @intCast(try br.bits(3));
+        }
+        var cl_huffman: Huffman = undefined;
+        try cl_huffman.build(&cl_lengths);
+
+        var lengths = [_]u8{0} ** (286 + 30);
+        const total = hlit + hdist;
+        var i: usize = 0;
+        while (i < total) {
+            const symbol = try cl_huffman.decode(br);
+            if (symbol < 16) {
+                lengths[i] = @intCast(symbol);
+                i += 1;
+                continue;
+            }
+            const repeat_value: u8 = if (symbol == 16) blk: {
+                if (i == 0) return error.InvalidData;
+                break :blk lengths[i - 1];
+            } else 0;
+            const repeat: usize = switch (symbol) {
+                16 => 3 + try br.bits(2),
+                17 => 3 + try br.bits(3),
+                18 => 11 + try br.bits(7),
+                else => return error.InvalidData,
+            };
+            if (i + repeat > total) return error.InvalidData;
+            @memset(lengths[i..][0..repeat], repeat_value);
+            i += repeat;
+        }
+
+        // The end-of-block code must be present
+        if (lengths[256] == 0) return error.InvalidData;
+
+        // Tables are only replaced once the whole header has been read
+        try self.lit.build(lengths[0..hlit]);
+        try self.dist.build(lengths[hlit..total]);
+    }
+
+    fn decodeSymbol(self: *Inflate, br: *BitReader) (CodecError || error{NeedInput})!void {
+        const lit_table = if (self.use_fixed) &self.fixed_lit else &self.lit;
+        const dist_table = if (self.use_fixed) &self.fixed_dist else &self.dist;
+
+        const symbol = try lit_table.decode(br);
+        if (symbol < 256) {
+            try self.emitSlice(&[_]u8{@intCast(symbol)});
+            return;
+        }
+        if (symbol == 256) {
+            self.endBlock();
+            return;
+        }
+
+        const length_index = symbol - 257;
+        if (length_index >= length_base.len) return error.InvalidData;
+        const length = length_base[length_index] + try br.bits(length_extra[length_index]);
+
+        const dist_symbol = try dist_table.decode(br);
+        if (dist_symbol >= dist_base.len) return error.InvalidData;
+        const distance = dist_base[dist_symbol] + try br.bits(dist_extra[dist_symbol]);
+        if (distance > self.total_out) return error.InvalidData;
+
+        self.copy_length = length;
+        self.copy_distance = distance;
+    }
+
+    fn readTrailer(self: *Inflate, br: *BitReader) (CodecError || error{NeedInput})!void {
+        br.alignToByte();
+        self.foldChecksum();
+
+        switch (self.container) {
+            .raw, .auto => {},
+            .zlib => {
+                var expected: u32 = 0;
+                for (0..4) |_| expected = (expected << 8) | try br.byte();
+                if (expected != self.checksum) return error.BadChecksum;
+            },
+            .gzip => {
+                var expected_crc: u32 = 0;
+                var expected_size: u32 = 0;
+                for (0..4) |i| expected_crc |= @as(u32, try br.byte()) << @intCast(i * 8);
+                for (0..4) |i| expected_size |= @as(u32, try br.byte()) << @intCast(i * 8);
+                if (expected_crc != self.checksum) return error.BadChecksum;
+                if (expected_size != @as(u32, @truncate(self.total_out))) return error.BadChecksum;
+            },
+        }
+        self.state = .done;
+    }
+
+    fn endBlock(self: *Inflate) void {
+        self.state = if (self.final_block) .trailer else .block_header;
+    }
+
+    fn drainCopy(self: *Inflate, limit: usize) CodecError!void {
+        const room = limit - self.output.items.len;
+        const n = @min(self.copy_length, room);
+        self.output.ensureUnusedCapacity(self.allocator, n) catch return error.OutOfMemory;
+        for (0..n) |_| {
+            const b = self.window[@intCast((self.total_out - self.copy_distance) % window_size)];
+            self.window[@intCast(self.total_out % window_size)] = b;
+            self.total_out += 1;
+            self.output.appendAssumeCapacity(b);
+        }
+        self.copy_length -= @intCast(n);
+    }
+
+    fn emitSlice(self: *Inflate, bytes: []const u8) CodecError!void {
+        self.output.appendSlice(self.allocator, bytes) catch return error.OutOfMemory;
+        for (bytes) |b| {
+            self.window[@intCast(self.total_out % window_size)] = b;
+            self.total_out += 1;
+        }
+    }
+
+    fn foldChecksum(self: *Inflate) void {
+        const fresh = self.output.items[self.checksum_pos..];
+        switch (self.container) {
+            .zlib => self.checksum = adler32(self.checksum, fresh),
+            .gzip => self.checksum = crc32(self.checksum, fresh),
+            .raw, .auto => {},
+        }
+        self.checksum_pos = self.output.items.len;
+    }
+};
+
+// ============================================================================
+// Deflate
+// ============================================================================
+
+const hash_bits = 15;
+const hash_size = 1 << hash_bits;
+
+/// Match search effort per level (greedy matching only)
+const LevelConfig = struct {
+    max_chain: u16,
+    nice_length: u16,
+};
+
+const level_configs = [10]LevelConfig{
+    .{ .max_chain = 0, .nice_length = 0 }, // stored
+    .{ .max_chain = 4, .nice_length = 8 },
+    .{ .max_chain = 4, .nice_length = 16 },
+    .{ .max_chain = 8, .nice_length = 32 },
+    .{ .max_chain = 16, .nice_length = 32 },
+    .{ .max_chain = 32, .nice_length = 64 },
+    .{ .max_chain = 128, .nice_length = 128 },
+    .{ .max_chain = 256, .nice_length = 128 },
+    .{ .max_chain = 1024, .nice_length = 258 },
+    .{ .max_chain = 4096, .nice_length = 258 },
+};
+
+/// Streaming compressor
+pub const Deflate = struct {
+    allocator: Allocator,
+    container: Container,
+    level: u4,
+
+    /// Up to window_size bytes of history followed by not-yet-encoded input
+    buffer: ArrayListUnmanaged(u8),
+    /// Index in buffer of the first byte not yet encoded
+    cursor: usize,
+    /// Absolute stream offset of buffer[0]
+    base: u64,
+
+    /// Hash chains: absolute position + 1 of the latest/previous occurrence (0 = none)
+    head: [hash_size]u64,
+    prev: [window_size]u64,
+
+    /// Compressed bytes waiting to be read
+    output: ArrayListUnmanaged(u8),
+    bit_buffer: u64,
+    bit_count: u6,
+
+    header_written: bool,
+    block_open: bool,
+    finished: bool,
+    checksum: u32,
+    total_in: u64,
+
+    /// level is zlib's 0-9, or -1 for the default (6)
+    pub fn init(allocator: Allocator, container: Container, level: i32) CodecError!*Deflate {
+        if (container == .auto) return error.InvalidArgument;
+        if (level < -1 or level > 9) return error.InvalidArgument;
+
+        const self = allocator.create(Deflate) catch return error.OutOfMemory;
+        self.* = .{
+            .allocator = allocator,
+            .container = container,
+            .level = if (level == -1) 6 else @intCast(level),
+            .buffer = .empty,
+            .cursor = 0,
+            .base = 0,
+            .head = undefined,
+            .prev = undefined,
+            .output = .empty,
+            .bit_buffer = 0,
+            .bit_count = 0,
+            .header_written = false,
+            .block_open = false,
+            .finished = false,
+            .checksum = if (container == .zlib) 1 else 0,
+            .total_in = 0,
+        };
+        @memset(&self.head, 0);
+        return self;
+    }
+
+    pub fn deinit(self: *Deflate) void {
+        self.buffer.deinit(self.allocator);
+        self.output.deinit(self.allocator);
+        self.allocator.destroy(self);
+    }
+
+    /// Deep copy, including history and pending output
+    pub fn clone(self: *const Deflate) CodecError!*Deflate {
+        const copy = self.allocator.create(Deflate) catch return error.OutOfMemory;
+        copy.* = self.*;
+        copy.buffer = self.buffer.clone(self.allocator) catch {
+            self.allocator.destroy(copy);
+            return error.OutOfMemory;
+        };
+        copy.output = self.output.clone(self.allocator) catch {
+            copy.buffer.deinit(self.allocator);
+            self.allocator.destroy(copy);
+            return error.OutOfMemory;
+        };
+        return copy;
+    }
+
+    /// Number of compressed bytes waiting to be read
+    pub fn pending(self: *const Deflate) usize {
+        return self.output.items.len;
+    }
+
+    /// Move up to buf.len pending bytes into buf
+    pub fn read(self: *Deflate, buf: []u8) usize {
+        return drainPending(&self.output, buf);
+    }
+
+    /// Add input; encodes everything except a lookahead tail kept for matching
+    pub fn write(self: *Deflate, data: []const u8) CodecError!void {
+        if (self.finished) return error.InvalidArgument;
+
+        self.buffer.appendSlice(self.allocator, data) catch return error.OutOfMemory;
+        self.total_in += data.len;
+        self.checksum = switch (self.container) {
+            .zlib => adler32(self.checksum, data),
+            .gzip => crc32(self.checksum, data),
+            .raw, .auto => self.checksum,
+        };
+
+        try self.encode(false);
+    }
+
+    /// Encode all buffered input and emit the requested flush marker
+    pub fn flush(self: *Deflate, mode: Flush) CodecError!void {
+        if (self.finished) {
+            // Flushing a finished stream is a no-op, like zlib
+            return;
+        }
+
+        try self.encode(true);
+
+        switch (mode) {
+            .none => {},
+            .sync, .full => {
+                try self.closeBlock();
+                // Empty stored block: byte-aligns the stream (00 00 ff ff)
+                try self.writeBits(0, 3);
+                try self.alignToByte();
+                try self.writeBytes(&[_]u8{ 0x00, 0x00, 0xff, 0xff });
+                if (mode == .full) @memset(&self.head, 0);
+            },
+            .finish => {
+                try self.closeBlock();
+                // Empty final fixed block: BFINAL=1, BTYPE=01, end-of-block
+                try self.writeBits(0b011, 3);
+                try self.writeBits(fixed_lit_codes[256], fixed_lit_lengths[256]);
+                try self.alignToByte();
+                try self.writeTrailer();
+                self.finished = true;
+            },
+        }
+    }
+
+    fn encode(self: *Deflate, flush_all: bool) CodecError!void {
+        try self.writeHeader();
+
+        if (self.level == 0) {
+            try self.encodeStored(flush_all);
+        } else {
+            try self.encodeLz77(flush_all);
+        }
+
+        self.slideWindow();
+    }
+
+    fn encodeStored(self: *Deflate, flush_all: bool) CodecError!void {
+        while (true) {
+            const remaining = self.buffer.items.len - self.cursor;
+            if (remaining == 0 or (!flush_all and remaining < 0xffff)) break;
+
+            const n: u16 = @intCast(@min(remaining, 0xffff));
+            try self.closeBlock();
+            try self.writeBits(0, 3); // BFINAL=0, BTYPE=00
+            try self.alignToByte();
+            try self.writeBytes(&[_]u8{ @truncate(n), @truncate(n >> 8), @truncate(~n), @truncate(~n >> 8) });
+            try self.writeBytes(self.buffer.items[self.cursor..][0..n]);
+            self.cursor += n;
+        }
+    }
+
+    fn encodeLz77(self: *Deflate, flush_all: bool) CodecError!void {
+        const data = self.buffer.items;
+        const end = if (flush_all) data.len else data.len -| max_match;
+        const config = level_configs[self.level];
+
+        while (self.cursor < end) {
+            const match = self.findMatch(self.cursor, config);
+            if (match.length >= min_match) {
+                try self.writeMatch(match.length, match.distance);
+                for (0..match.length) |i| self.insertHash(self.cursor + i);
+                self.cursor += match.length;
+            } else {
+                try self.writeLiteral(data[self.cursor]);
+                self.insertHash(self.cursor);
+                self.cursor += 1;
+            }
+        }
+    }
+
+    const Match = struct {
+        length: u32,
+        distance: u32,
+    };
+
+    fn hashAt(data: []const u8, pos: usize) usize {
+        const h = (@as(u32, data[pos]) << 10) ^ (@as(u32, data[pos + 1]) << 5) ^ data[pos + 2];
+        return h & (hash_size - 1);
+    }
+
+    fn insertHash(self: *Deflate, pos: usize) void {
+        const data = self.buffer.items;
+        if (pos + min_match > data.len) return;
+        const h = hashAt(data, pos);
+        const abs = self.base + pos;
+        self.prev[@intCast(abs % window_size)] = self.head[h];
+        self.head[h] = abs + 1;
+    }
+
+    fn findMatch(self: *const Deflate, pos: usize, config: LevelConfig) Match {
+        const data = self.buffer.items;
+        var best = Match{ .length = 0, .distance = 0 };
+        if (pos + min_match > data.len) return best;
+
+        const max_len: u32 = @intCast(@min(max_match, data.len - pos));
+        const abs = self.base + pos;
+        var candidate = self.head[hashAt(data, pos)];
+        var chain = config.max_chain;
+
+        while (candidate != 0 and chain > 0) : (chain -= 1) {
+            const cand_abs = candidate - 1;
+            if (cand_abs < self.base or abs - cand_abs > window_size) break;
+
+            const cand_pos: usize = @intCast(cand_abs - self.base);
+            var len: u32 = 0;
+            while (len < max_len and data[cand_pos + len] == data[pos + len]) len += 1;
+
+            if (len > best.length) {
+                best = .{ .length = len, .distance = @intCast(abs - cand_abs) };
+                if (len >= config.nice_length or len == max_len) break;
+            }
+            candidate = self.prev[@intCast(cand_abs % window_size)];
+        }
+        return best;
+    }
+
+    /// Drop history older than the window once enough has been encoded
+    fn slideWindow(self: *Deflate) void {
+        if (self.cursor <= 2 * window_size) return;
+        const drop = self.cursor - window_size;
+        const remaining = self.buffer.items.len - drop;
+        std.mem.copyForwards(u8, self.buffer.items[0..remaining], self.buffer.items[drop..]);
+        self.buffer.shrinkRetainingCapacity(remaining);
+        self.cursor -= drop;
+        self.base += drop;
+    }
+
+    fn openBlock(self: *Deflate) CodecError!void {
+        if (self.block_open) return;
+        try self.writeBits(0b010, 3); // BFINAL=0, BTYPE=01 (fixed Huffman)
+        self.block_open = true;
+    }
+
+    fn closeBlock(self: *Deflate) CodecError!void {
+        if (!self.block_open) return;
+        try self.writeBits(fixed_lit_codes[256], fixed_lit_lengths[256]);
+        self.block_open = false;
+    }
+
+    fn writeLiteral(self: *Deflate, byte: u8) CodecError!void {
+        try self.openBlock();
+        try self.writeBits(fixed_lit_codes[byte], @intCast(fixed_lit_lengths[byte]));
+    }
+
+    fn writeMatch(self: *Deflate, length: u32, distance: u32) CodecError!void {
+        try self.openBlock();
+
+        const li: usize = length_code_index[length];
+        try self.writeBits(fixed_lit_codes[257 + li], @intCast(fixed_lit_lengths[257 + li]));
+        try self.writeBits(length - length_base[li], length_extra[li]);
+
+        const di = distanceCodeIndex(distance);
+        try self.writeBits(reverseBits(@intCast(di), 5), 5);
+        try self.writeBits(distance - dist_base[di], dist_extra[di]);
+    }
+
+    fn writeBits(self: *Deflate, value: u32, count: u6) CodecError!void {
+        self.bit_buffer |= @as(u64, value) << self.bit_count;
+        self.bit_count += count;
+        while (self.bit_count >= 8) {
+            self.output.append(self.allocator, @truncate(self.bit_buffer)) catch return error.OutOfMemory;
+            self.bit_buffer >>= 8;
+            self.bit_count -= 8;
+        }
+    }
+
+    fn alignToByte(self: *Deflate) CodecError!void {
+        if (self.bit_count > 0) {
+            self.output.append(self.allocator, @truncate(self.bit_buffer)) catch return error.OutOfMemory;
+        }
+        self.bit_buffer = 0;
+        self.bit_count = 0;
+    }
+
+    fn writeBytes(self: *Deflate, bytes: []const u8) CodecError!void {
+        self.output.appendSlice(self.allocator, bytes) catch return error.OutOfMemory;
+    }
+
+    fn writeHeader(self: *Deflate) CodecError!void {
+        if (self.header_written) return;
+        self.header_written = true;
+
+        switch (self.container) {
+            .raw, .auto => {},
+            .zlib => {
+                // FLEVEL hint in FLG, with FCHECK making the pair a multiple of 31
+                const flg: u8 = switch (self.level) {
+                    0, 1 => 0x01,
+                    2, 3, 4, 5 => 0x5e,
+                    6 => 0x9c,
+                    else => 0xda,
+                };
+                try self.writeBytes(&[_]u8{ 0x78, flg });
+            },
+            .gzip => {
+                const xfl: u8 = if (self.level == 9) 2 else if (self.level == 1) 4 else 0;
+                try self.writeBytes(&[_]u8{ 0x1f, 0x8b, 8, 0, 0, 0, 0, 0, xfl, 3 });
+            },
+        }
+    }
+
+    fn writeTrailer(self: *Deflate) CodecError!void {
+        var trailer: [8]u8 = undefined;
+        switch (self.container) {
+            .raw, .auto => {},
+            .zlib => {
+                std.mem.writeInt(u32, trailer[0..4], self.checksum, .big);
+                try self.writeBytes(trailer[0..4]);
+            },
+            .gzip => {
+                std.mem.writeInt(u32, trailer[0..4], self.checksum, .little);
+                std.mem.writeInt(u32, trailer[4..8], @truncate(self.total_in), .little);
+                try self.writeBytes(&trailer);
+            },
+        }
+    }
+};
+
+/// Copy the front of a pending buffer into buf and shift the rest down
+fn drainPending(list: *ArrayListUnmanaged(u8), buf: []u8) usize {
+    const n = @min(buf.len, list.items.len);
+    @memcpy(buf[0..n], list.items[0..n]);
+    const remaining = list.items.len - n;
+    std.mem.copyForwards(u8, list.items[0..remaining], list.items[n..]);
+    list.shrinkRetainingCapacity(remaining);
+    return n;
+}
+
+// Tests
+test "deflate checksums" {
+    try std.testing.expectEqual(@as(u32, 0x3610a686), crc32(0, "hello"));
+    try std.testing.expectEqual(@as(u32, 0x062c0215), adler32(1, "hello"));
+    // Continuing from a previous value matches a single pass
+    try std.testing.expectEqual(crc32(0, "hello world"), crc32(crc32(0, "hello "), "world"));
+}
+
+test "inflate zlib stream produced by CPython" {
+    const allocator = std.testing.allocator;
+
+    // zlib.compress(b"hello")
+    const compressed = "x\x9c\xcbH\xcd\xc9\xc9\x07\x00\x06,\x02\x15";
+
+    var inflate = try Inflate.init(allocator, .zlib);
+    defer inflate.deinit();
+
+    // Feed one byte at a time to exercise rewinding
+    for (compressed) |byte| {
+        const result = try inflate.feed(&[_]u8{byte}, 0);
+        try std.testing.expectEqual(@as(usize, 1), result.consumed);
+    }
+    try std.testing.expect(inflate.isFinished());
+
+    var buf: [16]u8 = undefined;
+    const n = inflate.read(&buf);
+    try std.testing.expectEqualSlices(u8, "hello", buf[0..n]);
+}
+
+test "deflate round trip through every container" {
+    const allocator = std.testing.allocator;
+
+    var text: [10000]u8 = undefined;
+    for (&text, 0..) |*b, i| b.* = "the quick brown fox "[i % 20] ^ @as(u8, @intCast(i / 997));
+
+    for ([_]Container{ .raw, .zlib, .gzip }) |container| {
+        for ([_]i32{ 0, 1, 6, 9 }) |level| {
+            var deflate = try Deflate.init(allocator, container, level);
+            defer deflate.deinit();
+            try deflate.write(text[0..4000]);
+            try deflate.write(text[4000..]);
+            try deflate.flush(.finish);
+
+            const compressed = try allocator.alloc(u8, deflate.pending());
+            defer allocator.free(compressed);
+            _ = deflate.read(compressed);
+
+            var inflate = try Inflate.init(allocator, if (container == .raw) .raw else .auto);
+            defer inflate.deinit();
+            const result = try inflate.feed(compressed, 0);
+            try std.testing.expect(result.finished);
+            try std.testing.expectEqual(compressed.len, result.consumed);
+
+            const decompressed = try allocator.alloc(u8, inflate.pending());
+            defer allocator.free(decompressed);
+            _ = inflate.read(decompressed);
+            try std.testing.expectEqualSlices(u8, &text, decompressed);
+        }
+    }
+}
+
+test "inflate respects output limit" {
+    const allocator = std.testing.allocator;
+
+    var deflate = try Deflate.init(allocator, .zlib, 6);
+    defer deflate.deinit();
+    try deflate.write("a" ** 1000);
+    try deflate.flush(.finish);
+    var compressed: [64]u8 = undefined;
+    const compressed_len = deflate.read(&compressed);
+
+    var inflate = try Inflate.init(allocator, .zlib);
+    defer inflate.deinit();
+
+    var total: usize = 0;
+    var input: []const u8 = compressed[0..compressed_len];
+    var buf: [100]u8 = undefined;
+    while (!inflate.isFinished()) {
+        const result = try inflate.feed(input, buf.len);
+        input = input[result.consumed..];
+        try std.testing.expect(inflate.pending() <= buf.len);
+        total += inflate.read(&buf);
+    }
+    total += inflate.read(&buf);
+    try std.testing.expectEqual(@as(usize, 1000), total);
+    try std.testing.expectEqual(@as(usize, 0), input.len);
+}
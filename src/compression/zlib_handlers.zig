@@ -0,0 +1,423 @@
+const std = @import("std");
+const zware = @import("zware");
+const deflate = @import("deflate.zig");
+const Deflate = deflate.Deflate;
+const Inflate = deflate.Inflate;
+const Container = deflate.Container;
+const CodecError = deflate.CodecError;
+
+/// Status codes returned to the guest, numbered like zlib's Z_* values so the
+/// Python wrapper can report them verbatim ("Error -3 while decompressing")
+pub const ZlibStatus = enum(i32) {
+    ok = 0,
+    need_dict = 2,
+    stream_error = -2,
+    data_error = -3,
+    mem_error = -4,
+};
+
+pub const StreamHandle = u32;
+
+/// A compressor or decompressor owned by the guest
+pub const Stream = union(enum) {
+    compress: *Deflate,
+    decompress: *Inflate,
+
+    fn deinit(self: Stream) void {
+        switch (self) {
+            .compress => |d| d.deinit(),
+            .decompress => |i| i.deinit(),
+        }
+    }
+
+    fn clone(self: Stream) CodecError!Stream {
+        return switch (self) {
+            .compress => |d| .{ .compress = try d.clone() },
+            .decompress => |i| .{ .decompress = try i.clone() },
+        };
+    }
+
+    fn read(self: Stream, buf: []u8) usize {
+        return switch (self) {
+            .compress => |d| d.read(buf),
+            .decompress => |i| i.read(buf),
+        };
+    }
+};
+
+/// Live streams of one runtime, keyed by the handle given to the guest.
+/// Used only by the thread running that runtime, so it takes no lock.
+pub const StreamTable = struct {
+    streams: std.AutoHashMap(StreamHandle, Stream),
+    next_handle: StreamHandle,
+    allocator: std.mem.Allocator,
+    /// Copies of the streams taken by checkpoint(), for restore()
+    saved: ?Saved,
+
+    const Saved = struct {
+        streams: std.AutoHashMap(StreamHandle, Stream),
+        next_handle: StreamHandle,
+    };
+
+    pub fn init(allocator: std.mem.Allocator) StreamTable {
+        return StreamTable{
+            .streams = std.AutoHashMap(StreamHandle, Stream).init(allocator),
+            .next_handle = 1,
+            .allocator = allocator,
+            .saved = null,
+        };
+    }
+
+    pub fn deinit(self: *StreamTable) void {
+        freeStreams(&self.streams);
+        if (self.saved) |*saved| freeStreams(&saved.streams);
+    }
+
+    fn freeStreams(streams: *std.AutoHashMap(StreamHandle, Stream)) void {
+        var iter = streams.valueIterator();
+        while (iter.next()) |stream| stream.deinit();
+        streams.deinit();
+    }
+
+    /// Deep copy of a map of streams
+    fn cloneStreams(self: *StreamTable, streams: *const std.AutoHashMap(StreamHandle, Stream)) !std.AutoHashMap(StreamHandle, Stream) {
+        var copy = std.AutoHashMap(StreamHandle, Stream).init(self.allocator);
+        errdefer freeStreams(&copy);
+        try copy.ensureTotalCapacity(streams.count());
+
+        var iter = streams.iterator();
+        while (iter.next()) |entry| {
+            copy.putAssumeCapacityNoClobber(entry.key_ptr.*, try entry.value_ptr.clone());
+        }
+        return copy;
+    }
+
+    pub fn add(self: *StreamTable, stream: Stream) !StreamHandle {
+        const handle = self.next_handle;
+        self.next_handle += 1;
+        try self.streams.put(handle, stream);
+        return handle;
+    }
+
+    pub fn get(self: *StreamTable, handle: StreamHandle) ?Stream {
+        return self.streams.get(handle);
+    }
+
+    pub fn remove(self: *StreamTable, handle: StreamHandle) void {
+        if (self.streams.fetchRemove(handle)) |entry| entry.value.deinit();
+    }
+
+    /// Remember every stream, pending input and output included, for
+    /// restore()
+    pub fn checkpoint(self: *StreamTable) !void {
+        const streams = try self.cloneStreams(&self.streams);
+        if (self.saved) |*saved| freeStreams(&saved.streams);
+        self.saved = .{ .streams = streams, .next_handle = self.next_handle };
+    }
+
+    /// Put the table back as checkpoint() left it: streams created since
+    /// are freed, and fed or ended ones get their old state back. Does
+    /// nothing without a checkpoint.
+    pub fn restore(self: *StreamTable) !void {
+        const saved = if (self.saved) |*saved| saved else return;
+        const streams = try self.cloneStreams(&saved.streams);
+        freeStreams(&self.streams);
+        self.streams = streams;
+        self.next_handle = saved.next_handle;
+    }
+};
+
+/// Stream table of the runtime running on this thread. Each Runtime owns
+/// one and binds it before every call into the guest (see runtime.zig).
+threadlocal var current_table: ?*StreamTable = null;
+
+/// Set the stream table used by the zlib handlers on the calling thread
+pub fn setTable(table: ?*StreamTable) void {
+    current_table = table;
+}
+
+fn toStatus(err: anyerror) i32 {
+    const status: ZlibStatus = switch (err) {
+        error.InvalidData, error.BadChecksum => .data_error,
+        error.NeedDictionary => .need_dict,
+        error.OutOfMemory => .mem_error,
+        else => .stream_error,
+    };
+    return @intFromEnum(status);
+}
+
+fn pushStatus(vm: *zware.VirtualMachine, status: ZlibStatus) zware.WasmError!void {
+    try vm.pushOperand(i32, @intFromEnum(status));
+}
+
+/// Slice of guest memory, or null if the range is out of bounds
+fn guestSlice(memory_slice: []u8, ptr: u32, len: u32) ?[]u8 {
+    if (@as(u64, ptr) + len > memory_slice.len) return null;
+    return memory_slice[ptr .. ptr + len];
+}
+
+fn addStream(vm: *zware.VirtualMachine, stream: Stream, handle_ptr: u32) zware.WasmError!void {
+    const table = current_table orelse {
+        stream.deinit();
+        return pushStatus(vm, .stream_error);
+    };
+
+    const handle = table.add(stream) catch {
+        stream.deinit();
+        return pushStatus(vm, .mem_error);
+    };
+
+    const mem = try vm.inst.getMemory(0);
+    try mem.write(u32, 0, handle_ptr, handle);
+    try pushStatus(vm, .ok);
+}
+
+/// zlib_deflate_init: Create a compressor
+pub fn zlibDeflateInit(vm: *zware.VirtualMachine, _: usize) zware.WasmError!void {
+    const handle_ptr = vm.popOperand(u32);
+    const wbits = vm.popOperand(i32);
+    const level = vm.popOperand(i32);
+
+    const container = Container.fromWbits(wbits) catch return pushStatus(vm, .stream_error);
+    const compressor = Deflate.init(std.heap.page_allocator, container, level) catch |err| {
+        try vm.pushOperand(i32, toStatus(err));
+        return;
+    };
+    try addStream(vm, .{ .compress = compressor }, handle_ptr);
+}
+
+/// zlib_inflate_init: Create a decompressor
+pub fn zlibInflateInit(vm: *zware.VirtualMachine, _: usize) zware.WasmError!void {
+    const handle_ptr = vm.popOperand(u32);
+    const wbits = vm.popOperand(i32);
+
+    const container = Container.fromWbits(wbits) catch return pushStatus(vm, .stream_error);
+    const decompressor = Inflate.init(std.heap.page_allocator, container) catch |err| {
+        try vm.pushOperand(i32, toStatus(err));
+        return;
+    };
+    try addStream(vm, .{ .decompress = decompressor }, handle_ptr);
+}
+
+/// zlib_deflate_write: Compress input, then apply a flush mode.
+/// Writes the number of compressed bytes now pending to pending_ptr.
+pub fn zlibDeflateWrite(vm: *zware.VirtualMachine, _: usize) zware.WasmError!void {
+    const pending_ptr = vm.popOperand(u32);
+    const flush_raw = vm.popOperand(i32);
+    const in_len = vm.popOperand(u32);
+    const in_ptr = vm.popOperand(u32);
+    const handle = vm.popOperand(u32);
+
+    const table = current_table orelse return pushStatus(vm, .stream_error);
+    const stream = table.get(handle) orelse return pushStatus(vm, .stream_error);
+    const compressor = switch (stream) {
+        .compress => |d| d,
+        .decompress => return pushStatus(vm, .stream_error),
+    };
+
+    const mem = try vm.inst.getMemory(0);
+    const input = guestSlice(mem.memory(), in_ptr, in_len) orelse return pushStatus(vm, .stream_error);
+    const flush = deflate.Flush.fromZlib(flush_raw) catch return pushStatus(vm, .stream_error);
+
+    compressor.write(input) catch |err| {
+        try vm.pushOperand(i32, toStatus(err));
+        return;
+    };
+    compressor.flush(flush) catch |err| {
+        try vm.pushOperand(i32, toStatus(err));
+        return;
+    };
+
+    try mem.write(u32, 0, pending_ptr, @intCast(compressor.pending()));
+    try pushStatus(vm, .ok);
+}
+
+/// zlib_inflate_feed: Decompress input, stopping once max_out bytes are
+/// pending (0 = no limit). Writes {consumed, pending, eof} as three u32s
+/// to result_ptr.
+pub fn zlibInflateFeed(vm: *zware.VirtualMachine, _: usize) zware.WasmError!void {
+    const result_ptr = vm.popOperand(u32);
+    const max_out = vm.popOperand(u32);
+    const in_len = vm.popOperand(u32);
+    const in_ptr = vm.popOperand(u32);
+    const handle = vm.popOperand(u32);
+
+    const table = current_table orelse return pushStatus(vm, .stream_error);
+    const stream = table.get(handle) orelse return pushStatus(vm, .stream_error);
+    const decompressor = switch (stream) {
+        .decompress => |i| i,
+        .compress => return pushStatus(vm, .stream_error),
+    };
+
+    const mem = try vm.inst.getMemory(0);
+    const input = guestSlice(mem.memory(), in_ptr, in_len) orelse return pushStatus(vm, .stream_error);
+
+    const result = decompressor.feed(input, max_out) catch |err| {
+        try vm.pushOperand(i32, toStatus(err));
+        return;
+    };
+
+    try mem.write(u32, 0, result_ptr, @intCast(result.consumed));
+    try mem.write(u32, 0, result_ptr + 4, @intCast(decompressor.pending()));
+    try mem.write(u32, 0, result_ptr + 8, @intFromBool(result.finished));
+    try pushStatus(vm, .ok);
+}
+
+/// zlib_stream_read: Move pending output into a guest buffer
+pub fn zlibStreamRead(vm: *zware.VirtualMachine, _: usize) zware.WasmError!void {
+    const read_ptr = vm.popOperand(u32);
+    const buf_len = vm.popOperand(u32);
+    const buf_ptr = vm.popOperand(u32);
+    const handle = vm.popOperand(u32);
+
+    const table = current_table orelse return pushStatus(vm, .stream_error);
+    const stream = table.get(handle) orelse return pushStatus(vm, .stream_error);
+
+    const mem = try vm.inst.getMemory(0);
+    const buffer = guestSlice(mem.memory(), buf_ptr, buf_len) orelse return pushStatus(vm, .stream_error);
+
+    const n = stream.read(buffer);
+    try mem.write(u32, 0, read_ptr, @intCast(n));
+    try pushStatus(vm, .ok);
+}
+
+/// zlib_stream_copy: Duplicate a stream's full state under a new handle
+pub fn zlibStreamCopy(vm: *zware.VirtualMachine, _: usize) zware.WasmError!void {
+    const handle_ptr = vm.popOperand(u32);
+    const handle = vm.popOperand(u32);
+
+    const table = current_table orelse return pushStatus(vm, .stream_error);
+    const stream = table.get(handle) orelse return pushStatus(vm, .stream_error);
+
+    const copy: Stream = switch (stream) {
+        .compress => |d| .{ .compress = d.clone() catch return pushStatus(vm, .mem_error) },
+        .decompress => |i| .{ .decompress = i.clone() catch return pushStatus(vm, .mem_error) },
+    };
+    try addStream(vm, copy, handle_ptr);
+}
+
+/// zlib_stream_end: Release a stream
+pub fn zlibStreamEnd(vm: *zware.VirtualMachine, _: usize) zware.WasmError!void {
+    const handle = vm.popOperand(u32);
+
+    const table = current_table orelse return pushStatus(vm, .stream_error);
+    table.remove(handle);
+    try pushStatus(vm, .ok);
+}
+
+/// zlib_crc32: CRC-32 of a guest buffer, continuing from value
+pub fn zlibCrc32(vm: *zware.VirtualMachine, _: usize) zware.WasmError!void {
+    const value = vm.popOperand(u32);
+    const len = vm.popOperand(u32);
+    const ptr = vm.popOperand(u32);
+
+    const mem = try vm.inst.getMemory(0);
+    const data = guestSlice(mem.memory(), ptr, len) orelse return error.OutOfBoundsMemoryAccess;
+    try vm.pushOperand(u32, deflate.crc32(value, data));
+}
+
+/// zlib_adler32: Adler-32 of a guest buffer, continuing from value
+pub fn zlibAdler32(vm: *zware.VirtualMachine, _: usize) zware.WasmError!void {
+    const value = vm.popOperand(u32);
+    const len = vm.popOperand(u32);
+    const ptr = vm.popOperand(u32);
+
+    const mem = try vm.inst.getMemory(0);
+    const data = guestSlice(mem.memory(), ptr, len) orelse return error.OutOfBoundsMemoryAccess;
+    try vm.pushOperand(u32, deflate.adler32(value, data));
+}
+
+/// Register all zlib WASI functions
+pub fn registerZlibFunctions(store: *zware.Store) !void {
+    const i32_result = &[_]zware.ValType{.I32};
+
+    // zlib_deflate_init(level: i32, wbits: i32, handle_ptr: i32) -> i32
+    try store.exposeHostFunction(
+        "wasi_snapshot_preview1",
+        "zlib_deflate_init",
+        zlibDeflateInit,
+        0,
+        &.{ .I32, .I32, .I32 },
+        i32_result,
+    );
+
+    // zlib_inflate_init(wbits: i32, handle_ptr: i32) -> i32
+    try store.exposeHostFunction(
+        "wasi_snapshot_preview1",
+        "zlib_inflate_init",
+        zlibInflateInit,
+        0,
+        &.{ .I32, .I32 },
+        i32_result,
+    );
+
+    // zlib_deflate_write(handle: i32, in_ptr: i32, in_len: i32, flush: i32, pending_ptr: i32) -> i32
+    try store.exposeHostFunction(
+        "wasi_snapshot_preview1",
+        "zlib_deflate_write",
+        zlibDeflateWrite,
+        0,
+        &.{ .I32, .I32, .I32, .I32, .I32 },
+        i32_result,
+    );
+
+    // zlib_inflate_feed(handle: i32, in_ptr: i32, in_len: i32, max_out: i32, result_ptr: i32) -> i32
+    try store.exposeHostFunction(
+        "wasi_snapshot_preview1",
+        "zlib_inflate_feed",
+        zlibInflateFeed,
+        0,
+        &.{ .I32, .I32, .I32, .I32, .I32 },
+        i32_result,
+    );
+
+    // zlib_stream_read(handle: i32, buf_ptr: i32, buf_len: i32, read_ptr: i32) -> i32
+    try store.exposeHostFunction(
+        "wasi_snapshot_preview1",
+        "zlib_stream_read",
+        zlibStreamRead,
+        0,
+        &.{ .I32, .I32, .I32, .I32 },
+        i32_result,
+    );
+
+    // zlib_stream_copy(handle: i32, handle_ptr: i32) -> i32
+    try store.exposeHostFunction(
+        "wasi_snapshot_preview1",
+        "zlib_stream_copy",
+        zlibStreamCopy,
+        0,
+        &.{ .I32, .I32 },
+        i32_result,
+    );
+
+    // zlib_stream_end(handle: i32) -> i32
+    try store.exposeHostFunction(
+        "wasi_snapshot_preview1",
+        "zlib_stream_end",
+        zlibStreamEnd,
+        0,
+        &.{.I32},
+        i32_result,
+    );
+
+    // zlib_crc32(ptr: i32, len: i32, value: i32) -> i32
+    try store.exposeHostFunction(
+        "wasi_snapshot_preview1",
+        "zlib_crc32",
+        zlibCrc32,
+        0,
+        &.{ .I32, .I32, .I32 },
+        i32_result,
+    );
+
+    // zlib_adler32(ptr: i32, len: i32, value: i32) -> i32
+    try store.exposeHostFunction(
+        "wasi_snapshot_preview1",
+        "zlib_adler32",
+        zlibAdler32,
+        0,
+        &.{ .I32, .I32, .I32 },
+        i32_result,
+    );
+}
@@ -0,0 +1,387 @@
+// Symmetric Ciphers
+//
+// Block and stream ciphers for the host-side Cryptodome shim:
+// - AES-128/256 from std.crypto, DES/3DES from des.zig
+// - ECB, CBC and CTR modes with chaining state kept between calls, so the
+//   guest can encrypt a message in pieces like PyCryptodome allows
+// - RC4 stream cipher
+// - AES-CMAC (RFC 4493)
+//
+// Mode numbers match PyCryptodome's MODE_* constants.
+
+const std = @import("std");
+const aes = std.crypto.core.aes;
+const des = @import("des.zig");
+
+/// Error types for cipher operations
+pub const CipherError = error{
+    UnsupportedAlgorithm,
+    UnsupportedMode,
+    InvalidKeyLength,
+    InvalidIvLength,
+    /// ECB/CBC input that is not a whole number of blocks
+    InvalidDataLength,
+};
+
+pub const Algorithm = enum(u32) {
+    aes = 1,
+    des = 2,
+    des3 = 3,
+    rc4 = 4,
+};
+
+pub const Mode = enum(u32) {
+    ecb = 1,
+    cbc = 2,
+    ctr = 6,
+};
+
+pub const max_block_length = 16;
+
+/// A keyed block cipher with both directions expanded
+pub const BlockCipher = union(enum) {
+    aes128: struct {
+        enc: aes.AesEncryptCtx(aes.Aes128),
+        dec: aes.AesDecryptCtx(aes.Aes128),
+    },
+    aes256: struct {
+        enc: aes.AesEncryptCtx(aes.Aes256),
+        dec: aes.AesDecryptCtx(aes.Aes256),
+    },
+    des: des.Des,
+    des3: des.TripleDes,
+
+    pub fn init(algorithm: Algorithm, key: []const u8) CipherError!BlockCipher {
+        switch (algorithm) {
+            .aes => {
+                if (key.len == 16) return .{ .aes128 = .{
+                    .enc = aes.Aes128.initEnc(key[0..16].*),
+                    .dec = aes.Aes128.initDec(key[0..16].*),
+                } };
+                if (key.len == 32) return .{ .aes256 = .{
+                    .enc = aes.Aes256.initEnc(key[0..32].*),
+                    .dec = aes.Aes256.initDec(key[0..32].*),
+                } };
+                // std.crypto has no AES-192
+                return error.InvalidKeyLength;
+            },
+            .des => {
+                if (key.len != 8) return error.InvalidKeyLength;
+                return .{ .des = des.Des.init(key[0..8]) };
+            },
+            .des3 => return .{ .des3 = des.TripleDes.init(key) catch return error.InvalidKeyLength },
+            .rc4 => return error.UnsupportedAlgorithm,
+        }
+    }
+
+    pub fn blockLength(self: *const BlockCipher) usize {
+        return switch (self.*) {
+            .aes128, .aes256 => 16,
+            .des, .des3 => des.block_length,
+        };
+    }
+
+    /// Encrypt one block; dst and src are blockLength() bytes
+    pub fn encryptBlock(self: *const BlockCipher, dst: []u8, src: []const u8) void {
+        switch (self.*) {
+            .aes128 => |*c| c.enc.encrypt(dst[0..16], src[0..16]),
+            .aes256 => |*c| c.enc.encrypt(dst[0..16], src[0..16]),
+            .des => |*c| c.encrypt(dst[0..8], src[0..8]),
+            .des3 => |*c| c.encrypt(dst[0..8], src[0..8]),
+        }
+    }
+
+    /// Decrypt one block; dst and src are blockLength() bytes
+    pub fn decryptBlock(self: *const BlockCipher, dst: []u8, src: []const u8) void {
+        switch (self.*) {
+            .aes128 => |*c| c.dec.decrypt(dst[0..16], src[0..16]),
+            .aes256 => |*c| c.dec.decrypt(dst[0..16], src[0..16]),
+            .des => |*c| c.decrypt(dst[0..8], src[0..8]),
+            .des3 => |*c| c.decrypt(dst[0..8], src[0..8]),
+        }
+    }
+};
+
+/// RC4 (ARC4) stream cipher
+pub const Rc4 = struct {
+    s: [256]u8,
+    i: u8,
+    j: u8,
+
+    pub fn init(key: []const u8) CipherError!Rc4 {
+        if (key.len == 0 or key.len > 256) return error.InvalidKeyLength;
+
+        var self = Rc4{ .s = undefined, .i = 0, .j = 0 };
+        for (&self.s, 0..) |*b, idx| b.* = @intCast(idx);
+
+        var j: u8 = 0;
+        for (0..256) |idx| {
+            j +%= self.s[idx] +% key[idx % key.len];
+            std.mem.swap(u8, &self.s[idx], &self.s[j]);
+        }
+        return self;
+    }
+
+    pub fn process(self: *Rc4, dst: []u8, src: []const u8) void {
+        for (dst, src) |*out, in| {
+            self.i +%= 1;
+            self.j +%= self.s[self.i];
+            std.mem.swap(u8, &self.s[self.i], &self.s[self.j]);
+            out.* = in ^ self.s[self.s[self.i] +% self.s[self.j]];
+        }
+    }
+};
+
+/// A cipher with its mode and chaining state
+pub const Cipher = struct {
+    kind: union(enum) {
+        block: BlockCipher,
+        stream: Rc4,
+    },
+    mode: Mode,
+    /// CBC: previous ciphertext block. CTR: current counter block.
+    iv: [max_block_length]u8,
+    /// CTR: keystream for the current counter block
+    keystream: [max_block_length]u8,
+    /// CTR: bytes of keystream already used (block length = exhausted)
+    keystream_pos: usize,
+
+    /// mode is ignored for RC4. iv is the CBC IV or the initial CTR counter
+    /// block, and must be empty for ECB.
+    pub fn init(algorithm: Algorithm, mode: Mode, key: []const u8, iv: []const u8) CipherError!Cipher {
+        var self = Cipher{
+            .kind = undefined,
+            .mode = mode,
+            .iv = [_]u8{0} ** max_block_length,
+            .keystream = undefined,
+            .keystream_pos = 0,
+        };
+
+        if (algorithm == .rc4) {
+            self.kind = .{ .stream = try Rc4.init(key) };
+            return self;
+        }
+
+        const block = try BlockCipher.init(algorithm, key);
+        const block_len = block.blockLength();
+        switch (mode) {
+            .ecb => if (iv.len != 0) return error.InvalidIvLength,
+            .cbc, .ctr => if (iv.len != block_len) return error.InvalidIvLength,
+        }
+        @memcpy(self.iv[0..iv.len], iv);
+        self.kind = .{ .block = block };
+        self.keystream_pos = block_len;
+        return self;
+    }
+
+    /// Encrypt or decrypt src into dst (same length; may alias exactly)
+    pub fn process(self: *Cipher, decrypt: bool, dst: []u8, src: []const u8) CipherError!void {
+        std.debug.assert(dst.len == src.len);
+
+        const block = switch (self.kind) {
+            .stream => |*rc4| {
+                rc4.process(dst, src);
+                return;
+            },
+            .block => |*b| b,
+        };
+        const n = block.blockLength();
+
+        switch (self.mode) {
+            .ecb => {
+                if (src.len % n != 0) return error.InvalidDataLength;
+                var off: usize = 0;
+                while (off < src.len) : (off += n) {
+                    if (decrypt) {
+                        block.decryptBlock(dst[off..][0..n], src[off..][0..n]);
+                    } else {
+                        block.encryptBlock(dst[off..][0..n], src[off..][0..n]);
+                    }
+                }
+            },
+            .cbc => {
+                if (src.len % n != 0) return error.InvalidDataLength;
+                var tmp: [max_block_length]u8 = undefined;
+                var off: usize = 0;
+                while (off < src.len) : (off += n) {
+                    if (decrypt) {
+                        var next_iv: [max_block_length]u8 = undefined;
+                        @memcpy(next_iv[0..n], src[off..][0..n]);
+                        block.decryptBlock(tmp[0..n], src[off..][0..n]);
+                        for (dst[off..][0..n], tmp[0..n], self.iv[0..n]) |*out, p, v| out.* = p ^ v;
+                        @memcpy(self.iv[0..n], next_iv[0..n]);
+                    } else {
+                        for (tmp[0..n], src[off..][0..n], self.iv[0..n]) |*t, p, v| t.* = p ^ v;
+                        block.encryptBlock(dst[off..][0..n], tmp[0..n]);
+                        @memcpy(self.iv[0..n], dst[off..][0..n]);
+                    }
+                }
+            },
+            .ctr => {
+                for (dst, src) |*out, in| {
+                    if (self.keystream_pos == n) {
+                        block.encryptBlock(self.keystream[0..n], self.iv[0..n]);
+                        incrementCounter(self.iv[0..n]);
+                        self.keystream_pos = 0;
+                    }
+                    out.* = in ^ self.keystream[self.keystream_pos];
+                    self.keystream_pos += 1;
+                }
+            },
+        }
+    }
+};
+
+/// Big-endian increment of a whole counter block
+fn incrementCounter(counter: []u8) void {
+    var i = counter.len;
+    while (i > 0) {
+        i -= 1;
+        counter[i] +%= 1;
+        if (counter[i] != 0) break;
+    }
+}
+
+/// AES-CMAC (RFC 4493)
+pub const Cmac = struct {
+    pub const digest_length = 16;
+
+    cipher: BlockCipher,
+    k1: [16]u8,
+    k2: [16]u8,
+    state: [16]u8,
+    /// Pending input; the last block is held back until final
+    buf: [16]u8,
+    buf_len: usize,
+
+    pub fn init(key: []const u8) CipherError!Cmac {
+        const cipher = try BlockCipher.init(.aes, key);
+
+        var l: [16]u8 = undefined;
+        cipher.encryptBlock(&l, &([_]u8{0} ** 16));
+        const k1 = double(l);
+        return .{
+            .cipher = cipher,
+            .k1 = k1,
+            .k2 = double(k1),
+            .state = [_]u8{0} ** 16,
+            .buf = undefined,
+            .buf_len = 0,
+        };
+    }
+
+    /// Multiply by x in GF(2^128)
+    fn double(block: [16]u8) [16]u8 {
+        var out: [16]u8 = undefined;
+        var carry: u8 = 0;
+        var i: usize = 16;
+        while (i > 0) {
+            i -= 1;
+            out[i] = (block[i] << 1) | carry;
+            carry = block[i] >> 7;
+        }
+        if (carry != 0) out[15] ^= 0x87;
+        return out;
+    }
+
+    fn absorb(self: *Cmac, block: *const [16]u8) void {
+        for (&self.state, block) |*s, b| s.* ^= b;
+        const input = self.state;
+        self.cipher.encryptBlock(&self.state, &input);
+    }
+
+    pub fn update(self: *Cmac, data: []const u8) void {
+        var rest = data;
+        while (rest.len > 0) {
+            if (self.buf_len == 16) {
+                self.absorb(&self.buf);
+                self.buf_len = 0;
+            }
+            const n = @min(16 - self.buf_len, rest.len);
+            @memcpy(self.buf[self.buf_len..][0..n], rest[0..n]);
+            self.buf_len += n;
+            rest = rest[n..];
+        }
+    }
+
+    /// Write the tag of everything so far into out, leaving the state usable
+    pub fn digest(self: *const Cmac, out: []u8) CipherError!usize {
+        if (out.len < digest_length) return error.InvalidDataLength;
+
+        var last: [16]u8 = [_]u8{0} ** 16;
+        @memcpy(last[0..self.buf_len], self.buf[0..self.buf_len]);
+        if (self.buf_len == 16) {
+            for (&last, self.k1) |*b, k| b.* ^= k;
+        } else {
+            last[self.buf_len] = 0x80;
+            for (&last, self.k2) |*b, k| b.* ^= k;
+        }
+
+        var copy = self.*;
+        copy.absorb(&last);
+        @memcpy(out[0..digest_length], &copy.state);
+        return digest_length;
+    }
+};
+
+fn hexToBytes(comptime hex: []const u8) [hex.len / 2]u8 {
+    var out: [hex.len / 2]u8 = undefined;
+    _ = std.fmt.hexToBytes(&out, hex) catch unreachable;
+    return out;
+}
+
+// Tests
+test "rc4 known answer" {
+    var rc4 = try Rc4.init("Key");
+    var out: [9]u8 = undefined;
+    rc4.process(&out, "Plaintext");
+    try std.testing.expectEqualSlices(u8, &hexToBytes("bbf316e8d940af0ad3"), &out);
+}
+
+test "aes cbc round trip across split calls" {
+    const key = hexToBytes("2b7e151628aed2a6abf7158809cf4f3c");
+    const iv = hexToBytes("000102030405060708090a0b0c0d0e0f");
+    const plaintext = hexToBytes("6bc1bee22e409f96e93d7e117393172aae2d8a571e03ac9c9eb76fac45af8e51");
+    // NIST SP 800-38A F.2.1
+    const expected = hexToBytes("7649abac8119b246cee98e9b12e9197d5086cb9b507219ee95db113a917678b2");
+
+    var enc = try Cipher.init(.aes, .cbc, &key, &iv);
+    var out: [32]u8 = undefined;
+    try enc.process(false, out[0..16], plaintext[0..16]);
+    try enc.process(false, out[16..], plaintext[16..]);
+    try std.testing.expectEqualSlices(u8, &expected, &out);
+
+    var dec = try Cipher.init(.aes, .cbc, &key, &iv);
+    var back: [32]u8 = undefined;
+    try dec.process(true, &back, &out);
+    try std.testing.expectEqualSlices(u8, &plaintext, &back);
+
+    try std.testing.expectError(error.InvalidDataLength, enc.process(false, out[0..5], plaintext[0..5]));
+}
+
+test "aes ctr matches sp 800-38a" {
+    const key = hexToBytes("2b7e151628aed2a6abf7158809cf4f3c");
+    const counter = hexToBytes("f0f1f2f3f4f5f6f7f8f9fafbfcfdfeff");
+    const plaintext = hexToBytes("6bc1bee22e409f96e93d7e117393172aae2d8a571e03ac9c9eb76fac45af8e51");
+    const expected = hexToBytes("874d6191b620e3261bef6864990db6ce9806f66b7970fdff8617187bb9fffdff");
+
+    // Odd split exercises the partial keystream carry-over
+    var ctr = try Cipher.init(.aes, .ctr, &key, &counter);
+    var out: [32]u8 = undefined;
+    try ctr.process(false, out[0..7], plaintext[0..7]);
+    try ctr.process(false, out[7..], plaintext[7..]);
+    try std.testing.expectEqualSlices(u8, &expected, &out);
+}
+
+test "aes cmac rfc 4493 vectors" {
+    const key = hexToBytes("2b7e151628aed2a6abf7158809cf4f3c");
+
+    var mac = try Cmac.init(&key);
+    var out: [16]u8 = undefined;
+    _ = try mac.digest(&out);
+    try std.testing.expectEqualSlices(u8, &hexToBytes("bb1d6929e95937287fa37d129b756746"), &out);
+
+    mac.update(&hexToBytes("6bc1bee22e409f96e93d7e117393172a"));
+    _ = try mac.digest(&out);
+    try std.testing.expectEqualSlices(u8, &hexToBytes("070a16b46b4d4144f79bdd9dd04a287c"), &out);
+}
@@ -0,0 +1,392 @@
+const std = @import("std");
+const zware = @import("zware");
+const hash_mod = @import("hash.zig");
+const cipher_mod = @import("cipher.zig");
+const Hasher = hash_mod.Hasher;
+const Hmac = hash_mod.Hmac;
+const Algorithm = hash_mod.Algorithm;
+const Cipher = cipher_mod.Cipher;
+const Cmac = cipher_mod.Cmac;
+
+/// WASI errno values returned by crypto host functions
+pub const CryptoError = enum(u32) {
+    success = 0,
+    badf = 8, // Unknown handle, or handle of the wrong kind
+    inval = 28, // Bad argument or out-of-bounds buffer
+    nomem = 48,
+    notsup = 58, // Unsupported algorithm or mode
+};
+
+pub const ObjectHandle = u32;
+
+/// Host-side state for one guest crypto object
+pub const CryptoObject = union(enum) {
+    hash: Hasher,
+    hmac: Hmac,
+    cmac: Cmac,
+    cipher: Cipher,
+
+    fn update(self: *CryptoObject, data: []const u8) bool {
+        switch (self.*) {
+            .hash => |*h| h.update(data),
+            .hmac => |*h| h.update(data),
+            .cmac => |*c| c.update(data),
+            .cipher => return false,
+        }
+        return true;
+    }
+
+    fn digest(self: *const CryptoObject, out: []u8) ?usize {
+        return switch (self.*) {
+            .hash => |*h| h.digest(out) catch null,
+            .hmac => |*h| h.digest(out) catch null,
+            .cmac => |*c| c.digest(out) catch null,
+            .cipher => null,
+        };
+    }
+};
+
+/// Live crypto objects of one runtime, keyed by the handle given to the
+/// guest. Used only by the thread running that runtime, so it takes no
+/// lock; pointers from get() stay valid until the next add or remove.
+pub const ObjectTable = struct {
+    objects: std.AutoHashMap(ObjectHandle, CryptoObject),
+    next_handle: ObjectHandle,
+    allocator: std.mem.Allocator,
+    /// Copy of the table taken by checkpoint(), for restore()
+    saved: ?Saved,
+
+    /// Objects hold no pointers, so copying the map copies their state
+    const Saved = struct {
+        objects: std.AutoHashMap(ObjectHandle, CryptoObject),
+        next_handle: ObjectHandle,
+    };
+
+    pub fn init(allocator: std.mem.Allocator) ObjectTable {
+        return ObjectTable{
+            .objects = std.AutoHashMap(ObjectHandle, CryptoObject).init(allocator),
+            .next_handle = 1,
+            .allocator = allocator,
+            .saved = null,
+        };
+    }
+
+    pub fn deinit(self: *ObjectTable) void {
+        self.objects.deinit();
+        if (self.saved) |*saved| saved.objects.deinit();
+    }
+
+    pub fn add(self: *ObjectTable, object: CryptoObject) !ObjectHandle {
+        const handle = self.next_handle;
+        self.next_handle += 1;
+        try self.objects.put(handle, object);
+        return handle;
+    }
+
+    pub fn get(self: *ObjectTable, handle: ObjectHandle) ?*CryptoObject {
+        return self.objects.getPtr(handle);
+    }
+
+    pub fn remove(self: *ObjectTable, handle: ObjectHandle) void {
+        _ = self.objects.remove(handle);
+    }
+
+    /// Remember every object and its state for restore()
+    pub fn checkpoint(self: *ObjectTable) !void {
+        const objects = try self.objects.clone();
+        if (self.saved) |*saved| saved.objects.deinit();
+        self.saved = .{ .objects = objects, .next_handle = self.next_handle };
+    }
+
+    /// Put the table back as checkpoint() left it: objects created since
+    /// are freed, and updated or freed ones get their old state back.
+    /// Does nothing without a checkpoint.
+    pub fn restore(self: *ObjectTable) !void {
+        const saved = if (self.saved) |*saved| saved else return;
+        const objects = try saved.objects.clone();
+        self.objects.deinit();
+        self.objects = objects;
+        self.next_handle = saved.next_handle;
+    }
+};
+
+/// Object table of the runtime running on this thread. Each Runtime owns
+/// one, so a guest can only reach its own keys and cipher state; Runtime
+/// binds it before every call into the guest.
+threadlocal var current_table: ?*ObjectTable = null;
+
+/// Set the object table used by the crypto handlers on the calling thread
+pub fn setTable(table: ?*ObjectTable) void {
+    current_table = table;
+}
+
+fn pushError(vm: *zware.VirtualMachine, err: CryptoError) zware.WasmError!void {
+    try vm.pushOperand(u32, @intFromEnum(err));
+}
+
+/// Slice of guest memory, or null if the range is out of bounds
+fn guestSlice(memory_slice: []u8, ptr: u32, len: u32) ?[]u8 {
+    if (@as(u64, ptr) + len > memory_slice.len) return null;
+    return memory_slice[ptr .. ptr + len];
+}
+
+fn addObject(vm: *zware.VirtualMachine, object: CryptoObject, handle_ptr: u32) zware.WasmError!void {
+    const table = current_table orelse return pushError(vm, .inval);
+    const handle = table.add(object) catch return pushError(vm, .nomem);
+
+    const mem = try vm.inst.getMemory(0);
+    try mem.write(u32, 0, handle_ptr, handle);
+    try pushError(vm, .success);
+}
+
+fn getObject(handle: ObjectHandle) ?*CryptoObject {
+    const table = current_table orelse return null;
+    return table.get(handle);
+}
+
+fn toCryptoError(err: cipher_mod.CipherError) CryptoError {
+    return switch (err) {
+        error.UnsupportedAlgorithm, error.UnsupportedMode => .notsup,
+        error.InvalidKeyLength, error.InvalidIvLength, error.InvalidDataLength => .inval,
+    };
+}
+
+/// crypto_hash_new: Create a hash object by hashlib name.
+/// Writes {digest_size, block_size} as two u32s to info_ptr.
+pub fn cryptoHashNew(vm: *zware.VirtualMachine, _: usize) zware.WasmError!void {
+    const info_ptr = vm.popOperand(u32);
+    const handle_ptr = vm.popOperand(u32);
+    const name_len = vm.popOperand(u32);
+    const name_ptr = vm.popOperand(u32);
+
+    const mem = try vm.inst.getMemory(0);
+    const name = guestSlice(mem.memory(), name_ptr, name_len) orelse return pushError(vm, .inval);
+    const algorithm = Algorithm.fromName(name) orelse return pushError(vm, .notsup);
+
+    try mem.write(u32, 0, info_ptr, algorithm.digestSize());
+    try mem.write(u32, 0, info_ptr + 4, algorithm.blockSize());
+    try addObject(vm, .{ .hash = Hasher.init(algorithm) }, handle_ptr);
+}
+
+/// crypto_hmac_new: Create an HMAC object over a hashlib-named hash.
+/// Writes {digest_size, block_size} as two u32s to info_ptr.
+pub fn cryptoHmacNew(vm: *zware.VirtualMachine, _: usize) zware.WasmError!void {
+    const info_ptr = vm.popOperand(u32);
+    const handle_ptr = vm.popOperand(u32);
+    const key_len = vm.popOperand(u32);
+    const key_ptr = vm.popOperand(u32);
+    const name_len = vm.popOperand(u32);
+    const name_ptr = vm.popOperand(u32);
+
+    const mem = try vm.inst.getMemory(0);
+    const name = guestSlice(mem.memory(), name_ptr, name_len) orelse return pushError(vm, .inval);
+    const key = guestSlice(mem.memory(), key_ptr, key_len) orelse return pushError(vm, .inval);
+    const algorithm = Algorithm.fromName(name) orelse return pushError(vm, .notsup);
+    const hmac = Hmac.init(algorithm, key) catch return pushError(vm, .notsup);
+
+    try mem.write(u32, 0, info_ptr, algorithm.digestSize());
+    try mem.write(u32, 0, info_ptr + 4, algorithm.blockSize());
+    try addObject(vm, .{ .hmac = hmac }, handle_ptr);
+}
+
+/// crypto_cmac_new: Create an AES-CMAC object
+pub fn cryptoCmacNew(vm: *zware.VirtualMachine, _: usize) zware.WasmError!void {
+    const handle_ptr = vm.popOperand(u32);
+    const key_len = vm.popOperand(u32);
+    const key_ptr = vm.popOperand(u32);
+
+    const mem = try vm.inst.getMemory(0);
+    const key = guestSlice(mem.memory(), key_ptr, key_len) orelse return pushError(vm, .inval);
+    const cmac = Cmac.init(key) catch |err| return pushError(vm, toCryptoError(err));
+
+    try addObject(vm, .{ .cmac = cmac }, handle_ptr);
+}
+
+/// crypto_hash_update: Feed a guest buffer into a hash, HMAC or CMAC object
+pub fn cryptoHashUpdate(vm: *zware.VirtualMachine, _: usize) zware.WasmError!void {
+    const data_len = vm.popOperand(u32);
+    const data_ptr = vm.popOperand(u32);
+    const handle = vm.popOperand(u32);
+
+    const object = getObject(handle) orelse return pushError(vm, .badf);
+    const mem = try vm.inst.getMemory(0);
+    const data = guestSlice(mem.memory(), data_ptr, data_len) orelse return pushError(vm, .inval);
+
+    if (!object.update(data)) return pushError(vm, .badf);
+    try pushError(vm, .success);
+}
+
+/// crypto_hash_digest: Write the current digest or MAC without finalizing
+/// the object. For SHAKE, out_len is the requested digest length.
+pub fn cryptoHashDigest(vm: *zware.VirtualMachine, _: usize) zware.WasmError!void {
+    const written_ptr = vm.popOperand(u32);
+    const out_len = vm.popOperand(u32);
+    const out_ptr = vm.popOperand(u32);
+    const handle = vm.popOperand(u32);
+
+    const object = getObject(handle) orelse return pushError(vm, .badf);
+    const mem = try vm.inst.getMemory(0);
+    const out = guestSlice(mem.memory(), out_ptr, out_len) orelse return pushError(vm, .inval);
+
+    const written = object.digest(out) orelse return pushError(vm, .inval);
+    try mem.write(u32, 0, written_ptr, @intCast(written));
+    try pushError(vm, .success);
+}
+
+/// crypto_hash_copy: Duplicate any crypto object's state under a new handle
+pub fn cryptoHashCopy(vm: *zware.VirtualMachine, _: usize) zware.WasmError!void {
+    const handle_ptr = vm.popOperand(u32);
+    const handle = vm.popOperand(u32);
+
+    // Copied out first: adding may grow the table and move the original
+    const copy = (getObject(handle) orelse return pushError(vm, .badf)).*;
+    try addObject(vm, copy, handle_ptr);
+}
+
+/// crypto_cipher_new: Create a cipher (algorithm and mode as in cipher.zig)
+pub fn cryptoCipherNew(vm: *zware.VirtualMachine, _: usize) zware.WasmError!void {
+    const handle_ptr = vm.popOperand(u32);
+    const iv_len = vm.popOperand(u32);
+    const iv_ptr = vm.popOperand(u32);
+    const key_len = vm.popOperand(u32);
+    const key_ptr = vm.popOperand(u32);
+    const mode_raw = vm.popOperand(u32);
+    const algorithm_raw = vm.popOperand(u32);
+
+    const algorithm = std.meta.intToEnum(cipher_mod.Algorithm, algorithm_raw) catch return pushError(vm, .notsup);
+    const mode = std.meta.intToEnum(cipher_mod.Mode, mode_raw) catch return pushError(vm, .notsup);
+
+    const mem = try vm.inst.getMemory(0);
+    const key = guestSlice(mem.memory(), key_ptr, key_len) orelse return pushError(vm, .inval);
+    const iv = guestSlice(mem.memory(), iv_ptr, iv_len) orelse return pushError(vm, .inval);
+
+    const cipher = Cipher.init(algorithm, mode, key, iv) catch |err| return pushError(vm, toCryptoError(err));
+    try addObject(vm, .{ .cipher = cipher }, handle_ptr);
+}
+
+/// crypto_cipher_update: Encrypt (decrypt = 0) or decrypt len bytes from
+/// in_ptr to out_ptr, advancing the cipher's chaining state
+pub fn cryptoCipherUpdate(vm: *zware.VirtualMachine, _: usize) zware.WasmError!void {
+    const len = vm.popOperand(u32);
+    const out_ptr = vm.popOperand(u32);
+    const in_ptr = vm.popOperand(u32);
+    const decrypt = vm.popOperand(u32);
+    const handle = vm.popOperand(u32);
+
+    const object = getObject(handle) orelse return pushError(vm, .badf);
+    const cipher = switch (object.*) {
+        .cipher => |*c| c,
+        else => return pushError(vm, .badf),
+    };
+
+    const mem = try vm.inst.getMemory(0);
+    const input = guestSlice(mem.memory(), in_ptr, len) orelse return pushError(vm, .inval);
+    const output = guestSlice(mem.memory(), out_ptr, len) orelse return pushError(vm, .inval);
+
+    cipher.process(decrypt != 0, output, input) catch |err| return pushError(vm, toCryptoError(err));
+    try pushError(vm, .success);
+}
+
+/// crypto_free: Release any crypto object
+pub fn cryptoFree(vm: *zware.VirtualMachine, _: usize) zware.WasmError!void {
+    const handle = vm.popOperand(u32);
+
+    const table = current_table orelse return pushError(vm, .inval);
+    table.remove(handle);
+    try pushError(vm, .success);
+}
+
+/// Register all crypto WASI functions
+pub fn registerCryptoFunctions(store: *zware.Store) !void {
+    const i32_result = &[_]zware.ValType{.I32};
+
+    // crypto_hash_new(name_ptr: i32, name_len: i32, handle_ptr: i32, info_ptr: i32) -> i32
+    try store.exposeHostFunction(
+        "wasi_snapshot_preview1",
+        "crypto_hash_new",
+        cryptoHashNew,
+        0,
+        &.{ .I32, .I32, .I32, .I32 },
+        i32_result,
+    );
+
+    // crypto_hmac_new(name_ptr: i32, name_len: i32, key_ptr: i32, key_len: i32, handle_ptr: i32, info_ptr: i32) -> i32
+    try store.exposeHostFunction(
+        "wasi_snapshot_preview1",
+        "crypto_hmac_new",
+        cryptoHmacNew,
+        0,
+        &.{ .I32, .I32, .I32, .I32, .I32, .I32 },
+        i32_result,
+    );
+
+    // crypto_cmac_new(key_ptr: i32, key_len: i32, handle_ptr: i32) -> i32
+    try store.exposeHostFunction(
+        "wasi_snapshot_preview1",
+        "crypto_cmac_new",
+        cryptoCmacNew,
+        0,
+        &.{ .I32, .I32, .I32 },
+        i32_result,
+    );
+
+    // crypto_hash_update(handle: i32, data_ptr: i32, data_len: i32) -> i32
+    try store.exposeHostFunction(
+        "wasi_snapshot_preview1",
+        "crypto_hash_update",
+        cryptoHashUpdate,
+        0,
+        &.{ .I32, .I32, .I32 },
+        i32_result,
+    );
+
+    // crypto_hash_digest(handle: i32, out_ptr: i32, out_len: i32, written_ptr: i32) -> i32
+    try store.exposeHostFunction(
+        "wasi_snapshot_preview1",
+        "crypto_hash_digest",
+        cryptoHashDigest,
+        0,
+        &.{ .I32, .I32, .I32, .I32 },
+        i32_result,
+    );
+
+    // crypto_hash_copy(handle: i32, handle_ptr: i32) -> i32
+    try store.exposeHostFunction(
+        "wasi_snapshot_preview1",
+        "crypto_hash_copy",
+        cryptoHashCopy,
+        0,
+        &.{ .I32, .I32 },
+        i32_result,
+    );
+
+    // crypto_cipher_new(algorithm: i32, mode: i32, key_ptr: i32, key_len: i32, iv_ptr: i32, iv_len: i32, handle_ptr: i32) -> i32
+    try store.exposeHostFunction(
+        "wasi_snapshot_preview1",
+        "crypto_cipher_new",
+        cryptoCipherNew,
+        0,
+        &.{ .I32, .I32, .I32, .I32, .I32, .I32, .I32 },
+        i32_result,
+    );
+
+    // crypto_cipher_update(handle: i32, decrypt: i32, in_ptr: i32, out_ptr: i32, len: i32) -> i32
+    try store.exposeHostFunction(
+        "wasi_snapshot_preview1",
+        "crypto_cipher_update",
+        cryptoCipherUpdate,
+        0,
+        &.{ .I32, .I32, .I32, .I32, .I32 },
+        i32_result,
+    );
+
+    // crypto_free(handle: i32) -> i32
+    try store.exposeHostFunction(
+        "wasi_snapshot_preview1",
+        "crypto_free",
+        cryptoFree,
+        0,
+        &.{.I32},
+        i32_result,
+    );
+}
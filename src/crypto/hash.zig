@@ -0,0 +1,224 @@
+// Hash Functions
+//
+// Streaming message digests for the host-side hashlib provider. State lives
+// entirely in a Hasher value, so copying one (hashlib's .copy()) is a plain
+// struct copy and taking a digest never disturbs the running state.
+//
+// Names, digest sizes and block sizes follow hashlib.
+
+const std = @import("std");
+const hash = std.crypto.hash;
+const Md4 = @import("md4.zig").Md4;
+
+/// Error types for hash operations
+pub const HashError = error{
+    UnsupportedAlgorithm,
+    BufferTooSmall,
+};
+
+/// Supported algorithms, named as hashlib names them
+pub const Algorithm = enum {
+    md4,
+    md5,
+    sha1,
+    sha224,
+    sha256,
+    sha384,
+    sha512,
+    sha3_224,
+    sha3_256,
+    sha3_384,
+    sha3_512,
+    shake_128,
+    shake_256,
+    blake2b,
+    blake2s,
+
+    /// Look up an algorithm by hashlib name (case-insensitive)
+    pub fn fromName(name: []const u8) ?Algorithm {
+        var buf: [16]u8 = undefined;
+        if (name.len > buf.len) return null;
+        const lower = std.ascii.lowerString(&buf, name);
+        return std.meta.stringToEnum(Algorithm, lower);
+    }
+
+    /// Digest size in bytes (0 for the variable-length SHAKE functions)
+    pub fn digestSize(self: Algorithm) u32 {
+        return switch (self) {
+            .md4, .md5 => 16,
+            .sha1 => 20,
+            .sha224, .sha3_224 => 28,
+            .sha256, .sha3_256, .blake2s => 32,
+            .sha384, .sha3_384 => 48,
+            .sha512, .sha3_512, .blake2b => 64,
+            .shake_128, .shake_256 => 0,
+        };
+    }
+
+    /// Internal block size in bytes (the sponge rate for SHA-3/SHAKE)
+    pub fn blockSize(self: Algorithm) u32 {
+        return switch (self) {
+            .md4, .md5, .sha1, .sha224, .sha256, .blake2s => 64,
+            .sha384, .sha512, .blake2b => 128,
+            .sha3_224 => 144,
+            .sha3_256, .shake_256 => 136,
+            .sha3_384 => 104,
+            .sha3_512 => 72,
+            .shake_128 => 168,
+        };
+    }
+};
+
+/// Running hash state for any supported algorithm
+pub const Hasher = union(Algorithm) {
+    md4: Md4,
+    md5: hash.Md5,
+    sha1: hash.Sha1,
+    sha224: hash.sha2.Sha224,
+    sha256: hash.sha2.Sha256,
+    sha384: hash.sha2.Sha384,
+    sha512: hash.sha2.Sha512,
+    sha3_224: hash.sha3.Sha3_224,
+    sha3_256: hash.sha3.Sha3_256,
+    sha3_384: hash.sha3.Sha3_384,
+    sha3_512: hash.sha3.Sha3_512,
+    shake_128: hash.sha3.Shake128,
+    shake_256: hash.sha3.Shake256,
+    blake2b: hash.blake2.Blake2b512,
+    blake2s: hash.blake2.Blake2s256,
+
+    pub fn init(alg: Algorithm) Hasher {
+        return switch (alg) {
+            inline else => |tag| @unionInit(
+                Hasher,
+                @tagName(tag),
+                @FieldType(Hasher, @tagName(tag)).init(.{}),
+            ),
+        };
+    }
+
+    pub fn algorithm(self: *const Hasher) Algorithm {
+        return std.meta.activeTag(self.*);
+    }
+
+    pub fn update(self: *Hasher, data: []const u8) void {
+        switch (self.*) {
+            inline else => |*h| h.update(data),
+        }
+    }
+
+    /// Write the digest of everything hashed so far into out, leaving the
+    /// state usable. SHAKE fills all of out; fixed-size hashes write
+    /// digestSize() bytes. Returns the number of bytes written.
+    pub fn digest(self: *const Hasher, out: []u8) HashError!usize {
+        switch (self.*) {
+            inline .shake_128, .shake_256 => |h| {
+                var copy = h;
+                copy.final(out);
+                return out.len;
+            },
+            inline else => |h| {
+                const T = @TypeOf(h);
+                if (out.len < T.digest_length) return error.BufferTooSmall;
+                var copy = h;
+                copy.final(out[0..T.digest_length]);
+                return T.digest_length;
+            },
+        }
+    }
+};
+
+/// HMAC (RFC 2104) over any fixed-size Hasher algorithm
+pub const Hmac = struct {
+    inner: Hasher,
+    outer: Hasher,
+
+    pub fn init(alg: Algorithm, key: []const u8) HashError!Hmac {
+        if (alg.digestSize() == 0) return error.UnsupportedAlgorithm;
+
+        // Longest block is SHA3-224's 144-byte rate
+        var block = [_]u8{0} ** 144;
+        const block_size = alg.blockSize();
+
+        if (key.len > block_size) {
+            var key_hasher = Hasher.init(alg);
+            key_hasher.update(key);
+            _ = try key_hasher.digest(&block);
+        } else {
+            @memcpy(block[0..key.len], key);
+        }
+
+        var self = Hmac{ .inner = Hasher.init(alg), .outer = Hasher.init(alg) };
+        var pad: [144]u8 = undefined;
+        for (pad[0..block_size], block[0..block_size]) |*p, k| p.* = k ^ 0x36;
+        self.inner.update(pad[0..block_size]);
+        for (pad[0..block_size], block[0..block_size]) |*p, k| p.* = k ^ 0x5c;
+        self.outer.update(pad[0..block_size]);
+        return self;
+    }
+
+    pub fn update(self: *Hmac, data: []const u8) void {
+        self.inner.update(data);
+    }
+
+    /// Write the MAC of everything so far into out, leaving the state usable
+    pub fn digest(self: *const Hmac, out: []u8) HashError!usize {
+        var inner_digest: [64]u8 = undefined;
+        const n = try self.inner.digest(&inner_digest);
+
+        var outer = self.outer;
+        outer.update(inner_digest[0..n]);
+        return outer.digest(out);
+    }
+};
+
+// Tests
+test "hash algorithm lookup" {
+    try std.testing.expectEqual(Algorithm.sha256, Algorithm.fromName("SHA256").?);
+    try std.testing.expectEqual(Algorithm.shake_128, Algorithm.fromName("shake_128").?);
+    try std.testing.expect(Algorithm.fromName("md2") == null);
+    try std.testing.expect(Algorithm.fromName("a-very-long-unknown-name") == null);
+}
+
+test "hash digest is non-destructive" {
+    var hasher = Hasher.init(.sha256);
+    hasher.update("ab");
+
+    var first: [32]u8 = undefined;
+    _ = try hasher.digest(&first);
+
+    hasher.update("c");
+    var out: [32]u8 = undefined;
+    const n = try hasher.digest(&out);
+    try std.testing.expectEqual(@as(usize, 32), n);
+
+    const expected = "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad";
+    try std.testing.expectEqualStrings(expected, &std.fmt.bytesToHex(out, .lower));
+}
+
+test "hash copy diverges independently" {
+    var a = Hasher.init(.md5);
+    a.update("hello");
+    var b = a;
+    b.update(" world");
+
+    var out_a: [16]u8 = undefined;
+    var out_b: [16]u8 = undefined;
+    _ = try a.digest(&out_a);
+    _ = try b.digest(&out_b);
+    try std.testing.expect(!std.mem.eql(u8, &out_a, &out_b));
+
+    var small: [8]u8 = undefined;
+    try std.testing.expectError(error.BufferTooSmall, a.digest(&small));
+}
+
+test "hmac rfc 2202 vector" {
+    var mac = try Hmac.init(.md5, &([_]u8{0x0b} ** 16));
+    mac.update("Hi There");
+
+    var out: [16]u8 = undefined;
+    _ = try mac.digest(&out);
+    try std.testing.expectEqualStrings("9294727a3638bb1c13f48ef8158bfc9d", &std.fmt.bytesToHex(out, .lower));
+
+    try std.testing.expectError(error.UnsupportedAlgorithm, Hmac.init(.shake_128, "key"));
+}
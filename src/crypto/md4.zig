@@ -0,0 +1,133 @@
+// MD4 Message Digest (RFC 1320)
+//
+// Broken as a general-purpose hash, but still required by NTLM and the
+// RC4-HMAC Kerberos etype. std.crypto does not ship it, so it lives here with
+// the same interface as the std hashes so it can sit in the Hasher union.
+
+const std = @import("std");
+
+pub const Md4 = struct {
+    pub const digest_length = 16;
+    pub const block_length = 64;
+    pub const Options = struct {};
+
+    s: [4]u32,
+    buf: [block_length]u8,
+    buf_len: usize,
+    total_len: u64,
+
+    pub fn init(options: Options) Md4 {
+        _ = options;
+        return .{
+            .s = .{ 0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476 },
+            .buf = undefined,
+            .buf_len = 0,
+            .total_len = 0,
+        };
+    }
+
+    pub fn hash(data: []const u8, out: *[digest_length]u8, options: Options) void {
+        var h = Md4.init(options);
+        h.update(data);
+        h.final(out);
+    }
+
+    pub fn update(self: *Md4, data: []const u8) void {
+        var rest = data;
+        self.total_len += data.len;
+
+        if (self.buf_len > 0) {
+            const n = @min(block_length - self.buf_len, rest.len);
+            @memcpy(self.buf[self.buf_len..][0..n], rest[0..n]);
+            self.buf_len += n;
+            rest = rest[n..];
+            if (self.buf_len < block_length) return;
+            self.round(&self.buf);
+            self.buf_len = 0;
+        }
+
+        while (rest.len >= block_length) {
+            self.round(rest[0..block_length]);
+            rest = rest[block_length..];
+        }
+
+        @memcpy(self.buf[0..rest.len], rest);
+        self.buf_len = rest.len;
+    }
+
+    pub fn final(self: *Md4, out: *[digest_length]u8) void {
+        const bit_len = self.total_len *% 8;
+
+        // Pad with 0x80, zeros, then the 64-bit little-endian bit length
+        var pad = [_]u8{0} ** (block_length + 8);
+        pad[0] = 0x80;
+        const pad_len = if (self.buf_len < 56) 56 - self.buf_len else 120 - self.buf_len;
+        self.update(pad[0..pad_len]);
+
+        var len_bytes: [8]u8 = undefined;
+        std.mem.writeInt(u64, &len_bytes, bit_len, .little);
+        self.update(&len_bytes);
+
+        for (self.s, 0..) |word, i| {
+            std.mem.writeInt(u32, out[i * 4 ..][0..4], word, .little);
+        }
+    }
+
+    fn round(self: *Md4, block: *const [block_length]u8) void {
+        var x: [16]u32 = undefined;
+        for (&x, 0..) |*word, i| {
+            word.* = std.mem.readInt(u32, block[i * 4 ..][0..4], .little);
+        }
+
+        // Registers rotate a, d, c, b through each step; v[t] is the target
+        var v = self.s;
+
+        const order2 = [16]u8{ 0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15 };
+        const order3 = [16]u8{ 0, 8, 4, 12, 2, 10, 6, 14, 1, 9, 5, 13, 3, 11, 7, 15 };
+        const shifts1 = [4]u5{ 3, 7, 11, 19 };
+        const shifts2 = [4]u5{ 3, 5, 9, 13 };
+        const shifts3 = [4]u5{ 3, 9, 11, 15 };
+
+        inline for (0..16) |i| {
+            const t = (4 - i % 4) % 4;
+            const b = v[(t + 1) % 4];
+            const c = v[(t + 2) % 4];
+            const d = v[(t + 3) % 4];
+            v[t] = std.math.rotl(u32, v[t] +% ((b & c) | (~b & d)) +% x[i], shifts1[i % 4]);
+        }
+        inline for (0..16) |i| {
+            const t = (4 - i % 4) % 4;
+            const b = v[(t + 1) % 4];
+            const c = v[(t + 2) % 4];
+            const d = v[(t + 3) % 4];
+            v[t] = std.math.rotl(u32, v[t] +% ((b & c) | (b & d) | (c & d)) +% x[order2[i]] +% 0x5a827999, shifts2[i % 4]);
+        }
+        inline for (0..16) |i| {
+            const t = (4 - i % 4) % 4;
+            const b = v[(t + 1) % 4];
+            const c = v[(t + 2) % 4];
+            const d = v[(t + 3) % 4];
+            v[t] = std.math.rotl(u32, v[t] +% (b ^ c ^ d) +% x[order3[i]] +% 0x6ed9eba1, shifts3[i % 4]);
+        }
+
+        for (&self.s, v) |*s, value| s.* +%= value;
+    }
+};
+
+// Tests
+test "md4 test vectors" {
+    const vectors = [_]struct { input: []const u8, expected: []const u8 }{
+        .{ .input = "", .expected = "31d6cfe0d16ae931b73c59d7e0c089c0" },
+        .{ .input = "abc", .expected = "a448017aaf21d8525fc10ae87aa6729d" },
+        .{
+            .input = "12345678901234567890123456789012345678901234567890123456789012345678901234567890",
+            .expected = "e33b4ddc9c38f2199c3e7b164fcc0536",
+        },
+    };
+
+    for (vectors) |v| {
+        var out: [Md4.digest_length]u8 = undefined;
+        Md4.hash(v.input, &out, .{});
+        try std.testing.expectEqualStrings(v.expected, &std.fmt.bytesToHex(out, .lower));
+    }
+}
@@ -0,0 +1,192 @@
+// Execution Deadlines
+//
+// A Watchdog bounds how long one call into the guest may run: in wall time,
+// and in CPU time of the thread that made the call. It runs on a thread of
+// its own. The caller arms it before the call and disarms it after; if a
+// limit passes in between, the watchdog runs the interrupt it was armed
+// with, then runs it again every redeliver_ns until disarmed, since the
+// guest may catch what the first one raised.
+//
+// The watchdog only measures and signals. What an interrupt does is up to
+// its owner: Runtime makes the interpreter raise DeadlineExceeded (see
+// Runtime.deliverInterrupt). Interrupts run with the watchdog's lock held,
+// so once disarm() returns none is running or will run.
+
+const std = @import("std");
+const builtin = @import("builtin");
+
+/// How often an expired deadline is signalled again
+pub const redeliver_ns = 10 * std.time.ns_per_ms;
+
+pub const Limits = struct {
+    /// Wall-clock milliseconds; 0 = no limit
+    wall_ms: u32 = 0,
+    /// Milliseconds of CPU time on the calling thread; 0 = no limit.
+    /// Supported on Linux only.
+    cpu_ms: u32 = 0,
+
+    pub fn isSet(self: Limits) bool {
+        return self.wall_ms != 0 or self.cpu_ms != 0;
+    }
+};
+
+pub const Interrupt = struct {
+    context: *anyopaque,
+    func: *const fn (context: *anyopaque) void,
+};
+
+pub const Watchdog = struct {
+    mutex: std.Thread.Mutex = .{},
+    cond: std.Thread.Condition = .{},
+    /// Started by the first arm()
+    thread: ?std.Thread = null,
+    shutdown: bool = false,
+
+    // The armed call, valid while armed is set
+    armed: bool = false,
+    /// Set once a limit has passed
+    fired: bool = false,
+    limits: Limits = .{},
+    interrupt: Interrupt = undefined,
+    wall_start: std.time.Instant = undefined,
+    cpu_clock: ?std.posix.clockid_t = null,
+    cpu_start: u64 = 0,
+
+    /// Stop the watchdog thread
+    pub fn deinit(self: *Watchdog) void {
+        const thread = self.thread orelse return;
+        self.mutex.lock();
+        self.shutdown = true;
+        self.cond.signal();
+        self.mutex.unlock();
+        thread.join();
+        self.thread = null;
+    }
+
+    /// Start timing a call made from the current thread
+    pub fn arm(self: *Watchdog, limits: Limits, interrupt: Interrupt) !void {
+        const cpu_clock = if (limits.cpu_ms != 0) threadCpuClock() orelse return error.Unsupported else null;
+        const cpu_start = if (cpu_clock) |clock| try readClock(clock) else 0;
+        const wall_start = try std.time.Instant.now();
+
+        if (self.thread == null) self.thread = try std.Thread.spawn(.{}, main, .{self});
+
+        self.mutex.lock();
+        defer self.mutex.unlock();
+        self.armed = true;
+        self.fired = false;
+        self.limits = limits;
+        self.interrupt = interrupt;
+        self.wall_start = wall_start;
+        self.cpu_clock = cpu_clock;
+        self.cpu_start = cpu_start;
+        self.cond.signal();
+    }
+
+    /// Stop timing the call; returns whether a limit passed during it
+    pub fn disarm(self: *Watchdog) bool {
+        self.mutex.lock();
+        defer self.mutex.unlock();
+        self.armed = false;
+        return self.fired;
+    }
+
+    fn main(self: *Watchdog) void {
+        self.mutex.lock();
+        defer self.mutex.unlock();
+
+        while (!self.shutdown) {
+            if (!self.armed) {
+                self.cond.wait(&self.mutex);
+                continue;
+            }
+
+            const wait_ns = self.remaining() orelse blk: {
+                self.fired = true;
+                self.interrupt.func(self.interrupt.context);
+                break :blk redeliver_ns;
+            };
+            self.cond.timedWait(&self.mutex, wait_ns) catch {};
+        }
+    }
+
+    /// Time until the first limit passes; null once one has. A thread
+    /// cannot use CPU time faster than wall time, so sleeping for the CPU
+    /// budget left never oversleeps it.
+    fn remaining(self: *Watchdog) ?u64 {
+        var wait: u64 = std.math.maxInt(u64);
+        if (self.limits.wall_ms != 0) {
+            const now = std.time.Instant.now() catch return null;
+            const used = now.since(self.wall_start);
+            const limit = @as(u64, self.limits.wall_ms) * std.time.ns_per_ms;
+            if (used >= limit) return null;
+            wait = @min(wait, limit - used);
+        }
+        if (self.cpu_clock) |clock| {
+            const used = (readClock(clock) catch return null) -| self.cpu_start;
+            const limit = @as(u64, self.limits.cpu_ms) * std.time.ns_per_ms;
+            if (used >= limit) return null;
+            wait = @min(wait, limit - used);
+        }
+        return wait;
+    }
+};
+
+/// Clock measuring the calling thread's CPU time, readable from other
+/// threads; null where there is none
+fn threadCpuClock() ?std.posix.clockid_t {
+    if (builtin.os.tag != .linux) return null;
+    // What pthread_getcpuclockid returns: CPUCLOCK_SCHED with the
+    // per-thread bit, for this thread id
+    const tid = std.os.linux.gettid();
+    const id: i32 = (~tid << 3) | 6;
+    return @enumFromInt(@as(u32, @bitCast(id)));
+}
+
+fn readClock(clock: std.posix.clockid_t) !u64 {
+    const ts = try std.posix.clock_gettime(clock);
+    return @as(u64, @intCast(ts.sec)) * std.time.ns_per_s + @as(u64, @intCast(ts.nsec));
+}
+
+test "watchdog deadlines" {
+    const Counter = struct {
+        count: std.atomic.Value(u32) = .init(0),
+
+        fn bump(context: *anyopaque) void {
+            const self: *@This() = @ptrCast(@alignCast(context));
+            _ = self.count.fetchAdd(1, .monotonic);
+        }
+    };
+
+    var watchdog: Watchdog = .{};
+    defer watchdog.deinit();
+    var counter: Counter = .{};
+    const interrupt: Interrupt = .{ .context = &counter, .func = Counter.bump };
+
+    // Disarmed in time: never signalled
+    try watchdog.arm(.{ .wall_ms = 10_000 }, interrupt);
+    try std.testing.expect(!watchdog.disarm());
+    try std.testing.expectEqual(@as(u32, 0), counter.count.load(.monotonic));
+
+    // Expired: signalled, then signalled again while still running
+    try watchdog.arm(.{ .wall_ms = 5 }, interrupt);
+    std.Thread.sleep(5 * redeliver_ns);
+    try std.testing.expect(watchdog.disarm());
+    const delivered = counter.count.load(.monotonic);
+    try std.testing.expect(delivered >= 2);
+    std.Thread.sleep(2 * redeliver_ns);
+    try std.testing.expectEqual(delivered, counter.count.load(.monotonic));
+
+    if (builtin.os.tag == .linux) {
+        // CPU time passes only while the thread runs
+        counter.count.store(0, .monotonic);
+        try watchdog.arm(.{ .cpu_ms = 5 }, interrupt);
+        std.Thread.sleep(3 * redeliver_ns);
+        try std.testing.expectEqual(@as(u32, 0), counter.count.load(.monotonic));
+        var timer = try std.time.Timer.start();
+        while (counter.count.load(.monotonic) == 0 and timer.read() < std.time.ns_per_s) {
+            std.mem.doNotOptimizeAway(timer.read());
+        }
+        try std.testing.expect(watchdog.disarm());
+    }
+}
@@ -0,0 +1,440 @@
+// Binary-to-text transforms
+//
+// Base64 and hex encoding/decoding, repeating-key XOR and byte translation
+// for the binascii/base64 acceleration. The codecs run 16 bytes at a time
+// on @Vector registers (SSE/NEON on the host, scalar fallback elsewhere)
+// and finish the tail with the scalar path.
+//
+// Decoders only accept canonical input: base64 without whitespace or
+// stray characters and with padding only on the last quad, hex of even
+// length. Anything else is rejected so the guest can hand it to binascii,
+// which implements the lenient rules and the exact error messages.
+
+const std = @import("std");
+
+pub const DecodeError = error{ InvalidCharacter, InvalidLength };
+
+const V16 = @Vector(16, u8);
+const Shift16 = @Vector(16, u3);
+
+/// Characters for base64 values 62 and 63 ("+/" or an altchars pair)
+pub const Alt = struct {
+    c62: u8 = '+',
+    c63: u8 = '/',
+};
+
+// ============================================================================
+// Base64
+// ============================================================================
+
+pub fn base64EncodedLen(n: usize) usize {
+    return (n + 2) / 3 * 4;
+}
+
+/// Exact decoded size of canonical base64, or an error for input that is
+/// not a whole number of quads or has misplaced padding
+pub fn base64DecodedLen(src: []const u8) DecodeError!usize {
+    if (src.len % 4 != 0) return error.InvalidLength;
+    if (src.len == 0) return 0;
+    var pad: usize = 0;
+    if (src[src.len - 1] == '=') pad += 1;
+    if (src[src.len - 2] == '=') pad += 1;
+    return src.len / 4 * 3 - pad;
+}
+
+fn base64Char(value: u8, alt: Alt) u8 {
+    return switch (value) {
+        0...25 => 'A' + value,
+        26...51 => 'a' + (value - 26),
+        52...61 => '0' + (value - 52),
+        62 => alt.c62,
+        else => alt.c63,
+    };
+}
+
+fn base64Value(c: u8, alt: Alt) ?u8 {
+    return switch (c) {
+        'A'...'Z' => c - 'A',
+        'a'...'z' => c - 'a' + 26,
+        '0'...'9' => c - '0' + 52,
+        else => if (c == alt.c62) 62 else if (c == alt.c63) 63 else null,
+    };
+}
+
+/// Encode src into dst, which must be base64EncodedLen(src.len) long
+pub fn base64Encode(dst: []u8, src: []const u8, alt: Alt) void {
+    std.debug.assert(dst.len == base64EncodedLen(src.len));
+
+    // Per output lane: idx = ((hi << sl) | (lo >> sr)) & 63, where hi/lo
+    // pick bytes of the lane's 3-byte group (lane 0 of a group takes no hi)
+    const hi_mask = comptime groupMask(&.{ -1, 0, 1, 2 });
+    const lo_mask = comptime groupMask(&.{ 0, 1, 2, 2 });
+    const sl: Shift16 = .{ 0, 4, 2, 0, 0, 4, 2, 0, 0, 4, 2, 0, 0, 4, 2, 0 };
+    const sr: Shift16 = .{ 2, 4, 6, 0, 2, 4, 6, 0, 2, 4, 6, 0, 2, 4, 6, 0 };
+    const zero: V16 = @splat(0);
+
+    var i: usize = 0;
+    var o: usize = 0;
+    // 12 input bytes per block, but each load reads 16
+    while (i + 16 <= src.len) : ({
+        i += 12;
+        o += 16;
+    }) {
+        const v: V16 = src[i..][0..16].*;
+        const hi = @shuffle(u8, v, zero, hi_mask);
+        const lo = @shuffle(u8, v, zero, lo_mask);
+        const idx = ((hi << sl) | (lo >> sr)) & @as(V16, @splat(63));
+        dst[o..][0..16].* = base64Chars(idx, alt);
+    }
+
+    while (i + 3 <= src.len) : ({
+        i += 3;
+        o += 4;
+    }) {
+        const a = src[i];
+        const b = src[i + 1];
+        const c = src[i + 2];
+        dst[o] = base64Char(a >> 2, alt);
+        dst[o + 1] = base64Char(((a & 3) << 4) | (b >> 4), alt);
+        dst[o + 2] = base64Char(((b & 15) << 2) | (c >> 6), alt);
+        dst[o + 3] = base64Char(c & 63, alt);
+    }
+
+    switch (src.len - i) {
+        1 => {
+            const a = src[i];
+            dst[o] = base64Char(a >> 2, alt);
+            dst[o + 1] = base64Char((a & 3) << 4, alt);
+            dst[o + 2] = '=';
+            dst[o + 3] = '=';
+        },
+        2 => {
+            const a = src[i];
+            const b = src[i + 1];
+            dst[o] = base64Char(a >> 2, alt);
+            dst[o + 1] = base64Char(((a & 3) << 4) | (b >> 4), alt);
+            dst[o + 2] = base64Char((b & 15) << 2, alt);
+            dst[o + 3] = '=';
+        },
+        else => {},
+    }
+}
+
+/// Shuffle mask repeating a per-group pattern over four 3-byte groups;
+/// -1 selects zero
+fn groupMask(comptime pattern: []const i32) @Vector(16, i32) {
+    var mask: [16]i32 = undefined;
+    for (0..4) |g| {
+        for (pattern, 0..) |p, k| {
+            mask[g * 4 + k] = if (p < 0) ~@as(i32, 0) else @as(i32, @intCast(g * 3)) + p;
+        }
+    }
+    return mask;
+}
+
+fn base64Chars(idx: V16, alt: Alt) V16 {
+    const upper = idx < @as(V16, @splat(26));
+    const lower = idx < @as(V16, @splat(52));
+    const digit = idx < @as(V16, @splat(62));
+    const is62 = idx == @as(V16, @splat(62));
+
+    var out = @select(u8, digit, idx -% @as(V16, @splat(4)), @select(u8, is62, @as(V16, @splat(alt.c62)), @as(V16, @splat(alt.c63))));
+    out = @select(u8, lower, idx +% @as(V16, @splat('a' - 26)), out);
+    out = @select(u8, upper, idx +% @as(V16, @splat('A')), out);
+    return out;
+}
+
+/// Decode canonical base64 into dst, which must be base64DecodedLen(src)
+/// long. Bits past the last full byte are ignored, as binascii does.
+pub fn base64Decode(dst: []u8, src: []const u8, alt: Alt) DecodeError!void {
+    std.debug.assert(dst.len == try base64DecodedLen(src));
+    if (src.len == 0) return;
+
+    // The last quad may hold padding, everything before it may not
+    const body = src[0 .. src.len - 4];
+
+    // Output lane j of group g = j / 3, m = j % 3 combines values 4g+m
+    // and 4g+m+1; lanes 12-15 are unused
+    const hi_mask = comptime quadMask(0);
+    const lo_mask = comptime quadMask(1);
+    const sl: Shift16 = .{ 2, 4, 6, 2, 4, 6, 2, 4, 6, 2, 4, 6, 0, 0, 0, 0 };
+    const sr: Shift16 = .{ 4, 2, 0, 4, 2, 0, 4, 2, 0, 4, 2, 0, 0, 0, 0, 0 };
+
+    var i: usize = 0;
+    var o: usize = 0;
+    // 16 chars in, 12 bytes out; the store writes 16, so keep 4 bytes spare
+    while (i + 16 <= body.len and o + 16 <= dst.len) : ({
+        i += 16;
+        o += 12;
+    }) {
+        const v = try base64Values(body[i..][0..16].*, alt);
+        const hi = @shuffle(u8, v, undefined, hi_mask);
+        const lo = @shuffle(u8, v, undefined, lo_mask);
+        dst[o..][0..16].* = (hi << sl) | (lo >> sr);
+    }
+
+    while (i < body.len) : ({
+        i += 4;
+        o += 3;
+    }) {
+        const quad = try scalarQuad(body[i..][0..4], alt);
+        dst[o..][0..3].* = quad;
+    }
+
+    // Final quad: "xxxx", "xxx=" or "xx=="
+    const last = src[src.len - 4 ..][0..4];
+    var values: [4]u8 = undefined;
+    const n = dst.len - o; // bytes left: 1, 2 or 3
+    for (0..n + 1) |k| {
+        values[k] = base64Value(last[k], alt) orelse return error.InvalidCharacter;
+    }
+    for (n + 1..4) |k| {
+        if (last[k] != '=') return error.InvalidCharacter;
+        values[k] = 0;
+    }
+    const bytes = [3]u8{
+        (values[0] << 2) | (values[1] >> 4),
+        (values[1] << 4) | (values[2] >> 2),
+        (values[2] << 6) | values[3],
+    };
+    @memcpy(dst[o..], bytes[0..n]);
+}
+
+fn quadMask(comptime offset: i32) @Vector(16, i32) {
+    var mask: [16]i32 = undefined;
+    for (0..16) |j| {
+        const g: i32 = @intCast(j / 3);
+        const m: i32 = @intCast(j % 3);
+        mask[j] = if (j < 12) g * 4 + m + offset else 0;
+    }
+    return mask;
+}
+
+fn base64Values(chars: V16, alt: Alt) DecodeError!V16 {
+    const upper = (chars >= @as(V16, @splat('A'))) & (chars <= @as(V16, @splat('Z')));
+    const lower = (chars >= @as(V16, @splat('a'))) & (chars <= @as(V16, @splat('z')));
+    const digit = (chars >= @as(V16, @splat('0'))) & (chars <= @as(V16, @splat('9')));
+    const is62 = chars == @as(V16, @splat(alt.c62));
+    const is63 = chars == @as(V16, @splat(alt.c63));
+
+    const valid = upper | lower | digit | is62 | is63;
+    if (!@reduce(.And, valid)) return error.InvalidCharacter;
+
+    var values = @select(u8, is62, @as(V16, @splat(62)), @as(V16, @splat(63)));
+    values = @select(u8, digit, chars +% @as(V16, @splat(52 - '0')), values);
+    values = @select(u8, lower, chars -% @as(V16, @splat('a' - 26)), values);
+    values = @select(u8, upper, chars -% @as(V16, @splat('A')), values);
+    return values;
+}
+
+fn scalarQuad(chars: *const [4]u8, alt: Alt) DecodeError![3]u8 {
+    var values: [4]u8 = undefined;
+    for (chars, &values) |c, *v| {
+        v.* = base64Value(c, alt) orelse return error.InvalidCharacter;
+    }
+    return .{
+        (values[0] << 2) | (values[1] >> 4),
+        (values[1] << 4) | (values[2] >> 2),
+        (values[2] << 6) | values[3],
+    };
+}
+
+// ============================================================================
+// Hex
+// ============================================================================
+
+const hex_digits = "0123456789abcdef";
+
+/// Lowercase hex of src into dst, which must be twice as long
+pub fn hexEncode(dst: []u8, src: []const u8) void {
+    std.debug.assert(dst.len == src.len * 2);
+
+    // Interleave high and low nibbles: byte k -> lanes 2k, 2k+1
+    const interleave = comptime blk: {
+        var mask: [32]i32 = undefined;
+        for (0..16) |k| {
+            mask[2 * k] = @intCast(k);
+            mask[2 * k + 1] = ~@as(i32, @intCast(k));
+        }
+        break :blk mask;
+    };
+    const V32 = @Vector(32, u8);
+
+    var i: usize = 0;
+    while (i + 16 <= src.len) : (i += 16) {
+        const v: V16 = src[i..][0..16].*;
+        const hi = v >> @as(Shift16, @splat(4));
+        const lo = v & @as(V16, @splat(15));
+        const nibbles: V32 = @shuffle(u8, hi, lo, interleave);
+        const letters = nibbles >= @as(V32, @splat(10));
+        dst[i * 2 ..][0..32].* = nibbles +% @select(u8, letters, @as(V32, @splat('a' - 10)), @as(V32, @splat('0')));
+    }
+
+    for (src[i..], i..) |b, k| {
+        dst[2 * k] = hex_digits[b >> 4];
+        dst[2 * k + 1] = hex_digits[b & 15];
+    }
+}
+
+fn hexValue(c: u8) ?u8 {
+    return switch (c) {
+        '0'...'9' => c - '0',
+        'a'...'f' => c - 'a' + 10,
+        'A'...'F' => c - 'A' + 10,
+        else => null,
+    };
+}
+
+/// Decode hex (either case) into dst, which must be half as long as src
+pub fn hexDecode(dst: []u8, src: []const u8) DecodeError!void {
+    if (src.len % 2 != 0) return error.InvalidLength;
+    std.debug.assert(dst.len == src.len / 2);
+
+    const V32 = @Vector(32, u8);
+    const even = comptime blk: {
+        var mask: [16]i32 = undefined;
+        for (0..16) |k| mask[k] = @intCast(2 * k);
+        break :blk mask;
+    };
+    const odd = comptime blk: {
+        var mask: [16]i32 = undefined;
+        for (0..16) |k| mask[k] = @intCast(2 * k + 1);
+        break :blk mask;
+    };
+
+    var i: usize = 0;
+    while (i + 32 <= src.len) : (i += 32) {
+        const chars: V32 = src[i..][0..32].*;
+        const digit = (chars >= @as(V32, @splat('0'))) & (chars <= @as(V32, @splat('9')));
+        // Folding to lowercase maps 'A'-'F' onto 'a'-'f' and leaves digits alone
+        const folded = chars | @as(V32, @splat(0x20));
+        const letter = (folded >= @as(V32, @splat('a'))) & (folded <= @as(V32, @splat('f')));
+        if (!@reduce(.And, digit | letter)) return error.InvalidCharacter;
+
+        const nibbles = @select(u8, digit, chars -% @as(V32, @splat('0')), folded -% @as(V32, @splat('a' - 10)));
+        const hi = @shuffle(u8, nibbles, undefined, even);
+        const lo = @shuffle(u8, nibbles, undefined, odd);
+        dst[i / 2 ..][0..16].* = (hi << @as(Shift16, @splat(4))) | lo;
+    }
+
+    while (i < src.len) : (i += 2) {
+        const hi = hexValue(src[i]) orelse return error.InvalidCharacter;
+        const lo = hexValue(src[i + 1]) orelse return error.InvalidCharacter;
+        dst[i / 2] = (hi << 4) | lo;
+    }
+}
+
+// ============================================================================
+// Bulk byte transforms
+// ============================================================================
+
+/// data[i] ^= key[i % key.len], in place
+pub fn xorRepeat(data: []u8, key: []const u8) void {
+    if (key.len == 0) return;
+
+    // Short keys are repeated into a block so the inner loop always works on
+    // long contiguous runs
+    var block_buf: [256]u8 = undefined;
+    const block: []const u8 = if (key.len >= block_buf.len) key else blk: {
+        const reps = block_buf.len / key.len;
+        for (0..reps) |r| @memcpy(block_buf[r * key.len ..][0..key.len], key);
+        break :blk block_buf[0 .. reps * key.len];
+    };
+
+    var i: usize = 0;
+    while (i < data.len) : (i += block.len) {
+        const n = @min(block.len, data.len - i);
+        xorSlices(data[i..][0..n], block[0..n]);
+    }
+}
+
+fn xorSlices(dst: []u8, src: []const u8) void {
+    var i: usize = 0;
+    while (i + 16 <= dst.len) : (i += 16) {
+        const a: V16 = dst[i..][0..16].*;
+        const b: V16 = src[i..][0..16].*;
+        dst[i..][0..16].* = a ^ b;
+    }
+    for (dst[i..], src[i..]) |*d, s| d.* ^= s;
+}
+
+/// data[i] = table[data[i]], in place
+pub fn translate(data: []u8, table: *const [256]u8) void {
+    // No portable vector gather; an unrolled table walk is what bytes.translate does natively
+    var i: usize = 0;
+    while (i + 4 <= data.len) : (i += 4) {
+        data[i] = table[data[i]];
+        data[i + 1] = table[data[i + 1]];
+        data[i + 2] = table[data[i + 2]];
+        data[i + 3] = table[data[i + 3]];
+    }
+    for (data[i..]) |*b| b.* = table[b.*];
+}
+
+// Tests
+test "base64 matches std.base64 at every tail length" {
+    const allocator = std.testing.allocator;
+    var prng = std.Random.DefaultPrng.init(0x5eed);
+    var src: [100]u8 = undefined;
+    prng.random().bytes(&src);
+
+    for (0..src.len) |n| {
+        const expected = try allocator.alloc(u8, std.base64.standard.Encoder.calcSize(n));
+        defer allocator.free(expected);
+        _ = std.base64.standard.Encoder.encode(expected, src[0..n]);
+
+        const encoded = try allocator.alloc(u8, base64EncodedLen(n));
+        defer allocator.free(encoded);
+        base64Encode(encoded, src[0..n], .{});
+        try std.testing.expectEqualStrings(expected, encoded);
+
+        const decoded = try allocator.alloc(u8, try base64DecodedLen(encoded));
+        defer allocator.free(decoded);
+        try base64Decode(decoded, encoded, .{});
+        try std.testing.expectEqualSlices(u8, src[0..n], decoded);
+    }
+}
+
+test "base64 rejects non-canonical input" {
+    var buf: [64]u8 = undefined;
+    try std.testing.expectError(error.InvalidLength, base64DecodedLen("YQ="));
+    try std.testing.expectError(error.InvalidCharacter, base64Decode(buf[0..2], "Y=Q=", .{}));
+    try std.testing.expectError(error.InvalidCharacter, base64Decode(buf[0..15], "QUJD\nREVGR0hJSktMTU5", .{}));
+    try std.testing.expectError(error.InvalidCharacter, base64Decode(buf[0..12], "QUJDREVGR0hJ-ktM", .{}));
+
+    // urlsafe alphabet via altchars
+    base64Encode(buf[0..4], "\xfb\xff", .{ .c62 = '-', .c63 = '_' });
+    try std.testing.expectEqualStrings("-_8=", buf[0..4]);
+}
+
+test "hex round trip" {
+    var src: [70]u8 = undefined;
+    for (&src, 0..) |*b, k| b.* = @intCast(k * 37 % 256);
+    var encoded: [140]u8 = undefined;
+    hexEncode(&encoded, &src);
+    try std.testing.expectEqualStrings("00254a6f94b9de03", encoded[0..16]);
+
+    // Upper case decodes the same
+    for (encoded[64..]) |*c| c.* = std.ascii.toUpper(c.*);
+    var decoded: [70]u8 = undefined;
+    try hexDecode(&decoded, &encoded);
+    try std.testing.expectEqualSlices(u8, &src, &decoded);
+
+    try std.testing.expectError(error.InvalidLength, hexDecode(decoded[0..1], "abc"));
+    try std.testing.expectError(error.InvalidCharacter, hexDecode(decoded[0..1], "g0"));
+}
+
+test "xor and translate" {
+    var data: [600]u8 = undefined;
+    @memset(&data, 0x5a);
+    xorRepeat(&data, "\x01\x02\x03");
+    for (data, 0..) |b, k| {
+        try std.testing.expectEqual(@as(u8, 0x5a) ^ @as(u8, @intCast(k % 3 + 1)), b);
+    }
+
+    var table: [256]u8 = undefined;
+    for (&table, 0..) |*t, k| t.* = @intCast(255 - k);
+    var text = "abc".*;
+    translate(&text, &table);
+    try std.testing.expectEqualSlices(u8, &.{ 255 - 'a', 255 - 'b', 255 - 'c' }, &text);
+}
@@ -0,0 +1,195 @@
+const std = @import("std");
+const zware = @import("zware");
+const binascii = @import("binascii.zig");
+
+/// WASI errno values returned by binascii host functions
+pub const BinasciiError = enum(u32) {
+    success = 0,
+    ilseq = 25, // Not canonical input; the guest falls back to binascii
+    inval = 28, // Out-of-bounds buffer or wrong output size
+};
+
+fn pushError(vm: *zware.VirtualMachine, err: BinasciiError) zware.WasmError!void {
+    try vm.pushOperand(u32, @intFromEnum(err));
+}
+
+/// Slice of guest memory, or null if the range is out of bounds
+fn guestSlice(memory_slice: []u8, ptr: u32, len: u32) ?[]u8 {
+    if (@as(u64, ptr) + len > memory_slice.len) return null;
+    return memory_slice[ptr .. ptr + len];
+}
+
+/// altchars are passed packed as c62 | c63 << 8
+fn unpackAlt(packed_alt: u32) binascii.Alt {
+    return .{ .c62 = @truncate(packed_alt), .c63 = @truncate(packed_alt >> 8) };
+}
+
+/// binascii_b64encode: Base64 encode src into dst, which must be exactly
+/// the encoded size
+pub fn binasciiB64Encode(vm: *zware.VirtualMachine, _: usize) zware.WasmError!void {
+    const alt = vm.popOperand(u32);
+    const dst_len = vm.popOperand(u32);
+    const dst_ptr = vm.popOperand(u32);
+    const src_len = vm.popOperand(u32);
+    const src_ptr = vm.popOperand(u32);
+
+    const mem = try vm.inst.getMemory(0);
+    const src = guestSlice(mem.memory(), src_ptr, src_len) orelse return pushError(vm, .inval);
+    const dst = guestSlice(mem.memory(), dst_ptr, dst_len) orelse return pushError(vm, .inval);
+    if (dst.len != binascii.base64EncodedLen(src.len)) return pushError(vm, .inval);
+
+    binascii.base64Encode(dst, src, unpackAlt(alt));
+    try pushError(vm, .success);
+}
+
+/// binascii_b64decode: Decode canonical base64 into dst (at least the
+/// decoded size) and write the decoded length to out_len_ptr
+pub fn binasciiB64Decode(vm: *zware.VirtualMachine, _: usize) zware.WasmError!void {
+    const out_len_ptr = vm.popOperand(u32);
+    const alt = vm.popOperand(u32);
+    const dst_cap = vm.popOperand(u32);
+    const dst_ptr = vm.popOperand(u32);
+    const src_len = vm.popOperand(u32);
+    const src_ptr = vm.popOperand(u32);
+
+    const mem = try vm.inst.getMemory(0);
+    const src = guestSlice(mem.memory(), src_ptr, src_len) orelse return pushError(vm, .inval);
+    const dst = guestSlice(mem.memory(), dst_ptr, dst_cap) orelse return pushError(vm, .inval);
+    if (@as(u64, out_len_ptr) + 4 > mem.memory().len) return pushError(vm, .inval);
+
+    const n = binascii.base64DecodedLen(src) catch return pushError(vm, .ilseq);
+    if (n > dst.len) return pushError(vm, .inval);
+    binascii.base64Decode(dst[0..n], src, unpackAlt(alt)) catch return pushError(vm, .ilseq);
+
+    try mem.write(u32, 0, out_len_ptr, @intCast(n));
+    try pushError(vm, .success);
+}
+
+/// binascii_hexlify: Lowercase hex of src into dst (twice src's size)
+pub fn binasciiHexlify(vm: *zware.VirtualMachine, _: usize) zware.WasmError!void {
+    const dst_len = vm.popOperand(u32);
+    const dst_ptr = vm.popOperand(u32);
+    const src_len = vm.popOperand(u32);
+    const src_ptr = vm.popOperand(u32);
+
+    const mem = try vm.inst.getMemory(0);
+    const src = guestSlice(mem.memory(), src_ptr, src_len) orelse return pushError(vm, .inval);
+    const dst = guestSlice(mem.memory(), dst_ptr, dst_len) orelse return pushError(vm, .inval);
+    if (dst.len != @as(u64, src.len) * 2) return pushError(vm, .inval);
+
+    binascii.hexEncode(dst, src);
+    try pushError(vm, .success);
+}
+
+/// binascii_unhexlify: Decode hex src into dst (half src's size)
+pub fn binasciiUnhexlify(vm: *zware.VirtualMachine, _: usize) zware.WasmError!void {
+    const dst_len = vm.popOperand(u32);
+    const dst_ptr = vm.popOperand(u32);
+    const src_len = vm.popOperand(u32);
+    const src_ptr = vm.popOperand(u32);
+
+    const mem = try vm.inst.getMemory(0);
+    const src = guestSlice(mem.memory(), src_ptr, src_len) orelse return pushError(vm, .inval);
+    const dst = guestSlice(mem.memory(), dst_ptr, dst_len) orelse return pushError(vm, .inval);
+    if (src.len % 2 != 0) return pushError(vm, .ilseq);
+    if (dst.len != src.len / 2) return pushError(vm, .inval);
+
+    binascii.hexDecode(dst, src) catch return pushError(vm, .ilseq);
+    try pushError(vm, .success);
+}
+
+/// binascii_xor: XOR a guest buffer in place with a repeating key
+pub fn binasciiXor(vm: *zware.VirtualMachine, _: usize) zware.WasmError!void {
+    const key_len = vm.popOperand(u32);
+    const key_ptr = vm.popOperand(u32);
+    const data_len = vm.popOperand(u32);
+    const data_ptr = vm.popOperand(u32);
+
+    const mem = try vm.inst.getMemory(0);
+    const data = guestSlice(mem.memory(), data_ptr, data_len) orelse return pushError(vm, .inval);
+    const key = guestSlice(mem.memory(), key_ptr, key_len) orelse return pushError(vm, .inval);
+    if (key.len == 0) return pushError(vm, .inval);
+
+    binascii.xorRepeat(data, key);
+    try pushError(vm, .success);
+}
+
+/// binascii_translate: Map every byte of a guest buffer through a
+/// 256-byte table, in place
+pub fn binasciiTranslate(vm: *zware.VirtualMachine, _: usize) zware.WasmError!void {
+    const table_ptr = vm.popOperand(u32);
+    const data_len = vm.popOperand(u32);
+    const data_ptr = vm.popOperand(u32);
+
+    const mem = try vm.inst.getMemory(0);
+    const data = guestSlice(mem.memory(), data_ptr, data_len) orelse return pushError(vm, .inval);
+    const table = guestSlice(mem.memory(), table_ptr, 256) orelse return pushError(vm, .inval);
+
+    binascii.translate(data, table[0..256]);
+    try pushError(vm, .success);
+}
+
+/// Register all binascii WASI functions
+pub fn registerBinasciiFunctions(store: *zware.Store) !void {
+    const i32_result = &[_]zware.ValType{.I32};
+
+    // binascii_b64encode(src_ptr: i32, src_len: i32, dst_ptr: i32, dst_len: i32, altchars: i32) -> i32
+    try store.exposeHostFunction(
+        "wasi_snapshot_preview1",
+        "binascii_b64encode",
+        binasciiB64Encode,
+        0,
+        &.{ .I32, .I32, .I32, .I32, .I32 },
+        i32_result,
+    );
+
+    // binascii_b64decode(src_ptr: i32, src_len: i32, dst_ptr: i32, dst_cap: i32, altchars: i32, out_len_ptr: i32) -> i32
+    try store.exposeHostFunction(
+        "wasi_snapshot_preview1",
+        "binascii_b64decode",
+        binasciiB64Decode,
+        0,
+        &.{ .I32, .I32, .I32, .I32, .I32, .I32 },
+        i32_result,
+    );
+
+    // binascii_hexlify(src_ptr: i32, src_len: i32, dst_ptr: i32, dst_len: i32) -> i32
+    try store.exposeHostFunction(
+        "wasi_snapshot_preview1",
+        "binascii_hexlify",
+        binasciiHexlify,
+        0,
+        &.{ .I32, .I32, .I32, .I32 },
+        i32_result,
+    );
+
+    // binascii_unhexlify(src_ptr: i32, src_len: i32, dst_ptr: i32, dst_len: i32) -> i32
+    try store.exposeHostFunction(
+        "wasi_snapshot_preview1",
+        "binascii_unhexlify",
+        binasciiUnhexlify,
+        0,
+        &.{ .I32, .I32, .I32, .I32 },
+        i32_result,
+    );
+
+    // binascii_xor(data_ptr: i32, data_len: i32, key_ptr: i32, key_len: i32) -> i32
+    try store.exposeHostFunction(
+        "wasi_snapshot_preview1",
+        "binascii_xor",
+        binasciiXor,
+        0,
+        &.{ .I32, .I32, .I32, .I32 },
+        i32_result,
+    );
+
+    // binascii_translate(data_ptr: i32, data_len: i32, table_ptr: i32) -> i32
+    try store.exposeHostFunction(
+        "wasi_snapshot_preview1",
+        "binascii_translate",
+        binasciiTranslate,
+        0,
+        &.{ .I32, .I32, .I32 },
+        i32_result,
+    );
+}
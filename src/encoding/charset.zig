@@ -0,0 +1,517 @@
+// Charset Detection
+//
+// Guesses the encoding of an undeclared byte buffer, following the approach
+// of charset_normalizer (which requests uses for Response.apparent_encoding):
+// - BOMs, ASCII, UTF-8 and BOM-less UTF-16 are decided structurally
+// - Each single-byte code page that decodes the buffer is scored for "mess"
+//   (control characters, symbols glued to letters, impossible case changes,
+//   mixed scripts inside a word) and for "coherence" (how closely the letter
+//   frequencies match a known language)
+// - CJK multi-byte encodings are validated byte-wise and told apart by
+//   lead-byte statistics
+//
+// Encoding names are Python codec names, as charset_normalizer reports them.
+
+const std = @import("std");
+const codepages = @import("codepages.zig");
+
+/// Only this much of the buffer is scored; structural checks (UTF-8
+/// validity) still cover all of it
+pub const max_scan = 1 << 20;
+
+/// Candidates messier than this are rejected (charset_normalizer's default)
+const mess_threshold: f32 = 0.2;
+
+/// Weight of coherence against mess when ranking single-byte code pages
+const coherence_weight: f32 = 0.25;
+
+pub const Result = struct {
+    /// Python codec name, or null if no encoding fits (binary data)
+    encoding: ?[]const u8,
+    /// Language name, or "" if unknown
+    language: []const u8 = "",
+    confidence: f32,
+    /// The encoding was decided by a byte order mark
+    bom: bool = false,
+};
+
+pub fn detect(data: []const u8) Result {
+    if (detectBom(data)) |result| return result;
+    if (data.len == 0) return .{ .encoding = "utf_8", .confidence = 1.0 };
+
+    if (detectUtf16(data)) |name| return .{ .encoding = name, .confidence = 1.0 };
+
+    const ascii = for (data) |b| {
+        if (b >= 0x80) break false;
+    } else true;
+
+    if (ascii or std.unicode.utf8ValidateSlice(data)) {
+        var scorer = Scorer{};
+        var it = std.unicode.Utf8View.initUnchecked(utf8Sample(data)).iterator();
+        while (it.nextCodepoint()) |c| scorer.feed(c);
+        const coherence = scorer.coherence();
+        return .{
+            .encoding = if (ascii) "ascii" else "utf_8",
+            .language = coherence.language,
+            .confidence = 1.0 - scorer.mess(),
+        };
+    }
+
+    const sample = data[0..@min(data.len, max_scan)];
+
+    // Best single-byte code page
+    var single: ?struct { page: *const codepages.CodePage, mess: f32, rank: f32, language: []const u8 } = null;
+    for (&codepages.all) |*page| {
+        var scorer = Scorer{};
+        const decodable = for (sample) |b| {
+            const c: u21 = if (b < 0x80) b else page.high[b - 0x80];
+            if (c == 0) break false;
+            scorer.feed(c);
+        } else true;
+        if (!decodable) continue;
+
+        const mess = scorer.mess();
+        const coherence = scorer.coherence();
+        const rank = mess - coherence_weight * coherence.score;
+        if (single == null or rank < single.?.rank) {
+            single = .{ .page = page, .mess = mess, .rank = rank, .language = coherence.language };
+        }
+    }
+
+    // A multi-byte encoding that validates and looks like its language beats
+    // any code page that needed to tolerate some mess
+    if (detectCjk(sample)) |cjk| {
+        if (cjk.score >= 0.5 and (single == null or single.?.mess > 0.05)) {
+            return .{ .encoding = cjk.name, .language = cjk.language, .confidence = cjk.score };
+        }
+    }
+
+    if (single) |best| {
+        if (best.mess <= mess_threshold) {
+            return .{ .encoding = best.page.name, .language = best.language, .confidence = 1.0 - best.mess };
+        }
+    }
+    return .{ .encoding = null, .confidence = 0.0 };
+}
+
+fn detectBom(data: []const u8) ?Result {
+    const boms = [_]struct { mark: []const u8, name: []const u8 }{
+        // UTF-32 first: its little-endian BOM starts with UTF-16's
+        .{ .mark = "\xff\xfe\x00\x00", .name = "utf_32" },
+        .{ .mark = "\x00\x00\xfe\xff", .name = "utf_32" },
+        .{ .mark = "\xef\xbb\xbf", .name = "utf_8" },
+        .{ .mark = "\xff\xfe", .name = "utf_16" },
+        .{ .mark = "\xfe\xff", .name = "utf_16" },
+    };
+    for (boms) |bom| {
+        if (std.mem.startsWith(u8, data, bom.mark)) {
+            return .{ .encoding = bom.name, .confidence = 1.0, .bom = true };
+        }
+    }
+    return null;
+}
+
+/// BOM-less UTF-16 text is mostly ASCII with a zero in every other byte.
+/// Checked before UTF-8, which would happily accept the zeros.
+fn detectUtf16(data: []const u8) ?[]const u8 {
+    if (data.len < 4 or data.len % 2 != 0) return null;
+    const sample = data[0..@min(data.len, max_scan) & ~@as(usize, 1)];
+
+    var even_zeros: usize = 0;
+    var odd_zeros: usize = 0;
+    var i: usize = 0;
+    while (i < sample.len) : (i += 2) {
+        if (sample[i] == 0) even_zeros += 1;
+        if (sample[i + 1] == 0) odd_zeros += 1;
+    }
+
+    const units = sample.len / 2;
+    if (odd_zeros * 10 > units * 3 and even_zeros * 10 < units) return "utf_16_le";
+    if (even_zeros * 10 > units * 3 and odd_zeros * 10 < units) return "utf_16_be";
+    return null;
+}
+
+/// The first max_scan bytes of valid UTF-8, cut on a character boundary
+fn utf8Sample(data: []const u8) []const u8 {
+    if (data.len <= max_scan) return data;
+    var cut: usize = max_scan;
+    while (cut > 0 and data[cut] & 0xc0 == 0x80) cut -= 1;
+    return data[0..cut];
+}
+
+// ============================================================================
+// Character classes
+// ============================================================================
+
+const Script = enum { none, latin, greek, cyrillic, hebrew, arabic, cjk };
+
+fn scriptOf(c: u21) Script {
+    return switch (c) {
+        'A'...'Z', 'a'...'z', 0xaa, 0xb5, 0xba => .latin,
+        0xc0...0x24f => if (c == 0xd7 or c == 0xf7) .none else .latin,
+        0x386...0x3ff => .greek,
+        0x400...0x4ff => .cyrillic,
+        0x5d0...0x5ea => .hebrew,
+        0x620...0x64a, 0x671...0x6d3 => .arabic,
+        0x3040...0x30ff, 0x3400...0x9fff, 0xac00...0xd7a3 => .cjk,
+        else => .none,
+    };
+}
+
+/// Case only matters for the alphabets the code pages cover
+fn isUpper(c: u21) bool {
+    return switch (c) {
+        'A'...'Z', 0x386...0x38f, 0x391...0x3a9, 0x400...0x42f => true,
+        0xc0...0xde => c != 0xd7,
+        // Latin Extended-A pairs are upper/lower, even/odd, except in two runs
+        0x139...0x148, 0x179...0x17e => c % 2 == 1,
+        0x100...0x138, 0x149...0x178, 0x17f => c % 2 == 0,
+        else => false,
+    };
+}
+
+fn isLower(c: u21) bool {
+    return switch (scriptOf(c)) {
+        .latin, .greek, .cyrillic => !isUpper(c),
+        else => false,
+    };
+}
+
+fn toLower(c: u21) u21 {
+    if (!isUpper(c)) return c;
+    return switch (c) {
+        0x100...0x17f => c + 1,
+        0x386 => 0x3ac,
+        0x388...0x38a => c + 37,
+        0x38c => 0x3cc,
+        0x38e, 0x38f => c + 63,
+        0x400...0x40f => c + 80,
+        else => c + 32,
+    };
+}
+
+fn isAccented(c: u21) bool {
+    return c >= 0xc0 and scriptOf(c) == .latin;
+}
+
+fn isUnprintable(c: u21) bool {
+    return switch (c) {
+        '\t', '\n', '\r', 0x0c => false,
+        0...0x1f, 0x7f...0x9f => true,
+        else => false,
+    };
+}
+
+/// Non-ASCII punctuation that real text uses freely
+fn isCommonSymbol(c: u21) bool {
+    return switch (c) {
+        0xa0, 0xa3, 0xa7, 0xa9, 0xab, 0xae, 0xb0, 0xb4, 0xb7, 0xbb => true,
+        0x2013, 0x2014, 0x2018, 0x2019, 0x201c, 0x201d, 0x201e, 0x2022, 0x2026 => true,
+        0x20ac, 0x2122 => true,
+        else => false,
+    };
+}
+
+// ============================================================================
+// Scoring
+// ============================================================================
+
+/// Letter histogram covers Latin through Arabic; CJK is scored elsewhere
+const histogram_size = 0x700;
+
+const Language = struct {
+    name: []const u8,
+    /// Most frequent letters, most frequent first
+    letters: []const u21,
+};
+
+fn codepoints(comptime s: []const u8) []const u21 {
+    comptime {
+        @setEvalBranchQuota(20000);
+        var out: [s.len]u21 = undefined;
+        var n: usize = 0;
+        var it = std.unicode.Utf8View.initComptime(s).iterator();
+        while (it.nextCodepoint()) |c| : (n += 1) out[n] = c;
+        const result = out[0..n].*;
+        return &result;
+    }
+}
+
+const languages = [_]Language{
+    .{ .name = "English", .letters = codepoints("eaotinshrdlcumwfgypbvkxjqz") },
+    .{ .name = "German", .letters = codepoints("enirstadhulgocmbfkwzpvüäöj") },
+    .{ .name = "French", .letters = codepoints("easnitrluodcpmévgfbhqàxèyj") },
+    .{ .name = "Spanish", .letters = codepoints("eaosrnildtcumpbgvyqóhfízjéáñ") },
+    .{ .name = "Portuguese", .letters = codepoints("aeosridmntcuplvgbfhãqéçáz") },
+    .{ .name = "Italian", .letters = codepoints("eaionltrscdupmvgfbzhqèàkyò") },
+    .{ .name = "Dutch", .letters = codepoints("enatirodslgvhkmubpwjczfy") },
+    .{ .name = "Swedish", .letters = codepoints("eanrtsildomkgvhfupäcböåyj") },
+    .{ .name = "Polish", .letters = codepoints("aioenrzwsctkydpmuljłgbhąęó") },
+    .{ .name = "Czech", .letters = codepoints("oeantvsilrkdumpíyhčzjáěbřé") },
+    .{ .name = "Hungarian", .letters = codepoints("eatlsnkriozáégmbydvhjfuöóőüúű") },
+    .{ .name = "Romanian", .letters = codepoints("eiarnutclsoămdpâîfvbgşţz") },
+    .{ .name = "Turkish", .letters = codepoints("aeinrlıdkmuytsboüşzgçhğvcö") },
+    .{ .name = "Lithuanian", .letters = codepoints("iasoretnuklpvmdjgėšybųžcčąįū") },
+    .{ .name = "Russian", .letters = codepoints("оеаинтсрвлкмдпуяыьгзбчйхжшюцщэфъё") },
+    .{ .name = "Ukrainian", .letters = codepoints("оаніивтерскломдпуяьзбгчхжйщцшюєїф") },
+    .{ .name = "Bulgarian", .letters = codepoints("аоеинтрсвлкдпмзгяъубчцйжшхфщю") },
+    .{ .name = "Greek", .letters = codepoints("αοιετνσρηκπυμλωδγχθφβξζψ") },
+    .{ .name = "Hebrew", .letters = codepoints("יוהלארתבמנשעםדכקףפסצגזחטךןץ") },
+    .{ .name = "Arabic", .letters = codepoints("اليمونرتهبعكدسقفحجشطصزخضثذغظئءةأإآ") },
+};
+
+/// Accumulates mess penalties and a letter histogram over decoded text
+const Scorer = struct {
+    chars: usize = 0,
+    penalty: usize = 0,
+    prev: u21 = ' ',
+    word_len: usize = 0,
+    word_accented: usize = 0,
+    letters: [histogram_size]u32 = [_]u32{0} ** histogram_size,
+
+    fn feed(self: *Scorer, c: u21) void {
+        defer self.prev = c;
+
+        if (c == ' ' or c == '\t' or c == '\n' or c == '\r') {
+            self.endWord();
+            return;
+        }
+        self.chars += 1;
+        if (isUnprintable(c)) self.penalty += 8;
+
+        const script = scriptOf(c);
+        const prev_script = scriptOf(self.prev);
+
+        if (script != .none) {
+            self.word_len += 1;
+            if (isAccented(c)) self.word_accented += 1;
+            if (c < histogram_size) self.letters[toLower(c)] += 1;
+
+            if (prev_script != .none) {
+                // Scripts only mix inside a word when the decoding is wrong
+                if (script != prev_script and script != .cjk and prev_script != .cjk) self.penalty += 2;
+                if (c >= 0x80 or self.prev >= 0x80) {
+                    // "dÃ", "ÃÂ": typical of UTF-8 read as a code page
+                    if (isUpper(c) and isLower(self.prev)) self.penalty += 1;
+                    if (isAccented(c) and isAccented(self.prev) and isUpper(c) and isUpper(self.prev)) self.penalty += 1;
+                }
+            } else if (self.prev >= 0x80 and !isCommonSymbol(self.prev) and self.word_len > 1) {
+                // Letter right after an odd symbol inside a word
+                self.penalty += 2;
+            }
+            return;
+        }
+
+        if (c >= 0x80 and !isCommonSymbol(c)) {
+            self.penalty += 1;
+            if (prev_script != .none) self.penalty += 1;
+        }
+        if (!(c >= '0' and c <= '9') and c != '\'' and c != '-') self.endWord();
+    }
+
+    /// Words that are mostly accented letters are a strong mess signal
+    fn endWord(self: *Scorer) void {
+        if (self.word_len >= 4 and self.word_accented * 4 >= self.word_len * 3) {
+            self.penalty += self.word_len;
+        }
+        self.word_len = 0;
+        self.word_accented = 0;
+    }
+
+    fn mess(self: *Scorer) f32 {
+        self.endWord();
+        if (self.chars == 0) return 0.0;
+        const ratio = @as(f32, @floatFromInt(self.penalty)) / @as(f32, @floatFromInt(self.chars));
+        return @min(1.0, ratio);
+    }
+
+    /// Best rank-proximity match between the text's most frequent letters
+    /// and a language's frequency list
+    fn coherence(self: *const Scorer) struct { score: f32, language: []const u8 } {
+        var best_score: f32 = 0.0;
+        var best_language: []const u8 = "";
+
+        for (languages) |language| {
+            const script = scriptOf(language.letters[0]);
+            const k = language.letters.len;
+
+            // Top-k letters of this script, by count
+            var top: [64]u21 = undefined;
+            var top_len: usize = 0;
+            for (self.letters, 0..) |count, cp| {
+                if (count == 0 or scriptOf(@intCast(cp)) != script) continue;
+                var pos = top_len;
+                while (pos > 0 and self.letters[top[pos - 1]] < count) pos -= 1;
+                if (pos >= k) continue;
+                if (top_len < k) top_len += 1;
+                var j = top_len - 1;
+                while (j > pos) : (j -= 1) top[j] = top[j - 1];
+                top[pos] = @intCast(cp);
+            }
+            if (top_len == 0) continue;
+
+            var total: f32 = 0.0;
+            for (top[0..top_len], 0..) |c, i| {
+                const j = std.mem.indexOfScalar(u21, language.letters, c) orelse continue;
+                const distance: f32 = @floatFromInt(@max(i, j) - @min(i, j));
+                total += 1.0 - distance / @as(f32, @floatFromInt(k));
+            }
+            const score = total / @as(f32, @floatFromInt(k));
+            if (score > best_score) {
+                best_score = score;
+                best_language = language.name;
+            }
+        }
+        return .{ .score = best_score, .language = best_language };
+    }
+};
+
+// ============================================================================
+// CJK multi-byte encodings
+// ============================================================================
+
+const CjkGuess = struct {
+    name: []const u8,
+    language: []const u8,
+    score: f32,
+};
+
+fn ratio(part: usize, whole: usize) f32 {
+    return @as(f32, @floatFromInt(part)) / @as(f32, @floatFromInt(whole));
+}
+
+/// Validate the sample against each CJK encoding's byte structure and score
+/// the ones that fit by how their lead bytes are distributed. A trailing
+/// partial character is tolerated.
+fn detectCjk(sample: []const u8) ?CjkGuess {
+    var best: ?CjkGuess = null;
+    const consider = struct {
+        fn f(current: *?CjkGuess, guess: CjkGuess) void {
+            if (current.* == null or guess.score > current.*.?.score) current.* = guess;
+        }
+    }.f;
+
+    // EUC-JP, EUC-KR and GB2312 share the A1-FE pair structure. Japanese is
+    // rich in kana (A4/A5 leads), Korean hangul sits in B0-C8 and Chinese
+    // spreads over B0-F7.
+    euc: {
+        var pairs: usize = 0;
+        var kana: usize = 0;
+        var hangul: usize = 0;
+        var hanzi: usize = 0;
+        var i: usize = 0;
+        while (i < sample.len) {
+            const c = sample[i];
+            if (c < 0x80) {
+                i += 1;
+                continue;
+            }
+            if (i + 1 >= sample.len) break;
+            const t = sample[i + 1];
+            if (c == 0x8e and t >= 0xa1 and t <= 0xdf) {
+                kana += 1;
+            } else if (c >= 0xa1 and c <= 0xfe and t >= 0xa1 and t <= 0xfe) {
+                if (c == 0xa4 or c == 0xa5) kana += 1;
+                if (c >= 0xb0 and c <= 0xc8) hangul += 1;
+                if (c >= 0xb0 and c <= 0xf7) hanzi += 1;
+            } else break :euc;
+            pairs += 1;
+            i += 2;
+        }
+        if (pairs == 0) break :euc;
+        consider(&best, .{ .name = "euc_jp", .language = "Japanese", .score = @min(1.0, 2.0 * ratio(kana, pairs)) });
+        consider(&best, .{ .name = "euc_kr", .language = "Korean", .score = ratio(hangul, pairs) });
+        consider(&best, .{ .name = "gb18030", .language = "Chinese", .score = 0.9 * ratio(hanzi, pairs) });
+    }
+
+    // Big5 allows 40-7E trail bytes; common hanzi have A4-C6 leads
+    big5: {
+        var pairs: usize = 0;
+        var common: usize = 0;
+        var i: usize = 0;
+        while (i < sample.len) {
+            const c = sample[i];
+            if (c < 0x80) {
+                i += 1;
+                continue;
+            }
+            if (i + 1 >= sample.len) break;
+            const t = sample[i + 1];
+            if (c < 0x81 or c > 0xfe) break :big5;
+            if (!((t >= 0x40 and t <= 0x7e) or (t >= 0xa1 and t <= 0xfe))) break :big5;
+            if (c >= 0xa4 and c <= 0xc6) common += 1;
+            pairs += 1;
+            i += 2;
+        }
+        if (pairs == 0) break :big5;
+        consider(&best, .{ .name = "big5", .language = "Chinese", .score = 0.85 * ratio(common, pairs) });
+    }
+
+    // Shift_JIS: kana pairs have 82/83 leads; A1-DF are single half-width
+    // katakana, which real text rarely uses
+    sjis: {
+        var pairs: usize = 0;
+        var kana: usize = 0;
+        var half: usize = 0;
+        var i: usize = 0;
+        while (i < sample.len) {
+            const c = sample[i];
+            if (c < 0x80) {
+                i += 1;
+                continue;
+            }
+            if (c >= 0xa1 and c <= 0xdf) {
+                half += 1;
+                i += 1;
+                continue;
+            }
+            if (!((c >= 0x81 and c <= 0x9f) or (c >= 0xe0 and c <= 0xef))) break :sjis;
+            if (i + 1 >= sample.len) break;
+            const t = sample[i + 1];
+            if (!((t >= 0x40 and t <= 0x7e) or (t >= 0x80 and t <= 0xfc))) break :sjis;
+            if (c == 0x82 or c == 0x83) kana += 1;
+            pairs += 1;
+            i += 2;
+        }
+        if (pairs + half == 0) break :sjis;
+        const kana_score = @min(1.0, 2.0 * ratio(kana, @max(pairs, 1)));
+        consider(&best, .{ .name = "shift_jis", .language = "Japanese", .score = kana_score * ratio(pairs, pairs + half) });
+    }
+
+    return best;
+}
+
+// Tests
+test "bom, ascii and utf-8" {
+    const bom = detect("\xef\xbb\xbfhello");
+    try std.testing.expectEqualStrings("utf_8", bom.encoding.?);
+    try std.testing.expect(bom.bom);
+
+    try std.testing.expectEqualStrings("ascii", detect("The quick brown fox jumps over the lazy dog.").encoding.?);
+    try std.testing.expectEqualStrings("utf_8", detect("Été, café, où est la bibliothèque?").encoding.?);
+    try std.testing.expectEqualStrings("utf_16_le", detect("h\x00e\x00l\x00l\x00o\x00").encoding.?);
+}
+
+test "single-byte code pages" {
+    // "Ça va très bien, merci beaucoup à vous. Été, café, où est la bibliothèque?" in cp1252
+    const french = "\xc7a va tr\xe8s bien, merci beaucoup \xe0 vous. \xc9t\xe9, caf\xe9, o\xf9 est la biblioth\xe8que?";
+    const fr = detect(french);
+    try std.testing.expectEqualStrings("cp1252", fr.encoding.?);
+    try std.testing.expectEqualStrings("French", fr.language);
+
+    // "Привет, как дела? Всё хорошо, спасибо большое." in cp1251 and koi8_r
+    const russian_cp1251 = "\xcf\xf0\xe8\xe2\xe5\xf2, \xea\xe0\xea \xe4\xe5\xeb\xe0? \xc2\xf1\xb8 \xf5\xee\xf0\xee\xf8\xee, \xf1\xef\xe0\xf1\xe8\xe1\xee \xe1\xee\xeb\xfc\xf8\xee\xe5.";
+    const russian_koi8 = "\xf0\xd2\xc9\xd7\xc5\xd4, \xcb\xc1\xcb \xc4\xc5\xcc\xc1? \xf7\xd3\xa3 \xc8\xcf\xd2\xcf\xdb\xcf, \xd3\xd0\xc1\xd3\xc9\xc2\xcf \xc2\xcf\xcc\xd8\xdb\xcf\xc5.";
+    try std.testing.expectEqualStrings("cp1251", detect(russian_cp1251).encoding.?);
+    try std.testing.expectEqualStrings("koi8_r", detect(russian_koi8).encoding.?);
+}
+
+test "cjk and binary" {
+    // "こんにちは、世界" in EUC-JP and Shift_JIS
+    try std.testing.expectEqualStrings("euc_jp", detect("\xa4\xb3\xa4\xf3\xa4\xcb\xa4\xc1\xa4\xcf\xa1\xa2\xc0\xa4\xb3\xa6").encoding.?);
+    try std.testing.expectEqualStrings("shift_jis", detect("\x82\xb1\x82\xf1\x82\xc9\x82\xbf\x82\xcd\x81\x41\x90\xa2\x8a\x45").encoding.?);
+
+    var binary: [512]u8 = undefined;
+    for (&binary, 0..) |*b, i| b.* = @truncate(i *% 151 +% 7);
+    try std.testing.expect(detect(&binary).encoding == null);
+}
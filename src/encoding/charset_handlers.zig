@@ -0,0 +1,72 @@
+const std = @import("std");
+const zware = @import("zware");
+const charset = @import("charset.zig");
+
+/// WASI errno values returned by charset host functions
+pub const CharsetError = enum(u32) {
+    success = 0,
+    inval = 28, // Out-of-bounds buffer
+    overflow = 61, // Name buffer too small
+};
+
+/// Layout of the result record written to result_ptr
+const ResultRecord = extern struct {
+    /// 0 when no encoding fits
+    encoding_len: u32,
+    language_len: u32,
+    /// Confidence in thousandths
+    confidence: u32,
+    bom: u32,
+};
+
+fn pushError(vm: *zware.VirtualMachine, err: CharsetError) zware.WasmError!void {
+    try vm.pushOperand(u32, @intFromEnum(err));
+}
+
+/// Slice of guest memory, or null if the range is out of bounds
+fn guestSlice(memory_slice: []u8, ptr: u32, len: u32) ?[]u8 {
+    if (@as(u64, ptr) + len > memory_slice.len) return null;
+    return memory_slice[ptr .. ptr + len];
+}
+
+/// charset_detect: Guess the encoding of a guest buffer.
+/// Writes the encoding name followed by the language name to names_ptr and
+/// a ResultRecord to result_ptr.
+pub fn charsetDetect(vm: *zware.VirtualMachine, _: usize) zware.WasmError!void {
+    const result_ptr = vm.popOperand(u32);
+    const names_cap = vm.popOperand(u32);
+    const names_ptr = vm.popOperand(u32);
+    const data_len = vm.popOperand(u32);
+    const data_ptr = vm.popOperand(u32);
+
+    const mem = try vm.inst.getMemory(0);
+    const data = guestSlice(mem.memory(), data_ptr, data_len) orelse return pushError(vm, .inval);
+    const names = guestSlice(mem.memory(), names_ptr, names_cap) orelse return pushError(vm, .inval);
+    if (@as(u64, result_ptr) + @sizeOf(ResultRecord) > mem.memory().len) return pushError(vm, .inval);
+
+    const result = charset.detect(data);
+    const encoding = result.encoding orelse "";
+    if (encoding.len + result.language.len > names.len) return pushError(vm, .overflow);
+
+    @memcpy(names[0..encoding.len], encoding);
+    @memcpy(names[encoding.len..][0..result.language.len], result.language);
+
+    try mem.write(u32, 0, result_ptr, @intCast(encoding.len));
+    try mem.write(u32, 0, result_ptr + 4, @intCast(result.language.len));
+    try mem.write(u32, 0, result_ptr + 8, @intFromFloat(@round(result.confidence * 1000.0)));
+    try mem.write(u32, 0, result_ptr + 12, @intFromBool(result.bom));
+    try pushError(vm, .success);
+}
+
+/// Register all charset WASI functions
+pub fn registerCharsetFunctions(store: *zware.Store) !void {
+    // charset_detect(data_ptr: i32, data_len: i32, names_ptr: i32, names_cap: i32, result_ptr: i32) -> i32
+    try store.exposeHostFunction(
+        "wasi_snapshot_preview1",
+        "charset_detect",
+        charsetDetect,
+        0,
+        &.{ .I32, .I32, .I32, .I32, .I32 },
+        &[_]zware.ValType{.I32},
+    );
+}
@@ -0,0 +1,563 @@
+// IDNA 2008 / UTS #46
+//
+// Host implementation of the idna package's encode() and decode(), used by
+// requests and urllib3 to prepare non-ASCII hostnames. It follows
+// idna/core.py step for step: UTS #46 remapping, label splitting, A-label
+// and U-label conversion (Punycode), and check_label's hyphen, combiner,
+// code point class, CONTEXTJ and CONTEXTO rules.
+//
+// A few checks depend on the guest's unicodedata, whose Unicode version may
+// be newer than the tables here: NFC, bidi classes and properties of
+// unassigned code points. Instead of guessing, such input is reported as
+// Undecided and the guest runs the original idna code; in practice that is
+// only right-to-left labels and text that is not already NFC.
+
+const std = @import("std");
+const tables = @import("idna_tables.zig");
+
+pub const IdnaError = error{
+    /// idna would raise IDNAError
+    Invalid,
+    /// Needs Unicode data the host cannot vouch for; use the guest's idna
+    Undecided,
+    OutOfMemory,
+};
+
+pub const Options = struct {
+    strict: bool = false,
+    uts46: bool = false,
+    std3_rules: bool = false,
+    transitional: bool = false,
+};
+
+const CodePoints = std.ArrayListUnmanaged(u21);
+
+const alabel_prefix = "xn--";
+const max_label_len = 63;
+
+// ============================================================================
+// Entry points
+// ============================================================================
+
+/// idna.encode(): UTF-8 domain (surrogates allowed) to ASCII bytes.
+/// Caller owns the result.
+pub fn encode(allocator: std.mem.Allocator, domain: []const u8, options: Options) IdnaError![]u8 {
+    var arena_state = std.heap.ArenaAllocator.init(allocator);
+    defer arena_state.deinit();
+    const arena = arena_state.allocator();
+
+    var text = try decodeUtf8(arena, domain);
+    if (options.uts46) text = try uts46Remap(arena, text, options.std3_rules, options.transitional);
+
+    var out: std.ArrayListUnmanaged(u8) = .empty;
+    errdefer out.deinit(allocator);
+
+    const labels = try splitLabels(arena, text, options.strict);
+    for (labels.items, 0..) |label, i| {
+        if (i > 0) try out.append(allocator, '.');
+        try alabel(arena, allocator, &out, label);
+    }
+    if (labels.trailing_dot) try out.append(allocator, '.');
+
+    // valid_string_length
+    if (out.items.len > @as(usize, if (labels.trailing_dot) 254 else 253)) return error.Invalid;
+    return out.toOwnedSlice(allocator) catch error.OutOfMemory;
+}
+
+/// idna.decode(): domain (ASCII or UTF-8) to a UTF-8 string. Caller owns
+/// the result.
+pub fn decode(allocator: std.mem.Allocator, domain: []const u8, options: Options) IdnaError![]u8 {
+    var arena_state = std.heap.ArenaAllocator.init(allocator);
+    defer arena_state.deinit();
+    const arena = arena_state.allocator();
+
+    var text = try decodeUtf8(arena, domain);
+    if (options.uts46) text = try uts46Remap(arena, text, options.std3_rules, false);
+
+    var out: std.ArrayListUnmanaged(u8) = .empty;
+    errdefer out.deinit(allocator);
+
+    const labels = try splitLabels(arena, text, options.strict);
+    for (labels.items, 0..) |label, i| {
+        if (i > 0) try out.append(allocator, '.');
+        const ulabel_text = try ulabel(arena, label);
+        for (ulabel_text) |cp| try appendUtf8(allocator, &out, cp);
+    }
+    if (labels.trailing_dot) try out.append(allocator, '.');
+    return out.toOwnedSlice(allocator) catch error.OutOfMemory;
+}
+
+// ============================================================================
+// Labels
+// ============================================================================
+
+const Labels = struct {
+    items: []const []const u21,
+    trailing_dot: bool,
+};
+
+fn isDot(cp: u21, strict: bool) bool {
+    if (strict) return cp == '.';
+    return cp == '.' or cp == 0x3002 or cp == 0xff0e or cp == 0xff61;
+}
+
+fn splitLabels(arena: std.mem.Allocator, text: []const u21, strict: bool) IdnaError!Labels {
+    var items: std.ArrayListUnmanaged([]const u21) = .empty;
+    var start: usize = 0;
+    for (text, 0..) |cp, i| {
+        if (isDot(cp, strict)) {
+            try items.append(arena, text[start..i]);
+            start = i + 1;
+        }
+    }
+    try items.append(arena, text[start..]);
+
+    // "Empty domain"
+    if (items.items.len == 1 and items.items[0].len == 0) return error.Invalid;
+
+    var trailing_dot = false;
+    if (items.items[items.items.len - 1].len == 0) {
+        _ = items.pop();
+        trailing_dot = true;
+    }
+    return .{ .items = items.items, .trailing_dot = trailing_dot };
+}
+
+fn isAscii(label: []const u21) bool {
+    for (label) |cp| {
+        if (cp >= 0x80) return false;
+    }
+    return true;
+}
+
+/// core.alabel, appending the A-label to out
+fn alabel(arena: std.mem.Allocator, allocator: std.mem.Allocator, out: *std.ArrayListUnmanaged(u8), label: []const u21) IdnaError!void {
+    const start = out.items.len;
+    if (isAscii(label)) {
+        // Validated as a U-label, but returned with its original case
+        _ = try ulabel(arena, label);
+        for (label) |cp| try out.append(allocator, @intCast(cp));
+    } else {
+        try checkLabel(label);
+        try out.appendSlice(allocator, alabel_prefix);
+        try punycodeEncode(allocator, out, label);
+    }
+
+    // "Empty label" for an empty result, "Label too long" past 63 bytes
+    const len = out.items.len - start;
+    if (len == 0 or len > max_label_len) return error.Invalid;
+}
+
+/// core.ulabel
+fn ulabel(arena: std.mem.Allocator, label: []const u21) IdnaError![]const u21 {
+    if (!isAscii(label)) {
+        try checkLabel(label);
+        return label;
+    }
+
+    const lower = try arena.alloc(u21, label.len);
+    for (label, lower) |cp, *l| l.* = std.ascii.toLower(@intCast(cp));
+
+    if (lower.len < alabel_prefix.len or !startsWithPrefix(lower)) {
+        try checkLabel(lower);
+        return lower;
+    }
+
+    const encoded = lower[alabel_prefix.len..];
+    // "Malformed A-label" / "A-label must not end with a hyphen"
+    if (encoded.len == 0 or encoded[encoded.len - 1] == '-') return error.Invalid;
+
+    const decoded = try punycodeDecode(arena, encoded);
+    try checkLabel(decoded);
+    return decoded;
+}
+
+fn startsWithPrefix(label: []const u21) bool {
+    for (alabel_prefix, 0..) |c, i| {
+        if (label[i] != c) return false;
+    }
+    return true;
+}
+
+// ============================================================================
+// check_label
+// ============================================================================
+
+fn checkLabel(label: []const u21) IdnaError!void {
+    if (label.len == 0) return error.Invalid;
+
+    // check_nfc and check_bidi, as far as the tables can answer them
+    var prev_combining = false;
+    for (label) |cp| {
+        const props = properties(cp);
+        if (props & tables.prop_assigned == 0) return error.Undecided;
+        if (props & (tables.prop_nfc_unstable | tables.prop_rtl) != 0) return error.Undecided;
+        const combining = props & tables.prop_combining != 0;
+        // Two marks in a row may need canonical reordering
+        if (combining and prev_combining) return error.Undecided;
+        prev_combining = combining;
+    }
+
+    // check_hyphen_ok
+    if (label.len >= 4 and label[2] == '-' and label[3] == '-') return error.Invalid;
+    if (label[0] == '-' or label[label.len - 1] == '-') return error.Invalid;
+
+    // check_initial_combiner
+    if (properties(label[0]) & tables.prop_mark != 0) return error.Invalid;
+
+    for (label, 0..) |cp, pos| {
+        if (inRanges(&tables.pvalid, cp)) continue;
+        if (inRanges(&tables.contextj, cp)) {
+            if (!validContextJ(label, pos)) return error.Invalid;
+        } else if (inRanges(&tables.contexto, cp)) {
+            if (!validContextO(label, pos)) return error.Invalid;
+        } else {
+            return error.Invalid;
+        }
+    }
+}
+
+fn joiningType(cp: u21) ?u8 {
+    const index = upperBound(tables.JoiningRange, &tables.joining_types, cp, struct {
+        fn start(r: tables.JoiningRange) u21 {
+            return r[0];
+        }
+    }.start) orelse return null;
+    const range = tables.joining_types[index];
+    return if (cp < range[1]) range[2] else null;
+}
+
+/// ZERO WIDTH NON-JOINER / JOINER rules (RFC 5892 appendix A.1, A.2)
+fn validContextJ(label: []const u21, pos: usize) bool {
+    const cp = label[pos];
+    if (pos > 0 and properties(label[pos - 1]) & tables.prop_virama != 0) return true;
+    if (cp != 0x200c) return false;
+
+    // ZWNJ between a left-joining and a right-joining character, skipping
+    // transparent ones
+    var ok = false;
+    var i = pos;
+    while (i > 0) {
+        i -= 1;
+        const t = joiningType(label[i]) orelse break;
+        if (t == 'T') continue;
+        ok = t == 'L' or t == 'D';
+        break;
+    }
+    if (!ok) return false;
+
+    for (label[pos + 1 ..]) |next| {
+        const t = joiningType(next) orelse return false;
+        if (t == 'T') continue;
+        return t == 'R' or t == 'D';
+    }
+    return false;
+}
+
+/// CONTEXTO rules (RFC 5892 appendix A.3 - A.9)
+fn validContextO(label: []const u21, pos: usize) bool {
+    const cp = label[pos];
+    switch (cp) {
+        // MIDDLE DOT between two 'l'
+        0x00b7 => return pos > 0 and pos + 1 < label.len and label[pos - 1] == 'l' and label[pos + 1] == 'l',
+        // GREEK LOWER NUMERAL SIGN before Greek
+        0x0375 => return pos + 1 < label.len and inRanges(&tables.greek, label[pos + 1]),
+        // HEBREW GERESH / GERSHAYIM after Hebrew
+        0x05f3, 0x05f4 => return pos > 0 and inRanges(&tables.hebrew, label[pos - 1]),
+        // KATAKANA MIDDLE DOT with some Japanese script in the label
+        0x30fb => {
+            for (label) |other| {
+                if (other == 0x30fb) continue;
+                if (inRanges(&tables.hiragana, other) or inRanges(&tables.katakana, other) or inRanges(&tables.han, other)) return true;
+            }
+            return false;
+        },
+        // Arabic-Indic digits must not mix with extended ones, and vice versa
+        0x0660...0x0669 => {
+            for (label) |other| {
+                if (other >= 0x06f0 and other <= 0x06f9) return false;
+            }
+            return true;
+        },
+        0x06f0...0x06f9 => {
+            for (label) |other| {
+                if (other >= 0x0660 and other <= 0x0669) return false;
+            }
+            return true;
+        },
+        else => return false,
+    }
+}
+
+// ============================================================================
+// UTS #46 remapping
+// ============================================================================
+
+fn uts46Remap(arena: std.mem.Allocator, text: []const u21, std3_rules: bool, transitional: bool) IdnaError![]const u21 {
+    var out: CodePoints = .empty;
+    for (text) |cp| {
+        const index = upperBound(u32, &tables.uts46_rows, cp, struct {
+            fn start(row: u32) u21 {
+                return @intCast(row >> 8);
+            }
+        }.start).?;
+        const status: u8 = @truncate(tables.uts46_rows[index]);
+        const mapping = tables.uts46_mappings[index];
+        const has_mapping = mapping != tables.no_mapping;
+
+        if (status == 'V' or
+            (status == 'D' and !transitional) or
+            (status == '3' and !std3_rules and !has_mapping))
+        {
+            try out.append(arena, cp);
+        } else if (has_mapping and (status == 'M' or
+            (status == '3' and !std3_rules) or
+            (status == 'D' and transitional)))
+        {
+            const start = tables.mapping_offsets[mapping];
+            const end = tables.mapping_offsets[mapping + 1];
+            var it = std.unicode.Utf8View.initUnchecked(tables.mapping_data[start..end]).iterator();
+            while (it.nextCodepoint()) |mapped| try out.append(arena, mapped);
+        } else if (status != 'I') {
+            return error.Invalid;
+        }
+    }
+
+    // The remapped text goes through NFC; leave anything NFC could change
+    // to the guest
+    var prev_combining = false;
+    for (out.items) |cp| {
+        const props = properties(cp);
+        if (props & tables.prop_assigned == 0 or props & tables.prop_nfc_unstable != 0) return error.Undecided;
+        const combining = props & tables.prop_combining != 0;
+        if (combining and prev_combining) return error.Undecided;
+        prev_combining = combining;
+    }
+    return out.items;
+}
+
+// ============================================================================
+// Punycode (RFC 3492, as Python's punycode codec implements it)
+// ============================================================================
+
+const base = 36;
+const tmin = 1;
+const tmax = 26;
+const skew = 38;
+const damp = 700;
+const initial_bias = 72;
+const initial_n = 0x80;
+
+fn threshold(j: u64, bias: u64) u64 {
+    const t = @as(i64, @intCast(base * (j + 1))) - @as(i64, @intCast(bias));
+    return @intCast(std.math.clamp(t, tmin, tmax));
+}
+
+fn adapt(delta_in: u64, first: bool, numchars: u64) u64 {
+    var delta = if (first) delta_in / damp else delta_in / 2;
+    delta += delta / numchars;
+    var divisions: u64 = 0;
+    while (delta > ((base - tmin) * tmax) / 2) {
+        delta /= base - tmin;
+        divisions += base;
+    }
+    return divisions + (base * delta) / (delta + skew);
+}
+
+fn punycodeDigit(d: u64) u8 {
+    return "abcdefghijklmnopqrstuvwxyz0123456789"[@intCast(d)];
+}
+
+fn punycodeEncode(allocator: std.mem.Allocator, out: *std.ArrayListUnmanaged(u8), label: []const u21) IdnaError!void {
+    var basic_count: u64 = 0;
+    for (label) |cp| {
+        if (cp < 0x80) {
+            try out.append(allocator, @intCast(cp));
+            basic_count += 1;
+        }
+    }
+    if (basic_count > 0) try out.append(allocator, '-');
+
+    var n: u64 = initial_n;
+    var delta: u64 = 0;
+    var bias: u64 = initial_bias;
+    var handled = basic_count;
+    var first = true;
+
+    while (handled < label.len) {
+        // Smallest code point not handled yet
+        var m: u64 = std.math.maxInt(u64);
+        for (label) |cp| {
+            if (cp >= n and cp < m) m = cp;
+        }
+
+        delta += (m - n) * (handled + 1);
+        n = m;
+        for (label) |cp| {
+            if (cp < n) delta += 1;
+            if (cp != n) continue;
+
+            // Emit delta as a generalized variable-length integer
+            var q = delta;
+            var j: u64 = 0;
+            while (true) : (j += 1) {
+                const t = threshold(j, bias);
+                if (q < t) break;
+                try out.append(allocator, punycodeDigit(t + (q - t) % (base - t)));
+                q = (q - t) / (base - t);
+            }
+            try out.append(allocator, punycodeDigit(q));
+
+            handled += 1;
+            bias = adapt(delta, first, handled);
+            first = false;
+            delta = 0;
+        }
+        delta += 1;
+        n += 1;
+    }
+}
+
+/// Decode the part after "xn--"; digits are case-insensitive
+fn punycodeDecode(arena: std.mem.Allocator, encoded: []const u21) IdnaError![]const u21 {
+    var out: CodePoints = .empty;
+
+    // Everything before the last '-' is copied literally
+    var extended = encoded;
+    if (std.mem.lastIndexOfScalar(u21, encoded, '-')) |dash| {
+        try out.appendSlice(arena, encoded[0..dash]);
+        extended = encoded[dash + 1 ..];
+    }
+
+    var n: u64 = initial_n;
+    var pos: u64 = 0; // Python's pos + 1
+    var bias: u64 = initial_bias;
+    var first = true;
+    var i: usize = 0;
+    while (i < extended.len) {
+        var delta: u64 = 0;
+        var w: u64 = 1;
+        var j: u64 = 0;
+        while (true) : (j += 1) {
+            // "incomplete punicode string"
+            if (i >= extended.len) return error.Invalid;
+            const c = extended[i];
+            i += 1;
+            const digit: u64 = switch (c) {
+                'A'...'Z' => c - 'A',
+                'a'...'z' => c - 'a',
+                '0'...'9' => c - '0' + 26,
+                else => return error.Invalid,
+            };
+            const t = threshold(j, bias);
+            // Overflow means a code point far beyond U+10FFFF anyway
+            delta = std.math.add(u64, delta, std.math.mul(u64, digit, w) catch return error.Invalid) catch return error.Invalid;
+            if (digit < t) break;
+            w = std.math.mul(u64, w, base - t) catch return error.Invalid;
+        }
+
+        pos = std.math.add(u64, pos, delta) catch return error.Invalid;
+        const len: u64 = out.items.len + 1;
+        n = std.math.add(u64, n, pos / len) catch return error.Invalid;
+        if (n > 0x10ffff) return error.Invalid;
+        pos %= len;
+        try out.insert(arena, @intCast(pos), @intCast(n));
+        bias = adapt(delta, first, out.items.len);
+        first = false;
+        pos += 1;
+    }
+    return out.items;
+}
+
+// ============================================================================
+// Helpers
+// ============================================================================
+
+/// Index of the last entry whose start is <= cp
+fn upperBound(comptime T: type, items: []const T, cp: u21, comptime startOf: fn (T) u21) ?usize {
+    var lo: usize = 0;
+    var hi: usize = items.len;
+    while (lo < hi) {
+        const mid = lo + (hi - lo) / 2;
+        if (startOf(items[mid]) <= cp) lo = mid + 1 else hi = mid;
+    }
+    return if (lo == 0) null else lo - 1;
+}
+
+fn inRanges(ranges: []const tables.Range, cp: u21) bool {
+    const index = upperBound(tables.Range, ranges, cp, struct {
+        fn start(r: tables.Range) u21 {
+            return r[0];
+        }
+    }.start) orelse return false;
+    return cp < ranges[index][1];
+}
+
+fn properties(cp: u21) u8 {
+    const index = upperBound(u32, &tables.properties, cp, struct {
+        fn start(entry: u32) u21 {
+            return @intCast(entry >> 8);
+        }
+    }.start).?;
+    return @truncate(tables.properties[index]);
+}
+
+/// UTF-8 with surrogates allowed (the guest encodes with surrogatepass)
+fn decodeUtf8(arena: std.mem.Allocator, bytes: []const u8) IdnaError![]const u21 {
+    var out: CodePoints = .empty;
+    const view = std.unicode.Wtf8View.init(bytes) catch return error.Invalid;
+    var iter = view.iterator();
+    while (iter.nextCodepoint()) |cp| try out.append(arena, cp);
+    return out.items;
+}
+
+fn appendUtf8(allocator: std.mem.Allocator, out: *std.ArrayListUnmanaged(u8), cp: u21) IdnaError!void {
+    var buf: [4]u8 = undefined;
+    const n = std.unicode.wtf8Encode(cp, &buf) catch unreachable;
+    try out.appendSlice(allocator, buf[0..n]);
+}
+
+// Tests
+fn expectEncode(expected: []const u8, domain: []const u8, options: Options) !void {
+    const result = try encode(std.testing.allocator, domain, options);
+    defer std.testing.allocator.free(result);
+    try std.testing.expectEqualStrings(expected, result);
+}
+
+fn expectDecode(expected: []const u8, domain: []const u8, options: Options) !void {
+    const result = try decode(std.testing.allocator, domain, options);
+    defer std.testing.allocator.free(result);
+    try std.testing.expectEqualStrings(expected, result);
+}
+
+test "encode matches the idna package" {
+    try expectEncode("xn--bcher-kva.com", "bücher.com", .{});
+    try expectEncode("xn--bcher-kva.com", "Bücher.com", .{ .uts46 = true });
+    try expectEncode("Example.com", "Example.com", .{});
+    try expectEncode("XN--bcher-kva.com", "XN--bcher-kva.com", .{});
+    try expectEncode("a.com.", "a.com.", .{});
+    try expectEncode("xn--fa-hia.de", "faß.de", .{ .uts46 = true });
+    try expectEncode("fass.de", "faß.de", .{ .uts46 = true, .transitional = true });
+    try expectEncode("xn--wgv71a119e.jp", "日本語。ＪＰ", .{ .uts46 = true });
+    try expectEncode("xn--e1afmkfd.com", "пример.com", .{});
+}
+
+test "encode rejects what the idna package rejects" {
+    const allocator = std.testing.allocator;
+    try std.testing.expectError(error.Invalid, encode(allocator, "", .{}));
+    try std.testing.expectError(error.Invalid, encode(allocator, "a..b", .{}));
+    try std.testing.expectError(error.Invalid, encode(allocator, "-a.com", .{}));
+    try std.testing.expectError(error.Invalid, encode(allocator, "ab--c.com", .{}));
+    try std.testing.expectError(error.Invalid, encode(allocator, "Bücher.com", .{}));
+    try std.testing.expectError(error.Invalid, encode(allocator, "xn--.com", .{}));
+    try std.testing.expectError(error.Invalid, encode(allocator, "a" ** 64 ++ ".com", .{}));
+    // Right-to-left labels are left to the guest
+    try std.testing.expectError(error.Undecided, encode(allocator, "مثال.com", .{}));
+}
+
+test "decode" {
+    try expectDecode("bücher.com", "xn--bcher-kva.com", .{});
+    try expectDecode("bücher.com", "XN--bcher-kva.COM", .{});
+    try expectDecode("日本語.jp", "xn--wgv71a119e.jp", .{});
+    try expectDecode("bücher.com", "Bücher.com", .{ .uts46 = true });
+}
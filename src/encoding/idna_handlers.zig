@@ -0,0 +1,194 @@
+const std = @import("std");
+const zware = @import("zware");
+const idna = @import("idna.zig");
+
+/// WASI errno values returned by idna host functions
+pub const IdnaStatus = enum(u32) {
+    success = 0,
+    ilseq = 25, // Rejected or undecided; the guest runs the idna package
+    inval = 28, // Out-of-bounds buffer
+    nomem = 48,
+    overflow = 61, // Output buffer too small; the needed size was written
+};
+
+/// Option flags, mirroring idna.encode/idna.decode arguments
+const flag_strict = 1 << 0;
+const flag_uts46 = 1 << 1;
+const flag_std3_rules = 1 << 2;
+const flag_transitional = 1 << 3;
+
+const Op = enum(u8) { encode, decode };
+
+/// Entries kept before the cache is emptied and starts over
+const max_cache_entries = 4096;
+
+/// Results for hostnames seen before. A client talks to a handful of hosts,
+/// so nearly every lookup after the first request to a host is a hit.
+/// Keys are the operation, the flags and the input; a null value records
+/// input that fell back to the guest, so it is not retried on the host.
+pub const HostnameCache = struct {
+    entries: std.StringHashMap(?[]u8),
+    allocator: std.mem.Allocator,
+    mutex: std.Thread.Mutex,
+
+    pub fn init(allocator: std.mem.Allocator) HostnameCache {
+        return HostnameCache{
+            .entries = std.StringHashMap(?[]u8).init(allocator),
+            .allocator = allocator,
+            .mutex = std.Thread.Mutex{},
+        };
+    }
+
+    pub fn deinit(self: *HostnameCache) void {
+        self.clear();
+        self.entries.deinit();
+    }
+
+    fn clear(self: *HostnameCache) void {
+        var iter = self.entries.iterator();
+        while (iter.next()) |entry| {
+            self.allocator.free(entry.key_ptr.*);
+            if (entry.value_ptr.*) |result| self.allocator.free(result);
+        }
+        self.entries.clearRetainingCapacity();
+    }
+
+    /// Look up or compute the result for key; null if the host declines.
+    /// Call with the mutex held.
+    fn resolve(self: *HostnameCache, key: []const u8, op: Op, input: []const u8, options: idna.Options) error{OutOfMemory}!?[]const u8 {
+        if (self.entries.get(key)) |cached| return cached;
+
+        const attempt = switch (op) {
+            .encode => idna.encode(self.allocator, input, options),
+            .decode => idna.decode(self.allocator, input, options),
+        };
+        const result: ?[]u8 = attempt catch |err| switch (err) {
+            error.OutOfMemory => return error.OutOfMemory,
+            error.Invalid, error.Undecided => null,
+        };
+        errdefer if (result) |bytes| self.allocator.free(bytes);
+
+        if (self.entries.count() >= max_cache_entries) self.clear();
+        const owned_key = try self.allocator.dupe(u8, key);
+        errdefer self.allocator.free(owned_key);
+        try self.entries.put(owned_key, result);
+        return result;
+    }
+};
+
+/// Global hostname cache
+var global_cache: ?*HostnameCache = null;
+
+/// Initialize the idna system
+pub fn init(allocator: std.mem.Allocator) !void {
+    if (global_cache == null) {
+        const cache = try allocator.create(HostnameCache);
+        cache.* = HostnameCache.init(allocator);
+        global_cache = cache;
+    }
+}
+
+/// Deinitialize the idna system
+pub fn deinit(allocator: std.mem.Allocator) void {
+    if (global_cache) |cache| {
+        cache.deinit();
+        allocator.destroy(cache);
+        global_cache = null;
+    }
+}
+
+fn pushStatus(vm: *zware.VirtualMachine, status: IdnaStatus) zware.WasmError!void {
+    try vm.pushOperand(u32, @intFromEnum(status));
+}
+
+/// Slice of guest memory, or null if the range is out of bounds
+fn guestSlice(memory_slice: []u8, ptr: u32, len: u32) ?[]u8 {
+    if (@as(u64, ptr) + len > memory_slice.len) return null;
+    return memory_slice[ptr .. ptr + len];
+}
+
+/// Shared body of idna_encode and idna_decode
+fn convert(vm: *zware.VirtualMachine, op: Op) zware.WasmError!void {
+    const out_len_ptr = vm.popOperand(u32);
+    const out_cap = vm.popOperand(u32);
+    const out_ptr = vm.popOperand(u32);
+    const flags = vm.popOperand(u32);
+    const in_len = vm.popOperand(u32);
+    const in_ptr = vm.popOperand(u32);
+
+    const cache = global_cache orelse return pushStatus(vm, .inval);
+    const mem = try vm.inst.getMemory(0);
+    const memory = mem.memory();
+    const input = guestSlice(memory, in_ptr, in_len) orelse return pushStatus(vm, .inval);
+    const out = guestSlice(memory, out_ptr, out_cap) orelse return pushStatus(vm, .inval);
+    if (guestSlice(memory, out_len_ptr, 4) == null) return pushStatus(vm, .inval);
+
+    const options = idna.Options{
+        .strict = flags & flag_strict != 0,
+        .uts46 = flags & flag_uts46 != 0,
+        .std3_rules = flags & flag_std3_rules != 0,
+        .transitional = flags & flag_transitional != 0,
+    };
+
+    var key_buf: [256]u8 = undefined;
+    var key: std.ArrayListUnmanaged(u8) = .initBuffer(&key_buf);
+    const key_len = 2 + input.len;
+    var heap_key: ?[]u8 = null;
+    defer if (heap_key) |bytes| cache.allocator.free(bytes);
+    if (key_len > key_buf.len) {
+        heap_key = cache.allocator.alloc(u8, key_len) catch return pushStatus(vm, .nomem);
+        key = .initBuffer(heap_key.?);
+    }
+    key.appendAssumeCapacity(@intFromEnum(op));
+    key.appendAssumeCapacity(@truncate(flags));
+    key.appendSliceAssumeCapacity(input);
+
+    cache.mutex.lock();
+    defer cache.mutex.unlock();
+
+    const result = (cache.resolve(key.items, op, input, options) catch return pushStatus(vm, .nomem)) orelse
+        return pushStatus(vm, .ilseq);
+
+    try mem.write(u32, 0, out_len_ptr, @intCast(result.len));
+    if (result.len > out.len) return pushStatus(vm, .overflow);
+    @memcpy(out[0..result.len], result);
+    try pushStatus(vm, .success);
+}
+
+/// idna_encode: idna.encode() of a UTF-8 domain into out. Writes the result
+/// length to out_len_ptr; if out is too small nothing is copied and the
+/// status is overflow.
+pub fn idnaEncode(vm: *zware.VirtualMachine, _: usize) zware.WasmError!void {
+    try convert(vm, .encode);
+}
+
+/// idna_decode: idna.decode() of a domain into UTF-8 text, with the same
+/// output convention as idna_encode
+pub fn idnaDecode(vm: *zware.VirtualMachine, _: usize) zware.WasmError!void {
+    try convert(vm, .decode);
+}
+
+/// Register all idna WASI functions
+pub fn registerIdnaFunctions(store: *zware.Store) !void {
+    const i32_result = &[_]zware.ValType{.I32};
+
+    // idna_encode(in_ptr: i32, in_len: i32, flags: i32, out_ptr: i32, out_cap: i32, out_len_ptr: i32) -> i32
+    try store.exposeHostFunction(
+        "wasi_snapshot_preview1",
+        "idna_encode",
+        idnaEncode,
+        0,
+        &.{ .I32, .I32, .I32, .I32, .I32, .I32 },
+        i32_result,
+    );
+
+    // idna_decode(in_ptr: i32, in_len: i32, flags: i32, out_ptr: i32, out_cap: i32, out_len_ptr: i32) -> i32
+    try store.exposeHostFunction(
+        "wasi_snapshot_preview1",
+        "idna_decode",
+        idnaDecode,
+        0,
+        &.{ .I32, .I32, .I32, .I32, .I32, .I32 },
+        i32_result,
+    );
+}
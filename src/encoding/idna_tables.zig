@@ -0,0 +1,2832 @@
+// IDNA data tables
+//
+// Generated from the idna package's uts46data/idnadata (Unicode 15.1.0), the
+// data the guest's idna package uses, and from unicodedata (Unicode 14.0.0)
+// for the character properties idna.core looks up at run time. Do not edit.
+
+/// One entry per UTS #46 range start, packed as start << 8 | status; an
+/// entry covers code points up to the next entry's start. status is the
+/// idna package's code: 'V' valid, 'M' mapped, 'D' deviation, 'I' ignored,
+/// 'X' disallowed, '3' disallowed under STD3 rules.
+pub const uts46_rows = [_]u32{
+    0x33, 0x133, 0x233, 0x333, 0x433, 0x533, 0x633, 0x733, 0x833, 0x933,
+    0xa33, 0xb33, 0xc33, 0xd33, 0xe33, 0xf33, 0x1033, 0x1133, 0x1233, 0x1333,
+    0x1433, 0x1533, 0x1633, 0x1733, 0x1833, 0x1933, 0x1a33, 0x1b33, 0x1c33, 0x1d33,
+    0x1e33, 0x1f33, 0x2033, 0x2133, 0x2233, 0x2333, 0x2433, 0x2533, 0x2633, 0x2733,
+    0x2833, 0x2933, 0x2a33, 0x2b33, 0x2c33, 0x2d56, 0x2e56, 0x2f33, 0x3056, 0x3156,
+    0x3256, 0x3356, 0x3456, 0x3556, 0x3656, 0x3756, 0x3856, 0x3956, 0x3a33, 0x3b33,
+    0x3c33, 0x3d33, 0x3e33, 0x3f33, 0x4033, 0x414d, 0x424d, 0x434d, 0x444d, 0x454d,
+    0x464d, 0x474d, 0x484d, 0x494d, 0x4a4d, 0x4b4d, 0x4c4d, 0x4d4d, 0x4e4d, 0x4f4d,
+    0x504d, 0x514d, 0x524d, 0x534d, 0x544d, 0x554d, 0x564d, 0x574d, 0x584d, 0x594d,
+    0x5a4d, 0x5b33, 0x5c33, 0x5d33, 0x5e33, 0x5f33, 0x6033, 0x6156, 0x6256, 0x6356,
+    0x6456, 0x6556, 0x6656, 0x6756, 0x6856, 0x6956, 0x6a56, 0x6b56, 0x6c56, 0x6d56,
+    0x6e56, 0x6f56, 0x7056, 0x7156, 0x7256, 0x7356, 0x7456, 0x7556, 0x7656, 0x7756,
+    0x7856, 0x7956, 0x7a56, 0x7b33, 0x7c33, 0x7d33, 0x7e33, 0x7f33, 0x8058, 0x8158,
+    0x8258, 0x8358, 0x8458, 0x8558, 0x8658, 0x8758, 0x8858, 0x8958, 0x8a58, 0x8b58,
+    0x8c58, 0x8d58, 0x8e58, 0x8f58, 0x9058, 0x9158, 0x9258, 0x9358, 0x9458, 0x9558,
+    0x9658, 0x9758, 0x9858, 0x9958, 0x9a58, 0x9b58, 0x9c58, 0x9d58, 0x9e58, 0x9f58,
+    0xa033, 0xa156, 0xa256, 0xa356, 0xa456, 0xa556, 0xa656, 0xa756, 0xa833, 0xa956,
+    0xaa4d, 0xab56, 0xac56, 0xad49, 0xae56, 0xaf33, 0xb056, 0xb156, 0xb24d, 0xb34d,
+    0xb433, 0xb54d, 0xb656, 0xb756, 0xb833, 0xb94d, 0xba4d, 0xbb56, 0xbc4d, 0xbd4d,
+    0xbe4d, 0xbf56, 0xc04d, 0xc14d, 0xc24d, 0xc34d, 0xc44d, 0xc54d, 0xc64d, 0xc74d,
+    0xc84d, 0xc94d, 0xca4d, 0xcb4d, 0xcc4d, 0xcd4d, 0xce4d, 0xcf4d, 0xd04d, 0xd14d,
+    0xd24d, 0xd34d, 0xd44d, 0xd54d, 0xd64d, 0xd756, 0xd84d, 0xd94d, 0xda4d, 0xdb4d,
+    0xdc4d, 0xdd4d, 0xde4d, 0xdf44, 0xe056, 0xe156, 0xe256, 0xe356, 0xe456, 0xe556,
+    0xe656, 0xe756, 0xe856, 0xe956, 0xea56, 0xeb56, 0xec56, 0xed56, 0xee56, 0xef56,
+    0xf056, 0xf156, 0xf256, 0xf356, 0xf456, 0xf556, 0xf656, 0xf756, 0xf856, 0xf956,
+    0xfa56, 0xfb56, 0xfc56, 0xfd56, 0xfe56, 0xff56, 0x1004d, 0x10156, 0x1024d, 0x10356,
+    0x1044d, 0x10556, 0x1064d, 0x10756, 0x1084d, 0x10956, 0x10a4d, 0x10b56, 0x10c4d, 0x10d56,
+    0x10e4d, 0x10f56, 0x1104d, 0x11156, 0x1124d, 0x11356, 0x1144d, 0x11556, 0x1164d, 0x11756,
+    0x1184d, 0x11956, 0x11a4d, 0x11b56, 0x11c4d, 0x11d56, 0x11e4d, 0x11f56, 0x1204d, 0x12156,
+    0x1224d, 0x12356, 0x1244d, 0x12556, 0x1264d, 0x12756, 0x1284d, 0x12956, 0x12a4d, 0x12b56,
+    0x12c4d, 0x12d56, 0x12e4d, 0x12f56, 0x1304d, 0x13156, 0x1324d, 0x1344d, 0x13556, 0x1364d,
+    0x13756, 0x1394d, 0x13a56, 0x13b4d, 0x13c56, 0x13d4d, 0x13e56, 0x13f4d, 0x1414d, 0x14256,
+    0x1434d, 0x14456, 0x1454d, 0x14656, 0x1474d, 0x14856, 0x1494d, 0x14a4d, 0x14b56, 0x14c4d,
+    0x14d56, 0x14e4d, 0x14f56, 0x1504d, 0x15156, 0x1524d, 0x15356, 0x1544d, 0x15556, 0x1564d,
+    0x15756, 0x1584d, 0x15956, 0x15a4d, 0x15b56, 0x15c4d, 0x15d56, 0x15e4d, 0x15f56, 0x1604d,
+    0x16156, 0x1624d, 0x16356, 0x1644d, 0x16556, 0x1664d, 0x16756, 0x1684d, 0x16956, 0x16a4d,
+    0x16b56, 0x16c4d, 0x16d56, 0x16e4d, 0x16f56, 0x1704d, 0x17156, 0x1724d, 0x17356, 0x1744d,
+    0x17556, 0x1764d, 0x17756, 0x1784d, 0x1794d, 0x17a56, 0x17b4d, 0x17c56, 0x17d4d, 0x17e56,
+    0x17f4d, 0x18056, 0x1814d, 0x1824d, 0x18356, 0x1844d, 0x18556, 0x1864d, 0x1874d, 0x18856,
+    0x1894d, 0x18a4d, 0x18b4d, 0x18c56, 0x18e4d, 0x18f4d, 0x1904d, 0x1914d, 0x19256, 0x1934d,
+    0x1944d, 0x19556, 0x1964d, 0x1974d, 0x1984d, 0x19956, 0x19c4d, 0x19d4d, 0x19e56, 0x19f4d,
+    0x1a04d, 0x1a156, 0x1a24d, 0x1a356, 0x1a44d, 0x1a556, 0x1a64d, 0x1a74d, 0x1a856, 0x1a94d,
+    0x1aa56, 0x1ac4d, 0x1ad56, 0x1ae4d, 0x1af4d, 0x1b056, 0x1b14d, 0x1b24d, 0x1b34d, 0x1b456,
+    0x1b54d, 0x1b656, 0x1b74d, 0x1b84d, 0x1b956, 0x1bc4d, 0x1bd56, 0x1c44d, 0x1c74d, 0x1ca4d,
+    0x1cd4d, 0x1ce56, 0x1cf4d, 0x1d056, 0x1d14d, 0x1d256, 0x1d34d, 0x1d456, 0x1d54d, 0x1d656,
+    0x1d74d, 0x1d856, 0x1d94d, 0x1da56, 0x1db4d, 0x1dc56, 0x1de4d, 0x1df56, 0x1e04d, 0x1e156,
+    0x1e24d, 0x1e356, 0x1e44d, 0x1e556, 0x1e64d, 0x1e756, 0x1e84d, 0x1e956, 0x1ea4d, 0x1eb56,
+    0x1ec4d, 0x1ed56, 0x1ee4d, 0x1ef56, 0x1f14d, 0x1f44d, 0x1f556, 0x1f64d, 0x1f74d, 0x1f84d,
+    0x1f956, 0x1fa4d, 0x1fb56, 0x1fc4d, 0x1fd56, 0x1fe4d, 0x1ff56, 0x2004d, 0x20156, 0x2024d,
+    0x20356, 0x2044d, 0x20556, 0x2064d, 0x20756, 0x2084d, 0x20956, 0x20a4d, 0x20b56, 0x20c4d,
+    0x20d56, 0x20e4d, 0x20f56, 0x2104d, 0x21156, 0x2124d, 0x21356, 0x2144d, 0x21556, 0x2164d,
+    0x21756, 0x2184d, 0x21956, 0x21a4d, 0x21b56, 0x21c4d, 0x21d56, 0x21e4d, 0x21f56, 0x2204d,
+    0x22156, 0x2224d, 0x22356, 0x2244d, 0x22556, 0x2264d, 0x22756, 0x2284d, 0x22956, 0x22a4d,
+    0x22b56, 0x22c4d, 0x22d56, 0x22e4d, 0x22f56, 0x2304d, 0x23156, 0x2324d, 0x23356, 0x23a4d,
+    0x23b4d, 0x23c56, 0x23d4d, 0x23e4d, 0x23f56, 0x2414d, 0x24256, 0x2434d, 0x2444d, 0x2454d,
+    0x2464d, 0x24756, 0x2484d, 0x24956, 0x24a4d, 0x24b56, 0x24c4d, 0x24d56, 0x24e4d, 0x24f56,
+    0x2b04d, 0x2b14d, 0x2b24d, 0x2b34d, 0x2b44d, 0x2b54d, 0x2b64d, 0x2b74d, 0x2b84d, 0x2b956,
+    0x2d833, 0x2d933, 0x2da33, 0x2db33, 0x2dc33, 0x2dd33, 0x2de56, 0x2e04d, 0x2e14d, 0x2e24d,
+    0x2e34d, 0x2e44d, 0x2e556, 0x3404d, 0x3414d, 0x34256, 0x3434d, 0x3444d, 0x3454d, 0x34656,
+    0x34f49, 0x35056, 0x3704d, 0x37156, 0x3724d, 0x37356, 0x3744d, 0x37556, 0x3764d, 0x37756,
+    0x37858, 0x37a33, 0x37b56, 0x37e33, 0x37f4d, 0x38058, 0x38433, 0x38533, 0x3864d, 0x3874d,
+    0x3884d, 0x3894d, 0x38a4d, 0x38b58, 0x38c4d, 0x38d58, 0x38e4d, 0x38f4d, 0x39056, 0x3914d,
+    0x3924d, 0x3934d, 0x3944d, 0x3954d, 0x3964d, 0x3974d, 0x3984d, 0x3994d, 0x39a4d, 0x39b4d,
+    0x39c4d, 0x39d4d, 0x39e4d, 0x39f4d, 0x3a04d, 0x3a14d, 0x3a258, 0x3a34d, 0x3a44d, 0x3a54d,
+    0x3a64d, 0x3a74d, 0x3a84d, 0x3a94d, 0x3aa4d, 0x3ab4d, 0x3ac56, 0x3c244, 0x3c356, 0x3cf4d,
+    0x3d04d, 0x3d14d, 0x3d24d, 0x3d34d, 0x3d44d, 0x3d54d, 0x3d64d, 0x3d756, 0x3d84d, 0x3d956,
+    0x3da4d, 0x3db56, 0x3dc4d, 0x3dd56, 0x3de4d, 0x3df56, 0x3e04d, 0x3e156, 0x3e24d, 0x3e356,
+    0x3e44d, 0x3e556, 0x3e64d, 0x3e756, 0x3e84d, 0x3e956, 0x3ea4d, 0x3eb56, 0x3ec4d, 0x3ed56,
+    0x3ee4d, 0x3ef56, 0x3f04d, 0x3f14d, 0x3f24d, 0x3f356, 0x3f44d, 0x3f54d, 0x3f656, 0x3f74d,
+    0x3f856, 0x3f94d, 0x3fa4d, 0x3fb56, 0x3fd4d, 0x3fe4d, 0x3ff4d, 0x4004d, 0x4014d, 0x4024d,
+    0x4034d, 0x4044d, 0x4054d, 0x4064d, 0x4074d, 0x4084d, 0x4094d, 0x40a4d, 0x40b4d, 0x40c4d,
+    0x40d4d, 0x40e4d, 0x40f4d, 0x4104d, 0x4114d, 0x4124d, 0x4134d, 0x4144d, 0x4154d, 0x4164d,
+    0x4174d, 0x4184d, 0x4194d, 0x41a4d, 0x41b4d, 0x41c4d, 0x41d4d, 0x41e4d, 0x41f4d, 0x4204d,
+    0x4214d, 0x4224d, 0x4234d, 0x4244d, 0x4254d, 0x4264d, 0x4274d, 0x4284d, 0x4294d, 0x42a4d,
+    0x42b4d, 0x42c4d, 0x42d4d, 0x42e4d, 0x42f4d, 0x43056, 0x4604d, 0x46156, 0x4624d, 0x46356,
+    0x4644d, 0x46556, 0x4664d, 0x46756, 0x4684d, 0x46956, 0x46a4d, 0x46b56, 0x46c4d, 0x46d56,
+    0x46e4d, 0x46f56, 0x4704d, 0x47156, 0x4724d, 0x47356, 0x4744d, 0x47556, 0x4764d, 0x47756,
+    0x4784d, 0x47956, 0x47a4d, 0x47b56, 0x47c4d, 0x47d56, 0x47e4d, 0x47f56, 0x4804d, 0x48156,
+    0x48a4d, 0x48b56, 0x48c4d, 0x48d56, 0x48e4d, 0x48f56, 0x4904d, 0x49156, 0x4924d, 0x49356,
+    0x4944d, 0x49556, 0x4964d, 0x49756, 0x4984d, 0x49956, 0x49a4d, 0x49b56, 0x49c4d, 0x49d56,
+    0x49e4d, 0x49f56, 0x4a04d, 0x4a156, 0x4a24d, 0x4a356, 0x4a44d, 0x4a556, 0x4a64d, 0x4a756,
+    0x4a84d, 0x4a956, 0x4aa4d, 0x4ab56, 0x4ac4d, 0x4ad56, 0x4ae4d, 0x4af56, 0x4b04d, 0x4b156,
+    0x4b24d, 0x4b356, 0x4b44d, 0x4b556, 0x4b64d, 0x4b756, 0x4b84d, 0x4b956, 0x4ba4d, 0x4bb56,
+    0x4bc4d, 0x4bd56, 0x4be4d, 0x4bf56, 0x4c058, 0x4c14d, 0x4c256, 0x4c34d, 0x4c456, 0x4c54d,
+    0x4c656, 0x4c74d, 0x4c856, 0x4c94d, 0x4ca56, 0x4cb4d, 0x4cc56, 0x4cd4d, 0x4ce56, 0x4d04d,
+    0x4d156, 0x4d24d, 0x4d356, 0x4d44d, 0x4d556, 0x4d64d, 0x4d756, 0x4d84d, 0x4d956, 0x4da4d,
+    0x4db56, 0x4dc4d, 0x4dd56, 0x4de4d, 0x4df56, 0x4e04d, 0x4e156, 0x4e24d, 0x4e356, 0x4e44d,
+    0x4e556, 0x4e64d, 0x4e756, 0x4e84d, 0x4e956, 0x4ea4d, 0x4eb56, 0x4ec4d, 0x4ed56, 0x4ee4d,
+    0x4ef56, 0x4f04d, 0x4f156, 0x4f24d, 0x4f356, 0x4f44d, 0x4f556, 0x4f64d, 0x4f756, 0x4f84d,
+    0x4f956, 0x4fa4d, 0x4fb56, 0x4fc4d, 0x4fd56, 0x4fe4d, 0x4ff56, 0x5004d, 0x50156, 0x5024d,
+    0x50356, 0x5044d, 0x50556, 0x5064d, 0x50756, 0x5084d, 0x50956, 0x50a4d, 0x50b56, 0x50c4d,
+    0x50d56, 0x50e4d, 0x50f56, 0x5104d, 0x51156, 0x5124d, 0x51356, 0x5144d, 0x51556, 0x5164d,
+    0x51756, 0x5184d, 0x51956, 0x51a4d, 0x51b56, 0x51c4d, 0x51d56, 0x51e4d, 0x51f56, 0x5204d,
+    0x52156, 0x5224d, 0x52356, 0x5244d, 0x52556, 0x5264d, 0x52756, 0x5284d, 0x52956, 0x52a4d,
+    0x52b56, 0x52c4d, 0x52d56, 0x52e4d, 0x52f56, 0x53058, 0x5314d, 0x5324d, 0x5334d, 0x5344d,
+    0x5354d, 0x5364d, 0x5374d, 0x5384d, 0x5394d, 0x53a4d, 0x53b4d, 0x53c4d, 0x53d4d, 0x53e4d,
+    0x53f4d, 0x5404d, 0x5414d, 0x5424d, 0x5434d, 0x5444d, 0x5454d, 0x5464d, 0x5474d, 0x5484d,
+    0x5494d, 0x54a4d, 0x54b4d, 0x54c4d, 0x54d4d, 0x54e4d, 0x54f4d, 0x5504d, 0x5514d, 0x5524d,
+    0x5534d, 0x5544d, 0x5554d, 0x5564d, 0x55758, 0x55956, 0x5874d, 0x58856, 0x58b58, 0x58d56,
+    0x59058, 0x59156, 0x5c858, 0x5d056, 0x5eb58, 0x5ef56, 0x5f558, 0x60656, 0x61c58, 0x61d56,
+    0x6754d, 0x6764d, 0x6774d, 0x6784d, 0x67956, 0x6dd58, 0x6de56, 0x70e58, 0x71056, 0x74b58,
+    0x74d56, 0x7b258, 0x7c056, 0x7fb58, 0x7fd56, 0x82e58, 0x83056, 0x83f58, 0x84056, 0x85c58,
+    0x85e56, 0x85f58, 0x86056, 0x86b58, 0x87056, 0x88f58, 0x89856, 0x8e258, 0x8e356, 0x9584d,
+    0x9594d, 0x95a4d, 0x95b4d, 0x95c4d, 0x95d4d, 0x95e4d, 0x95f4d, 0x96056, 0x98458, 0x98556,
+    0x98d58, 0x98f56, 0x99158, 0x99356, 0x9a958, 0x9aa56, 0x9b158, 0x9b256, 0x9b358, 0x9b656,
+    0x9ba58, 0x9bc56, 0x9c558, 0x9c756, 0x9c958, 0x9cb56, 0x9cf58, 0x9d756, 0x9d858, 0x9dc4d,
+    0x9dd4d, 0x9de58, 0x9df4d, 0x9e056, 0x9e458, 0x9e656, 0x9ff58, 0xa0156, 0xa0458, 0xa0556,
+    0xa0b58, 0xa0f56, 0xa1158, 0xa1356, 0xa2958, 0xa2a56, 0xa3158, 0xa3256, 0xa334d, 0xa3458,
+    0xa3556, 0xa364d, 0xa3758, 0xa3856, 0xa3a58, 0xa3c56, 0xa3d58, 0xa3e56, 0xa4358, 0xa4756,
+    0xa4958, 0xa4b56, 0xa4e58, 0xa5156, 0xa5258, 0xa594d, 0xa5a4d, 0xa5b4d, 0xa5c56, 0xa5d58,
+    0xa5e4d, 0xa5f58, 0xa6656, 0xa7758, 0xa8156, 0xa8458, 0xa8556, 0xa8e58, 0xa8f56, 0xa9258,
+    0xa9356, 0xaa958, 0xaaa56, 0xab158, 0xab256, 0xab458, 0xab556, 0xaba58, 0xabc56, 0xac658,
+    0xac756, 0xaca58, 0xacb56, 0xace58, 0xad056, 0xad158, 0xae056, 0xae458, 0xae656, 0xaf258,
+    0xaf956, 0xb0058, 0xb0156, 0xb0458, 0xb0556, 0xb0d58, 0xb0f56, 0xb1158, 0xb1356, 0xb2958,
+    0xb2a56, 0xb3158, 0xb3256, 0xb3458, 0xb3556, 0xb3a58, 0xb3c56, 0xb4558, 0xb4756, 0xb4958,
+    0xb4b56, 0xb4e58, 0xb5556, 0xb5858, 0xb5c4d, 0xb5d4d, 0xb5e58, 0xb5f56, 0xb6458, 0xb6656,
+    0xb7858, 0xb8256, 0xb8458, 0xb8556, 0xb8b58, 0xb8e56, 0xb9158, 0xb9256, 0xb9658, 0xb9956,
+    0xb9b58, 0xb9c56, 0xb9d58, 0xb9e56, 0xba058, 0xba356, 0xba558, 0xba856, 0xbab58, 0xbae56,
+    0xbba58, 0xbbe56, 0xbc358, 0xbc656, 0xbc958, 0xbca56, 0xbce58, 0xbd056, 0xbd158, 0xbd756,
+    0xbd858, 0xbe656, 0xbfb58, 0xc0056, 0xc0d58, 0xc0e56, 0xc1158, 0xc1256, 0xc2958, 0xc2a56,
+    0xc3a58, 0xc3c56, 0xc4558, 0xc4656, 0xc4958, 0xc4a56, 0xc4e58, 0xc5556, 0xc5758, 0xc5856,
+    0xc5b58, 0xc5d56, 0xc5e58, 0xc6056, 0xc6458, 0xc6656, 0xc7058, 0xc7756, 0xc8d58, 0xc8e56,
+    0xc9158, 0xc9256, 0xca958, 0xcaa56, 0xcb458, 0xcb556, 0xcba58, 0xcbc56, 0xcc558, 0xcc656,
+    0xcc958, 0xcca56, 0xcce58, 0xcd556, 0xcd758, 0xcdd56, 0xcdf58, 0xce056, 0xce458, 0xce656,
+    0xcf058, 0xcf156, 0xcf458, 0xd0056, 0xd0d58, 0xd0e56, 0xd1158, 0xd1256, 0xd4558, 0xd4656,
+    0xd4958, 0xd4a56, 0xd5058, 0xd5456, 0xd6458, 0xd6656, 0xd8058, 0xd8156, 0xd8458, 0xd8556,
+    0xd9758, 0xd9a56, 0xdb258, 0xdb356, 0xdbc58, 0xdbd56, 0xdbe58, 0xdc056, 0xdc758, 0xdca56,
+    0xdcb58, 0xdcf56, 0xdd558, 0xdd656, 0xdd758, 0xdd856, 0xde058, 0xde656, 0xdf058, 0xdf256,
+    0xdf558, 0xe0156, 0xe334d, 0xe3456, 0xe3b58, 0xe3f56, 0xe5c58, 0xe8156, 0xe8358, 0xe8456,
+    0xe8558, 0xe8656, 0xe8b58, 0xe8c56, 0xea458, 0xea556, 0xea658, 0xea756, 0xeb34d, 0xeb456,
+    0xebe58, 0xec056, 0xec558, 0xec656, 0xec758, 0xec856, 0xecf58, 0xed056, 0xeda58, 0xedc4d,
+    0xedd4d, 0xede56, 0xee058, 0xf0056, 0xf0c4d, 0xf0d56, 0xf434d, 0xf4456, 0xf4858, 0xf4956,
+    0xf4d4d, 0xf4e56, 0xf524d, 0xf5356, 0xf574d, 0xf5856, 0xf5c4d, 0xf5d56, 0xf694d, 0xf6a56,
+    0xf6d58, 0xf7156, 0xf734d, 0xf7456, 0xf754d, 0xf764d, 0xf774d, 0xf784d, 0xf794d, 0xf7a56,
+    0xf814d, 0xf8256, 0xf934d, 0xf9456, 0xf9858, 0xf9956, 0xf9d4d, 0xf9e56, 0xfa24d, 0xfa356,
+    0xfa74d, 0xfa856, 0xfac4d, 0xfad56, 0xfb94d, 0xfba56, 0xfbd58, 0xfbe56, 0xfcd58, 0xfce56,
+    0xfdb58, 0x100056, 0x10a058, 0x10c74d, 0x10c858, 0x10cd4d, 0x10ce58, 0x10d056, 0x10fc4d, 0x10fd56,
+    0x115f58, 0x116156, 0x124958, 0x124a56, 0x124e58, 0x125056, 0x125758, 0x125856, 0x125958, 0x125a56,
+    0x125e58, 0x126056, 0x128958, 0x128a56, 0x128e58, 0x129056, 0x12b158, 0x12b256, 0x12b658, 0x12b856,
+    0x12bf58, 0x12c056, 0x12c158, 0x12c256, 0x12c658, 0x12c856, 0x12d758, 0x12d856, 0x131158, 0x131256,
+    0x131658, 0x131856, 0x135b58, 0x135d56, 0x137d58, 0x138056, 0x139a58, 0x13a056, 0x13f658, 0x13f84d,
+    0x13f94d, 0x13fa4d, 0x13fb4d, 0x13fc4d, 0x13fd4d, 0x13fe58, 0x140056, 0x168058, 0x168156, 0x169d58,
+    0x16a056, 0x16f958, 0x170056, 0x171658, 0x171f56, 0x173758, 0x174056, 0x175458, 0x176056, 0x176d58,
+    0x176e56, 0x177158, 0x177256, 0x177458, 0x178056, 0x17b458, 0x17b656, 0x17de58, 0x17e056, 0x17ea58,
+    0x17f056, 0x17fa58, 0x180056, 0x180658, 0x180756, 0x180b49, 0x180e58, 0x180f49, 0x181056, 0x181a58,
+    0x182056, 0x187958, 0x188056, 0x18ab58, 0x18b056, 0x18f658, 0x190056, 0x191f58, 0x192056, 0x192c58,
+    0x193056, 0x193c58, 0x194056, 0x194158, 0x194456, 0x196e58, 0x197056, 0x197558, 0x198056, 0x19ac58,
+    0x19b056, 0x19ca58, 0x19d056, 0x19db58, 0x19de56, 0x1a1c58, 0x1a1e56, 0x1a5f58, 0x1a6056, 0x1a7d58,
+    0x1a7f56, 0x1a8a58, 0x1a9056, 0x1a9a58, 0x1aa056, 0x1aae58, 0x1ab056, 0x1acf58, 0x1b0056, 0x1b4d58,
+    0x1b5056, 0x1b7f58, 0x1b8056, 0x1bf458, 0x1bfc56, 0x1c3858, 0x1c3b56, 0x1c4a58, 0x1c4d56, 0x1c804d,
+    0x1c814d, 0x1c824d, 0x1c834d, 0x1c844d, 0x1c864d, 0x1c874d, 0x1c884d, 0x1c8958, 0x1c904d, 0x1c914d,
+    0x1c924d, 0x1c934d, 0x1c944d, 0x1c954d, 0x1c964d, 0x1c974d, 0x1c984d, 0x1c994d, 0x1c9a4d, 0x1c9b4d,
+    0x1c9c4d, 0x1c9d4d, 0x1c9e4d, 0x1c9f4d, 0x1ca04d, 0x1ca14d, 0x1ca24d, 0x1ca34d, 0x1ca44d, 0x1ca54d,
+    0x1ca64d, 0x1ca74d, 0x1ca84d, 0x1ca94d, 0x1caa4d, 0x1cab4d, 0x1cac4d, 0x1cad4d, 0x1cae4d, 0x1caf4d,
+    0x1cb04d, 0x1cb14d, 0x1cb24d, 0x1cb34d, 0x1cb44d, 0x1cb54d, 0x1cb64d, 0x1cb74d, 0x1cb84d, 0x1cb94d,
+    0x1cba4d, 0x1cbb58, 0x1cbd4d, 0x1cbe4d, 0x1cbf4d, 0x1cc056, 0x1cc858, 0x1cd056, 0x1cfb58, 0x1d0056,
+    0x1d2c4d, 0x1d2d4d, 0x1d2e4d, 0x1d2f56, 0x1d304d, 0x1d314d, 0x1d324d, 0x1d334d, 0x1d344d, 0x1d354d,
+    0x1d364d, 0x1d374d, 0x1d384d, 0x1d394d, 0x1d3a4d, 0x1d3b56, 0x1d3c4d, 0x1d3d4d, 0x1d3e4d, 0x1d3f4d,
+    0x1d404d, 0x1d414d, 0x1d424d, 0x1d434d, 0x1d444d, 0x1d454d, 0x1d464d, 0x1d474d, 0x1d484d, 0x1d494d,
+    0x1d4a4d, 0x1d4b4d, 0x1d4c4d, 0x1d4d4d, 0x1d4e56, 0x1d4f4d, 0x1d504d, 0x1d514d, 0x1d524d, 0x1d534d,
+    0x1d544d, 0x1d554d, 0x1d564d, 0x1d574d, 0x1d584d, 0x1d594d, 0x1d5a4d, 0x1d5b4d, 0x1d5c4d, 0x1d5d4d,
+    0x1d5e4d, 0x1d5f4d, 0x1d604d, 0x1d614d, 0x1d624d, 0x1d634d, 0x1d644d, 0x1d654d, 0x1d664d, 0x1d674d,
+    0x1d684d, 0x1d694d, 0x1d6a4d, 0x1d6b56, 0x1d784d, 0x1d7956, 0x1d9b4d, 0x1d9c4d, 0x1d9d4d, 0x1d9e4d,
+    0x1d9f4d, 0x1da04d, 0x1da14d, 0x1da24d, 0x1da34d, 0x1da44d, 0x1da54d, 0x1da64d, 0x1da74d, 0x1da84d,
+    0x1da94d, 0x1daa4d, 0x1dab4d, 0x1dac4d, 0x1dad4d, 0x1dae4d, 0x1daf4d, 0x1db04d, 0x1db14d, 0x1db24d,
+    0x1db34d, 0x1db44d, 0x1db54d, 0x1db64d, 0x1db74d, 0x1db84d, 0x1db94d, 0x1dba4d, 0x1dbb4d, 0x1dbc4d,
+    0x1dbd4d, 0x1dbe4d, 0x1dbf4d, 0x1dc056, 0x1e004d, 0x1e0156, 0x1e024d, 0x1e0356, 0x1e044d, 0x1e0556,
+    0x1e064d, 0x1e0756, 0x1e084d, 0x1e0956, 0x1e0a4d, 0x1e0b56, 0x1e0c4d, 0x1e0d56, 0x1e0e4d, 0x1e0f56,
+    0x1e104d, 0x1e1156, 0x1e124d, 0x1e1356, 0x1e144d, 0x1e1556, 0x1e164d, 0x1e1756, 0x1e184d, 0x1e1956,
+    0x1e1a4d, 0x1e1b56, 0x1e1c4d, 0x1e1d56, 0x1e1e4d, 0x1e1f56, 0x1e204d, 0x1e2156, 0x1e224d, 0x1e2356,
+    0x1e244d, 0x1e2556, 0x1e264d, 0x1e2756, 0x1e284d, 0x1e2956, 0x1e2a4d, 0x1e2b56, 0x1e2c4d, 0x1e2d56,
+    0x1e2e4d, 0x1e2f56, 0x1e304d, 0x1e3156, 0x1e324d, 0x1e3356, 0x1e344d, 0x1e3556, 0x1e364d, 0x1e3756,
+    0x1e384d, 0x1e3956, 0x1e3a4d, 0x1e3b56, 0x1e3c4d, 0x1e3d56, 0x1e3e4d, 0x1e3f56, 0x1e404d, 0x1e4156,
+    0x1e424d, 0x1e4356, 0x1e444d, 0x1e4556, 0x1e464d, 0x1e4756, 0x1e484d, 0x1e4956, 0x1e4a4d, 0x1e4b56,
+    0x1e4c4d, 0x1e4d56, 0x1e4e4d, 0x1e4f56, 0x1e504d, 0x1e5156, 0x1e524d, 0x1e5356, 0x1e544d, 0x1e5556,
+    0x1e564d, 0x1e5756, 0x1e584d, 0x1e5956, 0x1e5a4d, 0x1e5b56, 0x1e5c4d, 0x1e5d56, 0x1e5e4d, 0x1e5f56,
+    0x1e604d, 0x1e6156, 0x1e624d, 0x1e6356, 0x1e644d, 0x1e6556, 0x1e664d, 0x1e6756, 0x1e684d, 0x1e6956,
+    0x1e6a4d, 0x1e6b56, 0x1e6c4d, 0x1e6d56, 0x1e6e4d, 0x1e6f56, 0x1e704d, 0x1e7156, 0x1e724d, 0x1e7356,
+    0x1e744d, 0x1e7556, 0x1e764d, 0x1e7756, 0x1e784d, 0x1e7956, 0x1e7a4d, 0x1e7b56, 0x1e7c4d, 0x1e7d56,
+    0x1e7e4d, 0x1e7f56, 0x1e804d, 0x1e8156, 0x1e824d, 0x1e8356, 0x1e844d, 0x1e8556, 0x1e864d, 0x1e8756,
+    0x1e884d, 0x1e8956, 0x1e8a4d, 0x1e8b56, 0x1e8c4d, 0x1e8d56, 0x1e8e4d, 0x1e8f56, 0x1e904d, 0x1e9156,
+    0x1e924d, 0x1e9356, 0x1e944d, 0x1e9556, 0x1e9a4d, 0x1e9b4d, 0x1e9c56, 0x1e9e4d, 0x1e9f56, 0x1ea04d,
+    0x1ea156, 0x1ea24d, 0x1ea356, 0x1ea44d, 0x1ea556, 0x1ea64d, 0x1ea756, 0x1ea84d, 0x1ea956, 0x1eaa4d,
+    0x1eab56, 0x1eac4d, 0x1ead56, 0x1eae4d, 0x1eaf56, 0x1eb04d, 0x1eb156, 0x1eb24d, 0x1eb356, 0x1eb44d,
+    0x1eb556, 0x1eb64d, 0x1eb756, 0x1eb84d, 0x1eb956, 0x1eba4d, 0x1ebb56, 0x1ebc4d, 0x1ebd56, 0x1ebe4d,
+    0x1ebf56, 0x1ec04d, 0x1ec156, 0x1ec24d, 0x1ec356, 0x1ec44d, 0x1ec556, 0x1ec64d, 0x1ec756, 0x1ec84d,
+    0x1ec956, 0x1eca4d, 0x1ecb56, 0x1ecc4d, 0x1ecd56, 0x1ece4d, 0x1ecf56, 0x1ed04d, 0x1ed156, 0x1ed24d,
+    0x1ed356, 0x1ed44d, 0x1ed556, 0x1ed64d, 0x1ed756, 0x1ed84d, 0x1ed956, 0x1eda4d, 0x1edb56, 0x1edc4d,
+    0x1edd56, 0x1ede4d, 0x1edf56, 0x1ee04d, 0x1ee156, 0x1ee24d, 0x1ee356, 0x1ee44d, 0x1ee556, 0x1ee64d,
+    0x1ee756, 0x1ee84d, 0x1ee956, 0x1eea4d, 0x1eeb56, 0x1eec4d, 0x1eed56, 0x1eee4d, 0x1eef56, 0x1ef04d,
+    0x1ef156, 0x1ef24d, 0x1ef356, 0x1ef44d, 0x1ef556, 0x1ef64d, 0x1ef756, 0x1ef84d, 0x1ef956, 0x1efa4d,
+    0x1efb56, 0x1efc4d, 0x1efd56, 0x1efe4d, 0x1eff56, 0x1f084d, 0x1f094d, 0x1f0a4d, 0x1f0b4d, 0x1f0c4d,
+    0x1f0d4d, 0x1f0e4d, 0x1f0f4d, 0x1f1056, 0x1f1658, 0x1f184d, 0x1f194d, 0x1f1a4d, 0x1f1b4d, 0x1f1c4d,
+    0x1f1d4d, 0x1f1e58, 0x1f2056, 0x1f284d, 0x1f294d, 0x1f2a4d, 0x1f2b4d, 0x1f2c4d, 0x1f2d4d, 0x1f2e4d,
+    0x1f2f4d, 0x1f3056, 0x1f384d, 0x1f394d, 0x1f3a4d, 0x1f3b4d, 0x1f3c4d, 0x1f3d4d, 0x1f3e4d, 0x1f3f4d,
+    0x1f4056, 0x1f4658, 0x1f484d, 0x1f494d, 0x1f4a4d, 0x1f4b4d, 0x1f4c4d, 0x1f4d4d, 0x1f4e58, 0x1f5056,
+    0x1f5858, 0x1f594d, 0x1f5a58, 0x1f5b4d, 0x1f5c58, 0x1f5d4d, 0x1f5e58, 0x1f5f4d, 0x1f6056, 0x1f684d,
+    0x1f694d, 0x1f6a4d, 0x1f6b4d, 0x1f6c4d, 0x1f6d4d, 0x1f6e4d, 0x1f6f4d, 0x1f7056, 0x1f714d, 0x1f7256,
+    0x1f734d, 0x1f7456, 0x1f754d, 0x1f7656, 0x1f774d, 0x1f7856, 0x1f794d, 0x1f7a56, 0x1f7b4d, 0x1f7c56,
+    0x1f7d4d, 0x1f7e58, 0x1f804d, 0x1f814d, 0x1f824d, 0x1f834d, 0x1f844d, 0x1f854d, 0x1f864d, 0x1f874d,
+    0x1f884d, 0x1f894d, 0x1f8a4d, 0x1f8b4d, 0x1f8c4d, 0x1f8d4d, 0x1f8e4d, 0x1f8f4d, 0x1f904d, 0x1f914d,
+    0x1f924d, 0x1f934d, 0x1f944d, 0x1f954d, 0x1f964d, 0x1f974d, 0x1f984d, 0x1f994d, 0x1f9a4d, 0x1f9b4d,
+    0x1f9c4d, 0x1f9d4d, 0x1f9e4d, 0x1f9f4d, 0x1fa04d, 0x1fa14d, 0x1fa24d, 0x1fa34d, 0x1fa44d, 0x1fa54d,
+    0x1fa64d, 0x1fa74d, 0x1fa84d, 0x1fa94d, 0x1faa4d, 0x1fab4d, 0x1fac4d, 0x1fad4d, 0x1fae4d, 0x1faf4d,
+    0x1fb056, 0x1fb24d, 0x1fb34d, 0x1fb44d, 0x1fb558, 0x1fb656, 0x1fb74d, 0x1fb84d, 0x1fb94d, 0x1fba4d,
+    0x1fbb4d, 0x1fbc4d, 0x1fbd33, 0x1fbe4d, 0x1fbf33, 0x1fc033, 0x1fc133, 0x1fc24d, 0x1fc34d, 0x1fc44d,
+    0x1fc558, 0x1fc656, 0x1fc74d, 0x1fc84d, 0x1fc94d, 0x1fca4d, 0x1fcb4d, 0x1fcc4d, 0x1fcd33, 0x1fce33,
+    0x1fcf33, 0x1fd056, 0x1fd34d, 0x1fd458, 0x1fd656, 0x1fd84d, 0x1fd94d, 0x1fda4d, 0x1fdb4d, 0x1fdc58,
+    0x1fdd33, 0x1fde33, 0x1fdf33, 0x1fe056, 0x1fe34d, 0x1fe456, 0x1fe84d, 0x1fe94d, 0x1fea4d, 0x1feb4d,
+    0x1fec4d, 0x1fed33, 0x1fee33, 0x1fef33, 0x1ff058, 0x1ff24d, 0x1ff34d, 0x1ff44d, 0x1ff558, 0x1ff656,
+    0x1ff74d, 0x1ff84d, 0x1ff94d, 0x1ffa4d, 0x1ffb4d, 0x1ffc4d, 0x1ffd33, 0x1ffe33, 0x1fff58, 0x200033,
+    0x200b49, 0x200c44, 0x200e58, 0x201056, 0x20114d, 0x201256, 0x201733, 0x201856, 0x202458, 0x202756,
+    0x202858, 0x202f33, 0x203056, 0x20334d, 0x20344d, 0x203556, 0x20364d, 0x20374d, 0x203856, 0x203c33,
+    0x203d56, 0x203e33, 0x203f56, 0x204733, 0x204833, 0x204933, 0x204a56, 0x20574d, 0x205856, 0x205f33,
+    0x206049, 0x206158, 0x206449, 0x206558, 0x20704d, 0x20714d, 0x207258, 0x20744d, 0x20754d, 0x20764d,
+    0x20774d, 0x20784d, 0x20794d, 0x207a33, 0x207b4d, 0x207c33, 0x207d33, 0x207e33, 0x207f4d, 0x20804d,
+    0x20814d, 0x20824d, 0x20834d, 0x20844d, 0x20854d, 0x20864d, 0x20874d, 0x20884d, 0x20894d, 0x208a33,
+    0x208b4d, 0x208c33, 0x208d33, 0x208e33, 0x208f58, 0x20904d, 0x20914d, 0x20924d, 0x20934d, 0x20944d,
+    0x20954d, 0x20964d, 0x20974d, 0x20984d, 0x20994d, 0x209a4d, 0x209b4d, 0x209c4d, 0x209d58, 0x20a056,
+    0x20a84d, 0x20a956, 0x20c158, 0x20d056, 0x20f158, 0x210033, 0x210133, 0x21024d, 0x21034d, 0x210456,
+    0x210533, 0x210633, 0x21074d, 0x210856, 0x21094d, 0x210a4d, 0x210b4d, 0x210f4d, 0x21104d, 0x21124d,
+    0x211456, 0x21154d, 0x21164d, 0x211756, 0x21194d, 0x211a4d, 0x211b4d, 0x211e56, 0x21204d, 0x21214d,
+    0x21224d, 0x212356, 0x21244d, 0x212556, 0x21264d, 0x212756, 0x21284d, 0x212956, 0x212a4d, 0x212b4d,
+    0x212c4d, 0x212d4d, 0x212e56, 0x212f4d, 0x21314d, 0x213258, 0x21334d, 0x21344d, 0x21354d, 0x21364d,
+    0x21374d, 0x21384d, 0x21394d, 0x213a56, 0x213b4d, 0x213c4d, 0x213d4d, 0x213f4d, 0x21404d, 0x214156,
+    0x21454d, 0x21474d, 0x21484d, 0x21494d, 0x214a56, 0x21504d, 0x21514d, 0x21524d, 0x21534d, 0x21544d,
+    0x21554d, 0x21564d, 0x21574d, 0x21584d, 0x21594d, 0x215a4d, 0x215b4d, 0x215c4d, 0x215d4d, 0x215e4d,
+    0x215f4d, 0x21604d, 0x21614d, 0x21624d, 0x21634d, 0x21644d, 0x21654d, 0x21664d, 0x21674d, 0x21684d,
+    0x21694d, 0x216a4d, 0x216b4d, 0x216c4d, 0x216d4d, 0x216e4d, 0x216f4d, 0x21704d, 0x21714d, 0x21724d,
+    0x21734d, 0x21744d, 0x21754d, 0x21764d, 0x21774d, 0x21784d, 0x21794d, 0x217a4d, 0x217b4d, 0x217c4d,
+    0x217d4d, 0x217e4d, 0x217f4d, 0x218056, 0x218358, 0x218456, 0x21894d, 0x218a56, 0x218c58, 0x219056,
+    0x222c4d, 0x222d4d, 0x222e56, 0x222f4d, 0x22304d, 0x223156, 0x23294d, 0x232a4d, 0x232b56, 0x242758,
+    0x244056, 0x244b58, 0x24604d, 0x24614d, 0x24624d, 0x24634d, 0x24644d, 0x24654d, 0x24664d, 0x24674d,
+    0x24684d, 0x24694d, 0x246a4d, 0x246b4d, 0x246c4d, 0x246d4d, 0x246e4d, 0x246f4d, 0x24704d, 0x24714d,
+    0x24724d, 0x24734d, 0x247433, 0x247533, 0x247633, 0x247733, 0x247833, 0x247933, 0x247a33, 0x247b33,
+    0x247c33, 0x247d33, 0x247e33, 0x247f33, 0x248033, 0x248133, 0x248233, 0x248333, 0x248433, 0x248533,
+    0x248633, 0x248733, 0x248858, 0x249c33, 0x249d33, 0x249e33, 0x249f33, 0x24a033, 0x24a133, 0x24a233,
+    0x24a333, 0x24a433, 0x24a533, 0x24a633, 0x24a733, 0x24a833, 0x24a933, 0x24aa33, 0x24ab33, 0x24ac33,
+    0x24ad33, 0x24ae33, 0x24af33, 0x24b033, 0x24b133, 0x24b233, 0x24b333, 0x24b433, 0x24b533, 0x24b64d,
+    0x24b74d, 0x24b84d, 0x24b94d, 0x24ba4d, 0x24bb4d, 0x24bc4d, 0x24bd4d, 0x24be4d, 0x24bf4d, 0x24c04d,
+    0x24c14d, 0x24c24d, 0x24c34d, 0x24c44d, 0x24c54d, 0x24c64d, 0x24c74d, 0x24c84d, 0x24c94d, 0x24ca4d,
+    0x24cb4d, 0x24cc4d, 0x24cd4d, 0x24ce4d, 0x24cf4d, 0x24d04d, 0x24d14d, 0x24d24d, 0x24d34d, 0x24d44d,
+    0x24d54d, 0x24d64d, 0x24d74d, 0x24d84d, 0x24d94d, 0x24da4d, 0x24db4d, 0x24dc4d, 0x24dd4d, 0x24de4d,
+    0x24df4d, 0x24e04d, 0x24e14d, 0x24e24d, 0x24e34d, 0x24e44d, 0x24e54d, 0x24e64d, 0x24e74d, 0x24e84d,
+    0x24e94d, 0x24ea4d, 0x24eb56, 0x2a0c4d, 0x2a0d56, 0x2a7433, 0x2a7533, 0x2a7633, 0x2a7756, 0x2adc4d,
+    0x2add56, 0x2b7458, 0x2b7656, 0x2b9658, 0x2b9756, 0x2c004d, 0x2c014d, 0x2c024d, 0x2c034d, 0x2c044d,
+    0x2c054d, 0x2c064d, 0x2c074d, 0x2c084d, 0x2c094d, 0x2c0a4d, 0x2c0b4d, 0x2c0c4d, 0x2c0d4d, 0x2c0e4d,
+    0x2c0f4d, 0x2c104d, 0x2c114d, 0x2c124d, 0x2c134d, 0x2c144d, 0x2c154d, 0x2c164d, 0x2c174d, 0x2c184d,
+    0x2c194d, 0x2c1a4d, 0x2c1b4d, 0x2c1c4d, 0x2c1d4d, 0x2c1e4d, 0x2c1f4d, 0x2c204d, 0x2c214d, 0x2c224d,
+    0x2c234d, 0x2c244d, 0x2c254d, 0x2c264d, 0x2c274d, 0x2c284d, 0x2c294d, 0x2c2a4d, 0x2c2b4d, 0x2c2c4d,
+    0x2c2d4d, 0x2c2e4d, 0x2c2f4d, 0x2c3056, 0x2c604d, 0x2c6156, 0x2c624d, 0x2c634d, 0x2c644d, 0x2c6556,
+    0x2c674d, 0x2c6856, 0x2c694d, 0x2c6a56, 0x2c6b4d, 0x2c6c56, 0x2c6d4d, 0x2c6e4d, 0x2c6f4d, 0x2c704d,
+    0x2c7156, 0x2c724d, 0x2c7356, 0x2c754d, 0x2c7656, 0x2c7c4d, 0x2c7d4d, 0x2c7e4d, 0x2c7f4d, 0x2c804d,
+    0x2c8156, 0x2c824d, 0x2c8356, 0x2c844d, 0x2c8556, 0x2c864d, 0x2c8756, 0x2c884d, 0x2c8956, 0x2c8a4d,
+    0x2c8b56, 0x2c8c4d, 0x2c8d56, 0x2c8e4d, 0x2c8f56, 0x2c904d, 0x2c9156, 0x2c924d, 0x2c9356, 0x2c944d,
+    0x2c9556, 0x2c964d, 0x2c9756, 0x2c984d, 0x2c9956, 0x2c9a4d, 0x2c9b56, 0x2c9c4d, 0x2c9d56, 0x2c9e4d,
+    0x2c9f56, 0x2ca04d, 0x2ca156, 0x2ca24d, 0x2ca356, 0x2ca44d, 0x2ca556, 0x2ca64d, 0x2ca756, 0x2ca84d,
+    0x2ca956, 0x2caa4d, 0x2cab56, 0x2cac4d, 0x2cad56, 0x2cae4d, 0x2caf56, 0x2cb04d, 0x2cb156, 0x2cb24d,
+    0x2cb356, 0x2cb44d, 0x2cb556, 0x2cb64d, 0x2cb756, 0x2cb84d, 0x2cb956, 0x2cba4d, 0x2cbb56, 0x2cbc4d,
+    0x2cbd56, 0x2cbe4d, 0x2cbf56, 0x2cc04d, 0x2cc156, 0x2cc24d, 0x2cc356, 0x2cc44d, 0x2cc556, 0x2cc64d,
+    0x2cc756, 0x2cc84d, 0x2cc956, 0x2cca4d, 0x2ccb56, 0x2ccc4d, 0x2ccd56, 0x2cce4d, 0x2ccf56, 0x2cd04d,
+    0x2cd156, 0x2cd24d, 0x2cd356, 0x2cd44d, 0x2cd556, 0x2cd64d, 0x2cd756, 0x2cd84d, 0x2cd956, 0x2cda4d,
+    0x2cdb56, 0x2cdc4d, 0x2cdd56, 0x2cde4d, 0x2cdf56, 0x2ce04d, 0x2ce156, 0x2ce24d, 0x2ce356, 0x2ceb4d,
+    0x2cec56, 0x2ced4d, 0x2cee56, 0x2cf24d, 0x2cf356, 0x2cf458, 0x2cf956, 0x2d2658, 0x2d2756, 0x2d2858,
+    0x2d2d56, 0x2d2e58, 0x2d3056, 0x2d6858, 0x2d6f4d, 0x2d7056, 0x2d7158, 0x2d7f56, 0x2d9758, 0x2da056,
+    0x2da758, 0x2da856, 0x2daf58, 0x2db056, 0x2db758, 0x2db856, 0x2dbf58, 0x2dc056, 0x2dc758, 0x2dc856,
+    0x2dcf58, 0x2dd056, 0x2dd758, 0x2dd856, 0x2ddf58, 0x2de056, 0x2e5e58, 0x2e8056, 0x2e9a58, 0x2e9b56,
+    0x2e9f4d, 0x2ea056, 0x2ef34d, 0x2ef458, 0x2f004d, 0x2f014d, 0x2f024d, 0x2f034d, 0x2f044d, 0x2f054d,
+    0x2f064d, 0x2f074d, 0x2f084d, 0x2f094d, 0x2f0a4d, 0x2f0b4d, 0x2f0c4d, 0x2f0d4d, 0x2f0e4d, 0x2f0f4d,
+    0x2f104d, 0x2f114d, 0x2f124d, 0x2f134d, 0x2f144d, 0x2f154d, 0x2f164d, 0x2f174d, 0x2f184d, 0x2f194d,
+    0x2f1a4d, 0x2f1b4d, 0x2f1c4d, 0x2f1d4d, 0x2f1e4d, 0x2f1f4d, 0x2f204d, 0x2f214d, 0x2f224d, 0x2f234d,
+    0x2f244d, 0x2f254d, 0x2f264d, 0x2f274d, 0x2f284d, 0x2f294d, 0x2f2a4d, 0x2f2b4d, 0x2f2c4d, 0x2f2d4d,
+    0x2f2e4d, 0x2f2f4d, 0x2f304d, 0x2f314d, 0x2f324d, 0x2f334d, 0x2f344d, 0x2f354d, 0x2f364d, 0x2f374d,
+    0x2f384d, 0x2f394d, 0x2f3a4d, 0x2f3b4d, 0x2f3c4d, 0x2f3d4d, 0x2f3e4d, 0x2f3f4d, 0x2f404d, 0x2f414d,
+    0x2f424d, 0x2f434d, 0x2f444d, 0x2f454d, 0x2f464d, 0x2f474d, 0x2f484d, 0x2f494d, 0x2f4a4d, 0x2f4b4d,
+    0x2f4c4d, 0x2f4d4d, 0x2f4e4d, 0x2f4f4d, 0x2f504d, 0x2f514d, 0x2f524d, 0x2f534d, 0x2f544d, 0x2f554d,
+    0x2f564d, 0x2f574d, 0x2f584d, 0x2f594d, 0x2f5a4d, 0x2f5b4d, 0x2f5c4d, 0x2f5d4d, 0x2f5e4d, 0x2f5f4d,
+    0x2f604d, 0x2f614d, 0x2f624d, 0x2f634d, 0x2f644d, 0x2f654d, 0x2f664d, 0x2f674d, 0x2f684d, 0x2f694d,
+    0x2f6a4d, 0x2f6b4d, 0x2f6c4d, 0x2f6d4d, 0x2f6e4d, 0x2f6f4d, 0x2f704d, 0x2f714d, 0x2f724d, 0x2f734d,
+    0x2f744d, 0x2f754d, 0x2f764d, 0x2f774d, 0x2f784d, 0x2f794d, 0x2f7a4d, 0x2f7b4d, 0x2f7c4d, 0x2f7d4d,
+    0x2f7e4d, 0x2f7f4d, 0x2f804d, 0x2f814d, 0x2f824d, 0x2f834d, 0x2f844d, 0x2f854d, 0x2f864d, 0x2f874d,
+    0x2f884d, 0x2f894d, 0x2f8a4d, 0x2f8b4d, 0x2f8c4d, 0x2f8d4d, 0x2f8e4d, 0x2f8f4d, 0x2f904d, 0x2f914d,
+    0x2f924d, 0x2f934d, 0x2f944d, 0x2f954d, 0x2f964d, 0x2f974d, 0x2f984d, 0x2f994d, 0x2f9a4d, 0x2f9b4d,
+    0x2f9c4d, 0x2f9d4d, 0x2f9e4d, 0x2f9f4d, 0x2fa04d, 0x2fa14d, 0x2fa24d, 0x2fa34d, 0x2fa44d, 0x2fa54d,
+    0x2fa64d, 0x2fa74d, 0x2fa84d, 0x2fa94d, 0x2faa4d, 0x2fab4d, 0x2fac4d, 0x2fad4d, 0x2fae4d, 0x2faf4d,
+    0x2fb04d, 0x2fb14d, 0x2fb24d, 0x2fb34d, 0x2fb44d, 0x2fb54d, 0x2fb64d, 0x2fb74d, 0x2fb84d, 0x2fb94d,
+    0x2fba4d, 0x2fbb4d, 0x2fbc4d, 0x2fbd4d, 0x2fbe4d, 0x2fbf4d, 0x2fc04d, 0x2fc14d, 0x2fc24d, 0x2fc34d,
+    0x2fc44d, 0x2fc54d, 0x2fc64d, 0x2fc74d, 0x2fc84d, 0x2fc94d, 0x2fca4d, 0x2fcb4d, 0x2fcc4d, 0x2fcd4d,
+    0x2fce4d, 0x2fcf4d, 0x2fd04d, 0x2fd14d, 0x2fd24d, 0x2fd34d, 0x2fd44d, 0x2fd54d, 0x2fd658, 0x300033,
+    0x300156, 0x30024d, 0x300356, 0x30364d, 0x303756, 0x30384d, 0x30394d, 0x303a4d, 0x303b56, 0x304058,
+    0x304156, 0x309758, 0x309956, 0x309b33, 0x309c33, 0x309d56, 0x309f4d, 0x30a056, 0x30ff4d, 0x310058,
+    0x310556, 0x313058, 0x31314d, 0x31324d, 0x31334d, 0x31344d, 0x31354d, 0x31364d, 0x31374d, 0x31384d,
+    0x31394d, 0x313a4d, 0x313b4d, 0x313c4d, 0x313d4d, 0x313e4d, 0x313f4d, 0x31404d, 0x31414d, 0x31424d,
+    0x31434d, 0x31444d, 0x31454d, 0x31464d, 0x31474d, 0x31484d, 0x31494d, 0x314a4d, 0x314b4d, 0x314c4d,
+    0x314d4d, 0x314e4d, 0x314f4d, 0x31504d, 0x31514d, 0x31524d, 0x31534d, 0x31544d, 0x31554d, 0x31564d,
+    0x31574d, 0x31584d, 0x31594d, 0x315a4d, 0x315b4d, 0x315c4d, 0x315d4d, 0x315e4d, 0x315f4d, 0x31604d,
+    0x31614d, 0x31624d, 0x31634d, 0x316458, 0x31654d, 0x31664d, 0x31674d, 0x31684d, 0x31694d, 0x316a4d,
+    0x316b4d, 0x316c4d, 0x316d4d, 0x316e4d, 0x316f4d, 0x31704d, 0x31714d, 0x31724d, 0x31734d, 0x31744d,
+    0x31754d, 0x31764d, 0x31774d, 0x31784d, 0x31794d, 0x317a4d, 0x317b4d, 0x317c4d, 0x317d4d, 0x317e4d,
+    0x317f4d, 0x31804d, 0x31814d, 0x31824d, 0x31834d, 0x31844d, 0x31854d, 0x31864d, 0x31874d, 0x31884d,
+    0x31894d, 0x318a4d, 0x318b4d, 0x318c4d, 0x318d4d, 0x318e4d, 0x318f58, 0x319056, 0x31924d, 0x31934d,
+    0x31944d, 0x31954d, 0x31964d, 0x31974d, 0x31984d, 0x31994d, 0x319a4d, 0x319b4d, 0x319c4d, 0x319d4d,
+    0x319e4d, 0x319f4d, 0x31a056, 0x31e458, 0x31f056, 0x320033, 0x320133, 0x320233, 0x320333, 0x320433,
+    0x320533, 0x320633, 0x320733, 0x320833, 0x320933, 0x320a33, 0x320b33, 0x320c33, 0x320d33, 0x320e33,
+    0x320f33, 0x321033, 0x321133, 0x321233, 0x321333, 0x321433, 0x321533, 0x321633, 0x321733, 0x321833,
+    0x321933, 0x321a33, 0x321b33, 0x321c33, 0x321d33, 0x321e33, 0x321f58, 0x322033, 0x322133, 0x322233,
+    0x322333, 0x322433, 0x322533, 0x322633, 0x322733, 0x322833, 0x322933, 0x322a33, 0x322b33, 0x322c33,
+    0x322d33, 0x322e33, 0x322f33, 0x323033, 0x323133, 0x323233, 0x323333, 0x323433, 0x323533, 0x323633,
+    0x323733, 0x323833, 0x323933, 0x323a33, 0x323b33, 0x323c33, 0x323d33, 0x323e33, 0x323f33, 0x324033,
+    0x324133, 0x324233, 0x324333, 0x32444d, 0x32454d, 0x32464d, 0x32474d, 0x324856, 0x32504d, 0x32514d,
+    0x32524d, 0x32534d, 0x32544d, 0x32554d, 0x32564d, 0x32574d, 0x32584d, 0x32594d, 0x325a4d, 0x325b4d,
+    0x325c4d, 0x325d4d, 0x325e4d, 0x325f4d, 0x32604d, 0x32614d, 0x32624d, 0x32634d, 0x32644d, 0x32654d,
+    0x32664d, 0x32674d, 0x32684d, 0x32694d, 0x326a4d, 0x326b4d, 0x326c4d, 0x326d4d, 0x326e4d, 0x326f4d,
+    0x32704d, 0x32714d, 0x32724d, 0x32734d, 0x32744d, 0x32754d, 0x32764d, 0x32774d, 0x32784d, 0x32794d,
+    0x327a4d, 0x327b4d, 0x327c4d, 0x327d4d, 0x327e4d, 0x327f56, 0x32804d, 0x32814d, 0x32824d, 0x32834d,
+    0x32844d, 0x32854d, 0x32864d, 0x32874d, 0x32884d, 0x32894d, 0x328a4d, 0x328b4d, 0x328c4d, 0x328d4d,
+    0x328e4d, 0x328f4d, 0x32904d, 0x32914d, 0x32924d, 0x32934d, 0x32944d, 0x32954d, 0x32964d, 0x32974d,
+    0x32984d, 0x32994d, 0x329a4d, 0x329b4d, 0x329c4d, 0x329d4d, 0x329e4d, 0x329f4d, 0x32a04d, 0x32a14d,
+    0x32a24d, 0x32a34d, 0x32a44d, 0x32a54d, 0x32a64d, 0x32a74d, 0x32a84d, 0x32a94d, 0x32aa4d, 0x32ab4d,
+    0x32ac4d, 0x32ad4d, 0x32ae4d, 0x32af4d, 0x32b04d, 0x32b14d, 0x32b24d, 0x32b34d, 0x32b44d, 0x32b54d,
+    0x32b64d, 0x32b74d, 0x32b84d, 0x32b94d, 0x32ba4d, 0x32bb4d, 0x32bc4d, 0x32bd4d, 0x32be4d, 0x32bf4d,
+    0x32c04d, 0x32c14d, 0x32c24d, 0x32c34d, 0x32c44d, 0x32c54d, 0x32c64d, 0x32c74d, 0x32c84d, 0x32c94d,
+    0x32ca4d, 0x32cb4d, 0x32cc4d, 0x32cd4d, 0x32ce4d, 0x32cf4d, 0x32d04d, 0x32d14d, 0x32d24d, 0x32d34d,
+    0x32d44d, 0x32d54d, 0x32d64d, 0x32d74d, 0x32d84d, 0x32d94d, 0x32da4d, 0x32db4d, 0x32dc4d, 0x32dd4d,
+    0x32de4d, 0x32df4d, 0x32e04d, 0x32e14d, 0x32e24d, 0x32e34d, 0x32e44d, 0x32e54d, 0x32e64d, 0x32e74d,
+    0x32e84d, 0x32e94d, 0x32ea4d, 0x32eb4d, 0x32ec4d, 0x32ed4d, 0x32ee4d, 0x32ef4d, 0x32f04d, 0x32f14d,
+    0x32f24d, 0x32f34d, 0x32f44d, 0x32f54d, 0x32f64d, 0x32f74d, 0x32f84d, 0x32f94d, 0x32fa4d, 0x32fb4d,
+    0x32fc4d, 0x32fd4d, 0x32fe4d, 0x32ff4d, 0x33004d, 0x33014d, 0x33024d, 0x33034d, 0x33044d, 0x33054d,
+    0x33064d, 0x33074d, 0x33084d, 0x33094d, 0x330a4d, 0x330b4d, 0x330c4d, 0x330d4d, 0x330e4d, 0x330f4d,
+    0x33104d, 0x33114d, 0x33124d, 0x33134d, 0x33144d, 0x33154d, 0x33164d, 0x33174d, 0x33184d, 0x33194d,
+    0x331a4d, 0x331b4d, 0x331c4d, 0x331d4d, 0x331e4d, 0x331f4d, 0x33204d, 0x33214d, 0x33224d, 0x33234d,
+    0x33244d, 0x33254d, 0x33264d, 0x33274d, 0x33284d, 0x33294d, 0x332a4d, 0x332b4d, 0x332c4d, 0x332d4d,
+    0x332e4d, 0x332f4d, 0x33304d, 0x33314d, 0x33324d, 0x33334d, 0x33344d, 0x33354d, 0x33364d, 0x33374d,
+    0x33384d, 0x33394d, 0x333a4d, 0x333b4d, 0x333c4d, 0x333d4d, 0x333e4d, 0x333f4d, 0x33404d, 0x33414d,
+    0x33424d, 0x33434d, 0x33444d, 0x33454d, 0x33464d, 0x33474d, 0x33484d, 0x33494d, 0x334a4d, 0x334b4d,
+    0x334c4d, 0x334d4d, 0x334e4d, 0x334f4d, 0x33504d, 0x33514d, 0x33524d, 0x33534d, 0x33544d, 0x33554d,
+    0x33564d, 0x33574d, 0x33584d, 0x33594d, 0x335a4d, 0x335b4d, 0x335c4d, 0x335d4d, 0x335e4d, 0x335f4d,
+    0x33604d, 0x33614d, 0x33624d, 0x33634d, 0x33644d, 0x33654d, 0x33664d, 0x33674d, 0x33684d, 0x33694d,
+    0x336a4d, 0x336b4d, 0x336c4d, 0x336d4d, 0x336e4d, 0x336f4d, 0x33704d, 0x33714d, 0x33724d, 0x33734d,
+    0x33744d, 0x33754d, 0x33764d, 0x33774d, 0x33784d, 0x33794d, 0x337a4d, 0x337b4d, 0x337c4d, 0x337d4d,
+    0x337e4d, 0x337f4d, 0x33804d, 0x33814d, 0x33824d, 0x33834d, 0x33844d, 0x33854d, 0x33864d, 0x33874d,
+    0x33884d, 0x33894d, 0x338a4d, 0x338b4d, 0x338c4d, 0x338d4d, 0x338e4d, 0x338f4d, 0x33904d, 0x33914d,
+    0x33924d, 0x33934d, 0x33944d, 0x33954d, 0x33964d, 0x33974d, 0x33984d, 0x33994d, 0x339a4d, 0x339b4d,
+    0x339c4d, 0x339d4d, 0x339e4d, 0x339f4d, 0x33a04d, 0x33a14d, 0x33a24d, 0x33a34d, 0x33a44d, 0x33a54d,
+    0x33a64d, 0x33a74d, 0x33a84d, 0x33a94d, 0x33aa4d, 0x33ab4d, 0x33ac4d, 0x33ad4d, 0x33ae4d, 0x33af4d,
+    0x33b04d, 0x33b14d, 0x33b24d, 0x33b34d, 0x33b44d, 0x33b54d, 0x33b64d, 0x33b74d, 0x33b84d, 0x33b94d,
+    0x33ba4d, 0x33bb4d, 0x33bc4d, 0x33bd4d, 0x33be4d, 0x33bf4d, 0x33c04d, 0x33c14d, 0x33c258, 0x33c34d,
+    0x33c44d, 0x33c54d, 0x33c64d, 0x33c758, 0x33c84d, 0x33c94d, 0x33ca4d, 0x33cb4d, 0x33cc4d, 0x33cd4d,
+    0x33ce4d, 0x33cf4d, 0x33d04d, 0x33d14d, 0x33d24d, 0x33d34d, 0x33d44d, 0x33d54d, 0x33d64d, 0x33d74d,
+    0x33d858, 0x33d94d, 0x33da4d, 0x33db4d, 0x33dc4d, 0x33dd4d, 0x33de4d, 0x33df4d, 0x33e04d, 0x33e14d,
+    0x33e24d, 0x33e34d, 0x33e44d, 0x33e54d, 0x33e64d, 0x33e74d, 0x33e84d, 0x33e94d, 0x33ea4d, 0x33eb4d,
+    0x33ec4d, 0x33ed4d, 0x33ee4d, 0x33ef4d, 0x33f04d, 0x33f14d, 0x33f24d, 0x33f34d, 0x33f44d, 0x33f54d,
+    0x33f64d, 0x33f74d, 0x33f84d, 0x33f94d, 0x33fa4d, 0x33fb4d, 0x33fc4d, 0x33fd4d, 0x33fe4d, 0x33ff4d,
+    0x340056, 0xa48d58, 0xa49056, 0xa4c758, 0xa4d056, 0xa62c58, 0xa6404d, 0xa64156, 0xa6424d, 0xa64356,
+    0xa6444d, 0xa64556, 0xa6464d, 0xa64756, 0xa6484d, 0xa64956, 0xa64a4d, 0xa64b56, 0xa64c4d, 0xa64d56,
+    0xa64e4d, 0xa64f56, 0xa6504d, 0xa65156, 0xa6524d, 0xa65356, 0xa6544d, 0xa65556, 0xa6564d, 0xa65756,
+    0xa6584d, 0xa65956, 0xa65a4d, 0xa65b56, 0xa65c4d, 0xa65d56, 0xa65e4d, 0xa65f56, 0xa6604d, 0xa66156,
+    0xa6624d, 0xa66356, 0xa6644d, 0xa66556, 0xa6664d, 0xa66756, 0xa6684d, 0xa66956, 0xa66a4d, 0xa66b56,
+    0xa66c4d, 0xa66d56, 0xa6804d, 0xa68156, 0xa6824d, 0xa68356, 0xa6844d, 0xa68556, 0xa6864d, 0xa68756,
+    0xa6884d, 0xa68956, 0xa68a4d, 0xa68b56, 0xa68c4d, 0xa68d56, 0xa68e4d, 0xa68f56, 0xa6904d, 0xa69156,
+    0xa6924d, 0xa69356, 0xa6944d, 0xa69556, 0xa6964d, 0xa69756, 0xa6984d, 0xa69956, 0xa69a4d, 0xa69b56,
+    0xa69c4d, 0xa69d4d, 0xa69e56, 0xa6f858, 0xa70056, 0xa7224d, 0xa72356, 0xa7244d, 0xa72556, 0xa7264d,
+    0xa72756, 0xa7284d, 0xa72956, 0xa72a4d, 0xa72b56, 0xa72c4d, 0xa72d56, 0xa72e4d, 0xa72f56, 0xa7324d,
+    0xa73356, 0xa7344d, 0xa73556, 0xa7364d, 0xa73756, 0xa7384d, 0xa73956, 0xa73a4d, 0xa73b56, 0xa73c4d,
+    0xa73d56, 0xa73e4d, 0xa73f56, 0xa7404d, 0xa74156, 0xa7424d, 0xa74356, 0xa7444d, 0xa74556, 0xa7464d,
+    0xa74756, 0xa7484d, 0xa74956, 0xa74a4d, 0xa74b56, 0xa74c4d, 0xa74d56, 0xa74e4d, 0xa74f56, 0xa7504d,
+    0xa75156, 0xa7524d, 0xa75356, 0xa7544d, 0xa75556, 0xa7564d, 0xa75756, 0xa7584d, 0xa75956, 0xa75a4d,
+    0xa75b56, 0xa75c4d, 0xa75d56, 0xa75e4d, 0xa75f56, 0xa7604d, 0xa76156, 0xa7624d, 0xa76356, 0xa7644d,
+    0xa76556, 0xa7664d, 0xa76756, 0xa7684d, 0xa76956, 0xa76a4d, 0xa76b56, 0xa76c4d, 0xa76d56, 0xa76e4d,
+    0xa76f56, 0xa7704d, 0xa77156, 0xa7794d, 0xa77a56, 0xa77b4d, 0xa77c56, 0xa77d4d, 0xa77e4d, 0xa77f56,
+    0xa7804d, 0xa78156, 0xa7824d, 0xa78356, 0xa7844d, 0xa78556, 0xa7864d, 0xa78756, 0xa78b4d, 0xa78c56,
+    0xa78d4d, 0xa78e56, 0xa7904d, 0xa79156, 0xa7924d, 0xa79356, 0xa7964d, 0xa79756, 0xa7984d, 0xa79956,
+    0xa79a4d, 0xa79b56, 0xa79c4d, 0xa79d56, 0xa79e4d, 0xa79f56, 0xa7a04d, 0xa7a156, 0xa7a24d, 0xa7a356,
+    0xa7a44d, 0xa7a556, 0xa7a64d, 0xa7a756, 0xa7a84d, 0xa7a956, 0xa7aa4d, 0xa7ab4d, 0xa7ac4d, 0xa7ad4d,
+    0xa7ae4d, 0xa7af56, 0xa7b04d, 0xa7b14d, 0xa7b24d, 0xa7b34d, 0xa7b44d, 0xa7b556, 0xa7b64d, 0xa7b756,
+    0xa7b84d, 0xa7b956, 0xa7ba4d, 0xa7bb56, 0xa7bc4d, 0xa7bd56, 0xa7be4d, 0xa7bf56, 0xa7c04d, 0xa7c156,
+    0xa7c24d, 0xa7c356, 0xa7c44d, 0xa7c54d, 0xa7c64d, 0xa7c74d, 0xa7c856, 0xa7c94d, 0xa7ca56, 0xa7cb58,
+    0xa7d04d, 0xa7d156, 0xa7d258, 0xa7d356, 0xa7d458, 0xa7d556, 0xa7d64d, 0xa7d756, 0xa7d84d, 0xa7d956,
+    0xa7da58, 0xa7f24d, 0xa7f34d, 0xa7f44d, 0xa7f54d, 0xa7f656, 0xa7f84d, 0xa7f94d, 0xa7fa56, 0xa82d58,
+    0xa83056, 0xa83a58, 0xa84056, 0xa87858, 0xa88056, 0xa8c658, 0xa8ce56, 0xa8da58, 0xa8e056, 0xa95458,
+    0xa95f56, 0xa97d58, 0xa98056, 0xa9ce58, 0xa9cf56, 0xa9da58, 0xa9de56, 0xa9ff58, 0xaa0056, 0xaa3758,
+    0xaa4056, 0xaa4e58, 0xaa5056, 0xaa5a58, 0xaa5c56, 0xaac358, 0xaadb56, 0xaaf758, 0xab0156, 0xab0758,
+    0xab0956, 0xab0f58, 0xab1156, 0xab1758, 0xab2056, 0xab2758, 0xab2856, 0xab2f58, 0xab3056, 0xab5c4d,
+    0xab5d4d, 0xab5e4d, 0xab5f4d, 0xab6056, 0xab694d, 0xab6a56, 0xab6c58, 0xab704d, 0xab714d, 0xab724d,
+    0xab734d, 0xab744d, 0xab754d, 0xab764d, 0xab774d, 0xab784d, 0xab794d, 0xab7a4d, 0xab7b4d, 0xab7c4d,
+    0xab7d4d, 0xab7e4d, 0xab7f4d, 0xab804d, 0xab814d, 0xab824d, 0xab834d, 0xab844d, 0xab854d, 0xab864d,
+    0xab874d, 0xab884d, 0xab894d, 0xab8a4d, 0xab8b4d, 0xab8c4d, 0xab8d4d, 0xab8e4d, 0xab8f4d, 0xab904d,
+    0xab914d, 0xab924d, 0xab934d, 0xab944d, 0xab954d, 0xab964d, 0xab974d, 0xab984d, 0xab994d, 0xab9a4d,
+    0xab9b4d, 0xab9c4d, 0xab9d4d, 0xab9e4d, 0xab9f4d, 0xaba04d, 0xaba14d, 0xaba24d, 0xaba34d, 0xaba44d,
+    0xaba54d, 0xaba64d, 0xaba74d, 0xaba84d, 0xaba94d, 0xabaa4d, 0xabab4d, 0xabac4d, 0xabad4d, 0xabae4d,
+    0xabaf4d, 0xabb04d, 0xabb14d, 0xabb24d, 0xabb34d, 0xabb44d, 0xabb54d, 0xabb64d, 0xabb74d, 0xabb84d,
+    0xabb94d, 0xabba4d, 0xabbb4d, 0xabbc4d, 0xabbd4d, 0xabbe4d, 0xabbf4d, 0xabc056, 0xabee58, 0xabf056,
+    0xabfa58, 0xac0056, 0xd7a458, 0xd7b056, 0xd7c758, 0xd7cb56, 0xd7fc58, 0xf9004d, 0xf9014d, 0xf9024d,
+    0xf9034d, 0xf9044d, 0xf9054d, 0xf9064d, 0xf9074d, 0xf9094d, 0xf90a4d, 0xf90b4d, 0xf90c4d, 0xf90d4d,
+    0xf90e4d, 0xf90f4d, 0xf9104d, 0xf9114d, 0xf9124d, 0xf9134d, 0xf9144d, 0xf9154d, 0xf9164d, 0xf9174d,
+    0xf9184d, 0xf9194d, 0xf91a4d, 0xf91b4d, 0xf91c4d, 0xf91d4d, 0xf91e4d, 0xf91f4d, 0xf9204d, 0xf9214d,
+    0xf9224d, 0xf9234d, 0xf9244d, 0xf9254d, 0xf9264d, 0xf9274d, 0xf9284d, 0xf9294d, 0xf92a4d, 0xf92b4d,
+    0xf92c4d, 0xf92d4d, 0xf92e4d, 0xf92f4d, 0xf9304d, 0xf9314d, 0xf9324d, 0xf9334d, 0xf9344d, 0xf9354d,
+    0xf9364d, 0xf9374d, 0xf9384d, 0xf9394d, 0xf93a4d, 0xf93b4d, 0xf93c4d, 0xf93d4d, 0xf93e4d, 0xf93f4d,
+    0xf9404d, 0xf9414d, 0xf9424d, 0xf9434d, 0xf9444d, 0xf9454d, 0xf9464d, 0xf9474d, 0xf9484d, 0xf9494d,
+    0xf94a4d, 0xf94b4d, 0xf94c4d, 0xf94d4d, 0xf94e4d, 0xf94f4d, 0xf9504d, 0xf9514d, 0xf9524d, 0xf9534d,
+    0xf9544d, 0xf9554d, 0xf9564d, 0xf9574d, 0xf9584d, 0xf9594d, 0xf95a4d, 0xf95b4d, 0xf95c4d, 0xf95d4d,
+    0xf95e4d, 0xf95f4d, 0xf9604d, 0xf9614d, 0xf9624d, 0xf9634d, 0xf9644d, 0xf9654d, 0xf9664d, 0xf9674d,
+    0xf9684d, 0xf9694d, 0xf96a4d, 0xf96b4d, 0xf96c4d, 0xf96d4d, 0xf96e4d, 0xf96f4d, 0xf9704d, 0xf9714d,
+    0xf9724d, 0xf9734d, 0xf9744d, 0xf9754d, 0xf9764d, 0xf9774d, 0xf9784d, 0xf9794d, 0xf97a4d, 0xf97b4d,
+    0xf97c4d, 0xf97d4d, 0xf97e4d, 0xf97f4d, 0xf9804d, 0xf9814d, 0xf9824d, 0xf9834d, 0xf9844d, 0xf9854d,
+    0xf9864d, 0xf9874d, 0xf9884d, 0xf9894d, 0xf98a4d, 0xf98b4d, 0xf98c4d, 0xf98d4d, 0xf98e4d, 0xf98f4d,
+    0xf9904d, 0xf9914d, 0xf9924d, 0xf9934d, 0xf9944d, 0xf9954d, 0xf9964d, 0xf9974d, 0xf9984d, 0xf9994d,
+    0xf99a4d, 0xf99b4d, 0xf99c4d, 0xf99d4d, 0xf99e4d, 0xf99f4d, 0xf9a04d, 0xf9a14d, 0xf9a24d, 0xf9a34d,
+    0xf9a44d, 0xf9a54d, 0xf9a64d, 0xf9a74d, 0xf9a84d, 0xf9a94d, 0xf9aa4d, 0xf9ab4d, 0xf9ac4d, 0xf9ad4d,
+    0xf9ae4d, 0xf9af4d, 0xf9b04d, 0xf9b14d, 0xf9b24d, 0xf9b34d, 0xf9b44d, 0xf9b54d, 0xf9b64d, 0xf9b74d,
+    0xf9b84d, 0xf9b94d, 0xf9ba4d, 0xf9bb4d, 0xf9bc4d, 0xf9bd4d, 0xf9be4d, 0xf9bf4d, 0xf9c04d, 0xf9c14d,
+    0xf9c24d, 0xf9c34d, 0xf9c44d, 0xf9c54d, 0xf9c64d, 0xf9c74d, 0xf9c84d, 0xf9c94d, 0xf9ca4d, 0xf9cb4d,
+    0xf9cc4d, 0xf9cd4d, 0xf9ce4d, 0xf9cf4d, 0xf9d04d, 0xf9d14d, 0xf9d24d, 0xf9d34d, 0xf9d44d, 0xf9d54d,
+    0xf9d64d, 0xf9d74d, 0xf9d84d, 0xf9d94d, 0xf9da4d, 0xf9db4d, 0xf9dc4d, 0xf9dd4d, 0xf9de4d, 0xf9df4d,
+    0xf9e04d, 0xf9e14d, 0xf9e24d, 0xf9e34d, 0xf9e44d, 0xf9e54d, 0xf9e64d, 0xf9e74d, 0xf9e84d, 0xf9e94d,
+    0xf9ea4d, 0xf9eb4d, 0xf9ec4d, 0xf9ed4d, 0xf9ee4d, 0xf9ef4d, 0xf9f04d, 0xf9f14d, 0xf9f24d, 0xf9f34d,
+    0xf9f44d, 0xf9f54d, 0xf9f64d, 0xf9f74d, 0xf9f84d, 0xf9f94d, 0xf9fa4d, 0xf9fb4d, 0xf9fc4d, 0xf9fd4d,
+    0xf9fe4d, 0xf9ff4d, 0xfa004d, 0xfa014d, 0xfa024d, 0xfa034d, 0xfa044d, 0xfa054d, 0xfa064d, 0xfa074d,
+    0xfa084d, 0xfa094d, 0xfa0a4d, 0xfa0b4d, 0xfa0c4d, 0xfa0d4d, 0xfa0e56, 0xfa104d, 0xfa1156, 0xfa124d,
+    0xfa1356, 0xfa154d, 0xfa164d, 0xfa174d, 0xfa184d, 0xfa194d, 0xfa1a4d, 0xfa1b4d, 0xfa1c4d, 0xfa1d4d,
+    0xfa1e4d, 0xfa1f56, 0xfa204d, 0xfa2156, 0xfa224d, 0xfa2356, 0xfa254d, 0xfa264d, 0xfa2756, 0xfa2a4d,
+    0xfa2b4d, 0xfa2c4d, 0xfa2d4d, 0xfa2e4d, 0xfa2f4d, 0xfa304d, 0xfa314d, 0xfa324d, 0xfa334d, 0xfa344d,
+    0xfa354d, 0xfa364d, 0xfa374d, 0xfa384d, 0xfa394d, 0xfa3a4d, 0xfa3b4d, 0xfa3c4d, 0xfa3d4d, 0xfa3e4d,
+    0xfa3f4d, 0xfa404d, 0xfa414d, 0xfa424d, 0xfa434d, 0xfa444d, 0xfa454d, 0xfa464d, 0xfa474d, 0xfa484d,
+    0xfa494d, 0xfa4a4d, 0xfa4b4d, 0xfa4c4d, 0xfa4d4d, 0xfa4e4d, 0xfa4f4d, 0xfa504d, 0xfa514d, 0xfa524d,
+    0xfa534d, 0xfa544d, 0xfa554d, 0xfa564d, 0xfa574d, 0xfa584d, 0xfa594d, 0xfa5a4d, 0xfa5b4d, 0xfa5c4d,
+    0xfa5d4d, 0xfa5f4d, 0xfa604d, 0xfa614d, 0xfa624d, 0xfa634d, 0xfa644d, 0xfa654d, 0xfa664d, 0xfa674d,
+    0xfa684d, 0xfa694d, 0xfa6a4d, 0xfa6b4d, 0xfa6c4d, 0xfa6d4d, 0xfa6e58, 0xfa704d, 0xfa714d, 0xfa724d,
+    0xfa734d, 0xfa744d, 0xfa754d, 0xfa764d, 0xfa774d, 0xfa784d, 0xfa794d, 0xfa7a4d, 0xfa7b4d, 0xfa7c4d,
+    0xfa7d4d, 0xfa7e4d, 0xfa7f4d, 0xfa804d, 0xfa814d, 0xfa824d, 0xfa834d, 0xfa844d, 0xfa854d, 0xfa864d,
+    0xfa874d, 0xfa884d, 0xfa894d, 0xfa8a4d, 0xfa8b4d, 0xfa8c4d, 0xfa8d4d, 0xfa8e4d, 0xfa8f4d, 0xfa904d,
+    0xfa914d, 0xfa924d, 0xfa934d, 0xfa944d, 0xfa954d, 0xfa964d, 0xfa974d, 0xfa984d, 0xfa994d, 0xfa9a4d,
+    0xfa9b4d, 0xfa9c4d, 0xfa9d4d, 0xfa9e4d, 0xfa9f4d, 0xfaa04d, 0xfaa14d, 0xfaa24d, 0xfaa34d, 0xfaa44d,
+    0xfaa54d, 0xfaa64d, 0xfaa74d, 0xfaa84d, 0xfaa94d, 0xfaaa4d, 0xfaab4d, 0xfaac4d, 0xfaad4d, 0xfaae4d,
+    0xfaaf4d, 0xfab04d, 0xfab14d, 0xfab24d, 0xfab34d, 0xfab44d, 0xfab54d, 0xfab64d, 0xfab74d, 0xfab84d,
+    0xfab94d, 0xfaba4d, 0xfabb4d, 0xfabc4d, 0xfabd4d, 0xfabe4d, 0xfabf4d, 0xfac04d, 0xfac14d, 0xfac24d,
+    0xfac34d, 0xfac44d, 0xfac54d, 0xfac64d, 0xfac74d, 0xfac84d, 0xfac94d, 0xfaca4d, 0xfacb4d, 0xfacc4d,
+    0xfacd4d, 0xface4d, 0xfacf4d, 0xfad04d, 0xfad14d, 0xfad24d, 0xfad34d, 0xfad44d, 0xfad54d, 0xfad64d,
+    0xfad74d, 0xfad84d, 0xfad94d, 0xfada58, 0xfb004d, 0xfb014d, 0xfb024d, 0xfb034d, 0xfb044d, 0xfb054d,
+    0xfb0758, 0xfb134d, 0xfb144d, 0xfb154d, 0xfb164d, 0xfb174d, 0xfb1858, 0xfb1d4d, 0xfb1e56, 0xfb1f4d,
+    0xfb204d, 0xfb214d, 0xfb224d, 0xfb234d, 0xfb244d, 0xfb254d, 0xfb264d, 0xfb274d, 0xfb284d, 0xfb2933,
+    0xfb2a4d, 0xfb2b4d, 0xfb2c4d, 0xfb2d4d, 0xfb2e4d, 0xfb2f4d, 0xfb304d, 0xfb314d, 0xfb324d, 0xfb334d,
+    0xfb344d, 0xfb354d, 0xfb364d, 0xfb3758, 0xfb384d, 0xfb394d, 0xfb3a4d, 0xfb3b4d, 0xfb3c4d, 0xfb3d58,
+    0xfb3e4d, 0xfb3f58, 0xfb404d, 0xfb414d, 0xfb4258, 0xfb434d, 0xfb444d, 0xfb4558, 0xfb464d, 0xfb474d,
+    0xfb484d, 0xfb494d, 0xfb4a4d, 0xfb4b4d, 0xfb4c4d, 0xfb4d4d, 0xfb4e4d, 0xfb4f4d, 0xfb504d, 0xfb524d,
+    0xfb564d, 0xfb5a4d, 0xfb5e4d, 0xfb624d, 0xfb664d, 0xfb6a4d, 0xfb6e4d, 0xfb724d, 0xfb764d, 0xfb7a4d,
+    0xfb7e4d, 0xfb824d, 0xfb844d, 0xfb864d, 0xfb884d, 0xfb8a4d, 0xfb8c4d, 0xfb8e4d, 0xfb924d, 0xfb964d,
+    0xfb9a4d, 0xfb9e4d, 0xfba04d, 0xfba44d, 0xfba64d, 0xfbaa4d, 0xfbae4d, 0xfbb04d, 0xfbb256, 0xfbc358,
+    0xfbd34d, 0xfbd74d, 0xfbd94d, 0xfbdb4d, 0xfbdd4d, 0xfbde4d, 0xfbe04d, 0xfbe24d, 0xfbe44d, 0xfbe84d,
+    0xfbea4d, 0xfbec4d, 0xfbee4d, 0xfbf04d, 0xfbf24d, 0xfbf44d, 0xfbf64d, 0xfbf94d, 0xfbfc4d, 0xfc004d,
+    0xfc014d, 0xfc024d, 0xfc034d, 0xfc044d, 0xfc054d, 0xfc064d, 0xfc074d, 0xfc084d, 0xfc094d, 0xfc0a4d,
+    0xfc0b4d, 0xfc0c4d, 0xfc0d4d, 0xfc0e4d, 0xfc0f4d, 0xfc104d, 0xfc114d, 0xfc124d, 0xfc134d, 0xfc144d,
+    0xfc154d, 0xfc164d, 0xfc174d, 0xfc184d, 0xfc194d, 0xfc1a4d, 0xfc1b4d, 0xfc1c4d, 0xfc1d4d, 0xfc1e4d,
+    0xfc1f4d, 0xfc204d, 0xfc214d, 0xfc224d, 0xfc234d, 0xfc244d, 0xfc254d, 0xfc264d, 0xfc274d, 0xfc284d,
+    0xfc294d, 0xfc2a4d, 0xfc2b4d, 0xfc2c4d, 0xfc2d4d, 0xfc2e4d, 0xfc2f4d, 0xfc304d, 0xfc314d, 0xfc324d,
+    0xfc334d, 0xfc344d, 0xfc354d, 0xfc364d, 0xfc374d, 0xfc384d, 0xfc394d, 0xfc3a4d, 0xfc3b4d, 0xfc3c4d,
+    0xfc3d4d, 0xfc3e4d, 0xfc3f4d, 0xfc404d, 0xfc414d, 0xfc424d, 0xfc434d, 0xfc444d, 0xfc454d, 0xfc464d,
+    0xfc474d, 0xfc484d, 0xfc494d, 0xfc4a4d, 0xfc4b4d, 0xfc4c4d, 0xfc4d4d, 0xfc4e4d, 0xfc4f4d, 0xfc504d,
+    0xfc514d, 0xfc524d, 0xfc534d, 0xfc544d, 0xfc554d, 0xfc564d, 0xfc574d, 0xfc584d, 0xfc594d, 0xfc5a4d,
+    0xfc5b4d, 0xfc5c4d, 0xfc5d4d, 0xfc5e33, 0xfc5f33, 0xfc6033, 0xfc6133, 0xfc6233, 0xfc6333, 0xfc644d,
+    0xfc654d, 0xfc664d, 0xfc674d, 0xfc684d, 0xfc694d, 0xfc6a4d, 0xfc6b4d, 0xfc6c4d, 0xfc6d4d, 0xfc6e4d,
+    0xfc6f4d, 0xfc704d, 0xfc714d, 0xfc724d, 0xfc734d, 0xfc744d, 0xfc754d, 0xfc764d, 0xfc774d, 0xfc784d,
+    0xfc794d, 0xfc7a4d, 0xfc7b4d, 0xfc7c4d, 0xfc7d4d, 0xfc7e4d, 0xfc7f4d, 0xfc804d, 0xfc814d, 0xfc824d,
+    0xfc834d, 0xfc844d, 0xfc854d, 0xfc864d, 0xfc874d, 0xfc884d, 0xfc894d, 0xfc8a4d, 0xfc8b4d, 0xfc8c4d,
+    0xfc8d4d, 0xfc8e4d, 0xfc8f4d, 0xfc904d, 0xfc914d, 0xfc924d, 0xfc934d, 0xfc944d, 0xfc954d, 0xfc964d,
+    0xfc974d, 0xfc984d, 0xfc994d, 0xfc9a4d, 0xfc9b4d, 0xfc9c4d, 0xfc9d4d, 0xfc9e4d, 0xfc9f4d, 0xfca04d,
+    0xfca14d, 0xfca24d, 0xfca34d, 0xfca44d, 0xfca54d, 0xfca64d, 0xfca74d, 0xfca84d, 0xfca94d, 0xfcaa4d,
+    0xfcab4d, 0xfcac4d, 0xfcad4d, 0xfcae4d, 0xfcaf4d, 0xfcb04d, 0xfcb14d, 0xfcb24d, 0xfcb34d, 0xfcb44d,
+    0xfcb54d, 0xfcb64d, 0xfcb74d, 0xfcb84d, 0xfcb94d, 0xfcba4d, 0xfcbb4d, 0xfcbc4d, 0xfcbd4d, 0xfcbe4d,
+    0xfcbf4d, 0xfcc04d, 0xfcc14d, 0xfcc24d, 0xfcc34d, 0xfcc44d, 0xfcc54d, 0xfcc64d, 0xfcc74d, 0xfcc84d,
+    0xfcc94d, 0xfcca4d, 0xfccb4d, 0xfccc4d, 0xfccd4d, 0xfcce4d, 0xfccf4d, 0xfcd04d, 0xfcd14d, 0xfcd24d,
+    0xfcd34d, 0xfcd44d, 0xfcd54d, 0xfcd64d, 0xfcd74d, 0xfcd84d, 0xfcd94d, 0xfcda4d, 0xfcdb4d, 0xfcdc4d,
+    0xfcdd4d, 0xfcde4d, 0xfcdf4d, 0xfce04d, 0xfce14d, 0xfce24d, 0xfce34d, 0xfce44d, 0xfce54d, 0xfce64d,
+    0xfce74d, 0xfce84d, 0xfce94d, 0xfcea4d, 0xfceb4d, 0xfcec4d, 0xfced4d, 0xfcee4d, 0xfcef4d, 0xfcf04d,
+    0xfcf14d, 0xfcf24d, 0xfcf34d, 0xfcf44d, 0xfcf54d, 0xfcf64d, 0xfcf74d, 0xfcf84d, 0xfcf94d, 0xfcfa4d,
+    0xfcfb4d, 0xfcfc4d, 0xfcfd4d, 0xfcfe4d, 0xfcff4d, 0xfd004d, 0xfd014d, 0xfd024d, 0xfd034d, 0xfd044d,
+    0xfd054d, 0xfd064d, 0xfd074d, 0xfd084d, 0xfd094d, 0xfd0a4d, 0xfd0b4d, 0xfd0c4d, 0xfd0d4d, 0xfd0e4d,
+    0xfd0f4d, 0xfd104d, 0xfd114d, 0xfd124d, 0xfd134d, 0xfd144d, 0xfd154d, 0xfd164d, 0xfd174d, 0xfd184d,
+    0xfd194d, 0xfd1a4d, 0xfd1b4d, 0xfd1c4d, 0xfd1d4d, 0xfd1e4d, 0xfd1f4d, 0xfd204d, 0xfd214d, 0xfd224d,
+    0xfd234d, 0xfd244d, 0xfd254d, 0xfd264d, 0xfd274d, 0xfd284d, 0xfd294d, 0xfd2a4d, 0xfd2b4d, 0xfd2c4d,
+    0xfd2d4d, 0xfd2e4d, 0xfd2f4d, 0xfd304d, 0xfd314d, 0xfd324d, 0xfd334d, 0xfd344d, 0xfd354d, 0xfd364d,
+    0xfd374d, 0xfd384d, 0xfd394d, 0xfd3a4d, 0xfd3b4d, 0xfd3c4d, 0xfd3e56, 0xfd504d, 0xfd514d, 0xfd534d,
+    0xfd544d, 0xfd554d, 0xfd564d, 0xfd574d, 0xfd584d, 0xfd5a4d, 0xfd5b4d, 0xfd5c4d, 0xfd5d4d, 0xfd5e4d,
+    0xfd5f4d, 0xfd614d, 0xfd624d, 0xfd644d, 0xfd664d, 0xfd674d, 0xfd694d, 0xfd6a4d, 0xfd6c4d, 0xfd6e4d,
+    0xfd6f4d, 0xfd714d, 0xfd734d, 0xfd744d, 0xfd754d, 0xfd764d, 0xfd784d, 0xfd794d, 0xfd7a4d, 0xfd7b4d,
+    0xfd7c4d, 0xfd7e4d, 0xfd7f4d, 0xfd804d, 0xfd814d, 0xfd824d, 0xfd834d, 0xfd854d, 0xfd874d, 0xfd894d,
+    0xfd8a4d, 0xfd8b4d, 0xfd8c4d, 0xfd8d4d, 0xfd8e4d, 0xfd8f4d, 0xfd9058, 0xfd924d, 0xfd934d, 0xfd944d,
+    0xfd954d, 0xfd964d, 0xfd974d, 0xfd994d, 0xfd9a4d, 0xfd9b4d, 0xfd9c4d, 0xfd9e4d, 0xfd9f4d, 0xfda04d,
+    0xfda14d, 0xfda24d, 0xfda34d, 0xfda44d, 0xfda54d, 0xfda64d, 0xfda74d, 0xfda84d, 0xfda94d, 0xfdaa4d,
+    0xfdab4d, 0xfdac4d, 0xfdad4d, 0xfdae4d, 0xfdaf4d, 0xfdb04d, 0xfdb14d, 0xfdb24d, 0xfdb34d, 0xfdb44d,
+    0xfdb54d, 0xfdb64d, 0xfdb74d, 0xfdb84d, 0xfdb94d, 0xfdba4d, 0xfdbb4d, 0xfdbc4d, 0xfdbd4d, 0xfdbe4d,
+    0xfdbf4d, 0xfdc04d, 0xfdc14d, 0xfdc24d, 0xfdc34d, 0xfdc44d, 0xfdc54d, 0xfdc64d, 0xfdc74d, 0xfdc858,
+    0xfdcf56, 0xfdd058, 0xfdf04d, 0xfdf14d, 0xfdf24d, 0xfdf34d, 0xfdf44d, 0xfdf54d, 0xfdf64d, 0xfdf74d,
+    0xfdf84d, 0xfdf94d, 0xfdfa33, 0xfdfb33, 0xfdfc4d, 0xfdfd56, 0xfe0049, 0xfe1033, 0xfe114d, 0xfe1258,
+    0xfe1333, 0xfe1433, 0xfe1533, 0xfe1633, 0xfe174d, 0xfe184d, 0xfe1958, 0xfe2056, 0xfe3058, 0xfe314d,
+    0xfe324d, 0xfe3333, 0xfe3533, 0xfe3633, 0xfe3733, 0xfe3833, 0xfe394d, 0xfe3a4d, 0xfe3b4d, 0xfe3c4d,
+    0xfe3d4d, 0xfe3e4d, 0xfe3f4d, 0xfe404d, 0xfe414d, 0xfe424d, 0xfe434d, 0xfe444d, 0xfe4556, 0xfe4733,
+    0xfe4833, 0xfe4933, 0xfe4d33, 0xfe5033, 0xfe514d, 0xfe5258, 0xfe5433, 0xfe5533, 0xfe5633, 0xfe5733,
+    0xfe584d, 0xfe5933, 0xfe5a33, 0xfe5b33, 0xfe5c33, 0xfe5d4d, 0xfe5e4d, 0xfe5f33, 0xfe6033, 0xfe6133,
+    0xfe6233, 0xfe634d, 0xfe6433, 0xfe6533, 0xfe6633, 0xfe6758, 0xfe6833, 0xfe6933, 0xfe6a33, 0xfe6b33,
+    0xfe6c58, 0xfe7033, 0xfe714d, 0xfe7233, 0xfe7356, 0xfe7433, 0xfe7558, 0xfe7633, 0xfe774d, 0xfe7833,
+    0xfe794d, 0xfe7a33, 0xfe7b4d, 0xfe7c33, 0xfe7d4d, 0xfe7e33, 0xfe7f4d, 0xfe804d, 0xfe814d, 0xfe834d,
+    0xfe854d, 0xfe874d, 0xfe894d, 0xfe8d4d, 0xfe8f4d, 0xfe934d, 0xfe954d, 0xfe994d, 0xfe9d4d, 0xfea14d,
+    0xfea54d, 0xfea94d, 0xfeab4d, 0xfead4d, 0xfeaf4d, 0xfeb14d, 0xfeb54d, 0xfeb94d, 0xfebd4d, 0xfec14d,
+    0xfec54d, 0xfec94d, 0xfecd4d, 0xfed14d, 0xfed54d, 0xfed94d, 0xfedd4d, 0xfee14d, 0xfee54d, 0xfee94d,
+    0xfeed4d, 0xfeef4d, 0xfef14d, 0xfef54d, 0xfef74d, 0xfef94d, 0xfefb4d, 0xfefd58, 0xfeff49, 0xff0058,
+    0xff0133, 0xff0233, 0xff0333, 0xff0433, 0xff0533, 0xff0633, 0xff0733, 0xff0833, 0xff0933, 0xff0a33,
+    0xff0b33, 0xff0c33, 0xff0d4d, 0xff0e4d, 0xff0f33, 0xff104d, 0xff114d, 0xff124d, 0xff134d, 0xff144d,
+    0xff154d, 0xff164d, 0xff174d, 0xff184d, 0xff194d, 0xff1a33, 0xff1b33, 0xff1c33, 0xff1d33, 0xff1e33,
+    0xff1f33, 0xff2033, 0xff214d, 0xff224d, 0xff234d, 0xff244d, 0xff254d, 0xff264d, 0xff274d, 0xff284d,
+    0xff294d, 0xff2a4d, 0xff2b4d, 0xff2c4d, 0xff2d4d, 0xff2e4d, 0xff2f4d, 0xff304d, 0xff314d, 0xff324d,
+    0xff334d, 0xff344d, 0xff354d, 0xff364d, 0xff374d, 0xff384d, 0xff394d, 0xff3a4d, 0xff3b33, 0xff3c33,
+    0xff3d33, 0xff3e33, 0xff3f33, 0xff4033, 0xff414d, 0xff424d, 0xff434d, 0xff444d, 0xff454d, 0xff464d,
+    0xff474d, 0xff484d, 0xff494d, 0xff4a4d, 0xff4b4d, 0xff4c4d, 0xff4d4d, 0xff4e4d, 0xff4f4d, 0xff504d,
+    0xff514d, 0xff524d, 0xff534d, 0xff544d, 0xff554d, 0xff564d, 0xff574d, 0xff584d, 0xff594d, 0xff5a4d,
+    0xff5b33, 0xff5c33, 0xff5d33, 0xff5e33, 0xff5f4d, 0xff604d, 0xff614d, 0xff624d, 0xff634d, 0xff644d,
+    0xff654d, 0xff664d, 0xff674d, 0xff684d, 0xff694d, 0xff6a4d, 0xff6b4d, 0xff6c4d, 0xff6d4d, 0xff6e4d,
+    0xff6f4d, 0xff704d, 0xff714d, 0xff724d, 0xff734d, 0xff744d, 0xff754d, 0xff764d, 0xff774d, 0xff784d,
+    0xff794d, 0xff7a4d, 0xff7b4d, 0xff7c4d, 0xff7d4d, 0xff7e4d, 0xff7f4d, 0xff804d, 0xff814d, 0xff824d,
+    0xff834d, 0xff844d, 0xff854d, 0xff864d, 0xff874d, 0xff884d, 0xff894d, 0xff8a4d, 0xff8b4d, 0xff8c4d,
+    0xff8d4d, 0xff8e4d, 0xff8f4d, 0xff904d, 0xff914d, 0xff924d, 0xff934d, 0xff944d, 0xff954d, 0xff964d,
+    0xff974d, 0xff984d, 0xff994d, 0xff9a4d, 0xff9b4d, 0xff9c4d, 0xff9d4d, 0xff9e4d, 0xff9f4d, 0xffa058,
+    0xffa14d, 0xffa24d, 0xffa34d, 0xffa44d, 0xffa54d, 0xffa64d, 0xffa74d, 0xffa84d, 0xffa94d, 0xffaa4d,
+    0xffab4d, 0xffac4d, 0xffad4d, 0xffae4d, 0xffaf4d, 0xffb04d, 0xffb14d, 0xffb24d, 0xffb34d, 0xffb44d,
+    0xffb54d, 0xffb64d, 0xffb74d, 0xffb84d, 0xffb94d, 0xffba4d, 0xffbb4d, 0xffbc4d, 0xffbd4d, 0xffbe4d,
+    0xffbf58, 0xffc24d, 0xffc34d, 0xffc44d, 0xffc54d, 0xffc64d, 0xffc74d, 0xffc858, 0xffca4d, 0xffcb4d,
+    0xffcc4d, 0xffcd4d, 0xffce4d, 0xffcf4d, 0xffd058, 0xffd24d, 0xffd34d, 0xffd44d, 0xffd54d, 0xffd64d,
+    0xffd74d, 0xffd858, 0xffda4d, 0xffdb4d, 0xffdc4d, 0xffdd58, 0xffe04d, 0xffe14d, 0xffe24d, 0xffe333,
+    0xffe44d, 0xffe54d, 0xffe64d, 0xffe758, 0xffe84d, 0xffe94d, 0xffea4d, 0xffeb4d, 0xffec4d, 0xffed4d,
+    0xffee4d, 0xffef58, 0x1000056, 0x1000c58, 0x1000d56, 0x1002758, 0x1002856, 0x1003b58, 0x1003c56, 0x1003e58,
+    0x1003f56, 0x1004e58, 0x1005056, 0x1005e58, 0x1008056, 0x100fb58, 0x1010056, 0x1010358, 0x1010756, 0x1013458,
+    0x1013756, 0x1018f58, 0x1019056, 0x1019d58, 0x101a056, 0x101a158, 0x101d056, 0x101fe58, 0x1028056, 0x1029d58,
+    0x102a056, 0x102d158, 0x102e056, 0x102fc58, 0x1030056, 0x1032458, 0x1032d56, 0x1034b58, 0x1035056, 0x1037b58,
+    0x1038056, 0x1039e58, 0x1039f56, 0x103c458, 0x103c856, 0x103d658, 0x104004d, 0x104014d, 0x104024d, 0x104034d,
+    0x104044d, 0x104054d, 0x104064d, 0x104074d, 0x104084d, 0x104094d, 0x1040a4d, 0x1040b4d, 0x1040c4d, 0x1040d4d,
+    0x1040e4d, 0x1040f4d, 0x104104d, 0x104114d, 0x104124d, 0x104134d, 0x104144d, 0x104154d, 0x104164d, 0x104174d,
+    0x104184d, 0x104194d, 0x1041a4d, 0x1041b4d, 0x1041c4d, 0x1041d4d, 0x1041e4d, 0x1041f4d, 0x104204d, 0x104214d,
+    0x104224d, 0x104234d, 0x104244d, 0x104254d, 0x104264d, 0x104274d, 0x1042856, 0x1049e58, 0x104a056, 0x104aa58,
+    0x104b04d, 0x104b14d, 0x104b24d, 0x104b34d, 0x104b44d, 0x104b54d, 0x104b64d, 0x104b74d, 0x104b84d, 0x104b94d,
+    0x104ba4d, 0x104bb4d, 0x104bc4d, 0x104bd4d, 0x104be4d, 0x104bf4d, 0x104c04d, 0x104c14d, 0x104c24d, 0x104c34d,
+    0x104c44d, 0x104c54d, 0x104c64d, 0x104c74d, 0x104c84d, 0x104c94d, 0x104ca4d, 0x104cb4d, 0x104cc4d, 0x104cd4d,
+    0x104ce4d, 0x104cf4d, 0x104d04d, 0x104d14d, 0x104d24d, 0x104d34d, 0x104d458, 0x104d856, 0x104fc58, 0x1050056,
+    0x1052858, 0x1053056, 0x1056458, 0x1056f56, 0x105704d, 0x105714d, 0x105724d, 0x105734d, 0x105744d, 0x105754d,
+    0x105764d, 0x105774d, 0x105784d, 0x105794d, 0x1057a4d, 0x1057b58, 0x1057c4d, 0x1057d4d, 0x1057e4d, 0x1057f4d,
+    0x105804d, 0x105814d, 0x105824d, 0x105834d, 0x105844d, 0x105854d, 0x105864d, 0x105874d, 0x105884d, 0x105894d,
+    0x1058a4d, 0x1058b58, 0x1058c4d, 0x1058d4d, 0x1058e4d, 0x1058f4d, 0x105904d, 0x105914d, 0x105924d, 0x1059358,
+    0x105944d, 0x105954d, 0x1059658, 0x1059756, 0x105a258, 0x105a356, 0x105b258, 0x105b356, 0x105ba58, 0x105bb56,
+    0x105bd58, 0x1060056, 0x1073758, 0x1074056, 0x1075658, 0x1076056, 0x1076858, 0x1078056, 0x107814d, 0x107824d,
+    0x107834d, 0x107844d, 0x107854d, 0x1078658, 0x107874d, 0x107884d, 0x107894d, 0x1078a4d, 0x1078b4d, 0x1078c4d,
+    0x1078d4d, 0x1078e4d, 0x1078f4d, 0x107904d, 0x107914d, 0x107924d, 0x107934d, 0x107944d, 0x107954d, 0x107964d,
+    0x107974d, 0x107984d, 0x107994d, 0x1079a4d, 0x1079b4d, 0x1079c4d, 0x1079d4d, 0x1079e4d, 0x1079f4d, 0x107a04d,
+    0x107a14d, 0x107a24d, 0x107a34d, 0x107a44d, 0x107a54d, 0x107a64d, 0x107a74d, 0x107a84d, 0x107a94d, 0x107aa4d,
+    0x107ab4d, 0x107ac4d, 0x107ad4d, 0x107ae4d, 0x107af4d, 0x107b04d, 0x107b158, 0x107b24d, 0x107b34d, 0x107b44d,
+    0x107b54d, 0x107b64d, 0x107b74d, 0x107b84d, 0x107b94d, 0x107ba4d, 0x107bb58, 0x1080056, 0x1080658, 0x1080856,
+    0x1080958, 0x1080a56, 0x1083658, 0x1083756, 0x1083958, 0x1083c56, 0x1083d58, 0x1083f56, 0x1085658, 0x1085756,
+    0x1089f58, 0x108a756, 0x108b058, 0x108e056, 0x108f358, 0x108f456, 0x108f658, 0x108fb56, 0x1091c58, 0x1091f56,
+    0x1093a58, 0x1093f56, 0x1094058, 0x1098056, 0x109b858, 0x109bc56, 0x109d058, 0x109d256, 0x10a0458, 0x10a0556,
+    0x10a0758, 0x10a0c56, 0x10a1458, 0x10a1556, 0x10a1858, 0x10a1956, 0x10a3658, 0x10a3856, 0x10a3b58, 0x10a3f56,
+    0x10a4958, 0x10a5056, 0x10a5958, 0x10a6056, 0x10aa058, 0x10ac056, 0x10ae758, 0x10aeb56, 0x10af758, 0x10b0056,
+    0x10b3658, 0x10b3956, 0x10b5658, 0x10b5856, 0x10b7358, 0x10b7856, 0x10b9258, 0x10b9956, 0x10b9d58, 0x10ba956,
+    0x10bb058, 0x10c0056, 0x10c4958, 0x10c804d, 0x10c814d, 0x10c824d, 0x10c834d, 0x10c844d, 0x10c854d, 0x10c864d,
+    0x10c874d, 0x10c884d, 0x10c894d, 0x10c8a4d, 0x10c8b4d, 0x10c8c4d, 0x10c8d4d, 0x10c8e4d, 0x10c8f4d, 0x10c904d,
+    0x10c914d, 0x10c924d, 0x10c934d, 0x10c944d, 0x10c954d, 0x10c964d, 0x10c974d, 0x10c984d, 0x10c994d, 0x10c9a4d,
+    0x10c9b4d, 0x10c9c4d, 0x10c9d4d, 0x10c9e4d, 0x10c9f4d, 0x10ca04d, 0x10ca14d, 0x10ca24d, 0x10ca34d, 0x10ca44d,
+    0x10ca54d, 0x10ca64d, 0x10ca74d, 0x10ca84d, 0x10ca94d, 0x10caa4d, 0x10cab4d, 0x10cac4d, 0x10cad4d, 0x10cae4d,
+    0x10caf4d, 0x10cb04d, 0x10cb14d, 0x10cb24d, 0x10cb358, 0x10cc056, 0x10cf358, 0x10cfa56, 0x10d2858, 0x10d3056,
+    0x10d3a58, 0x10e6056, 0x10e7f58, 0x10e8056, 0x10eaa58, 0x10eab56, 0x10eae58, 0x10eb056, 0x10eb258, 0x10efd56,
+    0x10f2858, 0x10f3056, 0x10f5a58, 0x10f7056, 0x10f8a58, 0x10fb056, 0x10fcc58, 0x10fe056, 0x10ff758, 0x1100056,
+    0x1104e58, 0x1105256, 0x1107658, 0x1107f56, 0x110bd58, 0x110be56, 0x110c358, 0x110d056, 0x110e958, 0x110f056,
+    0x110fa58, 0x1110056, 0x1113558, 0x1113656, 0x1114858, 0x1115056, 0x1117758, 0x1118056, 0x111e058, 0x111e156,
+    0x111f558, 0x1120056, 0x1121258, 0x1121356, 0x1124258, 0x1128056, 0x1128758, 0x1128856, 0x1128958, 0x1128a56,
+    0x1128e58, 0x1128f56, 0x1129e58, 0x1129f56, 0x112aa58, 0x112b056, 0x112eb58, 0x112f056, 0x112fa58, 0x1130056,
+    0x1130458, 0x1130556, 0x1130d58, 0x1130f56, 0x1131158, 0x1131356, 0x1132958, 0x1132a56, 0x1133158, 0x1133256,
+    0x1133458, 0x1133556, 0x1133a58, 0x1133b56, 0x1134558, 0x1134756, 0x1134958, 0x1134b56, 0x1134e58, 0x1135056,
+    0x1135158, 0x1135756, 0x1135858, 0x1135d56, 0x1136458, 0x1136656, 0x1136d58, 0x1137056, 0x1137558, 0x1140056,
+    0x1145c58, 0x1145d56, 0x1146258, 0x1148056, 0x114c858, 0x114d056, 0x114da58, 0x1158056, 0x115b658, 0x115b856,
+    0x115de58, 0x1160056, 0x1164558, 0x1165056, 0x1165a58, 0x1166056, 0x1166d58, 0x1168056, 0x116ba58, 0x116c056,
+    0x116ca58, 0x1170056, 0x1171b58, 0x1171d56, 0x1172c58, 0x1173056, 0x1174758, 0x1180056, 0x1183c58, 0x118a04d,
+    0x118a14d, 0x118a24d, 0x118a34d, 0x118a44d, 0x118a54d, 0x118a64d, 0x118a74d, 0x118a84d, 0x118a94d, 0x118aa4d,
+    0x118ab4d, 0x118ac4d, 0x118ad4d, 0x118ae4d, 0x118af4d, 0x118b04d, 0x118b14d, 0x118b24d, 0x118b34d, 0x118b44d,
+    0x118b54d, 0x118b64d, 0x118b74d, 0x118b84d, 0x118b94d, 0x118ba4d, 0x118bb4d, 0x118bc4d, 0x118bd4d, 0x118be4d,
+    0x118bf4d, 0x118c056, 0x118f358, 0x118ff56, 0x1190758, 0x1190956, 0x1190a58, 0x1190c56, 0x1191458, 0x1191556,
+    0x1191758, 0x1191856, 0x1193658, 0x1193756, 0x1193958, 0x1193b56, 0x1194758, 0x1195056, 0x1195a58, 0x119a056,
+    0x119a858, 0x119aa56, 0x119d858, 0x119da56, 0x119e558, 0x11a0056, 0x11a4858, 0x11a5056, 0x11aa358, 0x11ab056,
+    0x11af958, 0x11b0056, 0x11b0a58, 0x11c0056, 0x11c0958, 0x11c0a56, 0x11c3758, 0x11c3856, 0x11c4658, 0x11c5056,
+    0x11c6d58, 0x11c7056, 0x11c9058, 0x11c9256, 0x11ca858, 0x11ca956, 0x11cb758, 0x11d0056, 0x11d0758, 0x11d0856,
+    0x11d0a58, 0x11d0b56, 0x11d3758, 0x11d3a56, 0x11d3b58, 0x11d3c56, 0x11d3e58, 0x11d3f56, 0x11d4858, 0x11d5056,
+    0x11d5a58, 0x11d6056, 0x11d6658, 0x11d6756, 0x11d6958, 0x11d6a56, 0x11d8f58, 0x11d9056, 0x11d9258, 0x11d9356,
+    0x11d9958, 0x11da056, 0x11daa58, 0x11ee056, 0x11ef958, 0x11f0056, 0x11f1158, 0x11f1256, 0x11f3b58, 0x11f3e56,
+    0x11f5a58, 0x11fb056, 0x11fb158, 0x11fc056, 0x11ff258, 0x11fff56, 0x1239a58, 0x1240056, 0x1246f58, 0x1247056,
+    0x1247558, 0x1248056, 0x1254458, 0x12f9056, 0x12ff358, 0x1300056, 0x1343058, 0x1344056, 0x1345658, 0x1440056,
+    0x1464758, 0x1680056, 0x16a3958, 0x16a4056, 0x16a5f58, 0x16a6056, 0x16a6a58, 0x16a6e56, 0x16abf58, 0x16ac056,
+    0x16aca58, 0x16ad056, 0x16aee58, 0x16af056, 0x16af658, 0x16b0056, 0x16b4658, 0x16b5056, 0x16b5a58, 0x16b5b56,
+    0x16b6258, 0x16b6356, 0x16b7858, 0x16b7d56, 0x16b9058, 0x16e404d, 0x16e414d, 0x16e424d, 0x16e434d, 0x16e444d,
+    0x16e454d, 0x16e464d, 0x16e474d, 0x16e484d, 0x16e494d, 0x16e4a4d, 0x16e4b4d, 0x16e4c4d, 0x16e4d4d, 0x16e4e4d,
+    0x16e4f4d, 0x16e504d, 0x16e514d, 0x16e524d, 0x16e534d, 0x16e544d, 0x16e554d, 0x16e564d, 0x16e574d, 0x16e584d,
+    0x16e594d, 0x16e5a4d, 0x16e5b4d, 0x16e5c4d, 0x16e5d4d, 0x16e5e4d, 0x16e5f4d, 0x16e6056, 0x16e9b58, 0x16f0056,
+    0x16f4b58, 0x16f4f56, 0x16f8858, 0x16f8f56, 0x16fa058, 0x16fe056, 0x16fe558, 0x16ff056, 0x16ff258, 0x1700056,
+    0x187f858, 0x1880056, 0x18cd658, 0x18d0056, 0x18d0958, 0x1aff056, 0x1aff458, 0x1aff556, 0x1affc58, 0x1affd56,
+    0x1afff58, 0x1b00056, 0x1b12358, 0x1b13256, 0x1b13358, 0x1b15056, 0x1b15358, 0x1b15556, 0x1b15658, 0x1b16456,
+    0x1b16858, 0x1b17056, 0x1b2fc58, 0x1bc0056, 0x1bc6b58, 0x1bc7056, 0x1bc7d58, 0x1bc8056, 0x1bc8958, 0x1bc9056,
+    0x1bc9a58, 0x1bc9c56, 0x1bca049, 0x1bca458, 0x1cf0056, 0x1cf2e58, 0x1cf3056, 0x1cf4758, 0x1cf5056, 0x1cfc458,
+    0x1d00056, 0x1d0f658, 0x1d10056, 0x1d12758, 0x1d12956, 0x1d15e4d, 0x1d15f4d, 0x1d1604d, 0x1d1614d, 0x1d1624d,
+    0x1d1634d, 0x1d1644d, 0x1d16556, 0x1d17358, 0x1d17b56, 0x1d1bb4d, 0x1d1bc4d, 0x1d1bd4d, 0x1d1be4d, 0x1d1bf4d,
+    0x1d1c04d, 0x1d1c156, 0x1d1eb58, 0x1d20056, 0x1d24658, 0x1d2c056, 0x1d2d458, 0x1d2e056, 0x1d2f458, 0x1d30056,
+    0x1d35758, 0x1d36056, 0x1d37958, 0x1d4004d, 0x1d4014d, 0x1d4024d, 0x1d4034d, 0x1d4044d, 0x1d4054d, 0x1d4064d,
+    0x1d4074d, 0x1d4084d, 0x1d4094d, 0x1d40a4d, 0x1d40b4d, 0x1d40c4d, 0x1d40d4d, 0x1d40e4d, 0x1d40f4d, 0x1d4104d,
+    0x1d4114d, 0x1d4124d, 0x1d4134d, 0x1d4144d, 0x1d4154d, 0x1d4164d, 0x1d4174d, 0x1d4184d, 0x1d4194d, 0x1d41a4d,
+    0x1d41b4d, 0x1d41c4d, 0x1d41d4d, 0x1d41e4d, 0x1d41f4d, 0x1d4204d, 0x1d4214d, 0x1d4224d, 0x1d4234d, 0x1d4244d,
+    0x1d4254d, 0x1d4264d, 0x1d4274d, 0x1d4284d, 0x1d4294d, 0x1d42a4d, 0x1d42b4d, 0x1d42c4d, 0x1d42d4d, 0x1d42e4d,
+    0x1d42f4d, 0x1d4304d, 0x1d4314d, 0x1d4324d, 0x1d4334d, 0x1d4344d, 0x1d4354d, 0x1d4364d, 0x1d4374d, 0x1d4384d,
+    0x1d4394d, 0x1d43a4d, 0x1d43b4d, 0x1d43c4d, 0x1d43d4d, 0x1d43e4d, 0x1d43f4d, 0x1d4404d, 0x1d4414d, 0x1d4424d,
+    0x1d4434d, 0x1d4444d, 0x1d4454d, 0x1d4464d, 0x1d4474d, 0x1d4484d, 0x1d4494d, 0x1d44a4d, 0x1d44b4d, 0x1d44c4d,
+    0x1d44d4d, 0x1d44e4d, 0x1d44f4d, 0x1d4504d, 0x1d4514d, 0x1d4524d, 0x1d4534d, 0x1d4544d, 0x1d45558, 0x1d4564d,
+    0x1d4574d, 0x1d4584d, 0x1d4594d, 0x1d45a4d, 0x1d45b4d, 0x1d45c4d, 0x1d45d4d, 0x1d45e4d, 0x1d45f4d, 0x1d4604d,
+    0x1d4614d, 0x1d4624d, 0x1d4634d, 0x1d4644d, 0x1d4654d, 0x1d4664d, 0x1d4674d, 0x1d4684d, 0x1d4694d, 0x1d46a4d,
+    0x1d46b4d, 0x1d46c4d, 0x1d46d4d, 0x1d46e4d, 0x1d46f4d, 0x1d4704d, 0x1d4714d, 0x1d4724d, 0x1d4734d, 0x1d4744d,
+    0x1d4754d, 0x1d4764d, 0x1d4774d, 0x1d4784d, 0x1d4794d, 0x1d47a4d, 0x1d47b4d, 0x1d47c4d, 0x1d47d4d, 0x1d47e4d,
+    0x1d47f4d, 0x1d4804d, 0x1d4814d, 0x1d4824d, 0x1d4834d, 0x1d4844d, 0x1d4854d, 0x1d4864d, 0x1d4874d, 0x1d4884d,
+    0x1d4894d, 0x1d48a4d, 0x1d48b4d, 0x1d48c4d, 0x1d48d4d, 0x1d48e4d, 0x1d48f4d, 0x1d4904d, 0x1d4914d, 0x1d4924d,
+    0x1d4934d, 0x1d4944d, 0x1d4954d, 0x1d4964d, 0x1d4974d, 0x1d4984d, 0x1d4994d, 0x1d49a4d, 0x1d49b4d, 0x1d49c4d,
+    0x1d49d58, 0x1d49e4d, 0x1d49f4d, 0x1d4a058, 0x1d4a24d, 0x1d4a358, 0x1d4a54d, 0x1d4a64d, 0x1d4a758, 0x1d4a94d,
+    0x1d4aa4d, 0x1d4ab4d, 0x1d4ac4d, 0x1d4ad58, 0x1d4ae4d, 0x1d4af4d, 0x1d4b04d, 0x1d4b14d, 0x1d4b24d, 0x1d4b34d,
+    0x1d4b44d, 0x1d4b54d, 0x1d4b64d, 0x1d4b74d, 0x1d4b84d, 0x1d4b94d, 0x1d4ba58, 0x1d4bb4d, 0x1d4bc58, 0x1d4bd4d,
+    0x1d4be4d, 0x1d4bf4d, 0x1d4c04d, 0x1d4c14d, 0x1d4c24d, 0x1d4c34d, 0x1d4c458, 0x1d4c54d, 0x1d4c64d, 0x1d4c74d,
+    0x1d4c84d, 0x1d4c94d, 0x1d4ca4d, 0x1d4cb4d, 0x1d4cc4d, 0x1d4cd4d, 0x1d4ce4d, 0x1d4cf4d, 0x1d4d04d, 0x1d4d14d,
+    0x1d4d24d, 0x1d4d34d, 0x1d4d44d, 0x1d4d54d, 0x1d4d64d, 0x1d4d74d, 0x1d4d84d, 0x1d4d94d, 0x1d4da4d, 0x1d4db4d,
+    0x1d4dc4d, 0x1d4dd4d, 0x1d4de4d, 0x1d4df4d, 0x1d4e04d, 0x1d4e14d, 0x1d4e24d, 0x1d4e34d, 0x1d4e44d, 0x1d4e54d,
+    0x1d4e64d, 0x1d4e74d, 0x1d4e84d, 0x1d4e94d, 0x1d4ea4d, 0x1d4eb4d, 0x1d4ec4d, 0x1d4ed4d, 0x1d4ee4d, 0x1d4ef4d,
+    0x1d4f04d, 0x1d4f14d, 0x1d4f24d, 0x1d4f34d, 0x1d4f44d, 0x1d4f54d, 0x1d4f64d, 0x1d4f74d, 0x1d4f84d, 0x1d4f94d,
+    0x1d4fa4d, 0x1d4fb4d, 0x1d4fc4d, 0x1d4fd4d, 0x1d4fe4d, 0x1d4ff4d, 0x1d5004d, 0x1d5014d, 0x1d5024d, 0x1d5034d,
+    0x1d5044d, 0x1d5054d, 0x1d50658, 0x1d5074d, 0x1d5084d, 0x1d5094d, 0x1d50a4d, 0x1d50b58, 0x1d50d4d, 0x1d50e4d,
+    0x1d50f4d, 0x1d5104d, 0x1d5114d, 0x1d5124d, 0x1d5134d, 0x1d5144d, 0x1d51558, 0x1d5164d, 0x1d5174d, 0x1d5184d,
+    0x1d5194d, 0x1d51a4d, 0x1d51b4d, 0x1d51c4d, 0x1d51d58, 0x1d51e4d, 0x1d51f4d, 0x1d5204d, 0x1d5214d, 0x1d5224d,
+    0x1d5234d, 0x1d5244d, 0x1d5254d, 0x1d5264d, 0x1d5274d, 0x1d5284d, 0x1d5294d, 0x1d52a4d, 0x1d52b4d, 0x1d52c4d,
+    0x1d52d4d, 0x1d52e4d, 0x1d52f4d, 0x1d5304d, 0x1d5314d, 0x1d5324d, 0x1d5334d, 0x1d5344d, 0x1d5354d, 0x1d5364d,
+    0x1d5374d, 0x1d5384d, 0x1d5394d, 0x1d53a58, 0x1d53b4d, 0x1d53c4d, 0x1d53d4d, 0x1d53e4d, 0x1d53f58, 0x1d5404d,
+    0x1d5414d, 0x1d5424d, 0x1d5434d, 0x1d5444d, 0x1d54558, 0x1d5464d, 0x1d54758, 0x1d54a4d, 0x1d54b4d, 0x1d54c4d,
+    0x1d54d4d, 0x1d54e4d, 0x1d54f4d, 0x1d5504d, 0x1d55158, 0x1d5524d, 0x1d5534d, 0x1d5544d, 0x1d5554d, 0x1d5564d,
+    0x1d5574d, 0x1d5584d, 0x1d5594d, 0x1d55a4d, 0x1d55b4d, 0x1d55c4d, 0x1d55d4d, 0x1d55e4d, 0x1d55f4d, 0x1d5604d,
+    0x1d5614d, 0x1d5624d, 0x1d5634d, 0x1d5644d, 0x1d5654d, 0x1d5664d, 0x1d5674d, 0x1d5684d, 0x1d5694d, 0x1d56a4d,
+    0x1d56b4d, 0x1d56c4d, 0x1d56d4d, 0x1d56e4d, 0x1d56f4d, 0x1d5704d, 0x1d5714d, 0x1d5724d, 0x1d5734d, 0x1d5744d,
+    0x1d5754d, 0x1d5764d, 0x1d5774d, 0x1d5784d, 0x1d5794d, 0x1d57a4d, 0x1d57b4d, 0x1d57c4d, 0x1d57d4d, 0x1d57e4d,
+    0x1d57f4d, 0x1d5804d, 0x1d5814d, 0x1d5824d, 0x1d5834d, 0x1d5844d, 0x1d5854d, 0x1d5864d, 0x1d5874d, 0x1d5884d,
+    0x1d5894d, 0x1d58a4d, 0x1d58b4d, 0x1d58c4d, 0x1d58d4d, 0x1d58e4d, 0x1d58f4d, 0x1d5904d, 0x1d5914d, 0x1d5924d,
+    0x1d5934d, 0x1d5944d, 0x1d5954d, 0x1d5964d, 0x1d5974d, 0x1d5984d, 0x1d5994d, 0x1d59a4d, 0x1d59b4d, 0x1d59c4d,
+    0x1d59d4d, 0x1d59e4d, 0x1d59f4d, 0x1d5a04d, 0x1d5a14d, 0x1d5a24d, 0x1d5a34d, 0x1d5a44d, 0x1d5a54d, 0x1d5a64d,
+    0x1d5a74d, 0x1d5a84d, 0x1d5a94d, 0x1d5aa4d, 0x1d5ab4d, 0x1d5ac4d, 0x1d5ad4d, 0x1d5ae4d, 0x1d5af4d, 0x1d5b04d,
+    0x1d5b14d, 0x1d5b24d, 0x1d5b34d, 0x1d5b44d, 0x1d5b54d, 0x1d5b64d, 0x1d5b74d, 0x1d5b84d, 0x1d5b94d, 0x1d5ba4d,
+    0x1d5bb4d, 0x1d5bc4d, 0x1d5bd4d, 0x1d5be4d, 0x1d5bf4d, 0x1d5c04d, 0x1d5c14d, 0x1d5c24d, 0x1d5c34d, 0x1d5c44d,
+    0x1d5c54d, 0x1d5c64d, 0x1d5c74d, 0x1d5c84d, 0x1d5c94d, 0x1d5ca4d, 0x1d5cb4d, 0x1d5cc4d, 0x1d5cd4d, 0x1d5ce4d,
+    0x1d5cf4d, 0x1d5d04d, 0x1d5d14d, 0x1d5d24d, 0x1d5d34d, 0x1d5d44d, 0x1d5d54d, 0x1d5d64d, 0x1d5d74d, 0x1d5d84d,
+    0x1d5d94d, 0x1d5da4d, 0x1d5db4d, 0x1d5dc4d, 0x1d5dd4d, 0x1d5de4d, 0x1d5df4d, 0x1d5e04d, 0x1d5e14d, 0x1d5e24d,
+    0x1d5e34d, 0x1d5e44d, 0x1d5e54d, 0x1d5e64d, 0x1d5e74d, 0x1d5e84d, 0x1d5e94d, 0x1d5ea4d, 0x1d5eb4d, 0x1d5ec4d,
+    0x1d5ed4d, 0x1d5ee4d, 0x1d5ef4d, 0x1d5f04d, 0x1d5f14d, 0x1d5f24d, 0x1d5f34d, 0x1d5f44d, 0x1d5f54d, 0x1d5f64d,
+    0x1d5f74d, 0x1d5f84d, 0x1d5f94d, 0x1d5fa4d, 0x1d5fb4d, 0x1d5fc4d, 0x1d5fd4d, 0x1d5fe4d, 0x1d5ff4d, 0x1d6004d,
+    0x1d6014d, 0x1d6024d, 0x1d6034d, 0x1d6044d, 0x1d6054d, 0x1d6064d, 0x1d6074d, 0x1d6084d, 0x1d6094d, 0x1d60a4d,
+    0x1d60b4d, 0x1d60c4d, 0x1d60d4d, 0x1d60e4d, 0x1d60f4d, 0x1d6104d, 0x1d6114d, 0x1d6124d, 0x1d6134d, 0x1d6144d,
+    0x1d6154d, 0x1d6164d, 0x1d6174d, 0x1d6184d, 0x1d6194d, 0x1d61a4d, 0x1d61b4d, 0x1d61c4d, 0x1d61d4d, 0x1d61e4d,
+    0x1d61f4d, 0x1d6204d, 0x1d6214d, 0x1d6224d, 0x1d6234d, 0x1d6244d, 0x1d6254d, 0x1d6264d, 0x1d6274d, 0x1d6284d,
+    0x1d6294d, 0x1d62a4d, 0x1d62b4d, 0x1d62c4d, 0x1d62d4d, 0x1d62e4d, 0x1d62f4d, 0x1d6304d, 0x1d6314d, 0x1d6324d,
+    0x1d6334d, 0x1d6344d, 0x1d6354d, 0x1d6364d, 0x1d6374d, 0x1d6384d, 0x1d6394d, 0x1d63a4d, 0x1d63b4d, 0x1d63c4d,
+    0x1d63d4d, 0x1d63e4d, 0x1d63f4d, 0x1d6404d, 0x1d6414d, 0x1d6424d, 0x1d6434d, 0x1d6444d, 0x1d6454d, 0x1d6464d,
+    0x1d6474d, 0x1d6484d, 0x1d6494d, 0x1d64a4d, 0x1d64b4d, 0x1d64c4d, 0x1d64d4d, 0x1d64e4d, 0x1d64f4d, 0x1d6504d,
+    0x1d6514d, 0x1d6524d, 0x1d6534d, 0x1d6544d, 0x1d6554d, 0x1d6564d, 0x1d6574d, 0x1d6584d, 0x1d6594d, 0x1d65a4d,
+    0x1d65b4d, 0x1d65c4d, 0x1d65d4d, 0x1d65e4d, 0x1d65f4d, 0x1d6604d, 0x1d6614d, 0x1d6624d, 0x1d6634d, 0x1d6644d,
+    0x1d6654d, 0x1d6664d, 0x1d6674d, 0x1d6684d, 0x1d6694d, 0x1d66a4d, 0x1d66b4d, 0x1d66c4d, 0x1d66d4d, 0x1d66e4d,
+    0x1d66f4d, 0x1d6704d, 0x1d6714d, 0x1d6724d, 0x1d6734d, 0x1d6744d, 0x1d6754d, 0x1d6764d, 0x1d6774d, 0x1d6784d,
+    0x1d6794d, 0x1d67a4d, 0x1d67b4d, 0x1d67c4d, 0x1d67d4d, 0x1d67e4d, 0x1d67f4d, 0x1d6804d, 0x1d6814d, 0x1d6824d,
+    0x1d6834d, 0x1d6844d, 0x1d6854d, 0x1d6864d, 0x1d6874d, 0x1d6884d, 0x1d6894d, 0x1d68a4d, 0x1d68b4d, 0x1d68c4d,
+    0x1d68d4d, 0x1d68e4d, 0x1d68f4d, 0x1d6904d, 0x1d6914d, 0x1d6924d, 0x1d6934d, 0x1d6944d, 0x1d6954d, 0x1d6964d,
+    0x1d6974d, 0x1d6984d, 0x1d6994d, 0x1d69a4d, 0x1d69b4d, 0x1d69c4d, 0x1d69d4d, 0x1d69e4d, 0x1d69f4d, 0x1d6a04d,
+    0x1d6a14d, 0x1d6a24d, 0x1d6a34d, 0x1d6a44d, 0x1d6a54d, 0x1d6a658, 0x1d6a84d, 0x1d6a94d, 0x1d6aa4d, 0x1d6ab4d,
+    0x1d6ac4d, 0x1d6ad4d, 0x1d6ae4d, 0x1d6af4d, 0x1d6b04d, 0x1d6b14d, 0x1d6b24d, 0x1d6b34d, 0x1d6b44d, 0x1d6b54d,
+    0x1d6b64d, 0x1d6b74d, 0x1d6b84d, 0x1d6b94d, 0x1d6ba4d, 0x1d6bb4d, 0x1d6bc4d, 0x1d6bd4d, 0x1d6be4d, 0x1d6bf4d,
+    0x1d6c04d, 0x1d6c14d, 0x1d6c24d, 0x1d6c34d, 0x1d6c44d, 0x1d6c54d, 0x1d6c64d, 0x1d6c74d, 0x1d6c84d, 0x1d6c94d,
+    0x1d6ca4d, 0x1d6cb4d, 0x1d6cc4d, 0x1d6cd4d, 0x1d6ce4d, 0x1d6cf4d, 0x1d6d04d, 0x1d6d14d, 0x1d6d24d, 0x1d6d34d,
+    0x1d6d54d, 0x1d6d64d, 0x1d6d74d, 0x1d6d84d, 0x1d6d94d, 0x1d6da4d, 0x1d6db4d, 0x1d6dc4d, 0x1d6dd4d, 0x1d6de4d,
+    0x1d6df4d, 0x1d6e04d, 0x1d6e14d, 0x1d6e24d, 0x1d6e34d, 0x1d6e44d, 0x1d6e54d, 0x1d6e64d, 0x1d6e74d, 0x1d6e84d,
+    0x1d6e94d, 0x1d6ea4d, 0x1d6eb4d, 0x1d6ec4d, 0x1d6ed4d, 0x1d6ee4d, 0x1d6ef4d, 0x1d6f04d, 0x1d6f14d, 0x1d6f24d,
+    0x1d6f34d, 0x1d6f44d, 0x1d6f54d, 0x1d6f64d, 0x1d6f74d, 0x1d6f84d, 0x1d6f94d, 0x1d6fa4d, 0x1d6fb4d, 0x1d6fc4d,
+    0x1d6fd4d, 0x1d6fe4d, 0x1d6ff4d, 0x1d7004d, 0x1d7014d, 0x1d7024d, 0x1d7034d, 0x1d7044d, 0x1d7054d, 0x1d7064d,
+    0x1d7074d, 0x1d7084d, 0x1d7094d, 0x1d70a4d, 0x1d70b4d, 0x1d70c4d, 0x1d70d4d, 0x1d70f4d, 0x1d7104d, 0x1d7114d,
+    0x1d7124d, 0x1d7134d, 0x1d7144d, 0x1d7154d, 0x1d7164d, 0x1d7174d, 0x1d7184d, 0x1d7194d, 0x1d71a4d, 0x1d71b4d,
+    0x1d71c4d, 0x1d71d4d, 0x1d71e4d, 0x1d71f4d, 0x1d7204d, 0x1d7214d, 0x1d7224d, 0x1d7234d, 0x1d7244d, 0x1d7254d,
+    0x1d7264d, 0x1d7274d, 0x1d7284d, 0x1d7294d, 0x1d72a4d, 0x1d72b4d, 0x1d72c4d, 0x1d72d4d, 0x1d72e4d, 0x1d72f4d,
+    0x1d7304d, 0x1d7314d, 0x1d7324d, 0x1d7334d, 0x1d7344d, 0x1d7354d, 0x1d7364d, 0x1d7374d, 0x1d7384d, 0x1d7394d,
+    0x1d73a4d, 0x1d73b4d, 0x1d73c4d, 0x1d73d4d, 0x1d73e4d, 0x1d73f4d, 0x1d7404d, 0x1d7414d, 0x1d7424d, 0x1d7434d,
+    0x1d7444d, 0x1d7454d, 0x1d7464d, 0x1d7474d, 0x1d7494d, 0x1d74a4d, 0x1d74b4d, 0x1d74c4d, 0x1d74d4d, 0x1d74e4d,
+    0x1d74f4d, 0x1d7504d, 0x1d7514d, 0x1d7524d, 0x1d7534d, 0x1d7544d, 0x1d7554d, 0x1d7564d, 0x1d7574d, 0x1d7584d,
+    0x1d7594d, 0x1d75a4d, 0x1d75b4d, 0x1d75c4d, 0x1d75d4d, 0x1d75e4d, 0x1d75f4d, 0x1d7604d, 0x1d7614d, 0x1d7624d,
+    0x1d7634d, 0x1d7644d, 0x1d7654d, 0x1d7664d, 0x1d7674d, 0x1d7684d, 0x1d7694d, 0x1d76a4d, 0x1d76b4d, 0x1d76c4d,
+    0x1d76d4d, 0x1d76e4d, 0x1d76f4d, 0x1d7704d, 0x1d7714d, 0x1d7724d, 0x1d7734d, 0x1d7744d, 0x1d7754d, 0x1d7764d,
+    0x1d7774d, 0x1d7784d, 0x1d7794d, 0x1d77a4d, 0x1d77b4d, 0x1d77c4d, 0x1d77d4d, 0x1d77e4d, 0x1d77f4d, 0x1d7804d,
+    0x1d7814d, 0x1d7834d, 0x1d7844d, 0x1d7854d, 0x1d7864d, 0x1d7874d, 0x1d7884d, 0x1d7894d, 0x1d78a4d, 0x1d78b4d,
+    0x1d78c4d, 0x1d78d4d, 0x1d78e4d, 0x1d78f4d, 0x1d7904d, 0x1d7914d, 0x1d7924d, 0x1d7934d, 0x1d7944d, 0x1d7954d,
+    0x1d7964d, 0x1d7974d, 0x1d7984d, 0x1d7994d, 0x1d79a4d, 0x1d79b4d, 0x1d79c4d, 0x1d79d4d, 0x1d79e4d, 0x1d79f4d,
+    0x1d7a04d, 0x1d7a14d, 0x1d7a24d, 0x1d7a34d, 0x1d7a44d, 0x1d7a54d, 0x1d7a64d, 0x1d7a74d, 0x1d7a84d, 0x1d7a94d,
+    0x1d7aa4d, 0x1d7ab4d, 0x1d7ac4d, 0x1d7ad4d, 0x1d7ae4d, 0x1d7af4d, 0x1d7b04d, 0x1d7b14d, 0x1d7b24d, 0x1d7b34d,
+    0x1d7b44d, 0x1d7b54d, 0x1d7b64d, 0x1d7b74d, 0x1d7b84d, 0x1d7b94d, 0x1d7ba4d, 0x1d7bb4d, 0x1d7bd4d, 0x1d7be4d,
+    0x1d7bf4d, 0x1d7c04d, 0x1d7c14d, 0x1d7c24d, 0x1d7c34d, 0x1d7c44d, 0x1d7c54d, 0x1d7c64d, 0x1d7c74d, 0x1d7c84d,
+    0x1d7c94d, 0x1d7ca4d, 0x1d7cc58, 0x1d7ce4d, 0x1d7cf4d, 0x1d7d04d, 0x1d7d14d, 0x1d7d24d, 0x1d7d34d, 0x1d7d44d,
+    0x1d7d54d, 0x1d7d64d, 0x1d7d74d, 0x1d7d84d, 0x1d7d94d, 0x1d7da4d, 0x1d7db4d, 0x1d7dc4d, 0x1d7dd4d, 0x1d7de4d,
+    0x1d7df4d, 0x1d7e04d, 0x1d7e14d, 0x1d7e24d, 0x1d7e34d, 0x1d7e44d, 0x1d7e54d, 0x1d7e64d, 0x1d7e74d, 0x1d7e84d,
+    0x1d7e94d, 0x1d7ea4d, 0x1d7eb4d, 0x1d7ec4d, 0x1d7ed4d, 0x1d7ee4d, 0x1d7ef4d, 0x1d7f04d, 0x1d7f14d, 0x1d7f24d,
+    0x1d7f34d, 0x1d7f44d, 0x1d7f54d, 0x1d7f64d, 0x1d7f74d, 0x1d7f84d, 0x1d7f94d, 0x1d7fa4d, 0x1d7fb4d, 0x1d7fc4d,
+    0x1d7fd4d, 0x1d7fe4d, 0x1d7ff4d, 0x1d80056, 0x1da8c58, 0x1da9b56, 0x1daa058, 0x1daa156, 0x1dab058, 0x1df0056,
+    0x1df1f58, 0x1df2556, 0x1df2b58, 0x1e00056, 0x1e00758, 0x1e00856, 0x1e01958, 0x1e01b56, 0x1e02258, 0x1e02356,
+    0x1e02558, 0x1e02656, 0x1e02b58, 0x1e0304d, 0x1e0314d, 0x1e0324d, 0x1e0334d, 0x1e0344d, 0x1e0354d, 0x1e0364d,
+    0x1e0374d, 0x1e0384d, 0x1e0394d, 0x1e03a4d, 0x1e03b4d, 0x1e03c4d, 0x1e03d4d, 0x1e03e4d, 0x1e03f4d, 0x1e0404d,
+    0x1e0414d, 0x1e0424d, 0x1e0434d, 0x1e0444d, 0x1e0454d, 0x1e0464d, 0x1e0474d, 0x1e0484d, 0x1e0494d, 0x1e04a4d,
+    0x1e04b4d, 0x1e04c4d, 0x1e04d4d, 0x1e04e4d, 0x1e04f4d, 0x1e0504d, 0x1e0514d, 0x1e0524d, 0x1e0534d, 0x1e0544d,
+    0x1e0554d, 0x1e0564d, 0x1e0574d, 0x1e0584d, 0x1e0594d, 0x1e05a4d, 0x1e05b4d, 0x1e05c4d, 0x1e05d4d, 0x1e05e4d,
+    0x1e05f4d, 0x1e0604d, 0x1e0614d, 0x1e0624d, 0x1e0634d, 0x1e0644d, 0x1e0654d, 0x1e0664d, 0x1e0674d, 0x1e0684d,
+    0x1e0694d, 0x1e06a4d, 0x1e06b4d, 0x1e06c4d, 0x1e06d4d, 0x1e06e58, 0x1e08f56, 0x1e09058, 0x1e10056, 0x1e12d58,
+    0x1e13056, 0x1e13e58, 0x1e14056, 0x1e14a58, 0x1e14e56, 0x1e15058, 0x1e29056, 0x1e2af58, 0x1e2c056, 0x1e2fa58,
+    0x1e2ff56, 0x1e30058, 0x1e4d056, 0x1e4fa58, 0x1e7e056, 0x1e7e758, 0x1e7e856, 0x1e7ec58, 0x1e7ed56, 0x1e7ef58,
+    0x1e7f056, 0x1e7ff58, 0x1e80056, 0x1e8c558, 0x1e8c756, 0x1e8d758, 0x1e9004d, 0x1e9014d, 0x1e9024d, 0x1e9034d,
+    0x1e9044d, 0x1e9054d, 0x1e9064d, 0x1e9074d, 0x1e9084d, 0x1e9094d, 0x1e90a4d, 0x1e90b4d, 0x1e90c4d, 0x1e90d4d,
+    0x1e90e4d, 0x1e90f4d, 0x1e9104d, 0x1e9114d, 0x1e9124d, 0x1e9134d, 0x1e9144d, 0x1e9154d, 0x1e9164d, 0x1e9174d,
+    0x1e9184d, 0x1e9194d, 0x1e91a4d, 0x1e91b4d, 0x1e91c4d, 0x1e91d4d, 0x1e91e4d, 0x1e91f4d, 0x1e9204d, 0x1e9214d,
+    0x1e92256, 0x1e94c58, 0x1e95056, 0x1e95a58, 0x1e95e56, 0x1e96058, 0x1ec7156, 0x1ecb558, 0x1ed0156, 0x1ed3e58,
+    0x1ee004d, 0x1ee014d, 0x1ee024d, 0x1ee034d, 0x1ee0458, 0x1ee054d, 0x1ee064d, 0x1ee074d, 0x1ee084d, 0x1ee094d,
+    0x1ee0a4d, 0x1ee0b4d, 0x1ee0c4d, 0x1ee0d4d, 0x1ee0e4d, 0x1ee0f4d, 0x1ee104d, 0x1ee114d, 0x1ee124d, 0x1ee134d,
+    0x1ee144d, 0x1ee154d, 0x1ee164d, 0x1ee174d, 0x1ee184d, 0x1ee194d, 0x1ee1a4d, 0x1ee1b4d, 0x1ee1c4d, 0x1ee1d4d,
+    0x1ee1e4d, 0x1ee1f4d, 0x1ee2058, 0x1ee214d, 0x1ee224d, 0x1ee2358, 0x1ee244d, 0x1ee2558, 0x1ee274d, 0x1ee2858,
+    0x1ee294d, 0x1ee2a4d, 0x1ee2b4d, 0x1ee2c4d, 0x1ee2d4d, 0x1ee2e4d, 0x1ee2f4d, 0x1ee304d, 0x1ee314d, 0x1ee324d,
+    0x1ee3358, 0x1ee344d, 0x1ee354d, 0x1ee364d, 0x1ee374d, 0x1ee3858, 0x1ee394d, 0x1ee3a58, 0x1ee3b4d, 0x1ee3c58,
+    0x1ee424d, 0x1ee4358, 0x1ee474d, 0x1ee4858, 0x1ee494d, 0x1ee4a58, 0x1ee4b4d, 0x1ee4c58, 0x1ee4d4d, 0x1ee4e4d,
+    0x1ee4f4d, 0x1ee5058, 0x1ee514d, 0x1ee524d, 0x1ee5358, 0x1ee544d, 0x1ee5558, 0x1ee574d, 0x1ee5858, 0x1ee594d,
+    0x1ee5a58, 0x1ee5b4d, 0x1ee5c58, 0x1ee5d4d, 0x1ee5e58, 0x1ee5f4d, 0x1ee6058, 0x1ee614d, 0x1ee624d, 0x1ee6358,
+    0x1ee644d, 0x1ee6558, 0x1ee674d, 0x1ee684d, 0x1ee694d, 0x1ee6a4d, 0x1ee6b58, 0x1ee6c4d, 0x1ee6d4d, 0x1ee6e4d,
+    0x1ee6f4d, 0x1ee704d, 0x1ee714d, 0x1ee724d, 0x1ee7358, 0x1ee744d, 0x1ee754d, 0x1ee764d, 0x1ee774d, 0x1ee7858,
+    0x1ee794d, 0x1ee7a4d, 0x1ee7b4d, 0x1ee7c4d, 0x1ee7d58, 0x1ee7e4d, 0x1ee7f58, 0x1ee804d, 0x1ee814d, 0x1ee824d,
+    0x1ee834d, 0x1ee844d, 0x1ee854d, 0x1ee864d, 0x1ee874d, 0x1ee884d, 0x1ee894d, 0x1ee8a58, 0x1ee8b4d, 0x1ee8c4d,
+    0x1ee8d4d, 0x1ee8e4d, 0x1ee8f4d, 0x1ee904d, 0x1ee914d, 0x1ee924d, 0x1ee934d, 0x1ee944d, 0x1ee954d, 0x1ee964d,
+    0x1ee974d, 0x1ee984d, 0x1ee994d, 0x1ee9a4d, 0x1ee9b4d, 0x1ee9c58, 0x1eea14d, 0x1eea24d, 0x1eea34d, 0x1eea458,
+    0x1eea54d, 0x1eea64d, 0x1eea74d, 0x1eea84d, 0x1eea94d, 0x1eeaa58, 0x1eeab4d, 0x1eeac4d, 0x1eead4d, 0x1eeae4d,
+    0x1eeaf4d, 0x1eeb04d, 0x1eeb14d, 0x1eeb24d, 0x1eeb34d, 0x1eeb44d, 0x1eeb54d, 0x1eeb64d, 0x1eeb74d, 0x1eeb84d,
+    0x1eeb94d, 0x1eeba4d, 0x1eebb4d, 0x1eebc58, 0x1eef056, 0x1eef258, 0x1f00056, 0x1f02c58, 0x1f03056, 0x1f09458,
+    0x1f0a056, 0x1f0af58, 0x1f0b156, 0x1f0c058, 0x1f0c156, 0x1f0d058, 0x1f0d156, 0x1f0f658, 0x1f10133, 0x1f10233,
+    0x1f10333, 0x1f10433, 0x1f10533, 0x1f10633, 0x1f10733, 0x1f10833, 0x1f10933, 0x1f10a33, 0x1f10b56, 0x1f11033,
+    0x1f11133, 0x1f11233, 0x1f11333, 0x1f11433, 0x1f11533, 0x1f11633, 0x1f11733, 0x1f11833, 0x1f11933, 0x1f11a33,
+    0x1f11b33, 0x1f11c33, 0x1f11d33, 0x1f11e33, 0x1f11f33, 0x1f12033, 0x1f12133, 0x1f12233, 0x1f12333, 0x1f12433,
+    0x1f12533, 0x1f12633, 0x1f12733, 0x1f12833, 0x1f12933, 0x1f12a4d, 0x1f12b4d, 0x1f12c4d, 0x1f12d4d, 0x1f12e4d,
+    0x1f12f56, 0x1f1304d, 0x1f1314d, 0x1f1324d, 0x1f1334d, 0x1f1344d, 0x1f1354d, 0x1f1364d, 0x1f1374d, 0x1f1384d,
+    0x1f1394d, 0x1f13a4d, 0x1f13b4d, 0x1f13c4d, 0x1f13d4d, 0x1f13e4d, 0x1f13f4d, 0x1f1404d, 0x1f1414d, 0x1f1424d,
+    0x1f1434d, 0x1f1444d, 0x1f1454d, 0x1f1464d, 0x1f1474d, 0x1f1484d, 0x1f1494d, 0x1f14a4d, 0x1f14b4d, 0x1f14c4d,
+    0x1f14d4d, 0x1f14e4d, 0x1f14f4d, 0x1f15056, 0x1f16a4d, 0x1f16b4d, 0x1f16c4d, 0x1f16d56, 0x1f1904d, 0x1f19156,
+    0x1f1ae58, 0x1f1e656, 0x1f2004d, 0x1f2014d, 0x1f2024d, 0x1f20358, 0x1f2104d, 0x1f2114d, 0x1f2124d, 0x1f2134d,
+    0x1f2144d, 0x1f2154d, 0x1f2164d, 0x1f2174d, 0x1f2184d, 0x1f2194d, 0x1f21a4d, 0x1f21b4d, 0x1f21c4d, 0x1f21d4d,
+    0x1f21e4d, 0x1f21f4d, 0x1f2204d, 0x1f2214d, 0x1f2224d, 0x1f2234d, 0x1f2244d, 0x1f2254d, 0x1f2264d, 0x1f2274d,
+    0x1f2284d, 0x1f2294d, 0x1f22a4d, 0x1f22b4d, 0x1f22c4d, 0x1f22d4d, 0x1f22e4d, 0x1f22f4d, 0x1f2304d, 0x1f2314d,
+    0x1f2324d, 0x1f2334d, 0x1f2344d, 0x1f2354d, 0x1f2364d, 0x1f2374d, 0x1f2384d, 0x1f2394d, 0x1f23a4d, 0x1f23b4d,
+    0x1f23c58, 0x1f2404d, 0x1f2414d, 0x1f2424d, 0x1f2434d, 0x1f2444d, 0x1f2454d, 0x1f2464d, 0x1f2474d, 0x1f2484d,
+    0x1f24958, 0x1f2504d, 0x1f2514d, 0x1f25258, 0x1f26056, 0x1f26658, 0x1f30056, 0x1f6d858, 0x1f6dc56, 0x1f6ed58,
+    0x1f6f056, 0x1f6fd58, 0x1f70056, 0x1f77758, 0x1f77b56, 0x1f7da58, 0x1f7e056, 0x1f7ec58, 0x1f7f056, 0x1f7f158,
+    0x1f80056, 0x1f80c58, 0x1f81056, 0x1f84858, 0x1f85056, 0x1f85a58, 0x1f86056, 0x1f88858, 0x1f89056, 0x1f8ae58,
+    0x1f8b056, 0x1f8b258, 0x1f90056, 0x1fa5458, 0x1fa6056, 0x1fa6e58, 0x1fa7056, 0x1fa7d58, 0x1fa8056, 0x1fa8958,
+    0x1fa9056, 0x1fabe58, 0x1fabf56, 0x1fac658, 0x1face56, 0x1fadc58, 0x1fae056, 0x1fae958, 0x1faf056, 0x1faf958,
+    0x1fb0056, 0x1fb9358, 0x1fb9456, 0x1fbcb58, 0x1fbf04d, 0x1fbf14d, 0x1fbf24d, 0x1fbf34d, 0x1fbf44d, 0x1fbf54d,
+    0x1fbf64d, 0x1fbf74d, 0x1fbf84d, 0x1fbf94d, 0x1fbfa58, 0x2000056, 0x2a6e058, 0x2a70056, 0x2b73a58, 0x2b74056,
+    0x2b81e58, 0x2b82056, 0x2cea258, 0x2ceb056, 0x2ebe158, 0x2ebf056, 0x2ee5e58, 0x2f8004d, 0x2f8014d, 0x2f8024d,
+    0x2f8034d, 0x2f8044d, 0x2f8054d, 0x2f8064d, 0x2f8074d, 0x2f8084d, 0x2f8094d, 0x2f80a4d, 0x2f80b4d, 0x2f80c4d,
+    0x2f80d4d, 0x2f80e4d, 0x2f80f4d, 0x2f8104d, 0x2f8114d, 0x2f8124d, 0x2f8134d, 0x2f8144d, 0x2f8154d, 0x2f8164d,
+    0x2f8174d, 0x2f8184d, 0x2f8194d, 0x2f81a4d, 0x2f81b4d, 0x2f81c4d, 0x2f81d4d, 0x2f81e4d, 0x2f81f4d, 0x2f8204d,
+    0x2f8214d, 0x2f8224d, 0x2f8234d, 0x2f8244d, 0x2f8254d, 0x2f8264d, 0x2f8274d, 0x2f8284d, 0x2f8294d, 0x2f82a4d,
+    0x2f82b4d, 0x2f82c4d, 0x2f82d4d, 0x2f82e4d, 0x2f82f4d, 0x2f8304d, 0x2f8314d, 0x2f8344d, 0x2f8354d, 0x2f8364d,
+    0x2f8374d, 0x2f8384d, 0x2f8394d, 0x2f83a4d, 0x2f83b4d, 0x2f83c4d, 0x2f83d4d, 0x2f83e4d, 0x2f83f4d, 0x2f8404d,
+    0x2f8414d, 0x2f8424d, 0x2f8434d, 0x2f8444d, 0x2f8454d, 0x2f8474d, 0x2f8484d, 0x2f8494d, 0x2f84a4d, 0x2f84b4d,
+    0x2f84c4d, 0x2f84d4d, 0x2f84e4d, 0x2f84f4d, 0x2f8504d, 0x2f8514d, 0x2f8524d, 0x2f8534d, 0x2f8544d, 0x2f8554d,
+    0x2f8564d, 0x2f8574d, 0x2f8584d, 0x2f8594d, 0x2f85a4d, 0x2f85b4d, 0x2f85c4d, 0x2f85d4d, 0x2f85e4d, 0x2f85f4d,
+    0x2f8604d, 0x2f8614d, 0x2f8624d, 0x2f8634d, 0x2f8644d, 0x2f8654d, 0x2f8664d, 0x2f8674d, 0x2f86858, 0x2f8694d,
+    0x2f86a4d, 0x2f86c4d, 0x2f86d4d, 0x2f86e4d, 0x2f86f4d, 0x2f8704d, 0x2f8714d, 0x2f8724d, 0x2f8734d, 0x2f87458,
+    0x2f8754d, 0x2f8764d, 0x2f8774d, 0x2f8784d, 0x2f8794d, 0x2f87a4d, 0x2f87b4d, 0x2f87c4d, 0x2f87d4d, 0x2f87e4d,
+    0x2f87f4d, 0x2f8804d, 0x2f8814d, 0x2f8824d, 0x2f8834d, 0x2f8844d, 0x2f8854d, 0x2f8864d, 0x2f8874d, 0x2f8884d,
+    0x2f8894d, 0x2f88a4d, 0x2f88b4d, 0x2f88c4d, 0x2f88d4d, 0x2f88e4d, 0x2f88f4d, 0x2f8904d, 0x2f8914d, 0x2f8934d,
+    0x2f8944d, 0x2f8964d, 0x2f8974d, 0x2f8984d, 0x2f8994d, 0x2f89a4d, 0x2f89b4d, 0x2f89c4d, 0x2f89d4d, 0x2f89e4d,
+    0x2f89f4d, 0x2f8a04d, 0x2f8a14d, 0x2f8a24d, 0x2f8a34d, 0x2f8a44d, 0x2f8a54d, 0x2f8a64d, 0x2f8a74d, 0x2f8a84d,
+    0x2f8a94d, 0x2f8aa4d, 0x2f8ab4d, 0x2f8ac4d, 0x2f8ad4d, 0x2f8ae4d, 0x2f8af4d, 0x2f8b04d, 0x2f8b14d, 0x2f8b24d,
+    0x2f8b34d, 0x2f8b44d, 0x2f8b54d, 0x2f8b64d, 0x2f8b74d, 0x2f8b84d, 0x2f8b94d, 0x2f8ba4d, 0x2f8bb4d, 0x2f8bc4d,
+    0x2f8bd4d, 0x2f8be4d, 0x2f8bf4d, 0x2f8c04d, 0x2f8c14d, 0x2f8c24d, 0x2f8c34d, 0x2f8c44d, 0x2f8c54d, 0x2f8c64d,
+    0x2f8c74d, 0x2f8c84d, 0x2f8c94d, 0x2f8ca4d, 0x2f8cb4d, 0x2f8cc4d, 0x2f8cd4d, 0x2f8ce4d, 0x2f8cf4d, 0x2f8d04d,
+    0x2f8d14d, 0x2f8d24d, 0x2f8d34d, 0x2f8d44d, 0x2f8d54d, 0x2f8d64d, 0x2f8d74d, 0x2f8d84d, 0x2f8d94d, 0x2f8da4d,
+    0x2f8db4d, 0x2f8dc4d, 0x2f8dd4d, 0x2f8de4d, 0x2f8df4d, 0x2f8e04d, 0x2f8e14d, 0x2f8e24d, 0x2f8e34d, 0x2f8e44d,
+    0x2f8e54d, 0x2f8e64d, 0x2f8e74d, 0x2f8e84d, 0x2f8e94d, 0x2f8ea4d, 0x2f8eb4d, 0x2f8ec4d, 0x2f8ed4d, 0x2f8ee4d,
+    0x2f8ef4d, 0x2f8f04d, 0x2f8f14d, 0x2f8f24d, 0x2f8f34d, 0x2f8f44d, 0x2f8f54d, 0x2f8f64d, 0x2f8f74d, 0x2f8f84d,
+    0x2f8f94d, 0x2f8fa4d, 0x2f8fb4d, 0x2f8fc4d, 0x2f8fd4d, 0x2f8fe4d, 0x2f8ff4d, 0x2f9004d, 0x2f9014d, 0x2f9024d,
+    0x2f9034d, 0x2f9044d, 0x2f9054d, 0x2f9064d, 0x2f9074d, 0x2f9084d, 0x2f9094d, 0x2f90a4d, 0x2f90b4d, 0x2f90c4d,
+    0x2f90d4d, 0x2f90e4d, 0x2f90f4d, 0x2f9104d, 0x2f9114d, 0x2f9124d, 0x2f9134d, 0x2f9144d, 0x2f9154d, 0x2f9164d,
+    0x2f9174d, 0x2f9184d, 0x2f9194d, 0x2f91a4d, 0x2f91b4d, 0x2f91c4d, 0x2f91d4d, 0x2f91e4d, 0x2f91f58, 0x2f9204d,
+    0x2f9214d, 0x2f9224d, 0x2f9234d, 0x2f9244d, 0x2f9254d, 0x2f9264d, 0x2f9274d, 0x2f9284d, 0x2f9294d, 0x2f92a4d,
+    0x2f92b4d, 0x2f92c4d, 0x2f92e4d, 0x2f92f4d, 0x2f9304d, 0x2f9314d, 0x2f9324d, 0x2f9334d, 0x2f9344d, 0x2f9354d,
+    0x2f9364d, 0x2f9374d, 0x2f9384d, 0x2f9394d, 0x2f93a4d, 0x2f93b4d, 0x2f93c4d, 0x2f93d4d, 0x2f93e4d, 0x2f93f4d,
+    0x2f9404d, 0x2f9414d, 0x2f9424d, 0x2f9434d, 0x2f9444d, 0x2f9454d, 0x2f9464d, 0x2f9484d, 0x2f9494d, 0x2f94a4d,
+    0x2f94b4d, 0x2f94c4d, 0x2f94d4d, 0x2f94e4d, 0x2f94f4d, 0x2f9504d, 0x2f9514d, 0x2f9524d, 0x2f9534d, 0x2f9544d,
+    0x2f9554d, 0x2f9564d, 0x2f9574d, 0x2f9584d, 0x2f9594d, 0x2f95a4d, 0x2f95b4d, 0x2f95c4d, 0x2f95d4d, 0x2f95f58,
+    0x2f9604d, 0x2f9614d, 0x2f9624d, 0x2f9634d, 0x2f9644d, 0x2f9654d, 0x2f9664d, 0x2f9674d, 0x2f9684d, 0x2f9694d,
+    0x2f96a4d, 0x2f96b4d, 0x2f96c4d, 0x2f96d4d, 0x2f96e4d, 0x2f96f4d, 0x2f9704d, 0x2f9714d, 0x2f9724d, 0x2f9734d,
+    0x2f9744d, 0x2f9754d, 0x2f9764d, 0x2f9774d, 0x2f9784d, 0x2f9794d, 0x2f97a4d, 0x2f97b4d, 0x2f97c4d, 0x2f97d4d,
+    0x2f97e4d, 0x2f97f4d, 0x2f9804d, 0x2f9814d, 0x2f9824d, 0x2f9834d, 0x2f9844d, 0x2f9854d, 0x2f9864d, 0x2f9874d,
+    0x2f9884d, 0x2f9894d, 0x2f98a4d, 0x2f98b4d, 0x2f98c4d, 0x2f98d4d, 0x2f98e4d, 0x2f98f4d, 0x2f9904d, 0x2f9914d,
+    0x2f9924d, 0x2f9934d, 0x2f9944d, 0x2f9954d, 0x2f9964d, 0x2f9974d, 0x2f9984d, 0x2f9994d, 0x2f99a4d, 0x2f99b4d,
+    0x2f99c4d, 0x2f99d4d, 0x2f99e4d, 0x2f99f4d, 0x2f9a04d, 0x2f9a14d, 0x2f9a24d, 0x2f9a34d, 0x2f9a44d, 0x2f9a54d,
+    0x2f9a64d, 0x2f9a74d, 0x2f9a84d, 0x2f9a94d, 0x2f9aa4d, 0x2f9ab4d, 0x2f9ac4d, 0x2f9ad4d, 0x2f9ae4d, 0x2f9af4d,
+    0x2f9b04d, 0x2f9b14d, 0x2f9b24d, 0x2f9b34d, 0x2f9b44d, 0x2f9b54d, 0x2f9b64d, 0x2f9b74d, 0x2f9b84d, 0x2f9b94d,
+    0x2f9ba4d, 0x2f9bb4d, 0x2f9bc4d, 0x2f9bd4d, 0x2f9be4d, 0x2f9bf58, 0x2f9c04d, 0x2f9c14d, 0x2f9c24d, 0x2f9c34d,
+    0x2f9c44d, 0x2f9c54d, 0x2f9c64d, 0x2f9c74d, 0x2f9c84d, 0x2f9c94d, 0x2f9ca4d, 0x2f9cb4d, 0x2f9cc4d, 0x2f9cd4d,
+    0x2f9ce4d, 0x2f9cf4d, 0x2f9d04d, 0x2f9d14d, 0x2f9d24d, 0x2f9d34d, 0x2f9d44d, 0x2f9d54d, 0x2f9d64d, 0x2f9d74d,
+    0x2f9d84d, 0x2f9d94d, 0x2f9da4d, 0x2f9db4d, 0x2f9dc4d, 0x2f9dd4d, 0x2f9de4d, 0x2f9df4d, 0x2f9e04d, 0x2f9e14d,
+    0x2f9e24d, 0x2f9e34d, 0x2f9e44d, 0x2f9e54d, 0x2f9e64d, 0x2f9e74d, 0x2f9e84d, 0x2f9e94d, 0x2f9ea4d, 0x2f9eb4d,
+    0x2f9ec4d, 0x2f9ed4d, 0x2f9ee4d, 0x2f9ef4d, 0x2f9f04d, 0x2f9f14d, 0x2f9f24d, 0x2f9f34d, 0x2f9f44d, 0x2f9f54d,
+    0x2f9f64d, 0x2f9f74d, 0x2f9f84d, 0x2f9f94d, 0x2f9fa4d, 0x2f9fb4d, 0x2f9fc4d, 0x2f9fd4d, 0x2f9fe4d, 0x2fa004d,
+    0x2fa014d, 0x2fa024d, 0x2fa034d, 0x2fa044d, 0x2fa054d, 0x2fa064d, 0x2fa074d, 0x2fa084d, 0x2fa094d, 0x2fa0a4d,
+    0x2fa0b4d, 0x2fa0c4d, 0x2fa0d4d, 0x2fa0e4d, 0x2fa0f4d, 0x2fa104d, 0x2fa114d, 0x2fa124d, 0x2fa134d, 0x2fa144d,
+    0x2fa154d, 0x2fa164d, 0x2fa174d, 0x2fa184d, 0x2fa194d, 0x2fa1a4d, 0x2fa1b4d, 0x2fa1c4d, 0x2fa1d4d, 0x2fa1e58,
+    0x3000056, 0x3134b58, 0x3135056, 0x323b058, 0xe010049, 0xe01f058,
+};
+
+/// Parallel to uts46_rows: index into mapping_offsets, or no_mapping
+pub const uts46_mappings = [_]u16{
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, 0, 1, 2, 3, 4, 5, 6,
+    7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+    19, 20, 21, 22, 23, 24, 25, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, 26, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    27, no_mapping, 0, no_mapping, no_mapping, no_mapping, no_mapping, 28, no_mapping, no_mapping, 29, 30,
+    31, 32, no_mapping, no_mapping, 33, 34, 14, no_mapping, 35, 36, 37, no_mapping,
+    38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49,
+    50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, no_mapping,
+    61, 62, 63, 64, 65, 66, 67, 68, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, 69, no_mapping, 70, no_mapping, 71, no_mapping, 72, no_mapping,
+    73, no_mapping, 74, no_mapping, 75, no_mapping, 76, no_mapping, 77, no_mapping, 78, no_mapping,
+    79, no_mapping, 80, no_mapping, 81, no_mapping, 82, no_mapping, 83, no_mapping, 84, no_mapping,
+    85, no_mapping, 86, no_mapping, 87, no_mapping, 88, no_mapping, 89, no_mapping, 90, no_mapping,
+    91, no_mapping, 92, no_mapping, 93, no_mapping, 94, 95, no_mapping, 96, no_mapping, 97,
+    no_mapping, 98, no_mapping, 99, no_mapping, 100, 101, no_mapping, 102, no_mapping, 103, no_mapping,
+    104, no_mapping, 105, 106, no_mapping, 107, no_mapping, 108, no_mapping, 109, no_mapping, 110,
+    no_mapping, 111, no_mapping, 112, no_mapping, 113, no_mapping, 114, no_mapping, 115, no_mapping, 116,
+    no_mapping, 117, no_mapping, 118, no_mapping, 119, no_mapping, 120, no_mapping, 121, no_mapping, 122,
+    no_mapping, 123, no_mapping, 124, no_mapping, 125, no_mapping, 126, no_mapping, 127, no_mapping, 128,
+    no_mapping, 129, 130, no_mapping, 131, no_mapping, 132, no_mapping, 18, no_mapping, 133, 134,
+    no_mapping, 135, no_mapping, 136, 137, no_mapping, 138, 139, 140, no_mapping, 141, 142,
+    143, 144, no_mapping, 145, 146, no_mapping, 147, 148, 149, no_mapping, 150, 151,
+    no_mapping, 152, 153, no_mapping, 154, no_mapping, 155, no_mapping, 156, 157, no_mapping, 158,
+    no_mapping, 159, no_mapping, 160, 161, no_mapping, 162, 163, 164, no_mapping, 165, no_mapping,
+    166, 167, no_mapping, 168, no_mapping, 169, 170, 171, 172, no_mapping, 173, no_mapping,
+    174, no_mapping, 175, no_mapping, 176, no_mapping, 177, no_mapping, 178, no_mapping, 179, no_mapping,
+    180, no_mapping, 181, no_mapping, 182, no_mapping, 183, no_mapping, 184, no_mapping, 185, no_mapping,
+    186, no_mapping, 187, no_mapping, 188, no_mapping, 189, 190, no_mapping, 191, 192, 193,
+    no_mapping, 194, no_mapping, 195, no_mapping, 196, no_mapping, 197, no_mapping, 198, no_mapping, 199,
+    no_mapping, 200, no_mapping, 201, no_mapping, 202, no_mapping, 203, no_mapping, 204, no_mapping, 205,
+    no_mapping, 206, no_mapping, 207, no_mapping, 208, no_mapping, 209, no_mapping, 210, no_mapping, 211,
+    no_mapping, 212, no_mapping, 213, no_mapping, 214, no_mapping, 215, no_mapping, 216, no_mapping, 217,
+    no_mapping, 218, no_mapping, 219, no_mapping, 220, no_mapping, 221, no_mapping, 222, no_mapping, 223,
+    224, no_mapping, 225, 226, no_mapping, 227, no_mapping, 228, 229, 230, 231, no_mapping,
+    232, no_mapping, 233, no_mapping, 234, no_mapping, 235, no_mapping, 7, 236, 9, 17,
+    237, 238, 239, 22, 24, no_mapping, 240, 241, 242, 243, 244, 245,
+    no_mapping, 146, 11, 18, 23, 246, no_mapping, 247, 248, no_mapping, 249, 250,
+    251, no_mapping, no_mapping, no_mapping, 252, no_mapping, 253, no_mapping, 254, no_mapping, 255, no_mapping,
+    no_mapping, 256, no_mapping, 257, 258, no_mapping, 31, 259, 260, 261, 262, 263,
+    264, no_mapping, 265, no_mapping, 266, 267, no_mapping, 268, 269, 270, 271, 272,
+    273, 274, 275, 251, 276, 277, 32, 278, 279, 280, 281, 282,
+    no_mapping, 283, 284, 285, 286, 287, 288, 289, 290, 291, no_mapping, 283,
+    no_mapping, 292, 269, 275, 285, 266, 291, 286, 281, no_mapping, 293, no_mapping,
+    294, no_mapping, 295, no_mapping, 296, no_mapping, 297, no_mapping, 298, no_mapping, 299, no_mapping,
+    300, no_mapping, 301, no_mapping, 302, no_mapping, 303, no_mapping, 304, no_mapping, 276, 282,
+    283, no_mapping, 275, 272, no_mapping, 305, no_mapping, 283, 306, no_mapping, 307, 308,
+    309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320,
+    321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332,
+    333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344,
+    345, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356,
+    357, no_mapping, 358, no_mapping, 359, no_mapping, 360, no_mapping, 361, no_mapping, 362, no_mapping,
+    363, no_mapping, 364, no_mapping, 365, no_mapping, 366, no_mapping, 367, no_mapping, 368, no_mapping,
+    369, no_mapping, 370, no_mapping, 371, no_mapping, 372, no_mapping, 373, no_mapping, 374, no_mapping,
+    375, no_mapping, 376, no_mapping, 377, no_mapping, 378, no_mapping, 379, no_mapping, 380, no_mapping,
+    381, no_mapping, 382, no_mapping, 383, no_mapping, 384, no_mapping, 385, no_mapping, 386, no_mapping,
+    387, no_mapping, 388, no_mapping, 389, no_mapping, 390, no_mapping, 391, no_mapping, 392, no_mapping,
+    393, no_mapping, 394, no_mapping, 395, no_mapping, 396, no_mapping, 397, no_mapping, 398, no_mapping,
+    399, no_mapping, 400, no_mapping, 401, no_mapping, no_mapping, 402, no_mapping, 403, no_mapping, 404,
+    no_mapping, 405, no_mapping, 406, no_mapping, 407, no_mapping, 408, no_mapping, 409, no_mapping, 410,
+    no_mapping, 411, no_mapping, 412, no_mapping, 413, no_mapping, 414, no_mapping, 415, no_mapping, 416,
+    no_mapping, 417, no_mapping, 418, no_mapping, 419, no_mapping, 420, no_mapping, 421, no_mapping, 422,
+    no_mapping, 423, no_mapping, 424, no_mapping, 425, no_mapping, 426, no_mapping, 427, no_mapping, 428,
+    no_mapping, 429, no_mapping, 430, no_mapping, 431, no_mapping, 432, no_mapping, 433, no_mapping, 434,
+    no_mapping, 435, no_mapping, 436, no_mapping, 437, no_mapping, 438, no_mapping, 439, no_mapping, 440,
+    no_mapping, 441, no_mapping, 442, no_mapping, 443, no_mapping, 444, no_mapping, 445, no_mapping, 446,
+    no_mapping, 447, no_mapping, 448, no_mapping, 449, no_mapping, 450, no_mapping, 451, no_mapping, 452,
+    no_mapping, 453, no_mapping, 454, no_mapping, 455, no_mapping, 456, no_mapping, no_mapping, 457, 458,
+    459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470,
+    471, 472, 473, 474, 475, 476, 477, 478, 479, 480, 481, 482,
+    483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494,
+    no_mapping, no_mapping, 495, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, 496, 497, 498, 499, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, 500, 501, 502,
+    503, 504, 505, 506, 507, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, 508, 509, no_mapping, 510, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, 511, no_mapping,
+    no_mapping, 512, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, 513, 514, 515, no_mapping, no_mapping, 516, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, 517, 518, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, 519, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, 520, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, 521, 522, no_mapping, no_mapping, no_mapping, 523, no_mapping, 524, no_mapping, no_mapping, no_mapping,
+    525, no_mapping, 526, no_mapping, 527, no_mapping, 528, no_mapping, 529, no_mapping, no_mapping, no_mapping,
+    530, no_mapping, 531, 532, 533, 534, 535, no_mapping, 536, no_mapping, 537, no_mapping,
+    no_mapping, no_mapping, 538, no_mapping, 539, no_mapping, 540, no_mapping, 541, no_mapping, 542, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, 543, no_mapping, 544, no_mapping, no_mapping,
+    545, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, 546, 547, 548, 549, 550, 551, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, 328,
+    330, 340, 343, 344, 352, 359, 552, no_mapping, 553, 554, 555, 556,
+    557, 558, 559, 560, 561, 562, 563, 564, 545, 565, 566, 567,
+    568, 569, 570, 571, 572, 573, 574, 575, 576, 577, 578, 579,
+    580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591,
+    592, 593, 594, no_mapping, 595, 596, 597, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    0, 44, 1, no_mapping, 3, 4, 141, 6, 7, 8, 9, 10,
+    11, 12, 13, no_mapping, 14, 214, 15, 17, 19, 20, 22, 0,
+    598, 599, 600, 1, 3, 4, 142, 143, 601, 6, no_mapping, 10,
+    12, 106, 14, 136, 602, 603, 15, 19, 20, 604, 150, 21,
+    605, 269, 270, 271, 286, 287, 8, 17, 20, 21, 269, 270,
+    282, 286, 287, no_mapping, 339, no_mapping, 606, 2, 607, 54, 601, 5,
+    608, 609, 610, 148, 147, 611, 612, 613, 614, 615, 616, 617,
+    618, 151, 619, 620, 152, 621, 622, 158, 623, 229, 162, 624,
+    163, 230, 25, 625, 626, 166, 275, no_mapping, 627, no_mapping, 628, no_mapping,
+    629, no_mapping, 630, no_mapping, 631, no_mapping, 632, no_mapping, 633, no_mapping, 634, no_mapping,
+    635, no_mapping, 636, no_mapping, 637, no_mapping, 638, no_mapping, 639, no_mapping, 640, no_mapping,
+    641, no_mapping, 642, no_mapping, 643, no_mapping, 644, no_mapping, 645, no_mapping, 646, no_mapping,
+    647, no_mapping, 648, no_mapping, 649, no_mapping, 650, no_mapping, 651, no_mapping, 652, no_mapping,
+    653, no_mapping, 654, no_mapping, 655, no_mapping, 656, no_mapping, 657, no_mapping, 658, no_mapping,
+    659, no_mapping, 660, no_mapping, 661, no_mapping, 662, no_mapping, 663, no_mapping, 664, no_mapping,
+    665, no_mapping, 666, no_mapping, 667, no_mapping, 668, no_mapping, 669, no_mapping, 670, no_mapping,
+    671, no_mapping, 672, no_mapping, 673, no_mapping, 674, no_mapping, 675, no_mapping, 676, no_mapping,
+    677, no_mapping, 678, no_mapping, 679, no_mapping, 680, no_mapping, 681, no_mapping, 682, no_mapping,
+    683, no_mapping, 684, no_mapping, 685, no_mapping, 686, no_mapping, 687, no_mapping, 688, no_mapping,
+    689, no_mapping, 690, no_mapping, 691, no_mapping, 692, no_mapping, 693, no_mapping, 694, no_mapping,
+    695, no_mapping, 696, no_mapping, 697, no_mapping, 698, no_mapping, 699, no_mapping, 700, no_mapping,
+    701, no_mapping, 702, 675, no_mapping, 703, no_mapping, 704, no_mapping, 705, no_mapping, 706,
+    no_mapping, 707, no_mapping, 708, no_mapping, 709, no_mapping, 710, no_mapping, 711, no_mapping, 712,
+    no_mapping, 713, no_mapping, 714, no_mapping, 715, no_mapping, 716, no_mapping, 717, no_mapping, 718,
+    no_mapping, 719, no_mapping, 720, no_mapping, 721, no_mapping, 722, no_mapping, 723, no_mapping, 724,
+    no_mapping, 725, no_mapping, 726, no_mapping, 727, no_mapping, 728, no_mapping, 729, no_mapping, 730,
+    no_mapping, 731, no_mapping, 732, no_mapping, 733, no_mapping, 734, no_mapping, 735, no_mapping, 736,
+    no_mapping, 737, no_mapping, 738, no_mapping, 739, no_mapping, 740, no_mapping, 741, no_mapping, 742,
+    no_mapping, 743, no_mapping, 744, no_mapping, 745, no_mapping, 746, no_mapping, 747, no_mapping, 748,
+    no_mapping, 749, no_mapping, 750, no_mapping, 751, no_mapping, 752, 753, 754, 755, 756,
+    757, 758, 759, no_mapping, no_mapping, 760, 761, 762, 763, 764, 765, no_mapping,
+    no_mapping, 766, 767, 768, 769, 770, 771, 772, 773, no_mapping, 774, 775,
+    776, 777, 778, 779, 780, 781, no_mapping, no_mapping, 782, 783, 784, 785,
+    786, 787, no_mapping, no_mapping, no_mapping, 788, no_mapping, 789, no_mapping, 790, no_mapping, 791,
+    no_mapping, 792, 793, 794, 795, 796, 797, 798, 799, no_mapping, 260, no_mapping,
+    262, no_mapping, 263, no_mapping, 264, no_mapping, 265, no_mapping, 266, no_mapping, 267, no_mapping,
+    800, 801, 802, 803, 804, 805, 806, 807, 800, 801, 802, 803,
+    804, 805, 806, 807, 808, 809, 810, 811, 812, 813, 814, 815,
+    808, 809, 810, 811, 812, 813, 814, 815, 816, 817, 818, 819,
+    820, 821, 822, 823, 816, 817, 818, 819, 820, 821, 822, 823,
+    no_mapping, 824, 825, 826, no_mapping, no_mapping, 827, 828, 829, 830, 260, 825,
+    831, 251, 831, 832, 833, 834, 835, 836, no_mapping, no_mapping, 837, 838,
+    262, 839, 263, 835, 840, 841, 842, no_mapping, 843, no_mapping, no_mapping, 844,
+    845, 846, 264, no_mapping, 847, 848, 849, no_mapping, 850, no_mapping, 851, 852,
+    853, 266, 854, 855, 259, 856, no_mapping, 857, 858, 859, no_mapping, no_mapping,
+    860, 861, 265, 862, 267, 858, 31, 863, no_mapping, 26, no_mapping, 864,
+    no_mapping, no_mapping, 865, no_mapping, 866, no_mapping, no_mapping, no_mapping, no_mapping, 26, no_mapping, 867,
+    868, no_mapping, 869, 870, no_mapping, 871, no_mapping, 872, no_mapping, 873, 874, 875,
+    no_mapping, 876, no_mapping, 26, no_mapping, no_mapping, no_mapping, no_mapping, 877, 8, no_mapping, 878,
+    879, 880, 881, 882, 883, 884, 885, 886, 887, 888, 13, 877,
+    34, 29, 30, 878, 879, 880, 881, 882, 883, 884, 885, 886,
+    887, 888, no_mapping, 0, 4, 14, 23, 142, 7, 10, 11, 12,
+    13, 15, 18, 19, no_mapping, no_mapping, 889, no_mapping, no_mapping, no_mapping, no_mapping, 890,
+    891, 2, 892, no_mapping, 893, 894, 143, no_mapping, 895, 6, 7, 88,
+    8, 11, no_mapping, 13, 896, no_mapping, 15, 16, 17, no_mapping, 897, 898,
+    899, no_mapping, 25, no_mapping, 289, no_mapping, 25, no_mapping, 10, 43, 1, 2,
+    no_mapping, 4, 5, no_mapping, 12, 14, 900, 901, 902, 903, 8, no_mapping,
+    904, 281, 270, 281, 905, no_mapping, 3, 4, 8, 9, no_mapping, 906,
+    907, 908, 909, 910, 911, 912, 913, 914, 915, 916, 917, 918,
+    919, 920, 921, 8, 922, 923, 924, 21, 925, 926, 927, 928,
+    23, 929, 930, 11, 2, 3, 12, 8, 922, 923, 924, 21,
+    925, 926, 927, 928, 23, 929, 930, 11, 2, 3, 12, no_mapping,
+    no_mapping, no_mapping, 931, no_mapping, no_mapping, no_mapping, 932, 933, no_mapping, 934, 935, no_mapping,
+    936, 937, no_mapping, no_mapping, no_mapping, no_mapping, 34, 29, 30, 878, 879, 880,
+    881, 882, 883, 938, 939, 940, 941, 942, 943, 944, 945, 946,
+    947, 948, 949, 950, 951, 952, 953, 954, 955, 956, 957, 958,
+    959, 960, 961, 962, 963, 964, 965, 966, 967, 968, no_mapping, 969,
+    970, 971, 972, 973, 974, 975, 976, 977, 978, 979, 980, 981,
+    982, 983, 984, 985, 986, 987, 988, 989, 990, 991, 992, 993,
+    994, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10,
+    11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22,
+    23, 24, 25, 0, 1, 2, 3, 4, 5, 6, 7, 8,
+    9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20,
+    21, 22, 23, 24, 25, 877, no_mapping, 995, no_mapping, 996, 997, 998,
+    no_mapping, 999, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, 1000, 1001, 1002, 1003, 1004,
+    1005, 1006, 1007, 1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016,
+    1017, 1018, 1019, 1020, 1021, 1022, 1023, 1024, 1025, 1026, 1027, 1028,
+    1029, 1030, 1031, 1032, 1033, 1034, 1035, 1036, 1037, 1038, 1039, 1040,
+    1041, 1042, 1043, 1044, 1045, 1046, 1047, no_mapping, 1048, no_mapping, 1049, 1050,
+    1051, no_mapping, 1052, no_mapping, 1053, no_mapping, 1054, no_mapping, 599, 617, 598, 606,
+    no_mapping, 1055, no_mapping, 1056, no_mapping, 9, 21, 1057, 1058, 1059, no_mapping, 1060,
+    no_mapping, 1061, no_mapping, 1062, no_mapping, 1063, no_mapping, 1064, no_mapping, 1065, no_mapping, 1066,
+    no_mapping, 1067, no_mapping, 1068, no_mapping, 1069, no_mapping, 1070, no_mapping, 1071, no_mapping, 1072,
+    no_mapping, 1073, no_mapping, 1074, no_mapping, 1075, no_mapping, 1076, no_mapping, 1077, no_mapping, 1078,
+    no_mapping, 1079, no_mapping, 1080, no_mapping, 1081, no_mapping, 1082, no_mapping, 1083, no_mapping, 1084,
+    no_mapping, 1085, no_mapping, 1086, no_mapping, 1087, no_mapping, 1088, no_mapping, 1089, no_mapping, 1090,
+    no_mapping, 1091, no_mapping, 1092, no_mapping, 1093, no_mapping, 1094, no_mapping, 1095, no_mapping, 1096,
+    no_mapping, 1097, no_mapping, 1098, no_mapping, 1099, no_mapping, 1100, no_mapping, 1101, no_mapping, 1102,
+    no_mapping, 1103, no_mapping, 1104, no_mapping, 1105, no_mapping, 1106, no_mapping, 1107, no_mapping, 1108,
+    no_mapping, 1109, no_mapping, 1110, no_mapping, 1111, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, 1112, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, 1113, no_mapping, 1114, no_mapping, 1115, 1116,
+    1117, 1118, 1119, 1120, 1121, 1122, 1123, 1124, 1125, 1126, 1127, 1128,
+    1129, 1130, 1131, 1132, 1133, 1134, 1135, 1136, 1137, 1138, 1139, 1140,
+    1141, 1142, 1143, 1144, 1145, 1146, 1147, 1148, 1149, 1150, 1151, 1152,
+    1153, 1154, 1155, 1156, 1157, 1158, 1159, 1160, 1161, 1162, 1163, 1164,
+    1165, 1166, 1167, 1168, 1169, 1170, 1171, 1172, 1173, 1174, 1175, 1176,
+    1177, 1178, 1179, 1180, 1181, 1182, 1183, 1184, 1185, 1186, 1187, 1188,
+    1189, 1190, 1191, 1192, 1193, 1194, 1195, 1196, 1197, 1198, 1199, 1200,
+    1201, 1202, 1203, 1204, 1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212,
+    1213, 1214, 1215, 1216, 1217, 1218, 1219, 1220, 1221, 1222, 1223, 1224,
+    1225, 1226, 1227, 1228, 1229, 1230, 1231, 1232, 1233, 1234, 1235, 1236,
+    1237, 1238, 1239, 1240, 1241, 1242, 1243, 1244, 1245, 1246, 1247, 1248,
+    1249, 1250, 1251, 1252, 1253, 1254, 1255, 1256, 1257, 1258, 1259, 1260,
+    1261, 1262, 1263, 1264, 1265, 1266, 1267, 1268, 1269, 1270, 1271, 1272,
+    1273, 1274, 1275, 1276, 1277, 1278, 1279, 1280, 1281, 1282, 1283, 1284,
+    1285, 1286, 1287, 1288, 1289, 1290, 1291, 1292, 1293, 1294, 1295, 1296,
+    1297, 1298, 1299, 1300, 1301, 1302, 1303, 1304, 1305, 1306, 1307, 1308,
+    1309, 1310, 1311, 1312, 1313, 1314, 1315, 1316, 1317, 1318, 1319, 1320,
+    1321, 1322, 1323, 1324, 1325, 1326, 1327, 1328, no_mapping, 26, no_mapping, 1329,
+    no_mapping, 1330, no_mapping, 1138, 1331, 1332, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, 1333,
+    1334, no_mapping, 1335, no_mapping, 1336, no_mapping, no_mapping, no_mapping, 1337, 1338, 1339, 1340,
+    1341, 1342, 1343, 1344, 1345, 1346, 1347, 1348, 1349, 1350, 1351, 1352,
+    1353, 1354, 1355, 1356, 1357, 1358, 1359, 1360, 1361, 1362, 1363, 1364,
+    1365, 1366, 1367, 1368, 1369, 1370, 1371, 1372, 1373, 1374, 1375, 1376,
+    1377, 1378, 1379, 1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387, no_mapping,
+    1388, 1389, 1390, 1391, 1392, 1393, 1394, 1395, 1396, 1397, 1398, 1399,
+    1400, 1401, 1402, 1403, 1404, 1405, 1406, 1407, 1408, 1409, 1410, 1411,
+    1412, 1413, 1414, 1415, 1416, 1417, 1418, 1419, 1420, 1421, 1422, 1423,
+    1424, 1425, 1426, 1427, 1428, 1429, no_mapping, no_mapping, 1115, 1121, 1430, 1431,
+    1432, 1433, 1434, 1435, 1119, 1436, 1437, 1438, 1439, 1123, no_mapping, no_mapping,
+    no_mapping, 1440, 1441, 1442, 1443, 1444, 1445, 1446, 1447, 1448, 1449, 1450,
+    1451, 1452, 1453, 1454, 1455, 1456, 1457, 1458, 1459, 1460, 1461, 1462,
+    1463, 1464, 1465, 1466, 1467, 1468, 1469, 1470, no_mapping, 1471, 1472, 1473,
+    1474, 1475, 1476, 1477, 1478, 1479, 1480, 1481, 1482, 1483, 1484, 1485,
+    1486, 1487, 1488, 1489, 1490, 1491, 1492, 1493, 1494, 1495, 1496, 1497,
+    1498, 1499, 1500, 1501, 1502, 1503, 1504, 1505, 1506, 1507, 1508, 1181,
+    1509, no_mapping, 1510, 1511, 1512, 1513, 1514, 1515, 1516, 1517, 1518, 1519,
+    1520, 1521, 1522, 1523, 1524, 1525, 1337, 1340, 1343, 1345, 1353, 1354,
+    1357, 1359, 1360, 1362, 1363, 1364, 1365, 1366, 1526, 1527, 1528, 1529,
+    1530, 1531, 1532, 1533, 1534, 1535, 1536, 1537, 1538, 1539, 1540, 1541,
+    1542, no_mapping, 1115, 1121, 1430, 1431, 1543, 1544, 1545, 1126, 1546, 1138,
+    1188, 1200, 1199, 1189, 1281, 1146, 1186, 1547, 1548, 1549, 1550, 1551,
+    1552, 1553, 1554, 1555, 1556, 1152, 1557, 1558, 1559, 1560, 1561, 1562,
+    1563, 1564, 1432, 1433, 1434, 1565, 1566, 1567, 1568, 1569, 1570, 1571,
+    1572, 1573, 1574, 1575, 1576, 1577, 1578, 1579, 1580, 1581, 1582, 1583,
+    1584, 1585, 1586, 1587, 1588, 1589, 1590, 1591, 1592, 1593, 1594, 1595,
+    1596, 1597, 1598, 1599, 1600, 1601, 1602, 1603, 1604, 1605, 1606, 1607,
+    1608, 1609, 1610, 1611, 1612, 1613, 1614, 1615, 1616, 1617, 1618, 1619,
+    1620, 1621, 1622, 1623, 1624, 1625, 1626, 1627, 1628, 1629, 1630, 1631,
+    1632, 1633, 1634, 1635, 1636, 1637, 1638, 1639, 1640, 1641, 1642, 1643,
+    1644, 1645, 1646, 1647, 1648, 1649, 1650, 1651, 1652, 1653, 1654, 1655,
+    1656, 1657, 1658, 1659, 1660, 1661, 1662, 1663, 1664, 1665, 1666, 1667,
+    1668, 1669, 1670, 1671, 1672, 1673, 1674, 1675, 1676, 1677, 1678, 1679,
+    1680, 1681, 1682, 1683, 1684, 1685, 1686, 1687, 1688, 1689, 1690, 1691,
+    1692, 1693, 1694, 1695, 1696, 1697, 1698, 1699, 1700, 1701, 1702, 1703,
+    1704, 1705, 1706, 1707, 1708, 1709, 1710, 1711, 1712, 1713, 1714, 1715,
+    1716, 1717, 1718, 1719, 1720, 1721, 1722, 1723, 1724, 1725, 1726, 1727,
+    1728, 1729, 1730, 1731, 1732, 1733, 1734, 1735, 1736, 1737, 1738, 1739,
+    1740, 1741, 1742, 1743, 1744, 1745, 1746, 1747, 1748, 1749, 1750, 1751,
+    1752, 1753, 1754, 1755, 1756, 1757, 1758, 1759, 1760, 1761, 1762, 1763,
+    1764, 1765, 1766, 1767, 1768, 1769, 1770, 1771, 1772, 1773, 1774, 1775,
+    1776, 1777, 1778, 1779, 1780, 1781, 1782, 1783, 1784, 1785, 1786, 1787,
+    1788, 1789, 1790, 1791, 1792, 1793, 1794, 1795, 1796, 1797, 1798, 1799,
+    1800, 1801, 1802, 1803, 1804, 1805, 1806, 1807, 1808, 1809, 1810, 1811,
+    1812, 1813, 1814, 1815, 1816, 1817, 1818, 1819, 1820, 1821, 1822, 1782,
+    1823, 1824, 1825, 1826, 1827, 1828, 1829, 1830, 1831, 1832, 1833, 1834,
+    1835, 1836, 1837, 1836, 1838, 1839, 1840, 1841, 1842, 1841, 1843, 1844,
+    no_mapping, 1845, 1846, 1847, 1848, no_mapping, 1849, 1850, 1851, 1852, 1853, 1854,
+    1812, 1855, 1856, 1857, 1858, 1859, 1788, 1860, 1861, 1862, no_mapping, 1863,
+    1864, 1865, 1866, 1867, 1868, 1869, 1870, 1871, 1872, 1873, 1874, 1875,
+    1876, 1877, 1878, 1879, 1880, 1881, 1882, 1883, 1884, 1885, 1886, 1887,
+    1888, 1889, 1890, 1891, 1892, 1893, 1894, 1895, 1896, 1897, 1898, 1899,
+    1900, 1901, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, 1902, no_mapping, 1903, no_mapping,
+    1904, no_mapping, 1905, no_mapping, 1906, no_mapping, 552, no_mapping, 1907, no_mapping, 1908, no_mapping,
+    1909, no_mapping, 1910, no_mapping, 1911, no_mapping, 1912, no_mapping, 1913, no_mapping, 1914, no_mapping,
+    1915, no_mapping, 1916, no_mapping, 1917, no_mapping, 1918, no_mapping, 1919, no_mapping, 1920, no_mapping,
+    1921, no_mapping, 1922, no_mapping, 1923, no_mapping, 1924, no_mapping, 1925, no_mapping, 1926, no_mapping,
+    1927, no_mapping, 1928, no_mapping, 1929, no_mapping, 1930, no_mapping, 1931, no_mapping, 1932, no_mapping,
+    1933, no_mapping, 1934, no_mapping, 1935, no_mapping, 1936, no_mapping, 1937, no_mapping, 352, 354,
+    no_mapping, no_mapping, no_mapping, 1938, no_mapping, 1939, no_mapping, 1940, no_mapping, 1941, no_mapping, 1942,
+    no_mapping, 1943, no_mapping, 1944, no_mapping, 1945, no_mapping, 1946, no_mapping, 1947, no_mapping, 1948,
+    no_mapping, 1949, no_mapping, 1950, no_mapping, 1951, no_mapping, 1952, no_mapping, 1953, no_mapping, 1954,
+    no_mapping, 1955, no_mapping, 1956, no_mapping, 1957, no_mapping, 1958, no_mapping, 1959, no_mapping, 1960,
+    no_mapping, 1961, no_mapping, 1962, no_mapping, 1963, no_mapping, 1964, no_mapping, 1965, no_mapping, 1966,
+    no_mapping, 1967, no_mapping, 1968, no_mapping, 1969, no_mapping, 1970, no_mapping, 1971, no_mapping, 1972,
+    no_mapping, 1973, no_mapping, 1974, no_mapping, 1975, no_mapping, 1975, no_mapping, 1976, no_mapping, 1977,
+    no_mapping, 1978, 1979, no_mapping, 1980, no_mapping, 1981, no_mapping, 1982, no_mapping, 1983, no_mapping,
+    1984, no_mapping, 610, no_mapping, 1985, no_mapping, 1986, no_mapping, 1987, no_mapping, 1988, no_mapping,
+    1989, no_mapping, 1990, no_mapping, 1991, no_mapping, 1992, no_mapping, 1993, no_mapping, 1994, no_mapping,
+    1995, no_mapping, 1996, no_mapping, 236, 601, 609, 1997, 611, no_mapping, 1998, 1999,
+    613, 2000, 2001, no_mapping, 2002, no_mapping, 2003, no_mapping, 2004, no_mapping, 2005, no_mapping,
+    2006, no_mapping, 2007, no_mapping, 2008, no_mapping, 2009, 622, 2010, 2011, no_mapping, 2012,
+    no_mapping, no_mapping, 2013, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, 2014, no_mapping, 2015, no_mapping,
+    no_mapping, 2, 5, 16, 2016, no_mapping, 88, 110, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, 1940, 2017, 1049, 2018, no_mapping, 2019, no_mapping, no_mapping, 2020, 2021, 2022,
+    2023, 2024, 2025, 2026, 2027, 2028, 2029, 2030, 2031, 2032, 2033, 2034,
+    2035, 2036, 2037, 2038, 2039, 2040, 2041, 2042, 2043, 2044, 2045, 2046,
+    2047, 2048, 2049, 2050, 2051, 2052, 2053, 2054, 2055, 2056, 2057, 2058,
+    2059, 2060, 2061, 2062, 2063, 2064, 2065, 2066, 2067, 2068, 2069, 2070,
+    2071, 2072, 2073, 2074, 2075, 2076, 2077, 2078, 2079, 2080, 2081, 2082,
+    2083, 2084, 2085, 2086, 2087, 2088, 2089, 2090, 2091, 2092, 2093, 2094,
+    2095, 2096, 2097, 2098, 2099, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, 2100, 2101, 1273, 2102, 2103, 2104, 2105, 1327, 2106,
+    1281, 2107, 2108, 2109, 2110, 2111, 2112, 2113, 2114, 2115, 2116, 2117,
+    2118, 2119, 2120, 2121, 2122, 2123, 2124, 2125, 2126, 2127, 2128, 2129,
+    2130, 2131, 2132, 2133, 2134, 2135, 2136, 2137, 2138, 2139, 2140, 2141,
+    2142, 2143, 2144, 2145, 2146, 2147, 1239, 2148, 2149, 2150, 2151, 2152,
+    2153, 2154, 2155, 2156, 2157, 2158, 1312, 2159, 2160, 2161, 2162, 2163,
+    2164, 2165, 2166, 2167, 2168, 2169, 2170, 2171, 2172, 2173, 2174, 2175,
+    2176, 2177, 2178, 2179, 2180, 2181, 2182, 2183, 2184, 2185, 2116, 2186,
+    2187, 2188, 2189, 2190, 2191, 2192, 2193, 2194, 2195, 2196, 2197, 2198,
+    2199, 2200, 2201, 2202, 2203, 2204, 2205, 1275, 2206, 2207, 2208, 2209,
+    2210, 2211, 2212, 2213, 2214, 2215, 2216, 2217, 2218, 2219, 2220, 1152,
+    2221, 2222, 2223, 2224, 2225, 2226, 2227, 2228, 1133, 2229, 2230, 2231,
+    2232, 2233, 2234, 2235, 2236, 2237, 2238, 2239, 2240, 2241, 2242, 2243,
+    2244, 2245, 2246, 2247, 2248, 2249, 2250, 2204, 2251, 2252, 2253, 2254,
+    2255, 2256, 2257, 2258, 2188, 2259, 2260, 2261, 2262, 2263, 2264, 2265,
+    2266, 2267, 2268, 2269, 2270, 2271, 2272, 2273, 2274, 2275, 2276, 2277,
+    2278, 2116, 2279, 2280, 2281, 2282, 1326, 2283, 2284, 2285, 2286, 2287,
+    2288, 2289, 2290, 2291, 2292, 2293, 2294, 1544, 2295, 2296, 2297, 2298,
+    2299, 2300, 2301, 2302, 2303, 2190, 2304, 2305, 2306, 2307, 2308, 2309,
+    2310, 2311, 2312, 2313, 2314, 2315, 2316, 1280, 2317, 2318, 2319, 2320,
+    2321, 2322, 2323, 2324, 2325, 2326, 2327, 2328, 2329, 1231, 2330, 2331,
+    2332, 2333, 2334, 2335, 2336, 2337, 2338, 2339, 2340, 2341, 2342, 2343,
+    2344, 2345, 1258, 2346, 1261, 2347, 2348, 2349, no_mapping, 2350, no_mapping, 2351,
+    no_mapping, 2352, 2353, 2354, 2355, 2356, 2357, 2358, 2359, 2360, 1238, no_mapping,
+    2361, no_mapping, 2362, no_mapping, 2363, 2364, no_mapping, 2365, 2366, 2367, 2368, 2369,
+    2370, 2371, 2372, 2373, 2374, 2375, 2376, 2377, 2378, 2379, 2380, 2381,
+    2382, 1159, 2383, 2384, 2385, 2386, 2387, 2388, 2389, 2390, 2391, 2392,
+    2393, 2394, 2395, 2396, 2397, 1549, 2398, 2399, 2400, 2401, 1553, 2402,
+    2403, 2404, 2405, 2406, 2240, 2407, 2408, 2409, 2410, 2411, 2412, 2413,
+    2414, 2415, 2416, 2417, 2418, 2419, 2420, 2363, 2421, 2422, 2423, 2424,
+    2425, 2426, no_mapping, 2427, 2428, 2429, 2430, 2431, 2432, 2433, 2434, 2377,
+    2435, 2436, 2437, 2350, 2438, 2439, 2440, 2441, 2442, 2443, 2444, 2445,
+    2446, 2447, 2448, 2449, 2385, 2450, 2386, 2451, 2452, 2453, 2454, 2455,
+    2351, 2137, 2456, 2457, 1192, 2205, 2288, 2458, 2459, 2393, 2460, 2394,
+    2461, 2462, 2463, 2353, 2464, 2465, 2466, 2467, 2468, 2354, 2469, 2470,
+    2471, 2472, 2473, 2474, 2406, 2475, 2476, 2240, 2477, 2410, 2478, 2479,
+    2480, 2481, 2482, 2415, 2483, 2362, 2484, 2416, 2186, 2485, 2417, 2486,
+    2419, 2487, 2488, 2489, 2490, 2491, 2421, 2359, 2492, 2422, 2493, 2423,
+    2494, 1327, 2495, 2496, 2497, 2498, 2499, 2500, 2501, 2502, 2503, 2504,
+    2505, no_mapping, 2506, 2507, 2508, 2509, 2510, 2511, no_mapping, 2512, 2513, 2514,
+    2515, 2516, no_mapping, 2517, no_mapping, 2518, 2519, 900, 903, 2520, 2521, 2522,
+    2523, 2524, 2525, 884, 2526, 2527, 2528, 2529, 2530, 2531, 2532, 2533,
+    2534, 2535, 2536, 2537, 2538, no_mapping, 2539, 2540, 2541, 2542, 2543, no_mapping,
+    2544, no_mapping, 2545, 2546, no_mapping, 2547, 2548, no_mapping, 2549, 2550, 2551, 2552,
+    2553, 2554, 2555, 2556, 2557, 2558, 2559, 2560, 2561, 2562, 2563, 2564,
+    2565, 2566, 2567, 2568, 2569, 2570, 2571, 2572, 2573, 2574, 2575, 2576,
+    2577, 2578, 2579, 2580, 2581, 2582, 2583, 2584, 2585, 2586, 2587, 2588,
+    no_mapping, no_mapping, 2589, 2590, 2591, 2592, 498, 2593, 2594, 2595, 2596, 2597,
+    2598, 2599, 2600, 2601, 2602, 2603, 2604, 2605, 2606, 2607, 2608, 2609,
+    2605, 2610, 2611, 2612, 2613, 2614, 2615, 2616, 2617, 2618, 2619, 2620,
+    2621, 2622, 2623, 2624, 2625, 2626, 2627, 2628, 2629, 2630, 2631, 2632,
+    2633, 2634, 2635, 2636, 2637, 2638, 2639, 2640, 2641, 2642, 2643, 2644,
+    2645, 2646, 2647, 2648, 2649, 2650, 2651, 2652, 2653, 2654, 2655, 2656,
+    2657, 2658, 2659, 2660, 2661, 2662, 2663, 2664, 2665, 2666, 2667, 2668,
+    2669, 2670, 2671, 2672, 2673, 2674, 2675, 2676, 2677, 2678, 2679, 2680,
+    2681, 2682, 2683, 2684, 2685, 2686, 2687, 2688, 2689, 2690, 2691, 2692,
+    2693, 2694, 2695, 2696, 2697, 2698, 2699, 2700, 2701, 2702, 2703, 2704,
+    2705, 2706, 2707, 2609, 2708, 2605, 2610, 2709, 2710, 2614, 2711, 2615,
+    2616, 2712, 2713, 2620, 2714, 2621, 2622, 2715, 2716, 2624, 2717, 2625,
+    2626, 2655, 2656, 2659, 2660, 2661, 2665, 2666, 2667, 2668, 2672, 2673,
+    2674, 2718, 2678, 2719, 2720, 2684, 2721, 2685, 2686, 2699, 2722, 2723,
+    2694, 2724, 2695, 2696, 2607, 2608, 2725, 2609, 2726, 2611, 2612, 2613,
+    2614, 2727, 2617, 2618, 2619, 2620, 2728, 2624, 2627, 2628, 2629, 2630,
+    2631, 2633, 2634, 2635, 2636, 2637, 2638, 2729, 2639, 2640, 2641, 2642,
+    2643, 2644, 2646, 2647, 2648, 2649, 2650, 2651, 2652, 2653, 2654, 2657,
+    2658, 2662, 2663, 2664, 2665, 2666, 2669, 2670, 2671, 2672, 2730, 2675,
+    2676, 2677, 2678, 2681, 2682, 2683, 2684, 2731, 2687, 2688, 2732, 2691,
+    2692, 2693, 2694, 2733, 2609, 2726, 2614, 2727, 2620, 2728, 2624, 2734,
+    2637, 2735, 2736, 2737, 2665, 2666, 2672, 2684, 2731, 2694, 2733, 2738,
+    2739, 2740, 2741, 2742, 2743, 2744, 2745, 2746, 2747, 2748, 2749, 2750,
+    2751, 2752, 2753, 2754, 2755, 2756, 2757, 2758, 2759, 2760, 2761, 2762,
+    2763, 2736, 2764, 2765, 2766, 2767, 2741, 2742, 2743, 2744, 2745, 2746,
+    2747, 2748, 2749, 2750, 2751, 2752, 2753, 2754, 2755, 2756, 2757, 2758,
+    2759, 2760, 2761, 2762, 2763, 2736, 2764, 2765, 2766, 2767, 2761, 2762,
+    2763, 2736, 2735, 2737, 2645, 2634, 2635, 2636, 2761, 2762, 2763, 2645,
+    2646, 2768, no_mapping, 2769, 2770, 2771, 2772, 2773, 2774, 2775, 2776, 2777,
+    2778, 2779, 2780, 2781, 2782, 2783, 2784, 2785, 2786, 2787, 2788, 2789,
+    2790, 2791, 2792, 2793, 2794, 2795, 2796, 2797, 2798, 2799, 2800, 2801,
+    2802, 2803, 2804, 2805, 2806, 2807, 2808, 2809, 2810, 2811, 2812, 2813,
+    2814, 2815, 2816, 2817, no_mapping, 2818, 2819, 2820, 2821, 2822, 2823, 2824,
+    2825, 2826, 2827, 2828, 2829, 2830, 2831, 2832, 2833, 2834, 2835, 2836,
+    2837, 2838, 2839, 2840, 2841, 2842, 2843, 2844, 2845, 2846, 2847, 2848,
+    2849, 2803, 2805, 2850, 2851, 2852, 2853, 2854, 2855, 2854, 2852, 2856,
+    2857, 2858, 2859, 2860, 2855, 2796, 2786, 2861, 2862, no_mapping, no_mapping, no_mapping,
+    2863, 2864, 2865, 2866, 2867, 2868, 2869, 2870, 2871, 2872, 2873, 2874,
+    2875, no_mapping, no_mapping, 2876, 2877, no_mapping, 2878, 257, 2879, 2880, 2881, 2882,
+    no_mapping, no_mapping, no_mapping, 2883, 2884, 2885, 887, 888, 2886, 2887, 2888, 2889,
+    2890, 2891, 2892, 2893, 936, 937, 2894, 2895, 2896, 2897, no_mapping, 2898,
+    2899, 872, 2885, 2876, 2877, no_mapping, 257, 2878, 2880, 2879, 2883, 887,
+    888, 2886, 2887, 2888, 2889, 2900, 2901, 2902, 884, 2903, 2904, 2905,
+    886, no_mapping, 2906, 2907, 2908, 2909, no_mapping, 2910, 2911, 2912, no_mapping, 2913,
+    no_mapping, 2914, 2915, 2916, 2917, 2918, 2919, 2920, 2921, 2922, 2923, 2924,
+    2925, 2926, 2927, 2928, 2929, 2930, 2931, 2932, 2933, 2934, 2935, 2936,
+    2937, 2938, 2939, 2940, 2941, 2942, 2943, 2944, 2945, 2946, 2947, 2948,
+    2949, 2950, 2951, 2952, 2953, 2954, 2955, 2956, 2957, 2597, 2958, 2959,
+    2960, 2961, 2962, no_mapping, no_mapping, no_mapping, 2879, 2963, 2900, 2907, 2908, 2901,
+    2964, 887, 888, 2902, 884, 2876, 2903, 1329, 2965, 877, 34, 29,
+    30, 878, 879, 880, 881, 882, 883, 2878, 257, 2904, 886, 2905,
+    2880, 2909, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9,
+    10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21,
+    22, 23, 24, 25, 2898, 2906, 2899, 2966, 2885, 856, 0, 1,
+    2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13,
+    14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25,
+    2886, 2967, 2887, 2968, 2969, 2970, 1329, 2894, 2895, 2877, 2971, 1652,
+    2972, 2973, 2974, 2975, 2976, 2977, 2978, 2979, 2980, 2981, 1606, 1607,
+    1608, 1609, 1610, 1611, 1612, 1613, 1614, 1615, 1616, 1617, 1618, 1619,
+    1620, 1621, 1622, 1623, 1624, 1625, 1626, 1627, 1628, 1629, 1630, 1631,
+    1632, 1633, 1634, 1635, 1636, 1637, 1638, 1639, 1640, 1641, 1642, 1643,
+    1644, 1645, 1646, 1647, 1648, 1649, 2982, 2983, 2984, no_mapping, 1337, 1338,
+    1339, 1340, 1341, 1342, 1343, 1344, 1345, 1346, 1347, 1348, 1349, 1350,
+    1351, 1352, 1353, 1354, 1355, 1356, 1357, 1358, 1359, 1360, 1361, 1362,
+    1363, 1364, 1365, 1366, no_mapping, 1367, 1368, 1369, 1370, 1371, 1372, no_mapping,
+    1373, 1374, 1375, 1376, 1377, 1378, no_mapping, 1379, 1380, 1381, 1382, 1383,
+    1384, no_mapping, 1385, 1386, 1387, no_mapping, 2985, 2986, 2987, 28, 2988, 2989,
+    2990, no_mapping, 2991, 2992, 2993, 2994, 2995, 2996, 2997, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, 2998, 2999, 3000, 3001, 3002, 3003,
+    3004, 3005, 3006, 3007, 3008, 3009, 3010, 3011, 3012, 3013, 3014, 3015,
+    3016, 3017, 3018, 3019, 3020, 3021, 3022, 3023, 3024, 3025, 3026, 3027,
+    3028, 3029, 3030, 3031, 3032, 3033, 3034, 3035, 3036, 3037, no_mapping, no_mapping,
+    no_mapping, no_mapping, 3038, 3039, 3040, 3041, 3042, 3043, 3044, 3045, 3046, 3047,
+    3048, 3049, 3050, 3051, 3052, 3053, 3054, 3055, 3056, 3057, 3058, 3059,
+    3060, 3061, 3062, 3063, 3064, 3065, 3066, 3067, 3068, 3069, 3070, 3071,
+    3072, 3073, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, 3074, 3075,
+    3076, 3077, 3078, 3079, 3080, 3081, 3082, 3083, 3084, no_mapping, 3085, 3086,
+    3087, 3088, 3089, 3090, 3091, 3092, 3093, 3094, 3095, 3096, 3097, 3098,
+    3099, no_mapping, 3100, 3101, 3102, 3103, 3104, 3105, 3106, no_mapping, 3107, 3108,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, 3109, 3110, 44, 3111, 133, no_mapping, 3112, 3113,
+    3114, 3115, 138, 139, 3116, 3117, 3118, 3119, 3120, 3121, 145, 3122,
+    88, 3123, 3124, 3125, 3126, 3127, 1997, 3128, 3129, 3130, 3131, 3132,
+    3133, 61, 3134, 3135, 16, 3136, 3137, 1051, 3138, 156, 3139, 3140,
+    3141, 3142, 160, 3143, no_mapping, 3144, 3145, 3146, 3147, 3148, 3149, 3150,
+    3151, 3152, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, 3153, 3154, 3155,
+    3156, 3157, 3158, 3159, 3160, 3161, 3162, 3163, 3164, 3165, 3166, 3167,
+    3168, 3169, 3170, 3171, 3172, 3173, 3174, 3175, 3176, 3177, 3178, 3179,
+    3180, 3181, 3182, 3183, 3184, 3185, 3186, 3187, 3188, 3189, 3190, 3191,
+    3192, 3193, 3194, 3195, 3196, 3197, 3198, 3199, 3200, 3201, 3202, 3203,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, 3204, 3205, 3206, 3207, 3208, 3209, 3210,
+    3211, 3212, 3213, 3214, 3215, 3216, 3217, 3218, 3219, 3220, 3221, 3222,
+    3223, 3224, 3225, 3226, 3227, 3228, 3229, 3230, 3231, 3232, 3233, 3234,
+    3235, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, 3236, 3237, 3238, 3239, 3240, 3241, 3242,
+    3243, 3244, 3245, 3246, 3247, 3248, 3249, 3250, 3251, 3252, 3253, 3254,
+    3255, 3256, 3257, 3258, 3259, 3260, 3261, 3262, 3263, 3264, 3265, 3266,
+    3267, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, 3268,
+    3269, 3270, 3271, 3272, 3273, 3274, no_mapping, no_mapping, no_mapping, 3275, 3276, 3277,
+    3278, 3279, 3280, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, 0, 1, 2, 3, 4, 5, 6, 7, 8,
+    9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20,
+    21, 22, 23, 24, 25, 0, 1, 2, 3, 4, 5, 6,
+    7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+    19, 20, 21, 22, 23, 24, 25, 0, 1, 2, 3, 4,
+    5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+    17, 18, 19, 20, 21, 22, 23, 24, 25, 0, 1, 2,
+    3, 4, 5, 6, no_mapping, 8, 9, 10, 11, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 0,
+    1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12,
+    13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+    25, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10,
+    11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22,
+    23, 24, 25, 0, no_mapping, 2, 3, no_mapping, 6, no_mapping, 9, 10,
+    no_mapping, 13, 14, 15, 16, no_mapping, 18, 19, 20, 21, 22, 23,
+    24, 25, 0, 1, 2, 3, no_mapping, 5, no_mapping, 7, 8, 9,
+    10, 11, 12, 13, no_mapping, 15, 16, 17, 18, 19, 20, 21,
+    22, 23, 24, 25, 0, 1, 2, 3, 4, 5, 6, 7,
+    8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19,
+    20, 21, 22, 23, 24, 25, 0, 1, 2, 3, 4, 5,
+    6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17,
+    18, 19, 20, 21, 22, 23, 24, 25, 0, 1, no_mapping, 3,
+    4, 5, 6, no_mapping, 9, 10, 11, 12, 13, 14, 15, 16,
+    no_mapping, 18, 19, 20, 21, 22, 23, 24, no_mapping, 0, 1, 2,
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 0,
+    1, no_mapping, 3, 4, 5, 6, no_mapping, 8, 9, 10, 11, 12,
+    no_mapping, 14, no_mapping, 18, 19, 20, 21, 22, 23, 24, no_mapping, 0,
+    1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12,
+    13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+    25, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10,
+    11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22,
+    23, 24, 25, 0, 1, 2, 3, 4, 5, 6, 7, 8,
+    9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20,
+    21, 22, 23, 24, 25, 0, 1, 2, 3, 4, 5, 6,
+    7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+    19, 20, 21, 22, 23, 24, 25, 0, 1, 2, 3, 4,
+    5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+    17, 18, 19, 20, 21, 22, 23, 24, 25, 0, 1, 2,
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 0,
+    1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12,
+    13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+    25, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10,
+    11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22,
+    23, 24, 25, 0, 1, 2, 3, 4, 5, 6, 7, 8,
+    9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20,
+    21, 22, 23, 24, 25, 0, 1, 2, 3, 4, 5, 6,
+    7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+    19, 20, 21, 22, 23, 24, 25, 0, 1, 2, 3, 4,
+    5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+    17, 18, 19, 20, 21, 22, 23, 24, 25, 0, 1, 2,
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 0,
+    1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12,
+    13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+    25, 3281, 3282, no_mapping, 268, 269, 270, 271, 272, 273, 274, 275,
+    251, 276, 277, 32, 278, 279, 280, 281, 282, 275, 283, 284,
+    285, 286, 287, 288, 289, 3283, 268, 269, 270, 271, 272, 273,
+    274, 275, 251, 276, 277, 32, 278, 279, 280, 281, 282, 283,
+    284, 285, 286, 287, 288, 289, 3284, 272, 275, 276, 286, 282,
+    281, 268, 269, 270, 271, 272, 273, 274, 275, 251, 276, 277,
+    32, 278, 279, 280, 281, 282, 275, 283, 284, 285, 286, 287,
+    288, 289, 3283, 268, 269, 270, 271, 272, 273, 274, 275, 251,
+    276, 277, 32, 278, 279, 280, 281, 282, 283, 284, 285, 286,
+    287, 288, 289, 3284, 272, 275, 276, 286, 282, 281, 268, 269,
+    270, 271, 272, 273, 274, 275, 251, 276, 277, 32, 278, 279,
+    280, 281, 282, 275, 283, 284, 285, 286, 287, 288, 289, 3283,
+    268, 269, 270, 271, 272, 273, 274, 275, 251, 276, 277, 32,
+    278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289,
+    3284, 272, 275, 276, 286, 282, 281, 268, 269, 270, 271, 272,
+    273, 274, 275, 251, 276, 277, 32, 278, 279, 280, 281, 282,
+    275, 283, 284, 285, 286, 287, 288, 289, 3283, 268, 269, 270,
+    271, 272, 273, 274, 275, 251, 276, 277, 32, 278, 279, 280,
+    281, 282, 283, 284, 285, 286, 287, 288, 289, 3284, 272, 275,
+    276, 286, 282, 281, 268, 269, 270, 271, 272, 273, 274, 275,
+    251, 276, 277, 32, 278, 279, 280, 281, 282, 275, 283, 284,
+    285, 286, 287, 288, 289, 3283, 268, 269, 270, 271, 272, 273,
+    274, 275, 251, 276, 277, 32, 278, 279, 280, 281, 282, 283,
+    284, 285, 286, 287, 288, 289, 3284, 272, 275, 276, 286, 282,
+    281, 295, no_mapping, 877, 34, 29, 30, 878, 879, 880, 881, 882,
+    883, 877, 34, 29, 30, 878, 879, 880, 881, 882, 883, 877,
+    34, 29, 30, 878, 879, 880, 881, 882, 883, 877, 34, 29,
+    30, 878, 879, 880, 881, 882, 883, 877, 34, 29, 30, 878,
+    879, 880, 881, 882, 883, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, 326, 327, 328, 329, 330, 331, 332, 333, 334, 336, 337,
+    338, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350,
+    353, 355, 356, 1928, 413, 316, 318, 421, 393, 3285, 326, 327,
+    328, 329, 330, 331, 332, 333, 334, 336, 337, 340, 341, 343,
+    345, 346, 347, 348, 349, 350, 352, 353, 378, 316, 315, 325,
+    391, 1909, 394, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, 3286, 3287,
+    3288, 3289, 3290, 3291, 3292, 3293, 3294, 3295, 3296, 3297, 3298, 3299,
+    3300, 3301, 3302, 3303, 3304, 3305, 3306, 3307, 3308, 3309, 3310, 3311,
+    3312, 3313, 3314, 3315, 3316, 3317, 3318, 3319, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, 2930, 2931, 2935, 2938, no_mapping, 2957,
+    2941, 2936, 2946, 2958, 2952, 2953, 2954, 2955, 2942, 2948, 2950, 2944,
+    2951, 2940, 2943, 2933, 2934, 2937, 2939, 2945, 2947, 2949, 3320, 2582,
+    3321, 3322, no_mapping, 2931, 2935, no_mapping, 2956, no_mapping, 2936, no_mapping, 2958, 2952,
+    2953, 2954, 2955, 2942, 2948, 2950, 2944, 2951, no_mapping, 2943, 2933, 2934,
+    2937, no_mapping, 2945, no_mapping, 2949, no_mapping, 2935, no_mapping, 2936, no_mapping, 2958, no_mapping,
+    2953, no_mapping, 2955, 2942, 2948, no_mapping, 2944, 2951, no_mapping, 2943, no_mapping, 2937,
+    no_mapping, 2945, no_mapping, 2949, no_mapping, 2582, no_mapping, 3322, no_mapping, 2931, 2935, no_mapping,
+    2956, no_mapping, 2936, 2946, 2958, 2952, no_mapping, 2954, 2955, 2942, 2948, 2950,
+    2944, 2951, no_mapping, 2943, 2933, 2934, 2937, no_mapping, 2945, 2947, 2949, 3320,
+    no_mapping, 3321, no_mapping, 2930, 2931, 2935, 2938, 2956, 2957, 2941, 2936, 2946,
+    2958, no_mapping, 2953, 2954, 2955, 2942, 2948, 2950, 2944, 2951, 2940, 2943,
+    2933, 2934, 2937, 2939, 2945, 2947, 2949, no_mapping, 2931, 2935, 2938, no_mapping,
+    2957, 2941, 2936, 2946, 2958, no_mapping, 2953, 2954, 2955, 2942, 2948, 2950,
+    2944, 2951, 2940, 2943, 2933, 2934, 2937, 2939, 2945, 2947, 2949, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, 3323, 3324, 3325, 3326, 3327, 3328, 3329, 3330, 3331, 3332,
+    no_mapping, 969, 970, 971, 972, 973, 974, 975, 976, 977, 978, 979,
+    980, 981, 982, 983, 984, 985, 986, 987, 988, 989, 990, 991,
+    992, 993, 994, 3333, 2, 17, 1847, 3334, no_mapping, 0, 1, 2,
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 3335,
+    1836, 3336, 68, 3337, 3338, no_mapping, 3339, 3340, 3341, no_mapping, 3342, no_mapping,
+    no_mapping, no_mapping, 3343, 3344, 1616, no_mapping, 1178, 3345, 3346, 3347, 1121, 3348,
+    3349, 1438, 3350, 3351, 3352, 2278, 3353, 3354, 3355, 3356, 3357, 3358,
+    1214, 3359, 3360, 3361, 3362, 3363, 3364, 1115, 1430, 3365, 1565, 1433,
+    1566, 3366, 1270, 3367, 3368, 3369, 3370, 3371, 1548, 1188, 3372, 3373,
+    3374, 3375, no_mapping, 3376, 3377, 3378, 3379, 3380, 3381, 3382, 3383, 3384,
+    no_mapping, 3385, 3386, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, 877, 34, 29, 30, 878, 879,
+    880, 881, 882, 883, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping, no_mapping, 3387, 3388, 3389, 3390, 3391, 2371, 3392,
+    3393, 3394, 3395, 2372, 3396, 3397, 3398, 2373, 3399, 3400, 3401, 3402,
+    3403, 3404, 3355, 3405, 3406, 3407, 3408, 3409, 2428, 3410, 1131, 3411,
+    3412, 3413, 3414, 3373, 3415, 3416, 2433, 2374, 2375, 2434, 3417, 3418,
+    2192, 3419, 2376, 3420, 3421, 3422, 3423, 3424, 3425, 3426, 3427, 3428,
+    3429, 3430, 3431, 3432, 3433, 3434, 3435, 3436, 3437, 3438, 3439, 3440,
+    3441, 2436, 3442, 3443, 3444, 3445, 2378, 3446, 3447, 3448, 2338, 3449,
+    3450, 3451, 3452, 3453, 3454, 3455, 3456, 3457, 3458, 3459, 3460, 3348,
+    3461, 3462, 3463, 3464, 3465, 3466, 3467, 3468, 3469, 3470, no_mapping, 3471,
+    3472, 3473, 3474, 3475, 2188, 3476, 3477, 3478, 3479, no_mapping, 1157, 3480,
+    3481, 1159, 3482, 3483, 3484, 3485, 3486, 3487, 3488, 3489, 3490, 3491,
+    3492, 3493, 3494, 3495, 3496, 3497, 3498, 3499, 3500, 3501, 3502, 2136,
+    3503, 1169, 3504, 3505, 3506, 3507, 3508, 3509, 3510, 3511, 3512, 3513,
+    3514, 3515, 3516, 3517, 3518, 3519, 2383, 3520, 3521, 3522, 3523, 2448,
+    3523, 3524, 2385, 3525, 3526, 3527, 3528, 2386, 2109, 3529, 3530, 3531,
+    3532, 3533, 3534, 3535, 3536, 3537, 3538, 3539, 3540, 3541, 3542, 3543,
+    3544, 3545, 3546, 3547, 3548, 3549, 3550, 2387, 3551, 3552, 3553, 3554,
+    3555, 3556, 2389, 3557, 3558, 3559, 3560, 3561, 3562, 3563, 3564, 2137,
+    2456, 3565, 3566, 3567, 3568, 3569, 3570, 3571, 3572, 2390, 3573, 3574,
+    3575, 3576, 2498, 3577, 3578, 3579, 3580, 3581, 3582, 3583, 3584, 3585,
+    3586, 3587, 3588, 3589, 2205, 3590, 3591, 3592, 3593, 3594, 3595, 3596,
+    3597, 3598, 3599, 3600, 2391, 2288, 3601, 3602, 3603, 3604, 3605, 3606,
+    3607, 3608, 2459, 3609, 3610, 3611, 3612, 3613, 3614, 3615, 3616, 2460,
+    3617, 3618, 3619, 3620, 3621, 3622, 3623, 3624, 3625, 3626, no_mapping, 3627,
+    2462, 3628, 3629, 3630, 3631, 3632, 3633, 3634, 3635, 3636, 3637, 3638,
+    3639, 3640, 2464, 3641, 3642, 3643, 3644, 3645, 3646, 3647, 2191, 3648,
+    3649, 3650, 3651, 3652, 3653, 3654, 2470, 3655, 3656, 3657, 3658, 3659,
+    3660, 2471, 2500, 3661, 3662, 3663, 3664, 3665, 2154, 2473, 3666, 3667,
+    2401, 3668, 3669, 2358, 3670, 3671, 2404, 3672, 3673, 3674, 3675, no_mapping,
+    3676, 3677, 3678, 3679, 3680, 3681, 3682, 3683, 3684, 3685, 3686, 3687,
+    3688, 3689, 3690, 3691, 3692, 3693, 3694, 3695, 3696, 3697, 3698, 3699,
+    3700, 3701, 2410, 3702, 3703, 3704, 3705, 3706, 3707, 3708, 3709, 3710,
+    3711, 3712, 3713, 3714, 3715, 3716, 3717, 3505, 3718, 3719, 3720, 3721,
+    3722, 3723, 3724, 3725, 3726, 3727, 3728, 3729, 2208, 3730, 3731, 3732,
+    3733, 3734, 3735, 2413, 3736, 3737, 3738, 3739, 3740, 3741, 3742, 3743,
+    3744, 3745, 3746, 3747, 3748, 3749, 3750, 3751, 3752, 3753, 3754, 3755,
+    2149, 3756, 3757, 3758, 3759, 3760, 3761, 2480, 3762, 3763, 3764, no_mapping,
+    3765, 3766, 3767, 3768, 1259, 3769, 3770, 3771, 3772, 3773, 3774, 3775,
+    3776, 3777, 3778, 3779, 2485, 2486, 1266, 3780, 3781, 3782, 3783, 3784,
+    3785, 3786, 3787, 3788, 3789, 3790, 3791, 2487, 3792, 3793, 3794, 3795,
+    3796, 3797, 3798, 3799, 3800, 3801, 3802, 3803, 3804, 3805, 3806, 3807,
+    3808, 3809, 3810, 3811, 3812, 3813, 3814, 3815, 3816, 3817, 3818, 3819,
+    3820, 3821, 2493, 3822, 3823, 3824, 3825, 3826, 3827, 3828, 3829, 3830,
+    3831, 2494, 3832, 3833, 3834, 3835, 3836, 3837, 3838, 3839, 3840, 3841,
+    1314, 3842, 1318, 3843, 3844, 3845, 3846, 1323, 3847, no_mapping, no_mapping, no_mapping,
+    no_mapping, no_mapping, no_mapping, no_mapping,
+};
+
+pub const no_mapping: u16 = 0xffff;
+/// Replacement text of mapping i: mapping_data[mapping_offsets[i]..mapping_offsets[i + 1]]
+pub const mapping_offsets = [_]u16{
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+    12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+    24, 25, 26, 27, 30, 33, 34, 35, 38, 40, 43, 44,
+    49, 54, 59, 61, 63, 65, 67, 69, 71, 73, 75, 77,
+    79, 81, 83, 85, 87, 89, 91, 93, 95, 97, 99, 101,
+    103, 105, 107, 109, 111, 113, 115, 117, 119, 121, 123, 125,
+    127, 129, 131, 133, 135, 137, 139, 141, 143, 145, 147, 149,
+    151, 153, 155, 157, 159, 161, 163, 165, 167, 169, 172, 174,
+    176, 178, 180, 182, 184, 187, 189, 191, 193, 195, 198, 200,
+    202, 204, 206, 208, 210, 212, 214, 216, 218, 220, 222, 224,
+    226, 228, 230, 232, 234, 236, 238, 240, 242, 244, 246, 248,
+    250, 252, 254, 256, 258, 260, 262, 264, 266, 268, 270, 272,
+    274, 276, 278, 280, 282, 284, 286, 288, 290, 292, 294, 296,
+    298, 300, 302, 304, 306, 308, 310, 312, 314, 316, 318, 320,
+    322, 324, 327, 329, 331, 333, 335, 337, 339, 341, 343, 345,
+    347, 349, 351, 353, 355, 357, 359, 361, 363, 365, 367, 369,
+    371, 373, 375, 377, 379, 381, 383, 385, 387, 389, 391, 393,
+    395, 397, 399, 401, 403, 405, 407, 409, 411, 413, 415, 417,
+    419, 421, 423, 425, 427, 429, 431, 433, 436, 438, 440, 443,
+    445, 447, 449, 451, 453, 455, 457, 459, 461, 463, 465, 467,
+    469, 472, 475, 478, 481, 484, 487, 489, 491, 493, 495, 499,
+    501, 503, 505, 507, 509, 512, 513, 515, 520, 522, 524, 526,
+    528, 530, 532, 534, 536, 538, 540, 542, 544, 546, 548, 550,
+    552, 554, 556, 558, 560, 562, 564, 566, 568, 570, 572, 574,
+    576, 578, 580, 582, 584, 586, 588, 590, 592, 594, 596, 598,
+    600, 602, 604, 606, 608, 610, 612, 614, 616, 618, 620, 622,
+    624, 626, 628, 630, 632, 634, 636, 638, 640, 642, 644, 646,
+    648, 650, 652, 654, 656, 658, 660, 662, 664, 666, 668, 670,
+    672, 674, 676, 678, 680, 682, 684, 686, 688, 690, 692, 694,
+    696, 698, 700, 702, 704, 706, 708, 710, 712, 714, 716, 718,
+    720, 722, 724, 726, 728, 730, 732, 734, 736, 738, 740, 742,
+    744, 746, 748, 750, 752, 754, 756, 758, 760, 762, 764, 766,
+    768, 770, 772, 774, 776, 778, 780, 782, 784, 786, 788, 790,
+    792, 794, 796, 798, 800, 802, 804, 806, 808, 810, 812, 814,
+    816, 818, 820, 822, 824, 826, 828, 830, 832, 834, 836, 838,
+    840, 842, 844, 846, 848, 850, 852, 854, 856, 858, 860, 862,
+    864, 866, 868, 870, 872, 874, 876, 878, 880, 882, 884, 886,
+    888, 890, 892, 894, 896, 898, 900, 902, 904, 906, 908, 910,
+    912, 914, 916, 918, 920, 922, 924, 926, 928, 930, 932, 934,
+    936, 938, 940, 942, 944, 946, 948, 950, 952, 954, 956, 958,
+    960, 962, 964, 966, 968, 970, 972, 974, 976, 978, 980, 982,
+    984, 986, 988, 990, 994, 998, 1002, 1006, 1010, 1016, 1022, 1028,
+    1034, 1040, 1046, 1052, 1058, 1064, 1070, 1076, 1082, 1088, 1094, 1100,
+    1106, 1112, 1118, 1124, 1130, 1136, 1142, 1148, 1151, 1157, 1163, 1169,
+    1175, 1181, 1187, 1193, 1199, 1205, 1214, 1220, 1229, 1235, 1241, 1247,
+    1253, 1259, 1265, 1271, 1274, 1277, 1280, 1283, 1286, 1289, 1292, 1295,
+    1298, 1301, 1304, 1307, 1310, 1313, 1316, 1319, 1322, 1325, 1328, 1331,
+    1334, 1337, 1340, 1343, 1346, 1349, 1352, 1355, 1358, 1361, 1364, 1367,
+    1370, 1373, 1376, 1379, 1382, 1385, 1388, 1391, 1394, 1397, 1400, 1403,
+    1406, 1409, 1412, 1415, 1418, 1421, 1424, 1427, 1430, 1433, 1436, 1438,
+    1440, 1443, 1445, 1448, 1451, 1454, 1457, 1459, 1461, 1463, 1465, 1467,
+    1469, 1472, 1474, 1476, 1479, 1481, 1483, 1485, 1487, 1489, 1491, 1493,
+    1495, 1498, 1500, 1502, 1505, 1508, 1511, 1514, 1517, 1520, 1523, 1526,
+    1529, 1532, 1535, 1538, 1541, 1544, 1547, 1550, 1553, 1556, 1559, 1562,
+    1565, 1568, 1571, 1574, 1577, 1580, 1583, 1586, 1589, 1592, 1595, 1598,
+    1601, 1604, 1607, 1610, 1613, 1616, 1619, 1622, 1625, 1628, 1631, 1634,
+    1637, 1640, 1643, 1646, 1649, 1652, 1655, 1658, 1661, 1664, 1667, 1670,
+    1673, 1676, 1679, 1682, 1685, 1688, 1691, 1694, 1697, 1700, 1703, 1706,
+    1709, 1712, 1715, 1718, 1721, 1724, 1727, 1730, 1732, 1735, 1738, 1741,
+    1744, 1747, 1750, 1753, 1756, 1759, 1762, 1765, 1768, 1771, 1774, 1777,
+    1780, 1783, 1786, 1789, 1792, 1795, 1798, 1801, 1804, 1807, 1810, 1813,
+    1816, 1819, 1822, 1825, 1828, 1831, 1834, 1837, 1840, 1843, 1846, 1849,
+    1852, 1855, 1858, 1861, 1864, 1867, 1870, 1873, 1876, 1879, 1882, 1885,
+    1888, 1891, 1894, 1897, 1900, 1903, 1906, 1909, 1912, 1915, 1918, 1921,
+    1924, 1927, 1930, 1933, 1936, 1939, 1942, 1945, 1948, 1951, 1954, 1957,
+    1960, 1963, 1966, 1969, 1972, 1975, 1978, 1981, 1984, 1987, 1990, 1993,
+    1996, 1999, 2002, 2005, 2008, 2011, 2014, 2017, 2020, 2025, 2030, 2035,
+    2040, 2045, 2050, 2055, 2060, 2065, 2070, 2075, 2080, 2085, 2090, 2095,
+    2100, 2105, 2110, 2115, 2120, 2125, 2130, 2135, 2140, 2145, 2149, 2153,
+    2158, 2161, 2164, 2167, 2170, 2173, 2178, 2183, 2187, 2191, 2196, 2199,
+    2202, 2207, 2212, 2217, 2219, 2222, 2225, 2228, 2233, 2238, 2243, 2245,
+    2248, 2251, 2254, 2257, 2262, 2263, 2268, 2272, 2276, 2281, 2284, 2287,
+    2290, 2290, 2293, 2296, 2302, 2311, 2317, 2326, 2328, 2331, 2333, 2335,
+    2337, 2349, 2350, 2351, 2352, 2353, 2354, 2355, 2356, 2357, 2360, 2361,
+    2362, 2363, 2365, 2368, 2371, 2374, 2377, 2380, 2383, 2385, 2387, 2390,
+    2392, 2394, 2396, 2398, 2400, 2403, 2406, 2411, 2416, 2422, 2427, 2432,
+    2437, 2442, 2447, 2452, 2457, 2462, 2467, 2472, 2477, 2482, 2486, 2488,
+    2491, 2493, 2495, 2498, 2502, 2504, 2506, 2509, 2514, 2520, 2529, 2535,
+    2544, 2547, 2550, 2552, 2554, 2556, 2558, 2560, 2562, 2564, 2566, 2568,
+    2570, 2572, 2575, 2578, 2581, 2584, 2587, 2590, 2593, 2596, 2599, 2603,
+    2607, 2611, 2615, 2619, 2623, 2627, 2631, 2635, 2639, 2643, 2646, 2649,
+    2652, 2655, 2658, 2661, 2664, 2667, 2670, 2673, 2676, 2679, 2682, 2685,
+    2688, 2691, 2694, 2697, 2700, 2703, 2706, 2709, 2712, 2715, 2718, 2721,
+    2733, 2736, 2738, 2741, 2746, 2749, 2752, 2755, 2758, 2761, 2764, 2767,
+    2770, 2773, 2776, 2779, 2782, 2785, 2788, 2791, 2794, 2797, 2800, 2803,
+    2806, 2809, 2812, 2815, 2818, 2821, 2824, 2827, 2830, 2833, 2836, 2839,
+    2842, 2845, 2848, 2851, 2854, 2857, 2860, 2863, 2866, 2869, 2872, 2875,
+    2878, 2881, 2884, 2887, 2890, 2893, 2895, 2898, 2900, 2903, 2906, 2909,
+    2912, 2915, 2917, 2919, 2922, 2925, 2928, 2931, 2934, 2937, 2940, 2943,
+    2946, 2949, 2952, 2955, 2958, 2961, 2964, 2967, 2970, 2973, 2976, 2979,
+    2982, 2985, 2988, 2991, 2994, 2997, 3000, 3003, 3006, 3009, 3012, 3015,
+    3018, 3021, 3024, 3027, 3030, 3033, 3036, 3039, 3042, 3045, 3048, 3051,
+    3054, 3057, 3060, 3063, 3066, 3069, 3072, 3075, 3078, 3081, 3084, 3087,
+    3090, 3093, 3096, 3099, 3102, 3105, 3108, 3111, 3114, 3117, 3120, 3123,
+    3126, 3129, 3132, 3135, 3138, 3141, 3144, 3147, 3150, 3153, 3156, 3159,
+    3162, 3165, 3168, 3171, 3174, 3177, 3180, 3183, 3186, 3189, 3192, 3195,
+    3198, 3201, 3204, 3207, 3210, 3213, 3216, 3219, 3222, 3225, 3228, 3231,
+    3234, 3237, 3240, 3243, 3246, 3249, 3252, 3255, 3258, 3261, 3264, 3267,
+    3270, 3273, 3276, 3279, 3282, 3285, 3288, 3291, 3294, 3297, 3300, 3303,
+    3306, 3309, 3312, 3315, 3318, 3321, 3324, 3327, 3330, 3333, 3336, 3339,
+    3342, 3345, 3348, 3351, 3354, 3357, 3360, 3363, 3366, 3369, 3372, 3375,
+    3378, 3381, 3384, 3387, 3390, 3393, 3396, 3399, 3402, 3405, 3408, 3411,
+    3414, 3417, 3420, 3423, 3426, 3429, 3432, 3435, 3438, 3441, 3444, 3447,
+    3450, 3453, 3456, 3459, 3462, 3465, 3468, 3471, 3474, 3477, 3480, 3483,
+    3486, 3489, 3492, 3495, 3498, 3501, 3504, 3507, 3510, 3513, 3516, 3519,
+    3522, 3525, 3528, 3531, 3534, 3537, 3540, 3543, 3546, 3549, 3552, 3555,
+    3558, 3561, 3564, 3567, 3570, 3573, 3576, 3579, 3582, 3585, 3588, 3591,
+    3594, 3597, 3600, 3603, 3606, 3609, 3612, 3615, 3618, 3621, 3624, 3627,
+    3630, 3633, 3636, 3639, 3642, 3645, 3648, 3651, 3654, 3657, 3660, 3663,
+    3666, 3669, 3672, 3675, 3678, 3681, 3684, 3687, 3690, 3693, 3696, 3699,
+    3702, 3705, 3708, 3711, 3714, 3717, 3720, 3723, 3726, 3729, 3730, 3733,
+    3736, 3739, 3743, 3747, 3753, 3759, 3762, 3765, 3768, 3771, 3774, 3777,
+    3780, 3783, 3786, 3789, 3792, 3795, 3798, 3801, 3804, 3807, 3810, 3813,
+    3816, 3819, 3822, 3825, 3828, 3831, 3834, 3837, 3840, 3843, 3846, 3849,
+    3852, 3855, 3858, 3861, 3864, 3867, 3870, 3873, 3876, 3879, 3882, 3885,
+    3888, 3891, 3894, 3897, 3900, 3903, 3906, 3909, 3912, 3915, 3918, 3921,
+    3924, 3927, 3930, 3933, 3936, 3939, 3942, 3945, 3948, 3951, 3954, 3957,
+    3960, 3963, 3966, 3969, 3972, 3975, 3978, 3981, 3984, 3987, 3990, 3993,
+    3996, 3999, 4002, 4005, 4008, 4011, 4014, 4017, 4020, 4023, 4026, 4029,
+    4032, 4035, 4038, 4041, 4044, 4047, 4050, 4053, 4056, 4059, 4062, 4065,
+    4068, 4073, 4078, 4083, 4088, 4093, 4098, 4103, 4108, 4113, 4118, 4123,
+    4128, 4133, 4138, 4143, 4148, 4153, 4158, 4163, 4168, 4173, 4178, 4183,
+    4188, 4193, 4198, 4203, 4208, 4213, 4221, 4229, 4234, 4239, 4244, 4249,
+    4254, 4259, 4264, 4269, 4274, 4279, 4284, 4289, 4294, 4299, 4304, 4309,
+    4314, 4319, 4324, 4329, 4334, 4339, 4344, 4349, 4354, 4359, 4364, 4369,
+    4374, 4379, 4384, 4389, 4394, 4399, 4404, 4409, 4412, 4415, 4418, 4421,
+    4423, 4425, 4427, 4429, 4431, 4433, 4435, 4437, 4439, 4441, 4443, 4445,
+    4447, 4449, 4451, 4454, 4457, 4460, 4463, 4466, 4469, 4472, 4475, 4478,
+    4481, 4484, 4487, 4490, 4493, 4499, 4505, 4508, 4511, 4514, 4517, 4520,
+    4523, 4526, 4529, 4532, 4535, 4538, 4541, 4544, 4547, 4550, 4553, 4556,
+    4559, 4562, 4565, 4568, 4571, 4574, 4577, 4580, 4583, 4586, 4589, 4592,
+    4595, 4598, 4601, 4604, 4606, 4608, 4610, 4612, 4614, 4616, 4618, 4620,
+    4622, 4624, 4626, 4628, 4630, 4632, 4634, 4638, 4642, 4646, 4650, 4654,
+    4658, 4662, 4666, 4670, 4675, 4680, 4685, 4687, 4690, 4692, 4695, 4698,
+    4701, 4704, 4707, 4710, 4713, 4716, 4719, 4722, 4725, 4728, 4731, 4734,
+    4737, 4740, 4743, 4746, 4749, 4752, 4755, 4758, 4761, 4764, 4767, 4770,
+    4773, 4776, 4779, 4782, 4785, 4788, 4791, 4794, 4797, 4800, 4803, 4806,
+    4809, 4812, 4815, 4818, 4821, 4824, 4827, 4830, 4833, 4836, 4842, 4854,
+    4866, 4878, 4887, 4899, 4908, 4917, 4932, 4944, 4953, 4962, 4971, 4983,
+    4995, 5004, 5013, 5019, 5028, 5040, 5052, 5058, 5073, 5091, 5106, 5115,
+    5130, 5145, 5157, 5166, 5175, 5184, 5196, 5211, 5223, 5232, 5241, 5250,
+    5256, 5262, 5268, 5274, 5283, 5292, 5307, 5316, 5328, 5343, 5352, 5358,
+    5364, 5379, 5391, 5406, 5415, 5430, 5436, 5445, 5454, 5463, 5472, 5481,
+    5493, 5502, 5508, 5517, 5526, 5535, 5547, 5556, 5565, 5574, 5589, 5601,
+    5607, 5622, 5628, 5640, 5652, 5661, 5670, 5679, 5691, 5697, 5706, 5718,
+    5724, 5739, 5748, 5752, 5756, 5760, 5764, 5768, 5772, 5776, 5780, 5784,
+    5788, 5793, 5798, 5803, 5808, 5813, 5818, 5823, 5828, 5833, 5838, 5843,
+    5848, 5853, 5858, 5863, 5866, 5868, 5870, 5873, 5875, 5877, 5879, 5882,
+    5885, 5887, 5893, 5899, 5905, 5911, 5923, 5925, 5927, 5930, 5932, 5934,
+    5936, 5938, 5940, 5943, 5947, 5949, 5951, 5954, 5957, 5959, 5961, 5963,
+    5966, 5969, 5972, 5975, 5978, 5980, 5982, 5984, 5986, 5988, 5991, 5993,
+    5995, 5997, 6000, 6003, 6005, 6008, 6011, 6014, 6016, 6019, 6024, 6030,
+    6033, 6036, 6039, 6042, 6049, 6057, 6059, 6061, 6064, 6066, 6068, 6070,
+    6073, 6075, 6077, 6079, 6081, 6084, 6086, 6088, 6091, 6094, 6096, 6098,
+    6100, 6106, 6108, 6110, 6112, 6114, 6116, 6118, 6120, 6122, 6124, 6127,
+    6129, 6132, 6135, 6137, 6140, 6142, 6144, 6146, 6148, 6153, 6158, 6162,
+    6166, 6170, 6174, 6178, 6182, 6186, 6190, 6194, 6199, 6204, 6209, 6214,
+    6219, 6224, 6229, 6234, 6239, 6244, 6249, 6254, 6259, 6264, 6269, 6274,
+    6279, 6284, 6289, 6294, 6299, 6304, 6307, 6310, 6313, 6316, 6319, 6322,
+    6325, 6328, 6331, 6334, 6337, 6340, 6343, 6346, 6349, 6352, 6355, 6358,
+    6361, 6364, 6367, 6370, 6373, 6376, 6379, 6382, 6385, 6388, 6391, 6394,
+    6397, 6400, 6403, 6406, 6409, 6412, 6415, 6418, 6421, 6424, 6427, 6430,
+    6433, 6436, 6439, 6442, 6445, 6448, 6451, 6454, 6457, 6460, 6463, 6466,
+    6469, 6472, 6475, 6478, 6481, 6484, 6487, 6490, 6493, 6496, 6499, 6502,
+    6505, 6508, 6511, 6514, 6517, 6520, 6523, 6526, 6529, 6532, 6535, 6538,
+    6541, 6544, 6547, 6550, 6553, 6556, 6559, 6562, 6565, 6568, 6571, 6574,
+    6577, 6580, 6583, 6586, 6589, 6592, 6594, 6596, 6598, 6601, 6604, 6607,
+    6610, 6613, 6616, 6619, 6622, 6625, 6628, 6631, 6634, 6637, 6640, 6643,
+    6646, 6649, 6652, 6655, 6657, 6660, 6663, 6666, 6669, 6672, 6675, 6678,
+    6681, 6684, 6687, 6690, 6693, 6696, 6699, 6702, 6705, 6708, 6711, 6714,
+    6717, 6720, 6723, 6726, 6729, 6732, 6735, 6738, 6741, 6744, 6747, 6750,
+    6753, 6756, 6759, 6762, 6765, 6768, 6771, 6774, 6777, 6780, 6783, 6786,
+    6789, 6792, 6795, 6798, 6801, 6804, 6807, 6810, 6813, 6816, 6819, 6822,
+    6825, 6828, 6831, 6834, 6837, 6840, 6843, 6846, 6849, 6852, 6855, 6858,
+    6861, 6864, 6867, 6870, 6873, 6876, 6879, 6882, 6885, 6888, 6891, 6894,
+    6897, 6900, 6903, 6906, 6909, 6912, 6915, 6918, 6921, 6924, 6927, 6930,
+    6933, 6936, 6939, 6942, 6945, 6948, 6951, 6954, 6957, 6960, 6963, 6966,
+    6969, 6972, 6975, 6978, 6981, 6984, 6987, 6990, 6993, 6996, 6999, 7002,
+    7005, 7008, 7011, 7014, 7017, 7020, 7023, 7026, 7029, 7032, 7035, 7038,
+    7041, 7044, 7047, 7050, 7053, 7056, 7059, 7062, 7065, 7068, 7071, 7074,
+    7077, 7080, 7083, 7086, 7089, 7092, 7095, 7098, 7101, 7104, 7107, 7110,
+    7113, 7116, 7119, 7122, 7125, 7128, 7131, 7134, 7137, 7140, 7143, 7146,
+    7149, 7152, 7155, 7158, 7161, 7164, 7167, 7170, 7173, 7176, 7179, 7182,
+    7185, 7188, 7191, 7194, 7197, 7200, 7203, 7206, 7209, 7212, 7215, 7218,
+    7221, 7224, 7227, 7230, 7233, 7236, 7239, 7242, 7245, 7248, 7251, 7254,
+    7257, 7260, 7263, 7266, 7269, 7272, 7275, 7278, 7281, 7284, 7287, 7290,
+    7293, 7296, 7299, 7302, 7305, 7308, 7311, 7314, 7317, 7320, 7323, 7326,
+    7329, 7332, 7335, 7338, 7341, 7344, 7347, 7350, 7353, 7356, 7359, 7362,
+    7365, 7368, 7371, 7374, 7377, 7380, 7383, 7386, 7389, 7392, 7395, 7398,
+    7401, 7404, 7407, 7410, 7413, 7416, 7419, 7422, 7425, 7428, 7431, 7434,
+    7437, 7440, 7443, 7446, 7449, 7452, 7455, 7458, 7461, 7464, 7467, 7470,
+    7473, 7476, 7479, 7482, 7485, 7488, 7491, 7494, 7497, 7500, 7503, 7506,
+    7509, 7512, 7515, 7518, 7521, 7524, 7527, 7530, 7533, 7536, 7539, 7542,
+    7545, 7548, 7551, 7554, 7557, 7560, 7563, 7566, 7569, 7572, 7575, 7578,
+    7581, 7584, 7587, 7590, 7593, 7596, 7599, 7602, 7605, 7608, 7611, 7614,
+    7617, 7620, 7623, 7626, 7629, 7632, 7635, 7638, 7641, 7644, 7647, 7650,
+    7653, 7656, 7659, 7662, 7665, 7668, 7671, 7674, 7677, 7680, 7683, 7686,
+    7689, 7692, 7695, 7698, 7701, 7704, 7707, 7710, 7713, 7716, 7719, 7722,
+    7725, 7728, 7731, 7734, 7737, 7740, 7743, 7746, 7749, 7752, 7755, 7758,
+    7761, 7764, 7767, 7770, 7773, 7776, 7779, 7782, 7785, 7788, 7791, 7794,
+    7797, 7800, 7803, 7806, 7809, 7812, 7815, 7818, 7821, 7824, 7827, 7830,
+    7833, 7836, 7839, 7842, 7845, 7848, 7851, 7854, 7857, 7860, 7863, 7866,
+    7869, 7872, 7876, 7879, 7882, 7885, 7888, 7891, 7894, 7897, 7900, 7903,
+    7906, 7909, 7912, 7915, 7918, 7921, 7924, 7927, 7930, 7933, 7936, 7939,
+    7942, 7945, 7948, 7951, 7954, 7957, 7960, 7963, 7966, 7969, 7972, 7975,
+    7978, 7981, 7984, 7987, 7990, 7993, 7996, 7999, 8002, 8005, 8008, 8011,
+    8014, 8017, 8020, 8023, 8026, 8029, 8032, 8035, 8038, 8041, 8044, 8047,
+    8050, 8053, 8056, 8059, 8062, 8065, 8068, 8071, 8074, 8077, 8080, 8083,
+    8087, 8091, 8095, 8098, 8101, 8104, 8108, 8112, 8116, 8119, 8122, 8124,
+    8126, 8128, 8131, 8134, 8136, 8140, 8144, 8148, 8152, 8156, 8160, 8164,
+    8166, 8168, 8170, 8172, 8174, 8176, 8178, 8182, 8186, 8192, 8198, 8202,
+    8206, 8210, 8214, 8218, 8222, 8226, 8230, 8234, 8238, 8242, 8246, 8250,
+    8254, 8258, 8262, 8266, 8270, 8274, 8278, 8282, 8286, 8290, 8294, 8298,
+    8302, 8306, 8310, 8314, 8316, 8318, 8320, 8322, 8324, 8326, 8328, 8330,
+    8332, 8334, 8336, 8338, 8340, 8342, 8344, 8346, 8348, 8350, 8352, 8354,
+    8356, 8358, 8360, 8362, 8364, 8366, 8368, 8370, 8372, 8374, 8376, 8378,
+    8380, 8382, 8384, 8386, 8388, 8390, 8392, 8396, 8400, 8404, 8408, 8412,
+    8416, 8420, 8424, 8426, 8430, 8434, 8438, 8442, 8446, 8450, 8454, 8458,
+    8462, 8466, 8470, 8474, 8478, 8482, 8486, 8490, 8494, 8498, 8502, 8506,
+    8510, 8514, 8518, 8522, 8526, 8530, 8534, 8538, 8542, 8546, 8550, 8554,
+    8558, 8562, 8566, 8570, 8574, 8578, 8582, 8586, 8590, 8594, 8598, 8602,
+    8606, 8610, 8614, 8618, 8622, 8626, 8630, 8634, 8638, 8642, 8646, 8650,
+    8654, 8658, 8662, 8666, 8670, 8674, 8678, 8682, 8686, 8690, 8694, 8698,
+    8702, 8706, 8710, 8714, 8718, 8722, 8726, 8730, 8734, 8738, 8742, 8746,
+    8750, 8754, 8758, 8762, 8766, 8770, 8774, 8778, 8782, 8786, 8790, 8794,
+    8798, 8803, 8808, 8813, 8818, 8823, 8828, 8832, 8836, 8840, 8844, 8848,
+    8852, 8856, 8860, 8864, 8868, 8872, 8876, 8880, 8884, 8888, 8892, 8896,
+    8900, 8904, 8908, 8912, 8916, 8920, 8924, 8928, 8932, 8936, 8940, 8944,
+    8948, 8952, 8956, 8962, 8968, 8974, 8978, 8982, 8986, 8990, 8994, 8998,
+    9002, 9006, 9010, 9014, 9018, 9022, 9026, 9030, 9034, 9038, 9042, 9046,
+    9050, 9054, 9058, 9062, 9066, 9070, 9074, 9078, 9082, 9086, 9092, 9098,
+    9104, 9110, 9116, 9122, 9128, 9134, 9140, 9146, 9152, 9158, 9164, 9170,
+    9176, 9182, 9188, 9194, 9200, 9206, 9212, 9218, 9224, 9230, 9236, 9242,
+    9248, 9254, 9260, 9266, 9272, 9278, 9284, 9290, 9296, 9302, 9308, 9314,
+    9320, 9326, 9332, 9338, 9344, 9350, 9356, 9362, 9368, 9374, 9380, 9386,
+    9392, 9398, 9404, 9410, 9416, 9422, 9428, 9434, 9440, 9446, 9452, 9458,
+    9464, 9470, 9476, 9482, 9488, 9494, 9500, 9506, 9512, 9518, 9524, 9530,
+    9536, 9542, 9548, 9554, 9560, 9566, 9572, 9578, 9584, 9590, 9596, 9602,
+    9608, 9614, 9620, 9626, 9632, 9638, 9644, 9650, 9656, 9662, 9670, 9678,
+    9686, 9694, 9702, 9710, 9718, 9724, 9757, 9772, 9780, 9781, 9784, 9785,
+    9786, 9787, 9790, 9793, 9796, 9799, 9800, 9801, 9802, 9805, 9808, 9811,
+    9814, 9817, 9820, 9823, 9826, 9829, 9832, 9833, 9834, 9835, 9836, 9837,
+    9838, 9839, 9840, 9841, 9842, 9843, 9844, 9847, 9851, 9854, 9857, 9860,
+    9864, 9867, 9871, 9874, 9878, 9881, 9885, 9888, 9892, 9894, 9896, 9898,
+    9900, 9902, 9904, 9906, 9908, 9910, 9912, 9914, 9916, 9918, 9920, 9922,
+    9924, 9926, 9928, 9930, 9932, 9934, 9936, 9938, 9940, 9942, 9944, 9946,
+    9948, 9950, 9952, 9954, 9956, 9958, 9960, 9962, 9966, 9970, 9974, 9978,
+    9979, 9980, 9981, 9982, 9983, 9984, 9987, 9990, 9993, 9996, 9999, 10002,
+    10005, 10008, 10011, 10014, 10017, 10020, 10023, 10026, 10029, 10032, 10034, 10036,
+    10038, 10040, 10042, 10045, 10048, 10051, 10054, 10057, 10060, 10063, 10066, 10070,
+    10074, 10078, 10082, 10086, 10090, 10094, 10098, 10102, 10106, 10110, 10114, 10118,
+    10122, 10126, 10130, 10134, 10138, 10142, 10146, 10150, 10154, 10158, 10162, 10166,
+    10170, 10174, 10178, 10182, 10186, 10190, 10194, 10198, 10202, 10206, 10210, 10214,
+    10218, 10222, 10226, 10230, 10234, 10238, 10242, 10246, 10250, 10254, 10258, 10262,
+    10266, 10270, 10274, 10278, 10282, 10286, 10290, 10294, 10298, 10302, 10306, 10310,
+    10314, 10318, 10322, 10326, 10330, 10334, 10338, 10342, 10346, 10350, 10354, 10358,
+    10362, 10366, 10370, 10374, 10378, 10382, 10386, 10390, 10394, 10398, 10402, 10406,
+    10410, 10414, 10418, 10422, 10426, 10430, 10434, 10438, 10442, 10446, 10450, 10454,
+    10458, 10462, 10466, 10470, 10474, 10478, 10482, 10486, 10490, 10494, 10498, 10502,
+    10506, 10510, 10512, 10514, 10516, 10518, 10521, 10523, 10525, 10528, 10530, 10532,
+    10534, 10536, 10538, 10540, 10542, 10544, 10546, 10548, 10550, 10554, 10557, 10559,
+    10563, 10565, 10569, 10571, 10573, 10575, 10579, 10581, 10583, 10585, 10588, 10590,
+    10593, 10595, 10597, 10599, 10601, 10603, 10605, 10607, 10611, 10615, 10619, 10623,
+    10627, 10631, 10635, 10639, 10643, 10647, 10651, 10655, 10659, 10663, 10667, 10671,
+    10675, 10679, 10683, 10687, 10691, 10695, 10699, 10703, 10707, 10711, 10715, 10719,
+    10723, 10727, 10731, 10735, 10739, 10743, 10747, 10751, 10755, 10759, 10763, 10767,
+    10771, 10775, 10779, 10783, 10787, 10791, 10795, 10799, 10803, 10807, 10811, 10815,
+    10819, 10823, 10827, 10831, 10835, 10839, 10843, 10847, 10851, 10855, 10859, 10863,
+    10867, 10871, 10875, 10879, 10883, 10887, 10891, 10895, 10899, 10903, 10907, 10911,
+    10915, 10919, 10923, 10927, 10931, 10935, 10939, 10943, 10947, 10951, 10955, 10959,
+    10963, 10967, 10971, 10975, 10979, 10983, 10987, 10991, 10995, 10999, 11003, 11007,
+    11011, 11015, 11019, 11023, 11027, 11031, 11035, 11039, 11043, 11047, 11051, 11055,
+    11059, 11063, 11067, 11071, 11075, 11083, 11091, 11103, 11115, 11127, 11139, 11151,
+    11159, 11167, 11179, 11191, 11203, 11215, 11217, 11219, 11222, 11225, 11227, 11231,
+    11235, 11239, 11243, 11247, 11251, 11255, 11259, 11263, 11267, 11271, 11275, 11279,
+    11283, 11287, 11291, 11295, 11299, 11303, 11307, 11311, 11315, 11319, 11323, 11327,
+    11331, 11335, 11339, 11343, 11347, 11351, 11355, 11359, 11363, 11365, 11367, 11369,
+    11371, 11373, 11375, 11377, 11379, 11381, 11383, 11385, 11387, 11389, 11396, 11398,
+    11400, 11402, 11405, 11407, 11409, 11411, 11413, 11415, 11421, 11427, 11430, 11433,
+    11436, 11439, 11442, 11445, 11448, 11451, 11454, 11457, 11460, 11463, 11466, 11469,
+    11472, 11475, 11478, 11481, 11484, 11487, 11490, 11493, 11496, 11499, 11502, 11505,
+    11508, 11511, 11514, 11517, 11520, 11529, 11538, 11547, 11556, 11565, 11574, 11583,
+    11592, 11601, 11604, 11607, 11610, 11613, 11616, 11620, 11623, 11626, 11629, 11632,
+    11635, 11638, 11641, 11645, 11648, 11651, 11654, 11658, 11661, 11664, 11668, 11671,
+    11674, 11677, 11680, 11684, 11687, 11690, 11693, 11696, 11699, 11702, 11705, 11708,
+    11711, 11714, 11717, 11720, 11723, 11727, 11730, 11733, 11736, 11740, 11743, 11746,
+    11749, 11752, 11755, 11758, 11761, 11764, 11767, 11770, 11773, 11776, 11779, 11782,
+    11785, 11788, 11791, 11794, 11797, 11800, 11803, 11806, 11809, 11812, 11815, 11818,
+    11821, 11824, 11828, 11831, 11834, 11837, 11840, 11843, 11847, 11851, 11854, 11857,
+    11860, 11863, 11866, 11869, 11872, 11875, 11879, 11882, 11885, 11888, 11892, 11895,
+    11898, 11901, 11904, 11907, 11910, 11914, 11917, 11921, 11924, 11927, 11930, 11933,
+    11936, 11939, 11942, 11945, 11948, 11951, 11954, 11958, 11961, 11964, 11967, 11970,
+    11974, 11978, 11981, 11984, 11987, 11991, 11995, 11998, 12001, 12004, 12007, 12010,
+    12013, 12016, 12019, 12022, 12025, 12029, 12032, 12035, 12038, 12041, 12044, 12047,
+    12050, 12053, 12056, 12059, 12062, 12065, 12068, 12071, 12075, 12078, 12081, 12084,
+    12087, 12090, 12094, 12097, 12100, 12103, 12106, 12109, 12112, 12115, 12118, 12121,
+    12124, 12128, 12131, 12134, 12137, 12140, 12143, 12146, 12149, 12152, 12155, 12158,
+    12161, 12164, 12167, 12170, 12173, 12177, 12180, 12183, 12186, 12189, 12193, 12196,
+    12199, 12202, 12205, 12208, 12211, 12214, 12218, 12221, 12224, 12227, 12231, 12234,
+    12237, 12240, 12243, 12246, 12250, 12254, 12258, 12261, 12265, 12268, 12271, 12274,
+    12277, 12280, 12283, 12286, 12289, 12293, 12296, 12299, 12302, 12305, 12308, 12312,
+    12315, 12318, 12322, 12326, 12329, 12332, 12335, 12338, 12341, 12344, 12347, 12350,
+    12354, 12357, 12361, 12364, 12367, 12370, 12374, 12377, 12380, 12384, 12388, 12391,
+    12394, 12397, 12400, 12403, 12406, 12409, 12412, 12415, 12418, 12421, 12425, 12428,
+    12432, 12436, 12439, 12443, 12447, 12451, 12454, 12457, 12461, 12465, 12469, 12473,
+    12476, 12479, 12482, 12485, 12488, 12492, 12495, 12498, 12502, 12506, 12510, 12513,
+    12516, 12519, 12522, 12526, 12530, 12533, 12537, 12540, 12543, 12546, 12550, 12553,
+    12556, 12559, 12562, 12565, 12569, 12572, 12575, 12578, 12581, 12584, 12587, 12591,
+    12595, 12598, 12602, 12605, 12609, 12612, 12615, 12619, 12623, 12626, 12630, 12633,
+    12637, 12640, 12643, 12646, 12649, 12652, 12655, 12659, 12663, 12667, 12671, 12674,
+    12677, 12680, 12683, 12686, 12689, 12692, 12695, 12698, 12701, 12704, 12708, 12711,
+    12714, 12717, 12720, 12723, 12726, 12729, 12732, 12735, 12738, 12742, 12746, 12750,
+    12753, 12756, 12759, 12762, 12766, 12769, 12773, 12776, 12779, 12783, 12787, 12790,
+    12793, 12796, 12799, 12802, 12805, 12808, 12811, 12814, 12817, 12820, 12823, 12826,
+    12829, 12832, 12836, 12839, 12842, 12845, 12848, 12851, 12855, 12859, 12862, 12865,
+    12868, 12872, 12875, 12878, 12881, 12884, 12888, 12892, 12895, 12898, 12901, 12905,
+    12908, 12912, 12916, 12919, 12922, 12925, 12929, 12932, 12935, 12938, 12941, 12944,
+    12947, 12950, 12954, 12957, 12960, 12963, 12967, 12970, 12973, 12976, 12979, 12983,
+    12987, 12990, 12993, 12996, 13000, 13003, 13007, 13010, 13014, 13017, 13020, 13023,
+    13026, 13029, 13032, 13035, 13039, 13042, 13045, 13048, 13051, 13054, 13058, 13061,
+    13065, 13069, 13073, 13076, 13079, 13082, 13085, 13088, 13092,
+};
+
+pub const mapping_data: []const u8 =
+    "abcdefghijklmnopqrstuvwxyz  \u{308} \u{304}23 \u{301}\u{3bc} \u{327}11\u{2044}41\u{2044}2" ++
+    "3\u{2044}4\u{e0}\u{e1}\u{e2}\u{e3}\u{e4}\u{e5}\u{e6}\u{e7}\u{e8}\u{e9}\u{ea}\u{eb}\u{ec}" ++
+    "\u{ed}\u{ee}\u{ef}\u{f0}\u{f1}\u{f2}\u{f3}\u{f4}\u{f5}\u{f6}\u{f8}\u{f9}\u{fa}\u{fb}\u{fc}" ++
+    "\u{fd}\u{fe}ss\u{101}\u{103}\u{105}\u{107}\u{109}\u{10b}\u{10d}\u{10f}\u{111}\u{113}" ++
+    "\u{115}\u{117}\u{119}\u{11b}\u{11d}\u{11f}\u{121}\u{123}\u{125}\u{127}\u{129}\u{12b}" ++
+    "\u{12d}\u{12f}i\u{307}ij\u{135}\u{137}\u{13a}\u{13c}\u{13e}l\u{b7}\u{142}\u{144}\u{146}" ++
+    "\u{148}\u{2bc}n\u{14b}\u{14d}\u{14f}\u{151}\u{153}\u{155}\u{157}\u{159}\u{15b}\u{15d}" ++
+    "\u{15f}\u{161}\u{163}\u{165}\u{167}\u{169}\u{16b}\u{16d}\u{16f}\u{171}\u{173}\u{175}" ++
+    "\u{177}\u{ff}\u{17a}\u{17c}\u{17e}\u{253}\u{183}\u{185}\u{254}\u{188}\u{256}\u{257}\u{18c}" ++
+    "\u{1dd}\u{259}\u{25b}\u{192}\u{260}\u{263}\u{269}\u{268}\u{199}\u{26f}\u{272}\u{275}" ++
+    "\u{1a1}\u{1a3}\u{1a5}\u{280}\u{1a8}\u{283}\u{1ad}\u{288}\u{1b0}\u{28a}\u{28b}\u{1b4}" ++
+    "\u{1b6}\u{292}\u{1b9}\u{1bd}d\u{17e}ljnj\u{1ce}\u{1d0}\u{1d2}\u{1d4}\u{1d6}\u{1d8}\u{1da}" ++
+    "\u{1dc}\u{1df}\u{1e1}\u{1e3}\u{1e5}\u{1e7}\u{1e9}\u{1eb}\u{1ed}\u{1ef}dz\u{1f5}\u{195}" ++
+    "\u{1bf}\u{1f9}\u{1fb}\u{1fd}\u{1ff}\u{201}\u{203}\u{205}\u{207}\u{209}\u{20b}\u{20d}" ++
+    "\u{20f}\u{211}\u{213}\u{215}\u{217}\u{219}\u{21b}\u{21d}\u{21f}\u{19e}\u{223}\u{225}" ++
+    "\u{227}\u{229}\u{22b}\u{22d}\u{22f}\u{231}\u{233}\u{2c65}\u{23c}\u{19a}\u{2c66}\u{242}" ++
+    "\u{180}\u{289}\u{28c}\u{247}\u{249}\u{24b}\u{24d}\u{24f}\u{266}\u{279}\u{27b}\u{281}" ++
+    " \u{306} \u{307} \u{30a} \u{328} \u{303} \u{30b}\u{295}\u{300}\u{301}\u{313}\u{308}\u{301}" ++
+    "\u{3b9}\u{371}\u{373}\u{2b9}\u{377} \u{3b9};\u{3f3} \u{308}\u{301}\u{3ac}\u{b7}\u{3ad}" ++
+    "\u{3ae}\u{3af}\u{3cc}\u{3cd}\u{3ce}\u{3b1}\u{3b2}\u{3b3}\u{3b4}\u{3b5}\u{3b6}\u{3b7}" ++
+    "\u{3b8}\u{3ba}\u{3bb}\u{3bd}\u{3be}\u{3bf}\u{3c0}\u{3c1}\u{3c3}\u{3c4}\u{3c5}\u{3c6}" ++
+    "\u{3c7}\u{3c8}\u{3c9}\u{3ca}\u{3cb}\u{3d7}\u{3d9}\u{3db}\u{3dd}\u{3df}\u{3e1}\u{3e3}" ++
+    "\u{3e5}\u{3e7}\u{3e9}\u{3eb}\u{3ed}\u{3ef}\u{3f8}\u{3fb}\u{37b}\u{37c}\u{37d}\u{450}" ++
+    "\u{451}\u{452}\u{453}\u{454}\u{455}\u{456}\u{457}\u{458}\u{459}\u{45a}\u{45b}\u{45c}" ++
+    "\u{45d}\u{45e}\u{45f}\u{430}\u{431}\u{432}\u{433}\u{434}\u{435}\u{436}\u{437}\u{438}" ++
+    "\u{439}\u{43a}\u{43b}\u{43c}\u{43d}\u{43e}\u{43f}\u{440}\u{441}\u{442}\u{443}\u{444}" ++
+    "\u{445}\u{446}\u{447}\u{448}\u{449}\u{44a}\u{44b}\u{44c}\u{44d}\u{44e}\u{44f}\u{461}" ++
+    "\u{463}\u{465}\u{467}\u{469}\u{46b}\u{46d}\u{46f}\u{471}\u{473}\u{475}\u{477}\u{479}" ++
+    "\u{47b}\u{47d}\u{47f}\u{481}\u{48b}\u{48d}\u{48f}\u{491}\u{493}\u{495}\u{497}\u{499}" ++
+    "\u{49b}\u{49d}\u{49f}\u{4a1}\u{4a3}\u{4a5}\u{4a7}\u{4a9}\u{4ab}\u{4ad}\u{4af}\u{4b1}" ++
+    "\u{4b3}\u{4b5}\u{4b7}\u{4b9}\u{4bb}\u{4bd}\u{4bf}\u{4c2}\u{4c4}\u{4c6}\u{4c8}\u{4ca}" ++
+    "\u{4cc}\u{4ce}\u{4d1}\u{4d3}\u{4d5}\u{4d7}\u{4d9}\u{4db}\u{4dd}\u{4df}\u{4e1}\u{4e3}" ++
+    "\u{4e5}\u{4e7}\u{4e9}\u{4eb}\u{4ed}\u{4ef}\u{4f1}\u{4f3}\u{4f5}\u{4f7}\u{4f9}\u{4fb}" ++
+    "\u{4fd}\u{4ff}\u{501}\u{503}\u{505}\u{507}\u{509}\u{50b}\u{50d}\u{50f}\u{511}\u{513}" ++
+    "\u{515}\u{517}\u{519}\u{51b}\u{51d}\u{51f}\u{521}\u{523}\u{525}\u{527}\u{529}\u{52b}" ++
+    "\u{52d}\u{52f}\u{561}\u{562}\u{563}\u{564}\u{565}\u{566}\u{567}\u{568}\u{569}\u{56a}" ++
+    "\u{56b}\u{56c}\u{56d}\u{56e}\u{56f}\u{570}\u{571}\u{572}\u{573}\u{574}\u{575}\u{576}" ++
+    "\u{577}\u{578}\u{579}\u{57a}\u{57b}\u{57c}\u{57d}\u{57e}\u{57f}\u{580}\u{581}\u{582}" ++
+    "\u{583}\u{584}\u{585}\u{586}\u{565}\u{582}\u{627}\u{674}\u{648}\u{674}\u{6c7}\u{674}" ++
+    "\u{64a}\u{674}\u{915}\u{93c}\u{916}\u{93c}\u{917}\u{93c}\u{91c}\u{93c}\u{921}\u{93c}" ++
+    "\u{922}\u{93c}\u{92b}\u{93c}\u{92f}\u{93c}\u{9a1}\u{9bc}\u{9a2}\u{9bc}\u{9af}\u{9bc}" ++
+    "\u{a32}\u{a3c}\u{a38}\u{a3c}\u{a16}\u{a3c}\u{a17}\u{a3c}\u{a1c}\u{a3c}\u{a2b}\u{a3c}" ++
+    "\u{b21}\u{b3c}\u{b22}\u{b3c}\u{e4d}\u{e32}\u{ecd}\u{eb2}\u{eab}\u{e99}\u{eab}\u{ea1}" ++
+    "\u{f0b}\u{f42}\u{fb7}\u{f4c}\u{fb7}\u{f51}\u{fb7}\u{f56}\u{fb7}\u{f5b}\u{fb7}" ++
+    "\u{f40}\u{fb5}\u{f71}\u{f72}\u{f71}\u{f74}\u{fb2}\u{f80}\u{fb2}\u{f71}\u{f80}" ++
+    "\u{fb3}\u{f80}\u{fb3}\u{f71}\u{f80}\u{f71}\u{f80}\u{f92}\u{fb7}\u{f9c}\u{fb7}" ++
+    "\u{fa1}\u{fb7}\u{fa6}\u{fb7}\u{fab}\u{fb7}\u{f90}\u{fb5}\u{2d27}\u{2d2d}\u{10dc}\u{13f0}" ++
+    "\u{13f1}\u{13f2}\u{13f3}\u{13f4}\u{13f5}\u{a64b}\u{10d0}\u{10d1}\u{10d2}\u{10d3}\u{10d4}" ++
+    "\u{10d5}\u{10d6}\u{10d7}\u{10d8}\u{10d9}\u{10da}\u{10db}\u{10dd}\u{10de}\u{10df}\u{10e0}" ++
+    "\u{10e1}\u{10e2}\u{10e3}\u{10e4}\u{10e5}\u{10e6}\u{10e7}\u{10e8}\u{10e9}\u{10ea}\u{10eb}" ++
+    "\u{10ec}\u{10ed}\u{10ee}\u{10ef}\u{10f0}\u{10f1}\u{10f2}\u{10f3}\u{10f4}\u{10f5}\u{10f6}" ++
+    "\u{10f7}\u{10f8}\u{10f9}\u{10fa}\u{10fd}\u{10fe}\u{10ff}\u{250}\u{251}\u{1d02}\u{25c}" ++
+    "\u{1d16}\u{1d17}\u{1d1d}\u{1d25}\u{252}\u{255}\u{25f}\u{261}\u{265}\u{26a}\u{1d7b}\u{29d}" ++
+    "\u{26d}\u{1d85}\u{29f}\u{271}\u{270}\u{273}\u{274}\u{278}\u{282}\u{1ab}\u{1d1c}\u{290}" ++
+    "\u{291}\u{1e01}\u{1e03}\u{1e05}\u{1e07}\u{1e09}\u{1e0b}\u{1e0d}\u{1e0f}\u{1e11}\u{1e13}" ++
+    "\u{1e15}\u{1e17}\u{1e19}\u{1e1b}\u{1e1d}\u{1e1f}\u{1e21}\u{1e23}\u{1e25}\u{1e27}\u{1e29}" ++
+    "\u{1e2b}\u{1e2d}\u{1e2f}\u{1e31}\u{1e33}\u{1e35}\u{1e37}\u{1e39}\u{1e3b}\u{1e3d}\u{1e3f}" ++
+    "\u{1e41}\u{1e43}\u{1e45}\u{1e47}\u{1e49}\u{1e4b}\u{1e4d}\u{1e4f}\u{1e51}\u{1e53}\u{1e55}" ++
+    "\u{1e57}\u{1e59}\u{1e5b}\u{1e5d}\u{1e5f}\u{1e61}\u{1e63}\u{1e65}\u{1e67}\u{1e69}\u{1e6b}" ++
+    "\u{1e6d}\u{1e6f}\u{1e71}\u{1e73}\u{1e75}\u{1e77}\u{1e79}\u{1e7b}\u{1e7d}\u{1e7f}\u{1e81}" ++
+    "\u{1e83}\u{1e85}\u{1e87}\u{1e89}\u{1e8b}\u{1e8d}\u{1e8f}\u{1e91}\u{1e93}\u{1e95}a\u{2be}" ++
+    "\u{df}\u{1ea1}\u{1ea3}\u{1ea5}\u{1ea7}\u{1ea9}\u{1eab}\u{1ead}\u{1eaf}\u{1eb1}\u{1eb3}" ++
+    "\u{1eb5}\u{1eb7}\u{1eb9}\u{1ebb}\u{1ebd}\u{1ebf}\u{1ec1}\u{1ec3}\u{1ec5}\u{1ec7}\u{1ec9}" ++
+    "\u{1ecb}\u{1ecd}\u{1ecf}\u{1ed1}\u{1ed3}\u{1ed5}\u{1ed7}\u{1ed9}\u{1edb}\u{1edd}\u{1edf}" ++
+    "\u{1ee1}\u{1ee3}\u{1ee5}\u{1ee7}\u{1ee9}\u{1eeb}\u{1eed}\u{1eef}\u{1ef1}\u{1ef3}\u{1ef5}" ++
+    "\u{1ef7}\u{1ef9}\u{1efb}\u{1efd}\u{1eff}\u{1f00}\u{1f01}\u{1f02}\u{1f03}\u{1f04}\u{1f05}" ++
+    "\u{1f06}\u{1f07}\u{1f10}\u{1f11}\u{1f12}\u{1f13}\u{1f14}\u{1f15}\u{1f20}\u{1f21}\u{1f22}" ++
+    "\u{1f23}\u{1f24}\u{1f25}\u{1f26}\u{1f27}\u{1f30}\u{1f31}\u{1f32}\u{1f33}\u{1f34}\u{1f35}" ++
+    "\u{1f36}\u{1f37}\u{1f40}\u{1f41}\u{1f42}\u{1f43}\u{1f44}\u{1f45}\u{1f51}\u{1f53}\u{1f55}" ++
+    "\u{1f57}\u{1f60}\u{1f61}\u{1f62}\u{1f63}\u{1f64}\u{1f65}\u{1f66}\u{1f67}\u{1f00}\u{3b9}" ++
+    "\u{1f01}\u{3b9}\u{1f02}\u{3b9}\u{1f03}\u{3b9}\u{1f04}\u{3b9}\u{1f05}\u{3b9}\u{1f06}\u{3b9}" ++
+    "\u{1f07}\u{3b9}\u{1f20}\u{3b9}\u{1f21}\u{3b9}\u{1f22}\u{3b9}\u{1f23}\u{3b9}\u{1f24}\u{3b9}" ++
+    "\u{1f25}\u{3b9}\u{1f26}\u{3b9}\u{1f27}\u{3b9}\u{1f60}\u{3b9}\u{1f61}\u{3b9}\u{1f62}\u{3b9}" ++
+    "\u{1f63}\u{3b9}\u{1f64}\u{3b9}\u{1f65}\u{3b9}\u{1f66}\u{3b9}\u{1f67}\u{3b9}\u{1f70}\u{3b9}" ++
+    "\u{3b1}\u{3b9}\u{3ac}\u{3b9}\u{1fb6}\u{3b9}\u{1fb0}\u{1fb1}\u{1f70} \u{313} \u{342}" ++
+    " \u{308}\u{342}\u{1f74}\u{3b9}\u{3b7}\u{3b9}\u{3ae}\u{3b9}\u{1fc6}\u{3b9}\u{1f72}\u{1f74}" ++
+    " \u{313}\u{300} \u{313}\u{301} \u{313}\u{342}\u{390}\u{1fd0}\u{1fd1}\u{1f76}" ++
+    " \u{314}\u{300} \u{314}\u{301} \u{314}\u{342}\u{3b0}\u{1fe0}\u{1fe1}\u{1f7a}\u{1fe5}" ++
+    " \u{308}\u{300}`\u{1f7c}\u{3b9}\u{3c9}\u{3b9}\u{3ce}\u{3b9}\u{1ff6}\u{3b9}\u{1f78}\u{1f7c}" ++
+    " \u{314}\u{2010} \u{333}\u{2032}\u{2032}\u{2032}\u{2032}\u{2032}\u{2035}\u{2035}" ++
+    "\u{2035}\u{2035}\u{2035}!! \u{305}???!!?\u{2032}\u{2032}\u{2032}\u{2032}0456789+\u{2212}=(" ++
+    ")rsa/ca/s\u{b0}cc/oc/u\u{b0}fnosmteltm\u{5d0}\u{5d1}\u{5d2}\u{5d3}fax\u{2211}1\u{2044}7" ++
+    "1\u{2044}91\u{2044}101\u{2044}32\u{2044}31\u{2044}52\u{2044}53\u{2044}54\u{2044}5" ++
+    "1\u{2044}65\u{2044}61\u{2044}83\u{2044}85\u{2044}87\u{2044}81\u{2044}iiiiiivviviiviiiixxi" ++
+    "xii0\u{2044}3\u{222b}\u{222b}\u{222b}\u{222b}\u{222b}\u{222e}\u{222e}" ++
+    "\u{222e}\u{222e}\u{222e}\u{3008}\u{3009}1011121314151617181920(1)(2)(3)(4)(5)(6)(7)(8)(9)" ++
+    "(10)(11)(12)(13)(14)(15)(16)(17)(18)(19)(20)(a)(b)(c)(d)(e)(f)(g)(h)(i)(j)(k)(l)(m)(n)(o)" ++
+    "(p)(q)(r)(s)(t)(u)(v)(w)(x)(y)(z)\u{222b}\u{222b}\u{222b}\u{222b}::======\u{2add}\u{338}" ++
+    "\u{2c30}\u{2c31}\u{2c32}\u{2c33}\u{2c34}\u{2c35}\u{2c36}\u{2c37}\u{2c38}\u{2c39}\u{2c3a}" ++
+    "\u{2c3b}\u{2c3c}\u{2c3d}\u{2c3e}\u{2c3f}\u{2c40}\u{2c41}\u{2c42}\u{2c43}\u{2c44}\u{2c45}" ++
+    "\u{2c46}\u{2c47}\u{2c48}\u{2c49}\u{2c4a}\u{2c4b}\u{2c4c}\u{2c4d}\u{2c4e}\u{2c4f}\u{2c50}" ++
+    "\u{2c51}\u{2c52}\u{2c53}\u{2c54}\u{2c55}\u{2c56}\u{2c57}\u{2c58}\u{2c59}\u{2c5a}\u{2c5b}" ++
+    "\u{2c5c}\u{2c5d}\u{2c5e}\u{2c5f}\u{2c61}\u{26b}\u{1d7d}\u{27d}\u{2c68}\u{2c6a}\u{2c6c}" ++
+    "\u{2c73}\u{2c76}\u{23f}\u{240}\u{2c81}\u{2c83}\u{2c85}\u{2c87}\u{2c89}\u{2c8b}\u{2c8d}" ++
+    "\u{2c8f}\u{2c91}\u{2c93}\u{2c95}\u{2c97}\u{2c99}\u{2c9b}\u{2c9d}\u{2c9f}\u{2ca1}\u{2ca3}" ++
+    "\u{2ca5}\u{2ca7}\u{2ca9}\u{2cab}\u{2cad}\u{2caf}\u{2cb1}\u{2cb3}\u{2cb5}\u{2cb7}\u{2cb9}" ++
+    "\u{2cbb}\u{2cbd}\u{2cbf}\u{2cc1}\u{2cc3}\u{2cc5}\u{2cc7}\u{2cc9}\u{2ccb}\u{2ccd}\u{2ccf}" ++
+    "\u{2cd1}\u{2cd3}\u{2cd5}\u{2cd7}\u{2cd9}\u{2cdb}\u{2cdd}\u{2cdf}\u{2ce1}\u{2ce3}\u{2cec}" ++
+    "\u{2cee}\u{2cf3}\u{2d61}\u{6bcd}\u{9f9f}\u{4e00}\u{4e28}\u{4e36}\u{4e3f}\u{4e59}\u{4e85}" ++
+    "\u{4e8c}\u{4ea0}\u{4eba}\u{513f}\u{5165}\u{516b}\u{5182}\u{5196}\u{51ab}\u{51e0}\u{51f5}" ++
+    "\u{5200}\u{529b}\u{52f9}\u{5315}\u{531a}\u{5338}\u{5341}\u{535c}\u{5369}\u{5382}\u{53b6}" ++
+    "\u{53c8}\u{53e3}\u{56d7}\u{571f}\u{58eb}\u{5902}\u{590a}\u{5915}\u{5927}\u{5973}\u{5b50}" ++
+    "\u{5b80}\u{5bf8}\u{5c0f}\u{5c22}\u{5c38}\u{5c6e}\u{5c71}\u{5ddb}\u{5de5}\u{5df1}\u{5dfe}" ++
+    "\u{5e72}\u{5e7a}\u{5e7f}\u{5ef4}\u{5efe}\u{5f0b}\u{5f13}\u{5f50}\u{5f61}\u{5f73}\u{5fc3}" ++
+    "\u{6208}\u{6236}\u{624b}\u{652f}\u{6534}\u{6587}\u{6597}\u{65a4}\u{65b9}\u{65e0}\u{65e5}" ++
+    "\u{66f0}\u{6708}\u{6728}\u{6b20}\u{6b62}\u{6b79}\u{6bb3}\u{6bcb}\u{6bd4}\u{6bdb}\u{6c0f}" ++
+    "\u{6c14}\u{6c34}\u{706b}\u{722a}\u{7236}\u{723b}\u{723f}\u{7247}\u{7259}\u{725b}\u{72ac}" ++
+    "\u{7384}\u{7389}\u{74dc}\u{74e6}\u{7518}\u{751f}\u{7528}\u{7530}\u{758b}\u{7592}\u{7676}" ++
+    "\u{767d}\u{76ae}\u{76bf}\u{76ee}\u{77db}\u{77e2}\u{77f3}\u{793a}\u{79b8}\u{79be}\u{7a74}" ++
+    "\u{7acb}\u{7af9}\u{7c73}\u{7cf8}\u{7f36}\u{7f51}\u{7f8a}\u{7fbd}\u{8001}\u{800c}\u{8012}" ++
+    "\u{8033}\u{807f}\u{8089}\u{81e3}\u{81ea}\u{81f3}\u{81fc}\u{820c}\u{821b}\u{821f}\u{826e}" ++
+    "\u{8272}\u{8278}\u{864d}\u{866b}\u{8840}\u{884c}\u{8863}\u{897e}\u{898b}\u{89d2}\u{8a00}" ++
+    "\u{8c37}\u{8c46}\u{8c55}\u{8c78}\u{8c9d}\u{8d64}\u{8d70}\u{8db3}\u{8eab}\u{8eca}\u{8f9b}" ++
+    "\u{8fb0}\u{8fb5}\u{9091}\u{9149}\u{91c6}\u{91cc}\u{91d1}\u{9577}\u{9580}\u{961c}\u{96b6}" ++
+    "\u{96b9}\u{96e8}\u{9751}\u{975e}\u{9762}\u{9769}\u{97cb}\u{97ed}\u{97f3}\u{9801}\u{98a8}" ++
+    "\u{98db}\u{98df}\u{9996}\u{9999}\u{99ac}\u{9aa8}\u{9ad8}\u{9adf}\u{9b25}\u{9b2f}\u{9b32}" ++
+    "\u{9b3c}\u{9b5a}\u{9ce5}\u{9e75}\u{9e7f}\u{9ea5}\u{9ebb}\u{9ec3}\u{9ecd}\u{9ed1}\u{9ef9}" ++
+    "\u{9efd}\u{9f0e}\u{9f13}\u{9f20}\u{9f3b}\u{9f4a}\u{9f52}\u{9f8d}\u{9f9c}\u{9fa0}.\u{3012}" ++
+    "\u{5344}\u{5345} \u{3099} \u{309a}\u{3088}\u{308a}\u{30b3}\u{30c8}\u{1100}\u{1101}\u{11aa}" ++
+    "\u{1102}\u{11ac}\u{11ad}\u{1103}\u{1104}\u{1105}\u{11b0}\u{11b1}\u{11b2}\u{11b3}\u{11b4}" ++
+    "\u{11b5}\u{111a}\u{1106}\u{1107}\u{1108}\u{1121}\u{1109}\u{110a}\u{110b}\u{110c}\u{110d}" ++
+    "\u{110e}\u{110f}\u{1110}\u{1111}\u{1112}\u{1161}\u{1162}\u{1163}\u{1164}\u{1165}\u{1166}" ++
+    "\u{1167}\u{1168}\u{1169}\u{116a}\u{116b}\u{116c}\u{116d}\u{116e}\u{116f}\u{1170}\u{1171}" ++
+    "\u{1172}\u{1173}\u{1174}\u{1175}\u{1114}\u{1115}\u{11c7}\u{11c8}\u{11cc}\u{11ce}\u{11d3}" ++
+    "\u{11d7}\u{11d9}\u{111c}\u{11dd}\u{11df}\u{111d}\u{111e}\u{1120}\u{1122}\u{1123}\u{1127}" ++
+    "\u{1129}\u{112b}\u{112c}\u{112d}\u{112e}\u{112f}\u{1132}\u{1136}\u{1140}\u{1147}\u{114c}" ++
+    "\u{11f1}\u{11f2}\u{1157}\u{1158}\u{1159}\u{1184}\u{1185}\u{1188}\u{1191}\u{1192}\u{1194}" ++
+    "\u{119e}\u{11a1}\u{4e09}\u{56db}\u{4e0a}\u{4e2d}\u{4e0b}\u{7532}\u{4e19}\u{4e01}\u{5929}" ++
+    "\u{5730}(\u{1100})(\u{1102})(\u{1103})(\u{1105})(\u{1106})(\u{1107})(\u{1109})(\u{110b})" ++
+    "(\u{110c})(\u{110e})(\u{110f})(\u{1110})(\u{1111})(\u{1112})(\u{ac00})(\u{b098})(\u{b2e4})" ++
+    "(\u{b77c})(\u{b9c8})(\u{bc14})(\u{c0ac})(\u{c544})(\u{c790})(\u{cc28})(\u{ce74})(\u{d0c0})" ++
+    "(\u{d30c})(\u{d558})(\u{c8fc})(\u{c624}\u{c804})(\u{c624}\u{d6c4})(\u{4e00})(\u{4e8c})" ++
+    "(\u{4e09})(\u{56db})(\u{4e94})(\u{516d})(\u{4e03})(\u{516b})(\u{4e5d})(\u{5341})(\u{6708})" ++
+    "(\u{706b})(\u{6c34})(\u{6728})(\u{91d1})(\u{571f})(\u{65e5})(\u{682a})(\u{6709})(\u{793e})" ++
+    "(\u{540d})(\u{7279})(\u{8ca1})(\u{795d})(\u{52b4})(\u{4ee3})(\u{547c})(\u{5b66})(\u{76e3})" ++
+    "(\u{4f01})(\u{8cc7})(\u{5354})(\u{796d})(\u{4f11})(\u{81ea})(\u{81f3})\u{554f}\u{5e7c}" ++
+    "\u{7b8f}pte212223242526272829303132333435\u{ac00}\u{b098}\u{b2e4}\u{b77c}\u{b9c8}\u{bc14}" ++
+    "\u{c0ac}\u{c544}\u{c790}\u{cc28}\u{ce74}\u{d0c0}\u{d30c}\u{d558}\u{cc38}\u{ace0}" ++
+    "\u{c8fc}\u{c758}\u{c6b0}\u{4e94}\u{516d}\u{4e03}\u{4e5d}\u{682a}\u{6709}\u{793e}\u{540d}" ++
+    "\u{7279}\u{8ca1}\u{795d}\u{52b4}\u{79d8}\u{7537}\u{9069}\u{512a}\u{5370}\u{6ce8}\u{9805}" ++
+    "\u{4f11}\u{5199}\u{6b63}\u{5de6}\u{53f3}\u{533b}\u{5b97}\u{5b66}\u{76e3}\u{4f01}\u{8cc7}" ++
+    "\u{5354}\u{591c}3637383940414243444546474849501\u{6708}2\u{6708}3\u{6708}4\u{6708}" ++
+    "5\u{6708}6\u{6708}7\u{6708}8\u{6708}9\u{6708}10\u{6708}11\u{6708}12\u{6708}hgergevltd" ++
+    "\u{30a2}\u{30a4}\u{30a6}\u{30a8}\u{30aa}\u{30ab}\u{30ad}\u{30af}\u{30b1}\u{30b3}\u{30b5}" ++
+    "\u{30b7}\u{30b9}\u{30bb}\u{30bd}\u{30bf}\u{30c1}\u{30c4}\u{30c6}\u{30c8}\u{30ca}\u{30cb}" ++
+    "\u{30cc}\u{30cd}\u{30ce}\u{30cf}\u{30d2}\u{30d5}\u{30d8}\u{30db}\u{30de}\u{30df}\u{30e0}" ++
+    "\u{30e1}\u{30e2}\u{30e4}\u{30e6}\u{30e8}\u{30e9}\u{30ea}\u{30eb}\u{30ec}\u{30ed}\u{30ef}" ++
+    "\u{30f0}\u{30f1}\u{30f2}\u{4ee4}\u{548c}\u{30a2}\u{30d1}\u{30fc}\u{30c8}" ++
+    "\u{30a2}\u{30eb}\u{30d5}\u{30a1}\u{30a2}\u{30f3}\u{30da}\u{30a2}\u{30a2}\u{30fc}\u{30eb}" ++
+    "\u{30a4}\u{30cb}\u{30f3}\u{30b0}\u{30a4}\u{30f3}\u{30c1}\u{30a6}\u{30a9}\u{30f3}" ++
+    "\u{30a8}\u{30b9}\u{30af}\u{30fc}\u{30c9}\u{30a8}\u{30fc}\u{30ab}\u{30fc}" ++
+    "\u{30aa}\u{30f3}\u{30b9}\u{30aa}\u{30fc}\u{30e0}\u{30ab}\u{30a4}\u{30ea}" ++
+    "\u{30ab}\u{30e9}\u{30c3}\u{30c8}\u{30ab}\u{30ed}\u{30ea}\u{30fc}\u{30ac}\u{30ed}\u{30f3}" ++
+    "\u{30ac}\u{30f3}\u{30de}\u{30ae}\u{30ac}\u{30ae}\u{30cb}\u{30fc}" ++
+    "\u{30ad}\u{30e5}\u{30ea}\u{30fc}\u{30ae}\u{30eb}\u{30c0}\u{30fc}\u{30ad}\u{30ed}" ++
+    "\u{30ad}\u{30ed}\u{30b0}\u{30e9}\u{30e0}\u{30ad}\u{30ed}\u{30e1}\u{30fc}\u{30c8}\u{30eb}" ++
+    "\u{30ad}\u{30ed}\u{30ef}\u{30c3}\u{30c8}\u{30b0}\u{30e9}\u{30e0}" ++
+    "\u{30b0}\u{30e9}\u{30e0}\u{30c8}\u{30f3}\u{30af}\u{30eb}\u{30bc}\u{30a4}\u{30ed}" ++
+    "\u{30af}\u{30ed}\u{30fc}\u{30cd}\u{30b1}\u{30fc}\u{30b9}\u{30b3}\u{30eb}\u{30ca}" ++
+    "\u{30b3}\u{30fc}\u{30dd}\u{30b5}\u{30a4}\u{30af}\u{30eb}" ++
+    "\u{30b5}\u{30f3}\u{30c1}\u{30fc}\u{30e0}\u{30b7}\u{30ea}\u{30f3}\u{30b0}" ++
+    "\u{30bb}\u{30f3}\u{30c1}\u{30bb}\u{30f3}\u{30c8}\u{30c0}\u{30fc}\u{30b9}\u{30c7}\u{30b7}" ++
+    "\u{30c9}\u{30eb}\u{30c8}\u{30f3}\u{30ca}\u{30ce}\u{30ce}\u{30c3}\u{30c8}" ++
+    "\u{30cf}\u{30a4}\u{30c4}\u{30d1}\u{30fc}\u{30bb}\u{30f3}\u{30c8}\u{30d1}\u{30fc}\u{30c4}" ++
+    "\u{30d0}\u{30fc}\u{30ec}\u{30eb}\u{30d4}\u{30a2}\u{30b9}\u{30c8}\u{30eb}" ++
+    "\u{30d4}\u{30af}\u{30eb}\u{30d4}\u{30b3}\u{30d3}\u{30eb}" ++
+    "\u{30d5}\u{30a1}\u{30e9}\u{30c3}\u{30c9}\u{30d5}\u{30a3}\u{30fc}\u{30c8}" ++
+    "\u{30d6}\u{30c3}\u{30b7}\u{30a7}\u{30eb}\u{30d5}\u{30e9}\u{30f3}" ++
+    "\u{30d8}\u{30af}\u{30bf}\u{30fc}\u{30eb}\u{30da}\u{30bd}\u{30da}\u{30cb}\u{30d2}" ++
+    "\u{30d8}\u{30eb}\u{30c4}\u{30da}\u{30f3}\u{30b9}\u{30da}\u{30fc}\u{30b8}" ++
+    "\u{30d9}\u{30fc}\u{30bf}\u{30dd}\u{30a4}\u{30f3}\u{30c8}\u{30dc}\u{30eb}\u{30c8}" ++
+    "\u{30db}\u{30f3}\u{30dd}\u{30f3}\u{30c9}\u{30db}\u{30fc}\u{30eb}\u{30db}\u{30fc}\u{30f3}" ++
+    "\u{30de}\u{30a4}\u{30af}\u{30ed}\u{30de}\u{30a4}\u{30eb}\u{30de}\u{30c3}\u{30cf}" ++
+    "\u{30de}\u{30eb}\u{30af}\u{30de}\u{30f3}\u{30b7}\u{30e7}\u{30f3}" ++
+    "\u{30df}\u{30af}\u{30ed}\u{30f3}\u{30df}\u{30ea}\u{30df}\u{30ea}\u{30d0}\u{30fc}\u{30eb}" ++
+    "\u{30e1}\u{30ac}\u{30e1}\u{30ac}\u{30c8}\u{30f3}\u{30e1}\u{30fc}\u{30c8}\u{30eb}" ++
+    "\u{30e4}\u{30fc}\u{30c9}\u{30e4}\u{30fc}\u{30eb}\u{30e6}\u{30a2}\u{30f3}" ++
+    "\u{30ea}\u{30c3}\u{30c8}\u{30eb}\u{30ea}\u{30e9}\u{30eb}\u{30d4}\u{30fc}" ++
+    "\u{30eb}\u{30fc}\u{30d6}\u{30eb}\u{30ec}\u{30e0}\u{30ec}\u{30f3}\u{30c8}\u{30b2}\u{30f3}" ++
+    "\u{30ef}\u{30c3}\u{30c8}0\u{70b9}1\u{70b9}2\u{70b9}3\u{70b9}4\u{70b9}5\u{70b9}6\u{70b9}" ++
+    "7\u{70b9}8\u{70b9}9\u{70b9}10\u{70b9}11\u{70b9}12\u{70b9}13\u{70b9}14\u{70b9}15\u{70b9}" ++
+    "16\u{70b9}17\u{70b9}18\u{70b9}19\u{70b9}20\u{70b9}21\u{70b9}22\u{70b9}23\u{70b9}24\u{70b9}" ++
+    "hpadaaubarovpcdmdm2dm3iu\u{5e73}\u{6210}\u{662d}\u{548c}\u{5927}\u{6b63}\u{660e}\u{6cbb}" ++
+    "\u{682a}\u{5f0f}\u{4f1a}\u{793e}pana\u{3bc}amakakbmbgbcalkcalpfnf\u{3bc}f\u{3bc}gmgkghzkhz" ++
+    "mhzghzthz\u{3bc}lmldlklfmnm\u{3bc}mmmcmkmmm2cm2m2km2mm3cm3m3km3m\u{2215}sm\u{2215}s2kpampa" ++
+    "gparadrad\u{2215}srad\u{2215}s2psns\u{3bc}smspvnv\u{3bc}vmvkvpwnw\u{3bc}wmwkwk\u{3c9}" ++
+    "m\u{3c9}bqcccdc\u{2215}kgdbgyhahpinkkktlmlnloglxmilmolphppmprsrsvwbv\u{2215}ma\u{2215}m" ++
+    "1\u{65e5}2\u{65e5}3\u{65e5}4\u{65e5}5\u{65e5}6\u{65e5}7\u{65e5}8\u{65e5}9\u{65e5}" ++
+    "10\u{65e5}11\u{65e5}12\u{65e5}13\u{65e5}14\u{65e5}15\u{65e5}16\u{65e5}17\u{65e5}18\u{65e5}" ++
+    "19\u{65e5}20\u{65e5}21\u{65e5}22\u{65e5}23\u{65e5}24\u{65e5}25\u{65e5}26\u{65e5}27\u{65e5}" ++
+    "28\u{65e5}29\u{65e5}30\u{65e5}31\u{65e5}gal\u{a641}\u{a643}\u{a645}\u{a647}\u{a649}" ++
+    "\u{a64d}\u{a64f}\u{a651}\u{a653}\u{a655}\u{a657}\u{a659}\u{a65b}\u{a65d}\u{a65f}\u{a661}" ++
+    "\u{a663}\u{a665}\u{a667}\u{a669}\u{a66b}\u{a66d}\u{a681}\u{a683}\u{a685}\u{a687}\u{a689}" ++
+    "\u{a68b}\u{a68d}\u{a68f}\u{a691}\u{a693}\u{a695}\u{a697}\u{a699}\u{a69b}\u{a723}\u{a725}" ++
+    "\u{a727}\u{a729}\u{a72b}\u{a72d}\u{a72f}\u{a733}\u{a735}\u{a737}\u{a739}\u{a73b}\u{a73d}" ++
+    "\u{a73f}\u{a741}\u{a743}\u{a745}\u{a747}\u{a749}\u{a74b}\u{a74d}\u{a74f}\u{a751}\u{a753}" ++
+    "\u{a755}\u{a757}\u{a759}\u{a75b}\u{a75d}\u{a75f}\u{a761}\u{a763}\u{a765}\u{a767}\u{a769}" ++
+    "\u{a76b}\u{a76d}\u{a76f}\u{a77a}\u{a77c}\u{1d79}\u{a77f}\u{a781}\u{a783}\u{a785}\u{a787}" ++
+    "\u{a78c}\u{a791}\u{a793}\u{a797}\u{a799}\u{a79b}\u{a79d}\u{a79f}\u{a7a1}\u{a7a3}\u{a7a5}" ++
+    "\u{a7a7}\u{a7a9}\u{26c}\u{29e}\u{287}\u{ab53}\u{a7b5}\u{a7b7}\u{a7b9}\u{a7bb}\u{a7bd}" ++
+    "\u{a7bf}\u{a7c1}\u{a7c3}\u{a794}\u{1d8e}\u{a7c8}\u{a7ca}\u{a7d1}\u{a7d7}\u{a7d9}\u{a7f6}" ++
+    "\u{ab37}\u{ab52}\u{28d}\u{13a0}\u{13a1}\u{13a2}\u{13a3}\u{13a4}\u{13a5}\u{13a6}\u{13a7}" ++
+    "\u{13a8}\u{13a9}\u{13aa}\u{13ab}\u{13ac}\u{13ad}\u{13ae}\u{13af}\u{13b0}\u{13b1}\u{13b2}" ++
+    "\u{13b3}\u{13b4}\u{13b5}\u{13b6}\u{13b7}\u{13b8}\u{13b9}\u{13ba}\u{13bb}\u{13bc}\u{13bd}" ++
+    "\u{13be}\u{13bf}\u{13c0}\u{13c1}\u{13c2}\u{13c3}\u{13c4}\u{13c5}\u{13c6}\u{13c7}\u{13c8}" ++
+    "\u{13c9}\u{13ca}\u{13cb}\u{13cc}\u{13cd}\u{13ce}\u{13cf}\u{13d0}\u{13d1}\u{13d2}\u{13d3}" ++
+    "\u{13d4}\u{13d5}\u{13d6}\u{13d7}\u{13d8}\u{13d9}\u{13da}\u{13db}\u{13dc}\u{13dd}\u{13de}" ++
+    "\u{13df}\u{13e0}\u{13e1}\u{13e2}\u{13e3}\u{13e4}\u{13e5}\u{13e6}\u{13e7}\u{13e8}\u{13e9}" ++
+    "\u{13ea}\u{13eb}\u{13ec}\u{13ed}\u{13ee}\u{13ef}\u{8c48}\u{66f4}\u{8cc8}\u{6ed1}\u{4e32}" ++
+    "\u{53e5}\u{5951}\u{5587}\u{5948}\u{61f6}\u{7669}\u{7f85}\u{863f}\u{87ba}\u{88f8}\u{908f}" ++
+    "\u{6a02}\u{6d1b}\u{70d9}\u{73de}\u{843d}\u{916a}\u{99f1}\u{4e82}\u{5375}\u{6b04}\u{721b}" ++
+    "\u{862d}\u{9e1e}\u{5d50}\u{6feb}\u{85cd}\u{8964}\u{62c9}\u{81d8}\u{881f}\u{5eca}\u{6717}" ++
+    "\u{6d6a}\u{72fc}\u{90ce}\u{4f86}\u{51b7}\u{52de}\u{64c4}\u{6ad3}\u{7210}\u{76e7}\u{8606}" ++
+    "\u{865c}\u{8def}\u{9732}\u{9b6f}\u{9dfa}\u{788c}\u{797f}\u{7da0}\u{83c9}\u{9304}\u{8ad6}" ++
+    "\u{58df}\u{5f04}\u{7c60}\u{807e}\u{7262}\u{78ca}\u{8cc2}\u{96f7}\u{58d8}\u{5c62}\u{6a13}" ++
+    "\u{6dda}\u{6f0f}\u{7d2f}\u{7e37}\u{964b}\u{52d2}\u{808b}\u{51dc}\u{51cc}\u{7a1c}\u{7dbe}" ++
+    "\u{83f1}\u{9675}\u{8b80}\u{62cf}\u{8afe}\u{4e39}\u{5be7}\u{6012}\u{7387}\u{7570}\u{5317}" ++
+    "\u{78fb}\u{4fbf}\u{5fa9}\u{4e0d}\u{6ccc}\u{6578}\u{7d22}\u{53c3}\u{585e}\u{7701}\u{8449}" ++
+    "\u{8aaa}\u{6bba}\u{6c88}\u{62fe}\u{82e5}\u{63a0}\u{7565}\u{4eae}\u{5169}\u{51c9}\u{6881}" ++
+    "\u{7ce7}\u{826f}\u{8ad2}\u{91cf}\u{52f5}\u{5442}\u{5eec}\u{65c5}\u{6ffe}\u{792a}\u{95ad}" ++
+    "\u{9a6a}\u{9e97}\u{9ece}\u{66c6}\u{6b77}\u{8f62}\u{5e74}\u{6190}\u{6200}\u{649a}\u{6f23}" ++
+    "\u{7149}\u{7489}\u{79ca}\u{7df4}\u{806f}\u{8f26}\u{84ee}\u{9023}\u{934a}\u{5217}\u{52a3}" ++
+    "\u{54bd}\u{70c8}\u{88c2}\u{5ec9}\u{5ff5}\u{637b}\u{6bae}\u{7c3e}\u{7375}\u{4ee4}\u{56f9}" ++
+    "\u{5dba}\u{601c}\u{73b2}\u{7469}\u{7f9a}\u{8046}\u{9234}\u{96f6}\u{9748}\u{9818}\u{4f8b}" ++
+    "\u{79ae}\u{91b4}\u{96b8}\u{60e1}\u{4e86}\u{50da}\u{5bee}\u{5c3f}\u{6599}\u{71ce}\u{7642}" ++
+    "\u{84fc}\u{907c}\u{6688}\u{962e}\u{5289}\u{677b}\u{67f3}\u{6d41}\u{6e9c}\u{7409}\u{7559}" ++
+    "\u{786b}\u{7d10}\u{985e}\u{622e}\u{9678}\u{502b}\u{5d19}\u{6dea}\u{8f2a}\u{5f8b}\u{6144}" ++
+    "\u{6817}\u{9686}\u{5229}\u{540f}\u{5c65}\u{6613}\u{674e}\u{68a8}\u{6ce5}\u{7406}\u{75e2}" ++
+    "\u{7f79}\u{88cf}\u{88e1}\u{96e2}\u{533f}\u{6eba}\u{541d}\u{71d0}\u{7498}\u{85fa}\u{96a3}" ++
+    "\u{9c57}\u{9e9f}\u{6797}\u{6dcb}\u{81e8}\u{7b20}\u{7c92}\u{72c0}\u{7099}\u{8b58}\u{4ec0}" ++
+    "\u{8336}\u{523a}\u{5207}\u{5ea6}\u{62d3}\u{7cd6}\u{5b85}\u{6d1e}\u{66b4}\u{8f3b}\u{964d}" ++
+    "\u{5ed3}\u{5140}\u{55c0}\u{585a}\u{6674}\u{51de}\u{732a}\u{76ca}\u{793c}\u{795e}\u{7965}" ++
+    "\u{798f}\u{9756}\u{7cbe}\u{8612}\u{8af8}\u{9038}\u{90fd}\u{98ef}\u{98fc}\u{9928}\u{9db4}" ++
+    "\u{90de}\u{96b7}\u{4fae}\u{50e7}\u{514d}\u{52c9}\u{52e4}\u{5351}\u{559d}\u{5606}\u{5668}" ++
+    "\u{5840}\u{58a8}\u{5c64}\u{6094}\u{6168}\u{618e}\u{61f2}\u{654f}\u{65e2}\u{6691}\u{6885}" ++
+    "\u{6d77}\u{6e1a}\u{6f22}\u{716e}\u{722b}\u{7422}\u{7891}\u{7949}\u{7948}\u{7950}\u{7956}" ++
+    "\u{798d}\u{798e}\u{7a40}\u{7a81}\u{7bc0}\u{7e09}\u{7e41}\u{7f72}\u{8005}\u{81ed}\u{8279}" ++
+    "\u{8457}\u{8910}\u{8996}\u{8b01}\u{8b39}\u{8cd3}\u{8d08}\u{8fb6}\u{96e3}\u{97ff}\u{983b}" ++
+    "\u{6075}\u{242ee}\u{8218}\u{4e26}\u{51b5}\u{5168}\u{4f80}\u{5145}\u{5180}\u{52c7}\u{52fa}" ++
+    "\u{5555}\u{5599}\u{55e2}\u{58b3}\u{5944}\u{5954}\u{5a62}\u{5b28}\u{5ed2}\u{5ed9}\u{5f69}" ++
+    "\u{5fad}\u{60d8}\u{614e}\u{6108}\u{6160}\u{6234}\u{63c4}\u{641c}\u{6452}\u{6556}\u{671b}" ++
+    "\u{6756}\u{6edb}\u{6ecb}\u{701e}\u{77a7}\u{7235}\u{72af}\u{7471}\u{7506}\u{753b}\u{761d}" ++
+    "\u{761f}\u{76db}\u{76f4}\u{774a}\u{7740}\u{78cc}\u{7ab1}\u{7c7b}\u{7d5b}\u{7f3e}\u{8352}" ++
+    "\u{83ef}\u{8779}\u{8941}\u{8986}\u{8abf}\u{8acb}\u{8aed}\u{8b8a}\u{8f38}\u{9072}\u{9199}" ++
+    "\u{9276}\u{967c}\u{97db}\u{980b}\u{9b12}\u{2284a}\u{22844}\u{233d5}\u{3b9d}\u{4018}" ++
+    "\u{4039}\u{25249}\u{25cd0}\u{27ed3}\u{9f43}\u{9f8e}fffiflffifflst\u{574}\u{576}" ++
+    "\u{574}\u{565}\u{574}\u{56b}\u{57e}\u{576}\u{574}\u{56d}\u{5d9}\u{5b4}\u{5f2}\u{5b7}" ++
+    "\u{5e2}\u{5d4}\u{5db}\u{5dc}\u{5dd}\u{5e8}\u{5ea}\u{5e9}\u{5c1}\u{5e9}\u{5c2}" ++
+    "\u{5e9}\u{5bc}\u{5c1}\u{5e9}\u{5bc}\u{5c2}\u{5d0}\u{5b7}\u{5d0}\u{5b8}\u{5d0}\u{5bc}" ++
+    "\u{5d1}\u{5bc}\u{5d2}\u{5bc}\u{5d3}\u{5bc}\u{5d4}\u{5bc}\u{5d5}\u{5bc}\u{5d6}\u{5bc}" ++
+    "\u{5d8}\u{5bc}\u{5d9}\u{5bc}\u{5da}\u{5bc}\u{5db}\u{5bc}\u{5dc}\u{5bc}\u{5de}\u{5bc}" ++
+    "\u{5e0}\u{5bc}\u{5e1}\u{5bc}\u{5e3}\u{5bc}\u{5e4}\u{5bc}\u{5e6}\u{5bc}\u{5e7}\u{5bc}" ++
+    "\u{5e8}\u{5bc}\u{5e9}\u{5bc}\u{5ea}\u{5bc}\u{5d5}\u{5b9}\u{5d1}\u{5bf}\u{5db}\u{5bf}" ++
+    "\u{5e4}\u{5bf}\u{5d0}\u{5dc}\u{671}\u{67b}\u{67e}\u{680}\u{67a}\u{67f}\u{679}\u{6a4}" ++
+    "\u{6a6}\u{684}\u{683}\u{686}\u{687}\u{68d}\u{68c}\u{68e}\u{688}\u{698}\u{691}\u{6a9}" ++
+    "\u{6af}\u{6b3}\u{6b1}\u{6ba}\u{6bb}\u{6c0}\u{6c1}\u{6be}\u{6d2}\u{6d3}\u{6ad}\u{6c7}" ++
+    "\u{6c6}\u{6c8}\u{6cb}\u{6c5}\u{6c9}\u{6d0}\u{649}\u{626}\u{627}\u{626}\u{6d5}" ++
+    "\u{626}\u{648}\u{626}\u{6c7}\u{626}\u{6c6}\u{626}\u{6c8}\u{626}\u{6d0}\u{626}\u{649}" ++
+    "\u{6cc}\u{626}\u{62c}\u{626}\u{62d}\u{626}\u{645}\u{626}\u{64a}\u{628}\u{62c}" ++
+    "\u{628}\u{62d}\u{628}\u{62e}\u{628}\u{645}\u{628}\u{649}\u{628}\u{64a}\u{62a}\u{62c}" ++
+    "\u{62a}\u{62d}\u{62a}\u{62e}\u{62a}\u{645}\u{62a}\u{649}\u{62a}\u{64a}\u{62b}\u{62c}" ++
+    "\u{62b}\u{645}\u{62b}\u{649}\u{62b}\u{64a}\u{62c}\u{62d}\u{62c}\u{645}\u{62d}\u{62c}" ++
+    "\u{62d}\u{645}\u{62e}\u{62c}\u{62e}\u{62d}\u{62e}\u{645}\u{633}\u{62c}\u{633}\u{62d}" ++
+    "\u{633}\u{62e}\u{633}\u{645}\u{635}\u{62d}\u{635}\u{645}\u{636}\u{62c}\u{636}\u{62d}" ++
+    "\u{636}\u{62e}\u{636}\u{645}\u{637}\u{62d}\u{637}\u{645}\u{638}\u{645}\u{639}\u{62c}" ++
+    "\u{639}\u{645}\u{63a}\u{62c}\u{63a}\u{645}\u{641}\u{62c}\u{641}\u{62d}\u{641}\u{62e}" ++
+    "\u{641}\u{645}\u{641}\u{649}\u{641}\u{64a}\u{642}\u{62d}\u{642}\u{645}\u{642}\u{649}" ++
+    "\u{642}\u{64a}\u{643}\u{627}\u{643}\u{62c}\u{643}\u{62d}\u{643}\u{62e}\u{643}\u{644}" ++
+    "\u{643}\u{645}\u{643}\u{649}\u{643}\u{64a}\u{644}\u{62c}\u{644}\u{62d}\u{644}\u{62e}" ++
+    "\u{644}\u{645}\u{644}\u{649}\u{644}\u{64a}\u{645}\u{62c}\u{645}\u{62d}\u{645}\u{62e}" ++
+    "\u{645}\u{645}\u{645}\u{649}\u{645}\u{64a}\u{646}\u{62c}\u{646}\u{62d}\u{646}\u{62e}" ++
+    "\u{646}\u{645}\u{646}\u{649}\u{646}\u{64a}\u{647}\u{62c}\u{647}\u{645}\u{647}\u{649}" ++
+    "\u{647}\u{64a}\u{64a}\u{62c}\u{64a}\u{62d}\u{64a}\u{62e}\u{64a}\u{645}\u{64a}\u{649}" ++
+    "\u{64a}\u{64a}\u{630}\u{670}\u{631}\u{670}\u{649}\u{670} \u{64c}\u{651} \u{64d}\u{651}" ++
+    " \u{64e}\u{651} \u{64f}\u{651} \u{650}\u{651} \u{651}\u{670}\u{626}\u{631}\u{626}\u{632}" ++
+    "\u{626}\u{646}\u{628}\u{631}\u{628}\u{632}\u{628}\u{646}\u{62a}\u{631}\u{62a}\u{632}" ++
+    "\u{62a}\u{646}\u{62b}\u{631}\u{62b}\u{632}\u{62b}\u{646}\u{645}\u{627}\u{646}\u{631}" ++
+    "\u{646}\u{632}\u{646}\u{646}\u{64a}\u{631}\u{64a}\u{632}\u{64a}\u{646}\u{626}\u{62e}" ++
+    "\u{626}\u{647}\u{628}\u{647}\u{62a}\u{647}\u{635}\u{62e}\u{644}\u{647}\u{646}\u{647}" ++
+    "\u{647}\u{670}\u{64a}\u{647}\u{62b}\u{647}\u{633}\u{647}\u{634}\u{645}\u{634}\u{647}" ++
+    "\u{640}\u{64e}\u{651}\u{640}\u{64f}\u{651}\u{640}\u{650}\u{651}\u{637}\u{649}" ++
+    "\u{637}\u{64a}\u{639}\u{649}\u{639}\u{64a}\u{63a}\u{649}\u{63a}\u{64a}\u{633}\u{649}" ++
+    "\u{633}\u{64a}\u{634}\u{649}\u{634}\u{64a}\u{62d}\u{649}\u{62d}\u{64a}\u{62c}\u{649}" ++
+    "\u{62c}\u{64a}\u{62e}\u{649}\u{62e}\u{64a}\u{635}\u{649}\u{635}\u{64a}\u{636}\u{649}" ++
+    "\u{636}\u{64a}\u{634}\u{62c}\u{634}\u{62d}\u{634}\u{62e}\u{634}\u{631}\u{633}\u{631}" ++
+    "\u{635}\u{631}\u{636}\u{631}\u{627}\u{64b}\u{62a}\u{62c}\u{645}\u{62a}\u{62d}\u{62c}" ++
+    "\u{62a}\u{62d}\u{645}\u{62a}\u{62e}\u{645}\u{62a}\u{645}\u{62c}\u{62a}\u{645}\u{62d}" ++
+    "\u{62a}\u{645}\u{62e}\u{62c}\u{645}\u{62d}\u{62d}\u{645}\u{64a}\u{62d}\u{645}\u{649}" ++
+    "\u{633}\u{62d}\u{62c}\u{633}\u{62c}\u{62d}\u{633}\u{62c}\u{649}\u{633}\u{645}\u{62d}" ++
+    "\u{633}\u{645}\u{62c}\u{633}\u{645}\u{645}\u{635}\u{62d}\u{62d}\u{635}\u{645}\u{645}" ++
+    "\u{634}\u{62d}\u{645}\u{634}\u{62c}\u{64a}\u{634}\u{645}\u{62e}\u{634}\u{645}\u{645}" ++
+    "\u{636}\u{62d}\u{649}\u{636}\u{62e}\u{645}\u{637}\u{645}\u{62d}\u{637}\u{645}\u{645}" ++
+    "\u{637}\u{645}\u{64a}\u{639}\u{62c}\u{645}\u{639}\u{645}\u{645}\u{639}\u{645}\u{649}" ++
+    "\u{63a}\u{645}\u{645}\u{63a}\u{645}\u{64a}\u{63a}\u{645}\u{649}\u{641}\u{62e}\u{645}" ++
+    "\u{642}\u{645}\u{62d}\u{642}\u{645}\u{645}\u{644}\u{62d}\u{645}\u{644}\u{62d}\u{64a}" ++
+    "\u{644}\u{62d}\u{649}\u{644}\u{62c}\u{62c}\u{644}\u{62e}\u{645}\u{644}\u{645}\u{62d}" ++
+    "\u{645}\u{62d}\u{62c}\u{645}\u{62d}\u{645}\u{645}\u{62d}\u{64a}\u{645}\u{62c}\u{62d}" ++
+    "\u{645}\u{62c}\u{645}\u{645}\u{62e}\u{62c}\u{645}\u{62e}\u{645}\u{645}\u{62c}\u{62e}" ++
+    "\u{647}\u{645}\u{62c}\u{647}\u{645}\u{645}\u{646}\u{62d}\u{645}\u{646}\u{62d}\u{649}" ++
+    "\u{646}\u{62c}\u{645}\u{646}\u{62c}\u{649}\u{646}\u{645}\u{64a}\u{646}\u{645}\u{649}" ++
+    "\u{64a}\u{645}\u{645}\u{628}\u{62e}\u{64a}\u{62a}\u{62c}\u{64a}\u{62a}\u{62c}\u{649}" ++
+    "\u{62a}\u{62e}\u{64a}\u{62a}\u{62e}\u{649}\u{62a}\u{645}\u{64a}\u{62a}\u{645}\u{649}" ++
+    "\u{62c}\u{645}\u{64a}\u{62c}\u{62d}\u{649}\u{62c}\u{645}\u{649}\u{633}\u{62e}\u{649}" ++
+    "\u{635}\u{62d}\u{64a}\u{634}\u{62d}\u{64a}\u{636}\u{62d}\u{64a}\u{644}\u{62c}\u{64a}" ++
+    "\u{644}\u{645}\u{64a}\u{64a}\u{62d}\u{64a}\u{64a}\u{62c}\u{64a}\u{64a}\u{645}\u{64a}" ++
+    "\u{645}\u{645}\u{64a}\u{642}\u{645}\u{64a}\u{646}\u{62d}\u{64a}\u{639}\u{645}\u{64a}" ++
+    "\u{643}\u{645}\u{64a}\u{646}\u{62c}\u{62d}\u{645}\u{62e}\u{64a}\u{644}\u{62c}\u{645}" ++
+    "\u{643}\u{645}\u{645}\u{62c}\u{62d}\u{64a}\u{62d}\u{62c}\u{64a}\u{645}\u{62c}\u{64a}" ++
+    "\u{641}\u{645}\u{64a}\u{628}\u{62d}\u{64a}\u{633}\u{62e}\u{64a}\u{646}\u{62c}\u{64a}" ++
+    "\u{635}\u{644}\u{6d2}\u{642}\u{644}\u{6d2}\u{627}\u{644}\u{644}\u{647}" ++
+    "\u{627}\u{643}\u{628}\u{631}\u{645}\u{62d}\u{645}\u{62f}\u{635}\u{644}\u{639}\u{645}" ++
+    "\u{631}\u{633}\u{648}\u{644}\u{639}\u{644}\u{64a}\u{647}\u{648}\u{633}\u{644}\u{645}" ++
+    "\u{635}\u{644}\u{649}" ++
+    "\u{635}\u{644}\u{649} \u{627}\u{644}\u{644}\u{647} \u{639}\u{644}\u{64a}\u{647} \u{648}\u{633}\u{644}\u{645}" ++
+    "\u{62c}\u{644} \u{62c}\u{644}\u{627}\u{644}\u{647}\u{631}\u{6cc}\u{627}\u{644},\u{3001}:!?" ++
+    "\u{3016}\u{3017}\u{2014}\u{2013}_{}\u{3014}\u{3015}\u{3010}\u{3011}\u{300a}\u{300b}" ++
+    "\u{300c}\u{300d}\u{300e}\u{300f}[]#&*-<>\u{5c}$%@ \u{64b}\u{640}\u{64b} \u{64c} \u{64d}" ++
+    " \u{64e}\u{640}\u{64e} \u{64f}\u{640}\u{64f} \u{650}\u{640}\u{650} \u{651}\u{640}\u{651}" ++
+    " \u{652}\u{640}\u{652}\u{621}\u{622}\u{623}\u{624}\u{625}\u{626}\u{627}\u{628}\u{629}" ++
+    "\u{62a}\u{62b}\u{62c}\u{62d}\u{62e}\u{62f}\u{630}\u{631}\u{632}\u{633}\u{634}\u{635}" ++
+    "\u{636}\u{637}\u{638}\u{639}\u{63a}\u{641}\u{642}\u{643}\u{644}\u{645}\u{646}\u{647}" ++
+    "\u{648}\u{64a}\u{644}\u{622}\u{644}\u{623}\u{644}\u{625}\u{644}\u{627}\u{22}'/^|~\u{2985}" ++
+    "\u{2986}\u{30fb}\u{30a1}\u{30a3}\u{30a5}\u{30a7}\u{30a9}\u{30e3}\u{30e5}\u{30e7}\u{30c3}" ++
+    "\u{30fc}\u{30f3}\u{3099}\u{309a}\u{a2}\u{a3}\u{ac}\u{a6}\u{a5}\u{20a9}\u{2502}\u{2190}" ++
+    "\u{2191}\u{2192}\u{2193}\u{25a0}\u{25cb}\u{10428}\u{10429}\u{1042a}\u{1042b}\u{1042c}" ++
+    "\u{1042d}\u{1042e}\u{1042f}\u{10430}\u{10431}\u{10432}\u{10433}\u{10434}\u{10435}\u{10436}" ++
+    "\u{10437}\u{10438}\u{10439}\u{1043a}\u{1043b}\u{1043c}\u{1043d}\u{1043e}\u{1043f}\u{10440}" ++
+    "\u{10441}\u{10442}\u{10443}\u{10444}\u{10445}\u{10446}\u{10447}\u{10448}\u{10449}\u{1044a}" ++
+    "\u{1044b}\u{1044c}\u{1044d}\u{1044e}\u{1044f}\u{104d8}\u{104d9}\u{104da}\u{104db}\u{104dc}" ++
+    "\u{104dd}\u{104de}\u{104df}\u{104e0}\u{104e1}\u{104e2}\u{104e3}\u{104e4}\u{104e5}\u{104e6}" ++
+    "\u{104e7}\u{104e8}\u{104e9}\u{104ea}\u{104eb}\u{104ec}\u{104ed}\u{104ee}\u{104ef}\u{104f0}" ++
+    "\u{104f1}\u{104f2}\u{104f3}\u{104f4}\u{104f5}\u{104f6}\u{104f7}\u{104f8}\u{104f9}\u{104fa}" ++
+    "\u{104fb}\u{10597}\u{10598}\u{10599}\u{1059a}\u{1059b}\u{1059c}\u{1059d}\u{1059e}\u{1059f}" ++
+    "\u{105a0}\u{105a1}\u{105a3}\u{105a4}\u{105a5}\u{105a6}\u{105a7}\u{105a8}\u{105a9}\u{105aa}" ++
+    "\u{105ab}\u{105ac}\u{105ad}\u{105ae}\u{105af}\u{105b0}\u{105b1}\u{105b3}\u{105b4}\u{105b5}" ++
+    "\u{105b6}\u{105b7}\u{105b8}\u{105b9}\u{105bb}\u{105bc}\u{2d0}\u{2d1}\u{299}\u{2a3}\u{ab66}" ++
+    "\u{2a5}\u{2a4}\u{1d91}\u{258}\u{25e}\u{2a9}\u{264}\u{262}\u{29b}\u{29c}\u{267}\u{284}" ++
+    "\u{2aa}\u{2ab}\u{1df04}\u{a78e}\u{26e}\u{1df05}\u{28e}\u{1df06}\u{276}\u{277}\u{27a}" ++
+    "\u{1df08}\u{27e}\u{2a8}\u{2a6}\u{ab67}\u{2a7}\u{2c71}\u{28f}\u{2a1}\u{2a2}\u{298}\u{1c0}" ++
+    "\u{1c1}\u{1c2}\u{1df0a}\u{1df1e}\u{10cc0}\u{10cc1}\u{10cc2}\u{10cc3}\u{10cc4}\u{10cc5}" ++
+    "\u{10cc6}\u{10cc7}\u{10cc8}\u{10cc9}\u{10cca}\u{10ccb}\u{10ccc}\u{10ccd}\u{10cce}\u{10ccf}" ++
+    "\u{10cd0}\u{10cd1}\u{10cd2}\u{10cd3}\u{10cd4}\u{10cd5}\u{10cd6}\u{10cd7}\u{10cd8}\u{10cd9}" ++
+    "\u{10cda}\u{10cdb}\u{10cdc}\u{10cdd}\u{10cde}\u{10cdf}\u{10ce0}\u{10ce1}\u{10ce2}\u{10ce3}" ++
+    "\u{10ce4}\u{10ce5}\u{10ce6}\u{10ce7}\u{10ce8}\u{10ce9}\u{10cea}\u{10ceb}\u{10cec}\u{10ced}" ++
+    "\u{10cee}\u{10cef}\u{10cf0}\u{10cf1}\u{10cf2}\u{118c0}\u{118c1}\u{118c2}\u{118c3}\u{118c4}" ++
+    "\u{118c5}\u{118c6}\u{118c7}\u{118c8}\u{118c9}\u{118ca}\u{118cb}\u{118cc}\u{118cd}\u{118ce}" ++
+    "\u{118cf}\u{118d0}\u{118d1}\u{118d2}\u{118d3}\u{118d4}\u{118d5}\u{118d6}\u{118d7}\u{118d8}" ++
+    "\u{118d9}\u{118da}\u{118db}\u{118dc}\u{118dd}\u{118de}\u{118df}\u{16e60}\u{16e61}\u{16e62}" ++
+    "\u{16e63}\u{16e64}\u{16e65}\u{16e66}\u{16e67}\u{16e68}\u{16e69}\u{16e6a}\u{16e6b}\u{16e6c}" ++
+    "\u{16e6d}\u{16e6e}\u{16e6f}\u{16e70}\u{16e71}\u{16e72}\u{16e73}\u{16e74}\u{16e75}\u{16e76}" ++
+    "\u{16e77}\u{16e78}\u{16e79}\u{16e7a}\u{16e7b}\u{16e7c}\u{16e7d}\u{16e7e}\u{16e7f}" ++
+    "\u{1d157}\u{1d165}\u{1d158}\u{1d165}\u{1d158}\u{1d165}\u{1d16e}\u{1d158}\u{1d165}\u{1d16f}" ++
+    "\u{1d158}\u{1d165}\u{1d170}\u{1d158}\u{1d165}\u{1d171}\u{1d158}\u{1d165}\u{1d172}" ++
+    "\u{1d1b9}\u{1d165}\u{1d1ba}\u{1d165}\u{1d1b9}\u{1d165}\u{1d16e}\u{1d1ba}\u{1d165}\u{1d16e}" ++
+    "\u{1d1b9}\u{1d165}\u{1d16f}\u{1d1ba}\u{1d165}\u{1d16f}\u{131}\u{237}\u{2207}\u{2202}" ++
+    "\u{4cf}\u{1e922}\u{1e923}\u{1e924}\u{1e925}\u{1e926}\u{1e927}\u{1e928}\u{1e929}\u{1e92a}" ++
+    "\u{1e92b}\u{1e92c}\u{1e92d}\u{1e92e}\u{1e92f}\u{1e930}\u{1e931}\u{1e932}\u{1e933}\u{1e934}" ++
+    "\u{1e935}\u{1e936}\u{1e937}\u{1e938}\u{1e939}\u{1e93a}\u{1e93b}\u{1e93c}\u{1e93d}\u{1e93e}" ++
+    "\u{1e93f}\u{1e940}\u{1e941}\u{1e942}\u{1e943}\u{66e}\u{6a1}\u{66f}0,1,2,3,4,5,6,7,8,9," ++
+    "\u{3014}s\u{3015}wzhvsdppvwcmcmdmrdj\u{307b}\u{304b}\u{30b3}\u{30b3}\u{5b57}\u{53cc}" ++
+    "\u{30c7}\u{591a}\u{89e3}\u{4ea4}\u{6620}\u{7121}\u{524d}\u{5f8c}\u{518d}\u{65b0}\u{521d}" ++
+    "\u{7d42}\u{8ca9}\u{58f0}\u{5439}\u{6f14}\u{6295}\u{6355}\u{904a}\u{6307}\u{6253}\u{7981}" ++
+    "\u{7a7a}\u{5408}\u{6e80}\u{7533}\u{5272}\u{55b6}\u{914d}\u{3014}\u{672c}\u{3015}" ++
+    "\u{3014}\u{4e09}\u{3015}\u{3014}\u{4e8c}\u{3015}\u{3014}\u{5b89}\u{3015}" ++
+    "\u{3014}\u{70b9}\u{3015}\u{3014}\u{6253}\u{3015}\u{3014}\u{76d7}\u{3015}" ++
+    "\u{3014}\u{52dd}\u{3015}\u{3014}\u{6557}\u{3015}\u{5f97}\u{53ef}\u{4e3d}\u{4e38}\u{4e41}" ++
+    "\u{20122}\u{4f60}\u{4fbb}\u{5002}\u{507a}\u{5099}\u{50cf}\u{349e}\u{2063a}\u{5154}\u{5164}" ++
+    "\u{5177}\u{2051c}\u{34b9}\u{5167}\u{2054b}\u{5197}\u{51a4}\u{4ecc}\u{51ac}\u{291df}" ++
+    "\u{5203}\u{34df}\u{523b}\u{5246}\u{5277}\u{3515}\u{5305}\u{5306}\u{5349}\u{535a}\u{5373}" ++
+    "\u{537d}\u{537f}\u{20a2c}\u{7070}\u{53ca}\u{53df}\u{20b63}\u{53eb}\u{53f1}\u{5406}\u{549e}" ++
+    "\u{5438}\u{5448}\u{5468}\u{54a2}\u{54f6}\u{5510}\u{5553}\u{5563}\u{5584}\u{55ab}\u{55b3}" ++
+    "\u{55c2}\u{5716}\u{5717}\u{5651}\u{5674}\u{58ee}\u{57ce}\u{57f4}\u{580d}\u{578b}\u{5832}" ++
+    "\u{5831}\u{58ac}\u{214e4}\u{58f2}\u{58f7}\u{5906}\u{5922}\u{5962}\u{216a8}\u{216ea}" ++
+    "\u{59ec}\u{5a1b}\u{5a27}\u{59d8}\u{5a66}\u{36ee}\u{5b08}\u{5b3e}\u{219c8}\u{5bc3}\u{5bd8}" ++
+    "\u{5bf3}\u{21b18}\u{5bff}\u{5c06}\u{3781}\u{5c60}\u{5cc0}\u{5c8d}\u{21de4}\u{5d43}" ++
+    "\u{21de6}\u{5d6e}\u{5d6b}\u{5d7c}\u{5de1}\u{5de2}\u{382f}\u{5dfd}\u{5e28}\u{5e3d}\u{5e69}" ++
+    "\u{3862}\u{22183}\u{387c}\u{5eb0}\u{5eb3}\u{5eb6}\u{2a392}\u{22331}\u{8201}\u{5f22}" ++
+    "\u{38c7}\u{232b8}\u{261da}\u{5f62}\u{5f6b}\u{38e3}\u{5f9a}\u{5fcd}\u{5fd7}\u{5ff9}\u{6081}" ++
+    "\u{393a}\u{391c}\u{226d4}\u{60c7}\u{6148}\u{614c}\u{617a}\u{61b2}\u{61a4}\u{61af}\u{61de}" ++
+    "\u{6210}\u{621b}\u{625d}\u{62b1}\u{62d4}\u{6350}\u{22b0c}\u{633d}\u{62fc}\u{6368}\u{6383}" ++
+    "\u{63e4}\u{22bf1}\u{6422}\u{63c5}\u{63a9}\u{3a2e}\u{6469}\u{647e}\u{649d}\u{6477}\u{3a6c}" ++
+    "\u{656c}\u{2300a}\u{65e3}\u{66f8}\u{6649}\u{3b19}\u{3b08}\u{3ae4}\u{5192}\u{5195}\u{6700}" ++
+    "\u{669c}\u{80ad}\u{43d9}\u{6721}\u{675e}\u{6753}\u{233c3}\u{3b49}\u{67fa}\u{6785}\u{6852}" ++
+    "\u{2346d}\u{688e}\u{681f}\u{6914}\u{6942}\u{69a3}\u{69ea}\u{6aa8}\u{236a3}\u{6adb}\u{3c18}" ++
+    "\u{6b21}\u{238a7}\u{6b54}\u{3c4e}\u{6b72}\u{6b9f}\u{6bbb}\u{23a8d}\u{21d0b}\u{23afa}" ++
+    "\u{6c4e}\u{23cbc}\u{6cbf}\u{6ccd}\u{6c67}\u{6d16}\u{6d3e}\u{6d69}\u{6d78}\u{6d85}\u{23d1e}" ++
+    "\u{6d34}\u{6e2f}\u{6e6e}\u{3d33}\u{6ec7}\u{23ed1}\u{6df9}\u{6f6e}\u{23f5e}\u{23f8e}" ++
+    "\u{6fc6}\u{7039}\u{701b}\u{3d96}\u{704a}\u{707d}\u{7077}\u{70ad}\u{20525}\u{7145}\u{24263}" ++
+    "\u{719c}\u{7228}\u{7250}\u{24608}\u{7280}\u{7295}\u{24735}\u{24814}\u{737a}\u{738b}" ++
+    "\u{3eac}\u{73a5}\u{3eb8}\u{7447}\u{745c}\u{7485}\u{74ca}\u{3f1b}\u{7524}\u{24c36}\u{753e}" ++
+    "\u{24c92}\u{2219f}\u{7610}\u{24fa1}\u{24fb8}\u{25044}\u{3ffc}\u{4008}\u{250f3}\u{250f2}" ++
+    "\u{25119}\u{25133}\u{771e}\u{771f}\u{778b}\u{4046}\u{4096}\u{2541d}\u{784e}\u{40e3}" ++
+    "\u{25626}\u{2569a}\u{256c5}\u{79eb}\u{412f}\u{7a4a}\u{7a4f}\u{2597c}\u{25aa7}\u{4202}" ++
+    "\u{25bab}\u{7bc6}\u{7bc9}\u{4227}\u{25c80}\u{7cd2}\u{42a0}\u{7ce8}\u{7ce3}\u{7d00}" ++
+    "\u{25f86}\u{7d63}\u{4301}\u{7dc7}\u{7e02}\u{7e45}\u{4334}\u{26228}\u{26247}\u{4359}" ++
+    "\u{262d9}\u{7f7a}\u{2633e}\u{7f95}\u{7ffa}\u{264da}\u{26523}\u{8060}\u{265a8}\u{8070}" ++
+    "\u{2335f}\u{43d5}\u{80b2}\u{8103}\u{440b}\u{813e}\u{5ab5}\u{267a7}\u{267b5}\u{23393}" ++
+    "\u{2339c}\u{8204}\u{8f9e}\u{446b}\u{8291}\u{828b}\u{829d}\u{52b3}\u{82b1}\u{82b3}\u{82bd}" ++
+    "\u{82e6}\u{26b3c}\u{831d}\u{8363}\u{83ad}\u{8323}\u{83bd}\u{83e7}\u{8353}\u{83ca}\u{83cc}" ++
+    "\u{83dc}\u{26c36}\u{26d6b}\u{26cd5}\u{452b}\u{84f1}\u{84f3}\u{8516}\u{273ca}\u{8564}" ++
+    "\u{26f2c}\u{455d}\u{4561}\u{26fb1}\u{270d2}\u{456b}\u{8650}\u{8667}\u{8669}\u{86a9}" ++
+    "\u{8688}\u{870e}\u{86e2}\u{8728}\u{876b}\u{8786}\u{87e1}\u{8801}\u{45f9}\u{8860}\u{27667}" ++
+    "\u{88d7}\u{88de}\u{4635}\u{88fa}\u{34bb}\u{278ae}\u{27966}\u{46be}\u{46c7}\u{8aa0}" ++
+    "\u{27ca8}\u{8cab}\u{8cc1}\u{8d1b}\u{8d77}\u{27f2f}\u{20804}\u{8dcb}\u{8dbc}\u{8df0}" ++
+    "\u{208de}\u{8ed4}\u{285d2}\u{285ed}\u{9094}\u{90f1}\u{9111}\u{2872e}\u{911b}\u{9238}" ++
+    "\u{92d7}\u{92d8}\u{927c}\u{93f9}\u{9415}\u{28bfa}\u{958b}\u{4995}\u{95b7}\u{28d77}\u{49e6}" ++
+    "\u{96c3}\u{5db2}\u{9723}\u{29145}\u{2921a}\u{4a6e}\u{4a76}\u{97e0}\u{2940a}\u{4ab2}" ++
+    "\u{29496}\u{9829}\u{295b6}\u{98e2}\u{4b33}\u{9929}\u{99a7}\u{99c2}\u{99fe}\u{4bce}" ++
+    "\u{29b30}\u{9c40}\u{9cfd}\u{4cce}\u{4ced}\u{9d67}\u{2a0ce}\u{4cf8}\u{2a105}\u{2a20e}" ++
+    "\u{2a291}\u{4d56}\u{9efe}\u{9f05}\u{9f0f}\u{9f16}\u{2a600}";
+
+/// Half-open code point range
+pub const Range = struct { u21, u21 };
+
+pub const pvalid = [_]Range{
+    .{ 0x2d, 0x2e }, .{ 0x30, 0x3a }, .{ 0x61, 0x7b }, .{ 0xdf, 0xf7 }, .{ 0xf8, 0x100 }, .{ 0x101, 0x102 },
+    .{ 0x103, 0x104 }, .{ 0x105, 0x106 }, .{ 0x107, 0x108 }, .{ 0x109, 0x10a }, .{ 0x10b, 0x10c }, .{ 0x10d, 0x10e },
+    .{ 0x10f, 0x110 }, .{ 0x111, 0x112 }, .{ 0x113, 0x114 }, .{ 0x115, 0x116 }, .{ 0x117, 0x118 }, .{ 0x119, 0x11a },
+    .{ 0x11b, 0x11c }, .{ 0x11d, 0x11e }, .{ 0x11f, 0x120 }, .{ 0x121, 0x122 }, .{ 0x123, 0x124 }, .{ 0x125, 0x126 },
+    .{ 0x127, 0x128 }, .{ 0x129, 0x12a }, .{ 0x12b, 0x12c }, .{ 0x12d, 0x12e }, .{ 0x12f, 0x130 }, .{ 0x131, 0x132 },
+    .{ 0x135, 0x136 }, .{ 0x137, 0x139 }, .{ 0x13a, 0x13b }, .{ 0x13c, 0x13d }, .{ 0x13e, 0x13f }, .{ 0x142, 0x143 },
+    .{ 0x144, 0x145 }, .{ 0x146, 0x147 }, .{ 0x148, 0x149 }, .{ 0x14b, 0x14c }, .{ 0x14d, 0x14e }, .{ 0x14f, 0x150 },
+    .{ 0x151, 0x152 }, .{ 0x153, 0x154 }, .{ 0x155, 0x156 }, .{ 0x157, 0x158 }, .{ 0x159, 0x15a }, .{ 0x15b, 0x15c },
+    .{ 0x15d, 0x15e }, .{ 0x15f, 0x160 }, .{ 0x161, 0x162 }, .{ 0x163, 0x164 }, .{ 0x165, 0x166 }, .{ 0x167, 0x168 },
+    .{ 0x169, 0x16a }, .{ 0x16b, 0x16c }, .{ 0x16d, 0x16e }, .{ 0x16f, 0x170 }, .{ 0x171, 0x172 }, .{ 0x173, 0x174 },
+    .{ 0x175, 0x176 }, .{ 0x177, 0x178 }, .{ 0x17a, 0x17b }, .{ 0x17c, 0x17d }, .{ 0x17e, 0x17f }, .{ 0x180, 0x181 },
+    .{ 0x183, 0x184 }, .{ 0x185, 0x186 }, .{ 0x188, 0x189 }, .{ 0x18c, 0x18e }, .{ 0x192, 0x193 }, .{ 0x195, 0x196 },
+    .{ 0x199, 0x19c }, .{ 0x19e, 0x19f }, .{ 0x1a1, 0x1a2 }, .{ 0x1a3, 0x1a4 }, .{ 0x1a5, 0x1a6 }, .{ 0x1a8, 0x1a9 },
+    .{ 0x1aa, 0x1ac }, .{ 0x1ad, 0x1ae }, .{ 0x1b0, 0x1b1 }, .{ 0x1b4, 0x1b5 }, .{ 0x1b6, 0x1b7 }, .{ 0x1b9, 0x1bc },
+    .{ 0x1bd, 0x1c4 }, .{ 0x1ce, 0x1cf }, .{ 0x1d0, 0x1d1 }, .{ 0x1d2, 0x1d3 }, .{ 0x1d4, 0x1d5 }, .{ 0x1d6, 0x1d7 },
+    .{ 0x1d8, 0x1d9 }, .{ 0x1da, 0x1db }, .{ 0x1dc, 0x1de }, .{ 0x1df, 0x1e0 }, .{ 0x1e1, 0x1e2 }, .{ 0x1e3, 0x1e4 },
+    .{ 0x1e5, 0x1e6 }, .{ 0x1e7, 0x1e8 }, .{ 0x1e9, 0x1ea }, .{ 0x1eb, 0x1ec }, .{ 0x1ed, 0x1ee }, .{ 0x1ef, 0x1f1 },
+    .{ 0x1f5, 0x1f6 }, .{ 0x1f9, 0x1fa }, .{ 0x1fb, 0x1fc }, .{ 0x1fd, 0x1fe }, .{ 0x1ff, 0x200 }, .{ 0x201, 0x202 },
+    .{ 0x203, 0x204 }, .{ 0x205, 0x206 }, .{ 0x207, 0x208 }, .{ 0x209, 0x20a }, .{ 0x20b, 0x20c }, .{ 0x20d, 0x20e },
+    .{ 0x20f, 0x210 }, .{ 0x211, 0x212 }, .{ 0x213, 0x214 }, .{ 0x215, 0x216 }, .{ 0x217, 0x218 }, .{ 0x219, 0x21a },
+    .{ 0x21b, 0x21c }, .{ 0x21d, 0x21e }, .{ 0x21f, 0x220 }, .{ 0x221, 0x222 }, .{ 0x223, 0x224 }, .{ 0x225, 0x226 },
+    .{ 0x227, 0x228 }, .{ 0x229, 0x22a }, .{ 0x22b, 0x22c }, .{ 0x22d, 0x22e }, .{ 0x22f, 0x230 }, .{ 0x231, 0x232 },
+    .{ 0x233, 0x23a }, .{ 0x23c, 0x23d }, .{ 0x23f, 0x241 }, .{ 0x242, 0x243 }, .{ 0x247, 0x248 }, .{ 0x249, 0x24a },
+    .{ 0x24b, 0x24c }, .{ 0x24d, 0x24e }, .{ 0x24f, 0x2b0 }, .{ 0x2b9, 0x2c2 }, .{ 0x2c6, 0x2d2 }, .{ 0x2ec, 0x2ed },
+    .{ 0x2ee, 0x2ef }, .{ 0x300, 0x340 }, .{ 0x342, 0x343 }, .{ 0x346, 0x34f }, .{ 0x350, 0x370 }, .{ 0x371, 0x372 },
+    .{ 0x373, 0x374 }, .{ 0x377, 0x378 }, .{ 0x37b, 0x37e }, .{ 0x390, 0x391 }, .{ 0x3ac, 0x3cf }, .{ 0x3d7, 0x3d8 },
+    .{ 0x3d9, 0x3da }, .{ 0x3db, 0x3dc }, .{ 0x3dd, 0x3de }, .{ 0x3df, 0x3e0 }, .{ 0x3e1, 0x3e2 }, .{ 0x3e3, 0x3e4 },
+    .{ 0x3e5, 0x3e6 }, .{ 0x3e7, 0x3e8 }, .{ 0x3e9, 0x3ea }, .{ 0x3eb, 0x3ec }, .{ 0x3ed, 0x3ee }, .{ 0x3ef, 0x3f0 },
+    .{ 0x3f3, 0x3f4 }, .{ 0x3f8, 0x3f9 }, .{ 0x3fb, 0x3fd }, .{ 0x430, 0x460 }, .{ 0x461, 0x462 }, .{ 0x463, 0x464 },
+    .{ 0x465, 0x466 }, .{ 0x467, 0x468 }, .{ 0x469, 0x46a }, .{ 0x46b, 0x46c }, .{ 0x46d, 0x46e }, .{ 0x46f, 0x470 },
+    .{ 0x471, 0x472 }, .{ 0x473, 0x474 }, .{ 0x475, 0x476 }, .{ 0x477, 0x478 }, .{ 0x479, 0x47a }, .{ 0x47b, 0x47c },
+    .{ 0x47d, 0x47e }, .{ 0x47f, 0x480 }, .{ 0x481, 0x482 }, .{ 0x483, 0x488 }, .{ 0x48b, 0x48c }, .{ 0x48d, 0x48e },
+    .{ 0x48f, 0x490 }, .{ 0x491, 0x492 }, .{ 0x493, 0x494 }, .{ 0x495, 0x496 }, .{ 0x497, 0x498 }, .{ 0x499, 0x49a },
+    .{ 0x49b, 0x49c }, .{ 0x49d, 0x49e }, .{ 0x49f, 0x4a0 }, .{ 0x4a1, 0x4a2 }, .{ 0x4a3, 0x4a4 }, .{ 0x4a5, 0x4a6 },
+    .{ 0x4a7, 0x4a8 }, .{ 0x4a9, 0x4aa }, .{ 0x4ab, 0x4ac }, .{ 0x4ad, 0x4ae }, .{ 0x4af, 0x4b0 }, .{ 0x4b1, 0x4b2 },
+    .{ 0x4b3, 0x4b4 }, .{ 0x4b5, 0x4b6 }, .{ 0x4b7, 0x4b8 }, .{ 0x4b9, 0x4ba }, .{ 0x4bb, 0x4bc }, .{ 0x4bd, 0x4be },
+    .{ 0x4bf, 0x4c0 }, .{ 0x4c2, 0x4c3 }, .{ 0x4c4, 0x4c5 }, .{ 0x4c6, 0x4c7 }, .{ 0x4c8, 0x4c9 }, .{ 0x4ca, 0x4cb },
+    .{ 0x4cc, 0x4cd }, .{ 0x4ce, 0x4d0 }, .{ 0x4d1, 0x4d2 }, .{ 0x4d3, 0x4d4 }, .{ 0x4d5, 0x4d6 }, .{ 0x4d7, 0x4d8 },
+    .{ 0x4d9, 0x4da }, .{ 0x4db, 0x4dc }, .{ 0x4dd, 0x4de }, .{ 0x4df, 0x4e0 }, .{ 0x4e1, 0x4e2 }, .{ 0x4e3, 0x4e4 },
+    .{ 0x4e5, 0x4e6 }, .{ 0x4e7, 0x4e8 }, .{ 0x4e9, 0x4ea }, .{ 0x4eb, 0x4ec }, .{ 0x4ed, 0x4ee }, .{ 0x4ef, 0x4f0 },
+    .{ 0x4f1, 0x4f2 }, .{ 0x4f3, 0x4f4 }, .{ 0x4f5, 0x4f6 }, .{ 0x4f7, 0x4f8 }, .{ 0x4f9, 0x4fa }, .{ 0x4fb, 0x4fc },
+    .{ 0x4fd, 0x4fe }, .{ 0x4ff, 0x500 }, .{ 0x501, 0x502 }, .{ 0x503, 0x504 }, .{ 0x505, 0x506 }, .{ 0x507, 0x508 },
+    .{ 0x509, 0x50a }, .{ 0x50b, 0x50c }, .{ 0x50d, 0x50e }, .{ 0x50f, 0x510 }, .{ 0x511, 0x512 }, .{ 0x513, 0x514 },
+    .{ 0x515, 0x516 }, .{ 0x517, 0x518 }, .{ 0x519, 0x51a }, .{ 0x51b, 0x51c }, .{ 0x51d, 0x51e }, .{ 0x51f, 0x520 },
+    .{ 0x521, 0x522 }, .{ 0x523, 0x524 }, .{ 0x525, 0x526 }, .{ 0x527, 0x528 }, .{ 0x529, 0x52a }, .{ 0x52b, 0x52c },
+    .{ 0x52d, 0x52e }, .{ 0x52f, 0x530 }, .{ 0x559, 0x55a }, .{ 0x560, 0x587 }, .{ 0x588, 0x589 }, .{ 0x591, 0x5be },
+    .{ 0x5bf, 0x5c0 }, .{ 0x5c1, 0x5c3 }, .{ 0x5c4, 0x5c6 }, .{ 0x5c7, 0x5c8 }, .{ 0x5d0, 0x5eb }, .{ 0x5ef, 0x5f3 },
+    .{ 0x610, 0x61b }, .{ 0x620, 0x640 }, .{ 0x641, 0x660 }, .{ 0x66e, 0x675 }, .{ 0x679, 0x6d4 }, .{ 0x6d5, 0x6dd },
+    .{ 0x6df, 0x6e9 }, .{ 0x6ea, 0x6f0 }, .{ 0x6fa, 0x700 }, .{ 0x710, 0x74b }, .{ 0x74d, 0x7b2 }, .{ 0x7c0, 0x7f6 },
+    .{ 0x7fd, 0x7fe }, .{ 0x800, 0x82e }, .{ 0x840, 0x85c }, .{ 0x860, 0x86b }, .{ 0x870, 0x888 }, .{ 0x889, 0x88f },
+    .{ 0x898, 0x8e2 }, .{ 0x8e3, 0x958 }, .{ 0x960, 0x964 }, .{ 0x966, 0x970 }, .{ 0x971, 0x984 }, .{ 0x985, 0x98d },
+    .{ 0x98f, 0x991 }, .{ 0x993, 0x9a9 }, .{ 0x9aa, 0x9b1 }, .{ 0x9b2, 0x9b3 }, .{ 0x9b6, 0x9ba }, .{ 0x9bc, 0x9c5 },
+    .{ 0x9c7, 0x9c9 }, .{ 0x9cb, 0x9cf }, .{ 0x9d7, 0x9d8 }, .{ 0x9e0, 0x9e4 }, .{ 0x9e6, 0x9f2 }, .{ 0x9fc, 0x9fd },
+    .{ 0x9fe, 0x9ff }, .{ 0xa01, 0xa04 }, .{ 0xa05, 0xa0b }, .{ 0xa0f, 0xa11 }, .{ 0xa13, 0xa29 }, .{ 0xa2a, 0xa31 },
+    .{ 0xa32, 0xa33 }, .{ 0xa35, 0xa36 }, .{ 0xa38, 0xa3a }, .{ 0xa3c, 0xa3d }, .{ 0xa3e, 0xa43 }, .{ 0xa47, 0xa49 },
+    .{ 0xa4b, 0xa4e }, .{ 0xa51, 0xa52 }, .{ 0xa5c, 0xa5d }, .{ 0xa66, 0xa76 }, .{ 0xa81, 0xa84 }, .{ 0xa85, 0xa8e },
+    .{ 0xa8f, 0xa92 }, .{ 0xa93, 0xaa9 }, .{ 0xaaa, 0xab1 }, .{ 0xab2, 0xab4 }, .{ 0xab5, 0xaba }, .{ 0xabc, 0xac6 },
+    .{ 0xac7, 0xaca }, .{ 0xacb, 0xace }, .{ 0xad0, 0xad1 }, .{ 0xae0, 0xae4 }, .{ 0xae6, 0xaf0 }, .{ 0xaf9, 0xb00 },
+    .{ 0xb01, 0xb04 }, .{ 0xb05, 0xb0d }, .{ 0xb0f, 0xb11 }, .{ 0xb13, 0xb29 }, .{ 0xb2a, 0xb31 }, .{ 0xb32, 0xb34 },
+    .{ 0xb35, 0xb3a }, .{ 0xb3c, 0xb45 }, .{ 0xb47, 0xb49 }, .{ 0xb4b, 0xb4e }, .{ 0xb55, 0xb58 }, .{ 0xb5f, 0xb64 },
+    .{ 0xb66, 0xb70 }, .{ 0xb71, 0xb72 }, .{ 0xb82, 0xb84 }, .{ 0xb85, 0xb8b }, .{ 0xb8e, 0xb91 }, .{ 0xb92, 0xb96 },
+    .{ 0xb99, 0xb9b }, .{ 0xb9c, 0xb9d }, .{ 0xb9e, 0xba0 }, .{ 0xba3, 0xba5 }, .{ 0xba8, 0xbab }, .{ 0xbae, 0xbba },
+    .{ 0xbbe, 0xbc3 }, .{ 0xbc6, 0xbc9 }, .{ 0xbca, 0xbce }, .{ 0xbd0, 0xbd1 }, .{ 0xbd7, 0xbd8 }, .{ 0xbe6, 0xbf0 },
+    .{ 0xc00, 0xc0d }, .{ 0xc0e, 0xc11 }, .{ 0xc12, 0xc29 }, .{ 0xc2a, 0xc3a }, .{ 0xc3c, 0xc45 }, .{ 0xc46, 0xc49 },
+    .{ 0xc4a, 0xc4e }, .{ 0xc55, 0xc57 }, .{ 0xc58, 0xc5b }, .{ 0xc5d, 0xc5e }, .{ 0xc60, 0xc64 }, .{ 0xc66, 0xc70 },
+    .{ 0xc80, 0xc84 }, .{ 0xc85, 0xc8d }, .{ 0xc8e, 0xc91 }, .{ 0xc92, 0xca9 }, .{ 0xcaa, 0xcb4 }, .{ 0xcb5, 0xcba },
+    .{ 0xcbc, 0xcc5 }, .{ 0xcc6, 0xcc9 }, .{ 0xcca, 0xcce }, .{ 0xcd5, 0xcd7 }, .{ 0xcdd, 0xcdf }, .{ 0xce0, 0xce4 },
+    .{ 0xce6, 0xcf0 }, .{ 0xcf1, 0xcf4 }, .{ 0xd00, 0xd0d }, .{ 0xd0e, 0xd11 }, .{ 0xd12, 0xd45 }, .{ 0xd46, 0xd49 },
+    .{ 0xd4a, 0xd4f }, .{ 0xd54, 0xd58 }, .{ 0xd5f, 0xd64 }, .{ 0xd66, 0xd70 }, .{ 0xd7a, 0xd80 }, .{ 0xd81, 0xd84 },
+    .{ 0xd85, 0xd97 }, .{ 0xd9a, 0xdb2 }, .{ 0xdb3, 0xdbc }, .{ 0xdbd, 0xdbe }, .{ 0xdc0, 0xdc7 }, .{ 0xdca, 0xdcb },
+    .{ 0xdcf, 0xdd5 }, .{ 0xdd6, 0xdd7 }, .{ 0xdd8, 0xde0 }, .{ 0xde6, 0xdf0 }, .{ 0xdf2, 0xdf4 }, .{ 0xe01, 0xe33 },
+    .{ 0xe34, 0xe3b }, .{ 0xe40, 0xe4f }, .{ 0xe50, 0xe5a }, .{ 0xe81, 0xe83 }, .{ 0xe84, 0xe85 }, .{ 0xe86, 0xe8b },
+    .{ 0xe8c, 0xea4 }, .{ 0xea5, 0xea6 }, .{ 0xea7, 0xeb3 }, .{ 0xeb4, 0xebe }, .{ 0xec0, 0xec5 }, .{ 0xec6, 0xec7 },
+    .{ 0xec8, 0xecf }, .{ 0xed0, 0xeda }, .{ 0xede, 0xee0 }, .{ 0xf00, 0xf01 }, .{ 0xf0b, 0xf0c }, .{ 0xf18, 0xf1a },
+    .{ 0xf20, 0xf2a }, .{ 0xf35, 0xf36 }, .{ 0xf37, 0xf38 }, .{ 0xf39, 0xf3a }, .{ 0xf3e, 0xf43 }, .{ 0xf44, 0xf48 },
+    .{ 0xf49, 0xf4d }, .{ 0xf4e, 0xf52 }, .{ 0xf53, 0xf57 }, .{ 0xf58, 0xf5c }, .{ 0xf5d, 0xf69 }, .{ 0xf6a, 0xf6d },
+    .{ 0xf71, 0xf73 }, .{ 0xf74, 0xf75 }, .{ 0xf7a, 0xf81 }, .{ 0xf82, 0xf85 }, .{ 0xf86, 0xf93 }, .{ 0xf94, 0xf98 },
+    .{ 0xf99, 0xf9d }, .{ 0xf9e, 0xfa2 }, .{ 0xfa3, 0xfa7 }, .{ 0xfa8, 0xfac }, .{ 0xfad, 0xfb9 }, .{ 0xfba, 0xfbd },
+    .{ 0xfc6, 0xfc7 }, .{ 0x1000, 0x104a }, .{ 0x1050, 0x109e }, .{ 0x10d0, 0x10fb }, .{ 0x10fd, 0x1100 }, .{ 0x1200, 0x1249 },
+    .{ 0x124a, 0x124e }, .{ 0x1250, 0x1257 }, .{ 0x1258, 0x1259 }, .{ 0x125a, 0x125e }, .{ 0x1260, 0x1289 }, .{ 0x128a, 0x128e },
+    .{ 0x1290, 0x12b1 }, .{ 0x12b2, 0x12b6 }, .{ 0x12b8, 0x12bf }, .{ 0x12c0, 0x12c1 }, .{ 0x12c2, 0x12c6 }, .{ 0x12c8, 0x12d7 },
+    .{ 0x12d8, 0x1311 }, .{ 0x1312, 0x1316 }, .{ 0x1318, 0x135b }, .{ 0x135d, 0x1360 }, .{ 0x1380, 0x1390 }, .{ 0x13a0, 0x13f6 },
+    .{ 0x1401, 0x166d }, .{ 0x166f, 0x1680 }, .{ 0x1681, 0x169b }, .{ 0x16a0, 0x16eb }, .{ 0x16f1, 0x16f9 }, .{ 0x1700, 0x1716 },
+    .{ 0x171f, 0x1735 }, .{ 0x1740, 0x1754 }, .{ 0x1760, 0x176d }, .{ 0x176e, 0x1771 }, .{ 0x1772, 0x1774 }, .{ 0x1780, 0x17b4 },
+    .{ 0x17b6, 0x17d4 }, .{ 0x17d7, 0x17d8 }, .{ 0x17dc, 0x17de }, .{ 0x17e0, 0x17ea }, .{ 0x1810, 0x181a }, .{ 0x1820, 0x1879 },
+    .{ 0x1880, 0x18ab }, .{ 0x18b0, 0x18f6 }, .{ 0x1900, 0x191f }, .{ 0x1920, 0x192c }, .{ 0x1930, 0x193c }, .{ 0x1946, 0x196e },
+    .{ 0x1970, 0x1975 }, .{ 0x1980, 0x19ac }, .{ 0x19b0, 0x19ca }, .{ 0x19d0, 0x19da }, .{ 0x1a00, 0x1a1c }, .{ 0x1a20, 0x1a5f },
+    .{ 0x1a60, 0x1a7d }, .{ 0x1a7f, 0x1a8a }, .{ 0x1a90, 0x1a9a }, .{ 0x1aa7, 0x1aa8 }, .{ 0x1ab0, 0x1abe }, .{ 0x1abf, 0x1acf },
+    .{ 0x1b00, 0x1b4d }, .{ 0x1b50, 0x1b5a }, .{ 0x1b6b, 0x1b74 }, .{ 0x1b80, 0x1bf4 }, .{ 0x1c00, 0x1c38 }, .{ 0x1c40, 0x1c4a },
+    .{ 0x1c4d, 0x1c7e }, .{ 0x1cd0, 0x1cd3 }, .{ 0x1cd4, 0x1cfb }, .{ 0x1d00, 0x1d2c }, .{ 0x1d2f, 0x1d30 }, .{ 0x1d3b, 0x1d3c },
+    .{ 0x1d4e, 0x1d4f }, .{ 0x1d6b, 0x1d78 }, .{ 0x1d79, 0x1d9b }, .{ 0x1dc0, 0x1e00 }, .{ 0x1e01, 0x1e02 }, .{ 0x1e03, 0x1e04 },
+    .{ 0x1e05, 0x1e06 }, .{ 0x1e07, 0x1e08 }, .{ 0x1e09, 0x1e0a }, .{ 0x1e0b, 0x1e0c }, .{ 0x1e0d, 0x1e0e }, .{ 0x1e0f, 0x1e10 },
+    .{ 0x1e11, 0x1e12 }, .{ 0x1e13, 0x1e14 }, .{ 0x1e15, 0x1e16 }, .{ 0x1e17, 0x1e18 }, .{ 0x1e19, 0x1e1a }, .{ 0x1e1b, 0x1e1c },
+    .{ 0x1e1d, 0x1e1e }, .{ 0x1e1f, 0x1e20 }, .{ 0x1e21, 0x1e22 }, .{ 0x1e23, 0x1e24 }, .{ 0x1e25, 0x1e26 }, .{ 0x1e27, 0x1e28 },
+    .{ 0x1e29, 0x1e2a }, .{ 0x1e2b, 0x1e2c }, .{ 0x1e2d, 0x1e2e }, .{ 0x1e2f, 0x1e30 }, .{ 0x1e31, 0x1e32 }, .{ 0x1e33, 0x1e34 },
+    .{ 0x1e35, 0x1e36 }, .{ 0x1e37, 0x1e38 }, .{ 0x1e39, 0x1e3a }, .{ 0x1e3b, 0x1e3c }, .{ 0x1e3d, 0x1e3e }, .{ 0x1e3f, 0x1e40 },
+    .{ 0x1e41, 0x1e42 }, .{ 0x1e43, 0x1e44 }, .{ 0x1e45, 0x1e46 }, .{ 0x1e47, 0x1e48 }, .{ 0x1e49, 0x1e4a }, .{ 0x1e4b, 0x1e4c },
+    .{ 0x1e4d, 0x1e4e }, .{ 0x1e4f, 0x1e50 }, .{ 0x1e51, 0x1e52 }, .{ 0x1e53, 0x1e54 }, .{ 0x1e55, 0x1e56 }, .{ 0x1e57, 0x1e58 },
+    .{ 0x1e59, 0x1e5a }, .{ 0x1e5b, 0x1e5c }, .{ 0x1e5d, 0x1e5e }, .{ 0x1e5f, 0x1e60 }, .{ 0x1e61, 0x1e62 }, .{ 0x1e63, 0x1e64 },
+    .{ 0x1e65, 0x1e66 }, .{ 0x1e67, 0x1e68 }, .{ 0x1e69, 0x1e6a }, .{ 0x1e6b, 0x1e6c }, .{ 0x1e6d, 0x1e6e }, .{ 0x1e6f, 0x1e70 },
+    .{ 0x1e71, 0x1e72 }, .{ 0x1e73, 0x1e74 }, .{ 0x1e75, 0x1e76 }, .{ 0x1e77, 0x1e78 }, .{ 0x1e79, 0x1e7a }, .{ 0x1e7b, 0x1e7c },
+    .{ 0x1e7d, 0x1e7e }, .{ 0x1e7f, 0x1e80 }, .{ 0x1e81, 0x1e82 }, .{ 0x1e83, 0x1e84 }, .{ 0x1e85, 0x1e86 }, .{ 0x1e87, 0x1e88 },
+    .{ 0x1e89, 0x1e8a }, .{ 0x1e8b, 0x1e8c }, .{ 0x1e8d, 0x1e8e }, .{ 0x1e8f, 0x1e90 }, .{ 0x1e91, 0x1e92 }, .{ 0x1e93, 0x1e94 },
+    .{ 0x1e95, 0x1e9a }, .{ 0x1e9c, 0x1e9e }, .{ 0x1e9f, 0x1ea0 }, .{ 0x1ea1, 0x1ea2 }, .{ 0x1ea3, 0x1ea4 }, .{ 0x1ea5, 0x1ea6 },
+    .{ 0x1ea7, 0x1ea8 }, .{ 0x1ea9, 0x1eaa }, .{ 0x1eab, 0x1eac }, .{ 0x1ead, 0x1eae }, .{ 0x1eaf, 0x1eb0 }, .{ 0x1eb1, 0x1eb2 },
+    .{ 0x1eb3, 0x1eb4 }, .{ 0x1eb5, 0x1eb6 }, .{ 0x1eb7, 0x1eb8 }, .{ 0x1eb9, 0x1eba }, .{ 0x1ebb, 0x1ebc }, .{ 0x1ebd, 0x1ebe },
+    .{ 0x1ebf, 0x1ec0 }, .{ 0x1ec1, 0x1ec2 }, .{ 0x1ec3, 0x1ec4 }, .{ 0x1ec5, 0x1ec6 }, .{ 0x1ec7, 0x1ec8 }, .{ 0x1ec9, 0x1eca },
+    .{ 0x1ecb, 0x1ecc }, .{ 0x1ecd, 0x1ece }, .{ 0x1ecf, 0x1ed0 }, .{ 0x1ed1, 0x1ed2 }, .{ 0x1ed3, 0x1ed4 }, .{ 0x1ed5, 0x1ed6 },
+    .{ 0x1ed7, 0x1ed8 }, .{ 0x1ed9, 0x1eda }, .{ 0x1edb, 0x1edc }, .{ 0x1edd, 0x1ede }, .{ 0x1edf, 0x1ee0 }, .{ 0x1ee1, 0x1ee2 },
+    .{ 0x1ee3, 0x1ee4 }, .{ 0x1ee5, 0x1ee6 }, .{ 0x1ee7, 0x1ee8 }, .{ 0x1ee9, 0x1eea }, .{ 0x1eeb, 0x1eec }, .{ 0x1eed, 0x1eee },
+    .{ 0x1eef, 0x1ef0 }, .{ 0x1ef1, 0x1ef2 }, .{ 0x1ef3, 0x1ef4 }, .{ 0x1ef5, 0x1ef6 }, .{ 0x1ef7, 0x1ef8 }, .{ 0x1ef9, 0x1efa },
+    .{ 0x1efb, 0x1efc }, .{ 0x1efd, 0x1efe }, .{ 0x1eff, 0x1f08 }, .{ 0x1f10, 0x1f16 }, .{ 0x1f20, 0x1f28 }, .{ 0x1f30, 0x1f38 },
+    .{ 0x1f40, 0x1f46 }, .{ 0x1f50, 0x1f58 }, .{ 0x1f60, 0x1f68 }, .{ 0x1f70, 0x1f71 }, .{ 0x1f72, 0x1f73 }, .{ 0x1f74, 0x1f75 },
+    .{ 0x1f76, 0x1f77 }, .{ 0x1f78, 0x1f79 }, .{ 0x1f7a, 0x1f7b }, .{ 0x1f7c, 0x1f7d }, .{ 0x1fb0, 0x1fb2 }, .{ 0x1fb6, 0x1fb7 },
+    .{ 0x1fc6, 0x1fc7 }, .{ 0x1fd0, 0x1fd3 }, .{ 0x1fd6, 0x1fd8 }, .{ 0x1fe0, 0x1fe3 }, .{ 0x1fe4, 0x1fe8 }, .{ 0x1ff6, 0x1ff7 },
+    .{ 0x214e, 0x214f }, .{ 0x2184, 0x2185 }, .{ 0x2c30, 0x2c60 }, .{ 0x2c61, 0x2c62 }, .{ 0x2c65, 0x2c67 }, .{ 0x2c68, 0x2c69 },
+    .{ 0x2c6a, 0x2c6b }, .{ 0x2c6c, 0x2c6d }, .{ 0x2c71, 0x2c72 }, .{ 0x2c73, 0x2c75 }, .{ 0x2c76, 0x2c7c }, .{ 0x2c81, 0x2c82 },
+    .{ 0x2c83, 0x2c84 }, .{ 0x2c85, 0x2c86 }, .{ 0x2c87, 0x2c88 }, .{ 0x2c89, 0x2c8a }, .{ 0x2c8b, 0x2c8c }, .{ 0x2c8d, 0x2c8e },
+    .{ 0x2c8f, 0x2c90 }, .{ 0x2c91, 0x2c92 }, .{ 0x2c93, 0x2c94 }, .{ 0x2c95, 0x2c96 }, .{ 0x2c97, 0x2c98 }, .{ 0x2c99, 0x2c9a },
+    .{ 0x2c9b, 0x2c9c }, .{ 0x2c9d, 0x2c9e }, .{ 0x2c9f, 0x2ca0 }, .{ 0x2ca1, 0x2ca2 }, .{ 0x2ca3, 0x2ca4 }, .{ 0x2ca5, 0x2ca6 },
+    .{ 0x2ca7, 0x2ca8 }, .{ 0x2ca9, 0x2caa }, .{ 0x2cab, 0x2cac }, .{ 0x2cad, 0x2cae }, .{ 0x2caf, 0x2cb0 }, .{ 0x2cb1, 0x2cb2 },
+    .{ 0x2cb3, 0x2cb4 }, .{ 0x2cb5, 0x2cb6 }, .{ 0x2cb7, 0x2cb8 }, .{ 0x2cb9, 0x2cba }, .{ 0x2cbb, 0x2cbc }, .{ 0x2cbd, 0x2cbe },
+    .{ 0x2cbf, 0x2cc0 }, .{ 0x2cc1, 0x2cc2 }, .{ 0x2cc3, 0x2cc4 }, .{ 0x2cc5, 0x2cc6 }, .{ 0x2cc7, 0x2cc8 }, .{ 0x2cc9, 0x2cca },
+    .{ 0x2ccb, 0x2ccc }, .{ 0x2ccd, 0x2cce }, .{ 0x2ccf, 0x2cd0 }, .{ 0x2cd1, 0x2cd2 }, .{ 0x2cd3, 0x2cd4 }, .{ 0x2cd5, 0x2cd6 },
+    .{ 0x2cd7, 0x2cd8 }, .{ 0x2cd9, 0x2cda }, .{ 0x2cdb, 0x2cdc }, .{ 0x2cdd, 0x2cde }, .{ 0x2cdf, 0x2ce0 }, .{ 0x2ce1, 0x2ce2 },
+    .{ 0x2ce3, 0x2ce5 }, .{ 0x2cec, 0x2ced }, .{ 0x2cee, 0x2cf2 }, .{ 0x2cf3, 0x2cf4 }, .{ 0x2d00, 0x2d26 }, .{ 0x2d27, 0x2d28 },
+    .{ 0x2d2d, 0x2d2e }, .{ 0x2d30, 0x2d68 }, .{ 0x2d7f, 0x2d97 }, .{ 0x2da0, 0x2da7 }, .{ 0x2da8, 0x2daf }, .{ 0x2db0, 0x2db7 },
+    .{ 0x2db8, 0x2dbf }, .{ 0x2dc0, 0x2dc7 }, .{ 0x2dc8, 0x2dcf }, .{ 0x2dd0, 0x2dd7 }, .{ 0x2dd8, 0x2ddf }, .{ 0x2de0, 0x2e00 },
+    .{ 0x2e2f, 0x2e30 }, .{ 0x3005, 0x3008 }, .{ 0x302a, 0x302e }, .{ 0x303c, 0x303d }, .{ 0x3041, 0x3097 }, .{ 0x3099, 0x309b },
+    .{ 0x309d, 0x309f }, .{ 0x30a1, 0x30fb }, .{ 0x30fc, 0x30ff }, .{ 0x3105, 0x3130 }, .{ 0x31a0, 0x31c0 }, .{ 0x31f0, 0x3200 },
+    .{ 0x3400, 0x4dc0 }, .{ 0x4e00, 0xa48d }, .{ 0xa4d0, 0xa4fe }, .{ 0xa500, 0xa60d }, .{ 0xa610, 0xa62c }, .{ 0xa641, 0xa642 },
+    .{ 0xa643, 0xa644 }, .{ 0xa645, 0xa646 }, .{ 0xa647, 0xa648 }, .{ 0xa649, 0xa64a }, .{ 0xa64b, 0xa64c }, .{ 0xa64d, 0xa64e },
+    .{ 0xa64f, 0xa650 }, .{ 0xa651, 0xa652 }, .{ 0xa653, 0xa654 }, .{ 0xa655, 0xa656 }, .{ 0xa657, 0xa658 }, .{ 0xa659, 0xa65a },
+    .{ 0xa65b, 0xa65c }, .{ 0xa65d, 0xa65e }, .{ 0xa65f, 0xa660 }, .{ 0xa661, 0xa662 }, .{ 0xa663, 0xa664 }, .{ 0xa665, 0xa666 },
+    .{ 0xa667, 0xa668 }, .{ 0xa669, 0xa66a }, .{ 0xa66b, 0xa66c }, .{ 0xa66d, 0xa670 }, .{ 0xa674, 0xa67e }, .{ 0xa67f, 0xa680 },
+    .{ 0xa681, 0xa682 }, .{ 0xa683, 0xa684 }, .{ 0xa685, 0xa686 }, .{ 0xa687, 0xa688 }, .{ 0xa689, 0xa68a }, .{ 0xa68b, 0xa68c },
+    .{ 0xa68d, 0xa68e }, .{ 0xa68f, 0xa690 }, .{ 0xa691, 0xa692 }, .{ 0xa693, 0xa694 }, .{ 0xa695, 0xa696 }, .{ 0xa697, 0xa698 },
+    .{ 0xa699, 0xa69a }, .{ 0xa69b, 0xa69c }, .{ 0xa69e, 0xa6e6 }, .{ 0xa6f0, 0xa6f2 }, .{ 0xa717, 0xa720 }, .{ 0xa723, 0xa724 },
+    .{ 0xa725, 0xa726 }, .{ 0xa727, 0xa728 }, .{ 0xa729, 0xa72a }, .{ 0xa72b, 0xa72c }, .{ 0xa72d, 0xa72e }, .{ 0xa72f, 0xa732 },
+    .{ 0xa733, 0xa734 }, .{ 0xa735, 0xa736 }, .{ 0xa737, 0xa738 }, .{ 0xa739, 0xa73a }, .{ 0xa73b, 0xa73c }, .{ 0xa73d, 0xa73e },
+    .{ 0xa73f, 0xa740 }, .{ 0xa741, 0xa742 }, .{ 0xa743, 0xa744 }, .{ 0xa745, 0xa746 }, .{ 0xa747, 0xa748 }, .{ 0xa749, 0xa74a },
+    .{ 0xa74b, 0xa74c }, .{ 0xa74d, 0xa74e }, .{ 0xa74f, 0xa750 }, .{ 0xa751, 0xa752 }, .{ 0xa753, 0xa754 }, .{ 0xa755, 0xa756 },
+    .{ 0xa757, 0xa758 }, .{ 0xa759, 0xa75a }, .{ 0xa75b, 0xa75c }, .{ 0xa75d, 0xa75e }, .{ 0xa75f, 0xa760 }, .{ 0xa761, 0xa762 },
+    .{ 0xa763, 0xa764 }, .{ 0xa765, 0xa766 }, .{ 0xa767, 0xa768 }, .{ 0xa769, 0xa76a }, .{ 0xa76b, 0xa76c }, .{ 0xa76d, 0xa76e },
+    .{ 0xa76f, 0xa770 }, .{ 0xa771, 0xa779 }, .{ 0xa77a, 0xa77b }, .{ 0xa77c, 0xa77d }, .{ 0xa77f, 0xa780 }, .{ 0xa781, 0xa782 },
+    .{ 0xa783, 0xa784 }, .{ 0xa785, 0xa786 }, .{ 0xa787, 0xa789 }, .{ 0xa78c, 0xa78d }, .{ 0xa78e, 0xa790 }, .{ 0xa791, 0xa792 },
+    .{ 0xa793, 0xa796 }, .{ 0xa797, 0xa798 }, .{ 0xa799, 0xa79a }, .{ 0xa79b, 0xa79c }, .{ 0xa79d, 0xa79e }, .{ 0xa79f, 0xa7a0 },
+    .{ 0xa7a1, 0xa7a2 }, .{ 0xa7a3, 0xa7a4 }, .{ 0xa7a5, 0xa7a6 }, .{ 0xa7a7, 0xa7a8 }, .{ 0xa7a9, 0xa7aa }, .{ 0xa7af, 0xa7b0 },
+    .{ 0xa7b5, 0xa7b6 }, .{ 0xa7b7, 0xa7b8 }, .{ 0xa7b9, 0xa7ba }, .{ 0xa7bb, 0xa7bc }, .{ 0xa7bd, 0xa7be }, .{ 0xa7bf, 0xa7c0 },
+    .{ 0xa7c1, 0xa7c2 }, .{ 0xa7c3, 0xa7c4 }, .{ 0xa7c8, 0xa7c9 }, .{ 0xa7ca, 0xa7cb }, .{ 0xa7d1, 0xa7d2 }, .{ 0xa7d3, 0xa7d4 },
+    .{ 0xa7d5, 0xa7d6 }, .{ 0xa7d7, 0xa7d8 }, .{ 0xa7d9, 0xa7da }, .{ 0xa7f6, 0xa7f8 }, .{ 0xa7fa, 0xa828 }, .{ 0xa82c, 0xa82d },
+    .{ 0xa840, 0xa874 }, .{ 0xa880, 0xa8c6 }, .{ 0xa8d0, 0xa8da }, .{ 0xa8e0, 0xa8f8 }, .{ 0xa8fb, 0xa8fc }, .{ 0xa8fd, 0xa92e },
+    .{ 0xa930, 0xa954 }, .{ 0xa980, 0xa9c1 }, .{ 0xa9cf, 0xa9da }, .{ 0xa9e0, 0xa9ff }, .{ 0xaa00, 0xaa37 }, .{ 0xaa40, 0xaa4e },
+    .{ 0xaa50, 0xaa5a }, .{ 0xaa60, 0xaa77 }, .{ 0xaa7a, 0xaac3 }, .{ 0xaadb, 0xaade }, .{ 0xaae0, 0xaaf0 }, .{ 0xaaf2, 0xaaf7 },
+    .{ 0xab01, 0xab07 }, .{ 0xab09, 0xab0f }, .{ 0xab11, 0xab17 }, .{ 0xab20, 0xab27 }, .{ 0xab28, 0xab2f }, .{ 0xab30, 0xab5b },
+    .{ 0xab60, 0xab69 }, .{ 0xabc0, 0xabeb }, .{ 0xabec, 0xabee }, .{ 0xabf0, 0xabfa }, .{ 0xac00, 0xd7a4 }, .{ 0xfa0e, 0xfa10 },
+    .{ 0xfa11, 0xfa12 }, .{ 0xfa13, 0xfa15 }, .{ 0xfa1f, 0xfa20 }, .{ 0xfa21, 0xfa22 }, .{ 0xfa23, 0xfa25 }, .{ 0xfa27, 0xfa2a },
+    .{ 0xfb1e, 0xfb1f }, .{ 0xfe20, 0xfe30 }, .{ 0xfe73, 0xfe74 }, .{ 0x10000, 0x1000c }, .{ 0x1000d, 0x10027 }, .{ 0x10028, 0x1003b },
+    .{ 0x1003c, 0x1003e }, .{ 0x1003f, 0x1004e }, .{ 0x10050, 0x1005e }, .{ 0x10080, 0x100fb }, .{ 0x101fd, 0x101fe }, .{ 0x10280, 0x1029d },
+    .{ 0x102a0, 0x102d1 }, .{ 0x102e0, 0x102e1 }, .{ 0x10300, 0x10320 }, .{ 0x1032d, 0x10341 }, .{ 0x10342, 0x1034a }, .{ 0x10350, 0x1037b },
+    .{ 0x10380, 0x1039e }, .{ 0x103a0, 0x103c4 }, .{ 0x103c8, 0x103d0 }, .{ 0x10428, 0x1049e }, .{ 0x104a0, 0x104aa }, .{ 0x104d8, 0x104fc },
+    .{ 0x10500, 0x10528 }, .{ 0x10530, 0x10564 }, .{ 0x10597, 0x105a2 }, .{ 0x105a3, 0x105b2 }, .{ 0x105b3, 0x105ba }, .{ 0x105bb, 0x105bd },
+    .{ 0x10600, 0x10737 }, .{ 0x10740, 0x10756 }, .{ 0x10760, 0x10768 }, .{ 0x10780, 0x10781 }, .{ 0x10800, 0x10806 }, .{ 0x10808, 0x10809 },
+    .{ 0x1080a, 0x10836 }, .{ 0x10837, 0x10839 }, .{ 0x1083c, 0x1083d }, .{ 0x1083f, 0x10856 }, .{ 0x10860, 0x10877 }, .{ 0x10880, 0x1089f },
+    .{ 0x108e0, 0x108f3 }, .{ 0x108f4, 0x108f6 }, .{ 0x10900, 0x10916 }, .{ 0x10920, 0x1093a }, .{ 0x10980, 0x109b8 }, .{ 0x109be, 0x109c0 },
+    .{ 0x10a00, 0x10a04 }, .{ 0x10a05, 0x10a07 }, .{ 0x10a0c, 0x10a14 }, .{ 0x10a15, 0x10a18 }, .{ 0x10a19, 0x10a36 }, .{ 0x10a38, 0x10a3b },
+    .{ 0x10a3f, 0x10a40 }, .{ 0x10a60, 0x10a7d }, .{ 0x10a80, 0x10a9d }, .{ 0x10ac0, 0x10ac8 }, .{ 0x10ac9, 0x10ae7 }, .{ 0x10b00, 0x10b36 },
+    .{ 0x10b40, 0x10b56 }, .{ 0x10b60, 0x10b73 }, .{ 0x10b80, 0x10b92 }, .{ 0x10c00, 0x10c49 }, .{ 0x10cc0, 0x10cf3 }, .{ 0x10d00, 0x10d28 },
+    .{ 0x10d30, 0x10d3a }, .{ 0x10e80, 0x10eaa }, .{ 0x10eab, 0x10ead }, .{ 0x10eb0, 0x10eb2 }, .{ 0x10efd, 0x10f1d }, .{ 0x10f27, 0x10f28 },
+    .{ 0x10f30, 0x10f51 }, .{ 0x10f70, 0x10f86 }, .{ 0x10fb0, 0x10fc5 }, .{ 0x10fe0, 0x10ff7 }, .{ 0x11000, 0x11047 }, .{ 0x11066, 0x11076 },
+    .{ 0x1107f, 0x110bb }, .{ 0x110c2, 0x110c3 }, .{ 0x110d0, 0x110e9 }, .{ 0x110f0, 0x110fa }, .{ 0x11100, 0x11135 }, .{ 0x11136, 0x11140 },
+    .{ 0x11144, 0x11148 }, .{ 0x11150, 0x11174 }, .{ 0x11176, 0x11177 }, .{ 0x11180, 0x111c5 }, .{ 0x111c9, 0x111cd }, .{ 0x111ce, 0x111db },
+    .{ 0x111dc, 0x111dd }, .{ 0x11200, 0x11212 }, .{ 0x11213, 0x11238 }, .{ 0x1123e, 0x11242 }, .{ 0x11280, 0x11287 }, .{ 0x11288, 0x11289 },
+    .{ 0x1128a, 0x1128e }, .{ 0x1128f, 0x1129e }, .{ 0x1129f, 0x112a9 }, .{ 0x112b0, 0x112eb }, .{ 0x112f0, 0x112fa }, .{ 0x11300, 0x11304 },
+    .{ 0x11305, 0x1130d }, .{ 0x1130f, 0x11311 }, .{ 0x11313, 0x11329 }, .{ 0x1132a, 0x11331 }, .{ 0x11332, 0x11334 }, .{ 0x11335, 0x1133a },
+    .{ 0x1133b, 0x11345 }, .{ 0x11347, 0x11349 }, .{ 0x1134b, 0x1134e }, .{ 0x11350, 0x11351 }, .{ 0x11357, 0x11358 }, .{ 0x1135d, 0x11364 },
+    .{ 0x11366, 0x1136d }, .{ 0x11370, 0x11375 }, .{ 0x11400, 0x1144b }, .{ 0x11450, 0x1145a }, .{ 0x1145e, 0x11462 }, .{ 0x11480, 0x114c6 },
+    .{ 0x114c7, 0x114c8 }, .{ 0x114d0, 0x114da }, .{ 0x11580, 0x115b6 }, .{ 0x115b8, 0x115c1 }, .{ 0x115d8, 0x115de }, .{ 0x11600, 0x11641 },
+    .{ 0x11644, 0x11645 }, .{ 0x11650, 0x1165a }, .{ 0x11680, 0x116b9 }, .{ 0x116c0, 0x116ca }, .{ 0x11700, 0x1171b }, .{ 0x1171d, 0x1172c },
+    .{ 0x11730, 0x1173a }, .{ 0x11740, 0x11747 }, .{ 0x11800, 0x1183b }, .{ 0x118c0, 0x118ea }, .{ 0x118ff, 0x11907 }, .{ 0x11909, 0x1190a },
+    .{ 0x1190c, 0x11914 }, .{ 0x11915, 0x11917 }, .{ 0x11918, 0x11936 }, .{ 0x11937, 0x11939 }, .{ 0x1193b, 0x11944 }, .{ 0x11950, 0x1195a },
+    .{ 0x119a0, 0x119a8 }, .{ 0x119aa, 0x119d8 }, .{ 0x119da, 0x119e2 }, .{ 0x119e3, 0x119e5 }, .{ 0x11a00, 0x11a3f }, .{ 0x11a47, 0x11a48 },
+    .{ 0x11a50, 0x11a9a }, .{ 0x11a9d, 0x11a9e }, .{ 0x11ab0, 0x11af9 }, .{ 0x11c00, 0x11c09 }, .{ 0x11c0a, 0x11c37 }, .{ 0x11c38, 0x11c41 },
+    .{ 0x11c50, 0x11c5a }, .{ 0x11c72, 0x11c90 }, .{ 0x11c92, 0x11ca8 }, .{ 0x11ca9, 0x11cb7 }, .{ 0x11d00, 0x11d07 }, .{ 0x11d08, 0x11d0a },
+    .{ 0x11d0b, 0x11d37 }, .{ 0x11d3a, 0x11d3b }, .{ 0x11d3c, 0x11d3e }, .{ 0x11d3f, 0x11d48 }, .{ 0x11d50, 0x11d5a }, .{ 0x11d60, 0x11d66 },
+    .{ 0x11d67, 0x11d69 }, .{ 0x11d6a, 0x11d8f }, .{ 0x11d90, 0x11d92 }, .{ 0x11d93, 0x11d99 }, .{ 0x11da0, 0x11daa }, .{ 0x11ee0, 0x11ef7 },
+    .{ 0x11f00, 0x11f11 }, .{ 0x11f12, 0x11f3b }, .{ 0x11f3e, 0x11f43 }, .{ 0x11f50, 0x11f5a }, .{ 0x11fb0, 0x11fb1 }, .{ 0x12000, 0x1239a },
+    .{ 0x12480, 0x12544 }, .{ 0x12f90, 0x12ff1 }, .{ 0x13000, 0x13430 }, .{ 0x13440, 0x13456 }, .{ 0x14400, 0x14647 }, .{ 0x16800, 0x16a39 },
+    .{ 0x16a40, 0x16a5f }, .{ 0x16a60, 0x16a6a }, .{ 0x16a70, 0x16abf }, .{ 0x16ac0, 0x16aca }, .{ 0x16ad0, 0x16aee }, .{ 0x16af0, 0x16af5 },
+    .{ 0x16b00, 0x16b37 }, .{ 0x16b40, 0x16b44 }, .{ 0x16b50, 0x16b5a }, .{ 0x16b63, 0x16b78 }, .{ 0x16b7d, 0x16b90 }, .{ 0x16e60, 0x16e80 },
+    .{ 0x16f00, 0x16f4b }, .{ 0x16f4f, 0x16f88 }, .{ 0x16f8f, 0x16fa0 }, .{ 0x16fe0, 0x16fe2 }, .{ 0x16fe3, 0x16fe5 }, .{ 0x16ff0, 0x16ff2 },
+    .{ 0x17000, 0x187f8 }, .{ 0x18800, 0x18cd6 }, .{ 0x18d00, 0x18d09 }, .{ 0x1aff0, 0x1aff4 }, .{ 0x1aff5, 0x1affc }, .{ 0x1affd, 0x1afff },
+    .{ 0x1b000, 0x1b123 }, .{ 0x1b132, 0x1b133 }, .{ 0x1b150, 0x1b153 }, .{ 0x1b155, 0x1b156 }, .{ 0x1b164, 0x1b168 }, .{ 0x1b170, 0x1b2fc },
+    .{ 0x1bc00, 0x1bc6b }, .{ 0x1bc70, 0x1bc7d }, .{ 0x1bc80, 0x1bc89 }, .{ 0x1bc90, 0x1bc9a }, .{ 0x1bc9d, 0x1bc9f }, .{ 0x1cf00, 0x1cf2e },
+    .{ 0x1cf30, 0x1cf47 }, .{ 0x1da00, 0x1da37 }, .{ 0x1da3b, 0x1da6d }, .{ 0x1da75, 0x1da76 }, .{ 0x1da84, 0x1da85 }, .{ 0x1da9b, 0x1daa0 },
+    .{ 0x1daa1, 0x1dab0 }, .{ 0x1df00, 0x1df1f }, .{ 0x1df25, 0x1df2b }, .{ 0x1e000, 0x1e007 }, .{ 0x1e008, 0x1e019 }, .{ 0x1e01b, 0x1e022 },
+    .{ 0x1e023, 0x1e025 }, .{ 0x1e026, 0x1e02b }, .{ 0x1e08f, 0x1e090 }, .{ 0x1e100, 0x1e12d }, .{ 0x1e130, 0x1e13e }, .{ 0x1e140, 0x1e14a },
+    .{ 0x1e14e, 0x1e14f }, .{ 0x1e290, 0x1e2af }, .{ 0x1e2c0, 0x1e2fa }, .{ 0x1e4d0, 0x1e4fa }, .{ 0x1e7e0, 0x1e7e7 }, .{ 0x1e7e8, 0x1e7ec },
+    .{ 0x1e7ed, 0x1e7ef }, .{ 0x1e7f0, 0x1e7ff }, .{ 0x1e800, 0x1e8c5 }, .{ 0x1e8d0, 0x1e8d7 }, .{ 0x1e922, 0x1e94c }, .{ 0x1e950, 0x1e95a },
+    .{ 0x20000, 0x2a6e0 }, .{ 0x2a700, 0x2b73a }, .{ 0x2b740, 0x2b81e }, .{ 0x2b820, 0x2cea2 }, .{ 0x2ceb0, 0x2ebe1 }, .{ 0x2ebf0, 0x2ee5e },
+    .{ 0x30000, 0x3134b }, .{ 0x31350, 0x323b0 },
+};
+
+pub const contextj = [_]Range{
+    .{ 0x200c, 0x200e },
+};
+
+pub const contexto = [_]Range{
+    .{ 0xb7, 0xb8 }, .{ 0x375, 0x376 }, .{ 0x5f3, 0x5f5 }, .{ 0x660, 0x66a }, .{ 0x6f0, 0x6fa }, .{ 0x30fb, 0x30fc },
+};
+
+pub const greek = [_]Range{
+    .{ 0x370, 0x374 }, .{ 0x375, 0x378 }, .{ 0x37a, 0x37e }, .{ 0x37f, 0x380 }, .{ 0x384, 0x385 }, .{ 0x386, 0x387 },
+    .{ 0x388, 0x38b }, .{ 0x38c, 0x38d }, .{ 0x38e, 0x3a2 }, .{ 0x3a3, 0x3e2 }, .{ 0x3f0, 0x400 }, .{ 0x1d26, 0x1d2b },
+    .{ 0x1d5d, 0x1d62 }, .{ 0x1d66, 0x1d6b }, .{ 0x1dbf, 0x1dc0 }, .{ 0x1f00, 0x1f16 }, .{ 0x1f18, 0x1f1e }, .{ 0x1f20, 0x1f46 },
+    .{ 0x1f48, 0x1f4e }, .{ 0x1f50, 0x1f58 }, .{ 0x1f59, 0x1f5a }, .{ 0x1f5b, 0x1f5c }, .{ 0x1f5d, 0x1f5e }, .{ 0x1f5f, 0x1f7e },
+    .{ 0x1f80, 0x1fb5 }, .{ 0x1fb6, 0x1fc5 }, .{ 0x1fc6, 0x1fd4 }, .{ 0x1fd6, 0x1fdc }, .{ 0x1fdd, 0x1ff0 }, .{ 0x1ff2, 0x1ff5 },
+    .{ 0x1ff6, 0x1fff }, .{ 0x2126, 0x2127 }, .{ 0xab65, 0xab66 }, .{ 0x10140, 0x1018f }, .{ 0x101a0, 0x101a1 }, .{ 0x1d200, 0x1d246 },
+};
+
+pub const han = [_]Range{
+    .{ 0x2e80, 0x2e9a }, .{ 0x2e9b, 0x2ef4 }, .{ 0x2f00, 0x2fd6 }, .{ 0x3005, 0x3006 }, .{ 0x3007, 0x3008 }, .{ 0x3021, 0x302a },
+    .{ 0x3038, 0x303c }, .{ 0x3400, 0x4dc0 }, .{ 0x4e00, 0xa000 }, .{ 0xf900, 0xfa6e }, .{ 0xfa70, 0xfada }, .{ 0x16fe2, 0x16fe4 },
+    .{ 0x16ff0, 0x16ff2 }, .{ 0x20000, 0x2a6e0 }, .{ 0x2a700, 0x2b73a }, .{ 0x2b740, 0x2b81e }, .{ 0x2b820, 0x2cea2 }, .{ 0x2ceb0, 0x2ebe1 },
+    .{ 0x2ebf0, 0x2ee5e }, .{ 0x2f800, 0x2fa1e }, .{ 0x30000, 0x3134b }, .{ 0x31350, 0x323b0 },
+};
+
+pub const hebrew = [_]Range{
+    .{ 0x591, 0x5c8 }, .{ 0x5d0, 0x5eb }, .{ 0x5ef, 0x5f5 }, .{ 0xfb1d, 0xfb37 }, .{ 0xfb38, 0xfb3d }, .{ 0xfb3e, 0xfb3f },
+    .{ 0xfb40, 0xfb42 }, .{ 0xfb43, 0xfb45 }, .{ 0xfb46, 0xfb50 },
+};
+
+pub const hiragana = [_]Range{
+    .{ 0x3041, 0x3097 }, .{ 0x309d, 0x30a0 }, .{ 0x1b001, 0x1b120 }, .{ 0x1b132, 0x1b133 }, .{ 0x1b150, 0x1b153 }, .{ 0x1f200, 0x1f201 },
+};
+
+pub const katakana = [_]Range{
+    .{ 0x30a1, 0x30fb }, .{ 0x30fd, 0x3100 }, .{ 0x31f0, 0x3200 }, .{ 0x32d0, 0x32ff }, .{ 0x3300, 0x3358 }, .{ 0xff66, 0xff70 },
+    .{ 0xff71, 0xff9e }, .{ 0x1aff0, 0x1aff4 }, .{ 0x1aff5, 0x1affc }, .{ 0x1affd, 0x1afff }, .{ 0x1b000, 0x1b001 }, .{ 0x1b120, 0x1b123 },
+    .{ 0x1b155, 0x1b156 }, .{ 0x1b164, 0x1b168 },
+};
+
+/// Half-open range and its Arabic-style joining type ('C', 'D', 'L', 'R', 'T', 'U')
+pub const JoiningRange = struct { u21, u21, u8 };
+
+pub const joining_types = [_]JoiningRange{
+    .{ 0xad, 0xae, 'T' }, .{ 0x300, 0x370, 'T' }, .{ 0x483, 0x48a, 'T' }, .{ 0x591, 0x5be, 'T' }, .{ 0x5bf, 0x5c0, 'T' },
+    .{ 0x5c1, 0x5c3, 'T' }, .{ 0x5c4, 0x5c6, 'T' }, .{ 0x5c7, 0x5c8, 'T' }, .{ 0x610, 0x61b, 'T' }, .{ 0x61c, 0x61d, 'T' },
+    .{ 0x620, 0x621, 'D' }, .{ 0x622, 0x626, 'R' }, .{ 0x626, 0x627, 'D' }, .{ 0x627, 0x628, 'R' }, .{ 0x628, 0x629, 'D' },
+    .{ 0x629, 0x62a, 'R' }, .{ 0x62a, 0x62f, 'D' }, .{ 0x62f, 0x633, 'R' }, .{ 0x633, 0x640, 'D' }, .{ 0x640, 0x641, 'C' },
+    .{ 0x641, 0x648, 'D' }, .{ 0x648, 0x649, 'R' }, .{ 0x649, 0x64b, 'D' }, .{ 0x64b, 0x660, 'T' }, .{ 0x66e, 0x670, 'D' },
+    .{ 0x670, 0x671, 'T' }, .{ 0x671, 0x674, 'R' }, .{ 0x675, 0x678, 'R' }, .{ 0x678, 0x688, 'D' }, .{ 0x688, 0x69a, 'R' },
+    .{ 0x69a, 0x6c0, 'D' }, .{ 0x6c0, 0x6c1, 'R' }, .{ 0x6c1, 0x6c3, 'D' }, .{ 0x6c3, 0x6cc, 'R' }, .{ 0x6cc, 0x6cd, 'D' },
+    .{ 0x6cd, 0x6ce, 'R' }, .{ 0x6ce, 0x6cf, 'D' }, .{ 0x6cf, 0x6d0, 'R' }, .{ 0x6d0, 0x6d2, 'D' }, .{ 0x6d2, 0x6d4, 'R' },
+    .{ 0x6d5, 0x6d6, 'R' }, .{ 0x6d6, 0x6dd, 'T' }, .{ 0x6df, 0x6e5, 'T' }, .{ 0x6e7, 0x6e9, 'T' }, .{ 0x6ea, 0x6ee, 'T' },
+    .{ 0x6ee, 0x6f0, 'R' }, .{ 0x6fa, 0x6fd, 'D' }, .{ 0x6ff, 0x700, 'D' }, .{ 0x70f, 0x710, 'T' }, .{ 0x710, 0x711, 'R' },
+    .{ 0x711, 0x712, 'T' }, .{ 0x712, 0x715, 'D' }, .{ 0x715, 0x71a, 'R' }, .{ 0x71a, 0x71e, 'D' }, .{ 0x71e, 0x71f, 'R' },
+    .{ 0x71f, 0x728, 'D' }, .{ 0x728, 0x729, 'R' }, .{ 0x729, 0x72a, 'D' }, .{ 0x72a, 0x72b, 'R' }, .{ 0x72b, 0x72c, 'D' },
+    .{ 0x72c, 0x72d, 'R' }, .{ 0x72d, 0x72f, 'D' }, .{ 0x72f, 0x730, 'R' }, .{ 0x730, 0x74b, 'T' }, .{ 0x74d, 0x74e, 'R' },
+    .{ 0x74e, 0x759, 'D' }, .{ 0x759, 0x75c, 'R' }, .{ 0x75c, 0x76b, 'D' }, .{ 0x76b, 0x76d, 'R' }, .{ 0x76d, 0x771, 'D' },
+    .{ 0x771, 0x772, 'R' }, .{ 0x772, 0x773, 'D' }, .{ 0x773, 0x775, 'R' }, .{ 0x775, 0x778, 'D' }, .{ 0x778, 0x77a, 'R' },
+    .{ 0x77a, 0x780, 'D' }, .{ 0x7a6, 0x7b1, 'T' }, .{ 0x7ca, 0x7eb, 'D' }, .{ 0x7eb, 0x7f4, 'T' }, .{ 0x7fa, 0x7fb, 'C' },
+    .{ 0x7fd, 0x7fe, 'T' }, .{ 0x816, 0x81a, 'T' }, .{ 0x81b, 0x824, 'T' }, .{ 0x825, 0x828, 'T' }, .{ 0x829, 0x82e, 'T' },
+    .{ 0x840, 0x841, 'R' }, .{ 0x841, 0x846, 'D' }, .{ 0x846, 0x848, 'R' }, .{ 0x848, 0x849, 'D' }, .{ 0x849, 0x84a, 'R' },
+    .{ 0x84a, 0x854, 'D' }, .{ 0x854, 0x855, 'R' }, .{ 0x855, 0x856, 'D' }, .{ 0x856, 0x859, 'R' }, .{ 0x859, 0x85c, 'T' },
+    .{ 0x860, 0x861, 'D' }, .{ 0x862, 0x866, 'D' }, .{ 0x867, 0x868, 'R' }, .{ 0x868, 0x869, 'D' }, .{ 0x869, 0x86b, 'R' },
+    .{ 0x870, 0x883, 'R' }, .{ 0x883, 0x886, 'C' }, .{ 0x886, 0x887, 'D' }, .{ 0x889, 0x88e, 'D' }, .{ 0x88e, 0x88f, 'R' },
+    .{ 0x898, 0x8a0, 'T' }, .{ 0x8a0, 0x8aa, 'D' }, .{ 0x8aa, 0x8ad, 'R' }, .{ 0x8ae, 0x8af, 'R' }, .{ 0x8af, 0x8b1, 'D' },
+    .{ 0x8b1, 0x8b3, 'R' }, .{ 0x8b3, 0x8b9, 'D' }, .{ 0x8b9, 0x8ba, 'R' }, .{ 0x8ba, 0x8c9, 'D' }, .{ 0x8ca, 0x8e2, 'T' },
+    .{ 0x8e3, 0x903, 'T' }, .{ 0x93a, 0x93b, 'T' }, .{ 0x93c, 0x93d, 'T' }, .{ 0x941, 0x949, 'T' }, .{ 0x94d, 0x94e, 'T' },
+    .{ 0x951, 0x958, 'T' }, .{ 0x962, 0x964, 'T' }, .{ 0x981, 0x982, 'T' }, .{ 0x9bc, 0x9bd, 'T' }, .{ 0x9c1, 0x9c5, 'T' },
+    .{ 0x9cd, 0x9ce, 'T' }, .{ 0x9e2, 0x9e4, 'T' }, .{ 0x9fe, 0x9ff, 'T' }, .{ 0xa01, 0xa03, 'T' }, .{ 0xa3c, 0xa3d, 'T' },
+    .{ 0xa41, 0xa43, 'T' }, .{ 0xa47, 0xa49, 'T' }, .{ 0xa4b, 0xa4e, 'T' }, .{ 0xa51, 0xa52, 'T' }, .{ 0xa70, 0xa72, 'T' },
+    .{ 0xa75, 0xa76, 'T' }, .{ 0xa81, 0xa83, 'T' }, .{ 0xabc, 0xabd, 'T' }, .{ 0xac1, 0xac6, 'T' }, .{ 0xac7, 0xac9, 'T' },
+    .{ 0xacd, 0xace, 'T' }, .{ 0xae2, 0xae4, 'T' }, .{ 0xafa, 0xb00, 'T' }, .{ 0xb01, 0xb02, 'T' }, .{ 0xb3c, 0xb3d, 'T' },
+    .{ 0xb3f, 0xb40, 'T' }, .{ 0xb41, 0xb45, 'T' }, .{ 0xb4d, 0xb4e, 'T' }, .{ 0xb55, 0xb57, 'T' }, .{ 0xb62, 0xb64, 'T' },
+    .{ 0xb82, 0xb83, 'T' }, .{ 0xbc0, 0xbc1, 'T' }, .{ 0xbcd, 0xbce, 'T' }, .{ 0xc00, 0xc01, 'T' }, .{ 0xc04, 0xc05, 'T' },
+    .{ 0xc3c, 0xc3d, 'T' }, .{ 0xc3e, 0xc41, 'T' }, .{ 0xc46, 0xc49, 'T' }, .{ 0xc4a, 0xc4e, 'T' }, .{ 0xc55, 0xc57, 'T' },
+    .{ 0xc62, 0xc64, 'T' }, .{ 0xc81, 0xc82, 'T' }, .{ 0xcbc, 0xcbd, 'T' }, .{ 0xcbf, 0xcc0, 'T' }, .{ 0xcc6, 0xcc7, 'T' },
+    .{ 0xccc, 0xcce, 'T' }, .{ 0xce2, 0xce4, 'T' }, .{ 0xd00, 0xd02, 'T' }, .{ 0xd3b, 0xd3d, 'T' }, .{ 0xd41, 0xd45, 'T' },
+    .{ 0xd4d, 0xd4e, 'T' }, .{ 0xd62, 0xd64, 'T' }, .{ 0xd81, 0xd82, 'T' }, .{ 0xdca, 0xdcb, 'T' }, .{ 0xdd2, 0xdd5, 'T' },
+    .{ 0xdd6, 0xdd7, 'T' }, .{ 0xe31, 0xe32, 'T' }, .{ 0xe34, 0xe3b, 'T' }, .{ 0xe47, 0xe4f, 'T' }, .{ 0xeb1, 0xeb2, 'T' },
+    .{ 0xeb4, 0xebd, 'T' }, .{ 0xec8, 0xecf, 'T' }, .{ 0xf18, 0xf1a, 'T' }, .{ 0xf35, 0xf36, 'T' }, .{ 0xf37, 0xf38, 'T' },
+    .{ 0xf39, 0xf3a, 'T' }, .{ 0xf71, 0xf7f, 'T' }, .{ 0xf80, 0xf85, 'T' }, .{ 0xf86, 0xf88, 'T' }, .{ 0xf8d, 0xf98, 'T' },
+    .{ 0xf99, 0xfbd, 'T' }, .{ 0xfc6, 0xfc7, 'T' }, .{ 0x102d, 0x1031, 'T' }, .{ 0x1032, 0x1038, 'T' }, .{ 0x1039, 0x103b, 'T' },
+    .{ 0x103d, 0x103f, 'T' }, .{ 0x1058, 0x105a, 'T' }, .{ 0x105e, 0x1061, 'T' }, .{ 0x1071, 0x1075, 'T' }, .{ 0x1082, 0x1083, 'T' },
+    .{ 0x1085, 0x1087, 'T' }, .{ 0x108d, 0x108e, 'T' }, .{ 0x109d, 0x109e, 'T' }, .{ 0x135d, 0x1360, 'T' }, .{ 0x1712, 0x1715, 'T' },
+    .{ 0x1732, 0x1734, 'T' }, .{ 0x1752, 0x1754, 'T' }, .{ 0x1772, 0x1774, 'T' }, .{ 0x17b4, 0x17b6, 'T' }, .{ 0x17b7, 0x17be, 'T' },
+    .{ 0x17c6, 0x17c7, 'T' }, .{ 0x17c9, 0x17d4, 'T' }, .{ 0x17dd, 0x17de, 'T' }, .{ 0x1807, 0x1808, 'D' }, .{ 0x180a, 0x180b, 'C' },
+    .{ 0x180b, 0x180e, 'T' }, .{ 0x180f, 0x1810, 'T' }, .{ 0x1820, 0x1879, 'D' }, .{ 0x1885, 0x1887, 'T' }, .{ 0x1887, 0x18a9, 'D' },
+    .{ 0x18a9, 0x18aa, 'T' }, .{ 0x18aa, 0x18ab, 'D' }, .{ 0x1920, 0x1923, 'T' }, .{ 0x1927, 0x1929, 'T' }, .{ 0x1932, 0x1933, 'T' },
+    .{ 0x1939, 0x193c, 'T' }, .{ 0x1a17, 0x1a19, 'T' }, .{ 0x1a1b, 0x1a1c, 'T' }, .{ 0x1a56, 0x1a57, 'T' }, .{ 0x1a58, 0x1a5f, 'T' },
+    .{ 0x1a60, 0x1a61, 'T' }, .{ 0x1a62, 0x1a63, 'T' }, .{ 0x1a65, 0x1a6d, 'T' }, .{ 0x1a73, 0x1a7d, 'T' }, .{ 0x1a7f, 0x1a80, 'T' },
+    .{ 0x1ab0, 0x1acf, 'T' }, .{ 0x1b00, 0x1b04, 'T' }, .{ 0x1b34, 0x1b35, 'T' }, .{ 0x1b36, 0x1b3b, 'T' }, .{ 0x1b3c, 0x1b3d, 'T' },
+    .{ 0x1b42, 0x1b43, 'T' }, .{ 0x1b6b, 0x1b74, 'T' }, .{ 0x1b80, 0x1b82, 'T' }, .{ 0x1ba2, 0x1ba6, 'T' }, .{ 0x1ba8, 0x1baa, 'T' },
+    .{ 0x1bab, 0x1bae, 'T' }, .{ 0x1be6, 0x1be7, 'T' }, .{ 0x1be8, 0x1bea, 'T' }, .{ 0x1bed, 0x1bee, 'T' }, .{ 0x1bef, 0x1bf2, 'T' },
+    .{ 0x1c2c, 0x1c34, 'T' }, .{ 0x1c36, 0x1c38, 'T' }, .{ 0x1cd0, 0x1cd3, 'T' }, .{ 0x1cd4, 0x1ce1, 'T' }, .{ 0x1ce2, 0x1ce9, 'T' },
+    .{ 0x1ced, 0x1cee, 'T' }, .{ 0x1cf4, 0x1cf5, 'T' }, .{ 0x1cf8, 0x1cfa, 'T' }, .{ 0x1dc0, 0x1e00, 'T' }, .{ 0x200b, 0x200c, 'T' },
+    .{ 0x200d, 0x200e, 'C' }, .{ 0x200e, 0x2010, 'T' }, .{ 0x202a, 0x202f, 'T' }, .{ 0x2060, 0x2065, 'T' }, .{ 0x206a, 0x2070, 'T' },
+    .{ 0x20d0, 0x20f1, 'T' }, .{ 0x2cef, 0x2cf2, 'T' }, .{ 0x2d7f, 0x2d80, 'T' }, .{ 0x2de0, 0x2e00, 'T' }, .{ 0x302a, 0x302e, 'T' },
+    .{ 0x3099, 0x309b, 'T' }, .{ 0xa66f, 0xa673, 'T' }, .{ 0xa674, 0xa67e, 'T' }, .{ 0xa69e, 0xa6a0, 'T' }, .{ 0xa6f0, 0xa6f2, 'T' },
+    .{ 0xa802, 0xa803, 'T' }, .{ 0xa806, 0xa807, 'T' }, .{ 0xa80b, 0xa80c, 'T' }, .{ 0xa825, 0xa827, 'T' }, .{ 0xa82c, 0xa82d, 'T' },
+    .{ 0xa840, 0xa872, 'D' }, .{ 0xa872, 0xa873, 'L' }, .{ 0xa8c4, 0xa8c6, 'T' }, .{ 0xa8e0, 0xa8f2, 'T' }, .{ 0xa8ff, 0xa900, 'T' },
+    .{ 0xa926, 0xa92e, 'T' }, .{ 0xa947, 0xa952, 'T' }, .{ 0xa980, 0xa983, 'T' }, .{ 0xa9b3, 0xa9b4, 'T' }, .{ 0xa9b6, 0xa9ba, 'T' },
+    .{ 0xa9bc, 0xa9be, 'T' }, .{ 0xa9e5, 0xa9e6, 'T' }, .{ 0xaa29, 0xaa2f, 'T' }, .{ 0xaa31, 0xaa33, 'T' }, .{ 0xaa35, 0xaa37, 'T' },
+    .{ 0xaa43, 0xaa44, 'T' }, .{ 0xaa4c, 0xaa4d, 'T' }, .{ 0xaa7c, 0xaa7d, 'T' }, .{ 0xaab0, 0xaab1, 'T' }, .{ 0xaab2, 0xaab5, 'T' },
+    .{ 0xaab7, 0xaab9, 'T' }, .{ 0xaabe, 0xaac0, 'T' }, .{ 0xaac1, 0xaac2, 'T' }, .{ 0xaaec, 0xaaee, 'T' }, .{ 0xaaf6, 0xaaf7, 'T' },
+    .{ 0xabe5, 0xabe6, 'T' }, .{ 0xabe8, 0xabe9, 'T' }, .{ 0xabed, 0xabee, 'T' }, .{ 0xfb1e, 0xfb1f, 'T' }, .{ 0xfe00, 0xfe10, 'T' },
+    .{ 0xfe20, 0xfe30, 'T' }, .{ 0xfeff, 0xff00, 'T' }, .{ 0xfff9, 0xfffc, 'T' }, .{ 0x101fd, 0x101fe, 'T' }, .{ 0x102e0, 0x102e1, 'T' },
+    .{ 0x10376, 0x1037b, 'T' }, .{ 0x10a01, 0x10a04, 'T' }, .{ 0x10a05, 0x10a07, 'T' }, .{ 0x10a0c, 0x10a10, 'T' }, .{ 0x10a38, 0x10a3b, 'T' },
+    .{ 0x10a3f, 0x10a40, 'T' }, .{ 0x10ac0, 0x10ac5, 'D' }, .{ 0x10ac5, 0x10ac6, 'R' }, .{ 0x10ac7, 0x10ac8, 'R' }, .{ 0x10ac9, 0x10acb, 'R' },
+    .{ 0x10acd, 0x10ace, 'L' }, .{ 0x10ace, 0x10ad3, 'R' }, .{ 0x10ad3, 0x10ad7, 'D' }, .{ 0x10ad7, 0x10ad8, 'L' }, .{ 0x10ad8, 0x10add, 'D' },
+    .{ 0x10add, 0x10ade, 'R' }, .{ 0x10ade, 0x10ae1, 'D' }, .{ 0x10ae1, 0x10ae2, 'R' }, .{ 0x10ae4, 0x10ae5, 'R' }, .{ 0x10ae5, 0x10ae7, 'T' },
+    .{ 0x10aeb, 0x10aef, 'D' }, .{ 0x10aef, 0x10af0, 'R' }, .{ 0x10b80, 0x10b81, 'D' }, .{ 0x10b81, 0x10b82, 'R' }, .{ 0x10b82, 0x10b83, 'D' },
+    .{ 0x10b83, 0x10b86, 'R' }, .{ 0x10b86, 0x10b89, 'D' }, .{ 0x10b89, 0x10b8a, 'R' }, .{ 0x10b8a, 0x10b8c, 'D' }, .{ 0x10b8c, 0x10b8d, 'R' },
+    .{ 0x10b8d, 0x10b8e, 'D' }, .{ 0x10b8e, 0x10b90, 'R' }, .{ 0x10b90, 0x10b91, 'D' }, .{ 0x10b91, 0x10b92, 'R' }, .{ 0x10ba9, 0x10bad, 'R' },
+    .{ 0x10bad, 0x10baf, 'D' }, .{ 0x10d00, 0x10d01, 'L' }, .{ 0x10d01, 0x10d22, 'D' }, .{ 0x10d22, 0x10d23, 'R' }, .{ 0x10d23, 0x10d24, 'D' },
+    .{ 0x10d24, 0x10d28, 'T' }, .{ 0x10eab, 0x10ead, 'T' }, .{ 0x10efd, 0x10f00, 'T' }, .{ 0x10f30, 0x10f33, 'D' }, .{ 0x10f33, 0x10f34, 'R' },
+    .{ 0x10f34, 0x10f45, 'D' }, .{ 0x10f46, 0x10f51, 'T' }, .{ 0x10f51, 0x10f54, 'D' }, .{ 0x10f54, 0x10f55, 'R' }, .{ 0x10f70, 0x10f74, 'D' },
+    .{ 0x10f74, 0x10f76, 'R' }, .{ 0x10f76, 0x10f82, 'D' }, .{ 0x10f82, 0x10f86, 'T' }, .{ 0x10fb0, 0x10fb1, 'D' }, .{ 0x10fb2, 0x10fb4, 'D' },
+    .{ 0x10fb4, 0x10fb7, 'R' }, .{ 0x10fb8, 0x10fb9, 'D' }, .{ 0x10fb9, 0x10fbb, 'R' }, .{ 0x10fbb, 0x10fbd, 'D' }, .{ 0x10fbd, 0x10fbe, 'R' },
+    .{ 0x10fbe, 0x10fc0, 'D' }, .{ 0x10fc1, 0x10fc2, 'D' }, .{ 0x10fc2, 0x10fc4, 'R' }, .{ 0x10fc4, 0x10fc5, 'D' }, .{ 0x10fc9, 0x10fca, 'R' },
+    .{ 0x10fca, 0x10fcb, 'D' }, .{ 0x10fcb, 0x10fcc, 'L' }, .{ 0x11001, 0x11002, 'T' }, .{ 0x11038, 0x11047, 'T' }, .{ 0x11070, 0x11071, 'T' },
+    .{ 0x11073, 0x11075, 'T' }, .{ 0x1107f, 0x11082, 'T' }, .{ 0x110b3, 0x110b7, 'T' }, .{ 0x110b9, 0x110bb, 'T' }, .{ 0x110c2, 0x110c3, 'T' },
+    .{ 0x11100, 0x11103, 'T' }, .{ 0x11127, 0x1112c, 'T' }, .{ 0x1112d, 0x11135, 'T' }, .{ 0x11173, 0x11174, 'T' }, .{ 0x11180, 0x11182, 'T' },
+    .{ 0x111b6, 0x111bf, 'T' }, .{ 0x111c9, 0x111cd, 'T' }, .{ 0x111cf, 0x111d0, 'T' }, .{ 0x1122f, 0x11232, 'T' }, .{ 0x11234, 0x11235, 'T' },
+    .{ 0x11236, 0x11238, 'T' }, .{ 0x1123e, 0x1123f, 'T' }, .{ 0x11241, 0x11242, 'T' }, .{ 0x112df, 0x112e0, 'T' }, .{ 0x112e3, 0x112eb, 'T' },
+    .{ 0x11300, 0x11302, 'T' }, .{ 0x1133b, 0x1133d, 'T' }, .{ 0x11340, 0x11341, 'T' }, .{ 0x11366, 0x1136d, 'T' }, .{ 0x11370, 0x11375, 'T' },
+    .{ 0x11438, 0x11440, 'T' }, .{ 0x11442, 0x11445, 'T' }, .{ 0x11446, 0x11447, 'T' }, .{ 0x1145e, 0x1145f, 'T' }, .{ 0x114b3, 0x114b9, 'T' },
+    .{ 0x114ba, 0x114bb, 'T' }, .{ 0x114bf, 0x114c1, 'T' }, .{ 0x114c2, 0x114c4, 'T' }, .{ 0x115b2, 0x115b6, 'T' }, .{ 0x115bc, 0x115be, 'T' },
+    .{ 0x115bf, 0x115c1, 'T' }, .{ 0x115dc, 0x115de, 'T' }, .{ 0x11633, 0x1163b, 'T' }, .{ 0x1163d, 0x1163e, 'T' }, .{ 0x1163f, 0x11641, 'T' },
+    .{ 0x116ab, 0x116ac, 'T' }, .{ 0x116ad, 0x116ae, 'T' }, .{ 0x116b0, 0x116b6, 'T' }, .{ 0x116b7, 0x116b8, 'T' }, .{ 0x1171d, 0x11720, 'T' },
+    .{ 0x11722, 0x11726, 'T' }, .{ 0x11727, 0x1172c, 'T' }, .{ 0x1182f, 0x11838, 'T' }, .{ 0x11839, 0x1183b, 'T' }, .{ 0x1193b, 0x1193d, 'T' },
+    .{ 0x1193e, 0x1193f, 'T' }, .{ 0x11943, 0x11944, 'T' }, .{ 0x119d4, 0x119d8, 'T' }, .{ 0x119da, 0x119dc, 'T' }, .{ 0x119e0, 0x119e1, 'T' },
+    .{ 0x11a01, 0x11a0b, 'T' }, .{ 0x11a33, 0x11a39, 'T' }, .{ 0x11a3b, 0x11a3f, 'T' }, .{ 0x11a47, 0x11a48, 'T' }, .{ 0x11a51, 0x11a57, 'T' },
+    .{ 0x11a59, 0x11a5c, 'T' }, .{ 0x11a8a, 0x11a97, 'T' }, .{ 0x11a98, 0x11a9a, 'T' }, .{ 0x11c30, 0x11c37, 'T' }, .{ 0x11c38, 0x11c3e, 'T' },
+    .{ 0x11c3f, 0x11c40, 'T' }, .{ 0x11c92, 0x11ca8, 'T' }, .{ 0x11caa, 0x11cb1, 'T' }, .{ 0x11cb2, 0x11cb4, 'T' }, .{ 0x11cb5, 0x11cb7, 'T' },
+    .{ 0x11d31, 0x11d37, 'T' }, .{ 0x11d3a, 0x11d3b, 'T' }, .{ 0x11d3c, 0x11d3e, 'T' }, .{ 0x11d3f, 0x11d46, 'T' }, .{ 0x11d47, 0x11d48, 'T' },
+    .{ 0x11d90, 0x11d92, 'T' }, .{ 0x11d95, 0x11d96, 'T' }, .{ 0x11d97, 0x11d98, 'T' }, .{ 0x11ef3, 0x11ef5, 'T' }, .{ 0x11f00, 0x11f02, 'T' },
+    .{ 0x11f36, 0x11f3b, 'T' }, .{ 0x11f40, 0x11f41, 'T' }, .{ 0x11f42, 0x11f43, 'T' }, .{ 0x13430, 0x13441, 'T' }, .{ 0x13447, 0x13456, 'T' },
+    .{ 0x16af0, 0x16af5, 'T' }, .{ 0x16b30, 0x16b37, 'T' }, .{ 0x16f4f, 0x16f50, 'T' }, .{ 0x16f8f, 0x16f93, 'T' }, .{ 0x16fe4, 0x16fe5, 'T' },
+    .{ 0x1bc9d, 0x1bc9f, 'T' }, .{ 0x1bca0, 0x1bca4, 'T' }, .{ 0x1cf00, 0x1cf2e, 'T' }, .{ 0x1cf30, 0x1cf47, 'T' }, .{ 0x1d167, 0x1d16a, 'T' },
+    .{ 0x1d173, 0x1d183, 'T' }, .{ 0x1d185, 0x1d18c, 'T' }, .{ 0x1d1aa, 0x1d1ae, 'T' }, .{ 0x1d242, 0x1d245, 'T' }, .{ 0x1da00, 0x1da37, 'T' },
+    .{ 0x1da3b, 0x1da6d, 'T' }, .{ 0x1da75, 0x1da76, 'T' }, .{ 0x1da84, 0x1da85, 'T' }, .{ 0x1da9b, 0x1daa0, 'T' }, .{ 0x1daa1, 0x1dab0, 'T' },
+    .{ 0x1e000, 0x1e007, 'T' }, .{ 0x1e008, 0x1e019, 'T' }, .{ 0x1e01b, 0x1e022, 'T' }, .{ 0x1e023, 0x1e025, 'T' }, .{ 0x1e026, 0x1e02b, 'T' },
+    .{ 0x1e08f, 0x1e090, 'T' }, .{ 0x1e130, 0x1e137, 'T' }, .{ 0x1e2ae, 0x1e2af, 'T' }, .{ 0x1e2ec, 0x1e2f0, 'T' }, .{ 0x1e4ec, 0x1e4f0, 'T' },
+    .{ 0x1e8d0, 0x1e8d7, 'T' }, .{ 0x1e900, 0x1e944, 'D' }, .{ 0x1e944, 0x1e94c, 'T' }, .{ 0xe0001, 0xe0002, 'T' }, .{ 0xe0020, 0xe0080, 'T' },
+    .{ 0xe0100, 0xe01f0, 'T' },
+};
+
+/// Character property bits
+pub const prop_assigned: u8 = 1 << 0;
+/// General category M*
+pub const prop_mark: u8 = 1 << 1;
+/// Canonical combining class 9 (virama)
+pub const prop_virama: u8 = 1 << 2;
+/// Canonical combining class other than 0
+pub const prop_combining: u8 = 1 << 3;
+/// NFC_Quick_Check No or Maybe
+pub const prop_nfc_unstable: u8 = 1 << 4;
+/// Bidi class R, AL or AN
+pub const prop_rtl: u8 = 1 << 5;
+
+/// Property bits packed as start << 8 | props, covering code points up to
+/// the next entry's start
+pub const properties = [_]u32{
+    0x1, 0x3001b, 0x3050b, 0x3061b, 0x30d0b, 0x30f1b, 0x3100b, 0x3111b, 0x3120b, 0x3131b,
+    0x3150b, 0x31b1b, 0x31c0b, 0x3231b, 0x3290b, 0x32d1b, 0x32f0b, 0x3301b, 0x3320b, 0x3381b,
+    0x3390b, 0x3401b, 0x3460b, 0x34f03, 0x3500b, 0x37001, 0x37411, 0x37501, 0x37800, 0x37a01,
+    0x37e11, 0x37f01, 0x38000, 0x38401, 0x38711, 0x38801, 0x38b00, 0x38c01, 0x38d00, 0x38e01,
+    0x3a200, 0x3a301, 0x4830b, 0x48803, 0x48a01, 0x53000, 0x53101, 0x55700, 0x55901, 0x58b00,
+    0x58d01, 0x59000, 0x5910b, 0x5b41b, 0x5b50b, 0x5b71b, 0x5ba0b, 0x5bc1b, 0x5bd0b, 0x5be21,
+    0x5bf1b, 0x5c021, 0x5c11b, 0x5c321, 0x5c40b, 0x5c621, 0x5c70b, 0x5c800, 0x5d021, 0x5eb00,
+    0x5ef21, 0x5f500, 0x60021, 0x60601, 0x60821, 0x60901, 0x60b21, 0x60c01, 0x60d21, 0x60e01,
+    0x6100b, 0x61b21, 0x64b0b, 0x6531b, 0x6560b, 0x66021, 0x66a01, 0x66b21, 0x6700b, 0x67121,
+    0x6d60b, 0x6dd21, 0x6de01, 0x6df0b, 0x6e521, 0x6e70b, 0x6e901, 0x6ea0b, 0x6ee21, 0x6f001,
+    0x6fa21, 0x70e00, 0x70f21, 0x7110b, 0x71221, 0x7300b, 0x74b00, 0x74d21, 0x7a603, 0x7b121,
+    0x7b200, 0x7c021, 0x7eb0b, 0x7f421, 0x7f601, 0x7fa21, 0x7fb00, 0x7fd0b, 0x7fe21, 0x8160b,
+    0x81a21, 0x81b0b, 0x82421, 0x8250b, 0x82821, 0x8290b, 0x82e00, 0x83021, 0x83f00, 0x84021,
+    0x8590b, 0x85c00, 0x85e21, 0x85f00, 0x86021, 0x86b00, 0x87021, 0x88f00, 0x89021, 0x89200,
+    0x8980b, 0x8a021, 0x8ca0b, 0x8e221, 0x8e30b, 0x90003, 0x90401, 0x93a03, 0x93c1b, 0x93d01,
+    0x93e03, 0x94d0f, 0x94e03, 0x95001, 0x9510b, 0x95503, 0x95811, 0x96001, 0x96203, 0x96401,
+    0x98103, 0x98400, 0x98501, 0x98d00, 0x98f01, 0x99100, 0x99301, 0x9a900, 0x9aa01, 0x9b100,
+    0x9b201, 0x9b300, 0x9b601, 0x9ba00, 0x9bc1b, 0x9bd01, 0x9be13, 0x9bf03, 0x9c500, 0x9c703,
+    0x9c900, 0x9cb03, 0x9cd0f, 0x9ce01, 0x9cf00, 0x9d713, 0x9d800, 0x9dc11, 0x9de00, 0x9df11,
+    0x9e001, 0x9e203, 0x9e400, 0x9e601, 0x9fe0b, 0x9ff00, 0xa0103, 0xa0400, 0xa0501, 0xa0b00,
+    0xa0f01, 0xa1100, 0xa1301, 0xa2900, 0xa2a01, 0xa3100, 0xa3201, 0xa3311, 0xa3400, 0xa3501,
+    0xa3611, 0xa3700, 0xa3801, 0xa3a00, 0xa3c1b, 0xa3d00, 0xa3e03, 0xa4300, 0xa4703, 0xa4900,
+    0xa4b03, 0xa4d0f, 0xa4e00, 0xa5103, 0xa5200, 0xa5911, 0xa5c01, 0xa5d00, 0xa5e11, 0xa5f00,
+    0xa6601, 0xa7003, 0xa7201, 0xa7503, 0xa7601, 0xa7700, 0xa8103, 0xa8400, 0xa8501, 0xa8e00,
+    0xa8f01, 0xa9200, 0xa9301, 0xaa900, 0xaaa01, 0xab100, 0xab201, 0xab400, 0xab501, 0xaba00,
+    0xabc0b, 0xabd01, 0xabe03, 0xac600, 0xac703, 0xaca00, 0xacb03, 0xacd0f, 0xace00, 0xad001,
+    0xad100, 0xae001, 0xae203, 0xae400, 0xae601, 0xaf200, 0xaf901, 0xafa03, 0xb0000, 0xb0103,
+    0xb0400, 0xb0501, 0xb0d00, 0xb0f01, 0xb1100, 0xb1301, 0xb2900, 0xb2a01, 0xb3100, 0xb3201,
+    0xb3400, 0xb3501, 0xb3a00, 0xb3c1b, 0xb3d01, 0xb3e13, 0xb3f03, 0xb4500, 0xb4703, 0xb4900,
+    0xb4b03, 0xb4d0f, 0xb4e00, 0xb5503, 0xb5613, 0xb5800, 0xb5c11, 0xb5e00, 0xb5f01, 0xb6203,
+    0xb6400, 0xb6601, 0xb7800, 0xb8203, 0xb8301, 0xb8400, 0xb8501, 0xb8b00, 0xb8e01, 0xb9100,
+    0xb9201, 0xb9600, 0xb9901, 0xb9b00, 0xb9c01, 0xb9d00, 0xb9e01, 0xba000, 0xba301, 0xba500,
+    0xba801, 0xbab00, 0xbae01, 0xbba00, 0xbbe13, 0xbbf03, 0xbc300, 0xbc603, 0xbc900, 0xbca03,
+    0xbcd0f, 0xbce00, 0xbd001, 0xbd100, 0xbd713, 0xbd800, 0xbe601, 0xbfb00, 0xc0003, 0xc0501,
+    0xc0d00, 0xc0e01, 0xc1100, 0xc1201, 0xc2900, 0xc2a01, 0xc3a00, 0xc3c0b, 0xc3d01, 0xc3e03,
+    0xc4500, 0xc4603, 0xc4900, 0xc4a03, 0xc4d0f, 0xc4e00, 0xc550b, 0xc561b, 0xc5700, 0xc5801,
+    0xc5b00, 0xc5d01, 0xc5e00, 0xc6001, 0xc6203, 0xc6400, 0xc6601, 0xc7000, 0xc7701, 0xc8103,
+    0xc8401, 0xc8d00, 0xc8e01, 0xc9100, 0xc9201, 0xca900, 0xcaa01, 0xcb400, 0xcb501, 0xcba00,
+    0xcbc0b, 0xcbd01, 0xcbe03, 0xcc213, 0xcc303, 0xcc500, 0xcc603, 0xcc900, 0xcca03, 0xccd0f,
+    0xcce00, 0xcd513, 0xcd700, 0xcdd01, 0xcdf00, 0xce001, 0xce203, 0xce400, 0xce601, 0xcf000,
+    0xcf101, 0xcf300, 0xd0003, 0xd0401, 0xd0d00, 0xd0e01, 0xd1100, 0xd1201, 0xd3b0f, 0xd3d01,
+    0xd3e13, 0xd3f03, 0xd4500, 0xd4603, 0xd4900, 0xd4a03, 0xd4d0f, 0xd4e01, 0xd5000, 0xd5401,
+    0xd5713, 0xd5801, 0xd6203, 0xd6400, 0xd6601, 0xd8000, 0xd8103, 0xd8400, 0xd8501, 0xd9700,
+    0xd9a01, 0xdb200, 0xdb301, 0xdbc00, 0xdbd01, 0xdbe00, 0xdc001, 0xdc700, 0xdca1f, 0xdcb00,
+    0xdcf13, 0xdd003, 0xdd500, 0xdd603, 0xdd700, 0xdd803, 0xddf13, 0xde000, 0xde601, 0xdf000,
+    0xdf203, 0xdf401, 0xdf500, 0xe0101, 0xe3103, 0xe3201, 0xe3403, 0xe380b, 0xe3a0f, 0xe3b00,
+    0xe3f01, 0xe4703, 0xe480b, 0xe4c03, 0xe4f01, 0xe5c00, 0xe8101, 0xe8300, 0xe8401, 0xe8500,
+    0xe8601, 0xe8b00, 0xe8c01, 0xea400, 0xea501, 0xea600, 0xea701, 0xeb103, 0xeb201, 0xeb403,
+    0xeb80b, 0xeba0f, 0xebb03, 0xebd01, 0xebe00, 0xec001, 0xec500, 0xec601, 0xec700, 0xec80b,
+    0xecc03, 0xece00, 0xed001, 0xeda00, 0xedc01, 0xee000, 0xf0001, 0xf180b, 0xf1a01, 0xf350b,
+    0xf3601, 0xf370b, 0xf3801, 0xf390b, 0xf3a01, 0xf3e03, 0xf4001, 0xf4311, 0xf4401, 0xf4800,
+    0xf4901, 0xf4d11, 0xf4e01, 0xf5211, 0xf5301, 0xf5711, 0xf5801, 0xf5c11, 0xf5d01, 0xf6911,
+    0xf6a01, 0xf6d00, 0xf710b, 0xf721b, 0xf7313, 0xf741b, 0xf7513, 0xf7703, 0xf7813, 0xf7903,
+    0xf7a0b, 0xf7e03, 0xf801b, 0xf8113, 0xf820b, 0xf840f, 0xf8501, 0xf860b, 0xf8801, 0xf8d03,
+    0xf9313, 0xf9403, 0xf9800, 0xf9903, 0xf9d13, 0xf9e03, 0xfa213, 0xfa303, 0xfa713, 0xfa803,
+    0xfac13, 0xfad03, 0xfb513, 0xfb603, 0xfb713, 0xfb803, 0xfb913, 0xfba03, 0xfbd00, 0xfbe01,
+    0xfc60b, 0xfc701, 0xfcd00, 0xfce01, 0xfdb00, 0x100001, 0x102b03, 0x102e13, 0x102f03, 0x10370b,
+    0x103803, 0x10390f, 0x103b03, 0x103f01, 0x105603, 0x105a01, 0x105e03, 0x106101, 0x106203, 0x106501,
+    0x106703, 0x106e01, 0x107103, 0x107501, 0x108203, 0x108d0b, 0x108e01, 0x108f03, 0x109001, 0x109a03,
+    0x109e01, 0x10c600, 0x10c701, 0x10c800, 0x10cd01, 0x10ce00, 0x10d001, 0x116111, 0x117601, 0x11a811,
+    0x11c301, 0x124900, 0x124a01, 0x124e00, 0x125001, 0x125700, 0x125801, 0x125900, 0x125a01, 0x125e00,
+    0x126001, 0x128900, 0x128a01, 0x128e00, 0x129001, 0x12b100, 0x12b201, 0x12b600, 0x12b801, 0x12bf00,
+    0x12c001, 0x12c100, 0x12c201, 0x12c600, 0x12c801, 0x12d700, 0x12d801, 0x131100, 0x131201, 0x131600,
+    0x131801, 0x135b00, 0x135d0b, 0x136001, 0x137d00, 0x138001, 0x139a00, 0x13a001, 0x13f600, 0x13f801,
+    0x13fe00, 0x140001, 0x169d00, 0x16a001, 0x16f900, 0x170001, 0x171203, 0x17140f, 0x171600, 0x171f01,
+    0x173203, 0x17340f, 0x173501, 0x173700, 0x174001, 0x175203, 0x175400, 0x176001, 0x176d00, 0x176e01,
+    0x177100, 0x177203, 0x177400, 0x178001, 0x17b403, 0x17d20f, 0x17d303, 0x17d401, 0x17dd0b, 0x17de00,
+    0x17e001, 0x17ea00, 0x17f001, 0x17fa00, 0x180001, 0x180b03, 0x180e01, 0x180f03, 0x181001, 0x181a00,
+    0x182001, 0x187900, 0x188001, 0x188503, 0x188701, 0x18a90b, 0x18aa01, 0x18ab00, 0x18b001, 0x18f600,
+    0x190001, 0x191f00, 0x192003, 0x192c00, 0x193003, 0x19390b, 0x193c00, 0x194001, 0x194100, 0x194401,
+    0x196e00, 0x197001, 0x197500, 0x198001, 0x19ac00, 0x19b001, 0x19ca00, 0x19d001, 0x19db00, 0x19de01,
+    0x1a170b, 0x1a1903, 0x1a1c00, 0x1a1e01, 0x1a5503, 0x1a5f00, 0x1a600f, 0x1a6103, 0x1a750b, 0x1a7d00,
+    0x1a7f0b, 0x1a8001, 0x1a8a00, 0x1a9001, 0x1a9a00, 0x1aa001, 0x1aae00, 0x1ab00b, 0x1abe03, 0x1abf0b,
+    0x1acf00, 0x1b0003, 0x1b0501, 0x1b340b, 0x1b3513, 0x1b3603, 0x1b440f, 0x1b4501, 0x1b4d00, 0x1b5001,
+    0x1b6b0b, 0x1b7401, 0x1b7f00, 0x1b8003, 0x1b8301, 0x1ba103, 0x1baa0f, 0x1bac03, 0x1bae01, 0x1be60b,
+    0x1be703, 0x1bf20f, 0x1bf400, 0x1bfc01, 0x1c2403, 0x1c370b, 0x1c3800, 0x1c3b01, 0x1c4a00, 0x1c4d01,
+    0x1c8900, 0x1c9001, 0x1cbb00, 0x1cbd01, 0x1cc800, 0x1cd00b, 0x1cd301, 0x1cd40b, 0x1ce103, 0x1ce20b,
+    0x1ce901, 0x1ced0b, 0x1cee01, 0x1cf40b, 0x1cf501, 0x1cf703, 0x1cf80b, 0x1cfa01, 0x1cfb00, 0x1d0001,
+    0x1dc00b, 0x1e0001, 0x1f1600, 0x1f1801, 0x1f1e00, 0x1f2001, 0x1f4600, 0x1f4801, 0x1f4e00, 0x1f5001,
+    0x1f5800, 0x1f5901, 0x1f5a00, 0x1f5b01, 0x1f5c00, 0x1f5d01, 0x1f5e00, 0x1f5f01, 0x1f7111, 0x1f7201,
+    0x1f7311, 0x1f7401, 0x1f7511, 0x1f7601, 0x1f7711, 0x1f7801, 0x1f7911, 0x1f7a01, 0x1f7b11, 0x1f7c01,
+    0x1f7d11, 0x1f7e00, 0x1f8001, 0x1fb500, 0x1fb601, 0x1fbb11, 0x1fbc01, 0x1fbe11, 0x1fbf01, 0x1fc500,
+    0x1fc601, 0x1fc911, 0x1fca01, 0x1fcb11, 0x1fcc01, 0x1fd311, 0x1fd400, 0x1fd601, 0x1fdb11, 0x1fdc00,
+    0x1fdd01, 0x1fe311, 0x1fe401, 0x1feb11, 0x1fec01, 0x1fee11, 0x1ff000, 0x1ff201, 0x1ff500, 0x1ff601,
+    0x1ff911, 0x1ffa01, 0x1ffb11, 0x1ffc01, 0x1ffd11, 0x1ffe01, 0x1fff00, 0x200011, 0x200201, 0x200f21,
+    0x201001, 0x206500, 0x206601, 0x207200, 0x207401, 0x208f00, 0x209001, 0x209d00, 0x20a001, 0x20c100,
+    0x20d00b, 0x20dd03, 0x20e10b, 0x20e203, 0x20e50b, 0x20f100, 0x210001, 0x212611, 0x212701, 0x212a11,
+    0x212c01, 0x218c00, 0x219001, 0x232911, 0x232b01, 0x242700, 0x244001, 0x244b00, 0x246001, 0x2adc11,
+    0x2add01, 0x2b7400, 0x2b7601, 0x2b9600, 0x2b9701, 0x2cef0b, 0x2cf201, 0x2cf400, 0x2cf901, 0x2d2600,
+    0x2d2701, 0x2d2800, 0x2d2d01, 0x2d2e00, 0x2d3001, 0x2d6800, 0x2d6f01, 0x2d7100, 0x2d7f0f, 0x2d8001,
+    0x2d9700, 0x2da001, 0x2da700, 0x2da801, 0x2daf00, 0x2db001, 0x2db700, 0x2db801, 0x2dbf00, 0x2dc001,
+    0x2dc700, 0x2dc801, 0x2dcf00, 0x2dd001, 0x2dd700, 0x2dd801, 0x2ddf00, 0x2de00b, 0x2e0001, 0x2e5e00,
+    0x2e8001, 0x2e9a00, 0x2e9b01, 0x2ef400, 0x2f0001, 0x2fd600, 0x2ff001, 0x2ffc00, 0x300001, 0x302a0b,
+    0x303001, 0x304000, 0x304101, 0x309700, 0x30991b, 0x309b01, 0x310000, 0x310501, 0x313000, 0x313101,
+    0x318f00, 0x319001, 0x31e400, 0x31f001, 0x321f00, 0x322001, 0xa48d00, 0xa49001, 0xa4c700, 0xa4d001,
+    0xa62c00, 0xa64001, 0xa66f0b, 0xa67003, 0xa67301, 0xa6740b, 0xa67e01, 0xa69e0b, 0xa6a001, 0xa6f00b,
+    0xa6f201, 0xa6f800, 0xa70001, 0xa7cb00, 0xa7d001, 0xa7d200, 0xa7d301, 0xa7d400, 0xa7d501, 0xa7da00,
+    0xa7f201, 0xa80203, 0xa80301, 0xa8060f, 0xa80701, 0xa80b03, 0xa80c01, 0xa82303, 0xa82801, 0xa82c0f,
+    0xa82d00, 0xa83001, 0xa83a00, 0xa84001, 0xa87800, 0xa88003, 0xa88201, 0xa8b403, 0xa8c40f, 0xa8c503,
+    0xa8c600, 0xa8ce01, 0xa8da00, 0xa8e00b, 0xa8f201, 0xa8ff03, 0xa90001, 0xa92603, 0xa92b0b, 0xa92e01,
+    0xa94703, 0xa9530f, 0xa95400, 0xa95f01, 0xa97d00, 0xa98003, 0xa98401, 0xa9b30b, 0xa9b403, 0xa9c00f,
+    0xa9c101, 0xa9ce00, 0xa9cf01, 0xa9da00, 0xa9de01, 0xa9e503, 0xa9e601, 0xa9ff00, 0xaa0001, 0xaa2903,
+    0xaa3700, 0xaa4001, 0xaa4303, 0xaa4401, 0xaa4c03, 0xaa4e00, 0xaa5001, 0xaa5a00, 0xaa5c01, 0xaa7b03,
+    0xaa7e01, 0xaab00b, 0xaab101, 0xaab20b, 0xaab501, 0xaab70b, 0xaab901, 0xaabe0b, 0xaac001, 0xaac10b,
+    0xaac201, 0xaac300, 0xaadb01, 0xaaeb03, 0xaaf001, 0xaaf503, 0xaaf60f, 0xaaf700, 0xab0101, 0xab0700,
+    0xab0901, 0xab0f00, 0xab1101, 0xab1700, 0xab2001, 0xab2700, 0xab2801, 0xab2f00, 0xab3001, 0xab6c00,
+    0xab7001, 0xabe303, 0xabeb01, 0xabec03, 0xabed0f, 0xabee00, 0xabf001, 0xabfa00, 0xac0001, 0xd7a400,
+    0xd7b001, 0xd7c700, 0xd7cb01, 0xd7fc00, 0xd80001, 0xf90011, 0xfa0e01, 0xfa1011, 0xfa1101, 0xfa1211,
+    0xfa1301, 0xfa1511, 0xfa1f01, 0xfa2011, 0xfa2101, 0xfa2211, 0xfa2301, 0xfa2511, 0xfa2701, 0xfa2a11,
+    0xfa6e00, 0xfa7011, 0xfada00, 0xfb0001, 0xfb0700, 0xfb1301, 0xfb1800, 0xfb1d31, 0xfb1e0b, 0xfb1f31,
+    0xfb2021, 0xfb2901, 0xfb2a31, 0xfb3700, 0xfb3831, 0xfb3d00, 0xfb3e31, 0xfb3f00, 0xfb4031, 0xfb4200,
+    0xfb4331, 0xfb4500, 0xfb4631, 0xfb4f21, 0xfbc300, 0xfbd321, 0xfd3e01, 0xfd5021, 0xfd9000, 0xfd9221,
+    0xfdc800, 0xfdcf01, 0xfdd000, 0xfdf021, 0xfdfd01, 0xfe0003, 0xfe1001, 0xfe1a00, 0xfe200b, 0xfe3001,
+    0xfe5300, 0xfe5401, 0xfe6700, 0xfe6801, 0xfe6c00, 0xfe7021, 0xfe7500, 0xfe7621, 0xfefd00, 0xfeff01,
+    0xff0000, 0xff0101, 0xffbf00, 0xffc201, 0xffc800, 0xffca01, 0xffd000, 0xffd201, 0xffd800, 0xffda01,
+    0xffdd00, 0xffe001, 0xffe700, 0xffe801, 0xffef00, 0xfff901, 0xfffe00, 0x1000001, 0x1000c00, 0x1000d01,
+    0x1002700, 0x1002801, 0x1003b00, 0x1003c01, 0x1003e00, 0x1003f01, 0x1004e00, 0x1005001, 0x1005e00, 0x1008001,
+    0x100fb00, 0x1010001, 0x1010300, 0x1010701, 0x1013400, 0x1013701, 0x1018f00, 0x1019001, 0x1019d00, 0x101a001,
+    0x101a100, 0x101d001, 0x101fd0b, 0x101fe00, 0x1028001, 0x1029d00, 0x102a001, 0x102d100, 0x102e00b, 0x102e101,
+    0x102fc00, 0x1030001, 0x1032400, 0x1032d01, 0x1034b00, 0x1035001, 0x103760b, 0x1037b00, 0x1038001, 0x1039e00,
+    0x1039f01, 0x103c400, 0x103c801, 0x103d600, 0x1040001, 0x1049e00, 0x104a001, 0x104aa00, 0x104b001, 0x104d400,
+    0x104d801, 0x104fc00, 0x1050001, 0x1052800, 0x1053001, 0x1056400, 0x1056f01, 0x1057b00, 0x1057c01, 0x1058b00,
+    0x1058c01, 0x1059300, 0x1059401, 0x1059600, 0x1059701, 0x105a200, 0x105a301, 0x105b200, 0x105b301, 0x105ba00,
+    0x105bb01, 0x105bd00, 0x1060001, 0x1073700, 0x1074001, 0x1075600, 0x1076001, 0x1076800, 0x1078001, 0x1078600,
+    0x1078701, 0x107b100, 0x107b201, 0x107bb00, 0x1080021, 0x1080600, 0x1080821, 0x1080900, 0x1080a21, 0x1083600,
+    0x1083721, 0x1083900, 0x1083c21, 0x1083d00, 0x1083f21, 0x1085600, 0x1085721, 0x1089f00, 0x108a721, 0x108b000,
+    0x108e021, 0x108f300, 0x108f421, 0x108f600, 0x108fb21, 0x1091c00, 0x1091f01, 0x1092021, 0x1093a00, 0x1093f21,
+    0x1094000, 0x1098021, 0x109b800, 0x109bc21, 0x109d000, 0x109d221, 0x10a0103, 0x10a0400, 0x10a0503, 0x10a0700,
+    0x10a0c03, 0x10a0d0b, 0x10a0e03, 0x10a0f0b, 0x10a1021, 0x10a1400, 0x10a1521, 0x10a1800, 0x10a1921, 0x10a3600,
+    0x10a380b, 0x10a3b00, 0x10a3f0f, 0x10a4021, 0x10a4900, 0x10a5021, 0x10a5900, 0x10a6021, 0x10aa000, 0x10ac021,
+    0x10ae50b, 0x10ae700, 0x10aeb21, 0x10af700, 0x10b0021, 0x10b3600, 0x10b3901, 0x10b4021, 0x10b5600, 0x10b5821,
+    0x10b7300, 0x10b7821, 0x10b9200, 0x10b9921, 0x10b9d00, 0x10ba921, 0x10bb000, 0x10c0021, 0x10c4900, 0x10c8021,
+    0x10cb300, 0x10cc021, 0x10cf300, 0x10cfa21, 0x10d240b, 0x10d2800, 0x10d3021, 0x10d3a00, 0x10e6021, 0x10e7f00,
+    0x10e8021, 0x10eaa00, 0x10eab0b, 0x10ead21, 0x10eae00, 0x10eb021, 0x10eb200, 0x10f0021, 0x10f2800, 0x10f3021,
+    0x10f460b, 0x10f5121, 0x10f5a00, 0x10f7021, 0x10f820b, 0x10f8621, 0x10f8a00, 0x10fb021, 0x10fcc00, 0x10fe021,
+    0x10ff700, 0x1100003, 0x1100301, 0x1103803, 0x110460f, 0x1104701, 0x1104e00, 0x1105201, 0x110700f, 0x1107101,
+    0x1107303, 0x1107501, 0x1107600, 0x1107f0f, 0x1108003, 0x1108301, 0x110b003, 0x110b90f, 0x110ba1b, 0x110bb01,
+    0x110c203, 0x110c300, 0x110cd01, 0x110ce00, 0x110d001, 0x110e900, 0x110f001, 0x110fa00, 0x111000b, 0x1110301,
+    0x1112713, 0x1112803, 0x111330f, 0x1113500, 0x1113601, 0x1114503, 0x1114701, 0x1114800, 0x1115001, 0x111730b,
+    0x1117401, 0x1117700, 0x1118003, 0x1118301, 0x111b303, 0x111c00f, 0x111c101, 0x111c903, 0x111ca0b, 0x111cb03,
+    0x111cd01, 0x111ce03, 0x111d001, 0x111e000, 0x111e101, 0x111f500, 0x1120001, 0x1121200, 0x1121301, 0x1122c03,
+    0x112350f, 0x112360b, 0x1123703, 0x1123801, 0x1123e03, 0x1123f00, 0x1128001, 0x1128700, 0x1128801, 0x1128900,
+    0x1128a01, 0x1128e00, 0x1128f01, 0x1129e00, 0x1129f01, 0x112aa00, 0x112b001, 0x112df03, 0x112e90b, 0x112ea0f,
+    0x112eb00, 0x112f001, 0x112fa00, 0x1130003, 0x1130400, 0x1130501, 0x1130d00, 0x1130f01, 0x1131100, 0x1131301,
+    0x1132900, 0x1132a01, 0x1133100, 0x1133201, 0x1133400, 0x1133501, 0x1133a00, 0x1133b0b, 0x1133d01, 0x1133e13,
+    0x1133f03, 0x1134500, 0x1134703, 0x1134900, 0x1134b03, 0x1134d0f, 0x1134e00, 0x1135001, 0x1135100, 0x1135713,
+    0x1135800, 0x1135d01, 0x1136203, 0x1136400, 0x113660b, 0x1136d00, 0x113700b, 0x1137500, 0x1140001, 0x1143503,
+    0x114420f, 0x1144303, 0x114460b, 0x1144701, 0x1145c00, 0x1145d01, 0x1145e0b, 0x1145f01, 0x1146200, 0x1148001,
+    0x114b013, 0x114b103, 0x114ba13, 0x114bb03, 0x114bd13, 0x114be03, 0x114c20f, 0x114c30b, 0x114c401, 0x114c800,
+    0x114d001, 0x114da00, 0x1158001, 0x115af13, 0x115b003, 0x115b600, 0x115b803, 0x115bf0f, 0x115c00b, 0x115c101,
+    0x115dc03, 0x115de00, 0x1160001, 0x1163003, 0x1163f0f, 0x1164003, 0x1164101, 0x1164500, 0x1165001, 0x1165a00,
+    0x1166001, 0x1166d00, 0x1168001, 0x116ab03, 0x116b60f, 0x116b70b, 0x116b801, 0x116ba00, 0x116c001, 0x116ca00,
+    0x1170001, 0x1171b00, 0x1171d03, 0x1172b0f, 0x1172c00, 0x1173001, 0x1174700, 0x1180001, 0x1182c03, 0x118390f,
+    0x1183a0b, 0x1183b01, 0x1183c00, 0x118a001, 0x118f300, 0x118ff01, 0x1190700, 0x1190901, 0x1190a00, 0x1190c01,
+    0x1191400, 0x1191501, 0x1191700, 0x1191801, 0x1193013, 0x1193103, 0x1193600, 0x1193703, 0x1193900, 0x1193b03,
+    0x1193d0f, 0x1193f01, 0x1194003, 0x1194101, 0x1194203, 0x119430b, 0x1194401, 0x1194700, 0x1195001, 0x1195a00,
+    0x119a001, 0x119a800, 0x119aa01, 0x119d103, 0x119d800, 0x119da03, 0x119e00f, 0x119e101, 0x119e403, 0x119e500,
+    0x11a0001, 0x11a0103, 0x11a0b01, 0x11a3303, 0x11a340f, 0x11a3503, 0x11a3a01, 0x11a3b03, 0x11a3f01, 0x11a470f,
+    0x11a4800, 0x11a5001, 0x11a5103, 0x11a5c01, 0x11a8a03, 0x11a990f, 0x11a9a01, 0x11aa300, 0x11ab001, 0x11af900,
+    0x11c0001, 0x11c0900, 0x11c0a01, 0x11c2f03, 0x11c3700, 0x11c3803, 0x11c3f0f, 0x11c4001, 0x11c4600, 0x11c5001,
+    0x11c6d00, 0x11c7001, 0x11c9000, 0x11c9203, 0x11ca800, 0x11ca903, 0x11cb700, 0x11d0001, 0x11d0700, 0x11d0801,
+    0x11d0a00, 0x11d0b01, 0x11d3103, 0x11d3700, 0x11d3a03, 0x11d3b00, 0x11d3c03, 0x11d3e00, 0x11d3f03, 0x11d420b,
+    0x11d4303, 0x11d440f, 0x11d4601, 0x11d4703, 0x11d4800, 0x11d5001, 0x11d5a00, 0x11d6001, 0x11d6600, 0x11d6701,
+    0x11d6900, 0x11d6a01, 0x11d8a03, 0x11d8f00, 0x11d9003, 0x11d9200, 0x11d9303, 0x11d970f, 0x11d9801, 0x11d9900,
+    0x11da001, 0x11daa00, 0x11ee001, 0x11ef303, 0x11ef701, 0x11ef900, 0x11fb001, 0x11fb100, 0x11fc001, 0x11ff200,
+    0x11fff01, 0x1239a00, 0x1240001, 0x1246f00, 0x1247001, 0x1247500, 0x1248001, 0x1254400, 0x12f9001, 0x12ff300,
+    0x1300001, 0x1342f00, 0x1343001, 0x1343900, 0x1440001, 0x1464700, 0x1680001, 0x16a3900, 0x16a4001, 0x16a5f00,
+    0x16a6001, 0x16a6a00, 0x16a6e01, 0x16abf00, 0x16ac001, 0x16aca00, 0x16ad001, 0x16aee00, 0x16af00b, 0x16af501,
+    0x16af600, 0x16b0001, 0x16b300b, 0x16b3701, 0x16b4600, 0x16b5001, 0x16b5a00, 0x16b5b01, 0x16b6200, 0x16b6301,
+    0x16b7800, 0x16b7d01, 0x16b9000, 0x16e4001, 0x16e9b00, 0x16f0001, 0x16f4b00, 0x16f4f03, 0x16f5001, 0x16f5103,
+    0x16f8800, 0x16f8f03, 0x16f9301, 0x16fa000, 0x16fe001, 0x16fe403, 0x16fe500, 0x16ff00b, 0x16ff200, 0x1700001,
+    0x187f800, 0x1880001, 0x18cd600, 0x18d0001, 0x18d0900, 0x1aff001, 0x1aff400, 0x1aff501, 0x1affc00, 0x1affd01,
+    0x1afff00, 0x1b00001, 0x1b12300, 0x1b15001, 0x1b15300, 0x1b16401, 0x1b16800, 0x1b17001, 0x1b2fc00, 0x1bc0001,
+    0x1bc6b00, 0x1bc7001, 0x1bc7d00, 0x1bc8001, 0x1bc8900, 0x1bc9001, 0x1bc9a00, 0x1bc9c01, 0x1bc9d03, 0x1bc9e0b,
+    0x1bc9f01, 0x1bca400, 0x1cf0003, 0x1cf2e00, 0x1cf3003, 0x1cf4700, 0x1cf5001, 0x1cfc400, 0x1d00001, 0x1d0f600,
+    0x1d10001, 0x1d12700, 0x1d12901, 0x1d15e11, 0x1d1651b, 0x1d1660b, 0x1d16a01, 0x1d16d0b, 0x1d16e1b, 0x1d17301,
+    0x1d17b0b, 0x1d18301, 0x1d1850b, 0x1d18c01, 0x1d1aa0b, 0x1d1ae01, 0x1d1bb11, 0x1d1c101, 0x1d1eb00, 0x1d20001,
+    0x1d2420b, 0x1d24501, 0x1d24600, 0x1d2e001, 0x1d2f400, 0x1d30001, 0x1d35700, 0x1d36001, 0x1d37900, 0x1d40001,
+    0x1d45500, 0x1d45601, 0x1d49d00, 0x1d49e01, 0x1d4a000, 0x1d4a201, 0x1d4a300, 0x1d4a501, 0x1d4a700, 0x1d4a901,
+    0x1d4ad00, 0x1d4ae01, 0x1d4ba00, 0x1d4bb01, 0x1d4bc00, 0x1d4bd01, 0x1d4c400, 0x1d4c501, 0x1d50600, 0x1d50701,
+    0x1d50b00, 0x1d50d01, 0x1d51500, 0x1d51601, 0x1d51d00, 0x1d51e01, 0x1d53a00, 0x1d53b01, 0x1d53f00, 0x1d54001,
+    0x1d54500, 0x1d54601, 0x1d54700, 0x1d54a01, 0x1d55100, 0x1d55201, 0x1d6a600, 0x1d6a801, 0x1d7cc00, 0x1d7ce01,
+    0x1da0003, 0x1da3701, 0x1da3b03, 0x1da6d01, 0x1da7503, 0x1da7601, 0x1da8403, 0x1da8501, 0x1da8c00, 0x1da9b03,
+    0x1daa000, 0x1daa103, 0x1dab000, 0x1df0001, 0x1df1f00, 0x1e0000b, 0x1e00700, 0x1e0080b, 0x1e01900, 0x1e01b0b,
+    0x1e02200, 0x1e0230b, 0x1e02500, 0x1e0260b, 0x1e02b00, 0x1e10001, 0x1e12d00, 0x1e1300b, 0x1e13701, 0x1e13e00,
+    0x1e14001, 0x1e14a00, 0x1e14e01, 0x1e15000, 0x1e29001, 0x1e2ae0b, 0x1e2af00, 0x1e2c001, 0x1e2ec0b, 0x1e2f001,
+    0x1e2fa00, 0x1e2ff01, 0x1e30000, 0x1e7e001, 0x1e7e700, 0x1e7e801, 0x1e7ec00, 0x1e7ed01, 0x1e7ef00, 0x1e7f001,
+    0x1e7ff00, 0x1e80021, 0x1e8c500, 0x1e8c721, 0x1e8d00b, 0x1e8d700, 0x1e90021, 0x1e9440b, 0x1e94b21, 0x1e94c00,
+    0x1e95021, 0x1e95a00, 0x1e95e21, 0x1e96000, 0x1ec7121, 0x1ecb500, 0x1ed0121, 0x1ed3e00, 0x1ee0021, 0x1ee0400,
+    0x1ee0521, 0x1ee2000, 0x1ee2121, 0x1ee2300, 0x1ee2421, 0x1ee2500, 0x1ee2721, 0x1ee2800, 0x1ee2921, 0x1ee3300,
+    0x1ee3421, 0x1ee3800, 0x1ee3921, 0x1ee3a00, 0x1ee3b21, 0x1ee3c00, 0x1ee4221, 0x1ee4300, 0x1ee4721, 0x1ee4800,
+    0x1ee4921, 0x1ee4a00, 0x1ee4b21, 0x1ee4c00, 0x1ee4d21, 0x1ee5000, 0x1ee5121, 0x1ee5300, 0x1ee5421, 0x1ee5500,
+    0x1ee5721, 0x1ee5800, 0x1ee5921, 0x1ee5a00, 0x1ee5b21, 0x1ee5c00, 0x1ee5d21, 0x1ee5e00, 0x1ee5f21, 0x1ee6000,
+    0x1ee6121, 0x1ee6300, 0x1ee6421, 0x1ee6500, 0x1ee6721, 0x1ee6b00, 0x1ee6c21, 0x1ee7300, 0x1ee7421, 0x1ee7800,
+    0x1ee7921, 0x1ee7d00, 0x1ee7e21, 0x1ee7f00, 0x1ee8021, 0x1ee8a00, 0x1ee8b21, 0x1ee9c00, 0x1eea121, 0x1eea400,
+    0x1eea521, 0x1eeaa00, 0x1eeab21, 0x1eebc00, 0x1eef001, 0x1eef200, 0x1f00001, 0x1f02c00, 0x1f03001, 0x1f09400,
+    0x1f0a001, 0x1f0af00, 0x1f0b101, 0x1f0c000, 0x1f0c101, 0x1f0d000, 0x1f0d101, 0x1f0f600, 0x1f10001, 0x1f1ae00,
+    0x1f1e601, 0x1f20300, 0x1f21001, 0x1f23c00, 0x1f24001, 0x1f24900, 0x1f25001, 0x1f25200, 0x1f26001, 0x1f26600,
+    0x1f30001, 0x1f6d800, 0x1f6dd01, 0x1f6ed00, 0x1f6f001, 0x1f6fd00, 0x1f70001, 0x1f77400, 0x1f78001, 0x1f7d900,
+    0x1f7e001, 0x1f7ec00, 0x1f7f001, 0x1f7f100, 0x1f80001, 0x1f80c00, 0x1f81001, 0x1f84800, 0x1f85001, 0x1f85a00,
+    0x1f86001, 0x1f88800, 0x1f89001, 0x1f8ae00, 0x1f8b001, 0x1f8b200, 0x1f90001, 0x1fa5400, 0x1fa6001, 0x1fa6e00,
+    0x1fa7001, 0x1fa7500, 0x1fa7801, 0x1fa7d00, 0x1fa8001, 0x1fa8700, 0x1fa9001, 0x1faad00, 0x1fab001, 0x1fabb00,
+    0x1fac001, 0x1fac600, 0x1fad001, 0x1fada00, 0x1fae001, 0x1fae800, 0x1faf001, 0x1faf700, 0x1fb0001, 0x1fb9300,
+    0x1fb9401, 0x1fbcb00, 0x1fbf001, 0x1fbfa00, 0x2000001, 0x2a6e000, 0x2a70001, 0x2b73900, 0x2b74001, 0x2b81e00,
+    0x2b82001, 0x2cea200, 0x2ceb001, 0x2ebe100, 0x2f80011, 0x2fa1e00, 0x3000001, 0x3134b00, 0xe000101, 0xe000200,
+    0xe002001, 0xe008000, 0xe010003, 0xe01f000, 0xf000001, 0xffffe00, 0x10000001, 0x10fffe00,
+};
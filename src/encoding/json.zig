@@ -0,0 +1,907 @@
+// JSON Codec
+//
+// Host side of the json module acceleration. Neither direction touches
+// Python objects:
+// - decode parses JSON text into marshal bytes that the guest materializes
+//   with marshal.loads(), which is far less work than json's scanner
+// - encode formats the marshal.dumps() output of an object as JSON text,
+//   honouring json.dumps' indent, separators, sort_keys, ensure_ascii,
+//   allow_nan and skipkeys options
+//
+// The output matches CPython's json module byte for byte. Anything outside
+// the fast path (syntax errors, unsupported types, circular references) is
+// reported as an error and the guest falls back to the original json
+// functions, which then raise the usual exceptions.
+
+const std = @import("std");
+const marshal = @import("marshal.zig");
+const Managed = std.math.big.int.Managed;
+
+pub const JsonError = error{
+    /// Invalid JSON, or input the fast path does not handle
+    SyntaxError,
+    /// Object that json.dumps cannot serialize without help
+    NotSerializable,
+    /// NaN or infinity with allow_nan=False
+    NonFiniteFloat,
+    /// Nesting deeper than max_depth (includes circular references)
+    TooDeep,
+    BadMarshal,
+    OutOfMemory,
+};
+
+/// Deeper nesting hits CPython's recursion limit anyway
+pub const max_depth = 1000;
+
+/// CPython's default int max_str_digits
+const max_int_digits = 4300;
+
+// ============================================================================
+// Decoding: JSON text -> marshal
+// ============================================================================
+
+/// Parse JSON text (UTF-8; encoded surrogates allowed) into marshal bytes
+/// for marshal.loads(). Caller owns the result.
+pub fn decode(allocator: std.mem.Allocator, text: []const u8) JsonError![]u8 {
+    var arena = std.heap.ArenaAllocator.init(allocator);
+    defer arena.deinit();
+
+    var parser = Parser{
+        .src = text,
+        .writer = marshal.Writer.init(allocator),
+        .arena = arena.allocator(),
+    };
+    errdefer parser.writer.deinit();
+
+    parser.skipWhitespace();
+    try parser.parseValue();
+    parser.skipWhitespace();
+    if (parser.pos != text.len) return error.SyntaxError;
+
+    return parser.writer.toOwnedSlice() catch error.OutOfMemory;
+}
+
+const Parser = struct {
+    src: []const u8,
+    pos: usize = 0,
+    depth: usize = 0,
+    writer: marshal.Writer,
+    /// Scratch and key storage, freed when decode returns
+    arena: std.mem.Allocator,
+    /// Dict keys already emitted, by marshal reference index. Repeated keys
+    /// become references, so the guest shares one str object per key like
+    /// json's own memo does.
+    keys: std.StringHashMapUnmanaged(u32) = .empty,
+    scratch: std.ArrayListUnmanaged(u8) = .empty,
+
+    fn skipWhitespace(self: *Parser) void {
+        while (self.pos < self.src.len) : (self.pos += 1) {
+            switch (self.src[self.pos]) {
+                ' ', '\t', '\n', '\r' => {},
+                else => return,
+            }
+        }
+    }
+
+    fn peek(self: *Parser) JsonError!u8 {
+        if (self.pos >= self.src.len) return error.SyntaxError;
+        return self.src[self.pos];
+    }
+
+    fn consumeLiteral(self: *Parser, literal: []const u8) bool {
+        if (!std.mem.startsWith(u8, self.src[self.pos..], literal)) return false;
+        self.pos += literal.len;
+        return true;
+    }
+
+    fn parseValue(self: *Parser) JsonError!void {
+        switch (try self.peek()) {
+            '{' => try self.parseObject(),
+            '[' => try self.parseArray(),
+            '"' => try self.parseString(false),
+            'n' => {
+                if (!self.consumeLiteral("null")) return error.SyntaxError;
+                try self.writer.writeNone();
+            },
+            't' => {
+                if (!self.consumeLiteral("true")) return error.SyntaxError;
+                try self.writer.writeBool(true);
+            },
+            'f' => {
+                if (!self.consumeLiteral("false")) return error.SyntaxError;
+                try self.writer.writeBool(false);
+            },
+            // json.loads accepts these by default (parse_constant)
+            'N' => {
+                if (!self.consumeLiteral("NaN")) return error.SyntaxError;
+                try self.writer.writeFloat(std.math.nan(f64));
+            },
+            'I' => {
+                if (!self.consumeLiteral("Infinity")) return error.SyntaxError;
+                try self.writer.writeFloat(std.math.inf(f64));
+            },
+            '-' => {
+                if (self.consumeLiteral("-Infinity")) {
+                    try self.writer.writeFloat(-std.math.inf(f64));
+                } else {
+                    try self.parseNumber();
+                }
+            },
+            '0'...'9' => try self.parseNumber(),
+            else => return error.SyntaxError,
+        }
+    }
+
+    fn enter(self: *Parser) JsonError!void {
+        self.depth += 1;
+        if (self.depth > max_depth) return error.TooDeep;
+        self.pos += 1;
+        self.skipWhitespace();
+    }
+
+    fn parseObject(self: *Parser) JsonError!void {
+        try self.enter();
+        defer self.depth -= 1;
+        try self.writer.beginDict();
+
+        if (try self.peek() == '}') {
+            self.pos += 1;
+            return self.writer.endDict();
+        }
+
+        while (true) {
+            if (try self.peek() != '"') return error.SyntaxError;
+            try self.parseString(true);
+            self.skipWhitespace();
+            if (try self.peek() != ':') return error.SyntaxError;
+            self.pos += 1;
+            self.skipWhitespace();
+            try self.parseValue();
+            self.skipWhitespace();
+
+            switch (try self.peek()) {
+                ',' => {
+                    self.pos += 1;
+                    self.skipWhitespace();
+                },
+                '}' => {
+                    self.pos += 1;
+                    return self.writer.endDict();
+                },
+                else => return error.SyntaxError,
+            }
+        }
+    }
+
+    fn parseArray(self: *Parser) JsonError!void {
+        try self.enter();
+        defer self.depth -= 1;
+        const len_pos = try self.writer.beginList();
+
+        if (try self.peek() == ']') {
+            self.pos += 1;
+            return;
+        }
+
+        var count: usize = 0;
+        while (true) {
+            try self.parseValue();
+            count += 1;
+            self.skipWhitespace();
+
+            switch (try self.peek()) {
+                ',' => {
+                    self.pos += 1;
+                    self.skipWhitespace();
+                },
+                ']' => {
+                    self.pos += 1;
+                    self.writer.endList(len_pos, count);
+                    return;
+                },
+                else => return error.SyntaxError,
+            }
+        }
+    }
+
+    fn parseString(self: *Parser, is_key: bool) JsonError!void {
+        self.pos += 1; // opening quote
+        const start = self.pos;
+        var is_ascii = true;
+
+        // Fast path: no escapes, the bytes are the string
+        while (self.pos < self.src.len) : (self.pos += 1) {
+            const c = self.src[self.pos];
+            if (c == '"' or c == '\\' or c < 0x20) break;
+            if (c >= 0x80) is_ascii = false;
+        }
+        if (self.pos >= self.src.len) return error.SyntaxError;
+
+        var bytes: []const u8 = undefined;
+        if (self.src[self.pos] == '"') {
+            bytes = self.src[start..self.pos];
+            self.pos += 1;
+        } else {
+            self.scratch.clearRetainingCapacity();
+            try self.scratch.appendSlice(self.arena, self.src[start..self.pos]);
+            try self.parseEscapedTail(&is_ascii);
+            bytes = self.scratch.items;
+        }
+
+        if (!is_ascii and !validWtf8(bytes)) return error.SyntaxError;
+
+        if (!is_key) {
+            _ = try self.writer.writeString(bytes, is_ascii, false, false);
+            return;
+        }
+
+        if (self.keys.get(bytes)) |index| {
+            try self.writer.writeRef(index);
+            return;
+        }
+        const index = (try self.writer.writeString(bytes, is_ascii, true, true)).?;
+        const owned = try self.arena.dupe(u8, bytes);
+        try self.keys.put(self.arena, owned, index);
+    }
+
+    /// Continue a string at its first backslash or control character,
+    /// unescaping into scratch up to and including the closing quote
+    fn parseEscapedTail(self: *Parser, is_ascii: *bool) JsonError!void {
+        while (self.pos < self.src.len) {
+            const c = self.src[self.pos];
+            self.pos += 1;
+            switch (c) {
+                '"' => return,
+                '\\' => {
+                    const e = try self.peek();
+                    self.pos += 1;
+                    const unescaped: u8 = switch (e) {
+                        '"' => '"',
+                        '\\' => '\\',
+                        '/' => '/',
+                        'b' => 0x08,
+                        'f' => 0x0c,
+                        'n' => '\n',
+                        'r' => '\r',
+                        't' => '\t',
+                        'u' => {
+                            var cp: u21 = try self.parseHex4();
+                            // Join a surrogate pair; a lone surrogate stays as is
+                            if (cp >= 0xd800 and cp <= 0xdbff and std.mem.startsWith(u8, self.src[self.pos..], "\\u")) {
+                                const saved = self.pos;
+                                self.pos += 2;
+                                const low = try self.parseHex4();
+                                if (low >= 0xdc00 and low <= 0xdfff) {
+                                    cp = 0x10000 + ((cp - 0xd800) << 10) + (low - 0xdc00);
+                                } else {
+                                    self.pos = saved;
+                                }
+                            }
+                            if (cp >= 0x80) is_ascii.* = false;
+                            var buf: [4]u8 = undefined;
+                            const n = encodeWtf8(cp, &buf);
+                            try self.scratch.appendSlice(self.arena, buf[0..n]);
+                            continue;
+                        },
+                        else => return error.SyntaxError,
+                    };
+                    try self.scratch.append(self.arena, unescaped);
+                },
+                else => {
+                    // strict=True rejects raw control characters
+                    if (c < 0x20) return error.SyntaxError;
+                    if (c >= 0x80) is_ascii.* = false;
+                    try self.scratch.append(self.arena, c);
+                },
+            }
+        }
+        return error.SyntaxError;
+    }
+
+    fn parseHex4(self: *Parser) JsonError!u21 {
+        if (self.src.len - self.pos < 4) return error.SyntaxError;
+        const digits = self.src[self.pos..][0..4];
+        self.pos += 4;
+        // Exactly four hex digits; parseInt would also take signs and '_'
+        var value: u21 = 0;
+        for (digits) |c| {
+            const digit = std.fmt.charToDigit(c, 16) catch return error.SyntaxError;
+            value = value * 16 + digit;
+        }
+        return value;
+    }
+
+    fn parseNumber(self: *Parser) JsonError!void {
+        const start = self.pos;
+        if (self.src[self.pos] == '-') self.pos += 1;
+
+        // Integer part: 0 or [1-9][0-9]*
+        const int_start = self.pos;
+        if (try self.peek() == '0') {
+            self.pos += 1;
+        } else {
+            self.skipDigits();
+            if (self.pos == int_start) return error.SyntaxError;
+        }
+
+        var is_float = false;
+        // Like json's NUMBER_RE, a '.' or 'e' without digits ends the number
+        // (and then fails as extra data)
+        if (self.pos + 1 < self.src.len and self.src[self.pos] == '.' and std.ascii.isDigit(self.src[self.pos + 1])) {
+            self.pos += 1;
+            self.skipDigits();
+            is_float = true;
+        }
+        if (self.pos < self.src.len and (self.src[self.pos] == 'e' or self.src[self.pos] == 'E')) {
+            var p = self.pos + 1;
+            if (p < self.src.len and (self.src[p] == '+' or self.src[p] == '-')) p += 1;
+            if (p < self.src.len and std.ascii.isDigit(self.src[p])) {
+                self.pos = p;
+                self.skipDigits();
+                is_float = true;
+            }
+        }
+
+        const literal = self.src[start..self.pos];
+        if (is_float) {
+            const value = std.fmt.parseFloat(f64, literal) catch return error.SyntaxError;
+            return self.writer.writeFloat(value);
+        }
+
+        if (std.fmt.parseInt(i64, literal, 10)) |value| {
+            return self.writer.writeInt(value);
+        } else |_| {}
+
+        // int() refuses more digits than sys.get_int_max_str_digits()
+        if (literal.len - @intFromBool(literal[0] == '-') > max_int_digits) return error.SyntaxError;
+
+        var big = try Managed.init(self.arena);
+        defer big.deinit();
+        big.setString(10, literal) catch |err| switch (err) {
+            error.OutOfMemory => return error.OutOfMemory,
+            else => return error.SyntaxError,
+        };
+        try self.writer.writeBigInt(big.toConst());
+    }
+
+    fn skipDigits(self: *Parser) void {
+        while (self.pos < self.src.len and std.ascii.isDigit(self.src[self.pos])) self.pos += 1;
+    }
+};
+
+/// UTF-8 that may contain encoded surrogates, as Python's surrogatepass
+/// error handler produces and accepts
+fn validWtf8(bytes: []const u8) bool {
+    var i: usize = 0;
+    while (i < bytes.len) {
+        const len = std.unicode.utf8ByteSequenceLength(bytes[i]) catch return false;
+        if (i + len > bytes.len) return false;
+        if (len > 1) {
+            const seq = bytes[i..][0..len];
+            _ = switch (len) {
+                2 => std.unicode.utf8Decode2(seq[0..2].*),
+                3 => std.unicode.utf8Decode3AllowSurrogateHalf(seq[0..3].*),
+                4 => std.unicode.utf8Decode4(seq[0..4].*),
+                else => unreachable,
+            } catch return false;
+        }
+        i += len;
+    }
+    return true;
+}
+
+fn encodeWtf8(cp: u21, buf: *[4]u8) usize {
+    return std.unicode.wtf8Encode(cp, buf) catch unreachable;
+}
+
+// ============================================================================
+// Encoding: marshal -> JSON text
+// ============================================================================
+
+pub const EncodeOptions = struct {
+    ensure_ascii: bool = true,
+    allow_nan: bool = true,
+    sort_keys: bool = false,
+    skipkeys: bool = false,
+    /// null for single-line output
+    indent: ?[]const u8 = null,
+    item_separator: []const u8 = ", ",
+    key_separator: []const u8 = ": ",
+};
+
+/// Format marshal.dumps() output as json.dumps would. Caller owns the result.
+pub fn encode(allocator: std.mem.Allocator, data: []const u8, options: EncodeOptions) JsonError![]u8 {
+    var encoder = Encoder{
+        .src = data,
+        .options = options,
+        .allocator = allocator,
+    };
+    defer encoder.refs.deinit(allocator);
+    errdefer encoder.out.deinit(allocator);
+
+    // First pass numbers the flag_ref objects in stream order, so references
+    // resolve even when sort_keys emits values out of order
+    const end = try encoder.walk(0, .scan);
+    if (end != data.len) return error.BadMarshal;
+    _ = try encoder.walk(0, .emit);
+
+    return encoder.out.toOwnedSlice(allocator) catch error.OutOfMemory;
+}
+
+const Mode = enum {
+    /// Register references, no output
+    scan,
+    /// Find the end of an object
+    skip,
+    /// Write JSON
+    emit,
+};
+
+/// A dict key resolved to the string JSON will use
+const Key = struct {
+    /// Raw bytes for str keys, already-formatted text otherwise
+    bytes: []const u8,
+    is_str: bool,
+    is_ascii: bool,
+    value_pos: usize,
+};
+
+const Encoder = struct {
+    src: []const u8,
+    options: EncodeOptions,
+    allocator: std.mem.Allocator,
+    out: std.ArrayListUnmanaged(u8) = .empty,
+    /// Start offsets of flag_ref objects, by reference index
+    refs: std.ArrayListUnmanaged(usize) = .empty,
+    depth: usize = 0,
+    /// Formatting buffer for numeric keys
+    key_buf: [64]u8 = undefined,
+
+    fn write(self: *Encoder, bytes: []const u8) JsonError!void {
+        try self.out.appendSlice(self.allocator, bytes);
+    }
+
+    fn newline(self: *Encoder) JsonError!void {
+        const indent = self.options.indent orelse return;
+        try self.out.append(self.allocator, '\n');
+        for (0..self.depth) |_| try self.write(indent);
+    }
+
+    /// Process the object at pos; returns the offset just past it
+    fn walk(self: *Encoder, pos: usize, mode: Mode) JsonError!usize {
+        var r = marshal.Reader{ .src = self.src, .pos = pos };
+        const type_byte = r.readByte() catch return error.BadMarshal;
+        const t = type_byte & ~marshal.flag_ref;
+        if (type_byte & marshal.flag_ref != 0 and mode == .scan) {
+            try self.refs.append(self.allocator, pos);
+        }
+
+        switch (t) {
+            marshal.Type.none => if (mode == .emit) try self.write("null"),
+            marshal.Type.true_ => if (mode == .emit) try self.write("true"),
+            marshal.Type.false_ => if (mode == .emit) try self.write("false"),
+            marshal.Type.int => {
+                const value = r.readI32() catch return error.BadMarshal;
+                if (mode == .emit) {
+                    var buf: [16]u8 = undefined;
+                    try self.write(std.fmt.bufPrint(&buf, "{d}", .{value}) catch unreachable);
+                }
+            },
+            marshal.Type.long => {
+                if (mode == .emit) {
+                    try self.writeLong(&r);
+                } else {
+                    const n = r.readI32() catch return error.BadMarshal;
+                    _ = r.readBytes(@as(usize, @abs(n)) * 2) catch return error.BadMarshal;
+                }
+            },
+            marshal.Type.binary_float => {
+                const value = r.readF64() catch return error.BadMarshal;
+                if (mode == .emit) {
+                    var buf: [32]u8 = undefined;
+                    try self.write(try formatFloat(&buf, value, self.options.allow_nan));
+                }
+            },
+            marshal.Type.unicode,
+            marshal.Type.interned,
+            marshal.Type.ascii,
+            marshal.Type.ascii_interned,
+            marshal.Type.short_ascii,
+            marshal.Type.short_ascii_interned,
+            => {
+                const s = try readString(&r, t);
+                if (mode == .emit) try self.writeString(s.bytes, s.is_ascii);
+            },
+            marshal.Type.ref => {
+                const index = r.readLength() catch return error.BadMarshal;
+                if (mode == .emit) {
+                    if (index >= self.refs.items.len) return error.BadMarshal;
+                    // Re-walk the referenced object; a reference back into
+                    // an enclosing container recurses until TooDeep
+                    _ = try self.walk(self.refs.items[index], .emit);
+                }
+            },
+            marshal.Type.small_tuple, marshal.Type.tuple, marshal.Type.list => {
+                const count = if (t == marshal.Type.small_tuple)
+                    r.readByte() catch return error.BadMarshal
+                else
+                    r.readLength() catch return error.BadMarshal;
+                return self.walkArray(r.pos, count, mode);
+            },
+            marshal.Type.dict => return self.walkObject(r.pos, mode),
+            // bytes, sets, complex, code objects, ...
+            else => return error.NotSerializable,
+        }
+        return r.pos;
+    }
+
+    fn enter(self: *Encoder) JsonError!void {
+        self.depth += 1;
+        if (self.depth > max_depth) return error.TooDeep;
+    }
+
+    fn walkArray(self: *Encoder, start: usize, count: usize, mode: Mode) JsonError!usize {
+        try self.enter();
+        defer self.depth -= 1;
+
+        var pos = start;
+        if (mode != .emit) {
+            for (0..count) |_| pos = try self.walk(pos, mode);
+            return pos;
+        }
+
+        if (count == 0) {
+            try self.write("[]");
+            return pos;
+        }
+        try self.write("[");
+        for (0..count) |i| {
+            if (i > 0) try self.write(self.options.item_separator);
+            try self.newline();
+            pos = try self.walk(pos, .emit);
+        }
+        self.depth -= 1;
+        try self.newline();
+        self.depth += 1;
+        try self.write("]");
+        return pos;
+    }
+
+    fn walkObject(self: *Encoder, start: usize, mode: Mode) JsonError!usize {
+        try self.enter();
+        defer self.depth -= 1;
+
+        if (mode != .emit) {
+            var pos = start;
+            while (true) {
+                if (pos >= self.src.len) return error.BadMarshal;
+                if (self.src[pos] == marshal.Type.null_) return pos + 1;
+                pos = try self.walk(pos, mode); // key
+                pos = try self.walk(pos, mode); // value
+            }
+        }
+
+        // Collect the entries first: needed for sort_keys, and to print "{}"
+        // for a dict whose keys were all skipped
+        var keys: std.ArrayListUnmanaged(Key) = .empty;
+        defer {
+            for (keys.items) |key| {
+                if (!key.is_str) self.allocator.free(key.bytes);
+            }
+            keys.deinit(self.allocator);
+        }
+
+        var pos = start;
+        var all_str = true;
+        while (true) {
+            if (pos >= self.src.len) return error.BadMarshal;
+            if (self.src[pos] == marshal.Type.null_) {
+                pos += 1;
+                break;
+            }
+            const key_end = try self.walk(pos, .skip);
+            const value_end = try self.walk(key_end, .skip);
+            if (try self.resolveKey(pos, key_end)) |key| {
+                all_str = all_str and key.is_str;
+                try keys.append(self.allocator, key);
+            }
+            pos = value_end;
+        }
+
+        if (self.options.sort_keys) {
+            // Python refuses to order keys of mixed types, and sorts numbers
+            // numerically; leave both to the original encoder
+            if (!all_str) return error.NotSerializable;
+            std.sort.pdq(Key, keys.items, {}, struct {
+                fn lessThan(_: void, a: Key, b: Key) bool {
+                    // UTF-8 byte order is code point order
+                    return std.mem.order(u8, a.bytes, b.bytes) == .lt;
+                }
+            }.lessThan);
+        }
+
+        if (keys.items.len == 0) {
+            try self.write("{}");
+            return pos;
+        }
+        try self.write("{");
+        for (keys.items, 0..) |key, i| {
+            if (i > 0) try self.write(self.options.item_separator);
+            try self.newline();
+            if (key.is_str) {
+                try self.writeString(key.bytes, key.is_ascii);
+            } else {
+                try self.out.append(self.allocator, '"');
+                try self.write(key.bytes);
+                try self.out.append(self.allocator, '"');
+            }
+            try self.write(self.options.key_separator);
+            _ = try self.walk(key.value_pos, .emit);
+        }
+        self.depth -= 1;
+        try self.newline();
+        self.depth += 1;
+        try self.write("}");
+        return pos;
+    }
+
+    /// Turn the key object at pos into its JSON key text; null if skipkeys
+    /// drops it
+    fn resolveKey(self: *Encoder, pos: usize, value_pos: usize) JsonError!?Key {
+        var r = marshal.Reader{ .src = self.src, .pos = pos };
+        var t = (r.readByte() catch return error.BadMarshal) & ~marshal.flag_ref;
+        if (t == marshal.Type.ref) {
+            const index = r.readLength() catch return error.BadMarshal;
+            if (index >= self.refs.items.len) return error.BadMarshal;
+            r.pos = self.refs.items[index];
+            t = (r.readByte() catch return error.BadMarshal) & ~marshal.flag_ref;
+        }
+
+        // json.dumps converts these key types to strings
+        const text: []const u8 = switch (t) {
+            marshal.Type.unicode,
+            marshal.Type.interned,
+            marshal.Type.ascii,
+            marshal.Type.ascii_interned,
+            marshal.Type.short_ascii,
+            marshal.Type.short_ascii_interned,
+            => {
+                const s = try readString(&r, t);
+                return .{ .bytes = s.bytes, .is_str = true, .is_ascii = s.is_ascii, .value_pos = value_pos };
+            },
+            marshal.Type.true_ => "true",
+            marshal.Type.false_ => "false",
+            marshal.Type.none => "null",
+            marshal.Type.int => std.fmt.bufPrint(&self.key_buf, "{d}", .{r.readI32() catch return error.BadMarshal}) catch unreachable,
+            marshal.Type.binary_float => try formatFloat(&self.key_buf, r.readF64() catch return error.BadMarshal, self.options.allow_nan),
+            marshal.Type.long => blk: {
+                var big = try Managed.init(self.allocator);
+                defer big.deinit();
+                r.readLong(&big) catch |err| switch (err) {
+                    error.OutOfMemory => return error.OutOfMemory,
+                    else => return error.BadMarshal,
+                };
+                const digits = big.toString(self.allocator, 10, .lower) catch return error.OutOfMemory;
+                break :blk digits;
+            },
+            else => {
+                if (self.options.skipkeys) return null;
+                return error.NotSerializable;
+            },
+        };
+
+        const owned = if (t == marshal.Type.long) text else try self.allocator.dupe(u8, text);
+        return .{ .bytes = owned, .is_str = false, .is_ascii = true, .value_pos = value_pos };
+    }
+
+    fn writeLong(self: *Encoder, r: *marshal.Reader) JsonError!void {
+        var big = try Managed.init(self.allocator);
+        defer big.deinit();
+        r.readLong(&big) catch |err| switch (err) {
+            error.OutOfMemory => return error.OutOfMemory,
+            else => return error.BadMarshal,
+        };
+        const digits = big.toString(self.allocator, 10, .lower) catch return error.OutOfMemory;
+        defer self.allocator.free(digits);
+        // int.__repr__ raises past the digit limit; let the stdlib say so
+        if (digits.len - @intFromBool(!big.isPositive()) > max_int_digits) return error.NotSerializable;
+        try self.write(digits);
+    }
+
+    /// Quote and escape like json.encoder's encode_basestring(_ascii)
+    fn writeString(self: *Encoder, bytes: []const u8, is_ascii: bool) JsonError!void {
+        try self.out.ensureUnusedCapacity(self.allocator, bytes.len + 2);
+        try self.out.append(self.allocator, '"');
+
+        var run_start: usize = 0;
+        var i: usize = 0;
+        while (i < bytes.len) {
+            const c = bytes[i];
+            const needs_escape = c < 0x20 or c == '"' or c == '\\' or
+                (self.options.ensure_ascii and c >= 0x7f);
+            if (!needs_escape) {
+                i += 1;
+                continue;
+            }
+
+            try self.write(bytes[run_start..i]);
+            if (c < 0x80) {
+                try self.writeEscape(c);
+                i += 1;
+            } else {
+                // ensure_ascii: \u-escape the code point (surrogate pair
+                // above the BMP); is_ascii strings never get here
+                std.debug.assert(!is_ascii);
+                const len = std.unicode.utf8ByteSequenceLength(c) catch return error.BadMarshal;
+                if (i + len > bytes.len) return error.BadMarshal;
+                const cp = decodeWtf8(bytes[i..][0..len]) orelse return error.BadMarshal;
+                if (cp >= 0x10000) {
+                    const v = cp - 0x10000;
+                    try self.writeUnicodeEscape(@intCast(0xd800 | (v >> 10)));
+                    try self.writeUnicodeEscape(@intCast(0xdc00 | (v & 0x3ff)));
+                } else {
+                    try self.writeUnicodeEscape(@intCast(cp));
+                }
+                i += len;
+            }
+            run_start = i;
+        }
+        try self.write(bytes[run_start..]);
+        try self.out.append(self.allocator, '"');
+    }
+
+    fn writeEscape(self: *Encoder, c: u8) JsonError!void {
+        switch (c) {
+            '"' => try self.write("\\\""),
+            '\\' => try self.write("\\\\"),
+            '\n' => try self.write("\\n"),
+            '\r' => try self.write("\\r"),
+            '\t' => try self.write("\\t"),
+            0x08 => try self.write("\\b"),
+            0x0c => try self.write("\\f"),
+            else => try self.writeUnicodeEscape(c),
+        }
+    }
+
+    fn writeUnicodeEscape(self: *Encoder, unit: u16) JsonError!void {
+        var buf: [6]u8 = undefined;
+        try self.write(std.fmt.bufPrint(&buf, "\\u{x:0>4}", .{unit}) catch unreachable);
+    }
+};
+
+const StringData = struct { bytes: []const u8, is_ascii: bool };
+
+fn readString(r: *marshal.Reader, t: u8) JsonError!StringData {
+    const short = t == marshal.Type.short_ascii or t == marshal.Type.short_ascii_interned;
+    const len: usize = if (short)
+        r.readByte() catch return error.BadMarshal
+    else
+        r.readLength() catch return error.BadMarshal;
+    const bytes = r.readBytes(len) catch return error.BadMarshal;
+    const is_ascii = t != marshal.Type.unicode and t != marshal.Type.interned;
+    return .{ .bytes = bytes, .is_ascii = is_ascii };
+}
+
+fn decodeWtf8(seq: []const u8) ?u21 {
+    return switch (seq.len) {
+        2 => std.unicode.utf8Decode2(seq[0..2].*) catch null,
+        3 => std.unicode.utf8Decode3AllowSurrogateHalf(seq[0..3].*) catch null,
+        4 => std.unicode.utf8Decode4(seq[0..4].*) catch null,
+        else => null,
+    };
+}
+
+/// float.__repr__, with json's spellings of the non-finite values
+fn formatFloat(buf: []u8, value: f64, allow_nan: bool) JsonError![]const u8 {
+    if (std.math.isNan(value) or std.math.isInf(value)) {
+        if (!allow_nan) return error.NonFiniteFloat;
+        if (std.math.isNan(value)) return "NaN";
+        return if (value > 0) "Infinity" else "-Infinity";
+    }
+
+    // Shortest round-trip digits, e.g. "1.2345e3", "-5e-7", "0e0"
+    var sci_buf: [32]u8 = undefined;
+    const sci = std.fmt.bufPrint(&sci_buf, "{e}", .{value}) catch unreachable;
+    const negative = sci[0] == '-';
+    const e_pos = std.mem.indexOfScalar(u8, sci, 'e').?;
+    const exponent = std.fmt.parseInt(i32, sci[e_pos + 1 ..], 10) catch unreachable;
+
+    var digits_buf: [24]u8 = undefined;
+    var n: usize = 0;
+    for (sci[@intFromBool(negative)..e_pos]) |c| {
+        if (c == '.') continue;
+        digits_buf[n] = c;
+        n += 1;
+    }
+    // Drop trailing zeros of the mantissa ("1.0e0" -> "1")
+    while (n > 1 and digits_buf[n - 1] == '0') n -= 1;
+    const digits = digits_buf[0..n];
+
+    var out = std.Io.Writer.fixed(buf);
+    if (negative) out.writeByte('-') catch unreachable;
+
+    // repr switches to exponent notation outside 1e-4 <= |x| < 1e16
+    if (exponent >= -4 and exponent < 16) {
+        const point = exponent + 1; // digits before the decimal point
+        if (point <= 0) {
+            out.writeAll("0.") catch unreachable;
+            out.splatByteAll('0', @intCast(-point)) catch unreachable;
+            out.writeAll(digits) catch unreachable;
+        } else if (point >= n) {
+            out.writeAll(digits) catch unreachable;
+            out.splatByteAll('0', @as(usize, @intCast(point)) - n) catch unreachable;
+            out.writeAll(".0") catch unreachable;
+        } else {
+            const p: usize = @intCast(point);
+            out.print("{s}.{s}", .{ digits[0..p], digits[p..] }) catch unreachable;
+        }
+    } else {
+        out.writeByte(digits[0]) catch unreachable;
+        if (n > 1) out.print(".{s}", .{digits[1..]}) catch unreachable;
+        const sign: u8 = if (exponent < 0) '-' else '+';
+        out.print("e{c}{d:0>2}", .{ sign, @abs(exponent) }) catch unreachable;
+    }
+    return out.buffered();
+}
+
+// Tests
+fn expectRoundTrip(json_text: []const u8, options: EncodeOptions, expected: []const u8) !void {
+    const allocator = std.testing.allocator;
+    const marshalled = try decode(allocator, json_text);
+    defer allocator.free(marshalled);
+    const text = try encode(allocator, marshalled, options);
+    defer allocator.free(text);
+    try std.testing.expectEqualStrings(expected, text);
+}
+
+test "decode then encode" {
+    try expectRoundTrip(
+        \\ {"a": [1, 2.5, -0.0001, 1e16, true, null], "b": {"a": "x\"yé"}}
+    , .{ .ensure_ascii = false },
+        \\{"a": [1, 2.5, -0.0001, 1e+16, true, null], "b": {"a": "x\"yé"}}
+    );
+    try expectRoundTrip("[123456789012345678901234567890, -5]", .{}, "[123456789012345678901234567890, -5]");
+    try expectRoundTrip("{\"b\": 1, \"a\": [], \"c\": {}}", .{ .sort_keys = true, .indent = "  ", .item_separator = "," },
+        \\{
+        \\  "a": [],
+        \\  "b": 1,
+        \\  "c": {}
+        \\}
+    );
+    try expectRoundTrip("\"\\ud83d\\ude00 caf\\u00e9\"", .{ .ensure_ascii = false }, "\"\u{1f600} café\"");
+    try expectRoundTrip("\"\\ud83d\\ude00\"", .{}, "\"\\ud83d\\ude00\"");
+}
+
+test "decode rejects what json.loads rejects" {
+    const allocator = std.testing.allocator;
+    const bad = [_][]const u8{ "", "[1,]", "{\"a\" 1}", "01", "[1] x", "\"\x01\"", "tru", "{1: 2}" };
+    for (bad) |text| {
+        try std.testing.expectError(error.SyntaxError, decode(allocator, text));
+    }
+}
+
+test "repeated keys become marshal references" {
+    const allocator = std.testing.allocator;
+    const marshalled = try decode(allocator, "[{\"id\": 1}, {\"id\": 2}]");
+    defer allocator.free(marshalled);
+    // Second "id" is a 5-byte reference to index 0
+    try std.testing.expect(std.mem.indexOf(u8, marshalled, "r\x00\x00\x00\x00") != null);
+}
+
+test "float repr" {
+    var buf: [32]u8 = undefined;
+    const cases = [_]struct { value: f64, expected: []const u8 }{
+        .{ .value = 0.0, .expected = "0.0" },
+        .{ .value = 1.0, .expected = "1.0" },
+        .{ .value = 0.1, .expected = "0.1" },
+        .{ .value = 1e-5, .expected = "1e-05" },
+        .{ .value = 123456789.0, .expected = "123456789.0" },
+        .{ .value = 1.5e300, .expected = "1.5e+300" },
+        .{ .value = -2.5e-10, .expected = "-2.5e-10" },
+        .{ .value = 1e15, .expected = "1000000000000000.0" },
+    };
+    for (cases) |case| {
+        try std.testing.expectEqualStrings(case.expected, try formatFloat(&buf, case.value, true));
+    }
+    try std.testing.expectError(error.NonFiniteFloat, formatFloat(&buf, std.math.inf(f64), false));
+}
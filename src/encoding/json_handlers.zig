@@ -0,0 +1,263 @@
+const std = @import("std");
+const zware = @import("zware");
+const json = @import("json.zig");
+
+/// WASI errno values returned by json host functions
+pub const JsonStatus = enum(u32) {
+    success = 0,
+    ilseq = 25, // Not handled by the fast path; the guest falls back
+    inval = 28, // Out-of-bounds buffer or unknown handle
+    nomem = 48,
+};
+
+/// Option flags in EncodeRecord.flags, mirroring json.dumps arguments
+const flag_ensure_ascii = 1 << 0;
+const flag_allow_nan = 1 << 1;
+const flag_sort_keys = 1 << 2;
+const flag_skipkeys = 1 << 3;
+const flag_has_indent = 1 << 4;
+
+/// Layout of the options record read from opts_ptr: flags followed by
+/// (ptr, len) pairs for indent, item separator and key separator
+const EncodeRecord = extern struct {
+    flags: u32,
+    indent_ptr: u32,
+    indent_len: u32,
+    item_sep_ptr: u32,
+    item_sep_len: u32,
+    key_sep_ptr: u32,
+    key_sep_len: u32,
+};
+
+pub const ResultHandle = u32;
+
+/// Encoded or decoded output waiting for the guest to collect it. The guest
+/// learns the size first, allocates a buffer of its own, then takes the
+/// bytes with json_take. Each runtime has its own, used only by the thread
+/// running it, so it takes no lock.
+pub const ResultTable = struct {
+    results: std.AutoHashMap(ResultHandle, []u8),
+    next_handle: ResultHandle,
+    allocator: std.mem.Allocator,
+    /// Copies of the results taken by checkpoint(), for restore()
+    saved: ?Saved,
+
+    const Saved = struct {
+        results: std.AutoHashMap(ResultHandle, []u8),
+        next_handle: ResultHandle,
+    };
+
+    pub fn init(allocator: std.mem.Allocator) ResultTable {
+        return ResultTable{
+            .results = std.AutoHashMap(ResultHandle, []u8).init(allocator),
+            .next_handle = 1,
+            .allocator = allocator,
+            .saved = null,
+        };
+    }
+
+    pub fn deinit(self: *ResultTable) void {
+        self.freeResults(&self.results);
+        if (self.saved) |*saved| self.freeResults(&saved.results);
+    }
+
+    fn freeResults(self: *ResultTable, results: *std.AutoHashMap(ResultHandle, []u8)) void {
+        var iter = results.valueIterator();
+        while (iter.next()) |bytes| self.allocator.free(bytes.*);
+        results.deinit();
+    }
+
+    /// Deep copy of a map of results
+    fn cloneResults(self: *ResultTable, results: *const std.AutoHashMap(ResultHandle, []u8)) !std.AutoHashMap(ResultHandle, []u8) {
+        var copy = std.AutoHashMap(ResultHandle, []u8).init(self.allocator);
+        errdefer self.freeResults(&copy);
+        try copy.ensureTotalCapacity(results.count());
+
+        var iter = results.iterator();
+        while (iter.next()) |entry| {
+            copy.putAssumeCapacityNoClobber(entry.key_ptr.*, try self.allocator.dupe(u8, entry.value_ptr.*));
+        }
+        return copy;
+    }
+
+    pub fn add(self: *ResultTable, bytes: []u8) !ResultHandle {
+        const handle = self.next_handle;
+        self.next_handle += 1;
+        try self.results.put(handle, bytes);
+        return handle;
+    }
+
+    /// Remove a result; the caller frees it with the table's allocator
+    pub fn take(self: *ResultTable, handle: ResultHandle) ?[]u8 {
+        const entry = self.results.fetchRemove(handle) orelse return null;
+        return entry.value;
+    }
+
+    /// Remember every result still waiting for restore()
+    pub fn checkpoint(self: *ResultTable) !void {
+        const results = try self.cloneResults(&self.results);
+        if (self.saved) |*saved| self.freeResults(&saved.results);
+        self.saved = .{ .results = results, .next_handle = self.next_handle };
+    }
+
+    /// Put the table back as checkpoint() left it: results stored since
+    /// are freed, and taken ones are back. Does nothing without a
+    /// checkpoint.
+    pub fn restore(self: *ResultTable) !void {
+        const saved = if (self.saved) |*saved| saved else return;
+        const results = try self.cloneResults(&saved.results);
+        self.freeResults(&self.results);
+        self.results = results;
+        self.next_handle = saved.next_handle;
+    }
+};
+
+/// Result table of the runtime running on this thread. Each Runtime owns
+/// one and binds it before every call into the guest (see runtime.zig).
+threadlocal var current_table: ?*ResultTable = null;
+
+/// Set the result table used by the json handlers on the calling thread
+pub fn setTable(table: ?*ResultTable) void {
+    current_table = table;
+}
+
+fn pushStatus(vm: *zware.VirtualMachine, status: JsonStatus) zware.WasmError!void {
+    try vm.pushOperand(u32, @intFromEnum(status));
+}
+
+fn toStatus(err: json.JsonError) JsonStatus {
+    return switch (err) {
+        error.OutOfMemory => .nomem,
+        else => .ilseq,
+    };
+}
+
+/// Slice of guest memory, or null if the range is out of bounds
+fn guestSlice(memory_slice: []u8, ptr: u32, len: u32) ?[]u8 {
+    if (@as(u64, ptr) + len > memory_slice.len) return null;
+    return memory_slice[ptr .. ptr + len];
+}
+
+/// Park a result in the table and report its handle and size to the guest
+fn storeResult(vm: *zware.VirtualMachine, table: *ResultTable, bytes: []u8, handle_ptr: u32, size_ptr: u32) zware.WasmError!void {
+    const handle = table.add(bytes) catch {
+        table.allocator.free(bytes);
+        return pushStatus(vm, .nomem);
+    };
+
+    const mem = try vm.inst.getMemory(0);
+    try mem.write(u32, 0, handle_ptr, handle);
+    try mem.write(u32, 0, size_ptr, @intCast(bytes.len));
+    try pushStatus(vm, .success);
+}
+
+/// json_decode: Parse JSON text (UTF-8) into marshal data for marshal.loads.
+/// Writes the result handle and its size.
+pub fn jsonDecode(vm: *zware.VirtualMachine, _: usize) zware.WasmError!void {
+    const size_ptr = vm.popOperand(u32);
+    const handle_ptr = vm.popOperand(u32);
+    const data_len = vm.popOperand(u32);
+    const data_ptr = vm.popOperand(u32);
+
+    const table = current_table orelse return pushStatus(vm, .inval);
+    const mem = try vm.inst.getMemory(0);
+    const text = guestSlice(mem.memory(), data_ptr, data_len) orelse return pushStatus(vm, .inval);
+    if (guestSlice(mem.memory(), handle_ptr, 4) == null or guestSlice(mem.memory(), size_ptr, 4) == null) {
+        return pushStatus(vm, .inval);
+    }
+
+    const result = json.decode(table.allocator, text) catch |err| return pushStatus(vm, toStatus(err));
+    try storeResult(vm, table, result, handle_ptr, size_ptr);
+}
+
+/// json_encode: Format marshal.dumps output as JSON text using the options
+/// record at opts_ptr. Writes the result handle and its size.
+pub fn jsonEncode(vm: *zware.VirtualMachine, _: usize) zware.WasmError!void {
+    const size_ptr = vm.popOperand(u32);
+    const handle_ptr = vm.popOperand(u32);
+    const opts_ptr = vm.popOperand(u32);
+    const data_len = vm.popOperand(u32);
+    const data_ptr = vm.popOperand(u32);
+
+    const table = current_table orelse return pushStatus(vm, .inval);
+    const mem = try vm.inst.getMemory(0);
+    const memory = mem.memory();
+    const data = guestSlice(memory, data_ptr, data_len) orelse return pushStatus(vm, .inval);
+    const record_bytes = guestSlice(memory, opts_ptr, @sizeOf(EncodeRecord)) orelse return pushStatus(vm, .inval);
+    if (guestSlice(memory, handle_ptr, 4) == null or guestSlice(memory, size_ptr, 4) == null) {
+        return pushStatus(vm, .inval);
+    }
+
+    const record = std.mem.bytesToValue(EncodeRecord, record_bytes[0..@sizeOf(EncodeRecord)]);
+    const indent = guestSlice(memory, record.indent_ptr, record.indent_len) orelse return pushStatus(vm, .inval);
+    const item_sep = guestSlice(memory, record.item_sep_ptr, record.item_sep_len) orelse return pushStatus(vm, .inval);
+    const key_sep = guestSlice(memory, record.key_sep_ptr, record.key_sep_len) orelse return pushStatus(vm, .inval);
+
+    const options = json.EncodeOptions{
+        .ensure_ascii = record.flags & flag_ensure_ascii != 0,
+        .allow_nan = record.flags & flag_allow_nan != 0,
+        .sort_keys = record.flags & flag_sort_keys != 0,
+        .skipkeys = record.flags & flag_skipkeys != 0,
+        .indent = if (record.flags & flag_has_indent != 0) indent else null,
+        .item_separator = item_sep,
+        .key_separator = key_sep,
+    };
+
+    const result = json.encode(table.allocator, data, options) catch |err| return pushStatus(vm, toStatus(err));
+    try storeResult(vm, table, result, handle_ptr, size_ptr);
+}
+
+/// json_take: Copy a result into a guest buffer of exactly its size and
+/// release it. Passing a zero-length buffer just releases the result.
+pub fn jsonTake(vm: *zware.VirtualMachine, _: usize) zware.WasmError!void {
+    const out_len = vm.popOperand(u32);
+    const out_ptr = vm.popOperand(u32);
+    const handle = vm.popOperand(u32);
+
+    const table = current_table orelse return pushStatus(vm, .inval);
+    const bytes = table.take(handle) orelse return pushStatus(vm, .inval);
+    defer table.allocator.free(bytes);
+
+    if (out_len == 0 and bytes.len != 0) return pushStatus(vm, .success);
+    const mem = try vm.inst.getMemory(0);
+    const out = guestSlice(mem.memory(), out_ptr, out_len) orelse return pushStatus(vm, .inval);
+    if (out.len != bytes.len) return pushStatus(vm, .inval);
+
+    @memcpy(out, bytes);
+    try pushStatus(vm, .success);
+}
+
+/// Register all json WASI functions
+pub fn registerJsonFunctions(store: *zware.Store) !void {
+    const i32_result = &[_]zware.ValType{.I32};
+
+    // json_decode(data_ptr: i32, data_len: i32, handle_ptr: i32, size_ptr: i32) -> i32
+    try store.exposeHostFunction(
+        "wasi_snapshot_preview1",
+        "json_decode",
+        jsonDecode,
+        0,
+        &.{ .I32, .I32, .I32, .I32 },
+        i32_result,
+    );
+
+    // json_encode(data_ptr: i32, data_len: i32, opts_ptr: i32, handle_ptr: i32, size_ptr: i32) -> i32
+    try store.exposeHostFunction(
+        "wasi_snapshot_preview1",
+        "json_encode",
+        jsonEncode,
+        0,
+        &.{ .I32, .I32, .I32, .I32, .I32 },
+        i32_result,
+    );
+
+    // json_take(handle: i32, out_ptr: i32, out_len: i32) -> i32
+    try store.exposeHostFunction(
+        "wasi_snapshot_preview1",
+        "json_take",
+        jsonTake,
+        0,
+        &.{ .I32, .I32, .I32 },
+        i32_result,
+    );
+}
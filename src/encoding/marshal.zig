@@ -0,0 +1,265 @@
+// CPython marshal format
+//
+// The subset of marshal (Python/marshal.c) needed to move JSON-shaped data
+// across the guest boundary without building Python objects on the host:
+// None, bools, int, float, str, list, tuple and dict. The guest turns the
+// bytes into objects with marshal.loads(), and produces them for us with
+// marshal.dumps().
+
+const std = @import("std");
+
+pub const Type = struct {
+    pub const null_ = '0';
+    pub const none = 'N';
+    pub const false_ = 'F';
+    pub const true_ = 'T';
+    pub const int = 'i';
+    pub const long = 'l';
+    pub const binary_float = 'g';
+    pub const unicode = 'u';
+    pub const interned = 't';
+    pub const ascii = 'a';
+    pub const ascii_interned = 'A';
+    pub const short_ascii = 'z';
+    pub const short_ascii_interned = 'Z';
+    pub const small_tuple = ')';
+    pub const tuple = '(';
+    pub const list = '[';
+    pub const dict = '{';
+    pub const ref = 'r';
+};
+
+/// Set on an object's type byte to add it to the reference table
+pub const flag_ref: u8 = 0x80;
+
+/// marshal stores ints that don't fit in 32 bits as base 2**15 digits
+pub const long_shift = 15;
+const long_mask = (1 << long_shift) - 1;
+
+pub const Writer = struct {
+    out: std.ArrayListUnmanaged(u8) = .empty,
+    allocator: std.mem.Allocator,
+    /// Number of objects written with flag_ref
+    ref_count: u32 = 0,
+
+    pub fn init(allocator: std.mem.Allocator) Writer {
+        return .{ .allocator = allocator };
+    }
+
+    pub fn deinit(self: *Writer) void {
+        self.out.deinit(self.allocator);
+    }
+
+    pub fn toOwnedSlice(self: *Writer) ![]u8 {
+        return self.out.toOwnedSlice(self.allocator);
+    }
+
+    fn writeByte(self: *Writer, b: u8) !void {
+        try self.out.append(self.allocator, b);
+    }
+
+    fn writeI32(self: *Writer, value: i32) !void {
+        var buf: [4]u8 = undefined;
+        std.mem.writeInt(i32, &buf, value, .little);
+        try self.out.appendSlice(self.allocator, &buf);
+    }
+
+    pub fn writeNone(self: *Writer) !void {
+        try self.writeByte(Type.none);
+    }
+
+    pub fn writeBool(self: *Writer, value: bool) !void {
+        try self.writeByte(if (value) Type.true_ else Type.false_);
+    }
+
+    pub fn writeInt(self: *Writer, value: i64) !void {
+        if (std.math.cast(i32, value)) |small| {
+            try self.writeByte(Type.int);
+            try self.writeI32(small);
+            return;
+        }
+
+        var magnitude = @abs(value);
+        var digits: [5]u16 = undefined;
+        var n: usize = 0;
+        while (magnitude != 0) : (n += 1) {
+            digits[n] = @intCast(magnitude & long_mask);
+            magnitude >>= long_shift;
+        }
+        try self.writeLongDigits(value < 0, digits[0..n]);
+    }
+
+    /// Arbitrary-precision int given as a big integer
+    pub fn writeBigInt(self: *Writer, value: std.math.big.int.Const) !void {
+        const bits = value.bitCountAbs();
+        const n = (bits + long_shift - 1) / long_shift;
+
+        try self.writeByte(Type.long);
+        try self.writeI32(@intCast(if (value.positive) @as(i64, @intCast(n)) else -@as(i64, @intCast(n))));
+
+        const limb_bits = @bitSizeOf(std.math.big.Limb);
+        for (0..n) |i| {
+            const offset = i * long_shift;
+            const limb = offset / limb_bits;
+            const shift: std.math.Log2Int(std.math.big.Limb) = @intCast(offset % limb_bits);
+            var digit = value.limbs[limb] >> shift;
+            if (shift + long_shift > limb_bits and limb + 1 < value.limbs.len) {
+                digit |= value.limbs[limb + 1] << @intCast(limb_bits - @as(usize, shift));
+            }
+            var buf: [2]u8 = undefined;
+            std.mem.writeInt(u16, &buf, @intCast(digit & long_mask), .little);
+            try self.out.appendSlice(self.allocator, &buf);
+        }
+    }
+
+    fn writeLongDigits(self: *Writer, negative: bool, digits: []const u16) !void {
+        const n: i32 = @intCast(digits.len);
+        try self.writeByte(Type.long);
+        try self.writeI32(if (negative) -n else n);
+        for (digits) |digit| {
+            var buf: [2]u8 = undefined;
+            std.mem.writeInt(u16, &buf, digit, .little);
+            try self.out.appendSlice(self.allocator, &buf);
+        }
+    }
+
+    pub fn writeFloat(self: *Writer, value: f64) !void {
+        try self.writeByte(Type.binary_float);
+        var buf: [8]u8 = undefined;
+        std.mem.writeInt(u64, &buf, @bitCast(value), .little);
+        try self.out.appendSlice(self.allocator, &buf);
+    }
+
+    /// Write a str from its UTF-8 bytes (surrogates allowed, as marshal
+    /// decodes with surrogatepass). Interned strings become dict-key-fast on
+    /// the guest; remember=true adds the string to the reference table and
+    /// returns its index.
+    pub fn writeString(self: *Writer, bytes: []const u8, is_ascii: bool, intern: bool, remember: bool) !?u32 {
+        var t: u8 = if (is_ascii)
+            (if (bytes.len < 256)
+                (if (intern) Type.short_ascii_interned else Type.short_ascii)
+            else if (intern) Type.ascii_interned else Type.ascii)
+        else if (intern) Type.interned else Type.unicode;
+        if (remember) t |= flag_ref;
+
+        try self.writeByte(t);
+        if (is_ascii and bytes.len < 256) {
+            try self.writeByte(@intCast(bytes.len));
+        } else {
+            try self.writeI32(@intCast(bytes.len));
+        }
+        try self.out.appendSlice(self.allocator, bytes);
+
+        if (!remember) return null;
+        defer self.ref_count += 1;
+        return self.ref_count;
+    }
+
+    pub fn writeRef(self: *Writer, index: u32) !void {
+        try self.writeByte(Type.ref);
+        try self.writeI32(@intCast(index));
+    }
+
+    /// Start a list whose length is patched in by endList
+    pub fn beginList(self: *Writer) !usize {
+        try self.writeByte(Type.list);
+        const pos = self.out.items.len;
+        try self.writeI32(0);
+        return pos;
+    }
+
+    pub fn endList(self: *Writer, pos: usize, count: usize) void {
+        std.mem.writeInt(i32, self.out.items[pos..][0..4], @intCast(count), .little);
+    }
+
+    pub fn beginDict(self: *Writer) !void {
+        try self.writeByte(Type.dict);
+    }
+
+    pub fn endDict(self: *Writer) !void {
+        try self.writeByte(Type.null_);
+    }
+};
+
+pub const ReadError = error{ Truncated, BadMarshal };
+
+/// Cursor over marshal bytes
+pub const Reader = struct {
+    src: []const u8,
+    pos: usize = 0,
+
+    pub fn readByte(self: *Reader) ReadError!u8 {
+        if (self.pos >= self.src.len) return error.Truncated;
+        defer self.pos += 1;
+        return self.src[self.pos];
+    }
+
+    pub fn readI32(self: *Reader) ReadError!i32 {
+        const bytes = try self.readBytes(4);
+        return std.mem.readInt(i32, bytes[0..4], .little);
+    }
+
+    pub fn readLength(self: *Reader) ReadError!usize {
+        const n = try self.readI32();
+        return std.math.cast(usize, n) orelse error.BadMarshal;
+    }
+
+    pub fn readF64(self: *Reader) ReadError!f64 {
+        const bytes = try self.readBytes(8);
+        return @bitCast(std.mem.readInt(u64, bytes[0..8], .little));
+    }
+
+    pub fn readBytes(self: *Reader, n: usize) ReadError![]const u8 {
+        if (n > self.src.len - self.pos) return error.Truncated;
+        defer self.pos += n;
+        return self.src[self.pos..][0..n];
+    }
+
+    /// Read the base 2**15 digits of a long into a big integer
+    pub fn readLong(self: *Reader, result: *std.math.big.int.Managed) !void {
+        const n = try self.readI32();
+        const count: usize = @abs(n);
+        const digits = try self.readBytes(count * 2);
+
+        try result.set(0);
+        var i = count;
+        while (i > 0) {
+            i -= 1;
+            const digit = std.mem.readInt(u16, digits[i * 2 ..][0..2], .little);
+            if (digit > long_mask) return error.BadMarshal;
+            try result.shiftLeft(result, long_shift);
+            try result.addScalar(result, digit);
+        }
+        if (n < 0) result.negate();
+    }
+};
+
+// Tests
+test "writer int encodings" {
+    var w = Writer.init(std.testing.allocator);
+    defer w.deinit();
+
+    try w.writeInt(1);
+    try w.writeInt(1 << 40);
+    // marshal.dumps(1) == b'i\x01\x00\x00\x00'
+    // marshal.dumps(1 << 40) == b'l\x03\x00\x00\x00\x00\x00\x00\x00\x00\x04'
+    try std.testing.expectEqualSlices(u8, "i\x01\x00\x00\x00l\x03\x00\x00\x00\x00\x00\x00\x00\x00\x04", w.out.items);
+}
+
+test "big int round trip" {
+    const allocator = std.testing.allocator;
+    var value = try std.math.big.int.Managed.init(allocator);
+    defer value.deinit();
+    try value.setString(10, "-123456789012345678901234567890");
+
+    var w = Writer.init(allocator);
+    defer w.deinit();
+    try w.writeBigInt(value.toConst());
+
+    var r = Reader{ .src = w.out.items };
+    try std.testing.expectEqual(@as(u8, Type.long), try r.readByte());
+    var back = try std.math.big.int.Managed.init(allocator);
+    defer back.deinit();
+    try r.readLong(&back);
+    try std.testing.expect(back.toConst().eql(value.toConst()));
+}
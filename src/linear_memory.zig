@@ -0,0 +1,313 @@
+// Linear Memory Reservation
+//
+// zware keeps a guest's linear memory in an ArrayList, so a memory.grow
+// past the list's capacity allocates a bigger buffer and copies the whole
+// memory into it: a heap of hundreds of MB pays for large copies and
+// briefly needs twice its size. A Reservation maps address space for the
+// memory's maximum size once, inaccessible, and takes over as the list's
+// allocator. Growing then makes more of the mapping accessible with
+// mprotect, in place: nothing is copied, and the memory never moves.
+// Pages take physical memory only once the guest writes them.
+//
+// Past the accessible part, the rest of the mapping and a guard region
+// after it stay inaccessible, so a stray access beyond the memory faults
+// instead of landing in other host memory.
+//
+// Each growth is counted and, with debug set, logged; stats() gives the
+// numbers for capacity planning.
+//
+// A reservation can also checkpoint the memory and later reset it to the
+// checkpoint (Linux only). The checkpoint is written to a memfd once and
+// mapped copy-on-write over the memory at the same address, so the kernel
+// keeps track of the pages written since: they are the mapping's private
+// copies. Resetting drops them with madvise(DONTNEED), and their next
+// access reads the checkpoint's content again. Pages grown past the
+// checkpoint are dropped the same way and the memory is shrunk back. A
+// reset costs time in proportion to the pages the guest touched, not to
+// the size of the memory.
+
+const std = @import("std");
+const builtin = @import("builtin");
+const zware = @import("zware");
+const Allocator = std.mem.Allocator;
+
+/// Inaccessible bytes kept after the usable part of a reservation
+pub const guard_size = 64 * 1024;
+
+/// zware's limit for a memory that declares no maximum
+const max_memory_bytes = 4 * 1024 * 1024 * 1024;
+
+pub const Stats = struct {
+    /// Largest size the memory has had (only reset() shrinks it)
+    memory_bytes: usize,
+    /// Address space reserved for the memory, guard excluded
+    reserved_bytes: usize,
+    /// Accessible bytes: the memory and the list's spare capacity
+    committed_bytes: usize,
+    /// Times the accessible part was extended
+    grows: u64,
+    /// Size of the memory at the checkpoint; 0 without one
+    checkpoint_bytes: usize,
+    resets: u64,
+};
+
+pub const Reservation = struct {
+    /// Allocator for anything that is not the memory itself
+    backing: Allocator,
+    /// The whole mapping, guard included
+    region: []align(std.heap.page_size_min) u8,
+    /// Bytes of the region that may be made accessible
+    usable: usize,
+    committed: usize = 0,
+    grows: u64 = 0,
+    debug: bool,
+    /// The memory installed in the reservation
+    mem: ?*zware.Memory = null,
+    /// memfd holding the checkpoint, and the memory's size then
+    golden_fd: ?std.posix.fd_t = null,
+    golden_len: usize = 0,
+    resets: u64 = 0,
+    /// Largest size of the memory before a reset
+    high_water: usize = 0,
+
+    /// Reserve address space for a memory of up to max_bytes
+    pub fn init(backing: Allocator, max_bytes: usize, debug: bool) !*Reservation {
+        if (builtin.os.tag == .windows) return error.Unsupported;
+
+        // ArrayList grows its capacity by half again, so the last growth
+        // before max_bytes can ask for up to 1.5 times as much
+        const usable = std.mem.alignForward(usize, max_bytes * 2, std.heap.pageSize());
+        const region = try std.posix.mmap(
+            null,
+            usable + guard_size,
+            std.posix.PROT.NONE,
+            .{ .TYPE = .PRIVATE, .ANONYMOUS = true, .NORESERVE = true },
+            -1,
+            0,
+        );
+        errdefer std.posix.munmap(region);
+
+        const self = try backing.create(Reservation);
+        self.* = .{ .backing = backing, .region = region, .usable = usable, .debug = debug };
+        return self;
+    }
+
+    /// Unmap the reservation. Whatever it backs must be gone.
+    pub fn deinit(self: *Reservation) void {
+        if (self.golden_fd) |fd| std.posix.close(fd);
+        std.posix.munmap(self.region);
+        self.backing.destroy(self);
+    }
+
+    pub fn allocator(self: *Reservation) Allocator {
+        return .{ .ptr = self, .vtable = &vtable };
+    }
+
+    /// Move a zware memory into the reservation. It is copied this once;
+    /// from then on it grows in place.
+    pub fn install(self: *Reservation, mem: *zware.Memory) !void {
+        const len = mem.memory().len;
+        try self.commit(len);
+        @memcpy(self.region[0..len], mem.memory());
+
+        // Managed or not depends on the zware version
+        const List = @TypeOf(mem.data);
+        if (comptime @hasField(List, "allocator")) {
+            mem.data.deinit();
+            mem.data = .{ .items = self.region[0..len], .capacity = self.committed, .allocator = self.allocator() };
+        } else {
+            mem.data.deinit(mem.alloc);
+            mem.data = .{ .items = self.region[0..len], .capacity = self.committed };
+        }
+        if (comptime @hasField(@TypeOf(mem.*), "alloc")) mem.alloc = self.allocator();
+        self.mem = mem;
+        self.grows = 0;
+    }
+
+    pub fn stats(self: *const Reservation) Stats {
+        return .{
+            .memory_bytes = @max(self.high_water, if (self.mem) |mem| mem.memory().len else 0),
+            .reserved_bytes = self.usable,
+            .committed_bytes = self.committed,
+            .grows = self.grows,
+            .checkpoint_bytes = self.golden_len,
+            .resets = self.resets,
+        };
+    }
+
+    /// Remember the installed memory's content for reset(), replacing any
+    /// earlier checkpoint. Copies the memory once.
+    pub fn checkpoint(self: *Reservation) !void {
+        const mem = self.mem orelse return error.NotInstalled;
+        try self.saveGolden(mem.memory().len);
+    }
+
+    /// Return the installed memory to the last checkpoint, content and
+    /// size. The guest must not be running.
+    pub fn reset(self: *Reservation) !void {
+        const mem = self.mem orelse return error.NotInstalled;
+        if (self.golden_fd == null) return error.NoCheckpoint;
+        const len = mem.memory().len;
+        try self.restoreGolden(len);
+        self.high_water = @max(self.high_water, len);
+        // Memory grown since is gone; its capacity stays accessible, and
+        // reads as zeros, as newly grown memory must
+        mem.data.items.len = self.golden_len;
+    }
+
+    fn saveGolden(self: *Reservation, len: usize) !void {
+        if (builtin.os.tag != .linux) return error.Unsupported;
+
+        const fd = try std.posix.memfd_create("zwc-checkpoint", std.posix.MFD.CLOEXEC);
+        errdefer std.posix.close(fd);
+        try std.posix.ftruncate(fd, len);
+        const file: std.fs.File = .{ .handle = fd };
+        try file.pwriteAll(self.region[0..len], 0);
+
+        // Same address and content; from here on writes make private
+        // copies of the file's pages
+        if (len > 0) {
+            _ = try std.posix.mmap(
+                self.region.ptr,
+                len,
+                std.posix.PROT.READ | std.posix.PROT.WRITE,
+                .{ .TYPE = .PRIVATE, .FIXED = true },
+                fd,
+                0,
+            );
+        }
+
+        if (self.golden_fd) |old| std.posix.close(old);
+        self.golden_fd = fd;
+        self.golden_len = len;
+    }
+
+    /// Drop the pages written since the checkpoint, and those grown past
+    /// it, of a memory now len bytes long
+    fn restoreGolden(self: *Reservation, len: usize) !void {
+        if (self.golden_len > 0) {
+            try std.posix.madvise(self.region.ptr, self.golden_len, std.posix.MADV.DONTNEED);
+        }
+        if (len > self.golden_len) {
+            try std.posix.madvise(@alignCast(self.region.ptr + self.golden_len), self.committed - self.golden_len, std.posix.MADV.DONTNEED);
+        }
+        self.resets += 1;
+    }
+
+    /// Make the first len bytes accessible
+    fn commit(self: *Reservation, len: usize) !void {
+        if (len <= self.committed) return;
+        if (len > self.usable) return error.OutOfMemory;
+        const end = std.mem.alignForward(usize, len, std.heap.pageSize());
+        const pages: []align(std.heap.page_size_min) u8 = @alignCast(self.region[self.committed..end]);
+        try std.posix.mprotect(pages, std.posix.PROT.READ | std.posix.PROT.WRITE);
+        if (self.debug) {
+            std.debug.print("Guest memory grew in place: {} KB -> {} KB accessible\n", .{ self.committed / 1024, end / 1024 });
+        }
+        self.committed = end;
+        self.grows += 1;
+    }
+
+    fn owns(self: *const Reservation, memory: []u8) bool {
+        return memory.ptr == self.region.ptr;
+    }
+
+    const vtable: Allocator.VTable = .{
+        .alloc = alloc,
+        .resize = resize,
+        .remap = remap,
+        .free = free,
+    };
+
+    fn alloc(context: *anyopaque, len: usize, alignment: std.mem.Alignment, ret_addr: usize) ?[*]u8 {
+        const self: *Reservation = @ptrCast(@alignCast(context));
+        return self.backing.rawAlloc(len, alignment, ret_addr);
+    }
+
+    fn resize(context: *anyopaque, memory: []u8, alignment: std.mem.Alignment, new_len: usize, ret_addr: usize) bool {
+        const self: *Reservation = @ptrCast(@alignCast(context));
+        if (!self.owns(memory)) return self.backing.rawResize(memory, alignment, new_len, ret_addr);
+        self.commit(new_len) catch return false;
+        return true;
+    }
+
+    fn remap(context: *anyopaque, memory: []u8, alignment: std.mem.Alignment, new_len: usize, ret_addr: usize) ?[*]u8 {
+        const self: *Reservation = @ptrCast(@alignCast(context));
+        if (!self.owns(memory)) return self.backing.rawRemap(memory, alignment, new_len, ret_addr);
+        self.commit(new_len) catch return null;
+        return memory.ptr;
+    }
+
+    fn free(context: *anyopaque, memory: []u8, alignment: std.mem.Alignment, ret_addr: usize) void {
+        const self: *Reservation = @ptrCast(@alignCast(context));
+        // The memory's pages go with the mapping in deinit
+        if (self.owns(memory)) return;
+        self.backing.rawFree(memory, alignment, ret_addr);
+    }
+};
+
+/// Reserve space for mem's declared maximum and move it there
+pub fn reserve(backing: Allocator, mem: *zware.Memory, debug: bool) !*Reservation {
+    const max_bytes: usize = if (mem.max) |pages| @as(usize, pages) * 64 * 1024 else max_memory_bytes;
+    const reservation = try Reservation.init(backing, max_bytes, debug);
+    errdefer reservation.deinit();
+    try reservation.install(mem);
+    return reservation;
+}
+
+test "linear memory reservation" {
+    const reservation = try Reservation.init(std.testing.allocator, 1024 * 1024, false);
+    defer reservation.deinit();
+    const gpa = reservation.allocator();
+
+    // Stands in for zware's memory
+    try reservation.commit(64 * 1024);
+    var list: std.ArrayListUnmanaged(u8) = .{ .items = reservation.region[0 .. 64 * 1024], .capacity = reservation.committed };
+    list.items[0] = 42;
+
+    // Growing extends the mapping in place
+    try list.resize(gpa, 640 * 1024);
+    try std.testing.expectEqual(@intFromPtr(reservation.region.ptr), @intFromPtr(list.items.ptr));
+    try std.testing.expectEqual(@as(u8, 42), list.items[0]);
+    list.items[640 * 1024 - 1] = 1;
+    try std.testing.expect(reservation.stats().committed_bytes >= 640 * 1024);
+    try std.testing.expectEqual(@as(u64, 2), reservation.stats().grows);
+
+    // Beyond the reservation growing fails instead of moving
+    try std.testing.expect(!gpa.resize(list.allocatedSlice(), reservation.usable + 1));
+
+    // Other allocations pass through
+    const other = try gpa.alloc(u8, 100);
+    gpa.free(other);
+    list.deinit(gpa);
+}
+
+test "linear memory checkpoint" {
+    if (builtin.os.tag != .linux) return error.SkipZigTest;
+
+    const reservation = try Reservation.init(std.testing.allocator, 1024 * 1024, false);
+    defer reservation.deinit();
+    const memory = reservation.region;
+
+    try reservation.commit(128 * 1024);
+    memory[0] = 1;
+    memory[100_000] = 2;
+    try reservation.saveGolden(128 * 1024);
+    try std.testing.expectEqual(@as(u8, 2), memory[100_000]);
+
+    // Written and grown pages go back to the checkpoint
+    memory[0] = 3;
+    memory[70_000] = 4;
+    try reservation.commit(192 * 1024);
+    memory[150_000] = 5;
+    try reservation.restoreGolden(192 * 1024);
+    try std.testing.expectEqual(@as(u8, 1), memory[0]);
+    try std.testing.expectEqual(@as(u8, 0), memory[70_000]);
+    try std.testing.expectEqual(@as(u8, 2), memory[100_000]);
+    try std.testing.expectEqual(@as(u8, 0), memory[150_000]);
+
+    // Untouched since the last reset: nothing to restore
+    try reservation.restoreGolden(128 * 1024);
+    try std.testing.expectEqual(@as(u8, 1), memory[0]);
+    try std.testing.expectEqual(@as(u64, 2), reservation.stats().resets);
+}
@@ -14,33 +14,12 @@
 //   3. From real filesystem via mount points
 
 const std = @import("std");
-const zware = @import("zware");
-const builtin = @import("builtin");
 
-// VFS module for in-memory filesystem
-const vfs_mod = @import("vfs/vfs.zig");
-const VirtualFileSystem = vfs_mod.VirtualFileSystem;
-const WasiVfsHooks = vfs_mod.WasiVfsHooks;
-const VFS_PREFIX = @import("vfs/filesystem.zig").VFS_PREFIX;
-
-// WASI handlers module
-const wasi_handlers = @import("wasi/handlers.zig");
-
-// Socket module
-const socket_handlers = @import("sockets/socket_handlers.zig");
-
-// Python modules
-const python_env = @import("python/environment.zig");
-const stdlib_loader = @import("python/stdlib_loader.zig");
-
-// Debug logging - only prints in debug builds
-const debug_enabled = builtin.mode == .Debug;
-
-fn debug_print(comptime fmt: []const u8, args: anytype) void {
-    if (debug_enabled) {
-        std.debug.print(fmt, args);
-    }
-}
+const runtime_mod = @import("runtime.zig");
+const Runtime = runtime_mod.Runtime;
+const Pool = @import("pool.zig").Pool;
+const server = @import("server.zig");
+const pipeline = @import("pipeline.zig");
 
 pub fn main() !void {
     const alloc = std.heap.page_allocator;
@@ -53,18 +32,150 @@ pub fn main() !void {
     _ = args.skip(); // Skip program name
 
     var script_path: ?[]const u8 = null;
+    var serve_path: ?[]const u8 = null;
+    var workers: usize = 1;
+    var vfs_max_bytes: ?u64 = null;
+    var pycache_path: ?[]const u8 = null;
+    var manifest_path: ?[]const u8 = null;
+    var python_lib_path: []const u8 = runtime_mod.default_python_lib_path;
+    var compiled_libs_path: []const u8 = runtime_mod.default_compiled_libs_path;
+    var pipeline_target: ?[]const u8 = null;
+    var pipeline_input: ?[]const u8 = null;
+    var pipeline_options: pipeline.Options = .{};
+    var deadline: runtime_mod.Limits = .{};
+    var reserve_memory = false;
+    var persist: std.ArrayListUnmanaged(runtime_mod.PersistentDir) = .empty;
+    defer persist.deinit(alloc);
     while (args.next()) |arg| {
         if (std.mem.eql(u8, arg, "--script") or std.mem.eql(u8, arg, "-s")) {
             script_path = args.next() orelse {
                 std.debug.print("Error: --script requires a file path argument\n", .{});
                 std.process.exit(1);
             };
+        } else if (std.mem.eql(u8, arg, "--serve")) {
+            serve_path = args.next() orelse {
+                std.debug.print("Error: --serve requires a socket path argument\n", .{});
+                std.process.exit(1);
+            };
+        } else if (std.mem.eql(u8, arg, "--workers")) {
+            const count = args.next() orelse {
+                std.debug.print("Error: --workers requires a count argument\n", .{});
+                std.process.exit(1);
+            };
+            workers = std.fmt.parseInt(usize, count, 10) catch {
+                std.debug.print("Error: Invalid worker count: {s}\n", .{count});
+                std.process.exit(1);
+            };
+        } else if (std.mem.eql(u8, arg, "--vfs-quota")) {
+            const bytes = args.next() orelse {
+                std.debug.print("Error: --vfs-quota requires a byte count argument\n", .{});
+                std.process.exit(1);
+            };
+            vfs_max_bytes = std.fmt.parseInt(u64, bytes, 10) catch {
+                std.debug.print("Error: Invalid byte count: {s}\n", .{bytes});
+                std.process.exit(1);
+            };
+        } else if (std.mem.eql(u8, arg, "--pycache")) {
+            pycache_path = args.next() orelse {
+                std.debug.print("Error: --pycache requires a directory argument\n", .{});
+                std.process.exit(1);
+            };
+        } else if (std.mem.eql(u8, arg, "--pipeline")) {
+            pipeline_target = args.next() orelse {
+                std.debug.print("Error: --pipeline requires a module:function argument\n", .{});
+                std.process.exit(1);
+            };
+        } else if (std.mem.eql(u8, arg, "--input")) {
+            pipeline_input = args.next() orelse {
+                std.debug.print("Error: --input requires a file path argument\n", .{});
+                std.process.exit(1);
+            };
+        } else if (std.mem.eql(u8, arg, "--format")) {
+            const format = args.next() orelse {
+                std.debug.print("Error: --format requires lines or length\n", .{});
+                std.process.exit(1);
+            };
+            pipeline_options.format = std.meta.stringToEnum(pipeline.Format, format) orelse {
+                std.debug.print("Error: Invalid format (expected lines or length): {s}\n", .{format});
+                std.process.exit(1);
+            };
+        } else if (std.mem.eql(u8, arg, "--batch-size")) {
+            const count = args.next() orelse {
+                std.debug.print("Error: --batch-size requires a record count argument\n", .{});
+                std.process.exit(1);
+            };
+            pipeline_options.batch_records = std.fmt.parseInt(usize, count, 10) catch 0;
+            if (pipeline_options.batch_records == 0) {
+                std.debug.print("Error: Invalid batch size: {s}\n", .{count});
+                std.process.exit(1);
+            }
+        } else if (std.mem.eql(u8, arg, "--timeout") or std.mem.eql(u8, arg, "--cpu-timeout")) {
+            const ms = args.next() orelse {
+                std.debug.print("Error: {s} requires a millisecond count argument\n", .{arg});
+                std.process.exit(1);
+            };
+            const limit = std.fmt.parseInt(u32, ms, 10) catch {
+                std.debug.print("Error: Invalid millisecond count: {s}\n", .{ms});
+                std.process.exit(1);
+            };
+            if (std.mem.eql(u8, arg, "--timeout")) deadline.wall_ms = limit else deadline.cpu_ms = limit;
+        } else if (std.mem.eql(u8, arg, "--reserve-memory")) {
+            reserve_memory = true;
+        } else if (std.mem.eql(u8, arg, "--manifest")) {
+            manifest_path = args.next() orelse {
+                std.debug.print("Error: --manifest requires a file path argument\n", .{});
+                std.process.exit(1);
+            };
+        } else if (std.mem.eql(u8, arg, "--python-lib")) {
+            python_lib_path = hostPath(alloc, args.next() orelse {
+                std.debug.print("Error: --python-lib requires a directory argument\n", .{});
+                std.process.exit(1);
+            });
+        } else if (std.mem.eql(u8, arg, "--compiled-libs")) {
+            compiled_libs_path = hostPath(alloc, args.next() orelse {
+                std.debug.print("Error: --compiled-libs requires a directory argument\n", .{});
+                std.process.exit(1);
+            });
+        } else if (std.mem.eql(u8, arg, "--persist")) {
+            const spec = args.next() orelse {
+                std.debug.print("Error: --persist requires a <vfs-dir>=<host-dir> argument\n", .{});
+                std.process.exit(1);
+            };
+            const eq = std.mem.indexOfScalar(u8, spec, '=') orelse {
+                std.debug.print("Error: Invalid --persist argument (expected <vfs-dir>=<host-dir>): {s}\n", .{spec});
+                std.process.exit(1);
+            };
+            try persist.append(alloc, .{ .guest_path = spec[0..eq], .host_path = spec[eq + 1 ..] });
         } else if (std.mem.eql(u8, arg, "--help") or std.mem.eql(u8, arg, "-h")) {
             std.debug.print(
                 \\Usage: zig_wasm_cpython [options]
                 \\
                 \\Options:
                 \\  --script, -s <path>    Run a Python script from the host filesystem
+                \\  --serve <socket>       Serve jobs over a Unix socket (see src/server.zig)
+                \\  --workers <n>          Interpreters serving jobs in parallel (0 = one per CPU)
+                \\  --vfs-quota <bytes>    Limit file data a script can write to its VFS
+                \\  --pycache <dir>        Cache compiled bytecode, including the --script, in a
+                \\                         host directory across runs (off by default)
+                \\  --persist <vfs>=<host> Keep a VFS directory (e.g. /cache) in a host directory
+                \\                         across runs; may be repeated
+                \\  --pipeline <mod:func>  Call a function on every record of the input, writing
+                \\                         its results to stdout (after running --script, whose
+                \\                         functions are __main__:name)
+                \\  --input <path>         Pipeline input (default: stdin)
+                \\  --format <fmt>         Pipeline records: lines (default) or length (u32 LE
+                \\                         length prefixed)
+                \\  --batch-size <n>       Records per guest call (default 1024)
+                \\  --timeout <ms>         Interrupt the script, or a pipeline batch, after this
+                \\                         much wall time
+                \\  --cpu-timeout <ms>     ...or after this much CPU time (Linux)
+                \\  --reserve-memory       Reserve address space for guest memory up front, so it
+                \\                         grows without copying; reports its size at exit
+                \\  --manifest <file>      Load only the libraries this JSON manifest declares
+                \\                         (default: every library in compiled_libs/)
+                \\  --python-lib <dir>     CPython Lib/ directory
+                \\  --compiled-libs <dir>  Directory compile_library.py wrote the libraries to
+                \\                         (relative defaults resolve against the executable)
                 \\  --help, -h             Show this help message
                 \\
                 \\If no script is specified, runs the embedded test script.
@@ -79,249 +190,131 @@ pub fn main() !void {
     }
 
     // ========================================================================
-    // Initialize VFS for in-memory Python scripts
+    // Serve on a worker pool: one shared image, one interpreter per thread
     // ========================================================================
 
-    var vfs = try VirtualFileSystem.init(alloc);
-    defer vfs.deinit();
-
-    if (debug_enabled) {
-        vfs.setDebug(true);
-    }
-
-    // Add VFS root preopen - all VFS content goes under /vfs/
-    const vfs_preopen_fd = try vfs.addPreopen("/");
-    debug_print("VFS preopen created at fd={}\n", .{vfs_preopen_fd});
-
-    // Load Python standard library into VFS
-    const python_lib_path = "/mnt/c/Users/nimbl/Repos_and_Code/cpython-wasi/Lib";
-    try stdlib_loader.loadStdlib(vfs, "/usr/local/lib/python3.13", python_lib_path, alloc);
-
-    // Load ALL compiled bytecode libraries into VFS from compiled_libs/
-    const compiled_libs_base = "/mnt/c/Users/nimbl/Repos_and_Code/zig-wasm-cpython/compiled_libs";
-    debug_print("Loading compiled bytecode libraries from: {s}\n", .{compiled_libs_base});
-
-    // Load impacket
-    const impacket_path = compiled_libs_base ++ "/impacket";
-    try stdlib_loader.loadBytecodeLibrary(vfs, "/usr/local/lib/python3.13/site-packages/impacket", impacket_path, alloc);
-    debug_print("Loaded impacket bytecode library\n", .{});
-
-    // Load mylib (example library)
-    const mylib_path = compiled_libs_base ++ "/mylib";
-    try stdlib_loader.loadBytecodeLibrary(vfs, "/usr/local/lib/python3.13/site-packages/mylib", mylib_path, alloc);
-    debug_print("Loaded mylib bytecode library\n", .{});
-
-    // Load requests and dependencies
-    const requests_path = compiled_libs_base ++ "/requests";
-    try stdlib_loader.loadBytecodeLibrary(vfs, "/usr/local/lib/python3.13/site-packages/requests", requests_path, alloc);
-    debug_print("Loaded requests bytecode library\n", .{});
-
-    const urllib3_path = compiled_libs_base ++ "/urllib3";
-    try stdlib_loader.loadBytecodeLibrary(vfs, "/usr/local/lib/python3.13/site-packages/urllib3", urllib3_path, alloc);
-    debug_print("Loaded urllib3 bytecode library\n", .{});
-
-    const charset_normalizer_path = compiled_libs_base ++ "/charset_normalizer";
-    try stdlib_loader.loadBytecodeLibrary(vfs, "/usr/local/lib/python3.13/site-packages/charset_normalizer", charset_normalizer_path, alloc);
-    debug_print("Loaded charset_normalizer bytecode library\n", .{});
-
-    const idna_path = compiled_libs_base ++ "/idna";
-    try stdlib_loader.loadBytecodeLibrary(vfs, "/usr/local/lib/python3.13/site-packages/idna", idna_path, alloc);
-    debug_print("Loaded idna bytecode library\n", .{});
-
-    const certifi_path = compiled_libs_base ++ "/certifi";
-    try stdlib_loader.loadBytecodeLibrary(vfs, "/usr/local/lib/python3.13/site-packages/certifi", certifi_path, alloc);
-    debug_print("Loaded certifi bytecode library\n", .{});
-
-    // Load wasisocket Python wrapper module
-    const wrapper_script = @embedFile("python_extensions/wasisocket/wasisocket.py");
-    try vfs.createFile("/usr/local/lib/python3.13/wasisocket.py", wrapper_script);
-    debug_print("Created wasisocket.py wrapper at /vfs/usr/local/lib/python3.13/wasisocket.py\n", .{});
-
-    // Load monkey patches (required for host function interop)
-    const socket_patch = @embedFile("python/monkey_patches/socket_patch.py");
-    try vfs.createFile("/socket_patch.py", socket_patch);
-    debug_print("Loaded socket_patch.py\n", .{});
-
-    // Load zlib stub (zlib not available in WASM)
-    const zlib_stub = @embedFile("python/monkey_patches/zlib_stub.py");
-    try vfs.createFile("/usr/local/lib/python3.13/zlib.py", zlib_stub);
-    debug_print("Loaded zlib stub\n", .{});
-
-    // Load Python script into VFS
-    if (script_path) |path| {
-        // Load script from host filesystem
-        const script_content = std.fs.cwd().readFileAlloc(alloc, path, 10 * 1024 * 1024) catch |err| {
-            std.debug.print("Error: Failed to read script file '{s}': {}\n", .{ path, err });
+    if (serve_path != null and workers != 1) {
+        if (persist.items.len > 0) {
+            std.debug.print("Error: --persist needs a single interpreter (--workers 1)\n", .{});
             std.process.exit(1);
-        };
-        defer alloc.free(script_content);
-        try vfs.createFile("/script.py", script_content);
-        debug_print("Loaded script from {s} into /vfs/script.py\n", .{path});
-    } else {
-        // Load default test script from embedded file
-        const test_script = "print('No script specified. Use --script to run a Python script.')";
-        try vfs.createFile("/script.py", test_script);
-        debug_print("No script specified, using default message\n", .{});
+        }
+        const image = try runtime_mod.Image.init(alloc, .{
+            .python_lib_path = python_lib_path,
+            .compiled_libs_path = compiled_libs_path,
+            .manifest_path = manifest_path,
+        });
+        defer image.deinit();
+        const pool = try Pool.init(alloc, image, .{
+            .workers = workers,
+            .vfs_limits = .{ .max_bytes = vfs_max_bytes },
+            .pycache_path = pycache_path,
+            .reserve_memory = reserve_memory,
+        });
+        defer pool.deinit();
+        return server.servePool(pool, alloc, serve_path.?);
     }
 
-    // Create WASI hooks backed by VFS
-    var vfs_hooks = WasiVfsHooks.init(vfs);
-    vfs_hooks.setDebug(debug_enabled);
-
-    // Set global VFS for WASI handlers
-    wasi_handlers.setVfs(vfs, &vfs_hooks);
-    defer wasi_handlers.clearVfs();
-
     // ========================================================================
-    // Load Python WASM and initialize zware
+    // Start the runtime (VFS, host functions, interpreter, monkey patches)
     // ========================================================================
 
-    const python_bytes = @embedFile("./python/python-wasi.wasm");
-
-    var store = zware.Store.init(alloc);
-    defer store.deinit();
-    try wasi_handlers.addWasiImports(&store);
-
-    // Initialize socket system
-    try socket_handlers.init(alloc);
-    defer socket_handlers.deinit(alloc);
-    try socket_handlers.registerSocketFunctions(&store);
-    debug_print("Socket system initialized and functions registered\n", .{});
-
-    var module = zware.Module.init(alloc, python_bytes);
-    defer module.deinit();
-    try module.decode();
-
-    var instance = zware.Instance.init(alloc, &store, module);
-    defer instance.deinit();
-    try instance.instantiate();
-
-    // ========================================================================
-    // Set up filesystem preopens
-    // ========================================================================
-
-    // Register VFS preopen with zware instance
-    // The VFS preopen was already created (vfs_preopen_fd), now tell zware about it
-    try instance.addWasiPreopen(@intCast(vfs_preopen_fd), VFS_PREFIX, 0);
-    debug_print("Added preopen: fd={}, path={s} (VFS-backed)\n", .{ vfs_preopen_fd, VFS_PREFIX });
-
-    // ========================================================================
-    // Configure Python environment and arguments
-    // ========================================================================
-
-    // Setup environment variables
-    const py_config = python_env.defaultConfig();
-    try python_env.setupEnvironment(&instance, py_config, alloc);
-    debug_print("Set {} environment variables\n", .{instance.wasi_env.count()});
-
-    // Setup minimal command-line arguments (required by Python initialization)
-    const cmd_config = python_env.CommandConfig{
-        .mode = .interactive,
-        .args = &[_][]const u8{},
+    const runtime = try Runtime.init(alloc, .{
+        .python_lib_path = python_lib_path,
+        .compiled_libs_path = compiled_libs_path,
+        .manifest_path = manifest_path,
+        .vfs_limits = .{ .max_bytes = vfs_max_bytes },
+        .persist = persist.items,
+        .pycache_path = pycache_path,
+        .deadline = deadline,
+        .reserve_memory = reserve_memory,
+    }) catch |err| switch (err) {
+        error.DeadlinesUnavailable => {
+            std.debug.print("Error: --timeout and --cpu-timeout need an interpreter built with _hostcall's hostcall_interrupt (and Linux for CPU time)\n", .{});
+            std.process.exit(1);
+        },
+        else => return err,
     };
-    try python_env.setupArguments(&instance, cmd_config, alloc);
-    debug_print("Set argv: python\n", .{});
-
-    // ========================================================================
-    // Initialize Python using C API
-    // ========================================================================
-
-    const memory = try instance.getMemory(0);
-    const mem_data = memory.memory();
-    debug_print("Memory size: {} bytes ({} pages)\n", .{ mem_data.len, mem_data.len / 65536 });
-
-    debug_print("Initializing Python interpreter via C API...\n", .{});
+    defer runtime.deinit();
+    defer if (reserve_memory) printMemoryStats(runtime);
 
-    // Call Py_Initialize() to start the interpreter
-    var init_in = [_]u64{};
-    var init_out = [_]u64{};
-    try instance.invoke("Py_Initialize", init_in[0..], init_out[0..], .{
-        .frame_stack_size = 8192,
-        .label_stack_size = 8192,
-        .operand_stack_size = 8192,
-    });
-    debug_print("Python interpreter initialized\n", .{});
-
-    // ========================================================================
-    // Run monkey patches first
-    // ========================================================================
-
-    debug_print("Applying monkey patches...\n", .{});
+    if (serve_path) |path| {
+        return server.serve(runtime, alloc, path);
+    }
 
-    // Run socket patch
-    const socket_patch_code = "exec(open('/vfs/socket_patch.py').read())";
-    const socket_patch_ptr = try allocateString(&instance, socket_patch_code);
+    // A pipeline's stdout carries its results, so it runs only a script
+    // that was asked for
+    if (script_path != null or pipeline_target == null) {
+        // Load Python script into VFS
+        const script_content = if (script_path) |path|
+            // Load script from host filesystem
+            std.fs.cwd().readFileAlloc(alloc, path, 10 * 1024 * 1024) catch |err| {
+                std.debug.print("Error: Failed to read script file '{s}': {}\n", .{ path, err });
+                std.process.exit(1);
+            }
+        else
+            // Load default test script from embedded file
+            try alloc.dupe(u8, "print('No script specified. Use --script to run a Python script.')");
+        defer alloc.free(script_content);
 
-    var patch_in = [_]u64{socket_patch_ptr};
-    var patch_out = [_]u64{0};
-    try instance.invoke("PyRun_SimpleString", patch_in[0..], patch_out[0..], .{
-        .frame_stack_size = 8192,
-        .label_stack_size = 8192,
-        .operand_stack_size = 8192,
-    });
+        // ====================================================================
+        // Run main script
+        // ====================================================================
 
-    if (patch_out[0] != 0) {
-        debug_print("Warning: Socket patch returned error code: {}\n", .{patch_out[0]});
-    } else {
-        debug_print("Socket patch applied successfully\n", .{});
+        runtime.runScript("/script.py", script_content) catch |err| switch (err) {
+            // Python already printed the traceback
+            error.ScriptFailed => if (pipeline_target != null) std.process.exit(1),
+            error.DeadlineExceeded => {
+                std.debug.print("Error: script exceeded its deadline\n", .{});
+                std.process.exit(1);
+            },
+            else => return err,
+        };
     }
 
     // ========================================================================
-    // Run main script
+    // Stream records through a function
     // ========================================================================
 
-    debug_print("Running main script...\n", .{});
-
-    const main_script_code = "exec(open('/vfs/script.py').read())";
-    const main_script_ptr = try allocateString(&instance, main_script_code);
-
-    var main_in = [_]u64{main_script_ptr};
-    var main_out = [_]u64{0};
-    try instance.invoke("PyRun_SimpleString", main_in[0..], main_out[0..], .{
-        .frame_stack_size = 8192,
-        .label_stack_size = 8192,
-        .operand_stack_size = 8192,
-    });
+    if (pipeline_target) |target| {
+        const input = if (pipeline_input) |path| std.fs.cwd().openFile(path, .{}) catch |err| {
+            std.debug.print("Error: Failed to open input file '{s}': {}\n", .{ path, err });
+            std.process.exit(1);
+        } else std.fs.File.stdin();
+        defer if (pipeline_input != null) input.close();
 
-    if (main_out[0] != 0) {
-        debug_print("Main script returned error code: {}\n", .{main_out[0]});
-    } else {
-        debug_print("Main script completed successfully\n", .{});
+        const stats = pipeline.run(runtime, alloc, target, input, std.fs.File.stdout(), pipeline_options) catch |err| {
+            const message = if (err == error.PythonException) runtime.lastError() else @errorName(err);
+            std.debug.print("Error: pipeline failed: {s}\n", .{message});
+            std.process.exit(1);
+        };
+        std.debug.print("Pipeline: {} records, {} results in {} batches, {d:.3}s ({d:.3}s in Python)\n", .{
+            stats.records,
+            stats.results,
+            stats.batches,
+            @as(f64, @floatFromInt(stats.elapsed_ns)) / std.time.ns_per_s,
+            @as(f64, @floatFromInt(stats.guest_ns)) / std.time.ns_per_s,
+        });
     }
+}
 
-    // ========================================================================
-    // Finalize Python
-    // ========================================================================
-
-    debug_print("Finalizing Python interpreter...\n", .{});
-    var fin_in = [_]u64{};
-    var fin_out = [_]u64{};
-    try instance.invoke("Py_Finalize", fin_in[0..], fin_out[0..], .{
-        .frame_stack_size = 8192,
-        .label_stack_size = 8192,
-        .operand_stack_size = 8192,
+/// For capacity planning: how large guest memory got, and how often it grew
+fn printMemoryStats(runtime: *const Runtime) void {
+    const stats = runtime.memoryStats() orelse return;
+    std.debug.print("Guest memory: {} KB high water, {} KB accessible, {} growths in {} MB reserved, {} resets\n", .{
+        stats.memory_bytes / 1024,
+        stats.committed_bytes / 1024,
+        stats.grows,
+        stats.reserved_bytes / (1024 * 1024),
+        stats.resets,
     });
-    debug_print("Python interpreter finalized\n", .{});
 }
 
-// Helper function to allocate a string in WASM memory and return its pointer
-fn allocateString(instance: *zware.Instance, str: []const u8) !u64 {
-    const memory = try instance.getMemory(0);
-    const mem_data = memory.memory();
-
-    // Find a safe place in memory to write the string
-    // We'll use a simple approach: write at a high address
-    // In a production system, you'd want proper memory allocation
-    const offset: u32 = 1024 * 1024; // 1MB offset
-
-    if (offset + str.len >= mem_data.len) {
-        return error.OutOfMemory;
-    }
-
-    // Copy string to WASM memory
-    @memcpy(mem_data[offset..][0..str.len], str);
-    // Null-terminate
-    mem_data[offset + str.len] = 0;
-
-    return offset;
+/// A directory given on the command line, made absolute against the
+/// working directory (the runtime resolves relative paths against the
+/// executable's)
+fn hostPath(alloc: std.mem.Allocator, path: []const u8) []const u8 {
+    return std.fs.cwd().realpathAlloc(alloc, path) catch |err| {
+        std.debug.print("Error: Cannot open directory '{s}': {}\n", .{ path, err });
+        std.process.exit(1);
+    };
 }
@@ -0,0 +1,265 @@
+// Record Pipeline (--pipeline)
+//
+// Applies one Python function to every record of a stream: records are
+// read from the input, framed into a batch in the runtime's reusable
+// argument buffer, and handed to the guest dispatcher (python/pipeline.py,
+// which documents the batch layout) in one call per batch. Results are
+// written out in the input's format as each batch finishes, so memory use
+// is bounded by the batch size however long the stream is.
+//
+// Formats:
+//   lines   one record per line; the line ending ('\n' or "\r\n") is not
+//           part of the record, and each result is written as a line
+//   length  each record and result is a u32 little-endian length followed
+//           by that many bytes
+
+const std = @import("std");
+const runtime_mod = @import("runtime.zig");
+const Runtime = runtime_mod.Runtime;
+
+/// Records larger than this are refused
+pub const max_record_len = 64 * 1024 * 1024;
+
+/// Marks a record the function returned None for (see python/pipeline.py)
+const no_result = 0xFFFF_FFFF;
+
+pub const Format = enum { lines, length };
+
+pub const Options = struct {
+    format: Format = .lines,
+    /// A batch is sent once it holds this many records...
+    batch_records: usize = 1024,
+    /// ...or this many bytes of them
+    batch_bytes: usize = 4 * 1024 * 1024,
+};
+
+pub const Stats = struct {
+    records: u64 = 0,
+    results: u64 = 0,
+    batches: u64 = 0,
+    /// Time spent in the guest, out of the whole run
+    guest_ns: u64 = 0,
+    elapsed_ns: u64 = 0,
+};
+
+/// Call target ("package.module:function") on every record read from
+/// input, writing the results to output
+pub fn run(
+    runtime: *Runtime,
+    allocator: std.mem.Allocator,
+    target: []const u8,
+    input: std.fs.File,
+    output: std.fs.File,
+    options: Options,
+) !Stats {
+    const dispatcher = try runtime.compile(@embedFile("python/pipeline.py"), "run");
+    defer runtime.release(dispatcher);
+
+    var timer = try std.time.Timer.start();
+    var stats: Stats = .{};
+    var reader: RecordReader = .{ .file = input, .format = options.format };
+    defer reader.deinit(allocator);
+
+    // Reused by every batch: the payload, and the results being written
+    var batch: std.ArrayListUnmanaged(u8) = .empty;
+    defer batch.deinit(allocator);
+    var out: std.ArrayListUnmanaged(u8) = .empty;
+    defer out.deinit(allocator);
+
+    var done = false;
+    while (!done) {
+        // Header: target, then the record count once it is known
+        batch.clearRetainingCapacity();
+        try appendU32(&batch, allocator, @intCast(target.len));
+        try batch.appendSlice(allocator, target);
+        const count_offset = batch.items.len;
+        try appendU32(&batch, allocator, 0);
+        const header_len = batch.items.len;
+
+        var count: u32 = 0;
+        while (count < options.batch_records and batch.items.len - header_len < options.batch_bytes) {
+            const record = try reader.next(allocator) orelse {
+                done = true;
+                break;
+            };
+            try appendU32(&batch, allocator, @intCast(record.len));
+            try batch.appendSlice(allocator, record);
+            count += 1;
+        }
+        if (count == 0) break;
+        std.mem.writeInt(u32, batch.items[count_offset..][0..4], count, .little);
+
+        const guest_start = timer.read();
+        const results = try runtime.call(dispatcher, batch.items, allocator);
+        defer allocator.free(results);
+        stats.guest_ns += timer.read() - guest_start;
+
+        out.clearRetainingCapacity();
+        stats.results += try frameResults(&out, allocator, results, count, options.format);
+        try output.writeAll(out.items);
+
+        stats.records += count;
+        stats.batches += 1;
+    }
+
+    stats.elapsed_ns = timer.read();
+    return stats;
+}
+
+/// Write a batch's results to out in format; returns how many there were
+fn frameResults(out: *std.ArrayListUnmanaged(u8), allocator: std.mem.Allocator, results: []const u8, count: u32, format: Format) !u64 {
+    var written: u64 = 0;
+    var offset: usize = 0;
+    for (0..count) |_| {
+        if (results.len - offset < 4) return error.MalformedReply;
+        const len = std.mem.readInt(u32, results[offset..][0..4], .little);
+        offset += 4;
+        if (len == no_result) continue;
+        if (results.len - offset < len) return error.MalformedReply;
+        const result = results[offset..][0..len];
+        offset += len;
+
+        switch (format) {
+            .lines => {
+                try out.appendSlice(allocator, result);
+                try out.append(allocator, '\n');
+            },
+            .length => {
+                try appendU32(out, allocator, len);
+                try out.appendSlice(allocator, result);
+            },
+        }
+        written += 1;
+    }
+    if (offset != results.len) return error.MalformedReply;
+    return written;
+}
+
+fn appendU32(list: *std.ArrayListUnmanaged(u8), allocator: std.mem.Allocator, value: u32) !void {
+    var bytes: [4]u8 = undefined;
+    std.mem.writeInt(u32, &bytes, value, .little);
+    try list.appendSlice(allocator, &bytes);
+}
+
+/// Splits a file into records, reading it in large chunks
+const RecordReader = struct {
+    file: std.fs.File,
+    format: Format,
+    buf: std.ArrayListUnmanaged(u8) = .empty,
+    /// Start of the bytes in buf not yet returned
+    pos: usize = 0,
+    eof: bool = false,
+
+    const chunk_size = 256 * 1024;
+
+    fn deinit(self: *RecordReader, allocator: std.mem.Allocator) void {
+        self.buf.deinit(allocator);
+    }
+
+    /// The next record, valid until the next call; null at the end
+    fn next(self: *RecordReader, allocator: std.mem.Allocator) !?[]const u8 {
+        switch (self.format) {
+            .lines => {
+                var scanned: usize = 0;
+                while (true) {
+                    const pending = self.buf.items[self.pos..];
+                    if (std.mem.indexOfScalarPos(u8, pending, scanned, '\n')) |end| {
+                        self.pos += end + 1;
+                        return std.mem.trimEnd(u8, pending[0..end], "\r");
+                    }
+                    scanned = pending.len;
+                    if (!try self.fill(allocator)) {
+                        // A last line without a line ending
+                        if (self.pos == self.buf.items.len) return null;
+                        const record = self.buf.items[self.pos..];
+                        self.pos = self.buf.items.len;
+                        return std.mem.trimEnd(u8, record, "\r");
+                    }
+                }
+            },
+            .length => {
+                if (!try self.want(allocator, 4)) {
+                    if (self.pos == self.buf.items.len) return null;
+                    return error.TruncatedRecord;
+                }
+                const len = std.mem.readInt(u32, self.buf.items[self.pos..][0..4], .little);
+                if (len > max_record_len) return error.RecordTooLong;
+                if (!try self.want(allocator, 4 + len)) return error.TruncatedRecord;
+                const record = self.buf.items[self.pos + 4 ..][0..len];
+                self.pos += 4 + len;
+                return record;
+            },
+        }
+    }
+
+    /// Read until n unreturned bytes are buffered; false if the file ends
+    /// first
+    fn want(self: *RecordReader, allocator: std.mem.Allocator, n: usize) !bool {
+        while (self.buf.items.len - self.pos < n) {
+            if (!try self.fill(allocator)) return false;
+        }
+        return true;
+    }
+
+    /// Read another chunk, first dropping the bytes already returned;
+    /// false at the end of the file
+    fn fill(self: *RecordReader, allocator: std.mem.Allocator) !bool {
+        if (self.eof) return false;
+        if (self.buf.items.len - self.pos > max_record_len) return error.RecordTooLong;
+
+        const kept = self.buf.items.len - self.pos;
+        std.mem.copyForwards(u8, self.buf.items[0..kept], self.buf.items[self.pos..]);
+        self.buf.shrinkRetainingCapacity(kept);
+        self.pos = 0;
+
+        try self.buf.ensureUnusedCapacity(allocator, chunk_size);
+        const n = try self.file.read(self.buf.unusedCapacitySlice());
+        if (n == 0) {
+            self.eof = true;
+            return false;
+        }
+        self.buf.items.len += n;
+        return true;
+    }
+};
+
+test "pipeline record reader" {
+    const allocator = std.testing.allocator;
+
+    var tmp = std.testing.tmpDir(.{});
+    defer tmp.cleanup();
+    try tmp.dir.writeFile(.{ .sub_path = "records.jsonl", .data = "{\"a\": 1}\r\n\n{\"b\": 2}" });
+    try tmp.dir.writeFile(.{ .sub_path = "records.bin", .data = "\x03\x00\x00\x00abc\x00\x00\x00\x00\x02\x00\x00" });
+
+    {
+        const file = try tmp.dir.openFile("records.jsonl", .{});
+        defer file.close();
+        var reader: RecordReader = .{ .file = file, .format = .lines };
+        defer reader.deinit(allocator);
+        try std.testing.expectEqualStrings("{\"a\": 1}", (try reader.next(allocator)).?);
+        try std.testing.expectEqualStrings("", (try reader.next(allocator)).?);
+        try std.testing.expectEqualStrings("{\"b\": 2}", (try reader.next(allocator)).?);
+        try std.testing.expect(try reader.next(allocator) == null);
+    }
+
+    const file = try tmp.dir.openFile("records.bin", .{});
+    defer file.close();
+    var reader: RecordReader = .{ .file = file, .format = .length };
+    defer reader.deinit(allocator);
+    try std.testing.expectEqualStrings("abc", (try reader.next(allocator)).?);
+    try std.testing.expectEqualStrings("", (try reader.next(allocator)).?);
+    try std.testing.expectError(error.TruncatedRecord, reader.next(allocator));
+}
+
+test "pipeline result framing" {
+    const allocator = std.testing.allocator;
+
+    var out: std.ArrayListUnmanaged(u8) = .empty;
+    defer out.deinit(allocator);
+    const results = "\x02\x00\x00\x00ok\xff\xff\xff\xff\x01\x00\x00\x00!";
+    try std.testing.expectEqual(@as(u64, 2), try frameResults(&out, allocator, results, 3, .lines));
+    try std.testing.expectEqualStrings("ok\n!\n", out.items);
+
+    out.clearRetainingCapacity();
+    try std.testing.expectError(error.MalformedReply, frameResults(&out, allocator, results, 2, .length));
+}
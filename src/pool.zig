@@ -0,0 +1,299 @@
+// Worker Pool
+//
+// Runs jobs on several interpreters at once. zware instances are single
+// threaded, so each worker thread owns a Runtime created from one shared
+// Image: the decoded module, the standard library and the bytecode
+// libraries exist once per process, while every worker has its own Store,
+// Instance and an overlay VFS over the image's.
+//
+// Jobs are hostjob payloads (see python/hostjob.py), the same requests
+// --serve accepts. They go through a bounded lock-free MPMC ring; workers
+// block on a semaphore only when the ring is empty, and submitters only
+// when it is full.
+//
+//     const image = try Image.init(allocator, .{});
+//     defer image.deinit();
+//     const pool = try Pool.init(allocator, image, .{ .workers = 8 });
+//     defer pool.deinit();
+//
+//     var job = Job{ .payload = request };
+//     pool.run(&job);
+//     defer job.deinit(allocator);
+
+const std = @import("std");
+const runtime_mod = @import("runtime.zig");
+const Runtime = runtime_mod.Runtime;
+const Image = runtime_mod.Image;
+const Limits = @import("vfs/vfs.zig").Limits;
+const server = @import("server.zig");
+
+/// Jobs the ring holds before submit blocks; a power of two
+pub const queue_capacity = 1024;
+
+pub const Options = struct {
+    /// Worker threads, each with its own interpreter; 0 = one per CPU
+    workers: usize = 0,
+    debug: bool = false,
+    /// Quotas on each worker's VFS
+    vfs_limits: Limits = .{},
+    /// Host bytecode cache the workers share (see runtime.Options)
+    pycache_path: ?[]const u8 = null,
+    /// Reserve each worker's guest memory up front (see runtime.Options)
+    reserve_memory: bool = false,
+};
+
+/// A request and, once done, its outcome
+pub const Job = struct {
+    /// hostjob request payload; must stay valid until the job is done
+    payload: []const u8,
+    /// Dispatcher reply (hostjob's returned payload), owned by the pool
+    /// allocator; null when the job failed
+    reply: ?[]u8 = null,
+    /// Why the job failed: the Python exception or the error name, owned
+    /// by the pool allocator
+    failure: ?[]u8 = null,
+    /// Wall time the worker spent on the job
+    elapsed_ns: u64 = 0,
+    done: std.Thread.ResetEvent = .{},
+
+    /// Block until a worker has finished the job
+    pub fn wait(self: *Job) void {
+        self.done.wait();
+    }
+
+    /// Free the outcome; allocator is the one the pool was created with
+    pub fn deinit(self: *Job, allocator: std.mem.Allocator) void {
+        if (self.reply) |reply| allocator.free(reply);
+        if (self.failure) |failure| allocator.free(failure);
+        self.reply = null;
+        self.failure = null;
+    }
+};
+
+/// Bounded multi-producer multi-consumer ring (Vyukov). Each cell's
+/// sequence number says whether it is free for the producer at that
+/// position or full for the consumer at that position.
+const JobQueue = struct {
+    const mask = queue_capacity - 1;
+
+    const Cell = struct {
+        sequence: std.atomic.Value(usize),
+        job: *Job,
+    };
+
+    cells: [queue_capacity]Cell,
+    enqueue_pos: std.atomic.Value(usize) = .init(0),
+    dequeue_pos: std.atomic.Value(usize) = .init(0),
+
+    comptime {
+        std.debug.assert(std.math.isPowerOfTwo(queue_capacity));
+    }
+
+    fn init(self: *JobQueue) void {
+        for (&self.cells, 0..) |*cell, i| {
+            cell.* = .{ .sequence = .init(i), .job = undefined };
+        }
+        self.enqueue_pos = .init(0);
+        self.dequeue_pos = .init(0);
+    }
+
+    /// Returns false if the ring is full
+    fn push(self: *JobQueue, job: *Job) bool {
+        var pos = self.enqueue_pos.load(.monotonic);
+        const cell = while (true) {
+            const cell = &self.cells[pos & mask];
+            const seq = cell.sequence.load(.acquire);
+            const diff = @as(isize, @bitCast(seq -% pos));
+            if (diff == 0) {
+                pos = self.enqueue_pos.cmpxchgWeak(pos, pos +% 1, .monotonic, .monotonic) orelse break cell;
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = self.enqueue_pos.load(.monotonic);
+            }
+        };
+        cell.job = job;
+        cell.sequence.store(pos +% 1, .release);
+        return true;
+    }
+
+    /// Returns null if no job is ready
+    fn pop(self: *JobQueue) ?*Job {
+        var pos = self.dequeue_pos.load(.monotonic);
+        const cell = while (true) {
+            const cell = &self.cells[pos & mask];
+            const seq = cell.sequence.load(.acquire);
+            const diff = @as(isize, @bitCast(seq -% (pos +% 1)));
+            if (diff == 0) {
+                pos = self.dequeue_pos.cmpxchgWeak(pos, pos +% 1, .monotonic, .monotonic) orelse break cell;
+            } else if (diff < 0) {
+                return null;
+            } else {
+                pos = self.dequeue_pos.load(.monotonic);
+            }
+        };
+        const job = cell.job;
+        cell.sequence.store(pos +% mask +% 1, .release);
+        return job;
+    }
+};
+
+const Worker = struct {
+    pool: *Pool,
+    thread: std.Thread = undefined,
+    /// Set once the worker's runtime is up (or failed to start)
+    ready: std.Thread.ResetEvent = .{},
+    init_error: ?anyerror = null,
+};
+
+pub const Pool = struct {
+    allocator: std.mem.Allocator,
+    image: *Image,
+    instance_options: runtime_mod.InstanceOptions,
+    workers: []Worker,
+    queue: JobQueue,
+    /// Jobs in the ring
+    pending: std.Thread.Semaphore = .{},
+    /// Free cells in the ring
+    free_slots: std.Thread.Semaphore = .{ .permits = queue_capacity },
+    stopping: std.atomic.Value(bool) = .init(false),
+
+    /// Start the workers and wait until every interpreter is initialized.
+    /// allocator must be thread-safe. The workers hold references on image.
+    pub fn init(allocator: std.mem.Allocator, image: *Image, options: Options) !*Pool {
+        const count = if (options.workers != 0) options.workers else try std.Thread.getCpuCount();
+
+        const self = try allocator.create(Pool);
+        errdefer allocator.destroy(self);
+        self.* = .{
+            .allocator = allocator,
+            .image = image,
+            .instance_options = .{
+                .debug = options.debug,
+                .vfs_limits = options.vfs_limits,
+                .pycache_path = options.pycache_path,
+                .reserve_memory = options.reserve_memory,
+            },
+            .workers = try allocator.alloc(Worker, count),
+            .queue = undefined,
+        };
+        errdefer allocator.free(self.workers);
+        self.queue.init();
+
+        var started: usize = 0;
+        errdefer self.stop(started);
+        for (self.workers) |*worker| {
+            worker.* = .{ .pool = self };
+            worker.thread = try std.Thread.spawn(.{}, workerMain, .{worker});
+            started += 1;
+        }
+
+        for (self.workers) |*worker| {
+            worker.ready.wait();
+            if (worker.init_error) |err| return err;
+        }
+        return self;
+    }
+
+    /// Finish the queued jobs, then stop the workers and free the pool
+    pub fn deinit(self: *Pool) void {
+        const allocator = self.allocator;
+        self.stop(self.workers.len);
+        allocator.free(self.workers);
+        allocator.destroy(self);
+    }
+
+    /// Queue a job, blocking while the ring is full. Wait for it with
+    /// job.wait().
+    pub fn submit(self: *Pool, job: *Job) void {
+        job.done.reset();
+        self.free_slots.wait();
+        // A free slot is reserved for us, so the push cannot fail
+        while (!self.queue.push(job)) std.Thread.yield() catch {};
+        self.pending.post();
+    }
+
+    /// Queue a job and wait for it
+    pub fn run(self: *Pool, job: *Job) void {
+        self.submit(job);
+        job.wait();
+    }
+
+    fn stop(self: *Pool, started: usize) void {
+        self.stopping.store(true, .release);
+        for (0..started) |_| self.pending.post();
+        for (self.workers[0..started]) |*worker| worker.thread.join();
+    }
+
+    fn nextJob(self: *Pool) ?*Job {
+        self.pending.wait();
+
+        // A producer may have claimed an earlier cell but not filled it
+        // yet; it will shortly, so spin rather than sleep. Once stopping,
+        // a worker exits when the ring has drained.
+        const job = while (true) {
+            if (self.queue.pop()) |job| break job;
+            if (self.stopping.load(.acquire)) return null;
+            std.Thread.yield() catch {};
+        };
+        self.free_slots.post();
+        return job;
+    }
+};
+
+fn workerMain(worker: *Worker) void {
+    const pool = worker.pool;
+
+    // The runtime is created on this thread, so the thread-local VFS and
+    // handle tables the host functions use are this worker's
+    const runtime = Runtime.initWithImage(pool.allocator, pool.image, pool.instance_options) catch |err| {
+        worker.init_error = err;
+        worker.ready.set();
+        return;
+    };
+    defer runtime.deinit();
+
+    const dispatcher = runtime.compile(@embedFile("python/hostjob.py"), "run") catch |err| {
+        worker.init_error = err;
+        worker.ready.set();
+        return;
+    };
+    defer runtime.release(dispatcher);
+    server.checkpointForJobs(runtime);
+    worker.ready.set();
+
+    while (pool.nextJob()) |job| {
+        const start = std.time.nanoTimestamp();
+        if (server.runJob(runtime, dispatcher, job.payload, pool.allocator)) |reply| {
+            job.reply = reply;
+        } else |err| {
+            const message = if (err == error.PythonException) runtime.lastError() else @errorName(err);
+            job.failure = pool.allocator.dupe(u8, message) catch null;
+        }
+        job.elapsed_ns = @intCast(@max(0, std.time.nanoTimestamp() - start));
+        job.done.set();
+    }
+}
+
+test "job queue is first in, first out" {
+    const queue = try std.testing.allocator.create(JobQueue);
+    defer std.testing.allocator.destroy(queue);
+    queue.init();
+
+    var jobs: [3]Job = .{ .{ .payload = "a" }, .{ .payload = "b" }, .{ .payload = "c" } };
+    for (&jobs) |*job| try std.testing.expect(queue.push(job));
+    for (&jobs) |*job| try std.testing.expectEqual(job, queue.pop().?);
+    try std.testing.expectEqual(@as(?*Job, null), queue.pop());
+}
+
+test "job queue reports full" {
+    const queue = try std.testing.allocator.create(JobQueue);
+    defer std.testing.allocator.destroy(queue);
+    queue.init();
+
+    var job = Job{ .payload = "" };
+    for (0..queue_capacity) |_| try std.testing.expect(queue.push(&job));
+    try std.testing.expect(!queue.push(&job));
+    _ = queue.pop();
+    try std.testing.expect(queue.push(&job));
+}
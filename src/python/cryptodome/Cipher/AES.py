@@ -0,0 +1,17 @@
+"""AES in ECB, CBC and CTR mode (128 and 256-bit keys)"""
+
+from Cryptodome.Cipher._host import (
+    ALG_AES, HostCipher, check_key,
+    MODE_ECB, MODE_CBC, MODE_CFB, MODE_OFB, MODE_CTR, MODE_OPENPGP,
+    MODE_CCM, MODE_EAX, MODE_SIV, MODE_GCM, MODE_OCB,
+)
+
+block_size = 16
+# AES-192 is not available from the host
+key_size = (16, 32)
+
+
+def new(key, mode, *args, **kwargs):
+    """Create a new AES cipher"""
+    check_key(key, key_size, 'AES')
+    return HostCipher(ALG_AES, key, mode, block_size, *args, **kwargs)
@@ -0,0 +1,33 @@
+"""RC4 stream cipher"""
+
+from Cryptodome.Cipher._host import ALG_ARC4, MODE_ECB, HostCipher
+
+block_size = 1
+key_size = range(1, 256 + 1)
+
+
+class ARC4Cipher(HostCipher):
+    """RC4 keeps one keystream; encrypt and decrypt are the same operation"""
+
+    def __init__(self, key, *args, **kwargs):
+        drop = kwargs.pop('drop', 0)
+        if args or kwargs:
+            raise TypeError("Unknown parameters for ARC4")
+        if len(key) not in key_size:
+            raise ValueError("Incorrect ARC4 key length (%d bytes)" % len(key))
+        # The host ignores the mode for stream ciphers
+        super().__init__(ALG_ARC4, key, MODE_ECB, block_size)
+        self.key_size = len(key)
+        if drop:
+            self.encrypt(bytes(drop))
+
+    def encrypt(self, plaintext, output=None):
+        return self._process(False, plaintext, output)
+
+    def decrypt(self, ciphertext, output=None):
+        return self._process(False, ciphertext, output)
+
+
+def new(key, *args, **kwargs):
+    """Create a new ARC4 cipher"""
+    return ARC4Cipher(key, *args, **kwargs)
@@ -0,0 +1,15 @@
+"""Single DES in ECB, CBC and CTR mode"""
+
+from Cryptodome.Cipher._host import (
+    ALG_DES, HostCipher, check_key,
+    MODE_ECB, MODE_CBC, MODE_CFB, MODE_OFB, MODE_CTR, MODE_OPENPGP, MODE_EAX,
+)
+
+block_size = 8
+key_size = 8
+
+
+def new(key, mode, *args, **kwargs):
+    """Create a new DES cipher"""
+    check_key(key, (key_size,), 'DES')
+    return HostCipher(ALG_DES, key, mode, block_size, *args, **kwargs)
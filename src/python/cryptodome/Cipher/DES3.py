@@ -0,0 +1,26 @@
+"""Triple DES (EDE, two or three keys) in ECB, CBC and CTR mode"""
+
+from Cryptodome.Cipher._host import (
+    ALG_DES3, HostCipher, check_key,
+    MODE_ECB, MODE_CBC, MODE_CFB, MODE_OFB, MODE_CTR, MODE_OPENPGP, MODE_EAX,
+)
+
+block_size = 8
+key_size = (16, 24)
+
+
+def adjust_key_parity(key_in):
+    """Set the DES parity bit of every key byte"""
+    def parity_byte(b):
+        b &= 0xFE
+        return b | (bin(b).count('1') + 1) % 2
+
+    key_in = bytes(key_in)
+    check_key(key_in, key_size, 'TDES')
+    return bytes(parity_byte(b) for b in key_in)
+
+
+def new(key, mode, *args, **kwargs):
+    """Create a new Triple DES cipher"""
+    check_key(key, key_size, 'TDES')
+    return HostCipher(ALG_DES3, key, mode, block_size, *args, **kwargs)
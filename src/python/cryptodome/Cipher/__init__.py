@@ -0,0 +1,3 @@
+"""Symmetric ciphers backed by host functions"""
+
+__all__ = ['AES', 'ARC4', 'DES', 'DES3']
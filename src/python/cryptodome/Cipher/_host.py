@@ -0,0 +1,143 @@
+"""
+Shared cipher object for the Cryptodome.Cipher modules.
+
+Chaining state (CBC IV, CTR counter and keystream position) lives on the
+host, so encrypt()/decrypt() can be called repeatedly on pieces of a message
+exactly like PyCryptodome allows.
+"""
+
+import _hostcrypto
+
+# Host algorithm numbers (see src/crypto/cipher.zig)
+ALG_AES = 1
+ALG_DES = 2
+ALG_DES3 = 3
+ALG_ARC4 = 4
+
+# PyCryptodome mode numbers; only ECB, CBC and CTR run on the host
+MODE_ECB = 1
+MODE_CBC = 2
+MODE_CFB = 3
+MODE_OFB = 5
+MODE_CTR = 6
+MODE_OPENPGP = 7
+MODE_CCM = 8
+MODE_EAX = 9
+MODE_SIV = 10
+MODE_GCM = 11
+MODE_OCB = 12
+
+_SUPPORTED_MODES = (MODE_ECB, MODE_CBC, MODE_CTR)
+
+
+def _counter_block(block_size, kwargs):
+    """Build the initial CTR counter block from nonce/initial_value/counter"""
+    counter = kwargs.pop('counter', None)
+    if counter is not None:
+        if kwargs:
+            raise TypeError("'counter' cannot be combined with nonce or initial_value")
+        if counter.get('little_endian') or counter.get('suffix'):
+            raise ValueError("Only big-endian counters without a suffix are supported")
+        prefix = counter['prefix']
+        value = counter['initial_value'].to_bytes(counter['counter_len'], 'big')
+        block = prefix + value
+        if len(block) != block_size:
+            raise ValueError("Counter block must be %d bytes long" % block_size)
+        return block, prefix
+
+    nonce = kwargs.pop('nonce', None)
+    initial_value = kwargs.pop('initial_value', 0)
+    if nonce is None:
+        import os
+        nonce = os.urandom(block_size // 2)
+    nonce = bytes(nonce)
+    if len(nonce) >= block_size:
+        raise ValueError("Nonce is too long")
+    counter_len = block_size - len(nonce)
+    if isinstance(initial_value, (bytes, bytearray)):
+        if len(initial_value) != counter_len:
+            raise ValueError("Incorrect length for counter byte string")
+        value = bytes(initial_value)
+    else:
+        value = initial_value.to_bytes(counter_len, 'big')
+    return nonce + value, nonce
+
+
+class HostCipher:
+    """PyCryptodome-style cipher object whose state lives on the host"""
+
+    def __init__(self, algorithm, key, mode, block_size, *args, **kwargs):
+        key = bytes(key)
+        self.block_size = block_size
+        self.mode = mode
+        self._handle = None
+        self._next = ('encrypt', 'decrypt')
+
+        if algorithm == ALG_ARC4:
+            iv = b""
+        elif mode not in _SUPPORTED_MODES:
+            raise ValueError("Mode %r is not supported by the host cipher" % mode)
+        elif mode == MODE_ECB:
+            if args or kwargs:
+                raise TypeError("ECB mode takes no IV")
+            iv = b""
+        elif mode == MODE_CBC:
+            if len(args) > 1:
+                raise TypeError("Too many arguments")
+            iv = args[0] if args else kwargs.pop('iv', kwargs.pop('IV', None))
+            if kwargs:
+                raise TypeError("Unknown parameters: %s" % ', '.join(kwargs))
+            if iv is None:
+                import os
+                iv = os.urandom(block_size)
+            iv = bytes(iv)
+            if len(iv) != block_size:
+                raise ValueError("Incorrect IV length (it must be %d bytes long)" % block_size)
+            self.iv = self.IV = iv
+        else:
+            if args:
+                raise TypeError("CTR mode takes keyword arguments only")
+            iv, self.nonce = _counter_block(block_size, kwargs)
+            if kwargs:
+                raise TypeError("Unknown parameters: %s" % ', '.join(kwargs))
+
+        self._handle = _hostcrypto.cipher_new(algorithm, mode, key, iv)
+
+    def __del__(self):
+        handle = getattr(self, '_handle', None)
+        if handle is not None:
+            _hostcrypto.free(handle)
+            self._handle = None
+
+    def _check_length(self, data):
+        if self.mode in (MODE_ECB, MODE_CBC) and len(data) % self.block_size:
+            raise ValueError("Data must be aligned to block boundary in %s mode"
+                             % ('ECB' if self.mode == MODE_ECB else 'CBC'))
+
+    def _process(self, decrypt, data, output):
+        result = _hostcrypto.cipher_update(self._handle, decrypt, data)
+        if output is None:
+            return result
+        output[:] = result
+        return None
+
+    def encrypt(self, plaintext, output=None):
+        if 'encrypt' not in self._next:
+            raise TypeError("encrypt() cannot be called after decrypt()")
+        if self.mode != MODE_ECB:
+            self._next = ('encrypt',)
+        self._check_length(plaintext)
+        return self._process(False, plaintext, output)
+
+    def decrypt(self, ciphertext, output=None):
+        if 'decrypt' not in self._next:
+            raise TypeError("decrypt() cannot be called after encrypt()")
+        if self.mode != MODE_ECB:
+            self._next = ('decrypt',)
+        self._check_length(ciphertext)
+        return self._process(True, ciphertext, output)
+
+
+def check_key(key, sizes, name):
+    if len(key) not in sizes:
+        raise ValueError("Incorrect %s key length (%d bytes)" % (name, len(key)))
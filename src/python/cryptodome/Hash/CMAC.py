@@ -0,0 +1,65 @@
+"""AES-CMAC (RFC 4493)"""
+
+import hmac as _hmac
+
+import _hostcrypto
+
+from Cryptodome.Cipher import AES
+
+digest_size = 16
+
+
+class CMAC:
+    """PyCryptodome-style CMAC object; only AES is available from the host"""
+
+    digest_size = 16
+
+    def __init__(self, key, msg=None, ciphermod=None, mac_len=None):
+        if ciphermod is None:
+            raise TypeError("ciphermod must be specified (try AES)")
+        if ciphermod is not AES:
+            raise ValueError("Only AES-CMAC is supported")
+        if mac_len is None:
+            mac_len = self.digest_size
+        if not 4 <= mac_len <= self.digest_size:
+            raise ValueError("MAC tag length must be between 4 and 16 bytes")
+        self._mac_len = mac_len
+        self._handle = _hostcrypto.cmac_new(bytes(key))
+        if msg is not None:
+            self.update(msg)
+
+    def __del__(self):
+        handle = getattr(self, '_handle', None)
+        if handle is not None:
+            _hostcrypto.free(handle)
+            self._handle = None
+
+    def update(self, msg):
+        _hostcrypto.hash_update(self._handle, msg)
+        return self
+
+    def copy(self):
+        other = object.__new__(type(self))
+        other._mac_len = self._mac_len
+        other._handle = _hostcrypto.hash_copy(self._handle)
+        return other
+
+    def digest(self):
+        return _hostcrypto.hash_digest(self._handle)[:self._mac_len]
+
+    def hexdigest(self):
+        return self.digest().hex()
+
+    def verify(self, mac_tag):
+        if not _hmac.compare_digest(self.digest(), bytes(mac_tag)):
+            raise ValueError("MAC check failed")
+
+    def hexverify(self, hex_mac_tag):
+        self.verify(bytes.fromhex(hex_mac_tag))
+
+
+def new(key, msg=None, ciphermod=None, cipher_params=None, mac_len=None, update_after_digest=False):
+    """Create a new CMAC object"""
+    if cipher_params:
+        raise TypeError("cipher_params are not supported")
+    return CMAC(key, msg, ciphermod, mac_len)
@@ -0,0 +1,79 @@
+"""HMAC (RFC 2104) over the Cryptodome.Hash modules"""
+
+import hmac as _hmac
+
+import _hostcrypto
+
+from Cryptodome.Hash import MD5
+
+
+class HMAC:
+    """PyCryptodome-style HMAC object.
+
+    digestmod modules from this package run entirely on the host; any other
+    hash module or object falls back to the stdlib hmac module.
+    """
+
+    def __init__(self, key, msg=b"", digestmod=None):
+        if digestmod is None:
+            digestmod = MD5
+        self._digestmod = digestmod
+        self._handle = None
+        self._fallback = None
+
+        host_name = getattr(digestmod, '_host_name', None)
+        if host_name is None and hasattr(digestmod, '_module'):
+            host_name = getattr(digestmod._module, '_host_name', None)
+        if host_name is not None:
+            self._handle, self.digest_size, _ = _hostcrypto.hmac_new(host_name, bytes(key))
+        else:
+            self._fallback = _hmac.new(bytes(key), digestmod=lambda d=b"": digestmod.new(d))
+            self.digest_size = self._fallback.digest_size
+
+        if msg:
+            self.update(msg)
+
+    def __del__(self):
+        handle = getattr(self, '_handle', None)
+        if handle is not None:
+            _hostcrypto.free(handle)
+            self._handle = None
+
+    def update(self, msg):
+        if self._fallback is not None:
+            self._fallback.update(msg)
+        else:
+            _hostcrypto.hash_update(self._handle, msg)
+        return self
+
+    def copy(self):
+        other = object.__new__(type(self))
+        other._digestmod = self._digestmod
+        other.digest_size = self.digest_size
+        other._handle = None
+        other._fallback = None
+        if self._fallback is not None:
+            other._fallback = self._fallback.copy()
+        else:
+            other._handle = _hostcrypto.hash_copy(self._handle)
+        return other
+
+    def digest(self):
+        if self._fallback is not None:
+            return self._fallback.digest()
+        return _hostcrypto.hash_digest(self._handle)
+
+    def hexdigest(self):
+        return self.digest().hex()
+
+    def verify(self, mac_tag):
+        if not _hmac.compare_digest(self.digest(), bytes(mac_tag)):
+            raise ValueError("MAC check failed")
+
+    def hexverify(self, hex_mac_tag):
+        self.verify(bytes.fromhex(hex_mac_tag))
+
+
+def new(key, msg=b"", digestmod=None):
+    """Create a new HMAC object"""
+    return HMAC(key, msg, digestmod)
@@ -0,0 +1,15 @@
+"""MD4 message digest (RFC 1320)"""
+
+import sys
+
+from Cryptodome.Hash._host import HostHash
+
+digest_size = 16
+block_size = 64
+oid = "1.2.840.113549.2.4"
+_host_name = 'md4'
+
+
+def new(data=None):
+    """Create a new MD4 hash object"""
+    return HostHash(sys.modules[__name__], data)
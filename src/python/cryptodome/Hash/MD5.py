@@ -0,0 +1,15 @@
+"""MD5 message digest (RFC 1321)"""
+
+import sys
+
+from Cryptodome.Hash._host import HostHash
+
+digest_size = 16
+block_size = 64
+oid = "1.2.840.113549.2.5"
+_host_name = 'md5'
+
+
+def new(data=None):
+    """Create a new MD5 hash object"""
+    return HostHash(sys.modules[__name__], data)
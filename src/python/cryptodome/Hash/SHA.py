@@ -0,0 +1,3 @@
+"""Legacy alias for SHA-1"""
+
+from Cryptodome.Hash.SHA1 import digest_size, block_size, oid, new, _host_name
@@ -0,0 +1,15 @@
+"""SHA-1 (FIPS 180-4)"""
+
+import sys
+
+from Cryptodome.Hash._host import HostHash
+
+digest_size = 20
+block_size = 64
+oid = "1.3.14.3.2.26"
+_host_name = 'sha1'
+
+
+def new(data=None):
+    """Create a new SHA-1 hash object"""
+    return HostHash(sys.modules[__name__], data)
@@ -0,0 +1,15 @@
+"""SHA-256 (FIPS 180-4)"""
+
+import sys
+
+from Cryptodome.Hash._host import HostHash
+
+digest_size = 32
+block_size = 64
+oid = "2.16.840.1.101.3.4.2.1"
+_host_name = 'sha256'
+
+
+def new(data=None):
+    """Create a new SHA-256 hash object"""
+    return HostHash(sys.modules[__name__], data)
@@ -0,0 +1,15 @@
+"""SHA-384 (FIPS 180-4)"""
+
+import sys
+
+from Cryptodome.Hash._host import HostHash
+
+digest_size = 48
+block_size = 128
+oid = "2.16.840.1.101.3.4.2.2"
+_host_name = 'sha384'
+
+
+def new(data=None):
+    """Create a new SHA-384 hash object"""
+    return HostHash(sys.modules[__name__], data)
@@ -0,0 +1,15 @@
+"""SHA-512 (FIPS 180-4)"""
+
+import sys
+
+from Cryptodome.Hash._host import HostHash
+
+digest_size = 64
+block_size = 128
+oid = "2.16.840.1.101.3.4.2.3"
+_host_name = 'sha512'
+
+
+def new(data=None):
+    """Create a new SHA-512 hash object"""
+    return HostHash(sys.modules[__name__], data)
@@ -0,0 +1,4 @@
+"""Hash functions and MACs backed by host functions"""
+
+__all__ = ['HMAC', 'CMAC', 'MD4', 'MD5', 'SHA', 'SHA1', 'SHA224', 'SHA256',
+           'SHA384', 'SHA512']
@@ -0,0 +1,47 @@
+"""
+Shared hash object for the Cryptodome.Hash modules.
+
+Every hash module defines digest_size, block_size, oid and _host_name (the
+hashlib name the host knows it by) and builds HostHash objects from them.
+"""
+
+import _hostcrypto
+
+
+class HostHash:
+    """PyCryptodome-style hash object whose state lives on the host"""
+
+    def __init__(self, module, data=None):
+        self._module = module
+        self._handle, self.digest_size, self.block_size = _hostcrypto.hash_new(module._host_name)
+        self.oid = module.oid
+        if data is not None:
+            self.update(data)
+
+    def __del__(self):
+        handle = getattr(self, '_handle', None)
+        if handle is not None:
+            _hostcrypto.free(handle)
+            self._handle = None
+
+    def update(self, data):
+        _hostcrypto.hash_update(self._handle, data)
+        return self
+
+    def digest(self):
+        return _hostcrypto.hash_digest(self._handle)
+
+    def hexdigest(self):
+        return self.digest().hex()
+
+    def copy(self):
+        other = object.__new__(type(self))
+        other._module = self._module
+        other._handle = _hostcrypto.hash_copy(self._handle)
+        other.digest_size = self.digest_size
+        other.block_size = self.block_size
+        other.oid = self.oid
+        return other
+
+    def new(self, data=None):
+        return HostHash(self._module, data)
@@ -0,0 +1,59 @@
+"""PBKDF2 (RFC 8018) with host-side HMAC"""
+
+import struct
+
+import _hostcrypto
+
+from Cryptodome.Hash import SHA1
+from Cryptodome.Util.strxor import strxor
+
+
+def _host_prf(host_name, password):
+    """PRF that keys the HMAC once and copies it for every block"""
+    base, _, _ = _hostcrypto.hmac_new(host_name, password)
+
+    def prf(_password, data):
+        handle = _hostcrypto.hash_copy(base)
+        try:
+            _hostcrypto.hash_update(handle, data)
+            return _hostcrypto.hash_digest(handle)
+        finally:
+            _hostcrypto.free(handle)
+
+    return prf, base
+
+
+def PBKDF2(password, salt, dkLen=16, count=1000, prf=None, hmac_hash_module=None):
+    """Derive dkLen bytes from password and salt.
+
+    prf is a callable prf(password, data) -> bytes; when it is omitted the
+    PRF is HMAC over hmac_hash_module (SHA1 by default), computed on the host.
+    """
+    if isinstance(password, str):
+        password = password.encode('utf-8')
+    if isinstance(salt, str):
+        salt = salt.encode('utf-8')
+    if prf is not None and hmac_hash_module is not None:
+        raise ValueError("'prf' and 'hmac_hash_module' are mutually exclusive")
+
+    base = None
+    if prf is None:
+        module = hmac_hash_module or SHA1
+        prf, base = _host_prf(module._host_name, bytes(password))
+
+    try:
+        key = b""
+        index = 1
+        while len(key) < dkLen:
+            u = prf(password, salt + struct.pack('>I', index))
+            block = u
+            for _ in range(count - 1):
+                u = prf(password, u)
+                block = strxor(block, u)
+            key += block
+            index += 1
+    finally:
+        if base is not None:
+            _hostcrypto.free(base)
+
+    return key[:dkLen]
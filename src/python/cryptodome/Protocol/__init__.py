@@ -0,0 +1,3 @@
+"""Key derivation functions"""
+
+__all__ = ['KDF']
@@ -0,0 +1,29 @@
+"""Cryptographically strong random bytes (WASI random_get)"""
+
+import os
+
+__all__ = ['new', 'get_random_bytes']
+
+
+def get_random_bytes(n):
+    """Return n random bytes"""
+    return os.urandom(n)
+
+
+class _UrandomRNG:
+    def read(self, n):
+        return os.urandom(n)
+
+    def flush(self):
+        pass
+
+    def reinit(self):
+        pass
+
+    def close(self):
+        pass
+
+
+def new(*args, **kwargs):
+    """Return a file-like object that yields random bytes"""
+    return _UrandomRNG()
@@ -0,0 +1,20 @@
+"""CTR mode counter blocks"""
+
+
+def new(nbits, prefix=b"", suffix=b"", initial_value=1, little_endian=False, allow_wraparound=False):
+    """Describe a counter block for Cryptodome.Cipher CTR mode.
+
+    The host cipher only supports big-endian counters without a suffix.
+    """
+    if nbits % 8 != 0:
+        raise ValueError("'nbits' must be a multiple of 8")
+    counter_len = nbits // 8
+    if initial_value >= 1 << nbits:
+        raise ValueError("Initial value takes more than %d bits" % nbits)
+    return {
+        'counter_len': counter_len,
+        'prefix': bytes(prefix),
+        'suffix': bytes(suffix),
+        'initial_value': initial_value,
+        'little_endian': little_endian,
+    }
@@ -0,0 +1,40 @@
+"""Block padding (PKCS#7, ISO 7816-4 and X.923)"""
+
+
+def pad(data_to_pad, block_size, style='pkcs7'):
+    """Pad data_to_pad to a multiple of block_size"""
+    padding_len = block_size - len(data_to_pad) % block_size
+    if style == 'pkcs7':
+        padding = bytes([padding_len]) * padding_len
+    elif style == 'x923':
+        padding = bytes(padding_len - 1) + bytes([padding_len])
+    elif style == 'iso7816':
+        padding = b"\x80" + bytes(padding_len - 1)
+    else:
+        raise ValueError("Unknown padding style")
+    return data_to_pad + padding
+
+
+def unpad(padded_data, block_size, style='pkcs7'):
+    """Remove padding added by pad()"""
+    pdata_len = len(padded_data)
+    if pdata_len == 0 or pdata_len % block_size:
+        raise ValueError("Input data is not padded")
+    if style in ('pkcs7', 'x923'):
+        padding_len = padded_data[-1]
+        if padding_len < 1 or padding_len > min(block_size, pdata_len):
+            raise ValueError("Padding is incorrect.")
+        if style == 'pkcs7':
+            if padded_data[-padding_len:] != bytes([padding_len]) * padding_len:
+                raise ValueError("PKCS#7 padding is incorrect.")
+        elif padded_data[-padding_len:-1] != bytes(padding_len - 1):
+            raise ValueError("ANSI X.923 padding is incorrect.")
+    elif style == 'iso7816':
+        padding_len = pdata_len - padded_data.rfind(b"\x80")
+        if padding_len < 1 or padding_len > min(block_size, pdata_len):
+            raise ValueError("Padding is incorrect.")
+        if padding_len > 1 and padded_data[1 - padding_len:] != bytes(padding_len - 1):
+            raise ValueError("ISO 7816-4 padding is incorrect.")
+    else:
+        raise ValueError("Unknown padding style")
+    return padded_data[:-padding_len]
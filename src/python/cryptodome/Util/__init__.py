@@ -0,0 +1,3 @@
+"""Miscellaneous helpers"""
+
+__all__ = ['Counter', 'Padding', 'number', 'strxor']
@@ -0,0 +1,35 @@
+"""Number-theory and integer/bytes helpers"""
+
+import math
+
+
+def GCD(x, y):
+    """Greatest common divisor"""
+    return math.gcd(x, y)
+
+
+def inverse(u, v):
+    """Inverse of u modulo v"""
+    return pow(u, -1, v)
+
+
+def size(N):
+    """Size of N in bits"""
+    if N < 0:
+        raise ValueError("Size in bits only available for non-negative numbers")
+    return N.bit_length()
+
+
+def long_to_bytes(n, blocksize=0):
+    """Big-endian bytes of n, left-padded to a multiple of blocksize"""
+    if n < 0:
+        raise ValueError("Values must be non-negative")
+    result = n.to_bytes(max(1, (n.bit_length() + 7) // 8), 'big')
+    if blocksize > 0 and len(result) % blocksize:
+        result = bytes(blocksize - len(result) % blocksize) + result
+    return result
+
+
+def bytes_to_long(s):
+    """Integer value of the big-endian byte string s"""
+    return int.from_bytes(s, 'big')
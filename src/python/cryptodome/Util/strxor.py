@@ -0,0 +1,32 @@
+"""XOR of byte strings"""
+
+try:
+    import _hostbinascii
+except ImportError:
+    _hostbinascii = None
+
+
+def strxor(term1, term2, output=None):
+    """XOR two byte strings of equal length"""
+    if len(term1) != len(term2):
+        raise ValueError("Only byte strings of equal length can be xored")
+    n = len(term1)
+    if _hostbinascii is not None and n:
+        result = _hostbinascii.xor(term1, term2)
+    else:
+        result = (int.from_bytes(term1, 'big') ^ int.from_bytes(term2, 'big')).to_bytes(n, 'big')
+    if output is None:
+        return result
+    output[:] = result
+    return None
+
+
+def strxor_c(term, c, output=None):
+    """XOR every byte of term with the integer c"""
+    if _hostbinascii is not None and len(term):
+        result = _hostbinascii.xor(term, bytes([c]))
+        if output is None:
+            return result
+        output[:] = result
+        return None
+    return strxor(term, bytes([c]) * len(term), output)
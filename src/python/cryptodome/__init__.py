@@ -0,0 +1,21 @@
+"""
+Cryptodome shim for Python WASM
+
+A small PyCryptodome-compatible package backed by the runtime's host crypto
+functions (the _hostcrypto extension). PyCryptodome itself needs compiled C
+modules that have no WASI build; this covers what impacket imports:
+
+- Cipher: AES (ECB/CBC/CTR), DES, DES3, ARC4
+- Hash: MD4, MD5, SHA1/SHA, SHA224, SHA256, SHA384, SHA512, HMAC, CMAC
+- Protocol.KDF: PBKDF2
+- Util: number, Padding, Counter, strxor
+- Random: get_random_bytes
+
+Anything else (AES-192, GCM/CCM and the other AEAD or feedback modes, public
+key crypto) is not provided.
+"""
+
+__all__ = ['Cipher', 'Hash', 'Protocol', 'Random', 'Util']
+
+version_info = (3, 20, 0)
+__version__ = "3.20.0"
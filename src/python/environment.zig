@@ -14,6 +14,7 @@ pub const PythonConfig = struct {
     utf8_mode: bool = true,                               // Enable UTF-8 mode
     coerce_locale: bool = false,                          // Disable locale coercion
     frozen_modules: []const u8 = "on",                    // Frozen modules setting
+    pycache_prefix: ?[]const u8 = null,                   // Bytecode cache root (PYTHONPYCACHEPREFIX)
 };
 
 /// Configure Python environment variables in the zware instance
@@ -31,6 +32,9 @@ pub fn setupEnvironment(
     try instance.wasi_env.put(allocator, "PYTHONUTF8", if (config.utf8_mode) "1" else "0");
     try instance.wasi_env.put(allocator, "PYTHONCOERCECLOCALE", if (config.coerce_locale) "1" else "0");
     try instance.wasi_env.put(allocator, "PYTHON_FROZEN_MODULES", config.frozen_modules);
+    if (config.pycache_prefix) |prefix| {
+        try instance.wasi_env.put(allocator, "PYTHONPYCACHEPREFIX", prefix);
+    }
 }
 
 /// Python command configuration
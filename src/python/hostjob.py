@@ -0,0 +1,211 @@
+"""
+Job dispatcher for --serve mode
+
+The server (src/server.zig) compiles run() once and calls it with the
+payload of every request frame. Each job runs with stdout and stderr
+captured, and its outcome is packed for the host to frame and send back.
+
+Request payload (little-endian):
+    u8   kind        1 = script source, 2 = call module:function
+    u8   flags       bit 0: reset interpreter state after the job (the host
+                     also rolls back the job's file changes, and restores a
+                     checkpointed interpreter's memory)
+    u32  timeout_ms  0 = no limit
+    u32  len, bytes  script source, or "package.module:function"
+    u32  len, bytes  input
+
+A timeout is enforced by the host, which interrupts the job with
+_hostcall.DeadlineExceeded (see src/deadline.zig); with an interpreter
+built without it, a trace function checks the time instead, which slows
+the job down and cannot stop it inside a single long call.
+
+Scripts see the input as INPUT and may set RESULT; functions are called
+with the input and return their result. A result may be bytes-like, str
+(sent as UTF-8) or None. The code compiled from the most recent scripts is
+kept, so a script sent again is not compiled again.
+
+Returned payload:
+    u8   status      0 ok, 1 exception, 2 timeout, 3 bad request
+    u32  len, bytes  stdout
+    u32  len, bytes  stderr
+    u32  len, bytes  result, or the traceback for status 1-3
+"""
+
+import builtins
+import gc
+import importlib
+import io
+import struct
+import sys
+import time
+import traceback
+
+try:
+    from _hostcall import DeadlineExceeded, acknowledge_deadline
+except ImportError:
+    DeadlineExceeded = acknowledge_deadline = None
+
+_KIND_SCRIPT = 1
+_KIND_CALL = 2
+
+_FLAG_RESET = 1
+
+_STATUS_OK = 0
+_STATUS_EXCEPTION = 1
+_STATUS_TIMEOUT = 2
+_STATUS_BAD_REQUEST = 3
+
+# Trace events between deadline checks
+_CHECK_INTERVAL = 256
+
+# Compiled scripts kept, keyed by source, least recently used first
+_CODE_CACHE_SIZE = 64
+_code_cache = {}
+
+# State a reset returns to: what was loaded when the server started
+_baseline_modules = frozenset(sys.modules)
+_baseline_path = list(sys.path)
+
+
+class JobTimeout(BaseException):
+    """Raised inside a job that ran past its deadline"""
+
+
+class _BadRequest(Exception):
+    pass
+
+
+_TIMEOUTS = (JobTimeout,) if DeadlineExceeded is None else (JobTimeout, DeadlineExceeded)
+
+
+def _read_field(payload, offset):
+    if offset + 4 > len(payload):
+        raise _BadRequest('truncated request')
+    (length,) = struct.unpack_from('<I', payload, offset)
+    start = offset + 4
+    end = start + length
+    if end > len(payload):
+        raise _BadRequest('truncated request')
+    return payload[start:end], end
+
+
+def _parse(payload):
+    if len(payload) < 6:
+        raise _BadRequest('truncated request')
+    kind, flags, timeout_ms = struct.unpack_from('<BBI', payload, 0)
+    if kind not in (_KIND_SCRIPT, _KIND_CALL):
+        raise _BadRequest(f'unknown job kind {kind}')
+    target, offset = _read_field(payload, 6)
+    job_input, offset = _read_field(payload, offset)
+    if offset != len(payload):
+        raise _BadRequest('trailing bytes in request')
+    return kind, flags, timeout_ms, target.decode('utf-8'), job_input
+
+
+def _deadline_tracer(deadline):
+    """Trace function that raises JobTimeout once the deadline passes"""
+    events = 0
+
+    def tracer(frame, event, arg):
+        nonlocal events
+        events += 1
+        if events % _CHECK_INTERVAL == 0 and time.monotonic() > deadline:
+            raise JobTimeout('job exceeded its deadline')
+        return tracer
+
+    return tracer
+
+
+def _resolve(target):
+    module_name, sep, attr_path = target.partition(':')
+    if not sep or not module_name or not attr_path:
+        raise _BadRequest(f'call target must be module:function, got {target!r}')
+    obj = importlib.import_module(module_name)
+    for attr in attr_path.split('.'):
+        obj = getattr(obj, attr)
+    return obj
+
+
+def _compile_script(source):
+    code = _code_cache.pop(source, None)
+    if code is None:
+        code = compile(source, '<job>', 'exec')
+        if len(_code_cache) >= _CODE_CACHE_SIZE:
+            del _code_cache[next(iter(_code_cache))]
+    _code_cache[source] = code
+    return code
+
+
+def _run_job(kind, target, job_input):
+    if kind == _KIND_SCRIPT:
+        namespace = {'__name__': '__main__', '__builtins__': builtins, 'INPUT': job_input}
+        exec(_compile_script(target), namespace)
+        return namespace.get('RESULT')
+    return _resolve(target)(job_input)
+
+
+def _to_bytes(result):
+    if result is None:
+        return b''
+    if isinstance(result, str):
+        return result.encode('utf-8', 'surrogatepass')
+    return bytes(memoryview(result))
+
+
+def _reset():
+    """Forget modules imported by jobs and restore sys.path"""
+    for name in [name for name in sys.modules if name not in _baseline_modules]:
+        del sys.modules[name]
+    sys.path[:] = _baseline_path
+    importlib.invalidate_caches()
+    gc.collect()
+
+
+def _pack(status, stdout, stderr, result):
+    out = bytearray((status,))
+    for field in (stdout, stderr, result):
+        out += struct.pack('<I', len(field))
+        out += field
+    return bytes(out)
+
+
+def run(payload):
+    """Run one job; see the module docstring for the formats"""
+    try:
+        kind, flags, timeout_ms, target, job_input = _parse(payload)
+    except (_BadRequest, UnicodeDecodeError, struct.error) as exc:
+        return _pack(_STATUS_BAD_REQUEST, b'', b'', str(exc).encode('utf-8'))
+
+    stdout, stderr = io.StringIO(), io.StringIO()
+    saved_stdout, saved_stderr = sys.stdout, sys.stderr
+    sys.stdout, sys.stderr = stdout, stderr
+    if timeout_ms and DeadlineExceeded is None:
+        sys.settrace(_deadline_tracer(time.monotonic() + timeout_ms / 1000))
+
+    try:
+        status, result = _STATUS_OK, _to_bytes(_run_job(kind, target, job_input))
+    except _TIMEOUTS:
+        if acknowledge_deadline is not None:
+            # Handled here; the host would otherwise keep raising it
+            acknowledge_deadline()
+        status, result = _STATUS_TIMEOUT, traceback.format_exc().encode('utf-8', 'backslashreplace')
+    except _BadRequest as exc:
+        status, result = _STATUS_BAD_REQUEST, str(exc).encode('utf-8')
+    except BaseException:
+        status, result = _STATUS_EXCEPTION, traceback.format_exc().encode('utf-8', 'backslashreplace')
+    finally:
+        if acknowledge_deadline is not None:
+            # The job is over; a deadline passing now must not interrupt
+            # the rest of this function
+            acknowledge_deadline()
+        sys.settrace(None)
+        sys.stdout, sys.stderr = saved_stdout, saved_stderr
+        if flags & _FLAG_RESET:
+            _reset()
+
+    return _pack(
+        status,
+        stdout.getvalue().encode('utf-8', 'backslashreplace'),
+        stderr.getvalue().encode('utf-8', 'backslashreplace'),
+        result,
+    )
@@ -0,0 +1,207 @@
+// Library Manifest
+//
+// Decides which bytecode libraries a runtime loads, and from where. A
+// deployment manifest (Options.manifest_path) declares them:
+//
+//   {
+//     "python_lib": "../cpython-wasi/Lib",
+//     "compiled_libs": "compiled_libs",
+//     "libraries": [
+//       { "name": "requests" },
+//       { "name": "impacket", "load": "lazy" }
+//     ]
+//   }
+//
+// Relative paths in it resolve against the manifest's own directory; paths
+// it leaves out come from Options. Without a deployment manifest, every
+// library compile_library.py recorded in compiled_libs/.manifest.json is
+// loaded eagerly.
+
+const std = @import("std");
+const Allocator = std.mem.Allocator;
+
+/// Name of the manifest compile_library.py keeps in compiled_libs/
+pub const compiled_manifest_name = ".manifest.json";
+
+/// compile_library.py's entry for the standard library, which is loaded
+/// by loadStdlib rather than as a library
+const stdlib_entry = "stdlib";
+
+pub const LoadMode = enum {
+    /// Content read into memory when the runtime starts
+    eager,
+    /// Content mapped from the host file, so its pages are read from disk
+    /// only when the guest first reads them; the guest reads a library's
+    /// pack only when the library is first imported
+    lazy,
+};
+
+pub const Library = struct {
+    /// Directory (or pack, <name>.zpack) under compiled_libs/, and the
+    /// package name it is imported as
+    name: []const u8,
+    load: LoadMode = .eager,
+};
+
+/// What to load, with every path absolute
+pub const Plan = struct {
+    arena: std.heap.ArenaAllocator,
+    python_lib_path: []const u8,
+    compiled_libs_path: []const u8,
+    libraries: []const Library,
+
+    pub fn deinit(self: *Plan) void {
+        self.arena.deinit();
+    }
+};
+
+/// A deployment manifest as written
+const Manifest = struct {
+    python_lib: ?[]const u8 = null,
+    compiled_libs: ?[]const u8 = null,
+    libraries: []const Library = &.{},
+};
+
+/// Plan the libraries a deployment manifest declares. python_lib_path and
+/// compiled_libs_path (absolute) are used where the manifest names no
+/// directory.
+pub fn fromManifest(
+    allocator: Allocator,
+    manifest_path: []const u8,
+    python_lib_path: []const u8,
+    compiled_libs_path: []const u8,
+) !Plan {
+    var plan: Plan = .{
+        .arena = .init(allocator),
+        .python_lib_path = undefined,
+        .compiled_libs_path = undefined,
+        .libraries = undefined,
+    };
+    errdefer plan.deinit();
+    const arena = plan.arena.allocator();
+
+    const path = try std.fs.cwd().realpathAlloc(arena, manifest_path);
+    const base_dir = std.fs.path.dirname(path) orelse "/";
+    const content = try std.fs.cwd().readFileAlloc(arena, path, 1024 * 1024);
+    const manifest = std.json.parseFromSliceLeaky(Manifest, arena, content, .{ .ignore_unknown_fields = true }) catch |err| {
+        std.debug.print("Error: invalid library manifest {s}: {}\n", .{ path, err });
+        return error.InvalidManifest;
+    };
+
+    for (manifest.libraries) |library| {
+        if (!isLibraryName(library.name)) {
+            std.debug.print("Error: invalid library name in {s}: \"{s}\"\n", .{ path, library.name });
+            return error.InvalidManifest;
+        }
+    }
+
+    plan.python_lib_path = if (manifest.python_lib) |dir| try resolve(arena, base_dir, dir) else try arena.dupe(u8, python_lib_path);
+    plan.compiled_libs_path = if (manifest.compiled_libs) |dir| try resolve(arena, base_dir, dir) else try arena.dupe(u8, compiled_libs_path);
+    plan.libraries = manifest.libraries;
+    return plan;
+}
+
+/// Plan every library recorded in compiled_libs_path's manifest, loaded
+/// eagerly; none if compile_library.py has not been run there
+pub fn fromCompiledLibs(allocator: Allocator, python_lib_path: []const u8, compiled_libs_path: []const u8) !Plan {
+    var plan: Plan = .{
+        .arena = .init(allocator),
+        .python_lib_path = undefined,
+        .compiled_libs_path = undefined,
+        .libraries = &.{},
+    };
+    errdefer plan.deinit();
+    const arena = plan.arena.allocator();
+    plan.python_lib_path = try arena.dupe(u8, python_lib_path);
+    plan.compiled_libs_path = try arena.dupe(u8, compiled_libs_path);
+
+    const path = try std.fs.path.join(arena, &.{ compiled_libs_path, compiled_manifest_name });
+    const content = std.fs.cwd().readFileAlloc(arena, path, 64 * 1024 * 1024) catch |err| switch (err) {
+        error.FileNotFound => return plan,
+        else => return err,
+    };
+    const root = std.json.parseFromSliceLeaky(std.json.Value, arena, content, .{}) catch |err| {
+        std.debug.print("Error: invalid library manifest {s}: {}\n", .{ path, err });
+        return error.InvalidManifest;
+    };
+    if (root != .object) {
+        std.debug.print("Error: invalid library manifest {s}: not an object\n", .{path});
+        return error.InvalidManifest;
+    }
+
+    var libraries: std.ArrayListUnmanaged(Library) = .empty;
+    for (root.object.keys()) |name| {
+        if (std.mem.eql(u8, name, stdlib_entry) or !isLibraryName(name)) continue;
+        try libraries.append(arena, .{ .name = name });
+    }
+    plan.libraries = libraries.items;
+    return plan;
+}
+
+/// path made absolute against base_dir
+pub fn resolve(allocator: Allocator, base_dir: []const u8, path: []const u8) ![]u8 {
+    if (std.fs.path.isAbsolute(path)) return allocator.dupe(u8, path);
+    return std.fs.path.resolve(allocator, &.{ base_dir, path });
+}
+
+/// A single path component naming a directory under compiled_libs/
+fn isLibraryName(name: []const u8) bool {
+    return name.len > 0 and
+        std.mem.indexOfScalar(u8, name, '/') == null and
+        !std.mem.eql(u8, name, ".") and
+        !std.mem.eql(u8, name, "..");
+}
+
+test "library manifest" {
+    const allocator = std.testing.allocator;
+
+    var tmp = std.testing.tmpDir(.{});
+    defer tmp.cleanup();
+    const root = try tmp.dir.realpathAlloc(allocator, ".");
+    defer allocator.free(root);
+
+    try tmp.dir.writeFile(.{ .sub_path = "deploy.json", .data =
+        \\{
+        \\  "compiled_libs": "libs",
+        \\  "libraries": [
+        \\    { "name": "requests" },
+        \\    { "name": "impacket", "load": "lazy" }
+        \\  ]
+        \\}
+    });
+    const manifest_path = try std.fs.path.join(allocator, &.{ root, "deploy.json" });
+    defer allocator.free(manifest_path);
+
+    var plan = try fromManifest(allocator, manifest_path, "/opt/Lib", "/opt/compiled_libs");
+    defer plan.deinit();
+    try std.testing.expectEqualStrings("/opt/Lib", plan.python_lib_path);
+    const libs_path = try std.fs.path.join(allocator, &.{ root, "libs" });
+    defer allocator.free(libs_path);
+    try std.testing.expectEqualStrings(libs_path, plan.compiled_libs_path);
+    try std.testing.expectEqual(@as(usize, 2), plan.libraries.len);
+    try std.testing.expectEqualStrings("impacket", plan.libraries[1].name);
+    try std.testing.expectEqual(LoadMode.lazy, plan.libraries[1].load);
+    try std.testing.expectEqual(LoadMode.eager, plan.libraries[0].load);
+
+    // compile_library.py's manifest: every library but the stdlib
+    try tmp.dir.makePath("libs");
+    try tmp.dir.writeFile(.{ .sub_path = "libs/.manifest.json", .data =
+        \\{"stdlib": {"files": {}}, "requests": {"files": {}}, "urllib3": {"files": {}}}
+    });
+    var discovered = try fromCompiledLibs(allocator, "/opt/Lib", libs_path);
+    defer discovered.deinit();
+    try std.testing.expectEqual(@as(usize, 2), discovered.libraries.len);
+    try std.testing.expectEqualStrings("requests", discovered.libraries[0].name);
+    try std.testing.expectEqualStrings("urllib3", discovered.libraries[1].name);
+
+    var empty = try fromCompiledLibs(allocator, "/opt/Lib", root);
+    defer empty.deinit();
+    try std.testing.expectEqual(@as(usize, 0), empty.libraries.len);
+
+    try tmp.dir.writeFile(.{ .sub_path = "bad.json", .data =
+        \\{"libraries": [{"name": "../etc"}]}
+    });
+    const bad_path = try std.fs.path.join(allocator, &.{ root, "bad.json" });
+    defer allocator.free(bad_path);
+    try std.testing.expectError(error.InvalidManifest, fromManifest(allocator, bad_path, "/opt/Lib", "/opt/compiled_libs"));
+}
@@ -0,0 +1,81 @@
+"""
+Post-import hooks for host-backed patches
+
+Some host accelerations replace functions in third-party packages that are
+loaded from bytecode (charset_normalizer, idna, ...). Importing those
+packages eagerly at startup would cost every script their import time, so
+patches register a callback that runs right after the package is first
+imported instead:
+
+    import _hostpatch
+
+    def _patch(module):
+        module.detect = fast_detect
+
+    _hostpatch.when_imported('charset_normalizer', _patch)
+
+If the module is already imported the callback runs immediately. Callbacks
+run again whenever the module is imported anew (after being removed from
+sys.modules, as --serve does when it resets state between jobs).
+"""
+
+import sys
+
+_hooks = {}
+
+
+class _HookedLoader:
+    """Wraps a module's loader and runs the hooks after exec_module"""
+
+    def __init__(self, loader, name):
+        self._loader = loader
+        self._name = name
+
+    def __getattr__(self, attr):
+        return getattr(self._loader, attr)
+
+    def create_module(self, spec):
+        return self._loader.create_module(spec)
+
+    def exec_module(self, module):
+        # Keep the real loader visible to importlib.resources and friends
+        module.__loader__ = self._loader
+        module.__spec__.loader = self._loader
+        self._loader.exec_module(module)
+        for callback in _hooks.get(self._name, ()):
+            callback(module)
+
+
+class _PostImportFinder:
+    """Meta path finder that only intercepts modules with pending hooks"""
+
+    def find_spec(self, fullname, path=None, target=None):
+        if fullname not in _hooks:
+            return None
+
+        for finder in sys.meta_path:
+            if finder is self or not hasattr(finder, 'find_spec'):
+                continue
+            spec = finder.find_spec(fullname, path, target)
+            if spec is not None:
+                break
+        else:
+            return None
+
+        if spec.loader is not None and hasattr(spec.loader, 'exec_module'):
+            spec.loader = _HookedLoader(spec.loader, fullname)
+        return spec
+
+
+_finder = _PostImportFinder()
+
+
+def when_imported(name, callback):
+    """Call callback(module) once module `name` has been imported"""
+    module = sys.modules.get(name)
+    if module is not None:
+        callback(module)
+
+    _hooks.setdefault(name, []).append(callback)
+    if _finder not in sys.meta_path:
+        sys.meta_path.insert(0, _finder)
@@ -0,0 +1,136 @@
+"""
+binascii/base64 Monkey Patch for Python WASM
+
+Base64 and hex conversion of large blobs (auth headers, attachments, NTLM
+messages) runs binascii's C loops as interpreted WASM. This patch sends
+inputs above a size threshold to the vectorized host codecs in the
+_hostbinascii extension; small inputs stay on binascii, where the call
+overhead is lower.
+
+The host only decodes canonical input. Base64 with whitespace, junk
+characters or odd padding, hex with odd length, separators and so on go to
+the original functions, which apply their usual leniency and raise their
+usual errors.
+
+If _hostbinascii is missing from the build, this patch does nothing.
+"""
+
+import binascii
+
+import _hostpatch
+
+try:
+    import _hostbinascii
+except ImportError:
+    _hostbinascii = None
+
+# Inputs shorter than this are not worth a host call
+_THRESHOLD = 256
+
+_BINARY = (bytes, bytearray)
+
+
+def _ascii_input(data):
+    """bytes for a binascii decoder argument, or None to use the original"""
+    if isinstance(data, _BINARY):
+        return data
+    if isinstance(data, str) and data.isascii():
+        return data.encode('ascii')
+    return None
+
+
+def _patch_binascii(module):
+    original_b2a_base64 = module.b2a_base64
+    original_a2b_base64 = module.a2b_base64
+    original_hexlify = module.hexlify
+    original_unhexlify = module.unhexlify
+
+    def b2a_base64(data, /, *, newline=True):
+        if isinstance(data, _BINARY) and len(data) >= _THRESHOLD:
+            return _hostbinascii.b64encode(data, b'+/', newline)
+        return original_b2a_base64(data, newline=newline)
+
+    def a2b_base64(data, /, *, strict_mode=False):
+        raw = _ascii_input(data)
+        if raw is not None and len(raw) >= _THRESHOLD:
+            try:
+                return _hostbinascii.b64decode(raw, b'+/')
+            except ValueError:
+                pass
+        return original_a2b_base64(data, strict_mode=strict_mode)
+
+    def hexlify(data, sep=None, bytes_per_sep=1):
+        if sep is None and isinstance(data, _BINARY) and len(data) >= _THRESHOLD:
+            return _hostbinascii.hexlify(data)
+        if sep is None:
+            return original_hexlify(data)
+        return original_hexlify(data, sep, bytes_per_sep)
+
+    def unhexlify(hexstr, /):
+        raw = _ascii_input(hexstr)
+        if raw is not None and len(raw) >= _THRESHOLD:
+            try:
+                return _hostbinascii.unhexlify(raw)
+            except ValueError:
+                pass
+        return original_unhexlify(hexstr)
+
+    for patched, original in ((b2a_base64, original_b2a_base64),
+                              (a2b_base64, original_a2b_base64),
+                              (hexlify, original_hexlify),
+                              (unhexlify, original_unhexlify)):
+        patched.__doc__ = original.__doc__
+    module.b2a_base64 = b2a_base64
+    module.a2b_base64 = a2b_base64
+    module.hexlify = module.b2a_hex = hexlify
+    module.unhexlify = module.a2b_hex = unhexlify
+
+
+def _patch_base64(module):
+    """altchars variants skip base64's extra translate() pass"""
+    original_b64encode = module.b64encode
+    original_b64decode = module.b64decode
+    original_urlsafe_b64encode = module.urlsafe_b64encode
+    original_urlsafe_b64decode = module.urlsafe_b64decode
+
+    def b64encode(s, altchars=None):
+        if (altchars is not None and isinstance(s, _BINARY) and len(s) >= _THRESHOLD
+                and isinstance(altchars, _BINARY) and len(altchars) == 2):
+            return _hostbinascii.b64encode(s, altchars, False)
+        return original_b64encode(s, altchars)
+
+    def b64decode(s, altchars=None, validate=False):
+        if altchars is not None and isinstance(altchars, _BINARY) and len(altchars) == 2:
+            raw = _ascii_input(s)
+            if raw is not None and len(raw) >= _THRESHOLD:
+                try:
+                    return _hostbinascii.b64decode(raw, altchars)
+                except ValueError:
+                    pass
+        return original_b64decode(s, altchars, validate)
+
+    def urlsafe_b64encode(s):
+        if isinstance(s, _BINARY) and len(s) >= _THRESHOLD:
+            return _hostbinascii.b64encode(s, b'-_', False)
+        return original_urlsafe_b64encode(s)
+
+    def urlsafe_b64decode(s):
+        raw = _ascii_input(s)
+        if raw is not None and len(raw) >= _THRESHOLD:
+            try:
+                return _hostbinascii.b64decode(raw, b'-_')
+            except ValueError:
+                pass
+        return original_urlsafe_b64decode(s)
+
+    for patched, original in ((b64encode, original_b64encode),
+                              (b64decode, original_b64decode),
+                              (urlsafe_b64encode, original_urlsafe_b64encode),
+                              (urlsafe_b64decode, original_urlsafe_b64decode)):
+        patched.__doc__ = original.__doc__
+        setattr(module, original.__name__, patched)
+
+
+if _hostbinascii is not None:
+    _patch_binascii(binascii)
+    _hostpatch.when_imported('base64', _patch_base64)
@@ -0,0 +1,59 @@
+"""
+charset_normalizer Monkey Patch for Python WASM
+
+requests calls charset_normalizer.detect() on response.text whenever the
+server does not declare an encoding. That runs charset_normalizer's
+mess/coherence analysis in pure Python, which is very slow under
+interpretation. This patch swaps detect() for the host detector in the
+_hostcharset extension once charset_normalizer is imported.
+
+Only detect() is replaced; from_bytes() and friends keep the original
+implementation. If _hostcharset is missing from the build, this patch does
+nothing.
+"""
+
+import _hostpatch
+
+try:
+    import _hostcharset
+except ImportError:
+    _hostcharset = None
+
+
+def _patch_charset_normalizer(module):
+    original_detect = module.detect
+    try:
+        from charset_normalizer.constant import CHARDET_CORRESPONDENCE
+    except ImportError:
+        CHARDET_CORRESPONDENCE = {}
+
+    def detect(byte_str, should_rename_legacy=False, **kwargs):
+        """chardet-compatible detect() backed by the host detector"""
+        if kwargs:
+            return original_detect(byte_str, should_rename_legacy, **kwargs)
+        if not isinstance(byte_str, (bytes, bytearray)):
+            raise TypeError(
+                "Expected object of type bytes or bytearray, got: {0}".format(type(byte_str))
+            )
+
+        encoding, language, confidence, bom = _hostcharset.detect(byte_str)
+        # Same renames as charset_normalizer.legacy.detect
+        if encoding == 'utf_8' and bom:
+            encoding += '_sig'
+        if not should_rename_legacy and encoding in CHARDET_CORRESPONDENCE:
+            encoding = CHARDET_CORRESPONDENCE[encoding]
+        return {
+            'encoding': encoding,
+            'language': language,
+            'confidence': confidence if encoding is not None else None,
+        }
+
+    detect.__doc__ = original_detect.__doc__
+    module.detect = detect
+    legacy = getattr(module, 'legacy', None)
+    if legacy is not None:
+        legacy.detect = detect
+
+
+if _hostcharset is not None:
+    _hostpatch.when_imported('charset_normalizer', _patch_charset_normalizer)
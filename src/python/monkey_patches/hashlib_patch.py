@@ -0,0 +1,153 @@
+"""
+hashlib Monkey Patch for Python WASM
+
+Routes hashlib's constructors to host-side std.crypto implementations via
+the _hostcrypto extension. The built-in _md5/_sha2/_blake2 modules work, but
+they run as interpreted WASM and are orders of magnitude slower than native
+code on large payloads.
+
+Anything the host does not cover (keyed or resized BLAKE2, unknown names,
+extra constructor arguments) falls through to the original hashlib
+functions, so behaviour is unchanged apart from speed.
+
+If _hostcrypto is missing from the build, this patch does nothing.
+"""
+
+import hashlib
+
+try:
+    import _hostcrypto
+except ImportError:
+    _hostcrypto = None
+
+
+class HostHash:
+    """hashlib-compatible hash object whose state lives on the host"""
+    __slots__ = ['_handle', 'name', 'digest_size', 'block_size']
+
+    def __init__(self, name, data=b""):
+        self._handle, self.digest_size, self.block_size = _hostcrypto.hash_new(name)
+        self.name = name
+        if data:
+            self.update(data)
+
+    def __del__(self):
+        handle = getattr(self, '_handle', None)
+        if handle is not None:
+            _hostcrypto.free(handle)
+            self._handle = None
+
+    def update(self, data):
+        if isinstance(data, str):
+            raise TypeError("Strings must be encoded before hashing")
+        _hostcrypto.hash_update(self._handle, data)
+
+    def digest(self):
+        return _hostcrypto.hash_digest(self._handle)
+
+    def hexdigest(self):
+        return self.digest().hex()
+
+    def copy(self):
+        other = object.__new__(type(self))
+        other._handle = _hostcrypto.hash_copy(self._handle)
+        other.name = self.name
+        other.digest_size = self.digest_size
+        other.block_size = self.block_size
+        return other
+
+    def __repr__(self):
+        return f"<{self.name} HostHash object @ {hex(id(self))}>"
+
+
+class HostShake(HostHash):
+    """Variable-length SHAKE object; digest() takes the output length"""
+    __slots__ = []
+
+    def digest(self, length):
+        if length < 0:
+            raise ValueError("length must be non-negative")
+        if length == 0:
+            return b""
+        return _hostcrypto.hash_digest(self._handle, length)
+
+    def hexdigest(self, length):
+        return self.digest(length).hex()
+
+
+_HOST_ALGORITHMS = {
+    'md4', 'md5', 'sha1', 'sha224', 'sha256', 'sha384', 'sha512',
+    'sha3_224', 'sha3_256', 'sha3_384', 'sha3_512',
+    'shake_128', 'shake_256', 'blake2b', 'blake2s',
+}
+
+
+def _host_hash(name, data):
+    cls = HostShake if name.startswith('shake_') else HostHash
+    return cls(name, data)
+
+
+def _data_arg(data, string):
+    if string is not None:
+        if data:
+            raise TypeError("'data' and 'string' are mutually exclusive")
+        return string
+    return data
+
+
+_original_new = hashlib.new
+
+
+def new(name, data=b"", **kwargs):
+    """new(name, data=b'', **kwargs) - Return a new hashing object using the
+    named algorithm; optionally initialized with data (which must be
+    a bytes-like object).
+    """
+    kwargs.pop('usedforsecurity', None)
+    data = _data_arg(data, kwargs.pop('string', None))
+    if not kwargs and isinstance(name, str) and name.lower() in _HOST_ALGORITHMS:
+        return _host_hash(name.lower(), data)
+    return _original_new(name, data, **kwargs)
+
+
+def _make_constructor(name):
+    original = getattr(hashlib, name)
+
+    def constructor(data=b"", *, usedforsecurity=True, string=None):
+        return _host_hash(name, _data_arg(data, string))
+
+    constructor.__name__ = constructor.__qualname__ = name
+    constructor.__doc__ = original.__doc__
+    return constructor
+
+
+def _make_blake2_constructor(name):
+    original = getattr(hashlib, name)
+
+    def constructor(data=b"", *, digest_size=original.MAX_DIGEST_SIZE, key=b"",
+                    usedforsecurity=True, string=None, **params):
+        data = _data_arg(data, string)
+        # Only the unkeyed, full-length variant runs on the host
+        if digest_size == original.MAX_DIGEST_SIZE and not key and not any(params.values()):
+            return _host_hash(name, data)
+        return original(data, digest_size=digest_size, key=key, **params)
+
+    constructor.__name__ = constructor.__qualname__ = name
+    constructor.__doc__ = original.__doc__
+    for attr in ('SALT_SIZE', 'PERSON_SIZE', 'MAX_KEY_SIZE', 'MAX_DIGEST_SIZE'):
+        setattr(constructor, attr, getattr(original, attr))
+    return constructor
+
+
+if _hostcrypto is not None:
+    for _name in ('md5', 'sha1', 'sha224', 'sha256', 'sha384', 'sha512',
+                  'sha3_224', 'sha3_256', 'sha3_384', 'sha3_512',
+                  'shake_128', 'shake_256'):
+        if hasattr(hashlib, _name):
+            setattr(hashlib, _name, _make_constructor(_name))
+    for _name in ('blake2b', 'blake2s'):
+        if hasattr(hashlib, _name):
+            setattr(hashlib, _name, _make_blake2_constructor(_name))
+    hashlib.new = new
+    # hashlib.file_digest and hmac look digest constructors up on hashlib,
+    # so they pick up the host versions too
@@ -0,0 +1,79 @@
+"""
+idna Monkey Patch for Python WASM
+
+requests and urllib3 run every non-ASCII hostname through idna.encode(),
+and idna's Unicode table lookups, context rules and Punycode loops are slow
+as interpreted WASM. This patch routes idna.encode/idna.decode to the host
+implementation in the _hostidna extension, which follows idna.core exactly
+and caches results per hostname.
+
+The host declines input it cannot decide with its tables (right-to-left
+labels, text NFC could change, code points newer than its Unicode data)
+and input idna rejects; both go to the original functions, so errors are
+raised by idna with its usual messages. If _hostidna is missing from the
+build, this patch does nothing.
+"""
+
+import _hostpatch
+
+try:
+    import _hostidna
+except ImportError:
+    _hostidna = None
+
+
+def _flags(strict, uts46, std3_rules, transitional):
+    flags = 0
+    if strict:
+        flags |= _hostidna.STRICT
+    if uts46:
+        flags |= _hostidna.UTS46
+    if std3_rules:
+        flags |= _hostidna.STD3_RULES
+    if transitional:
+        flags |= _hostidna.TRANSITIONAL
+    return flags
+
+
+def _host_input(s):
+    """UTF-8 bytes for the host, or None to use the original"""
+    if isinstance(s, str):
+        return s.encode('utf-8', 'surrogatepass')
+    # idna reads bytes as ASCII and raises for anything else
+    if isinstance(s, (bytes, bytearray)) and s.isascii():
+        return s
+    return None
+
+
+def _patch_idna(module):
+    core = module.core
+    original_encode = core.encode
+    original_decode = core.decode
+
+    def encode(s, strict=False, uts46=False, std3_rules=False, transitional=False):
+        data = _host_input(s)
+        if data is not None:
+            try:
+                return _hostidna.encode(data, _flags(strict, uts46, std3_rules, transitional))
+            except ValueError:
+                pass
+        return original_encode(s, strict, uts46, std3_rules, transitional)
+
+    def decode(s, strict=False, uts46=False, std3_rules=False):
+        data = _host_input(s)
+        if data is not None:
+            try:
+                return _hostidna.decode(data, _flags(strict, uts46, std3_rules, False))
+            except ValueError:
+                pass
+        return original_decode(s, strict, uts46, std3_rules)
+
+    for patched, original in ((encode, original_encode), (decode, original_decode)):
+        patched.__doc__ = original.__doc__
+        patched.__annotations__ = original.__annotations__
+        setattr(core, original.__name__, patched)
+        setattr(module, original.__name__, patched)
+
+
+if _hostidna is not None:
+    _hostpatch.when_imported('idna', _patch_idna)
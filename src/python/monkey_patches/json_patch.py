@@ -0,0 +1,136 @@
+"""
+json Monkey Patch for Python WASM
+
+json's C accelerator (_json) still runs inside the interpreter, and the
+pure-Python scanner and encoder it falls back to are slow under WASM. This
+patch routes json.loads/json.dumps (and load/dump, which go through them)
+to the host JSON codec in the _hostjson extension.
+
+Objects cross the boundary as marshal data: the host parses JSON straight
+into marshal bytes for marshal.loads(), and formats the marshal.dumps()
+output of an object as JSON text. The result is identical to the stdlib's.
+
+The host path is only taken for the default behaviour. Calls with cls,
+object hooks, parse_* overrides or a default function, and objects marshal
+cannot represent exactly (subclasses, enums, ...), use the original
+functions. So does any input the host rejects, so errors are raised by the
+stdlib with its usual messages. If _hostjson is missing from the build,
+this patch does nothing.
+"""
+
+import marshal
+
+import _hostpatch
+
+try:
+    import _hostjson
+except ImportError:
+    _hostjson = None
+
+
+def _patch_json(module):
+    original_loads = module.loads
+    original_dumps = module.dumps
+    original_dump = module.dump
+    detect_encoding = module.detect_encoding
+
+    def loads(s, *, cls=None, object_hook=None, parse_float=None,
+              parse_int=None, parse_constant=None, object_pairs_hook=None, **kw):
+        """json.loads backed by the host parser"""
+        if (cls is not None or object_hook is not None or parse_float is not None
+                or parse_int is not None or parse_constant is not None
+                or object_pairs_hook is not None or kw):
+            return original_loads(
+                s, cls=cls, object_hook=object_hook, parse_float=parse_float,
+                parse_int=parse_int, parse_constant=parse_constant,
+                object_pairs_hook=object_pairs_hook, **kw)
+
+        if isinstance(s, str):
+            # json.loads rejects a leading BOM in str input
+            data = None if s.startswith('\ufeff') else s.encode('utf-8', 'surrogatepass')
+        elif isinstance(s, (bytes, bytearray)) and detect_encoding(s) == 'utf-8':
+            data = s
+        else:
+            data = None
+
+        if data is not None:
+            try:
+                return marshal.loads(_hostjson.decode(data))
+            except ValueError:
+                pass
+        return original_loads(s)
+
+    def _encode(obj, skipkeys, ensure_ascii, allow_nan, indent, separators, sort_keys):
+        """JSON text for obj, or None if the host cannot produce it"""
+        try:
+            data = marshal.dumps(obj)
+        except ValueError:
+            return None
+
+        if indent is not None and not isinstance(indent, str):
+            indent = ' ' * indent
+        if separators is not None:
+            item_separator, key_separator = separators
+        elif indent is not None:
+            item_separator, key_separator = ',', ': '
+        else:
+            item_separator, key_separator = ', ', ': '
+
+        flags = 0
+        if skipkeys:
+            flags |= _hostjson.SKIPKEYS
+        if ensure_ascii:
+            flags |= _hostjson.ENSURE_ASCII
+        if allow_nan:
+            flags |= _hostjson.ALLOW_NAN
+        if sort_keys:
+            flags |= _hostjson.SORT_KEYS
+        if indent is not None:
+            flags |= _hostjson.HAS_INDENT
+
+        try:
+            text = _hostjson.encode(
+                data, flags,
+                (indent or '').encode('utf-8', 'surrogatepass'),
+                item_separator.encode('utf-8', 'surrogatepass'),
+                key_separator.encode('utf-8', 'surrogatepass'))
+        except ValueError:
+            return None
+        return text.decode('utf-8', 'surrogatepass')
+
+    def dumps(obj, *, skipkeys=False, ensure_ascii=True, check_circular=True,
+              allow_nan=True, cls=None, indent=None, separators=None,
+              default=None, sort_keys=False, **kw):
+        """json.dumps backed by the host formatter"""
+        if cls is None and default is None and not kw:
+            text = _encode(obj, skipkeys, ensure_ascii, allow_nan, indent, separators, sort_keys)
+            if text is not None:
+                return text
+        return original_dumps(
+            obj, skipkeys=skipkeys, ensure_ascii=ensure_ascii,
+            check_circular=check_circular, allow_nan=allow_nan, cls=cls,
+            indent=indent, separators=separators, default=default,
+            sort_keys=sort_keys, **kw)
+
+    def dump(obj, fp, *, skipkeys=False, ensure_ascii=True, check_circular=True,
+             allow_nan=True, cls=None, indent=None, separators=None,
+             default=None, sort_keys=False, **kw):
+        """json.dump backed by the host formatter"""
+        if cls is None and default is None and not kw:
+            text = _encode(obj, skipkeys, ensure_ascii, allow_nan, indent, separators, sort_keys)
+            if text is not None:
+                fp.write(text)
+                return
+        original_dump(
+            obj, fp, skipkeys=skipkeys, ensure_ascii=ensure_ascii,
+            check_circular=check_circular, allow_nan=allow_nan, cls=cls,
+            indent=indent, separators=separators, default=default,
+            sort_keys=sort_keys, **kw)
+
+    for patched, original in ((loads, original_loads), (dumps, original_dumps), (dump, original_dump)):
+        patched.__doc__ = original.__doc__
+        setattr(module, original.__name__, patched)
+
+
+if _hostjson is not None:
+    _hostpatch.when_imported('json', _patch_json)
@@ -0,0 +1,296 @@
+"""
+zlib module for WASM CPython, backed by the host runtime
+
+CPython's WASI build ships without zlib. This module provides the zlib API
+on top of the runtime's native DEFLATE codec, reached through the _zlibhost
+extension (src/python_extensions/zlibhost). The guest only passes buffers
+across; compression, decompression and checksums all run as host code.
+
+If _zlibhost was not compiled into the interpreter, the module still imports
+so that requests/urllib3 keep working, but compression raises error.
+"""
+
+try:
+    import _zlibhost
+except ImportError:
+    _zlibhost = None
+
+
+class error(Exception):
+    """Base class for zlib exceptions"""
+    pass
+
+
+# ============================================================================
+# Constants (same values as CPython's zlibmodule)
+# ============================================================================
+
+DEFLATED = 8
+DEF_BUF_SIZE = 16384
+DEF_MEM_LEVEL = 8
+MAX_WBITS = 15
+ZLIB_VERSION = "1.3.1"
+ZLIB_RUNTIME_VERSION = "1.3.1"
+
+Z_NO_COMPRESSION = 0
+Z_BEST_SPEED = 1
+Z_BEST_COMPRESSION = 9
+Z_DEFAULT_COMPRESSION = -1
+
+Z_DEFAULT_STRATEGY = 0
+Z_FILTERED = 1
+Z_HUFFMAN_ONLY = 2
+Z_RLE = 3
+Z_FIXED = 4
+
+Z_NO_FLUSH = 0
+Z_PARTIAL_FLUSH = 1
+Z_SYNC_FLUSH = 2
+Z_FULL_FLUSH = 3
+Z_FINISH = 4
+Z_BLOCK = 5
+Z_TREES = 6
+
+_MESSAGES = {
+    2: "need dictionary",
+    -2: "inconsistent stream state",
+    -3: "invalid input data",
+    -4: "insufficient memory",
+    -5: "incomplete or truncated stream",
+}
+
+
+def _raise(status, action):
+    raise error(f"Error {status} while {action}: {_MESSAGES.get(status, 'unknown error')}")
+
+
+def _require_host():
+    if _zlibhost is None:
+        raise error("zlib host functions are not available in this build")
+
+
+def _check_zdict(zdict):
+    if zdict:
+        raise error("zdict is not supported by the host zlib module")
+
+
+# ============================================================================
+# Checksums
+# ============================================================================
+
+def crc32(data, value=0, /):
+    """Compute a CRC-32 checksum of data, starting from value."""
+    if _zlibhost is None:
+        crc = ~value & 0xFFFFFFFF
+        for byte in bytes(data):
+            crc ^= byte
+            for _ in range(8):
+                crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1))
+        return ~crc & 0xFFFFFFFF
+    return _zlibhost.crc32(data, value & 0xFFFFFFFF)
+
+
+def adler32(data, value=1, /):
+    """Compute an Adler-32 checksum of data, starting from value."""
+    if _zlibhost is None:
+        a, b = value & 0xFFFF, (value >> 16) & 0xFFFF
+        for byte in bytes(data):
+            a = (a + byte) % 65521
+            b = (b + a) % 65521
+        return (b << 16) | a
+    return _zlibhost.adler32(data, value & 0xFFFFFFFF)
+
+
+# ============================================================================
+# Compression
+# ============================================================================
+
+class Compress:
+    """Compression object returned by compressobj()"""
+
+    def __init__(self, handle):
+        self._handle = handle
+
+    def __del__(self):
+        if self._handle is not None and _zlibhost is not None:
+            _zlibhost.end(self._handle)
+            self._handle = None
+
+    def _write(self, data, mode):
+        if self._handle is None:
+            _raise(-2, "compressing data")
+        try:
+            return _zlibhost.deflate_write(self._handle, data, mode)
+        except _zlibhost.ZlibHostError as e:
+            _raise(e.args[0], "compressing data")
+
+    def compress(self, data, /):
+        """Compress data, returning output that is ready so far."""
+        return self._write(data, Z_NO_FLUSH)
+
+    def flush(self, mode=Z_FINISH, /):
+        """Return remaining output; Z_FINISH ends the stream."""
+        if mode == Z_NO_FLUSH:
+            return b""
+        out = self._write(b"", mode)
+        if mode == Z_FINISH:
+            _zlibhost.end(self._handle)
+            self._handle = None
+        return out
+
+    def copy(self):
+        """Return a copy of the compression object."""
+        if self._handle is None:
+            raise ValueError("Inconsistent stream state")
+        return Compress(_zlibhost.copy(self._handle))
+
+    __copy__ = copy
+
+    def __deepcopy__(self, memo):
+        return self.copy()
+
+
+def compressobj(level=Z_DEFAULT_COMPRESSION, method=DEFLATED, wbits=MAX_WBITS,
+                memLevel=DEF_MEM_LEVEL, strategy=Z_DEFAULT_STRATEGY, zdict=None):
+    """Return a compressor object."""
+    _require_host()
+    _check_zdict(zdict)
+    if method != DEFLATED:
+        raise ValueError("Invalid initialization option")
+    # memLevel and strategy only tune zlib's internals; the host codec
+    # always uses its own settings
+    try:
+        return Compress(_zlibhost.deflate_init(level, wbits))
+    except _zlibhost.ZlibHostError:
+        raise ValueError("Invalid initialization option") from None
+
+
+def compress(data, /, level=Z_DEFAULT_COMPRESSION, wbits=MAX_WBITS):
+    """Returns a bytes object containing compressed data."""
+    compressor = compressobj(level, DEFLATED, wbits)
+    out = compressor._write(data, Z_FINISH)
+    _zlibhost.end(compressor._handle)
+    compressor._handle = None
+    return out
+
+
+# ============================================================================
+# Decompression
+# ============================================================================
+
+class Decompress:
+    """Decompression object returned by decompressobj()"""
+
+    def __init__(self, handle):
+        self._handle = handle
+        self.unused_data = b""
+        self.unconsumed_tail = b""
+        self.eof = False
+
+    def __del__(self):
+        if self._handle is not None and _zlibhost is not None:
+            _zlibhost.end(self._handle)
+            self._handle = None
+
+    def _feed(self, data, max_length):
+        try:
+            out, consumed, eof = _zlibhost.inflate_feed(self._handle, data, max_length)
+        except _zlibhost.ZlibHostError as e:
+            _raise(e.args[0], "decompressing data")
+        if eof:
+            self.eof = True
+            self.unused_data += bytes(data[consumed:])
+            self.unconsumed_tail = b""
+        else:
+            self.unconsumed_tail = bytes(data[consumed:])
+        return out
+
+    def decompress(self, data, /, max_length=0):
+        """Decompress data, returning at most max_length bytes (0 = no limit)."""
+        if max_length < 0:
+            raise ValueError("max_length must be non-negative")
+        if self.eof:
+            self.unused_data += bytes(data)
+            return b""
+        return self._feed(data, max_length)
+
+    def flush(self, length=DEF_BUF_SIZE, /):
+        """Return any remaining decompressed output."""
+        if length <= 0:
+            raise ValueError("length must be greater than zero")
+        if self.eof or self._handle is None:
+            return b""
+        return self._feed(self.unconsumed_tail, 0)
+
+    def copy(self):
+        """Return a copy of the decompression object."""
+        if self._handle is None:
+            raise ValueError("Inconsistent stream state")
+        other = Decompress(_zlibhost.copy(self._handle))
+        other.unused_data = self.unused_data
+        other.unconsumed_tail = self.unconsumed_tail
+        other.eof = self.eof
+        return other
+
+    __copy__ = copy
+
+    def __deepcopy__(self, memo):
+        return self.copy()
+
+
+def decompressobj(wbits=MAX_WBITS, zdict=b""):
+    """Return a decompressor object."""
+    _require_host()
+    _check_zdict(zdict)
+    try:
+        return Decompress(_zlibhost.inflate_init(wbits))
+    except _zlibhost.ZlibHostError:
+        raise ValueError("Invalid initialization option") from None
+
+
+def decompress(data, /, wbits=MAX_WBITS, bufsize=DEF_BUF_SIZE):
+    """Returns a bytes object containing the uncompressed data."""
+    if bufsize < 0:
+        raise ValueError("bufsize must be non-negative")
+    decompressor = decompressobj(wbits)
+    out = decompressor.decompress(data)
+    if not decompressor.eof:
+        _raise(-5, "decompressing data")
+    return out
+
+
+class _ZlibDecompressor:
+    """One-shot streaming decompressor used by gzip (CPython 3.12+ API)"""
+
+    def __init__(self, wbits=MAX_WBITS, zdict=b""):
+        _require_host()
+        _check_zdict(zdict)
+        self._decompressor = decompressobj(wbits)
+        self._buffer = b""
+        self.needs_input = True
+
+    @property
+    def eof(self):
+        return self._decompressor.eof
+
+    @property
+    def unused_data(self):
+        return self._decompressor.unused_data
+
+    def decompress(self, data, max_length=-1):
+        if self.eof:
+            raise EOFError("End of stream already reached")
+
+        d = self._decompressor
+        if max_length == 0:
+            self._buffer += bytes(data)
+            self.needs_input = False
+            return b""
+        out = d.decompress(self._buffer + bytes(data), max(max_length, 0))
+        self._buffer = d.unconsumed_tail
+
+        if d.eof or self._buffer:
+            self.needs_input = False
+        else:
+            self.needs_input = not (max_length >= 0 and len(out) == max_length)
+        return out
@@ -0,0 +1,135 @@
+"""
+Importer for bytecode packs
+
+compile_library.py writes each library as one .zpack file as well as a tree
+of .pyc files. The runtime puts the packs in site-packages, and this module
+installs a meta path finder that serves their modules. A pack is read with
+a single open and read when its library is first imported; every import
+after that unmarshals its code object from memory, skipping the
+stat/open/read sequence a path finder does for each module and each
+sys.path entry.
+
+Pack layout (little-endian):
+    4s   b'ZPK1'
+    4s   importlib magic number of the bytecode
+    u32  entry count
+    entries:
+        u16  len, bytes  module name (UTF-8), e.g. b'requests.adapters'
+        u8   flags       bit 0: package (__init__)
+        u32  offset      of the marshalled code object, from file start
+        u32  length
+    marshalled code objects
+
+Modules get the __file__ and __path__ they would have if loaded from the
+.pyc tree, so code looking near __file__ sees the same paths.
+"""
+
+import marshal
+import os
+import struct
+import sys
+from importlib.machinery import ModuleSpec
+from importlib.util import MAGIC_NUMBER
+
+_PACK_MAGIC = b'ZPK1'
+_FLAG_PACKAGE = 1
+
+
+class _Pack:
+    def __init__(self, path, data):
+        self.path = path
+        self.data = memoryview(data)
+        self.entries = {}
+        count = struct.unpack_from('<I', data, 8)[0]
+        offset = 12
+        for _ in range(count):
+            (name_len,) = struct.unpack_from('<H', data, offset)
+            offset += 2
+            name = bytes(data[offset:offset + name_len]).decode('utf-8')
+            offset += name_len
+            flags, blob_offset, blob_len = struct.unpack_from('<BII', data, offset)
+            offset += 9
+            self.entries[name] = (bool(flags & _FLAG_PACKAGE), blob_offset, blob_len)
+
+
+class PackLoader:
+    def __init__(self, pack, root):
+        self._pack = pack
+        self._root = root
+
+    def create_module(self, spec):
+        return None
+
+    def exec_module(self, module):
+        exec(self.get_code(module.__name__), module.__dict__)
+
+    def get_code(self, fullname):
+        _, offset, length = self._pack.entries[fullname]
+        return marshal.loads(self._pack.data[offset:offset + length])
+
+    def is_package(self, fullname):
+        return self._pack.entries[fullname][0]
+
+    def get_source(self, fullname):
+        return None
+
+
+class PackFinder:
+    """Meta path finder over every pack in a directory"""
+
+    def __init__(self, root):
+        self._root = root
+        self._modules = {}
+        # Packs not read yet, by the top-level package they hold (a pack
+        # is named after it); each is read when that package is imported
+        self._unread = {
+            name[:-len('.zpack')]: f'{root}/{name}'
+            for name in sorted(os.listdir(root))
+            if name.endswith('.zpack')
+        }
+
+    def _read(self, path):
+        with open(path, 'rb') as f:
+            data = f.read()
+        if data[:4] != _PACK_MAGIC or data[4:8] != MAGIC_NUMBER:
+            # Built for another Python version; its .pyc tree, if
+            # loaded, is used instead
+            return
+        pack = _Pack(path, data)
+        loader = PackLoader(pack, self._root)
+        for module in pack.entries:
+            self._modules.setdefault(module, (pack, loader))
+
+    def find_spec(self, fullname, path=None, target=None):
+        found = self._modules.get(fullname)
+        if found is None:
+            pack_path = self._unread.pop(fullname.partition('.')[0], None)
+            if pack_path is None:
+                return None
+            self._read(pack_path)
+            found = self._modules.get(fullname)
+            if found is None:
+                return None
+        pack, loader = found
+        is_package, _, _ = pack.entries[fullname]
+
+        location = f"{self._root}/{fullname.replace('.', '/')}"
+        spec = ModuleSpec(fullname, loader, origin=location + ('/__init__.pyc' if is_package else '.pyc'),
+                          is_package=is_package)
+        spec.has_location = True
+        if is_package:
+            spec.submodule_search_locations = [location]
+        return spec
+
+    def invalidate_caches(self):
+        pass
+
+
+def install(root):
+    """Serve the modules of every .zpack file in root ahead of other finders"""
+    if not os.path.isdir(root):
+        return None
+    finder = PackFinder(root)
+    if finder._unread:
+        sys.meta_path.insert(0, finder)
+    return finder
@@ -0,0 +1,74 @@
+"""
+Record dispatcher for --pipeline mode
+
+The host (src/pipeline.zig) compiles run() once, reads records from its
+input and calls run() with a batch of them at a time. run() calls the
+target function once per record and returns the results for the host to
+write out, so there is one host call per batch rather than per record.
+
+Batch payload (little-endian):
+    u32  len, bytes  target, "package.module:function"
+    u32  count
+    count times:
+        u32  len, bytes  record
+
+Returned payload, count times:
+    u32  len, bytes  result; len 0xFFFFFFFF if the function returned None,
+                     which writes nothing for the record
+
+Functions get each record as bytes and return bytes-like, str (written as
+UTF-8) or None. Their prints go to stderr, since stdout carries results.
+An exception aborts the pipeline with its traceback.
+"""
+
+import importlib
+import struct
+import sys
+
+_NO_RESULT = 0xFFFFFFFF
+
+# Resolved targets
+_functions = {}
+
+
+def _resolve(target):
+    module_name, sep, attr_path = target.partition(':')
+    if not sep or not module_name or not attr_path:
+        raise ValueError(f'pipeline target must be module:function, got {target!r}')
+    obj = importlib.import_module(module_name)
+    for attr in attr_path.split('.'):
+        obj = getattr(obj, attr)
+    return obj
+
+
+def run(payload):
+    """Run one batch; see the module docstring for the formats"""
+    view = memoryview(payload)
+    (target_len,) = struct.unpack_from('<I', view, 0)
+    target = bytes(view[4:4 + target_len]).decode('utf-8')
+    func = _functions.get(target)
+    if func is None:
+        func = _functions[target] = _resolve(target)
+    (count,) = struct.unpack_from('<I', view, 4 + target_len)
+    offset = 8 + target_len
+
+    out = bytearray()
+    pack = struct.pack
+    saved_stdout = sys.stdout
+    sys.stdout = sys.stderr
+    try:
+        for _ in range(count):
+            (length,) = struct.unpack_from('<I', view, offset)
+            offset += 4
+            result = func(bytes(view[offset:offset + length]))
+            offset += length
+            if result is None:
+                out += pack('<I', _NO_RESULT)
+                continue
+            if isinstance(result, str):
+                result = result.encode('utf-8', 'surrogatepass')
+            out += pack('<I', len(result))
+            out += result
+    finally:
+        sys.stdout = saved_stdout
+    return bytes(out)
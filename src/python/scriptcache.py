@@ -0,0 +1,54 @@
+"""
+Cached compilation of scripts
+
+The runtime (Runtime.runScript in src/runtime.zig) runs scripts through
+run(). Given a cache file, the code object compiled from a script is kept
+there, marshalled; the host names the file after a hash of the script's
+path and content, so a later run of the same script loads the code object
+instead of reading, parsing and compiling the source again.
+
+Cache file layout:
+    4s    importlib magic number; files from another Python are ignored
+    rest  marshalled code object
+"""
+
+import __main__
+import marshal
+import os
+from importlib.util import MAGIC_NUMBER
+
+
+def _load(cache_file):
+    try:
+        with open(cache_file, 'rb') as f:
+            data = f.read()
+    except OSError:
+        return None
+    if data[:4] != MAGIC_NUMBER:
+        return None
+    try:
+        return marshal.loads(memoryview(data)[4:])
+    except (EOFError, ValueError, TypeError):
+        return None
+
+
+def _store(cache_file, code):
+    try:
+        os.makedirs(os.path.dirname(cache_file), exist_ok=True)
+        with open(cache_file, 'wb') as f:
+            f.write(MAGIC_NUMBER + marshal.dumps(code))
+    except OSError:
+        # A full quota only costs the next run a compile
+        pass
+
+
+def run(path, cache_file=None):
+    """Run the script at path in __main__, as exec(open(path).read()) would"""
+    code = _load(cache_file) if cache_file else None
+    if code is None:
+        with open(path, 'rb') as f:
+            source = f.read()
+        code = compile(source, path, 'exec')
+        if cache_file:
+            _store(cache_file, code)
+    exec(code, __main__.__dict__)
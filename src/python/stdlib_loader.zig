@@ -17,11 +17,14 @@ fn debug_print(comptime fmt: []const u8, args: anytype) void {
 }
 
 /// Recursively load a directory tree into VFS
-/// Filters out test directories, caches, and non-essential files to save memory
+/// Filters out test directories, caches, and non-essential files to save memory.
+/// Sources with a .pyc in the matching directory under bytecode_dir_path are
+/// skipped: Python prefers a source over a sourceless .pyc next to it.
 pub fn loadDirectoryIntoVFS(
     vfs: *VirtualFileSystem,
     vfs_base_path: []const u8,
     real_dir_path: []const u8,
+    bytecode_dir_path: ?[]const u8,
     allocator: std.mem.Allocator,
 ) !void {
     var dir = try std.fs.openDirAbsolute(real_dir_path, .{ .iterate = true });
@@ -47,12 +50,19 @@ pub fn loadDirectoryIntoVFS(
 
                 dir_count += 1;
                 try vfs.mkdirp(vfs_entry_path);
+
+                const bytecode_entry_path = if (bytecode_dir_path) |path|
+                    try std.fmt.allocPrint(allocator, "{s}/{s}", .{ path, entry.name })
+                else
+                    null;
+                defer if (bytecode_entry_path) |path| allocator.free(path);
+
                 // Recursively load subdirectory
-                try loadDirectoryIntoVFS(vfs, vfs_entry_path, real_entry_path, allocator);
+                try loadDirectoryIntoVFS(vfs, vfs_entry_path, real_entry_path, bytecode_entry_path, allocator);
             },
             .file => {
                 // Only load Python files and essential files
-                if (shouldLoadFile(entry.name)) {
+                if (shouldLoadFile(entry.name) and !try hasBytecode(bytecode_dir_path, entry.name, allocator)) {
                     const file = try std.fs.openFileAbsolute(real_entry_path, .{});
                     defer file.close();
 
@@ -72,6 +82,17 @@ pub fn loadDirectoryIntoVFS(
     }
 }
 
+/// Whether a precompiled .pyc replaces the source file name
+fn hasBytecode(bytecode_dir_path: ?[]const u8, name: []const u8, allocator: std.mem.Allocator) !bool {
+    const dir_path = bytecode_dir_path orelse return false;
+    if (!std.mem.endsWith(u8, name, ".py")) return false;
+
+    const pyc_path = try std.fmt.allocPrint(allocator, "{s}/{s}c", .{ dir_path, name });
+    defer allocator.free(pyc_path);
+    std.fs.accessAbsolute(pyc_path, .{}) catch return false;
+    return true;
+}
+
 /// Determine if a directory should be skipped to save memory
 fn shouldSkipDirectory(name: []const u8) bool {
     const skip_dirs = [_][]const u8{
@@ -114,10 +135,13 @@ fn shouldLoadFile(name: []const u8) bool {
 /// Load a compiled bytecode library into VFS
 /// This function loads ONLY pre-compiled .pyc files from __pycache__ directories
 /// Python will use these bytecode files directly without requiring source .py files
+/// With lazy, files are mapped from the host rather than read (see
+/// VirtualFileSystem.mapFile)
 pub fn loadBytecodeLibrary(
     vfs: *VirtualFileSystem,
     vfs_library_path: []const u8,
     real_bytecode_path: []const u8,
+    lazy: bool,
     allocator: std.mem.Allocator,
 ) !void {
     debug_print("Loading bytecode library into VFS...\n", .{});
@@ -128,16 +152,51 @@ pub fn loadBytecodeLibrary(
     try vfs.mkdirp(vfs_library_path);
 
     // Recursively load all .pyc files from __pycache__ directories
-    try loadBytecodeDirectoryIntoVFS(vfs, vfs_library_path, real_bytecode_path, allocator);
+    try loadBytecodeDirectoryIntoVFS(vfs, vfs_library_path, real_bytecode_path, lazy, allocator);
 
     debug_print("Bytecode library loaded: {s}\n", .{vfs_library_path});
 }
 
+/// Load a library's bytecode pack (compiled_libs/<name>.zpack) into the VFS
+/// as a single file, for the guest's pack importer to serve modules from.
+/// With lazy, the pack is mapped from the host rather than read. Returns
+/// false if the library has no pack.
+pub fn loadBytecodePack(
+    vfs: *VirtualFileSystem,
+    vfs_pack_path: []const u8,
+    real_pack_path: []const u8,
+    lazy: bool,
+    allocator: std.mem.Allocator,
+) !bool {
+    if (lazy) {
+        vfs.mapFile(vfs_pack_path, real_pack_path) catch |err| switch (err) {
+            error.FileNotFound => return false,
+            else => return err,
+        };
+        debug_print("Bytecode pack mapped: {s}\n", .{vfs_pack_path});
+        return true;
+    }
+
+    const file = std.fs.openFileAbsolute(real_pack_path, .{}) catch |err| switch (err) {
+        error.FileNotFound => return false,
+        else => return err,
+    };
+    defer file.close();
+
+    const content = try file.readToEndAlloc(allocator, 64 * 1024 * 1024); // Max 64MB
+    defer allocator.free(content);
+
+    try vfs.createFile(vfs_pack_path, content);
+    debug_print("Bytecode pack loaded: {s} ({} bytes)\n", .{ vfs_pack_path, content.len });
+    return true;
+}
+
 /// Recursively load bytecode files from __pycache__ directories
 fn loadBytecodeDirectoryIntoVFS(
     vfs: *VirtualFileSystem,
     vfs_base_path: []const u8,
     real_dir_path: []const u8,
+    lazy: bool,
     allocator: std.mem.Allocator,
 ) !void {
     var dir = try std.fs.openDirAbsolute(real_dir_path, .{ .iterate = true });
@@ -162,20 +221,24 @@ fn loadBytecodeDirectoryIntoVFS(
                 // Create directory in VFS
                 try vfs.mkdirp(vfs_entry_path);
                 // Recursively load subdirectory
-                try loadBytecodeDirectoryIntoVFS(vfs, vfs_entry_path, real_entry_path, allocator);
+                try loadBytecodeDirectoryIntoVFS(vfs, vfs_entry_path, real_entry_path, lazy, allocator);
             },
             .file => {
                 // Only load .pyc files and MANIFEST.txt
                 if (std.mem.endsWith(u8, entry.name, ".pyc") or
                     std.mem.eql(u8, entry.name, "MANIFEST.txt"))
                 {
-                    const file = try std.fs.openFileAbsolute(real_entry_path, .{});
-                    defer file.close();
+                    if (lazy) {
+                        try vfs.mapFile(vfs_entry_path, real_entry_path);
+                    } else {
+                        const file = try std.fs.openFileAbsolute(real_entry_path, .{});
+                        defer file.close();
 
-                    const content = try file.readToEndAlloc(allocator, 10 * 1024 * 1024); // Max 10MB
-                    defer allocator.free(content);
+                        const content = try file.readToEndAlloc(allocator, 10 * 1024 * 1024); // Max 10MB
+                        defer allocator.free(content);
 
-                    try vfs.createFile(vfs_entry_path, content);
+                        try vfs.createFile(vfs_entry_path, content);
+                    }
                     file_count += 1;
 
                     debug_print("  Loaded bytecode: {s}\n", .{entry.name});
@@ -191,18 +254,24 @@ fn loadBytecodeDirectoryIntoVFS(
 }
 
 /// Load Python standard library into VFS
-/// This is the main entry point for loading the stdlib
+/// This is the main entry point for loading the stdlib. With
+/// bytecode_path (the stdlib precompiled by compile_library.py --stdlib),
+/// its .pyc files are loaded and only sources it lacks are read.
 pub fn loadStdlib(
     vfs: *VirtualFileSystem,
     vfs_stdlib_path: []const u8,
     real_stdlib_path: []const u8,
+    bytecode_path: ?[]const u8,
     allocator: std.mem.Allocator,
 ) !void {
     debug_print("Loading Python stdlib into VFS (minimal subset)...\n", .{});
     debug_print("  Source: {s}\n", .{real_stdlib_path});
     debug_print("  Target: {s}\n", .{vfs_stdlib_path});
 
-    try loadDirectoryIntoVFS(vfs, vfs_stdlib_path, real_stdlib_path, allocator);
+    if (bytecode_path) |path| {
+        try loadBytecodeLibrary(vfs, vfs_stdlib_path, path, false, allocator);
+    }
+    try loadDirectoryIntoVFS(vfs, vfs_stdlib_path, real_stdlib_path, bytecode_path, allocator);
 
     debug_print("Python stdlib loaded successfully\n", .{});
 }
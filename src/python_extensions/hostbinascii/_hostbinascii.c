@@ -0,0 +1,391 @@
+/*
+ * _hostbinascii - Python C Extension for Host-Side Binary Transforms
+ *
+ * This extension wraps the base64/hex/XOR host functions implemented in the
+ * zig-wasm-cpython runtime. binascii itself is C, but under the WASM
+ * interpreter every byte it touches is an interpreted instruction; the host
+ * versions run vectorized over linear memory and write straight into the
+ * result bytes object.
+ *
+ * WASI Functions Wrapped:
+ *   - binascii_b64encode / binascii_b64decode: Base64 with any altchars
+ *   - binascii_hexlify / binascii_unhexlify: Hex encoding
+ *   - binascii_xor: XOR with a repeating key
+ *   - binascii_translate: 256-byte table lookup
+ *
+ * Build: This module must be compiled as part of CPython WASI build
+ */
+
+#include <Python.h>
+#include <stdint.h>
+
+/* ============================================================================
+ * WASI Binascii Function Imports
+ * ============================================================================
+ * These functions are provided by the WASM runtime (zig-wasm-cpython).
+ * They are imported from the wasi_snapshot_preview1 module namespace.
+ */
+
+__attribute__((import_module("wasi_snapshot_preview1")))
+__attribute__((import_name("binascii_b64encode")))
+int32_t wasi_binascii_b64encode(
+    int32_t src_ptr,
+    int32_t src_len,
+    int32_t dst_ptr,
+    int32_t dst_len,
+    int32_t altchars
+);
+
+__attribute__((import_module("wasi_snapshot_preview1")))
+__attribute__((import_name("binascii_b64decode")))
+int32_t wasi_binascii_b64decode(
+    int32_t src_ptr,
+    int32_t src_len,
+    int32_t dst_ptr,
+    int32_t dst_cap,
+    int32_t altchars,
+    uint32_t* out_len_ptr
+);
+
+__attribute__((import_module("wasi_snapshot_preview1")))
+__attribute__((import_name("binascii_hexlify")))
+int32_t wasi_binascii_hexlify(
+    int32_t src_ptr,
+    int32_t src_len,
+    int32_t dst_ptr,
+    int32_t dst_len
+);
+
+__attribute__((import_module("wasi_snapshot_preview1")))
+__attribute__((import_name("binascii_unhexlify")))
+int32_t wasi_binascii_unhexlify(
+    int32_t src_ptr,
+    int32_t src_len,
+    int32_t dst_ptr,
+    int32_t dst_len
+);
+
+__attribute__((import_module("wasi_snapshot_preview1")))
+__attribute__((import_name("binascii_xor")))
+int32_t wasi_binascii_xor(
+    int32_t data_ptr,
+    int32_t data_len,
+    int32_t key_ptr,
+    int32_t key_len
+);
+
+__attribute__((import_module("wasi_snapshot_preview1")))
+__attribute__((import_name("binascii_translate")))
+int32_t wasi_binascii_translate(
+    int32_t data_ptr,
+    int32_t data_len,
+    int32_t table_ptr
+);
+
+/* ============================================================================
+ * Helper Functions
+ * ============================================================================ */
+
+/* Returned for input the host does not handle (non-canonical encodings) */
+#define BINASCII_EILSEQ 25
+
+static PyObject* binascii_error_from_errno(int32_t err) {
+    if (err == BINASCII_EILSEQ) {
+        PyErr_SetString(PyExc_ValueError, "input not supported by host binascii");
+        return NULL;
+    }
+    errno = err;
+    return PyErr_SetFromErrno(PyExc_OSError);
+}
+
+/* Finish a call that filled `result`: return it, or drop it and raise */
+static PyObject* finish(PyObject* result, int32_t err) {
+    if (err != 0) {
+        Py_DECREF(result);
+        return binascii_error_from_errno(err);
+    }
+    return result;
+}
+
+static int parse_altchars(Py_buffer* altchars, int32_t* packed) {
+    if (altchars->len != 2) {
+        PyErr_SetString(PyExc_ValueError, "altchars must be 2 bytes");
+        return -1;
+    }
+    const unsigned char* chars = altchars->buf;
+    *packed = (int32_t)(chars[0] | (chars[1] << 8));
+    return 0;
+}
+
+/* ============================================================================
+ * Python Function: b64encode(data, altchars, newline) -> bytes
+ * ============================================================================ */
+static PyObject* py_b64encode(PyObject* self, PyObject* args) {
+    Py_buffer data, altchars;
+    int newline;
+    int32_t alt;
+
+    if (!PyArg_ParseTuple(args, "y*y*p", &data, &altchars, &newline)) {
+        return NULL;
+    }
+    int bad_alt = parse_altchars(&altchars, &alt);
+    PyBuffer_Release(&altchars);
+    if (bad_alt < 0) {
+        PyBuffer_Release(&data);
+        return NULL;
+    }
+
+    Py_ssize_t encoded_len = (data.len + 2) / 3 * 4;
+    PyObject* result = PyBytes_FromStringAndSize(NULL, encoded_len + (newline ? 1 : 0));
+    if (!result) {
+        PyBuffer_Release(&data);
+        return NULL;
+    }
+    char* out = PyBytes_AS_STRING(result);
+    if (newline) {
+        out[encoded_len] = '\n';
+    }
+
+    int32_t err = wasi_binascii_b64encode(
+        (int32_t)(uintptr_t)data.buf,
+        (int32_t)data.len,
+        (int32_t)(uintptr_t)out,
+        (int32_t)encoded_len,
+        alt
+    );
+    PyBuffer_Release(&data);
+    return finish(result, err);
+}
+
+/* ============================================================================
+ * Python Function: b64decode(data, altchars) -> bytes
+ * ============================================================================ */
+static PyObject* py_b64decode(PyObject* self, PyObject* args) {
+    Py_buffer data, altchars;
+    int32_t alt;
+
+    if (!PyArg_ParseTuple(args, "y*y*", &data, &altchars)) {
+        return NULL;
+    }
+    int bad_alt = parse_altchars(&altchars, &alt);
+    PyBuffer_Release(&altchars);
+    if (bad_alt < 0) {
+        PyBuffer_Release(&data);
+        return NULL;
+    }
+
+    /* Canonical input decodes to exactly this many bytes; the host
+     * rejects everything else */
+    const char* chars = data.buf;
+    Py_ssize_t decoded_len = data.len / 4 * 3;
+    if (data.len % 4 == 0 && data.len > 0) {
+        decoded_len -= (chars[data.len - 1] == '=') + (chars[data.len - 2] == '=');
+    }
+
+    PyObject* result = PyBytes_FromStringAndSize(NULL, decoded_len);
+    if (!result) {
+        PyBuffer_Release(&data);
+        return NULL;
+    }
+
+    uint32_t out_len = 0;
+    int32_t err = wasi_binascii_b64decode(
+        (int32_t)(uintptr_t)data.buf,
+        (int32_t)data.len,
+        (int32_t)(uintptr_t)PyBytes_AS_STRING(result),
+        (int32_t)decoded_len,
+        alt,
+        &out_len
+    );
+    PyBuffer_Release(&data);
+    return finish(result, err);
+}
+
+/* ============================================================================
+ * Python Function: hexlify(data) -> bytes
+ * ============================================================================ */
+static PyObject* py_hexlify(PyObject* self, PyObject* args) {
+    Py_buffer data;
+
+    if (!PyArg_ParseTuple(args, "y*", &data)) {
+        return NULL;
+    }
+
+    PyObject* result = PyBytes_FromStringAndSize(NULL, data.len * 2);
+    if (!result) {
+        PyBuffer_Release(&data);
+        return NULL;
+    }
+
+    int32_t err = wasi_binascii_hexlify(
+        (int32_t)(uintptr_t)data.buf,
+        (int32_t)data.len,
+        (int32_t)(uintptr_t)PyBytes_AS_STRING(result),
+        (int32_t)(data.len * 2)
+    );
+    PyBuffer_Release(&data);
+    return finish(result, err);
+}
+
+/* ============================================================================
+ * Python Function: unhexlify(data) -> bytes
+ * ============================================================================ */
+static PyObject* py_unhexlify(PyObject* self, PyObject* args) {
+    Py_buffer data;
+
+    if (!PyArg_ParseTuple(args, "y*", &data)) {
+        return NULL;
+    }
+
+    PyObject* result = PyBytes_FromStringAndSize(NULL, data.len / 2);
+    if (!result) {
+        PyBuffer_Release(&data);
+        return NULL;
+    }
+
+    int32_t err = wasi_binascii_unhexlify(
+        (int32_t)(uintptr_t)data.buf,
+        (int32_t)data.len,
+        (int32_t)(uintptr_t)PyBytes_AS_STRING(result),
+        (int32_t)(data.len / 2)
+    );
+    PyBuffer_Release(&data);
+    return finish(result, err);
+}
+
+/* ============================================================================
+ * Python Function: xor(data, key) -> bytes
+ * ============================================================================ */
+static PyObject* py_xor(PyObject* self, PyObject* args) {
+    Py_buffer data, key;
+
+    if (!PyArg_ParseTuple(args, "y*y*", &data, &key)) {
+        return NULL;
+    }
+    if (key.len == 0) {
+        PyBuffer_Release(&data);
+        PyBuffer_Release(&key);
+        PyErr_SetString(PyExc_ValueError, "key must not be empty");
+        return NULL;
+    }
+
+    PyObject* result = PyBytes_FromStringAndSize(data.buf, data.len);
+    PyBuffer_Release(&data);
+    if (!result) {
+        PyBuffer_Release(&key);
+        return NULL;
+    }
+
+    int32_t err = wasi_binascii_xor(
+        (int32_t)(uintptr_t)PyBytes_AS_STRING(result),
+        (int32_t)PyBytes_GET_SIZE(result),
+        (int32_t)(uintptr_t)key.buf,
+        (int32_t)key.len
+    );
+    PyBuffer_Release(&key);
+    return finish(result, err);
+}
+
+/* ============================================================================
+ * Python Function: translate(data, table) -> bytes
+ * ============================================================================ */
+static PyObject* py_translate(PyObject* self, PyObject* args) {
+    Py_buffer data, table;
+
+    if (!PyArg_ParseTuple(args, "y*y*", &data, &table)) {
+        return NULL;
+    }
+    if (table.len != 256) {
+        PyBuffer_Release(&data);
+        PyBuffer_Release(&table);
+        PyErr_SetString(PyExc_ValueError, "translation table must be 256 characters long");
+        return NULL;
+    }
+
+    PyObject* result = PyBytes_FromStringAndSize(data.buf, data.len);
+    PyBuffer_Release(&data);
+    if (!result) {
+        PyBuffer_Release(&table);
+        return NULL;
+    }
+
+    int32_t err = wasi_binascii_translate(
+        (int32_t)(uintptr_t)PyBytes_AS_STRING(result),
+        (int32_t)PyBytes_GET_SIZE(result),
+        (int32_t)(uintptr_t)table.buf
+    );
+    PyBuffer_Release(&table);
+    return finish(result, err);
+}
+
+/* ============================================================================
+ * Method Table
+ * ============================================================================ */
+static PyMethodDef HostBinasciiMethods[] = {
+    {
+        "b64encode",
+        py_b64encode,
+        METH_VARARGS,
+        "b64encode(data, altchars, newline) -> bytes\n\n"
+        "Base64-encode data using altchars (2 bytes) for values 62 and 63,\n"
+        "optionally followed by a newline."
+    },
+    {
+        "b64decode",
+        py_b64decode,
+        METH_VARARGS,
+        "b64decode(data, altchars) -> bytes\n\n"
+        "Decode canonical base64 (whole quads, padding only at the end, no\n"
+        "whitespace). Raises ValueError for anything else; binascii handles\n"
+        "those cases."
+    },
+    {
+        "hexlify",
+        py_hexlify,
+        METH_VARARGS,
+        "hexlify(data) -> bytes\n\n"
+        "Lowercase hexadecimal representation of data."
+    },
+    {
+        "unhexlify",
+        py_unhexlify,
+        METH_VARARGS,
+        "unhexlify(data) -> bytes\n\n"
+        "Decode an even-length hex string. Raises ValueError otherwise."
+    },
+    {
+        "xor",
+        py_xor,
+        METH_VARARGS,
+        "xor(data, key) -> bytes\n\n"
+        "XOR data with key repeated to its length."
+    },
+    {
+        "translate",
+        py_translate,
+        METH_VARARGS,
+        "translate(data, table) -> bytes\n\n"
+        "Map every byte of data through a 256-byte table."
+    },
+    {NULL, NULL, 0, NULL}  // Sentinel
+};
+
+/* ============================================================================
+ * Module Definition
+ * ============================================================================ */
+static struct PyModuleDef hostbinasciimodule = {
+    PyModuleDef_HEAD_INIT,
+    "_hostbinascii",
+    "Low-level host binary transform interface.\n\n"
+    "binascii and base64 are patched to use it automatically for large\n"
+    "inputs; see binascii_patch.py.",
+    -1,
+    HostBinasciiMethods
+};
+
+/* ============================================================================
+ * Module Initialization
+ * ============================================================================ */
+PyMODINIT_FUNC PyInit__hostbinascii(void) {
+    return PyModule_Create(&hostbinasciimodule);
+}
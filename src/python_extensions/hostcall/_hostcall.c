@@ -0,0 +1,370 @@
+/*
+ * _hostcall - Guest Exports for the Embedding Runtime API
+ *
+ * The other host extensions call out of the guest; this one is called in.
+ * It exports a small ABI that the zig-wasm-cpython Runtime (src/runtime.zig)
+ * invokes directly, so a host service can compile a Python callable once
+ * and call it many times with bytes in and bytes out, without going
+ * through PyRun_SimpleString or spawning a process.
+ *
+ * WASM Functions Exported:
+ *   - hostcall_alloc / hostcall_free: The guest's malloc, for argument and
+ *     result buffers the host fills or reads
+ *   - hostcall_compile: Exec source in a fresh namespace and keep one of
+ *     its callables
+ *   - hostcall_invoke: Call a kept callable with a bytes argument
+ *   - hostcall_release: Drop a kept callable
+ *   - hostcall_error: Text of the last Python exception
+ *   - hostcall_interrupt: Where the host writes to interrupt a running
+ *     call (see Deadlines below)
+ *
+ * Python Functions:
+ *   - _hostcall.acknowledge_deadline(): Stop the host re-raising
+ *     DeadlineExceeded for the rest of the current call
+ *
+ * Build: This module must be compiled as part of CPython WASI build
+ */
+
+#include <Python.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* ============================================================================
+ * Status Codes
+ * ============================================================================
+ * Mirrored by HostcallStatus in src/runtime.zig.
+ */
+
+#define HOSTCALL_OK        0
+#define HOSTCALL_EXCEPTION 1  /* Python raised; see hostcall_error */
+#define HOSTCALL_EINVAL    28 /* Unknown handle */
+#define HOSTCALL_ENOMEM    48
+
+#define HOSTCALL_EXPORT(name) __attribute__((export_name(#name)))
+
+/* ============================================================================
+ * Callable Table
+ * ============================================================================
+ * Handles are 1-based slot indices; released slots are reused.
+ */
+
+static PyObject** callables = NULL;
+static uint32_t callables_cap = 0;
+
+static char* last_error = NULL;
+static uint32_t last_error_len = 0;
+
+static PyObject* lookup(uint32_t handle) {
+    if (handle == 0 || handle > callables_cap) {
+        return NULL;
+    }
+    return callables[handle - 1];
+}
+
+static int32_t store_callable(PyObject* callable, uint32_t* handle_ptr) {
+    uint32_t slot = 0;
+    while (slot < callables_cap && callables[slot] != NULL) {
+        slot++;
+    }
+    if (slot == callables_cap) {
+        uint32_t new_cap = callables_cap ? callables_cap * 2 : 16;
+        PyObject** grown = realloc(callables, new_cap * sizeof(PyObject*));
+        if (!grown) {
+            return HOSTCALL_ENOMEM;
+        }
+        memset(grown + callables_cap, 0, (new_cap - callables_cap) * sizeof(PyObject*));
+        callables = grown;
+        callables_cap = new_cap;
+    }
+    Py_INCREF(callable);
+    callables[slot] = callable;
+    *handle_ptr = slot + 1;
+    return HOSTCALL_OK;
+}
+
+/* ============================================================================
+ * Deadlines
+ * ============================================================================
+ * The host's watchdog (src/deadline.zig) interrupts a call that runs past
+ * its deadline from another thread, without calling into the guest: it
+ * stores DeadlineExceeded as the thread state's pending async exception
+ * and sets the eval breaker bit that makes the interpreter raise it at its
+ * next check (every loop back-edge and call). C code that never returns to
+ * the eval loop is not interrupted.
+ *
+ * The host stores the exception again every few milliseconds until the
+ * call returns, so code that catches it still stops, unless it calls
+ * acknowledge_deadline() to take over the timeout itself.
+ */
+
+/* _PY_ASYNC_EXCEPTION_BIT in Include/internal/pycore_ceval.h */
+#define ASYNC_EXCEPTION_BIT (1u << 3)
+
+static PyObject* deadline_exceeded = NULL;
+
+/* Set by the guest, cleared by the host when it arms a deadline */
+static volatile uint32_t deadline_acknowledged = 0;
+
+/*
+ * The exception type, created on first use. It is made immortal: the
+ * interpreter drops a reference each time it raises the pending exception,
+ * and the host stores it without taking one.
+ */
+static PyObject* get_deadline_exceeded(void) {
+    if (!deadline_exceeded) {
+        deadline_exceeded = PyErr_NewExceptionWithDoc(
+            "_hostcall.DeadlineExceeded",
+            "Raised by the host in a call that ran past its deadline.",
+            PyExc_BaseException, NULL);
+        if (deadline_exceeded) {
+            Py_SET_REFCNT(deadline_exceeded, _Py_IMMORTAL_REFCNT);
+        }
+    }
+    return deadline_exceeded;
+}
+
+/* ============================================================================
+ * Helper Functions
+ * ============================================================================ */
+
+/* Save "Type: message" for the pending exception and clear it */
+static int32_t capture_exception(void) {
+    PyObject* exc = PyErr_GetRaisedException();
+    PyObject* text = NULL;
+    if (exc) {
+        text = PyUnicode_FromFormat("%s: %S", Py_TYPE(exc)->tp_name, exc);
+        Py_DECREF(exc);
+    }
+
+    Py_ssize_t len = 0;
+    const char* utf8 = text ? PyUnicode_AsUTF8AndSize(text, &len) : NULL;
+    if (!utf8) {
+        PyErr_Clear();
+        utf8 = "error while formatting the exception";
+        len = (Py_ssize_t)strlen(utf8);
+    }
+
+    free(last_error);
+    last_error = malloc((size_t)len);
+    last_error_len = last_error ? (uint32_t)len : 0;
+    if (last_error) {
+        memcpy(last_error, utf8, (size_t)len);
+    }
+    Py_XDECREF(text);
+    return HOSTCALL_EXCEPTION;
+}
+
+/* ============================================================================
+ * Exported Functions
+ * ============================================================================ */
+
+HOSTCALL_EXPORT(hostcall_alloc)
+void* hostcall_alloc(uint32_t size) {
+    return malloc(size ? size : 1);
+}
+
+HOSTCALL_EXPORT(hostcall_free)
+void hostcall_free(void* ptr) {
+    free(ptr);
+}
+
+/*
+ * Exec src (UTF-8 module source) in a fresh namespace and keep the object
+ * bound to name. The namespace lives as long as the callable does.
+ */
+HOSTCALL_EXPORT(hostcall_compile)
+int32_t hostcall_compile(const char* src, uint32_t src_len,
+                         const char* name, uint32_t name_len,
+                         uint32_t* handle_ptr) {
+    PyObject* globals = NULL;
+    PyObject* code = NULL;
+    PyObject* result = NULL;
+    PyObject* callable = NULL;
+    PyObject* key = NULL;
+    int32_t status;
+
+    /* Py_CompileString needs a NUL-terminated source */
+    char* source = malloc((size_t)src_len + 1);
+    if (!source) {
+        return HOSTCALL_ENOMEM;
+    }
+    memcpy(source, src, src_len);
+    source[src_len] = '\0';
+
+    globals = PyDict_New();
+    if (!globals ||
+        PyDict_SetItemString(globals, "__builtins__", PyEval_GetBuiltins()) < 0) {
+        goto error;
+    }
+    key = PyUnicode_FromString("__hostcall__");
+    if (!key || PyDict_SetItemString(globals, "__name__", key) < 0) {
+        goto error;
+    }
+    Py_CLEAR(key);
+
+    code = Py_CompileString(source, "<hostcall>", Py_file_input);
+    if (!code) {
+        goto error;
+    }
+    result = PyEval_EvalCode(code, globals, globals);
+    if (!result) {
+        goto error;
+    }
+
+    key = PyUnicode_DecodeUTF8(name, name_len, "strict");
+    if (!key) {
+        goto error;
+    }
+    callable = PyDict_GetItemWithError(globals, key);
+    if (!callable) {
+        if (!PyErr_Occurred()) {
+            PyErr_Format(PyExc_NameError, "name '%U' is not defined", key);
+        }
+        goto error;
+    }
+    if (!PyCallable_Check(callable)) {
+        PyErr_Format(PyExc_TypeError, "'%s' object is not callable", Py_TYPE(callable)->tp_name);
+        goto error;
+    }
+
+    status = store_callable(callable, handle_ptr);
+    goto done;
+
+error:
+    status = capture_exception();
+done:
+    free(source);
+    Py_XDECREF(key);
+    Py_XDECREF(result);
+    Py_XDECREF(code);
+    Py_XDECREF(globals);
+    return status;
+}
+
+/*
+ * Call a kept callable with bytes(input). On success result_ptr[0..2]
+ * receives a malloc'd copy of the returned bytes-like object and its
+ * length; the host frees it with hostcall_free.
+ */
+HOSTCALL_EXPORT(hostcall_invoke)
+int32_t hostcall_invoke(uint32_t handle, const char* in, uint32_t in_len,
+                        uint32_t* result_ptr) {
+    PyObject* callable = lookup(handle);
+    if (!callable) {
+        return HOSTCALL_EINVAL;
+    }
+
+    PyObject* arg = PyBytes_FromStringAndSize(in, in_len);
+    if (!arg) {
+        return capture_exception();
+    }
+    PyObject* ret = PyObject_CallOneArg(callable, arg);
+    Py_DECREF(arg);
+    if (!ret) {
+        return capture_exception();
+    }
+
+    Py_buffer view;
+    if (PyObject_GetBuffer(ret, &view, PyBUF_SIMPLE) < 0) {
+        Py_DECREF(ret);
+        return capture_exception();
+    }
+
+    int32_t status = HOSTCALL_OK;
+    char* out = malloc(view.len ? (size_t)view.len : 1);
+    if (out) {
+        memcpy(out, view.buf, (size_t)view.len);
+        result_ptr[0] = (uint32_t)(uintptr_t)out;
+        result_ptr[1] = (uint32_t)view.len;
+    } else {
+        status = HOSTCALL_ENOMEM;
+    }
+    PyBuffer_Release(&view);
+    Py_DECREF(ret);
+    return status;
+}
+
+HOSTCALL_EXPORT(hostcall_release)
+int32_t hostcall_release(uint32_t handle) {
+    PyObject* callable = lookup(handle);
+    if (!callable) {
+        return HOSTCALL_EINVAL;
+    }
+    callables[handle - 1] = NULL;
+    Py_DECREF(callable);
+    return HOSTCALL_OK;
+}
+
+/* Point result_ptr[0..2] at the last exception text (owned by the guest) */
+HOSTCALL_EXPORT(hostcall_error)
+void hostcall_error(uint32_t* result_ptr) {
+    result_ptr[0] = (uint32_t)(uintptr_t)last_error;
+    result_ptr[1] = last_error_len;
+}
+
+/*
+ * Write what the host needs to interrupt the running thread to
+ * slots_ptr[0..5]: the address of its eval breaker, the bit to set there,
+ * the address of its pending async exception, the exception to store
+ * there, and the address of the acknowledgement flag.
+ */
+HOSTCALL_EXPORT(hostcall_interrupt)
+int32_t hostcall_interrupt(uint32_t* slots_ptr) {
+    PyThreadState* tstate = PyThreadState_Get();
+    PyObject* exc = get_deadline_exceeded();
+    if (!exc) {
+        return capture_exception();
+    }
+    slots_ptr[0] = (uint32_t)(uintptr_t)&tstate->eval_breaker;
+    slots_ptr[1] = ASYNC_EXCEPTION_BIT;
+    slots_ptr[2] = (uint32_t)(uintptr_t)&tstate->async_exc;
+    slots_ptr[3] = (uint32_t)(uintptr_t)exc;
+    slots_ptr[4] = (uint32_t)(uintptr_t)&deadline_acknowledged;
+    return HOSTCALL_OK;
+}
+
+/* ============================================================================
+ * Python Functions
+ * ============================================================================ */
+
+static PyObject* acknowledge_deadline(PyObject* self, PyObject* unused) {
+    deadline_acknowledged = 1;
+    Py_RETURN_NONE;
+}
+
+static PyMethodDef hostcall_methods[] = {
+    {"acknowledge_deadline", acknowledge_deadline, METH_NOARGS,
+     "Stop the host raising DeadlineExceeded again in the current call."},
+    {NULL, NULL, 0, NULL}
+};
+
+/* ============================================================================
+ * Module Definition
+ * ============================================================================
+ * The exports above work without importing the module; Setup.local links
+ * this object into the interpreter through it.
+ */
+static struct PyModuleDef hostcallmodule = {
+    PyModuleDef_HEAD_INIT,
+    "_hostcall",
+    "Guest side of the embedding runtime API (see src/runtime.zig).",
+    -1,
+    hostcall_methods
+};
+
+/* ============================================================================
+ * Module Initialization
+ * ============================================================================ */
+PyMODINIT_FUNC PyInit__hostcall(void) {
+    PyObject* module = PyModule_Create(&hostcallmodule);
+    if (!module) {
+        return NULL;
+    }
+    PyObject* exc = get_deadline_exceeded();
+    if (!exc || PyModule_AddObjectRef(module, "DeadlineExceeded", exc) < 0) {
+        Py_DECREF(module);
+        return NULL;
+    }
+    return module;
+}
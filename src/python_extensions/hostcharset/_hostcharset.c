@@ -0,0 +1,134 @@
+/*
+ * _hostcharset - Python C Extension for Host-Side Charset Detection
+ *
+ * This extension wraps the charset detection host function implemented in
+ * the zig-wasm-cpython runtime. The host scores the buffer straight from
+ * linear memory, so detecting the encoding of a large response no longer
+ * runs charset_normalizer's analysis as interpreted WASM.
+ *
+ * WASI Functions Wrapped:
+ *   - charset_detect: Guess the encoding and language of a buffer
+ *
+ * Build: This module must be compiled as part of CPython WASI build
+ */
+
+#include <Python.h>
+#include <stdint.h>
+
+/* ============================================================================
+ * WASI Charset Function Imports
+ * ============================================================================
+ * These functions are provided by the WASM runtime (zig-wasm-cpython).
+ * They are imported from the wasi_snapshot_preview1 module namespace.
+ */
+
+__attribute__((import_module("wasi_snapshot_preview1")))
+__attribute__((import_name("charset_detect")))
+int32_t wasi_charset_detect(
+    int32_t data_ptr,
+    int32_t data_len,
+    int32_t names_ptr,
+    int32_t names_cap,
+    uint32_t* result_ptr
+);
+
+/* ============================================================================
+ * Constants
+ * ============================================================================ */
+
+#define NAMES_CAP 64
+
+/* Layout of the record charset_detect writes to result_ptr */
+enum {
+    RESULT_ENCODING_LEN = 0,
+    RESULT_LANGUAGE_LEN = 1,
+    RESULT_CONFIDENCE = 2,  // thousandths
+    RESULT_BOM = 3,
+    RESULT_FIELDS = 4
+};
+
+/* ============================================================================
+ * Python Function: detect(data) -> (encoding, language, confidence, bom)
+ * ============================================================================ */
+static PyObject* py_detect(PyObject* self, PyObject* args) {
+    Py_buffer data;
+    char names[NAMES_CAP];
+    uint32_t result[RESULT_FIELDS] = {0, 0, 0, 0};
+
+    if (!PyArg_ParseTuple(args, "y*", &data)) {
+        return NULL;
+    }
+
+    int32_t err = wasi_charset_detect(
+        (int32_t)(uintptr_t)data.buf,
+        (int32_t)data.len,
+        (int32_t)(uintptr_t)names,
+        NAMES_CAP,
+        result
+    );
+    PyBuffer_Release(&data);
+
+    if (err != 0) {
+        errno = err;
+        return PyErr_SetFromErrno(PyExc_OSError);
+    }
+
+    PyObject* encoding;
+    if (result[RESULT_ENCODING_LEN] == 0) {
+        encoding = Py_NewRef(Py_None);
+    } else {
+        encoding = PyUnicode_FromStringAndSize(names, result[RESULT_ENCODING_LEN]);
+        if (!encoding) {
+            return NULL;
+        }
+    }
+
+    return Py_BuildValue(
+        "(Ns#dO)",
+        encoding,
+        names + result[RESULT_ENCODING_LEN],
+        (Py_ssize_t)result[RESULT_LANGUAGE_LEN],
+        result[RESULT_CONFIDENCE] / 1000.0,
+        result[RESULT_BOM] ? Py_True : Py_False
+    );
+}
+
+/* ============================================================================
+ * Method Table
+ * ============================================================================ */
+static PyMethodDef HostCharsetMethods[] = {
+    {
+        "detect",
+        py_detect,
+        METH_VARARGS,
+        "detect(data) -> (encoding, language, confidence, bom)\n\n"
+        "Guess the encoding of a bytes-like object.\n\n"
+        "Returns:\n"
+        "    encoding (str | None): Python codec name, e.g. 'utf_8' or\n"
+        "        'cp1252'; None if the data does not look like text\n"
+        "    language (str): Detected language, or '' if unknown\n"
+        "    confidence (float): 0.0 - 1.0\n"
+        "    bom (bool): True if a byte order mark decided the encoding"
+    },
+    {NULL, NULL, 0, NULL}  // Sentinel
+};
+
+/* ============================================================================
+ * Module Definition
+ * ============================================================================ */
+static struct PyModuleDef hostcharsetmodule = {
+    PyModuleDef_HEAD_INIT,
+    "_hostcharset",
+    "Low-level host charset detection interface.\n\n"
+    "charset_normalizer.detect is patched to use it automatically; see\n"
+    "charset_patch.py.",
+    -1,
+    HostCharsetMethods
+};
+
+/* ============================================================================
+ * Module Initialization
+ * ============================================================================ */
+PyMODINIT_FUNC PyInit__hostcharset(void) {
+    return PyModule_Create(&hostcharsetmodule);
+}
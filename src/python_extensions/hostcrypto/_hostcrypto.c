@@ -0,0 +1,494 @@
+/*
+ * _hostcrypto - Python C Extension for Host-Side Cryptography
+ *
+ * This extension wraps the crypto host functions implemented in the
+ * zig-wasm-cpython runtime. Hash, MAC and cipher state lives on the host;
+ * the guest only holds an integer handle and passes buffers straight from
+ * linear memory.
+ *
+ * WASI Functions Wrapped:
+ *   - crypto_hash_new: Create a hash object by hashlib name
+ *   - crypto_hmac_new: Create an HMAC object by hashlib name and key
+ *   - crypto_cmac_new: Create an AES-CMAC object
+ *   - crypto_hash_update: Feed data into a hash/HMAC/CMAC object
+ *   - crypto_hash_digest: Read the current digest or tag (non-destructive)
+ *   - crypto_hash_copy: Duplicate a crypto object
+ *   - crypto_cipher_new: Create a block or stream cipher
+ *   - crypto_cipher_update: Encrypt or decrypt a buffer
+ *   - crypto_free: Release a crypto object
+ *
+ * Build: This module must be compiled as part of CPython WASI build
+ */
+
+#include <Python.h>
+#include <stdint.h>
+
+/* ============================================================================
+ * WASI Crypto Function Imports
+ * ============================================================================
+ * These functions are provided by the WASM runtime (zig-wasm-cpython).
+ * They are imported from the wasi_snapshot_preview1 module namespace.
+ */
+
+__attribute__((import_module("wasi_snapshot_preview1")))
+__attribute__((import_name("crypto_hash_new")))
+int32_t wasi_crypto_hash_new(
+    int32_t name_ptr,
+    int32_t name_len,
+    int32_t* handle_ptr,
+    uint32_t* info_ptr
+);
+
+__attribute__((import_module("wasi_snapshot_preview1")))
+__attribute__((import_name("crypto_hmac_new")))
+int32_t wasi_crypto_hmac_new(
+    int32_t name_ptr,
+    int32_t name_len,
+    int32_t key_ptr,
+    int32_t key_len,
+    int32_t* handle_ptr,
+    uint32_t* info_ptr
+);
+
+__attribute__((import_module("wasi_snapshot_preview1")))
+__attribute__((import_name("crypto_cmac_new")))
+int32_t wasi_crypto_cmac_new(int32_t key_ptr, int32_t key_len, int32_t* handle_ptr);
+
+__attribute__((import_module("wasi_snapshot_preview1")))
+__attribute__((import_name("crypto_hash_update")))
+int32_t wasi_crypto_hash_update(int32_t handle, int32_t data_ptr, int32_t data_len);
+
+__attribute__((import_module("wasi_snapshot_preview1")))
+__attribute__((import_name("crypto_hash_digest")))
+int32_t wasi_crypto_hash_digest(
+    int32_t handle,
+    int32_t out_ptr,
+    int32_t out_len,
+    int32_t* written_ptr
+);
+
+__attribute__((import_module("wasi_snapshot_preview1")))
+__attribute__((import_name("crypto_hash_copy")))
+int32_t wasi_crypto_hash_copy(int32_t handle, int32_t* handle_ptr);
+
+__attribute__((import_module("wasi_snapshot_preview1")))
+__attribute__((import_name("crypto_cipher_new")))
+int32_t wasi_crypto_cipher_new(
+    int32_t algorithm,
+    int32_t mode,
+    int32_t key_ptr,
+    int32_t key_len,
+    int32_t iv_ptr,
+    int32_t iv_len,
+    int32_t* handle_ptr
+);
+
+__attribute__((import_module("wasi_snapshot_preview1")))
+__attribute__((import_name("crypto_cipher_update")))
+int32_t wasi_crypto_cipher_update(
+    int32_t handle,
+    int32_t decrypt,
+    int32_t in_ptr,
+    int32_t out_ptr,
+    int32_t len
+);
+
+__attribute__((import_module("wasi_snapshot_preview1")))
+__attribute__((import_name("crypto_free")))
+int32_t wasi_crypto_free(int32_t handle);
+
+/* ============================================================================
+ * Constants
+ * ============================================================================ */
+
+#define CRYPTO_EINVAL 28
+#define CRYPTO_ENOTSUP 58
+#define MAX_FIXED_DIGEST 64
+
+/* ============================================================================
+ * Helper Functions
+ * ============================================================================ */
+
+static PyObject* crypto_error_from_errno(int err) {
+    if (err == CRYPTO_ENOTSUP) {
+        PyErr_SetString(PyExc_ValueError, "unsupported hash type");
+        return NULL;
+    }
+    errno = err;
+    return PyErr_SetFromErrno(PyExc_OSError);
+}
+
+/* Cipher and MAC constructors report bad parameters as ValueError, like
+ * PyCryptodome does */
+static PyObject* cipher_error_from_errno(int err) {
+    if (err == CRYPTO_ENOTSUP) {
+        PyErr_SetString(PyExc_ValueError, "unsupported cipher algorithm or mode");
+        return NULL;
+    }
+    if (err == CRYPTO_EINVAL) {
+        PyErr_SetString(PyExc_ValueError, "invalid key, IV or data length");
+        return NULL;
+    }
+    return crypto_error_from_errno(err);
+}
+
+/* ============================================================================
+ * Python Function: hash_new(name) -> (handle, digest_size, block_size)
+ * ============================================================================ */
+static PyObject* py_hash_new(PyObject* self, PyObject* args) {
+    const char* name;
+    Py_ssize_t name_len;
+    int32_t handle;
+    uint32_t info[2] = {0, 0};  // digest_size, block_size
+
+    if (!PyArg_ParseTuple(args, "s#", &name, &name_len)) {
+        return NULL;
+    }
+
+    int32_t result = wasi_crypto_hash_new(
+        (int32_t)(uintptr_t)name,
+        (int32_t)name_len,
+        &handle,
+        info
+    );
+
+    if (result != 0) {
+        return crypto_error_from_errno(result);
+    }
+
+    return Py_BuildValue("(iII)", handle, info[0], info[1]);
+}
+
+/* ============================================================================
+ * Python Function: hmac_new(name, key) -> (handle, digest_size, block_size)
+ * ============================================================================ */
+static PyObject* py_hmac_new(PyObject* self, PyObject* args) {
+    const char* name;
+    Py_ssize_t name_len;
+    Py_buffer key;
+    int32_t handle;
+    uint32_t info[2] = {0, 0};  // digest_size, block_size
+
+    if (!PyArg_ParseTuple(args, "s#y*", &name, &name_len, &key)) {
+        return NULL;
+    }
+
+    int32_t result = wasi_crypto_hmac_new(
+        (int32_t)(uintptr_t)name,
+        (int32_t)name_len,
+        (int32_t)(uintptr_t)key.buf,
+        (int32_t)key.len,
+        &handle,
+        info
+    );
+    PyBuffer_Release(&key);
+
+    if (result != 0) {
+        return crypto_error_from_errno(result);
+    }
+
+    return Py_BuildValue("(iII)", handle, info[0], info[1]);
+}
+
+/* ============================================================================
+ * Python Function: cmac_new(key) -> handle
+ * ============================================================================ */
+static PyObject* py_cmac_new(PyObject* self, PyObject* args) {
+    Py_buffer key;
+    int32_t handle;
+
+    if (!PyArg_ParseTuple(args, "y*", &key)) {
+        return NULL;
+    }
+
+    int32_t result = wasi_crypto_cmac_new(
+        (int32_t)(uintptr_t)key.buf,
+        (int32_t)key.len,
+        &handle
+    );
+    PyBuffer_Release(&key);
+
+    if (result != 0) {
+        return cipher_error_from_errno(result);
+    }
+
+    return PyLong_FromLong(handle);
+}
+
+/* ============================================================================
+ * Python Function: hash_update(handle, data) -> None
+ * ============================================================================ */
+static PyObject* py_hash_update(PyObject* self, PyObject* args) {
+    int handle;
+    Py_buffer data;
+
+    if (!PyArg_ParseTuple(args, "iy*", &handle, &data)) {
+        return NULL;
+    }
+
+    int32_t result = wasi_crypto_hash_update(
+        handle,
+        (int32_t)(uintptr_t)data.buf,
+        (int32_t)data.len
+    );
+    PyBuffer_Release(&data);
+
+    if (result != 0) {
+        return crypto_error_from_errno(result);
+    }
+
+    Py_RETURN_NONE;
+}
+
+/* ============================================================================
+ * Python Function: hash_digest(handle, length=0) -> bytes
+ * ============================================================================
+ * length is only used by the SHAKE functions; fixed-size hashes ignore it.
+ */
+static PyObject* py_hash_digest(PyObject* self, PyObject* args) {
+    int handle;
+    Py_ssize_t length = 0;
+
+    if (!PyArg_ParseTuple(args, "i|n", &handle, &length)) {
+        return NULL;
+    }
+
+    if (length < 0) {
+        PyErr_SetString(PyExc_ValueError, "length must be non-negative");
+        return NULL;
+    }
+
+    Py_ssize_t buf_len = length > 0 ? length : MAX_FIXED_DIGEST;
+    PyObject* out = PyBytes_FromStringAndSize(NULL, buf_len);
+    if (!out) {
+        return NULL;
+    }
+
+    int32_t written = 0;
+    int32_t result = wasi_crypto_hash_digest(
+        handle,
+        (int32_t)(uintptr_t)PyBytes_AS_STRING(out),
+        (int32_t)buf_len,
+        &written
+    );
+
+    if (result != 0) {
+        Py_DECREF(out);
+        return crypto_error_from_errno(result);
+    }
+
+    if (written != buf_len && _PyBytes_Resize(&out, written) < 0) {
+        return NULL;
+    }
+    return out;
+}
+
+/* ============================================================================
+ * Python Function: hash_copy(handle) -> handle
+ * ============================================================================ */
+static PyObject* py_hash_copy(PyObject* self, PyObject* args) {
+    int handle;
+    int32_t new_handle;
+
+    if (!PyArg_ParseTuple(args, "i", &handle)) {
+        return NULL;
+    }
+
+    int32_t result = wasi_crypto_hash_copy(handle, &new_handle);
+    if (result != 0) {
+        return crypto_error_from_errno(result);
+    }
+
+    return PyLong_FromLong(new_handle);
+}
+
+/* ============================================================================
+ * Python Function: cipher_new(algorithm, mode, key, iv) -> handle
+ * ============================================================================ */
+static PyObject* py_cipher_new(PyObject* self, PyObject* args) {
+    int algorithm;
+    int mode;
+    Py_buffer key;
+    Py_buffer iv;
+    int32_t handle;
+
+    if (!PyArg_ParseTuple(args, "iiy*y*", &algorithm, &mode, &key, &iv)) {
+        return NULL;
+    }
+
+    int32_t result = wasi_crypto_cipher_new(
+        algorithm,
+        mode,
+        (int32_t)(uintptr_t)key.buf,
+        (int32_t)key.len,
+        (int32_t)(uintptr_t)iv.buf,
+        (int32_t)iv.len,
+        &handle
+    );
+    PyBuffer_Release(&key);
+    PyBuffer_Release(&iv);
+
+    if (result != 0) {
+        return cipher_error_from_errno(result);
+    }
+
+    return PyLong_FromLong(handle);
+}
+
+/* ============================================================================
+ * Python Function: cipher_update(handle, decrypt, data) -> bytes
+ * ============================================================================ */
+static PyObject* py_cipher_update(PyObject* self, PyObject* args) {
+    int handle;
+    int decrypt;
+    Py_buffer data;
+
+    if (!PyArg_ParseTuple(args, "ipy*", &handle, &decrypt, &data)) {
+        return NULL;
+    }
+
+    PyObject* out = PyBytes_FromStringAndSize(NULL, data.len);
+    if (!out) {
+        PyBuffer_Release(&data);
+        return NULL;
+    }
+
+    int32_t result = wasi_crypto_cipher_update(
+        handle,
+        decrypt,
+        (int32_t)(uintptr_t)data.buf,
+        (int32_t)(uintptr_t)PyBytes_AS_STRING(out),
+        (int32_t)data.len
+    );
+    PyBuffer_Release(&data);
+
+    if (result != 0) {
+        Py_DECREF(out);
+        return cipher_error_from_errno(result);
+    }
+
+    return out;
+}
+
+/* ============================================================================
+ * Python Function: free(handle) -> None
+ * ============================================================================ */
+static PyObject* py_free(PyObject* self, PyObject* args) {
+    int handle;
+
+    if (!PyArg_ParseTuple(args, "i", &handle)) {
+        return NULL;
+    }
+
+    wasi_crypto_free(handle);
+    Py_RETURN_NONE;
+}
+
+/* ============================================================================
+ * Method Table
+ * ============================================================================ */
+static PyMethodDef HostCryptoMethods[] = {
+    {
+        "hash_new",
+        py_hash_new,
+        METH_VARARGS,
+        "hash_new(name) -> (handle, digest_size, block_size)\n\n"
+        "Create a host hash object.\n\n"
+        "Args:\n"
+        "    name (str): hashlib algorithm name, e.g. 'sha256'\n\n"
+        "Raises:\n"
+        "    ValueError: If the algorithm is not supported by the host"
+    },
+    {
+        "hmac_new",
+        py_hmac_new,
+        METH_VARARGS,
+        "hmac_new(name, key) -> (handle, digest_size, block_size)\n\n"
+        "Create a host HMAC object. Use hash_update/hash_digest on it.\n\n"
+        "Raises:\n"
+        "    ValueError: If the hash is not supported (SHAKE included)"
+    },
+    {
+        "cmac_new",
+        py_cmac_new,
+        METH_VARARGS,
+        "cmac_new(key) -> handle\n\n"
+        "Create a host AES-CMAC object (16 or 32 byte key). Use\n"
+        "hash_update/hash_digest on it."
+    },
+    {
+        "hash_update",
+        py_hash_update,
+        METH_VARARGS,
+        "hash_update(handle, data) -> None\n\n"
+        "Feed bytes-like data into a hash object."
+    },
+    {
+        "hash_digest",
+        py_hash_digest,
+        METH_VARARGS,
+        "hash_digest(handle, length=0) -> bytes\n\n"
+        "Return the digest of the data hashed so far. The object stays\n"
+        "usable. length is required for shake_128/shake_256."
+    },
+    {
+        "hash_copy",
+        py_hash_copy,
+        METH_VARARGS,
+        "hash_copy(handle) -> handle\n\n"
+        "Duplicate a hash, MAC or cipher object."
+    },
+    {
+        "cipher_new",
+        py_cipher_new,
+        METH_VARARGS,
+        "cipher_new(algorithm, mode, key, iv) -> handle\n\n"
+        "Create a host cipher.\n\n"
+        "Args:\n"
+        "    algorithm (int): 1=AES, 2=DES, 3=DES3, 4=ARC4\n"
+        "    mode (int): 1=ECB, 2=CBC, 6=CTR (PyCryptodome numbering;\n"
+        "        ignored for ARC4)\n"
+        "    key (bytes): Cipher key\n"
+        "    iv (bytes): CBC IV or initial CTR counter block; empty for ECB\n\n"
+        "Raises:\n"
+        "    ValueError: On unsupported algorithm/mode or bad lengths"
+    },
+    {
+        "cipher_update",
+        py_cipher_update,
+        METH_VARARGS,
+        "cipher_update(handle, decrypt, data) -> bytes\n\n"
+        "Encrypt (decrypt=False) or decrypt data. Chaining state carries\n"
+        "over between calls. ECB/CBC data must be whole blocks."
+    },
+    {
+        "free",
+        py_free,
+        METH_VARARGS,
+        "free(handle) -> None\n\n"
+        "Release a host crypto object."
+    },
+    {NULL, NULL, 0, NULL}  // Sentinel
+};
+
+/* ============================================================================
+ * Module Definition
+ * ============================================================================ */
+static struct PyModuleDef hostcryptomodule = {
+    PyModuleDef_HEAD_INIT,
+    "_hostcrypto",
+    "Low-level host cryptography interface.\n\n"
+    "This module provides direct access to the std.crypto primitives\n"
+    "exposed by the zig-wasm-cpython runtime. hashlib is patched to use\n"
+    "it automatically (see hashlib_patch.py), and the bundled Cryptodome\n"
+    "shim uses it for ciphers and MACs.",
+    -1,
+    HostCryptoMethods
+};
+
+/* ============================================================================
+ * Module Initialization
+ * ============================================================================ */
+PyMODINIT_FUNC PyInit__hostcrypto(void) {
+    return PyModule_Create(&hostcryptomodule);
+}
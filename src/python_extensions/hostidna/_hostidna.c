@@ -0,0 +1,208 @@
+/*
+ * _hostidna - Python C Extension for Host-Side IDNA
+ *
+ * This extension wraps the IDNA host functions implemented in the
+ * zig-wasm-cpython runtime. requests and urllib3 pass every non-ASCII
+ * hostname through the idna package, whose per-label Unicode table lookups
+ * and Punycode loops are slow under the WASM interpreter. The host runs the
+ * same algorithm natively and caches results per hostname.
+ *
+ * WASI Functions Wrapped:
+ *   - idna_encode: idna.encode() of UTF-8 text to ASCII
+ *   - idna_decode: idna.decode() of a domain to UTF-8 text
+ *
+ * Build: This module must be compiled as part of CPython WASI build
+ */
+
+#include <Python.h>
+#include <stdint.h>
+
+/* ============================================================================
+ * WASI IDNA Function Imports
+ * ============================================================================
+ * These functions are provided by the WASM runtime (zig-wasm-cpython).
+ * They are imported from the wasi_snapshot_preview1 module namespace.
+ */
+
+__attribute__((import_module("wasi_snapshot_preview1")))
+__attribute__((import_name("idna_encode")))
+int32_t wasi_idna_encode(
+    int32_t in_ptr,
+    int32_t in_len,
+    int32_t flags,
+    int32_t out_ptr,
+    int32_t out_cap,
+    uint32_t* out_len_ptr
+);
+
+__attribute__((import_module("wasi_snapshot_preview1")))
+__attribute__((import_name("idna_decode")))
+int32_t wasi_idna_decode(
+    int32_t in_ptr,
+    int32_t in_len,
+    int32_t flags,
+    int32_t out_ptr,
+    int32_t out_cap,
+    uint32_t* out_len_ptr
+);
+
+/* ============================================================================
+ * Helper Functions
+ * ============================================================================ */
+
+/* Flags, mirroring idna.encode/idna.decode arguments */
+#define IDNA_STRICT       (1 << 0)
+#define IDNA_UTS46        (1 << 1)
+#define IDNA_STD3_RULES   (1 << 2)
+#define IDNA_TRANSITIONAL (1 << 3)
+
+/* Returned for input the host rejects or cannot decide */
+#define IDNA_EILSEQ 25
+/* Returned when the output buffer is too small */
+#define IDNA_EOVERFLOW 61
+
+typedef int32_t (*idna_fn)(int32_t, int32_t, int32_t, int32_t, int32_t, uint32_t*);
+
+static PyObject* idna_error_from_errno(int32_t err) {
+    if (err == IDNA_EILSEQ) {
+        PyErr_SetString(PyExc_ValueError, "input not supported by host idna");
+        return NULL;
+    }
+    errno = err;
+    return PyErr_SetFromErrno(PyExc_OSError);
+}
+
+/*
+ * Run fn over data. Hostnames fit the stack buffer; longer results are
+ * fetched again (from the host's cache) into a buffer of the reported size.
+ * Returns the result as bytes (decode=0) or str (decode=1).
+ */
+static PyObject* call_idna(idna_fn fn, Py_buffer* data, int flags, int decode) {
+    char stack_buf[256];
+    uint32_t out_len = 0;
+
+    int32_t err = fn(
+        (int32_t)(uintptr_t)data->buf,
+        (int32_t)data->len,
+        (int32_t)flags,
+        (int32_t)(uintptr_t)stack_buf,
+        (int32_t)sizeof(stack_buf),
+        &out_len
+    );
+    if (err == 0) {
+        return decode ? PyUnicode_DecodeUTF8(stack_buf, out_len, "surrogatepass")
+                      : PyBytes_FromStringAndSize(stack_buf, out_len);
+    }
+    if (err != IDNA_EOVERFLOW) {
+        return idna_error_from_errno(err);
+    }
+
+    char* heap_buf = PyMem_Malloc(out_len);
+    if (!heap_buf) {
+        return PyErr_NoMemory();
+    }
+    err = fn(
+        (int32_t)(uintptr_t)data->buf,
+        (int32_t)data->len,
+        (int32_t)flags,
+        (int32_t)(uintptr_t)heap_buf,
+        (int32_t)out_len,
+        &out_len
+    );
+    PyObject* result;
+    if (err != 0) {
+        result = idna_error_from_errno(err);
+    } else if (decode) {
+        result = PyUnicode_DecodeUTF8(heap_buf, out_len, "surrogatepass");
+    } else {
+        result = PyBytes_FromStringAndSize(heap_buf, out_len);
+    }
+    PyMem_Free(heap_buf);
+    return result;
+}
+
+/* ============================================================================
+ * Python Function: encode(data, flags) -> bytes
+ * ============================================================================ */
+static PyObject* py_encode(PyObject* self, PyObject* args) {
+    Py_buffer data;
+    int flags;
+
+    if (!PyArg_ParseTuple(args, "y*i", &data, &flags)) {
+        return NULL;
+    }
+    PyObject* result = call_idna(wasi_idna_encode, &data, flags, 0);
+    PyBuffer_Release(&data);
+    return result;
+}
+
+/* ============================================================================
+ * Python Function: decode(data, flags) -> str
+ * ============================================================================ */
+static PyObject* py_decode(PyObject* self, PyObject* args) {
+    Py_buffer data;
+    int flags;
+
+    if (!PyArg_ParseTuple(args, "y*i", &data, &flags)) {
+        return NULL;
+    }
+    PyObject* result = call_idna(wasi_idna_decode, &data, flags, 1);
+    PyBuffer_Release(&data);
+    return result;
+}
+
+/* ============================================================================
+ * Method Table
+ * ============================================================================ */
+static PyMethodDef HostIdnaMethods[] = {
+    {
+        "encode",
+        py_encode,
+        METH_VARARGS,
+        "encode(data, flags) -> bytes\n\n"
+        "idna.encode() of UTF-8 encoded text (surrogatepass). flags combine\n"
+        "STRICT, UTS46, STD3_RULES and TRANSITIONAL. Raises ValueError for\n"
+        "input idna would reject or the host cannot decide; the idna package\n"
+        "handles those."
+    },
+    {
+        "decode",
+        py_decode,
+        METH_VARARGS,
+        "decode(data, flags) -> str\n\n"
+        "idna.decode() of an ASCII or UTF-8 encoded domain. Raises ValueError\n"
+        "like encode()."
+    },
+    {NULL, NULL, 0, NULL}  // Sentinel
+};
+
+/* ============================================================================
+ * Module Definition
+ * ============================================================================ */
+static struct PyModuleDef hostidnamodule = {
+    PyModuleDef_HEAD_INIT,
+    "_hostidna",
+    "Low-level host IDNA interface.\n\n"
+    "The idna package is patched to use it automatically; see\n"
+    "idna_patch.py.",
+    -1,
+    HostIdnaMethods
+};
+
+/* ============================================================================
+ * Module Initialization
+ * ============================================================================ */
+PyMODINIT_FUNC PyInit__hostidna(void) {
+    PyObject* m = PyModule_Create(&hostidnamodule);
+    if (!m) {
+        return NULL;
+    }
+    if (PyModule_AddIntConstant(m, "STRICT", IDNA_STRICT) < 0 ||
+        PyModule_AddIntConstant(m, "UTS46", IDNA_UTS46) < 0 ||
+        PyModule_AddIntConstant(m, "STD3_RULES", IDNA_STD3_RULES) < 0 ||
+        PyModule_AddIntConstant(m, "TRANSITIONAL", IDNA_TRANSITIONAL) < 0) {
+        Py_DECREF(m);
+        return NULL;
+    }
+    return m;
+}
@@ -0,0 +1,237 @@
+/*
+ * _hostjson - Python C Extension for Host-Side JSON Encoding/Decoding
+ *
+ * This extension wraps the JSON host functions implemented in the
+ * zig-wasm-cpython runtime. Objects cross the boundary in marshal format:
+ * decode() turns JSON text into marshal data for marshal.loads(), and
+ * encode() formats the output of marshal.dumps() as JSON text. Both the
+ * scanning and the formatting then run natively instead of as interpreted
+ * WASM.
+ *
+ * WASI Functions Wrapped:
+ *   - json_decode: Parse JSON text into marshal data
+ *   - json_encode: Format marshal data as JSON text
+ *   - json_take: Collect (or discard) a pending result
+ *
+ * Build: This module must be compiled as part of CPython WASI build
+ */
+
+#include <Python.h>
+#include <stdint.h>
+
+/* ============================================================================
+ * WASI JSON Function Imports
+ * ============================================================================
+ * These functions are provided by the WASM runtime (zig-wasm-cpython).
+ * They are imported from the wasi_snapshot_preview1 module namespace.
+ */
+
+__attribute__((import_module("wasi_snapshot_preview1")))
+__attribute__((import_name("json_decode")))
+int32_t wasi_json_decode(
+    int32_t data_ptr,
+    int32_t data_len,
+    uint32_t* handle_ptr,
+    uint32_t* size_ptr
+);
+
+__attribute__((import_module("wasi_snapshot_preview1")))
+__attribute__((import_name("json_encode")))
+int32_t wasi_json_encode(
+    int32_t data_ptr,
+    int32_t data_len,
+    int32_t opts_ptr,
+    uint32_t* handle_ptr,
+    uint32_t* size_ptr
+);
+
+__attribute__((import_module("wasi_snapshot_preview1")))
+__attribute__((import_name("json_take")))
+int32_t wasi_json_take(
+    uint32_t handle,
+    int32_t out_ptr,
+    int32_t out_len
+);
+
+/* ============================================================================
+ * Constants
+ * ============================================================================ */
+
+/* Returned when the input is outside the host fast path */
+#define JSON_EILSEQ 25
+#define JSON_ENOMEM 48
+
+/* Layout of the options record json_encode reads from opts_ptr */
+enum {
+    OPTS_FLAGS = 0,
+    OPTS_INDENT_PTR = 1,
+    OPTS_INDENT_LEN = 2,
+    OPTS_ITEM_SEP_PTR = 3,
+    OPTS_ITEM_SEP_LEN = 4,
+    OPTS_KEY_SEP_PTR = 5,
+    OPTS_KEY_SEP_LEN = 6,
+    OPTS_FIELDS = 7
+};
+
+/* ============================================================================
+ * Helper Functions
+ * ============================================================================ */
+
+static PyObject* json_error_from_errno(int32_t err) {
+    if (err == JSON_EILSEQ) {
+        PyErr_SetString(PyExc_ValueError, "input not supported by host json");
+        return NULL;
+    }
+    if (err == JSON_ENOMEM) {
+        return PyErr_NoMemory();
+    }
+    errno = err;
+    return PyErr_SetFromErrno(PyExc_OSError);
+}
+
+/* Copy a pending result into a new bytes object */
+static PyObject* take_result(uint32_t handle, uint32_t size) {
+    PyObject* result = PyBytes_FromStringAndSize(NULL, size);
+    if (!result) {
+        wasi_json_take(handle, 0, 0);
+        return NULL;
+    }
+
+    int32_t err = wasi_json_take(
+        handle,
+        (int32_t)(uintptr_t)PyBytes_AS_STRING(result),
+        (int32_t)size
+    );
+    if (err != 0) {
+        Py_DECREF(result);
+        return json_error_from_errno(err);
+    }
+    return result;
+}
+
+/* ============================================================================
+ * Python Function: decode(text) -> bytes
+ * ============================================================================ */
+static PyObject* py_decode(PyObject* self, PyObject* args) {
+    Py_buffer data;
+    uint32_t handle = 0;
+    uint32_t size = 0;
+
+    if (!PyArg_ParseTuple(args, "y*", &data)) {
+        return NULL;
+    }
+
+    int32_t err = wasi_json_decode(
+        (int32_t)(uintptr_t)data.buf,
+        (int32_t)data.len,
+        &handle,
+        &size
+    );
+    PyBuffer_Release(&data);
+
+    if (err != 0) {
+        return json_error_from_errno(err);
+    }
+    return take_result(handle, size);
+}
+
+/* ============================================================================
+ * Python Function: encode(data, flags, indent, item_sep, key_sep) -> bytes
+ * ============================================================================ */
+static PyObject* py_encode(PyObject* self, PyObject* args) {
+    Py_buffer data;
+    unsigned int flags;
+    Py_buffer indent, item_sep, key_sep;
+    uint32_t handle = 0;
+    uint32_t size = 0;
+
+    if (!PyArg_ParseTuple(args, "y*Iy*y*y*", &data, &flags, &indent, &item_sep, &key_sep)) {
+        return NULL;
+    }
+
+    uint32_t opts[OPTS_FIELDS] = {
+        [OPTS_FLAGS] = flags,
+        [OPTS_INDENT_PTR] = (uint32_t)(uintptr_t)indent.buf,
+        [OPTS_INDENT_LEN] = (uint32_t)indent.len,
+        [OPTS_ITEM_SEP_PTR] = (uint32_t)(uintptr_t)item_sep.buf,
+        [OPTS_ITEM_SEP_LEN] = (uint32_t)item_sep.len,
+        [OPTS_KEY_SEP_PTR] = (uint32_t)(uintptr_t)key_sep.buf,
+        [OPTS_KEY_SEP_LEN] = (uint32_t)key_sep.len,
+    };
+
+    int32_t err = wasi_json_encode(
+        (int32_t)(uintptr_t)data.buf,
+        (int32_t)data.len,
+        (int32_t)(uintptr_t)opts,
+        &handle,
+        &size
+    );
+    PyBuffer_Release(&data);
+    PyBuffer_Release(&indent);
+    PyBuffer_Release(&item_sep);
+    PyBuffer_Release(&key_sep);
+
+    if (err != 0) {
+        return json_error_from_errno(err);
+    }
+    return take_result(handle, size);
+}
+
+/* ============================================================================
+ * Method Table
+ * ============================================================================ */
+static PyMethodDef HostJsonMethods[] = {
+    {
+        "decode",
+        py_decode,
+        METH_VARARGS,
+        "decode(text) -> bytes\n\n"
+        "Parse UTF-8 JSON text (surrogates allowed) and return marshal data\n"
+        "for marshal.loads(). Raises ValueError for anything json.loads would\n"
+        "reject; call json.loads for the detailed error."
+    },
+    {
+        "encode",
+        py_encode,
+        METH_VARARGS,
+        "encode(data, flags, indent, item_sep, key_sep) -> bytes\n\n"
+        "Format marshal.dumps() output as UTF-8 JSON text.\n\n"
+        "flags: ENSURE_ASCII | ALLOW_NAN | SORT_KEYS | SKIPKEYS | HAS_INDENT\n"
+        "Raises ValueError for objects the host cannot format the way\n"
+        "json.dumps would."
+    },
+    {NULL, NULL, 0, NULL}  // Sentinel
+};
+
+/* ============================================================================
+ * Module Definition
+ * ============================================================================ */
+static struct PyModuleDef hostjsonmodule = {
+    PyModuleDef_HEAD_INIT,
+    "_hostjson",
+    "Low-level host JSON interface.\n\n"
+    "json.loads and json.dumps are patched to use it automatically; see\n"
+    "json_patch.py.",
+    -1,
+    HostJsonMethods
+};
+
+/* ============================================================================
+ * Module Initialization
+ * ============================================================================ */
+PyMODINIT_FUNC PyInit__hostjson(void) {
+    PyObject* m = PyModule_Create(&hostjsonmodule);
+    if (!m) {
+        return NULL;
+    }
+
+    if (PyModule_AddIntConstant(m, "ENSURE_ASCII", 1 << 0) < 0 ||
+        PyModule_AddIntConstant(m, "ALLOW_NAN", 1 << 1) < 0 ||
+        PyModule_AddIntConstant(m, "SORT_KEYS", 1 << 2) < 0 ||
+        PyModule_AddIntConstant(m, "SKIPKEYS", 1 << 3) < 0 ||
+        PyModule_AddIntConstant(m, "HAS_INDENT", 1 << 4) < 0) {
+        Py_DECREF(m);
+        return NULL;
+    }
+    return m;
+}
@@ -0,0 +1,385 @@
+/*
+ * _zlibhost - Python C Extension for Host-Side Compression
+ *
+ * This extension wraps the zlib host functions implemented in the
+ * zig-wasm-cpython runtime, so DEFLATE runs as native code instead of
+ * interpreted Python or WASM-compiled zlib.
+ *
+ * WASI Functions Wrapped:
+ *   - zlib_deflate_init / zlib_inflate_init: Create a stream
+ *   - zlib_deflate_write: Compress data with a flush mode
+ *   - zlib_inflate_feed: Decompress data with an output limit
+ *   - zlib_stream_read: Drain pending output
+ *   - zlib_stream_copy: Duplicate a stream
+ *   - zlib_stream_end: Release a stream
+ *   - zlib_crc32 / zlib_adler32: Checksums
+ *
+ * Build: This module must be compiled as part of CPython WASI build
+ */
+
+#include <Python.h>
+#include <stdint.h>
+
+/* ============================================================================
+ * WASI zlib Function Imports
+ * ============================================================================
+ * These functions are provided by the WASM runtime (zig-wasm-cpython).
+ * They are imported from the wasi_snapshot_preview1 module namespace.
+ */
+
+__attribute__((import_module("wasi_snapshot_preview1")))
+__attribute__((import_name("zlib_deflate_init")))
+int32_t wasi_zlib_deflate_init(int32_t level, int32_t wbits, int32_t* handle_ptr);
+
+__attribute__((import_module("wasi_snapshot_preview1")))
+__attribute__((import_name("zlib_inflate_init")))
+int32_t wasi_zlib_inflate_init(int32_t wbits, int32_t* handle_ptr);
+
+__attribute__((import_module("wasi_snapshot_preview1")))
+__attribute__((import_name("zlib_deflate_write")))
+int32_t wasi_zlib_deflate_write(
+    int32_t handle,
+    int32_t in_ptr,
+    int32_t in_len,
+    int32_t flush,
+    int32_t* pending_ptr
+);
+
+__attribute__((import_module("wasi_snapshot_preview1")))
+__attribute__((import_name("zlib_inflate_feed")))
+int32_t wasi_zlib_inflate_feed(
+    int32_t handle,
+    int32_t in_ptr,
+    int32_t in_len,
+    int32_t max_out,
+    uint32_t* result_ptr
+);
+
+__attribute__((import_module("wasi_snapshot_preview1")))
+__attribute__((import_name("zlib_stream_read")))
+int32_t wasi_zlib_stream_read(
+    int32_t handle,
+    int32_t buf_ptr,
+    int32_t buf_len,
+    int32_t* read_ptr
+);
+
+__attribute__((import_module("wasi_snapshot_preview1")))
+__attribute__((import_name("zlib_stream_copy")))
+int32_t wasi_zlib_stream_copy(int32_t handle, int32_t* handle_ptr);
+
+__attribute__((import_module("wasi_snapshot_preview1")))
+__attribute__((import_name("zlib_stream_end")))
+int32_t wasi_zlib_stream_end(int32_t handle);
+
+__attribute__((import_module("wasi_snapshot_preview1")))
+__attribute__((import_name("zlib_crc32")))
+uint32_t wasi_zlib_crc32(int32_t ptr, int32_t len, uint32_t value);
+
+__attribute__((import_module("wasi_snapshot_preview1")))
+__attribute__((import_name("zlib_adler32")))
+uint32_t wasi_zlib_adler32(int32_t ptr, int32_t len, uint32_t value);
+
+/* ============================================================================
+ * Helper Functions
+ * ============================================================================ */
+
+static PyObject* ZlibHostError;
+
+/* Raise ZlibHostError(status); the Python wrapper turns it into zlib.error */
+static PyObject* zlib_error_from_status(int32_t status) {
+    PyObject* arg = PyLong_FromLong(status);
+    if (arg) {
+        PyErr_SetObject(ZlibHostError, arg);
+        Py_DECREF(arg);
+    }
+    return NULL;
+}
+
+/* Read `pending` bytes of output from a stream into a new bytes object */
+static PyObject* read_pending(int32_t handle, int32_t pending) {
+    PyObject* out = PyBytes_FromStringAndSize(NULL, pending);
+    if (!out || pending == 0) {
+        return out;
+    }
+
+    int32_t n = 0;
+    int32_t result = wasi_zlib_stream_read(
+        handle,
+        (int32_t)(uintptr_t)PyBytes_AS_STRING(out),
+        pending,
+        &n
+    );
+
+    if (result != 0) {
+        Py_DECREF(out);
+        return zlib_error_from_status(result);
+    }
+
+    if (n != pending && _PyBytes_Resize(&out, n) < 0) {
+        return NULL;
+    }
+    return out;
+}
+
+/* ============================================================================
+ * Python Function: deflate_init(level, wbits) -> handle
+ * ============================================================================ */
+static PyObject* py_deflate_init(PyObject* self, PyObject* args) {
+    int level, wbits;
+    int32_t handle;
+
+    if (!PyArg_ParseTuple(args, "ii", &level, &wbits)) {
+        return NULL;
+    }
+
+    int32_t result = wasi_zlib_deflate_init(level, wbits, &handle);
+    if (result != 0) {
+        return zlib_error_from_status(result);
+    }
+
+    return PyLong_FromLong(handle);
+}
+
+/* ============================================================================
+ * Python Function: inflate_init(wbits) -> handle
+ * ============================================================================ */
+static PyObject* py_inflate_init(PyObject* self, PyObject* args) {
+    int wbits;
+    int32_t handle;
+
+    if (!PyArg_ParseTuple(args, "i", &wbits)) {
+        return NULL;
+    }
+
+    int32_t result = wasi_zlib_inflate_init(wbits, &handle);
+    if (result != 0) {
+        return zlib_error_from_status(result);
+    }
+
+    return PyLong_FromLong(handle);
+}
+
+/* ============================================================================
+ * Python Function: deflate_write(handle, data, flush) -> bytes
+ * ============================================================================ */
+static PyObject* py_deflate_write(PyObject* self, PyObject* args) {
+    int handle, flush;
+    Py_buffer data;
+    int32_t pending = 0;
+
+    if (!PyArg_ParseTuple(args, "iy*i", &handle, &data, &flush)) {
+        return NULL;
+    }
+
+    int32_t result = wasi_zlib_deflate_write(
+        handle,
+        (int32_t)(uintptr_t)data.buf,
+        (int32_t)data.len,
+        flush,
+        &pending
+    );
+    PyBuffer_Release(&data);
+
+    if (result != 0) {
+        return zlib_error_from_status(result);
+    }
+
+    return read_pending(handle, pending);
+}
+
+/* ============================================================================
+ * Python Function: inflate_feed(handle, data, max_out) -> (bytes, consumed, eof)
+ * ============================================================================ */
+static PyObject* py_inflate_feed(PyObject* self, PyObject* args) {
+    int handle, max_out;
+    Py_buffer data;
+    uint32_t feed_result[3] = {0, 0, 0};  // consumed, pending, eof
+
+    if (!PyArg_ParseTuple(args, "iy*i", &handle, &data, &max_out)) {
+        return NULL;
+    }
+
+    int32_t result = wasi_zlib_inflate_feed(
+        handle,
+        (int32_t)(uintptr_t)data.buf,
+        (int32_t)data.len,
+        max_out,
+        feed_result
+    );
+    PyBuffer_Release(&data);
+
+    if (result != 0) {
+        return zlib_error_from_status(result);
+    }
+
+    PyObject* out = read_pending(handle, (int32_t)feed_result[1]);
+    if (!out) {
+        return NULL;
+    }
+
+    return Py_BuildValue("(NIO)", out, feed_result[0], feed_result[2] ? Py_True : Py_False);
+}
+
+/* ============================================================================
+ * Python Function: copy(handle) -> handle
+ * ============================================================================ */
+static PyObject* py_copy(PyObject* self, PyObject* args) {
+    int handle;
+    int32_t new_handle;
+
+    if (!PyArg_ParseTuple(args, "i", &handle)) {
+        return NULL;
+    }
+
+    int32_t result = wasi_zlib_stream_copy(handle, &new_handle);
+    if (result != 0) {
+        return zlib_error_from_status(result);
+    }
+
+    return PyLong_FromLong(new_handle);
+}
+
+/* ============================================================================
+ * Python Function: end(handle) -> None
+ * ============================================================================ */
+static PyObject* py_end(PyObject* self, PyObject* args) {
+    int handle;
+
+    if (!PyArg_ParseTuple(args, "i", &handle)) {
+        return NULL;
+    }
+
+    wasi_zlib_stream_end(handle);
+    Py_RETURN_NONE;
+}
+
+/* ============================================================================
+ * Python Functions: crc32(data, value) / adler32(data, value) -> int
+ * ============================================================================ */
+static PyObject* py_crc32(PyObject* self, PyObject* args) {
+    Py_buffer data;
+    unsigned int value;
+
+    if (!PyArg_ParseTuple(args, "y*I", &data, &value)) {
+        return NULL;
+    }
+
+    uint32_t crc = wasi_zlib_crc32((int32_t)(uintptr_t)data.buf, (int32_t)data.len, value);
+    PyBuffer_Release(&data);
+
+    return PyLong_FromUnsignedLong(crc);
+}
+
+static PyObject* py_adler32(PyObject* self, PyObject* args) {
+    Py_buffer data;
+    unsigned int value;
+
+    if (!PyArg_ParseTuple(args, "y*I", &data, &value)) {
+        return NULL;
+    }
+
+    uint32_t adler = wasi_zlib_adler32((int32_t)(uintptr_t)data.buf, (int32_t)data.len, value);
+    PyBuffer_Release(&data);
+
+    return PyLong_FromUnsignedLong(adler);
+}
+
+/* ============================================================================
+ * Method Table
+ * ============================================================================ */
+static PyMethodDef ZlibHostMethods[] = {
+    {
+        "deflate_init",
+        py_deflate_init,
+        METH_VARARGS,
+        "deflate_init(level, wbits) -> handle\n\n"
+        "Create a host compressor. wbits follows the zlib convention\n"
+        "(9..15 zlib, -9..-15 raw, 25..31 gzip)."
+    },
+    {
+        "inflate_init",
+        py_inflate_init,
+        METH_VARARGS,
+        "inflate_init(wbits) -> handle\n\n"
+        "Create a host decompressor. wbits 40..47 auto-detects zlib/gzip."
+    },
+    {
+        "deflate_write",
+        py_deflate_write,
+        METH_VARARGS,
+        "deflate_write(handle, data, flush) -> bytes\n\n"
+        "Compress data, apply a Z_* flush mode and return all output\n"
+        "produced so far."
+    },
+    {
+        "inflate_feed",
+        py_inflate_feed,
+        METH_VARARGS,
+        "inflate_feed(handle, data, max_out) -> (bytes, consumed, eof)\n\n"
+        "Decompress data, producing at most max_out bytes (0 = no limit).\n"
+        "consumed is how much of data was used; the rest must be fed again."
+    },
+    {
+        "copy",
+        py_copy,
+        METH_VARARGS,
+        "copy(handle) -> handle\n\n"
+        "Duplicate a stream, including buffered input and output."
+    },
+    {
+        "end",
+        py_end,
+        METH_VARARGS,
+        "end(handle) -> None\n\n"
+        "Release a stream."
+    },
+    {
+        "crc32",
+        py_crc32,
+        METH_VARARGS,
+        "crc32(data, value) -> int\n\n"
+        "CRC-32 of data, continuing from value."
+    },
+    {
+        "adler32",
+        py_adler32,
+        METH_VARARGS,
+        "adler32(data, value) -> int\n\n"
+        "Adler-32 of data, continuing from value."
+    },
+    {NULL, NULL, 0, NULL}  // Sentinel
+};
+
+/* ============================================================================
+ * Module Definition
+ * ============================================================================ */
+static struct PyModuleDef zlibhostmodule = {
+    PyModuleDef_HEAD_INIT,
+    "_zlibhost",
+    "Low-level host compression interface.\n\n"
+    "This module provides direct access to the DEFLATE codec implemented\n"
+    "by the zig-wasm-cpython runtime. Use the 'zlib' module instead.\n\n"
+    "Exceptions:\n"
+    "    ZlibHostError: Raised with the zlib status code as its argument",
+    -1,
+    ZlibHostMethods
+};
+
+/* ============================================================================
+ * Module Initialization
+ * ============================================================================ */
+PyMODINIT_FUNC PyInit__zlibhost(void) {
+    PyObject* m = PyModule_Create(&zlibhostmodule);
+    if (m == NULL) {
+        return NULL;
+    }
+
+    ZlibHostError = PyErr_NewException("_zlibhost.ZlibHostError", NULL, NULL);
+    if (ZlibHostError == NULL || PyModule_AddObjectRef(m, "ZlibHostError", ZlibHostError) < 0) {
+        Py_DECREF(m);
+        return NULL;
+    }
+
+    return m;
+}
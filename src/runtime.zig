@@ -0,0 +1,1119 @@
+// Embeddable Python Runtime
+//
+// Owns everything needed to run the CPython WASI guest: the VFS with the
+// standard library, bytecode libraries and monkey patches, the zware Store
+// with all host functions registered, and the initialized interpreter.
+// main.zig is one user; capi.zig exposes the same API over the C ABI.
+//
+// Besides running source strings, a Runtime can compile a Python callable
+// once and call it many times with bytes in and bytes out. Calls go
+// straight to the _hostcall extension's exports, and argument buffers come
+// from the guest's own malloc, so the host never writes into memory the
+// guest heap may be using.
+//
+// The parts that never change between interpreters, the decoded module and
+// a VFS holding the standard library, bytecode libraries and patches, form
+// an Image. Runtimes created from one Image share it. Each gets its own
+// Store, Instance and an overlay VFS whose shared base layer is the
+// Image's VFS; a runtime's own layer only holds what it looks up or
+// writes.
+// Host-side objects the guest holds handles to (sockets, zlib streams,
+// crypto objects, pending json results) live in tables of the runtime's
+// own, so no job can reach another runtime's handles. The idna hostname
+// cache is the one process-wide piece, shared behind its own lock.
+//
+// A deadline (setDeadline) bounds the wall and CPU time of each runString,
+// runScript, compile and call: a watchdog thread (deadline.zig) makes the
+// interpreter raise DeadlineExceeded once it passes, and the call fails
+// with error.DeadlineExceeded.
+//
+// With its memory reserved, a runtime can checkpoint the interpreter and
+// later reset it to the checkpoint (checkpoint, reset): guest memory is
+// restored page by page, in time proportional to what was written since,
+// and the host objects and fds behind its handles from saved copies.
+//
+// A Runtime may be used from one thread at a time. Any number of Runtimes
+// may run at once on different threads (see pool.zig).
+
+const std = @import("std");
+const zware = @import("zware");
+const builtin = @import("builtin");
+
+// VFS module for in-memory filesystem
+const vfs_mod = @import("vfs/vfs.zig");
+const VirtualFileSystem = vfs_mod.VirtualFileSystem;
+const WasiVfsHooks = vfs_mod.WasiVfsHooks;
+const VFS_PREFIX = @import("vfs/filesystem.zig").VFS_PREFIX;
+
+// WASI handlers module
+const wasi_handlers = @import("wasi/handlers.zig");
+
+// Socket module
+const socket_handlers = @import("sockets/socket_handlers.zig");
+const socket_mod = @import("sockets/socket.zig");
+
+// Compression module
+const zlib_handlers = @import("compression/zlib_handlers.zig");
+
+// Crypto module
+const crypto_handlers = @import("crypto/crypto_handlers.zig");
+
+// Charset detection module
+const charset_handlers = @import("encoding/charset_handlers.zig");
+
+// JSON codec module
+const json_handlers = @import("encoding/json_handlers.zig");
+
+// Base64/hex transform module
+const binascii_handlers = @import("encoding/binascii_handlers.zig");
+
+// IDNA hostname module
+const idna_handlers = @import("encoding/idna_handlers.zig");
+
+// Execution deadlines
+const deadline_mod = @import("deadline.zig");
+
+// Reserved guest memory
+const linear_memory = @import("linear_memory.zig");
+
+// Python modules
+const python_env = @import("python/environment.zig");
+const stdlib_loader = @import("python/stdlib_loader.zig");
+const library_manifest = @import("python/library_manifest.zig");
+
+/// Default host directories; relative paths in Options resolve against the
+/// executable's directory, here zig-out/bin/ of a checkout that sits next
+/// to its cpython-wasi checkout
+pub const default_python_lib_path = "../../../cpython-wasi/Lib";
+pub const default_compiled_libs_path = "../../compiled_libs";
+
+/// VFS directory the bytecode libraries and their packs are loaded into
+const site_packages_path = "/usr/local/lib/python3.13/site-packages";
+
+/// VFS directory Python's bytecode cache is redirected to when
+/// Options.pycache_path is set
+const pycache_vfs_path = "/pycache";
+
+/// Where runScript keeps the code compiled from scripts, in the same
+/// cache (see python/scriptcache.py)
+const script_cache_vfs_path = pycache_vfs_path ++ "/scripts";
+
+pub const Options = struct {
+    /// CPython Lib/ directory on the host
+    python_lib_path: []const u8 = default_python_lib_path,
+    /// Directory holding the compiled bytecode libraries
+    compiled_libs_path: []const u8 = default_compiled_libs_path,
+    /// Deployment manifest declaring the libraries to load (see
+    /// python/library_manifest.zig); without one, every library in
+    /// compiled_libs_path is loaded
+    manifest_path: ?[]const u8 = null,
+    /// Verbose VFS and runtime logging
+    debug: bool = builtin.mode == .Debug,
+    /// Quotas on what the guest can store in its VFS
+    vfs_limits: vfs_mod.Limits = .{},
+    /// VFS directories kept in host directories across runs
+    persist: []const PersistentDir = &.{},
+    /// Host directory caching the bytecode Python compiles from sources,
+    /// so each module is compiled once rather than once per process
+    pycache_path: ?[]const u8 = null,
+    /// Limits on every call into Python (see Runtime.setDeadline)
+    deadline: Limits = .{},
+    /// Back guest memory with a reservation of its maximum size, so it
+    /// grows in place instead of being copied (see linear_memory.zig)
+    reserve_memory: bool = false,
+};
+
+/// Settings of one runtime on a shared Image
+pub const InstanceOptions = struct {
+    debug: bool = builtin.mode == .Debug,
+    vfs_limits: vfs_mod.Limits = .{},
+    /// May be shared by any number of runtimes
+    pycache_path: ?[]const u8 = null,
+    /// Runtimes sharing a host directory would overwrite each other's
+    /// files, so each needs directories of its own
+    persist: []const PersistentDir = &.{},
+    deadline: Limits = .{},
+    reserve_memory: bool = false,
+};
+
+/// A VFS directory written back to a host directory and reloaded from it
+/// on the next start (see VirtualFileSystem.mountPersistent)
+pub const PersistentDir = struct {
+    /// VFS path; Python sees it under /vfs
+    guest_path: []const u8,
+    host_path: []const u8,
+    options: vfs_mod.PersistOptions = .{},
+};
+
+pub const RuntimeError = error{
+    /// The guest lacks the _hostcall exports (see docs/BUILDING_CPYTHON.md)
+    HostcallUnavailable,
+    /// Python raised; the message is in lastError()
+    PythonException,
+    /// PyRun_SimpleString reported an error (already printed by Python)
+    ScriptFailed,
+    /// Unknown or released callable
+    InvalidCallable,
+    /// The guest's malloc failed
+    GuestOutOfMemory,
+    /// The guest reported a result outside its memory
+    InvalidResult,
+    /// Input to compile(), call() or runString() does not fit in guest
+    /// memory
+    InputTooLarge,
+    /// A call ran past its deadline and was interrupted; the exception
+    /// text is in lastError() for compile() and call()
+    DeadlineExceeded,
+    /// The guest lacks the hostcall_interrupt export, or CPU limits are
+    /// not supported on this OS
+    DeadlinesUnavailable,
+};
+
+/// Handle of a callable kept by the guest
+pub const Callable = u32;
+
+/// Wall and CPU time limits (see Runtime.setDeadline)
+pub const Limits = deadline_mod.Limits;
+
+/// Status codes of the _hostcall exports
+const HostcallStatus = enum(u32) {
+    ok = 0,
+    exception = 1,
+    inval = 28,
+    nomem = 48,
+    _,
+};
+
+/// Host-side state that refers into guest memory, as of a checkpoint. The
+/// handle tables and fd table keep their own copies.
+const SavedState = struct {
+    arg_ptr: u32,
+    arg_cap: u32,
+};
+
+/// Guest addresses from hostcall_interrupt (see _hostcall.c)
+const InterruptSlots = extern struct {
+    /// PyThreadState.eval_breaker, and the bit that makes the
+    /// interpreter raise the pending async exception
+    eval_breaker: u32,
+    async_exc_bit: u32,
+    /// PyThreadState.async_exc, and the DeadlineExceeded type stored there
+    async_exc: u32,
+    exception: u32,
+    /// Nonzero once the guest has handled the timeout itself
+    acknowledged: u32,
+};
+
+const invoke_options = .{
+    .frame_stack_size = 8192,
+    .label_stack_size = 8192,
+    .operand_stack_size = 8192,
+};
+
+const wasm_page_size = 64 * 1024;
+
+/// Size of the fallback string area for guests without hostcall_alloc
+const scratch_pages = 16;
+
+/// Runtimes alive in the process; the idna cache exists while nonzero
+var handler_users: usize = 0;
+var handler_allocator: std.mem.Allocator = undefined;
+var handler_mutex: std.Thread.Mutex = .{};
+
+/// Decoded guest module and prototype VFS, shared read-only by Runtimes.
+/// Reference counted: every Runtime holds a reference, so an image is freed
+/// when its creator has released it and the last Runtime using it is gone.
+pub const Image = struct {
+    allocator: std.mem.Allocator,
+    /// Standard library, bytecode libraries and patches; frozen, so
+    /// runtimes on any thread read it without locks
+    vfs: *VirtualFileSystem,
+    module: zware.Module,
+    refs: std.atomic.Value(usize),
+
+    pub fn init(allocator: std.mem.Allocator, options: Options) !*Image {
+        const self = try allocator.create(Image);
+        errdefer allocator.destroy(self);
+        self.allocator = allocator;
+        self.refs = .init(1);
+
+        self.vfs = try VirtualFileSystem.init(allocator);
+        errdefer self.vfs.deinit();
+        if (options.debug) {
+            self.vfs.setDebug(true);
+        }
+
+        // createFile resolves paths against the first preopen
+        _ = try self.vfs.addPreopen("/");
+        try loadLibraries(self.vfs, options, allocator);
+        try loadPatchFiles(self.vfs);
+        // Bytecode the guest caches for these sources stays valid in
+        // later processes (see Options.pycache_path)
+        self.vfs.stampContentTimes();
+        self.vfs.freeze();
+
+        const python_bytes = @embedFile("./python/python-wasi.wasm");
+        self.module = zware.Module.init(allocator, python_bytes);
+        errdefer self.module.deinit();
+        try self.module.decode();
+
+        return self;
+    }
+
+    /// Drop the creator's reference
+    pub fn deinit(self: *Image) void {
+        self.release();
+    }
+
+    fn retain(self: *Image) void {
+        _ = self.refs.fetchAdd(1, .monotonic);
+    }
+
+    fn release(self: *Image) void {
+        if (self.refs.fetchSub(1, .release) != 1) return;
+        // Pair with the other releasers before freeing what they read
+        _ = self.refs.load(.acquire);
+
+        const allocator = self.allocator;
+        self.module.deinit();
+        self.vfs.deinit();
+        allocator.destroy(self);
+    }
+};
+
+pub const Runtime = struct {
+    allocator: std.mem.Allocator,
+    debug: bool,
+    /// Image the runtime holds a reference on
+    image: *Image,
+    vfs: *VirtualFileSystem,
+    vfs_hooks: WasiVfsHooks,
+    /// Objects behind the guest's socket, zlib, crypto and json handles
+    handles: HandleTables,
+    store: zware.Store,
+    instance: zware.Instance,
+    /// Whether the guest exports the _hostcall ABI
+    has_hostcall: bool,
+    /// Fallback area for runString when the guest has no allocator export:
+    /// pages the host grew memory by, which the guest's sbrk never hands out
+    scratch_ptr: u32 = 0,
+    /// Reusable guest buffer for call() arguments
+    arg_ptr: u32 = 0,
+    arg_cap: u32 = 0,
+    /// Guest u32[2] the exports write (ptr, len) results into
+    result_ptr: u32 = 0,
+    /// Message of the last Python exception, owned by the runtime
+    last_error: ?[]u8 = null,
+    /// Whether runScript caches compiled scripts (set with a pycache_path)
+    script_cache: bool = false,
+    /// Limits on each call into Python, enforced by watchdog
+    deadline: Limits = .{},
+    watchdog: deadline_mod.Watchdog = .{},
+    /// Guest addresses the watchdog writes to, from hostcall_interrupt
+    interrupt: ?InterruptSlots = null,
+    /// Base of guest memory during a call with a deadline; fixed, since
+    /// the memory is reserved in full (see reserveMemory)
+    memory_base: [*]u8 = undefined,
+    /// Address space guest memory grows into, if reserved
+    reservation: ?*linear_memory.Reservation = null,
+    /// Host-side state at the checkpoint, for reset
+    saved: ?SavedState = null,
+    /// Whether the last call with a deadline was interrupted
+    deadline_hit: bool = false,
+
+    /// Load the libraries, build an Image, then start a runtime on it as
+    /// initWithImage does. The image is freed with the runtime.
+    pub fn init(allocator: std.mem.Allocator, options: Options) !*Runtime {
+        const image = try Image.init(allocator, options);
+        defer image.deinit();
+        return initWithImage(allocator, image, .{
+            .debug = options.debug,
+            .vfs_limits = options.vfs_limits,
+            .persist = options.persist,
+            .pycache_path = options.pycache_path,
+            .deadline = options.deadline,
+            .reserve_memory = options.reserve_memory,
+        });
+    }
+
+    /// Give a runtime its own overlay of the image's VFS,
+    /// register host functions, instantiate the image's module, initialize
+    /// Python and apply the monkey patches. Extra files (the user's
+    /// scripts) can be added to vfs afterwards. The runtime keeps the
+    /// image alive.
+    pub fn initWithImage(allocator: std.mem.Allocator, image: *Image, options: InstanceOptions) !*Runtime {
+        const debug = options.debug;
+        const self = try allocator.create(Runtime);
+        errdefer allocator.destroy(self);
+        self.* = .{
+            .allocator = allocator,
+            .debug = debug,
+            .image = image,
+            .vfs = undefined,
+            .vfs_hooks = undefined,
+            .handles = HandleTables.init(allocator),
+            .store = undefined,
+            .instance = undefined,
+            .has_hostcall = false,
+        };
+        image.retain();
+        errdefer image.release();
+        errdefer self.handles.deinit();
+
+        // ====================================================================
+        // Initialize VFS for in-memory Python scripts
+        // ====================================================================
+
+        self.vfs = try VirtualFileSystem.initOverlay(allocator, image.vfs);
+        errdefer self.vfs.deinit();
+        if (debug) {
+            self.vfs.setDebug(true);
+        }
+        self.vfs.setLimits(options.vfs_limits);
+
+        // Add VFS root preopen - all VFS content goes under /vfs/
+        const vfs_preopen_fd = try self.vfs.addPreopen("/");
+        self.debugPrint("VFS preopen created at fd={}\n", .{vfs_preopen_fd});
+
+        for (options.persist) |dir| {
+            try self.vfs.mountPersistent(dir.guest_path, dir.host_path, dir.options);
+            self.debugPrint("Persistent mount: {s} -> {s}\n", .{ dir.guest_path, dir.host_path });
+        }
+        if (options.pycache_path) |path| {
+            // Files written back as soon as Python closes them, since a
+            // server may never exit cleanly. Sources carry content-derived
+            // mtimes (see Image.init), so the .pyc files validate in later
+            // processes.
+            try self.vfs.mountPersistent(pycache_vfs_path, path, .{ .flush = .on_close });
+            self.script_cache = true;
+            self.debugPrint("Bytecode cache: {s}\n", .{path});
+        }
+
+        // Create WASI hooks backed by VFS
+        self.vfs_hooks = WasiVfsHooks.init(self.vfs);
+        self.vfs_hooks.setDebug(debug);
+
+        // Point the WASI handlers at this VFS and the host function
+        // modules at our handle tables (rebound before every call, see
+        // invoke)
+        wasi_handlers.setVfs(self.vfs, &self.vfs_hooks);
+        errdefer wasi_handlers.clearVfs();
+        self.handles.bind();
+        errdefer HandleTables.unbind();
+
+        // ====================================================================
+        // Instantiate the shared module on a store of our own
+        // ====================================================================
+
+        self.store = zware.Store.init(allocator);
+        errdefer self.store.deinit();
+        try wasi_handlers.addWasiImports(&self.store);
+
+        try acquireHandlers(allocator);
+        errdefer releaseHandlers();
+        try registerHandlers(&self.store);
+        self.debugPrint("Host functions registered\n", .{});
+
+        self.instance = zware.Instance.init(allocator, &self.store, image.module);
+        errdefer self.instance.deinit();
+        try self.instance.instantiate();
+        // Unmapped last: the store's free of the memory does not touch it
+        errdefer if (self.reservation) |reservation| reservation.deinit();
+        if (options.reserve_memory) try self.reserveMemory();
+
+        // Register VFS preopen with zware instance
+        try self.instance.addWasiPreopen(@intCast(vfs_preopen_fd), VFS_PREFIX, 0);
+        self.debugPrint("Added preopen: fd={}, path={s} (VFS-backed)\n", .{ vfs_preopen_fd, VFS_PREFIX });
+
+        // ====================================================================
+        // Configure Python environment and arguments
+        // ====================================================================
+
+        var env_config = python_env.defaultConfig();
+        if (options.pycache_path != null) env_config.pycache_prefix = VFS_PREFIX ++ pycache_vfs_path;
+        try python_env.setupEnvironment(&self.instance, env_config, allocator);
+        self.debugPrint("Set {} environment variables\n", .{self.instance.wasi_env.count()});
+
+        // Minimal command-line arguments (required by Python initialization)
+        const cmd_config = python_env.CommandConfig{
+            .mode = .interactive,
+            .args = &[_][]const u8{},
+        };
+        try python_env.setupArguments(&self.instance, cmd_config, allocator);
+
+        // ====================================================================
+        // Initialize Python using C API
+        // ====================================================================
+
+        var init_in = [_]u64{};
+        var init_out = [_]u64{};
+        try self.invoke("Py_Initialize", init_in[0..], init_out[0..]);
+        self.debugPrint("Python interpreter initialized\n", .{});
+
+        try self.setUpGuestBuffers();
+        try self.applyMonkeyPatches();
+        try self.setDeadline(options.deadline);
+
+        return self;
+    }
+
+    /// Finalize Python and release everything the runtime owns
+    pub fn deinit(self: *Runtime) void {
+        const allocator = self.allocator;
+
+        var fin_in = [_]u64{};
+        var fin_out = [_]u64{};
+        self.invoke("Py_Finalize", fin_in[0..], fin_out[0..]) catch |err| {
+            self.debugPrint("Py_Finalize failed: {}\n", .{err});
+        };
+        self.debugPrint("Python interpreter finalized\n", .{});
+
+        self.watchdog.deinit();
+        if (self.last_error) |message| allocator.free(message);
+        self.instance.deinit();
+        releaseHandlers();
+        self.store.deinit();
+        if (self.reservation) |reservation| reservation.deinit();
+        wasi_handlers.clearVfs();
+        HandleTables.unbind();
+        self.handles.deinit();
+        self.vfs.deinit();
+        self.image.release();
+        allocator.destroy(self);
+    }
+
+    /// Message of the last Python exception raised by compile() or call()
+    pub fn lastError(self: *const Runtime) []const u8 {
+        return self.last_error orelse "";
+    }
+
+    /// Run source with PyRun_SimpleString in __main__. Exceptions are
+    /// printed by Python and reported as error.ScriptFailed.
+    pub fn runString(self: *Runtime, code: []const u8) !void {
+        const code_ptr = try self.writeCString(code);
+        defer self.releaseCString(code_ptr);
+
+        var run_in = [_]u64{code_ptr};
+        var run_out = [_]u64{0};
+        try self.invokeLimited("PyRun_SimpleString", run_in[0..], run_out[0..]);
+        if (run_out[0] != 0) return if (self.deadline_hit) error.DeadlineExceeded else error.ScriptFailed;
+    }
+
+    /// Put a script into the VFS at path and run it in __main__, as
+    /// runString does. With a bytecode cache (InstanceOptions.pycache_path)
+    /// the compiled script is cached under a hash of path and source, and
+    /// runs of the same script after the first skip compiling it. Without
+    /// one, the script is compiled on every call.
+    pub fn runScript(self: *Runtime, path: []const u8, source: []const u8) !void {
+        // path is quoted into Python source below
+        if (path.len == 0 or path[0] != '/' or std.mem.indexOfAny(u8, path, "'\\\n") != null) return error.InvalidPath;
+        try self.vfs.createFile(path, source);
+
+        var buf: [512]u8 = undefined;
+        const code = if (self.script_cache) blk: {
+            var hasher = std.hash.Wyhash.init(0);
+            hasher.update(path);
+            hasher.update(&.{0});
+            hasher.update(source);
+            break :blk try std.fmt.bufPrint(&buf, "__import__('_scriptcache').run('{s}{s}', '{s}{s}/{x:0>16}.code')", .{
+                VFS_PREFIX, path, VFS_PREFIX, script_cache_vfs_path, hasher.final(),
+            });
+        } else try std.fmt.bufPrint(&buf, "__import__('_scriptcache').run('{s}{s}')", .{ VFS_PREFIX, path });
+        return self.runString(code);
+    }
+
+    /// Exec source in a fresh namespace and keep the callable bound to
+    /// name. Release it with release().
+    pub fn compile(self: *Runtime, source: []const u8, name: []const u8) !Callable {
+        if (!self.has_hostcall) return error.HostcallUnavailable;
+
+        const src_ptr = try self.guestDupe(source);
+        defer self.guestFree(src_ptr);
+        const name_ptr = try self.guestDupe(name);
+        defer self.guestFree(name_ptr);
+
+        var in = [_]u64{ src_ptr, source.len, name_ptr, name.len, self.result_ptr };
+        var out = [_]u64{0};
+        try self.invokeLimited("hostcall_compile", in[0..], out[0..]);
+        try self.checkStatus(out[0]);
+
+        const mem = try self.instance.getMemory(0);
+        return mem.read(u32, 0, self.result_ptr);
+    }
+
+    /// Call a compiled callable with input as its bytes argument. The
+    /// callable must return a bytes-like object; the caller owns the
+    /// returned copy.
+    pub fn call(self: *Runtime, callable: Callable, input: []const u8, allocator: std.mem.Allocator) ![]u8 {
+        if (!self.has_hostcall) return error.HostcallUnavailable;
+        // Guest memory is 32-bit
+        if (input.len > std.math.maxInt(u32)) return error.InputTooLarge;
+
+        // Reuse one argument buffer, growing it as needed
+        if (input.len > self.arg_cap) {
+            const ptr = try self.guestAlloc(@intCast(input.len));
+            if (self.arg_ptr != 0) self.guestFree(self.arg_ptr);
+            self.arg_ptr = ptr;
+            self.arg_cap = @intCast(input.len);
+        }
+        {
+            const mem = try self.instance.getMemory(0);
+            @memcpy(mem.memory()[self.arg_ptr..][0..input.len], input);
+        }
+
+        var in = [_]u64{ callable, self.arg_ptr, input.len, self.result_ptr };
+        var out = [_]u64{0};
+        try self.invokeLimited("hostcall_invoke", in[0..], out[0..]);
+        try self.checkStatus(out[0]);
+
+        // The call may have grown memory; look it up again
+        const mem = try self.instance.getMemory(0);
+        const out_ptr = try mem.read(u32, 0, self.result_ptr);
+        const out_len = try mem.read(u32, 0, self.result_ptr + 4);
+        // The guest wrote these, so check them before reading through them.
+        // The buffer is the guest's to free even if its length is wrong.
+        if (out_ptr >= mem.memory().len) return error.InvalidResult;
+        defer self.guestFree(out_ptr);
+        if (@as(u64, out_ptr) + out_len > mem.memory().len) return error.InvalidResult;
+        return allocator.dupe(u8, mem.memory()[out_ptr..][0..out_len]);
+    }
+
+    /// Drop a compiled callable
+    pub fn release(self: *Runtime, callable: Callable) void {
+        if (!self.has_hostcall) return;
+        var in = [_]u64{callable};
+        var out = [_]u64{0};
+        self.invoke("hostcall_release", in[0..], out[0..]) catch {};
+    }
+
+    /// Limit the wall and CPU time of every later runString, runScript,
+    /// compile and call; zero limits remove them. A call that runs past a
+    /// limit is interrupted when the interpreter next checks for pending
+    /// work (any loop iteration or call) and fails with
+    /// error.DeadlineExceeded. The first limit set reserves the guest's
+    /// whole address space up front (see reserveMemory).
+    pub fn setDeadline(self: *Runtime, limits: Limits) !void {
+        if (limits.isSet()) {
+            if (self.interrupt == null) return error.DeadlinesUnavailable;
+            try self.reserveMemory();
+        }
+        self.deadline = limits;
+    }
+
+    /// invoke under the runtime's deadline, if it has one
+    fn invokeLimited(self: *Runtime, name: []const u8, in: []u64, out: []u64) !void {
+        self.deadline_hit = false;
+        if (!self.deadline.isSet()) return self.invoke(name, in, out);
+
+        const slots = self.interrupt.?;
+        const mem = try self.instance.getMemory(0);
+        self.memory_base = mem.memory().ptr;
+        self.guestWord(slots.acknowledged).* = 0;
+
+        self.watchdog.arm(self.deadline, .{ .context = self, .func = deliverInterrupt }) catch |err| switch (err) {
+            error.Unsupported => return error.DeadlinesUnavailable,
+            else => return err,
+        };
+        defer {
+            if (self.watchdog.disarm()) {
+                self.deadline_hit = true;
+                self.clearInterrupt();
+            }
+        }
+        try self.invoke(name, in, out);
+    }
+
+    /// Watchdog interrupt: make the interpreter raise DeadlineExceeded
+    /// (see _hostcall.c). Runs on the watchdog's thread while the guest
+    /// runs; the words it writes are aligned, and the guest only reads them
+    /// whole, so either sees the store or not.
+    fn deliverInterrupt(context: *anyopaque) void {
+        const self: *Runtime = @ptrCast(@alignCast(context));
+        const slots = self.interrupt.?;
+        if (@atomicLoad(u32, self.guestWord(slots.acknowledged), .acquire) != 0) return;
+        @atomicStore(u32, self.guestWord(slots.async_exc), slots.exception, .release);
+        _ = @atomicRmw(u32, self.guestWord(slots.eval_breaker), .Or, slots.async_exc_bit, .release);
+    }
+
+    /// Withdraw an interrupt the guest has not acted on, after the call
+    fn clearInterrupt(self: *Runtime) void {
+        const slots = self.interrupt.?;
+        const mem = self.instance.getMemory(0) catch return;
+        self.memory_base = mem.memory().ptr;
+        self.guestWord(slots.async_exc).* = 0;
+        self.guestWord(slots.eval_breaker).* &= ~slots.async_exc_bit;
+    }
+
+    fn guestWord(self: *Runtime, addr: u32) *u32 {
+        return @ptrCast(@alignCast(self.memory_base + addr));
+    }
+
+    /// Call a guest export. The host functions find the VFS and handle
+    /// tables through thread-locals, so bind ours first in case another
+    /// runtime ran on this thread since.
+    fn invoke(self: *Runtime, name: []const u8, in: []u64, out: []u64) !void {
+        wasi_handlers.setVfs(self.vfs, &self.vfs_hooks);
+        self.handles.bind();
+        try self.instance.invoke(name, in, out, invoke_options);
+    }
+
+    // ========================================================================
+    // Guest memory
+    // ========================================================================
+
+    /// Allocate len bytes with the guest's malloc
+    pub fn guestAlloc(self: *Runtime, len: u32) !u32 {
+        var in = [_]u64{len};
+        var out = [_]u64{0};
+        try self.invoke("hostcall_alloc", in[0..], out[0..]);
+        if (out[0] == 0) return error.GuestOutOfMemory;
+        return @intCast(out[0]);
+    }
+
+    pub fn guestFree(self: *Runtime, ptr: u32) void {
+        var in = [_]u64{ptr};
+        var out = [_]u64{};
+        self.invoke("hostcall_free", in[0..], out[0..]) catch {};
+    }
+
+    fn guestDupe(self: *Runtime, bytes: []const u8) !u32 {
+        if (bytes.len > std.math.maxInt(u32)) return error.InputTooLarge;
+        const ptr = try self.guestAlloc(@intCast(bytes.len));
+        const mem = try self.instance.getMemory(0);
+        @memcpy(mem.memory()[ptr..][0..bytes.len], bytes);
+        return ptr;
+    }
+
+    /// NUL-terminated copy of str in guest memory
+    fn writeCString(self: *Runtime, str: []const u8) !u32 {
+        if (str.len >= std.math.maxInt(u32)) return error.InputTooLarge;
+        const ptr = if (self.has_hostcall) try self.guestAlloc(@intCast(str.len + 1)) else blk: {
+            if (str.len + 1 > scratch_pages * wasm_page_size) return error.OutOfMemory;
+            break :blk self.scratch_ptr;
+        };
+        const mem = try self.instance.getMemory(0);
+        const dest = mem.memory()[ptr..][0 .. str.len + 1];
+        @memcpy(dest[0..str.len], str);
+        dest[str.len] = 0;
+        return ptr;
+    }
+
+    fn releaseCString(self: *Runtime, ptr: u32) void {
+        if (self.has_hostcall) self.guestFree(ptr);
+    }
+
+    /// Find the guest allocator, or reserve the fallback string area, and
+    /// allocate the result slots
+    fn setUpGuestBuffers(self: *Runtime) !void {
+        if (self.guestAlloc(8)) |ptr| {
+            self.has_hostcall = true;
+            self.result_ptr = ptr;
+            self.interrupt = try self.queryInterrupt();
+            return;
+        } else |err| switch (err) {
+            error.ExportNotFound => {},
+            else => return err,
+        }
+
+        // Interpreter built without _hostcall: strings go in pages appended
+        // to linear memory. The guest's sbrk grows memory from its current
+        // end, so it never allocates over them.
+        const mem = try self.instance.getMemory(0);
+        const old_len = mem.memory().len;
+        _ = try mem.grow(scratch_pages);
+        self.scratch_ptr = @intCast(old_len);
+        self.debugPrint("Guest has no _hostcall exports; using a {} KB scratch area\n", .{scratch_pages * 64});
+    }
+
+    /// The guest addresses deadlines are enforced through; null for a
+    /// guest built before hostcall_interrupt
+    fn queryInterrupt(self: *Runtime) !?InterruptSlots {
+        const slots_ptr = try self.guestAlloc(@sizeOf(InterruptSlots));
+        defer self.guestFree(slots_ptr);
+
+        var in = [_]u64{slots_ptr};
+        var out = [_]u64{0};
+        self.invoke("hostcall_interrupt", in[0..], out[0..]) catch |err| switch (err) {
+            error.ExportNotFound => return null,
+            else => return err,
+        };
+        try self.checkStatus(out[0]);
+
+        const mem = try self.instance.getMemory(0);
+        var words: [5]u32 = undefined;
+        for (&words, 0..) |*word, i| word.* = try mem.read(u32, 0, slots_ptr + @as(u32, @intCast(i * 4)));
+        return .{
+            .eval_breaker = words[0],
+            .async_exc_bit = words[1],
+            .async_exc = words[2],
+            .exception = words[3],
+            .acknowledged = words[4],
+        };
+    }
+
+    /// Move guest memory into a reservation of its maximum size (see
+    /// linear_memory.zig), so that growing it never copies or moves it.
+    /// Deadlines need this: the watchdog writes into the memory from
+    /// another thread while the guest runs.
+    fn reserveMemory(self: *Runtime) !void {
+        if (self.reservation != null) return;
+        const mem = try self.instance.getMemory(0);
+        self.reservation = try linear_memory.reserve(self.allocator, mem, self.debug);
+        self.debugPrint("Reserved {} MB of address space for guest memory\n", .{self.reservation.?.usable / (1024 * 1024)});
+    }
+
+    /// Save the interpreter's state for reset(): guest memory as it is
+    /// now, and the host objects and fds it holds handles to. Reserves the
+    /// memory first if needed. Linux only.
+    pub fn checkpoint(self: *Runtime) !void {
+        try self.reserveMemory();
+        // Half a checkpoint is none
+        self.saved = null;
+        try self.reservation.?.checkpoint();
+        try self.handles.checkpoint();
+        try self.vfs.checkpointFds();
+        self.saved = .{
+            .arg_ptr = self.arg_ptr,
+            .arg_cap = self.arg_cap,
+        };
+    }
+
+    /// Return the interpreter to the last checkpoint. Guest memory is
+    /// restored, and so are the handles in it: streams, crypto objects,
+    /// json results and fds get back the state they had, and those
+    /// created since are freed. Sockets cannot be rewound and are all
+    /// closed. VFS contents are not restored (see
+    /// VirtualFileSystem.rollback).
+    pub fn reset(self: *Runtime) !void {
+        const saved = self.saved orelse return error.NoCheckpoint;
+        try self.reservation.?.reset();
+        self.arg_ptr = saved.arg_ptr;
+        self.arg_cap = saved.arg_cap;
+        try self.handles.restore();
+        try self.vfs.restoreFds();
+    }
+
+    /// Guest memory size and growth; null unless the memory is reserved
+    /// (InstanceOptions.reserve_memory, or a deadline)
+    pub fn memoryStats(self: *const Runtime) ?linear_memory.Stats {
+        const reservation = self.reservation orelse return null;
+        return reservation.stats();
+    }
+
+    fn checkStatus(self: *Runtime, raw: u64) !void {
+        switch (@as(HostcallStatus, @enumFromInt(@as(u32, @truncate(raw))))) {
+            .ok => return,
+            .inval => return error.InvalidCallable,
+            .nomem => return error.GuestOutOfMemory,
+            .exception => {
+                self.saveGuestError();
+                return if (self.deadline_hit) error.DeadlineExceeded else error.PythonException;
+            },
+            _ => return error.PythonException,
+        }
+    }
+
+    /// Copy the guest's last exception text into last_error
+    fn saveGuestError(self: *Runtime) void {
+        var in = [_]u64{self.result_ptr};
+        var out = [_]u64{};
+        self.invoke("hostcall_error", in[0..], out[0..]) catch return;
+
+        const mem = self.instance.getMemory(0) catch return;
+        const ptr = mem.read(u32, 0, self.result_ptr) catch return;
+        const len = mem.read(u32, 0, self.result_ptr + 4) catch return;
+        if (@as(u64, ptr) + len > mem.memory().len) return;
+
+        const message = self.allocator.dupe(u8, mem.memory()[ptr..][0..len]) catch return;
+        if (self.last_error) |old| self.allocator.free(old);
+        self.last_error = message;
+    }
+
+    // ========================================================================
+    // Setup helpers
+    // ========================================================================
+
+    fn applyMonkeyPatches(self: *Runtime) !void {
+        self.debugPrint("Applying monkey patches...\n", .{});
+
+        // Socket patch runs in __main__ (it must be in place before any import of
+        // socket); the others get a private namespace so helpers don't leak into
+        // the user's script globals
+        const monkey_patches = [_]struct { name: []const u8, code: []const u8 }{
+            // First, so that later patches importing packed libraries find them
+            .{ .name = "zpack", .code = "import _zpack; _zpack.install('" ++ VFS_PREFIX ++ site_packages_path ++ "')" },
+            .{ .name = "Socket", .code = "exec(open('/vfs/socket_patch.py').read())" },
+            .{ .name = "hashlib", .code = "exec(open('/vfs/hashlib_patch.py').read(), {'__name__': '__hashlib_patch__'})" },
+            .{ .name = "charset_normalizer", .code = "exec(open('/vfs/charset_patch.py').read(), {'__name__': '__charset_patch__'})" },
+            .{ .name = "json", .code = "exec(open('/vfs/json_patch.py').read(), {'__name__': '__json_patch__'})" },
+            .{ .name = "binascii", .code = "exec(open('/vfs/binascii_patch.py').read(), {'__name__': '__binascii_patch__'})" },
+            .{ .name = "idna", .code = "exec(open('/vfs/idna_patch.py').read(), {'__name__': '__idna_patch__'})" },
+        };
+
+        for (monkey_patches) |patch| {
+            self.runString(patch.code) catch |err| switch (err) {
+                error.ScriptFailed => {
+                    self.debugPrint("Warning: {s} patch failed\n", .{patch.name});
+                    continue;
+                },
+                else => return err,
+            };
+            self.debugPrint("{s} patch applied successfully\n", .{patch.name});
+        }
+    }
+
+    fn debugPrint(self: *const Runtime, comptime fmt: []const u8, args: anytype) void {
+        if (self.debug) {
+            std.debug.print(fmt, args);
+        }
+    }
+};
+
+/// Load the standard library and the libraries the manifest declares
+/// into the VFS
+fn loadLibraries(vfs: *VirtualFileSystem, options: Options, allocator: std.mem.Allocator) !void {
+    const exe_dir = try std.fs.selfExeDirPathAlloc(allocator);
+    defer allocator.free(exe_dir);
+    const python_lib_path = try library_manifest.resolve(allocator, exe_dir, options.python_lib_path);
+    defer allocator.free(python_lib_path);
+    const compiled_libs_path = try library_manifest.resolve(allocator, exe_dir, options.compiled_libs_path);
+    defer allocator.free(compiled_libs_path);
+
+    var plan = if (options.manifest_path) |path|
+        try library_manifest.fromManifest(allocator, path, python_lib_path, compiled_libs_path)
+    else
+        try library_manifest.fromCompiledLibs(allocator, python_lib_path, compiled_libs_path);
+    defer plan.deinit();
+
+    // Precompiled by compile_library.py --stdlib, if it has been run
+    const stdlib_bytecode = try std.fs.path.join(allocator, &.{ plan.compiled_libs_path, "stdlib" });
+    defer allocator.free(stdlib_bytecode);
+    const have_bytecode = if (std.fs.accessAbsolute(stdlib_bytecode, .{})) true else |_| false;
+    try stdlib_loader.loadStdlib(vfs, "/usr/local/lib/python3.13", plan.python_lib_path, if (have_bytecode) stdlib_bytecode else null, allocator);
+
+    for (plan.libraries) |library| {
+        const lazy = library.load == .lazy;
+
+        // The pack (<name>.zpack) if compile_library.py wrote one
+        const pack_name = try std.fmt.allocPrint(allocator, "{s}.zpack", .{library.name});
+        defer allocator.free(pack_name);
+        const real_pack = try std.fs.path.join(allocator, &.{ plan.compiled_libs_path, pack_name });
+        defer allocator.free(real_pack);
+        const vfs_pack = try std.fmt.allocPrint(allocator, site_packages_path ++ "/{s}", .{pack_name});
+        defer allocator.free(vfs_pack);
+        if (try stdlib_loader.loadBytecodePack(vfs, vfs_pack, real_pack, lazy, allocator)) continue;
+
+        const real_path = try std.fs.path.join(allocator, &.{ plan.compiled_libs_path, library.name });
+        defer allocator.free(real_path);
+        const vfs_path = try std.fmt.allocPrint(allocator, site_packages_path ++ "/{s}", .{library.name});
+        defer allocator.free(vfs_path);
+        stdlib_loader.loadBytecodeLibrary(vfs, vfs_path, real_path, lazy, allocator) catch |err| switch (err) {
+            error.FileNotFound => {
+                std.debug.print("Error: library {s} not found in {s}\n", .{ library.name, plan.compiled_libs_path });
+                return err;
+            },
+            else => return err,
+        };
+    }
+}
+
+/// Put the embedded patches, wrappers and shims into the VFS
+fn loadPatchFiles(vfs: *VirtualFileSystem) !void {
+    // Load wasisocket Python wrapper module
+    try vfs.createFile("/usr/local/lib/python3.13/wasisocket.py", @embedFile("python_extensions/wasisocket/wasisocket.py"));
+
+    // Load monkey patches (required for host function interop)
+    try vfs.createFile("/socket_patch.py", @embedFile("python/monkey_patches/socket_patch.py"));
+    try vfs.createFile("/hashlib_patch.py", @embedFile("python/monkey_patches/hashlib_patch.py"));
+    try vfs.createFile("/charset_patch.py", @embedFile("python/monkey_patches/charset_patch.py"));
+    try vfs.createFile("/json_patch.py", @embedFile("python/monkey_patches/json_patch.py"));
+    try vfs.createFile("/binascii_patch.py", @embedFile("python/monkey_patches/binascii_patch.py"));
+    try vfs.createFile("/idna_patch.py", @embedFile("python/monkey_patches/idna_patch.py"));
+
+    // Importer for the bytecode packs loaded into site-packages
+    try vfs.createFile("/usr/local/lib/python3.13/_zpack.py", @embedFile("python/monkey_patches/zpack_importer.py"));
+
+    // Runs scripts for Runtime.runScript, caching their compiled code
+    try vfs.createFile("/usr/local/lib/python3.13/_scriptcache.py", @embedFile("python/scriptcache.py"));
+
+    // Post-import hook helper used by patches of bytecode-loaded packages
+    try vfs.createFile("/usr/local/lib/python3.13/_hostpatch.py", @embedFile("python/monkey_patches/_hostpatch.py"));
+
+    // Host-backed zlib module (CPython WASI ships without zlib)
+    try vfs.createFile("/usr/local/lib/python3.13/zlib.py", @embedFile("python/monkey_patches/zlib_host.py"));
+
+    // Host-backed Cryptodome shim (impacket imports it in place of
+    // PyCryptodome, which has no WASI build)
+    const cryptodome_files = [_][]const u8{
+        "__init__.py",
+        "Cipher/__init__.py",
+        "Cipher/_host.py",
+        "Cipher/AES.py",
+        "Cipher/ARC4.py",
+        "Cipher/DES.py",
+        "Cipher/DES3.py",
+        "Hash/__init__.py",
+        "Hash/_host.py",
+        "Hash/CMAC.py",
+        "Hash/HMAC.py",
+        "Hash/MD4.py",
+        "Hash/MD5.py",
+        "Hash/SHA.py",
+        "Hash/SHA1.py",
+        "Hash/SHA224.py",
+        "Hash/SHA256.py",
+        "Hash/SHA384.py",
+        "Hash/SHA512.py",
+        "Protocol/__init__.py",
+        "Protocol/KDF.py",
+        "Random/__init__.py",
+        "Util/__init__.py",
+        "Util/Counter.py",
+        "Util/Padding.py",
+        "Util/number.py",
+        "Util/strxor.py",
+    };
+    inline for (cryptodome_files) |file| {
+        try vfs.createFile("/usr/local/lib/python3.13/site-packages/Cryptodome/" ++ file, @embedFile("python/cryptodome/" ++ file));
+    }
+}
+
+/// Host-side objects behind one runtime's guest handles
+const HandleTables = struct {
+    sockets: socket_mod.SocketTable,
+    streams: zlib_handlers.StreamTable,
+    crypto: crypto_handlers.ObjectTable,
+    json: json_handlers.ResultTable,
+
+    fn init(allocator: std.mem.Allocator) HandleTables {
+        return .{
+            .sockets = socket_mod.SocketTable.init(allocator),
+            .streams = zlib_handlers.StreamTable.init(allocator),
+            .crypto = crypto_handlers.ObjectTable.init(allocator),
+            .json = json_handlers.ResultTable.init(allocator),
+        };
+    }
+
+    /// Close and free everything the guest left open
+    fn deinit(self: *HandleTables) void {
+        self.json.deinit();
+        self.crypto.deinit();
+        self.streams.deinit();
+        self.sockets.deinit();
+    }
+
+    /// Make these the tables the host functions use on the calling thread
+    fn bind(self: *HandleTables) void {
+        socket_handlers.setTable(&self.sockets);
+        zlib_handlers.setTable(&self.streams);
+        crypto_handlers.setTable(&self.crypto);
+        json_handlers.setTable(&self.json);
+    }
+
+    /// Save every table for restore()
+    fn checkpoint(self: *HandleTables) !void {
+        self.sockets.checkpoint();
+        try self.streams.checkpoint();
+        try self.crypto.checkpoint();
+        try self.json.checkpoint();
+    }
+
+    /// Put every table back as checkpoint() left it
+    fn restore(self: *HandleTables) !void {
+        try self.json.restore();
+        try self.crypto.restore();
+        try self.streams.restore();
+        self.sockets.restore();
+    }
+
+    fn unbind() void {
+        socket_handlers.setTable(null);
+        zlib_handlers.setTable(null);
+        crypto_handlers.setTable(null);
+        json_handlers.setTable(null);
+    }
+};
+
+/// Take a reference on the process-wide idna cache, creating it for the
+/// first runtime. allocator must be thread-safe if runtimes run on several
+/// threads; the cache is freed with the allocator of the runtime that
+/// created it.
+fn acquireHandlers(allocator: std.mem.Allocator) !void {
+    handler_mutex.lock();
+    defer handler_mutex.unlock();
+
+    if (handler_users == 0) {
+        // Charset detection and base64/hex transforms are stateless
+        try idna_handlers.init(allocator);
+        handler_allocator = allocator;
+    }
+    handler_users += 1;
+}
+
+/// Drop a reference taken by acquireHandlers
+fn releaseHandlers() void {
+    handler_mutex.lock();
+    defer handler_mutex.unlock();
+
+    handler_users -= 1;
+    if (handler_users == 0) idna_handlers.deinit(handler_allocator);
+}
+
+/// Register every host function with a runtime's store
+fn registerHandlers(store: *zware.Store) !void {
+    try socket_handlers.registerSocketFunctions(store);
+    try zlib_handlers.registerZlibFunctions(store);
+    try crypto_handlers.registerCryptoFunctions(store);
+    try charset_handlers.registerCharsetFunctions(store);
+    try json_handlers.registerJsonFunctions(store);
+    try binascii_handlers.registerBinasciiFunctions(store);
+    try idna_handlers.registerIdnaFunctions(store);
+}
+
+test "reset restores pre-checkpoint fds and crypto objects" {
+    const allocator = std.testing.allocator;
+    const Hasher = @import("crypto/hash.zig").Hasher;
+
+    var vfs = try VirtualFileSystem.init(allocator);
+    defer vfs.deinit();
+    const preopen_fd = try vfs.addPreopen("/");
+    try vfs.createFile("/data/input.txt", "line one\nline two\n");
+    var handles = HandleTables.init(allocator);
+    defer handles.deinit();
+
+    // State the guest holds at the checkpoint
+    const fd = try vfs.open(preopen_fd, "data/input.txt", .{ .read = true });
+    var buf: [16]u8 = undefined;
+    _ = try vfs.read(fd, buf[0..5]);
+    const hash = try handles.crypto.add(.{ .hash = Hasher.init(.sha256) });
+    handles.crypto.get(hash).?.hash.update("line ");
+    try handles.checkpoint();
+    try vfs.checkpointFds();
+
+    // A job moves and closes the fd, unlinks its file, feeds the hash and
+    // opens more of each
+    _ = try vfs.seek(fd, 0, .end);
+    try vfs.close(fd);
+    try vfs.unlink(preopen_fd, "data/input.txt");
+    handles.crypto.get(hash).?.hash.update("job data");
+    _ = try handles.crypto.add(.{ .hash = Hasher.init(.md5) });
+    const job_fd = try vfs.open(preopen_fd, "data", .{ .read = true, .directory = true });
+
+    try handles.restore();
+    try vfs.restoreFds();
+
+    // The fd reads on from where it stood, and the hash only holds its
+    // checkpoint input
+    const n = try vfs.read(fd, &buf);
+    try std.testing.expectEqualSlices(u8, "one\nline two\n", buf[0..n]);
+    var digest: [32]u8 = undefined;
+    _ = try handles.crypto.get(hash).?.hash.digest(&digest);
+    var expected: [32]u8 = undefined;
+    std.crypto.hash.sha2.Sha256.hash("line ", &expected, .{});
+    try std.testing.expectEqualSlices(u8, &expected, &digest);
+
+    // What the job opened is gone, and numbering starts over
+    try std.testing.expect(handles.crypto.get(hash + 1) == null);
+    try std.testing.expectError(error.BadFileDescriptor, vfs.read(job_fd, &buf));
+    try std.testing.expectEqual(job_fd, try vfs.open(preopen_fd, "data", .{ .read = true, .directory = true }));
+}
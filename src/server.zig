@@ -0,0 +1,249 @@
+// Job Server (--serve)
+//
+// Keeps one initialized Runtime and runs jobs sent over a Unix socket, so
+// stdlib loading, module decoding and Py_Initialize happen once instead of
+// once per job.
+//
+// Every message in either direction is a frame: a u32 little-endian
+// payload length followed by the payload. Request payloads are parsed by
+// the guest dispatcher (python/hostjob.py, which documents the layout);
+// the server answers each with:
+//
+//     u8   status       0 ok, 1 exception, 2 timeout, 3 bad request,
+//                       4 runtime failure
+//     u64  elapsed_ns   wall time of the job on the host
+//     u32  len, bytes   stdout
+//     u32  len, bytes   stderr
+//     u32  len, bytes   result, or the error text for status 1-4
+//
+// A request's timeout is enforced as a deadline on the runtime (see
+// runtime.Runtime.setDeadline), so a job that runs too long is interrupted
+// and answered with status 2 without tying up its runtime.
+//
+// A connection may send any number of requests; they are answered in
+// order. With a single runtime (serve) connections are served one at a
+// time, since the interpreter runs one job at a time anyway. With a worker
+// pool (servePool) each connection gets a thread and its jobs run on
+// whichever worker is free; at most max_connections_per_worker connections
+// per worker are open at once, and further ones wait in the listen backlog.
+
+const std = @import("std");
+const runtime_mod = @import("runtime.zig");
+const Runtime = runtime_mod.Runtime;
+const pool_mod = @import("pool.zig");
+const Pool = pool_mod.Pool;
+
+/// Requests larger than this are refused and the connection closed
+pub const max_frame_len = 64 * 1024 * 1024;
+
+const status_runtime_failure = 4;
+
+/// Connections servePool keeps open per worker. More than one, so a worker
+/// is not idle while its client sends the next request; few, since every
+/// connection holds a thread and queued jobs only wait for a worker.
+pub const max_connections_per_worker = 4;
+
+/// Request flag (see python/hostjob.py): reset the interpreter after the
+/// job. The host also rolls back the job's VFS changes.
+const flag_reset = 1;
+
+/// Whether a request payload asks for a reset
+pub fn resetRequested(payload: []const u8) bool {
+    return payload.len >= 2 and payload[1] & flag_reset != 0;
+}
+
+/// Timeout a request payload asks for, in milliseconds; 0 for none
+pub fn requestTimeout(payload: []const u8) u32 {
+    if (payload.len < 6) return 0;
+    return std.mem.readInt(u32, payload[2..6], .little);
+}
+
+/// Checkpoint a runtime that is ready for jobs if its memory is reserved,
+/// so that resetting jobs also return the interpreter to this state (see
+/// runJob)
+pub fn checkpointForJobs(runtime: *Runtime) void {
+    if (runtime.reservation == null) return;
+    runtime.checkpoint() catch |err| {
+        std.debug.print("Warning: cannot checkpoint the interpreter; resets keep its memory: {}\n", .{err});
+    };
+}
+
+/// Run one request on a runtime, under the deadline it asks for. Files a
+/// resetting job creates, changes or deletes are rolled back afterwards,
+/// and a checkpointed runtime's memory is reset, along with the handles
+/// and fds in it (see Runtime.reset).
+pub fn runJob(runtime: *Runtime, dispatcher: runtime_mod.Callable, payload: []const u8, allocator: std.mem.Allocator) ![]u8 {
+    // Without interrupts the dispatcher times the job itself
+    const timeout_ms = requestTimeout(payload);
+    const saved = runtime.deadline;
+    if (timeout_ms != 0 and runtime.interrupt != null) {
+        try runtime.setDeadline(.{ .wall_ms = timeout_ms, .cpu_ms = saved.cpu_ms });
+    }
+    defer runtime.deadline = saved;
+
+    if (!resetRequested(payload)) return runtime.call(dispatcher, payload, allocator);
+
+    defer if (runtime.saved != null) runtime.reset() catch |err| {
+        std.debug.print("Warning: interpreter reset failed: {}\n", .{err});
+    };
+    const snap = runtime.vfs.snapshot();
+    defer runtime.vfs.release(snap);
+    defer runtime.vfs.rollback(snap) catch |err| {
+        std.debug.print("Warning: VFS rollback failed: {}\n", .{err});
+    };
+    return runtime.call(dispatcher, payload, allocator);
+}
+
+/// Bind socket_path and serve jobs until the process is stopped
+pub fn serve(runtime: *Runtime, allocator: std.mem.Allocator, socket_path: []const u8) !void {
+    const dispatcher = try runtime.compile(@embedFile("python/hostjob.py"), "run");
+    defer runtime.release(dispatcher);
+    checkpointForJobs(runtime);
+
+    var server = try listen(socket_path);
+    defer server.deinit();
+
+    while (true) {
+        const connection = server.accept() catch |err| {
+            std.debug.print("Warning: accept failed: {}\n", .{err});
+            continue;
+        };
+        defer connection.stream.close();
+
+        handleRuntimeConnection(runtime, allocator, dispatcher, connection.stream) catch |err| {
+            std.debug.print("Warning: connection closed: {}\n", .{err});
+        };
+    }
+}
+
+/// Bind socket_path and serve jobs on a worker pool until the process is
+/// stopped. allocator must be thread-safe.
+pub fn servePool(pool: *Pool, allocator: std.mem.Allocator, socket_path: []const u8) !void {
+    var server = try listen(socket_path);
+    defer server.deinit();
+
+    // Taken before accepting, so clients over the limit wait in the
+    // listen backlog rather than getting a thread each
+    var slots = std.Thread.Semaphore{ .permits = pool.workers.len * max_connections_per_worker };
+
+    while (true) {
+        slots.wait();
+        const connection = server.accept() catch |err| {
+            std.debug.print("Warning: accept failed: {}\n", .{err});
+            slots.post();
+            continue;
+        };
+
+        const thread = std.Thread.spawn(.{}, poolConnectionMain, .{ pool, allocator, connection.stream, &slots }) catch |err| {
+            std.debug.print("Warning: cannot start connection thread: {}\n", .{err});
+            connection.stream.close();
+            slots.post();
+            continue;
+        };
+        thread.detach();
+    }
+}
+
+fn listen(socket_path: []const u8) !std.net.Server {
+    // A stale socket file from a previous run would make bind fail
+    std.fs.cwd().deleteFile(socket_path) catch |err| switch (err) {
+        error.FileNotFound => {},
+        else => return err,
+    };
+
+    const address = try std.net.Address.initUnix(socket_path);
+    const server = try address.listen(.{});
+    std.debug.print("Serving jobs on {s}\n", .{socket_path});
+    return server;
+}
+
+fn handleRuntimeConnection(runtime: *Runtime, allocator: std.mem.Allocator, dispatcher: runtime_mod.Callable, stream: std.net.Stream) !void {
+    while (try readRequest(stream, allocator)) |payload| {
+        defer allocator.free(payload);
+
+        var timer = try std.time.Timer.start();
+        const reply = runJob(runtime, dispatcher, payload, allocator) catch |err| {
+            const message = if (err == error.PythonException) runtime.lastError() else @errorName(err);
+            try writeFailure(stream, timer.read(), message);
+            continue;
+        };
+        defer allocator.free(reply);
+        try writeReply(stream, timer.read(), reply);
+    }
+}
+
+fn poolConnectionMain(pool: *Pool, allocator: std.mem.Allocator, stream: std.net.Stream, slots: *std.Thread.Semaphore) void {
+    defer slots.post();
+    defer stream.close();
+    handlePoolConnection(pool, allocator, stream) catch |err| {
+        std.debug.print("Warning: connection closed: {}\n", .{err});
+    };
+}
+
+fn handlePoolConnection(pool: *Pool, allocator: std.mem.Allocator, stream: std.net.Stream) !void {
+    while (try readRequest(stream, allocator)) |payload| {
+        defer allocator.free(payload);
+
+        var job = pool_mod.Job{ .payload = payload };
+        pool.run(&job);
+        defer job.deinit(pool.allocator);
+
+        if (job.reply) |reply| {
+            try writeReply(stream, job.elapsed_ns, reply);
+        } else {
+            try writeFailure(stream, job.elapsed_ns, job.failure orelse "OutOfMemory");
+        }
+    }
+}
+
+/// Read one request frame; null on a clean end of stream
+fn readRequest(stream: std.net.Stream, allocator: std.mem.Allocator) !?[]u8 {
+    var len_bytes: [4]u8 = undefined;
+    if (!try readExact(stream, &len_bytes, true)) return null;
+    const len = std.mem.readInt(u32, &len_bytes, .little);
+    if (len > max_frame_len) return error.FrameTooLarge;
+
+    const payload = try allocator.alloc(u8, len);
+    errdefer allocator.free(payload);
+    _ = try readExact(stream, payload, false);
+    return payload;
+}
+
+/// Frame the dispatcher's reply, which is the response without elapsed_ns
+fn writeReply(stream: std.net.Stream, elapsed: u64, reply: []const u8) !void {
+    if (reply.len == 0) return error.MalformedReply;
+    var header: [13]u8 = undefined;
+    std.mem.writeInt(u32, header[0..4], @intCast(reply.len + 8), .little);
+    header[4] = reply[0];
+    std.mem.writeInt(u64, header[5..13], elapsed, .little);
+    try stream.writeAll(&header);
+    try stream.writeAll(reply[1..]);
+}
+
+/// Answer a request the dispatcher could not handle
+fn writeFailure(stream: std.net.Stream, elapsed: u64, message: []const u8) !void {
+    var header: [25]u8 = undefined;
+    std.mem.writeInt(u32, header[0..4], @intCast(1 + 8 + 4 + 4 + 4 + message.len), .little);
+    header[4] = status_runtime_failure;
+    std.mem.writeInt(u64, header[5..13], elapsed, .little);
+    std.mem.writeInt(u32, header[13..17], 0, .little); // stdout
+    std.mem.writeInt(u32, header[17..21], 0, .little); // stderr
+    std.mem.writeInt(u32, header[21..25], @intCast(message.len), .little);
+    try stream.writeAll(&header);
+    try stream.writeAll(message);
+}
+
+/// Fill buf from the stream. Returns false on a clean end of stream before
+/// the first byte when eof_ok is set.
+fn readExact(stream: std.net.Stream, buf: []u8, eof_ok: bool) !bool {
+    var filled: usize = 0;
+    while (filled < buf.len) {
+        const n = try stream.read(buf[filled..]);
+        if (n == 0) {
+            if (filled == 0 and eof_ok) return false;
+            return error.EndOfStream;
+        }
+        filled += n;
+    }
+    return true;
+}
@@ -135,19 +135,22 @@ pub const Socket = struct {
     }
 };
 
-/// Global socket table
+/// Sockets of one runtime, keyed by the handle given to the guest. Used
+/// only by the thread running that runtime, so it takes no lock, and
+/// pointers from get() stay valid until the next create or remove.
 pub const SocketTable = struct {
     sockets: std.AutoHashMap(SocketHandle, Socket),
     next_handle: SocketHandle,
     allocator: std.mem.Allocator,
-    mutex: std.Thread.Mutex,
+    /// next_handle when checkpoint() was called, for restore()
+    saved_next_handle: ?SocketHandle,
 
     pub fn init(allocator: std.mem.Allocator) SocketTable {
         return SocketTable{
             .sockets = std.AutoHashMap(SocketHandle, Socket).init(allocator),
             .next_handle = 1000, // Start at 1000 to avoid conflicts with FDs
             .allocator = allocator,
-            .mutex = std.Thread.Mutex{},
+            .saved_next_handle = null,
         };
     }
 
@@ -161,9 +164,6 @@ pub const SocketTable = struct {
     }
 
     pub fn create(self: *SocketTable, socket_type: SocketType, family: AddressFamily) !SocketHandle {
-        self.mutex.lock();
-        defer self.mutex.unlock();
-
         const handle = self.next_handle;
         self.next_handle += 1;
 
@@ -174,20 +174,33 @@ pub const SocketTable = struct {
     }
 
     pub fn get(self: *SocketTable, handle: SocketHandle) ?*Socket {
-        self.mutex.lock();
-        defer self.mutex.unlock();
         return self.sockets.getPtr(handle);
     }
 
     pub fn remove(self: *SocketTable, handle: SocketHandle) void {
-        self.mutex.lock();
-        defer self.mutex.unlock();
-
         if (self.sockets.getPtr(handle)) |socket| {
             socket.deinit();
             _ = self.sockets.remove(handle);
         }
     }
+
+    /// Note where handles stand for restore()
+    pub fn checkpoint(self: *SocketTable) void {
+        self.saved_next_handle = self.next_handle;
+    }
+
+    /// Close every socket and number new ones as at checkpoint(). A
+    /// connection cannot be rewound, so sockets from before the checkpoint
+    /// are closed too: the guest gets EBADF rather than a stream some
+    /// earlier job has already read from. Does nothing without a
+    /// checkpoint.
+    pub fn restore(self: *SocketTable) void {
+        const first = self.saved_next_handle orelse return;
+        var iter = self.sockets.valueIterator();
+        while (iter.next()) |socket| socket.deinit();
+        self.sockets.clearRetainingCapacity();
+        self.next_handle = first;
+    }
 };
 
 /// DNS resolution result
@@ -7,25 +7,14 @@ const AddressFamily = socket_mod.AddressFamily;
 const SocketAddress = socket_mod.SocketAddress;
 const SocketError = socket_mod.SocketError;
 
-/// Global socket table
-var global_socket_table: ?*SocketTable = null;
-
-/// Initialize the socket system
-pub fn init(allocator: std.mem.Allocator) !void {
-    if (global_socket_table == null) {
-        const table = try allocator.create(SocketTable);
-        table.* = SocketTable.init(allocator);
-        global_socket_table = table;
-    }
-}
-
-/// Deinitialize the socket system
-pub fn deinit(allocator: std.mem.Allocator) void {
-    if (global_socket_table) |table| {
-        table.deinit();
-        allocator.destroy(table);
-        global_socket_table = null;
-    }
+/// Socket table of the runtime running on this thread. Each Runtime owns
+/// one, so a guest can only reach its own sockets; Runtime binds it before
+/// every call into the guest, as it does the VFS.
+threadlocal var current_table: ?*SocketTable = null;
+
+/// Set the socket table used by the socket handlers on the calling thread
+pub fn setTable(table: ?*SocketTable) void {
+    current_table = table;
 }
 
 /// Helper to convert Zig errors to WASI socket errors
@@ -53,7 +42,7 @@ pub fn sockOpen(vm: *zware.VirtualMachine, _: usize) zware.WasmError!void {
     const socktype_raw = vm.popOperand(i32);
     const af_raw = vm.popOperand(i32);
 
-    const table = global_socket_table orelse {
+    const table = current_table orelse {
         try vm.pushOperand(u32, @intFromEnum(SocketError.inval));
         return;
     };
@@ -93,7 +82,7 @@ pub fn sockConnect(vm: *zware.VirtualMachine, _: usize) zware.WasmError!void {
     const addr_ptr = vm.popOperand(u32);
     const sock_fd = vm.popOperand(u32);
 
-    const table = global_socket_table orelse {
+    const table = current_table orelse {
         try vm.pushOperand(u32, @intFromEnum(SocketError.inval));
         return;
     };
@@ -159,7 +148,7 @@ pub fn sockSend(vm: *zware.VirtualMachine, _: usize) zware.WasmError!void {
     const buf_ptr = vm.popOperand(u32);
     const sock_fd = vm.popOperand(u32);
 
-    const table = global_socket_table orelse {
+    const table = current_table orelse {
         try vm.pushOperand(u32, @intFromEnum(SocketError.inval));
         return;
     };
@@ -197,7 +186,7 @@ pub fn sockRecv(vm: *zware.VirtualMachine, _: usize) zware.WasmError!void {
     const buf_ptr = vm.popOperand(u32);
     const sock_fd = vm.popOperand(u32);
 
-    const table = global_socket_table orelse {
+    const table = current_table orelse {
         try vm.pushOperand(u32, @intFromEnum(SocketError.inval));
         return;
     };
@@ -232,7 +221,7 @@ pub fn sockRecv(vm: *zware.VirtualMachine, _: usize) zware.WasmError!void {
 pub fn sockClose(vm: *zware.VirtualMachine, _: usize) zware.WasmError!void {
     const sock_fd = vm.popOperand(u32);
 
-    const table = global_socket_table orelse {
+    const table = current_table orelse {
         try vm.pushOperand(u32, @intFromEnum(SocketError.inval));
         return;
     };
@@ -14,6 +14,7 @@ const AutoHashMap = std.AutoHashMap;
 const vfs = @import("vfs.zig");
 const MemoryFile = @import("memory_file.zig").MemoryFile;
 const MemoryDirectory = @import("memory_directory.zig").MemoryDirectory;
+const Node = @import("memory_directory.zig").Node;
 
 const FileType = vfs.FileType;
 const OpenFlags = vfs.OpenFlags;
@@ -118,29 +119,83 @@ pub const FdTable = struct {
     /// Next available fd number (starts at 3, after stdio)
     next_fd: i32,
 
+    /// Copy of the table taken by checkpoint(), for restore()
+    saved: ?Saved,
+
     /// Reserved fds (0=stdin, 1=stdout, 2=stderr)
     pub const RESERVED_FDS: i32 = 3;
 
+    const Saved = struct {
+        fds: AutoHashMap(i32, FileDescriptor),
+        next_fd: i32,
+    };
+
     pub fn init(allocator: Allocator) FdTable {
         return FdTable{
             .allocator = allocator,
             .fds = AutoHashMap(i32, FileDescriptor).init(allocator),
             .next_fd = RESERVED_FDS, // Start after stdio
+            .saved = null,
         };
     }
 
     pub fn deinit(self: *FdTable) void {
-        // Free any allocated paths
-        var iter = self.fds.iterator();
-        while (iter.next()) |entry| {
-            if (entry.value_ptr.path) |path| {
+        self.freeFds(&self.fds);
+        if (self.saved) |*saved| self.freeFds(&saved.fds);
+    }
+
+    /// Free a map of descriptors and the paths they own
+    fn freeFds(self: *FdTable, fds: *AutoHashMap(i32, FileDescriptor)) void {
+        var iter = fds.valueIterator();
+        while (iter.next()) |desc| {
+            if (desc.path) |path| {
                 self.allocator.free(path);
             }
-            if (entry.value_ptr.dir_state.cached_entries) |entries| {
+            if (desc.dir_state.cached_entries) |entries| {
                 self.allocator.free(entries);
             }
         }
-        self.fds.deinit();
+        fds.deinit();
+    }
+
+    /// Copy a map of descriptors, each with its own path
+    fn cloneFds(self: *FdTable, fds: *const AutoHashMap(i32, FileDescriptor)) VfsError!AutoHashMap(i32, FileDescriptor) {
+        var copy = AutoHashMap(i32, FileDescriptor).init(self.allocator);
+        errdefer self.freeFds(&copy);
+        copy.ensureTotalCapacity(fds.count()) catch return error.OutOfMemory;
+
+        var iter = fds.iterator();
+        while (iter.next()) |entry| {
+            var desc = entry.value_ptr.*;
+            // Only a cache; readdir fills it again
+            desc.dir_state.cached_entries = null;
+            if (desc.path) |path| {
+                const path_copy = self.allocator.dupe(u8, path) catch return error.OutOfMemory;
+                desc.path = path_copy;
+                // A preopen's guest path is its path
+                if (desc.kind == .preopen) desc.resource.preopen.guest_path = path_copy;
+            }
+            copy.putAssumeCapacityNoClobber(entry.key_ptr.*, desc);
+        }
+        return copy;
+    }
+
+    /// Remember every open fd, position included, for restore()
+    pub fn checkpoint(self: *FdTable) VfsError!void {
+        const fds = try self.cloneFds(&self.fds);
+        if (self.saved) |*saved| self.freeFds(&saved.fds);
+        self.saved = .{ .fds = fds, .next_fd = self.next_fd };
+    }
+
+    /// Put the table back as checkpoint() left it: fds opened since are
+    /// dropped, and fds closed or moved since are open again at their old
+    /// position. Does nothing without a checkpoint.
+    pub fn restore(self: *FdTable) VfsError!void {
+        const saved = if (self.saved) |*saved| saved else return;
+        const fds = try self.cloneFds(&saved.fds);
+        self.freeFds(&self.fds);
+        self.fds = fds;
+        self.next_fd = saved.next_fd;
     }
 
     /// Initialize standard streams (stdin, stdout, stderr)
@@ -309,6 +364,28 @@ pub const FdTable = struct {
         // that's managed by the VFS
     }
 
+    /// Whether any open fd, or any fd restore() would reopen, refers to
+    /// the given file or directory
+    pub fn references(self: *FdTable, node: Node) bool {
+        if (fdsReference(&self.fds, node)) return true;
+        if (self.saved) |*saved| return fdsReference(&saved.fds, node);
+        return false;
+    }
+
+    fn fdsReference(fds: *const AutoHashMap(i32, FileDescriptor), node: Node) bool {
+        var iter = fds.valueIterator();
+        while (iter.next()) |desc| {
+            switch (node) {
+                .file => |file| if (desc.kind == .memory_file and desc.resource.memory_file == file) return true,
+                .directory => |dir| {
+                    if (desc.kind == .memory_directory and desc.resource.memory_directory == dir) return true;
+                    if (desc.kind == .preopen and desc.resource.preopen.host_dir == dir) return true;
+                },
+            }
+        }
+        return false;
+    }
+
     /// Duplicate a file descriptor
     pub fn dup(self: *FdTable, old_fd: i32) VfsError!i32 {
         const old = self.get(old_fd) orelse return error.BadFileDescriptor;
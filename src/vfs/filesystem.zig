@@ -6,6 +6,7 @@
 // - Provides file operations (open, read, write, etc.)
 // - Manages preopens and mount points
 // - Optionally passes through to real filesystem
+// - Writes persistent subtrees back to host directories
 
 const std = @import("std");
 const Allocator = std.mem.Allocator;
@@ -20,6 +21,9 @@ const FdTable = @import("fd_table.zig").FdTable;
 const FileDescriptor = @import("fd_table.zig").FileDescriptor;
 const PreopenInfo = @import("fd_table.zig").PreopenInfo;
 const Backend = @import("fd_table.zig").Backend;
+const persist = @import("persist.zig");
+pub const PersistOptions = persist.PersistOptions;
+pub const FlushPolicy = persist.FlushPolicy;
 
 const FileType = vfs.FileType;
 const FileStat = vfs.FileStat;
@@ -35,6 +39,55 @@ const MountPoint = struct {
     host_fd: posix.fd_t,
 };
 
+/// Subtree kept in step with a host directory (see mountPersistent)
+const PersistentMount = struct {
+    /// Absolute VFS path of the subtree
+    guest_path: []u8,
+    host_path: []u8,
+    options: PersistOptions,
+    last_flush_ns: i128,
+};
+
+/// Undo record kept while a snapshot is active
+const JournalEntry = union(enum) {
+    /// A child was added; rollback takes it out again
+    added: struct { dir: *MemoryDirectory, name: []u8 },
+    /// A child was removed; the journal owns the node until rollback puts
+    /// it back or the outermost snapshot is released
+    removed: struct { dir: *MemoryDirectory, name: []u8, node: Node, whiteout_added: bool },
+    /// A file's content before its first change since the snapshot
+    content: struct { file: *MemoryFile, saved: MemoryFile.Saved },
+    /// A child was moved; rollback moves it back
+    renamed: struct {
+        from: *MemoryDirectory,
+        from_name: []u8,
+        to: *MemoryDirectory,
+        to_name: []u8,
+        whiteout_added: bool,
+    },
+};
+
+/// Quotas for one VFS (for an overlay, its own layer); null = unlimited
+pub const Limits = struct {
+    /// File content held by this VFS, including content saved for rollback
+    max_bytes: ?u64 = null,
+    /// Files and directories created in this VFS
+    max_inodes: ?u64 = null,
+};
+
+/// What a VFS holds against its Limits
+pub const Usage = struct {
+    bytes: u64 = 0,
+    inodes: u64 = 0,
+    peak_bytes: u64 = 0,
+    peak_inodes: u64 = 0,
+};
+
+/// A point the VFS can roll back to (see VirtualFileSystem.snapshot)
+pub const Snapshot = struct {
+    position: usize,
+};
+
 /// Magic path prefix for VFS routing
 /// Paths starting with this prefix are routed to the in-memory VFS
 /// All other paths go to the real filesystem via WASI
@@ -59,6 +112,40 @@ pub const VirtualFileSystem = struct {
     /// Whether to enable debug logging
     debug: bool,
 
+    /// Removed files and directories still open through an fd; freed once
+    /// the last such fd is closed
+    orphans: std.ArrayListUnmanaged(Node),
+
+    /// Undo records since the outermost active snapshot
+    journal: std.ArrayListUnmanaged(JournalEntry),
+
+    /// Active snapshots; changes are journaled while nonzero
+    snapshot_depth: usize,
+
+    /// Bumped by snapshot and rollback, so each file's content is saved
+    /// once per interval between them
+    generation: u64,
+
+    /// Set by freeze; the tree can no longer change
+    frozen: bool,
+
+    limits: Limits,
+    used: Usage,
+
+    /// Inodes below this came from an overlay base and are not charged
+    first_own_inode: u64,
+
+    /// Subtrees written back to the host
+    persistent: std.ArrayListUnmanaged(PersistentMount),
+
+    /// Applies write-back on its own thread; started by the first
+    /// persistent mount
+    writer: ?*persist.Writer,
+
+    /// Paths removed under persistent mounts, deleted from the host at
+    /// the next write-back unless they exist again by then
+    removed_paths: std.ArrayListUnmanaged([]u8),
+
     pub fn init(allocator: Allocator) !*VirtualFileSystem {
         const self = try allocator.create(VirtualFileSystem);
         errdefer allocator.destroy(self);
@@ -70,6 +157,17 @@ pub const VirtualFileSystem = struct {
             .next_inode = 2, // 1 is reserved for root
             .mounts = .empty,
             .debug = false,
+            .orphans = .empty,
+            .journal = .empty,
+            .snapshot_depth = 0,
+            .generation = 1,
+            .frozen = false,
+            .limits = .{},
+            .used = .{},
+            .first_own_inode = 2,
+            .persistent = .empty,
+            .writer = null,
+            .removed_paths = .empty,
         };
 
         // Initialize stdio
@@ -79,6 +177,19 @@ pub const VirtualFileSystem = struct {
     }
 
     pub fn deinit(self: *VirtualFileSystem) void {
+        // Persistent mounts are always written back at exit
+        self.flushPersistent() catch |err| {
+            std.debug.print("Warning: VFS write-back failed: {}\n", .{err});
+        };
+        if (self.writer) |writer| writer.deinit();
+        for (self.persistent.items) |mount| {
+            self.allocator.free(mount.guest_path);
+            self.allocator.free(mount.host_path);
+        }
+        self.persistent.deinit(self.allocator);
+        for (self.removed_paths.items) |path| self.allocator.free(path);
+        self.removed_paths.deinit(self.allocator);
+
         // Close mount points
         for (self.mounts.items) |mount| {
             self.allocator.free(mount.guest_path);
@@ -88,10 +199,68 @@ pub const VirtualFileSystem = struct {
         self.mounts.deinit(self.allocator);
 
         self.fd_table.deinit();
+        for (self.journal.items) |entry| self.dropEntry(entry);
+        self.journal.deinit(self.allocator);
+        for (self.orphans.items) |node| self.freeNode(node);
+        self.orphans.deinit(self.allocator);
         self.root.deinit();
         self.allocator.destroy(self);
     }
 
+    /// Make the tree immutable so it can serve as the base of overlays on
+    /// any number of threads. Overlays read a frozen tree without locks:
+    /// nothing in it is written again, so there is nothing to synchronize
+    /// and no node to reclaim while readers exist. Changes after this fail
+    /// with error.ReadOnly. Other threads must only reach the tree through
+    /// overlays; this VFS's own fd table stays single-threaded.
+    pub fn freeze(self: *VirtualFileSystem) void {
+        self.debugLog("freeze()", .{});
+        self.frozen = true;
+    }
+
+    /// Give every file a modification time derived from a hash of its
+    /// content. Caches validated by mtime and size, like CPython's .pyc
+    /// files, are then in effect keyed by content and stay valid in later
+    /// processes that load the same files.
+    pub fn stampContentTimes(self: *VirtualFileSystem) void {
+        stampTree(self.root);
+    }
+
+    fn stampTree(dir: *MemoryDirectory) void {
+        var iter = dir.children.valueIterator();
+        while (iter.next()) |node| switch (node.*) {
+            .file => |file| {
+                // Mapped files keep their host times: hashing them would
+                // read in pages the guest may never touch
+                if (file.mapping != null) continue;
+                // Whole seconds below 2^32, which is what a .pyc records
+                const hash: u32 = @truncate(std.hash.Wyhash.hash(0, file.getContent()));
+                file.mtime = @as(u64, hash) * std.time.ns_per_s;
+                file.ctime = file.mtime;
+            },
+            .directory => |child| stampTree(child),
+        };
+    }
+
+    fn checkWritable(self: *const VirtualFileSystem) VfsError!void {
+        if (self.frozen) return error.ReadOnly;
+    }
+
+    /// Create a VFS layered over base: every file of base is visible, but
+    /// nodes are only copied into this VFS when looked up, file content
+    /// only when written, and deletions are recorded as whiteouts. base
+    /// must be frozen and outlive the overlay. Each overlay has its own fd
+    /// table and is used by one thread at a time.
+    pub fn initOverlay(allocator: Allocator, base: *const VirtualFileSystem) !*VirtualFileSystem {
+        std.debug.assert(base.frozen);
+        const self = try init(allocator);
+        self.root.lower = base.root;
+        // Copied-up nodes keep their base inodes; new ones come after
+        self.next_inode = base.next_inode;
+        self.first_own_inode = base.next_inode;
+        return self;
+    }
+
     /// Enable or disable debug logging
     pub fn setDebug(self: *VirtualFileSystem, enabled: bool) void {
         self.debug = enabled;
@@ -103,6 +272,48 @@ pub const VirtualFileSystem = struct {
         }
     }
 
+    /// Set quotas. Operations that would exceed them fail with
+    /// error.NoSpace (ENOSPC); usage already above a new limit is kept.
+    pub fn setLimits(self: *VirtualFileSystem, limits: Limits) void {
+        self.limits = limits;
+    }
+
+    /// Current and peak usage
+    pub fn usage(self: *const VirtualFileSystem) Usage {
+        return self.used;
+    }
+
+    fn chargeBytes(self: *VirtualFileSystem, n: u64) VfsError!void {
+        if (self.limits.max_bytes) |max| {
+            if (self.used.bytes + n > max) return error.NoSpace;
+        }
+        self.used.bytes += n;
+        self.used.peak_bytes = @max(self.used.peak_bytes, self.used.bytes);
+    }
+
+    fn refundBytes(self: *VirtualFileSystem, n: u64) void {
+        self.used.bytes -= n;
+    }
+
+    fn chargeInode(self: *VirtualFileSystem) VfsError!void {
+        if (self.limits.max_inodes) |max| {
+            if (self.used.inodes + 1 > max) return error.NoSpace;
+        }
+        self.used.inodes += 1;
+        self.used.peak_inodes = @max(self.used.peak_inodes, self.used.inodes);
+    }
+
+    /// Replace a file's content, keeping the byte count in step
+    fn replaceContent(self: *VirtualFileSystem, file: *MemoryFile, content: []const u8) VfsError!void {
+        const before = file.ownedBytes();
+        if (content.len > before) try self.chargeBytes(content.len - before);
+        file.setContent(content) catch |err| {
+            if (content.len > before) self.refundBytes(content.len - before);
+            return err;
+        };
+        if (content.len < before) self.refundBytes(before - content.len);
+    }
+
     /// Generate a new unique inode number
     fn nextInode(self: *VirtualFileSystem) u64 {
         const inode = self.next_inode;
@@ -251,7 +462,7 @@ pub const VirtualFileSystem = struct {
                         current_dir = parent;
                     }
                 } else {
-                    const node = current_dir.lookup(last_component) orelse return error.FileNotFound;
+                    const node = (try current_dir.lookup(last_component)) orelse return error.FileNotFound;
                     switch (node) {
                         .directory => |dir| {
                             current_dir = dir;
@@ -275,6 +486,7 @@ pub const VirtualFileSystem = struct {
     /// Create a directory at the given path
     pub fn mkdir(self: *VirtualFileSystem, dir_fd: i32, path: []const u8) VfsError!void {
         self.debugLog("mkdir(fd={}, path=\"{s}\")", .{ dir_fd, path });
+        try self.checkWritable();
 
         const resolved = self.resolvePath(dir_fd, path) catch |err| return @as(VfsError, @errorCast(err));
 
@@ -282,12 +494,14 @@ pub const VirtualFileSystem = struct {
             return error.InvalidPath;
         }
 
-        _ = try resolved.dir.createDirectory(resolved.name, self.nextInode());
+        const dir = try resolved.dir.createDirectory(resolved.name, self.nextInode());
+        try self.nodeAdded(resolved.dir, resolved.name, .{ .directory = dir });
     }
 
     /// Create a file with content at the given path
     pub fn createFile(self: *VirtualFileSystem, path: []const u8, content: []const u8) VfsError!void {
         self.debugLog("createFile(path=\"{s}\", len={})", .{ path, content.len });
+        try self.checkWritable();
 
         // Ensure parent directories exist
         try self.mkdirp(path);
@@ -299,11 +513,12 @@ pub const VirtualFileSystem = struct {
         }
 
         // Check if file already exists
-        if (resolved.dir.lookup(resolved.name)) |existing| {
+        if (try resolved.dir.lookup(resolved.name)) |existing| {
             switch (existing) {
                 .file => |f| {
                     // Overwrite existing file
-                    try f.setContent(content);
+                    try self.recordContent(f);
+                    try self.replaceContent(f, content);
                     return;
                 },
                 .directory => return error.IsADirectory,
@@ -311,12 +526,48 @@ pub const VirtualFileSystem = struct {
         }
 
         // Create new file
+        try self.chargeBytes(content.len);
+        errdefer self.refundBytes(content.len);
         const file = try resolved.dir.createFile(resolved.name, self.nextInode());
-        _ = try file.pwrite(content, 0);
+        try self.nodeAdded(resolved.dir, resolved.name, .{ .file = file });
+        file.setContent(content) catch |err| {
+            // Undo the creation; the node was not in the tree before
+            self.destroyNode(resolved.dir.detach(resolved.name).?);
+            self.used.inodes -= 1;
+            return err;
+        };
+    }
+
+    /// Create a file at path (replacing one already there) whose content is
+    /// the host file at host_path, mapped read-only rather than read: its
+    /// pages are read from disk when the guest first reads them, and
+    /// copied on first write
+    pub fn mapFile(self: *VirtualFileSystem, path: []const u8, host_path: []const u8) VfsError!void {
+        self.debugLog("mapFile(path=\"{s}\", host_path=\"{s}\")", .{ path, host_path });
+        try self.checkWritable();
+
+        try self.mkdirp(path);
+        const resolved = self.resolvePath(3, path) catch |err| return @as(VfsError, @errorCast(err)); // Use first preopen as base
+        if (resolved.name.len == 0) {
+            return error.InvalidPath;
+        }
+
+        var host_dir = fs.cwd().openDir(fs.path.dirname(host_path) orelse ".", .{}) catch |err| return switch (err) {
+            error.FileNotFound => error.FileNotFound,
+            else => error.IO,
+        };
+        defer host_dir.close();
+        const name = fs.path.basename(host_path);
+        host_dir.access(name, .{}) catch |err| return switch (err) {
+            error.FileNotFound => error.FileNotFound,
+            else => error.IO,
+        };
+        try self.loadHostFile(resolved.dir, host_dir, name);
     }
 
     /// Create all directories in path (like mkdir -p)
     pub fn mkdirp(self: *VirtualFileSystem, path: []const u8) VfsError!void {
+        try self.checkWritable();
         var current_dir = self.root;
 
         var iter = std.mem.splitSequence(u8, path, "/");
@@ -334,7 +585,7 @@ pub const VirtualFileSystem = struct {
         // Create directories for all but the last component
         if (remaining_path.items.len > 0) {
             for (remaining_path.items[0 .. remaining_path.items.len - 1]) |component| {
-                if (current_dir.lookup(component)) |node| {
+                if (try current_dir.lookup(component)) |node| {
                     switch (node) {
                         .directory => |dir| {
                             current_dir = dir;
@@ -342,15 +593,407 @@ pub const VirtualFileSystem = struct {
                         .file => return error.FileExists,
                     }
                 } else {
-                    current_dir = try current_dir.createDirectory(component, self.nextInode());
+                    const dir = try current_dir.createDirectory(component, self.nextInode());
+                    try self.nodeAdded(current_dir, component, .{ .directory = dir });
+                    current_dir = dir;
                 }
             }
         }
     }
 
+    /// Remove a file
+    pub fn unlink(self: *VirtualFileSystem, dir_fd: i32, path: []const u8) VfsError!void {
+        self.debugLog("unlink(fd={}, path=\"{s}\")", .{ dir_fd, path });
+        try self.checkWritable();
+
+        const resolved = self.resolvePath(dir_fd, path) catch |err| return @as(VfsError, @errorCast(err));
+        if (resolved.name.len == 0) {
+            return error.IsADirectory;
+        }
+
+        const node = (try resolved.dir.lookup(resolved.name)) orelse return error.FileNotFound;
+        if (node == .directory) {
+            return error.IsADirectory;
+        }
+
+        try self.removeNode(resolved.dir, resolved.name);
+    }
+
+    /// Remove an empty directory
+    pub fn rmdir(self: *VirtualFileSystem, dir_fd: i32, path: []const u8) VfsError!void {
+        self.debugLog("rmdir(fd={}, path=\"{s}\")", .{ dir_fd, path });
+        try self.checkWritable();
+
+        const resolved = self.resolvePath(dir_fd, path) catch |err| return @as(VfsError, @errorCast(err));
+        if (resolved.name.len == 0) {
+            return error.InvalidArgument;
+        }
+
+        const node = (try resolved.dir.lookup(resolved.name)) orelse return error.FileNotFound;
+        const dir = switch (node) {
+            .directory => |d| d,
+            .file => return error.NotADirectory,
+        };
+        // Entries still in the lower layer count too
+        try dir.copyUpAll();
+        if (!dir.isEmpty()) {
+            return error.NotEmpty;
+        }
+
+        try self.removeNode(resolved.dir, resolved.name);
+    }
+
+    /// Move a file or directory, replacing a file or empty directory at
+    /// the destination. Open fds follow the node.
+    pub fn rename(self: *VirtualFileSystem, old_fd: i32, old_path: []const u8, new_fd: i32, new_path: []const u8) VfsError!void {
+        self.debugLog("rename(fd={}, path=\"{s}\", new_fd={}, new_path=\"{s}\")", .{ old_fd, old_path, new_fd, new_path });
+        try self.checkWritable();
+
+        const from = self.resolvePath(old_fd, old_path) catch |err| return @as(VfsError, @errorCast(err));
+        const to = self.resolvePath(new_fd, new_path) catch |err| return @as(VfsError, @errorCast(err));
+        if (from.name.len == 0 or to.name.len == 0) {
+            return error.InvalidArgument;
+        }
+
+        const node = (try from.dir.lookup(from.name)) orelse return error.FileNotFound;
+        if (from.dir == to.dir and std.mem.eql(u8, from.name, to.name)) {
+            return;
+        }
+        if (node == .directory) {
+            // A directory cannot move below itself
+            var current: ?*MemoryDirectory = to.dir;
+            while (current) |dir| : (current = dir.parent) {
+                if (dir == node.directory) return error.InvalidArgument;
+            }
+        }
+
+        const replaces = try to.dir.lookup(to.name);
+        if (replaces) |existing| {
+            switch (existing) {
+                .file => if (node == .directory) return error.NotADirectory,
+                .directory => |dir| {
+                    if (node == .file) return error.IsADirectory;
+                    try dir.copyUpAll();
+                    if (!dir.isEmpty()) return error.NotEmpty;
+                },
+            }
+        }
+
+        // Allocate everything before the destination is unlinked, so
+        // running out of memory leaves both paths as they were
+        var removal: ?Removal = if (replaces != null) try self.prepareRemoval(to.dir, to.name) else null;
+        errdefer if (removal) |*r| self.cancelRemoval(to.dir, to.name, r);
+
+        const owned_name = self.allocator.dupe(u8, to.name) catch return error.OutOfMemory;
+        errdefer self.allocator.free(owned_name);
+        const dir_name: ?[]u8 = if (node == .directory)
+            self.allocator.dupe(u8, to.name) catch return error.OutOfMemory
+        else
+            null;
+        errdefer if (dir_name) |name| self.allocator.free(name);
+        to.dir.children.ensureUnusedCapacity(1) catch return error.OutOfMemory;
+
+        // The source leaves its directory as a removal would, less the
+        // journal entry: the rename's own entry covers it
+        const from_removed_path = try self.removedPath(from.dir, from.name);
+        errdefer if (from_removed_path) |path| self.allocator.free(path);
+        const removed_paths: usize = @intFromBool(from_removed_path != null) +
+            @intFromBool(removal != null and removal.?.removed_path != null);
+        self.removed_paths.ensureUnusedCapacity(self.allocator, removed_paths) catch return error.OutOfMemory;
+        const had_whiteout = from.dir.whiteouts.contains(from.name);
+        const reserved_whiteout = try from.dir.reserveWhiteout(from.name);
+        errdefer if (reserved_whiteout) from.dir.clearWhiteout(from.name);
+
+        var journal_names: ?struct { from: []u8, to: []u8 } = null;
+        if (self.snapshot_depth > 0) {
+            // One entry for the rename, one for the replaced node
+            const entries: usize = if (removal != null) 2 else 1;
+            self.journal.ensureUnusedCapacity(self.allocator, entries) catch return error.OutOfMemory;
+            const from_copy = self.allocator.dupe(u8, from.name) catch return error.OutOfMemory;
+            const to_copy = self.allocator.dupe(u8, to.name) catch {
+                self.allocator.free(from_copy);
+                return error.OutOfMemory;
+            };
+            journal_names = .{ .from = from_copy, .to = to_copy };
+        }
+
+        // Nothing below can fail
+        if (removal) |*r| self.finishRemoval(to.dir, to.name, r);
+        if (from_removed_path) |path| self.removed_paths.appendAssumeCapacity(path);
+        _ = from.dir.remove(from.name) catch unreachable;
+
+        if (dir_name) |name| {
+            self.allocator.free(node.directory.name);
+            node.directory.name = name;
+        }
+        to.dir.attach(owned_name, node) catch unreachable;
+        to.dir.updateModTime();
+
+        if (journal_names) |names| {
+            self.journal.appendAssumeCapacity(.{ .renamed = .{
+                .from = from.dir,
+                .from_name = names.from,
+                .to = to.dir,
+                .to_name = names.to,
+                .whiteout_added = !had_whiteout and from.dir.whiteouts.contains(names.from),
+            } });
+        }
+        // Write the node back under its new path
+        if (self.persistent.items.len > 0) markDirty(node);
+    }
+
+    /// Detach a child and free it, or keep it as an orphan while an fd
+    /// still refers to it
+    fn removeNode(self: *VirtualFileSystem, parent: *MemoryDirectory, name: []const u8) VfsError!void {
+        var removal = try self.prepareRemoval(parent, name);
+        self.finishRemoval(parent, name, &removal);
+    }
+
+    /// What removing a child allocates, taken before the child is removed
+    const Removal = struct {
+        /// Path to note for write-back, if under a persistent mount
+        removed_path: ?[]u8,
+        /// Name for the journal entry, while a snapshot is active
+        journal_name: ?[]u8,
+        had_whiteout: bool,
+        reserved_whiteout: bool,
+    };
+
+    /// Allocate everything removing name from parent needs, so that
+    /// finishRemoval cannot fail. Undo with cancelRemoval.
+    fn prepareRemoval(self: *VirtualFileSystem, parent: *MemoryDirectory, name: []const u8) VfsError!Removal {
+        const removed_path = try self.removedPath(parent, name);
+        errdefer if (removed_path) |path| self.allocator.free(path);
+        if (removed_path != null) {
+            self.removed_paths.ensureUnusedCapacity(self.allocator, 1) catch return error.OutOfMemory;
+        }
+
+        var journal_name: ?[]u8 = null;
+        if (self.snapshot_depth > 0) {
+            self.journal.ensureUnusedCapacity(self.allocator, 1) catch return error.OutOfMemory;
+            journal_name = self.allocator.dupe(u8, name) catch return error.OutOfMemory;
+        } else {
+            self.orphans.ensureUnusedCapacity(self.allocator, 1) catch return error.OutOfMemory;
+        }
+        errdefer if (journal_name) |owned| self.allocator.free(owned);
+
+        const had_whiteout = parent.whiteouts.contains(name);
+        return .{
+            .removed_path = removed_path,
+            .journal_name = journal_name,
+            .had_whiteout = had_whiteout,
+            .reserved_whiteout = try parent.reserveWhiteout(name),
+        };
+    }
+
+    fn cancelRemoval(self: *VirtualFileSystem, parent: *MemoryDirectory, name: []const u8, removal: *Removal) void {
+        if (removal.removed_path) |path| self.allocator.free(path);
+        if (removal.journal_name) |owned| self.allocator.free(owned);
+        if (removal.reserved_whiteout) parent.clearWhiteout(name);
+    }
+
+    fn finishRemoval(self: *VirtualFileSystem, parent: *MemoryDirectory, name: []const u8, removal: *Removal) void {
+        if (removal.removed_path) |path| self.removed_paths.appendAssumeCapacity(path);
+        // Cannot fail: the child exists and its whiteout is in place
+        const node = parent.remove(name) catch unreachable;
+
+        if (removal.journal_name) |owned| {
+            // Keep the node in the journal so rollback can put it back
+            self.journal.appendAssumeCapacity(.{ .removed = .{
+                .dir = parent,
+                .name = owned,
+                .node = node,
+                .whiteout_added = !removal.had_whiteout and parent.whiteouts.contains(owned),
+            } });
+        } else {
+            self.releaseNode(node);
+        }
+    }
+
+    /// Free a node no longer in the tree, or keep it as an orphan while an
+    /// fd still refers to it
+    fn releaseNode(self: *VirtualFileSystem, node: Node) void {
+        if (self.fd_table.references(node)) {
+            // Leak rather than free a node an fd still uses
+            self.orphans.append(self.allocator, node) catch {};
+        } else {
+            self.freeNode(node);
+        }
+    }
+
+    fn freeNode(self: *VirtualFileSystem, node: Node) void {
+        self.refundNode(node);
+        self.destroyNode(node);
+    }
+
+    /// Give back what a node and its descendants were charged
+    fn refundNode(self: *VirtualFileSystem, node: Node) void {
+        switch (node) {
+            .file => |file| {
+                self.refundBytes(file.ownedBytes());
+                if (file.inode >= self.first_own_inode) self.used.inodes -= 1;
+            },
+            .directory => |dir| {
+                var iter = dir.children.valueIterator();
+                while (iter.next()) |child| self.refundNode(child.*);
+                if (dir.inode >= self.first_own_inode) self.used.inodes -= 1;
+            },
+        }
+    }
+
+    fn destroyNode(self: *VirtualFileSystem, node: Node) void {
+        switch (node) {
+            .file => |file| {
+                file.deinit();
+                self.allocator.destroy(file);
+            },
+            .directory => |dir| dir.deinit(),
+        }
+    }
+
+    // ========================================================================
+    // Snapshots
+    // ========================================================================
+
+    /// Mark a point to roll back to. Costs O(1); while a snapshot is
+    /// active, each change records just enough to undo it (the first write
+    /// to a file since the snapshot saves its content, which is free for
+    /// content borrowed from an overlay base). Snapshots nest and must be
+    /// released in reverse order of creation.
+    pub fn snapshot(self: *VirtualFileSystem) Snapshot {
+        self.snapshot_depth += 1;
+        self.generation += 1;
+        return .{ .position = self.journal.items.len };
+    }
+
+    /// Undo every change made since snap, in O(changes). snap stays active
+    /// and can be rolled back to again. Open fds keep working; files they
+    /// refer to that the rollback removed live on until closed.
+    pub fn rollback(self: *VirtualFileSystem, snap: Snapshot) VfsError!void {
+        self.debugLog("rollback({} changes)", .{self.journal.items.len - snap.position});
+
+        while (self.journal.items.len > snap.position) {
+            const entry = self.journal.items[self.journal.items.len - 1];
+            switch (entry) {
+                .added => |added| {
+                    try self.noteRemoved(added.dir, added.name);
+                    if (added.dir.detach(added.name)) |node| self.releaseNode(node);
+                    self.allocator.free(added.name);
+                },
+                .removed => |removed| {
+                    try removed.dir.attach(removed.name, removed.node);
+                    if (removed.whiteout_added) removed.dir.clearWhiteout(removed.name);
+                    // The host copy may have been written since the snapshot
+                    if (self.persistent.items.len > 0) markDirty(removed.node);
+                },
+                .content => |content| {
+                    // The saved bytes were charged when saved
+                    self.refundBytes(content.file.ownedBytes());
+                    content.file.restore(content.saved);
+                },
+                .renamed => |renamed| {
+                    const node = renamed.to.children.get(renamed.to_name).?;
+                    // Allocate before moving anything back, so a failure
+                    // leaves this entry untouched and rollback can be retried
+                    const dir_name: ?[]u8 = if (node == .directory)
+                        self.allocator.dupe(u8, renamed.from_name) catch return error.OutOfMemory
+                    else
+                        null;
+                    errdefer if (dir_name) |name| self.allocator.free(name);
+                    const removed_path = try self.removedPath(renamed.to, renamed.to_name);
+                    errdefer if (removed_path) |path| self.allocator.free(path);
+                    if (removed_path != null) {
+                        self.removed_paths.ensureUnusedCapacity(self.allocator, 1) catch return error.OutOfMemory;
+                    }
+                    renamed.from.children.ensureUnusedCapacity(1) catch return error.OutOfMemory;
+
+                    if (removed_path) |path| self.removed_paths.appendAssumeCapacity(path);
+                    if (dir_name) |name| {
+                        self.allocator.free(node.directory.name);
+                        node.directory.name = name;
+                    }
+                    _ = renamed.to.detach(renamed.to_name);
+                    if (renamed.whiteout_added) renamed.from.clearWhiteout(renamed.from_name);
+                    renamed.from.attach(renamed.from_name, node) catch unreachable;
+                    self.allocator.free(renamed.to_name);
+                    if (self.persistent.items.len > 0) markDirty(node);
+                },
+            }
+            self.journal.items.len -= 1;
+        }
+        self.generation += 1;
+    }
+
+    /// Keep the changes made since snap. Releasing the outermost snapshot
+    /// frees the journal.
+    pub fn release(self: *VirtualFileSystem, snap: Snapshot) void {
+        std.debug.assert(self.snapshot_depth > 0 and snap.position <= self.journal.items.len);
+        self.snapshot_depth -= 1;
+        if (self.snapshot_depth > 0) return;
+
+        for (self.journal.items) |entry| self.dropEntry(entry);
+        self.journal.clearRetainingCapacity();
+    }
+
+    /// Charge and journal a node just added to dir. On failure the node is
+    /// taken out again, so callers can simply return the error.
+    fn nodeAdded(self: *VirtualFileSystem, dir: *MemoryDirectory, name: []const u8, node: Node) VfsError!void {
+        errdefer self.destroyNode(dir.detach(name).?);
+        try self.chargeInode();
+        errdefer self.used.inodes -= 1;
+        // Not on the host yet, should this be under a persistent mount
+        if (node == .file) node.file.dirty = true;
+        if (self.snapshot_depth == 0) return;
+
+        // A new file needs no saved content; rollback removes it anyway
+        if (node == .file) node.file.snapshot_gen = self.generation;
+
+        self.journal.ensureUnusedCapacity(self.allocator, 1) catch return error.OutOfMemory;
+        const owned_name = self.allocator.dupe(u8, name) catch return error.OutOfMemory;
+        self.journal.appendAssumeCapacity(.{ .added = .{ .dir = dir, .name = owned_name } });
+    }
+
+    /// Save a file's content before its first change since the last
+    /// snapshot or rollback
+    fn recordContent(self: *VirtualFileSystem, file: *MemoryFile) VfsError!void {
+        if (self.snapshot_depth == 0 or file.snapshot_gen == self.generation) return;
+
+        self.journal.ensureUnusedCapacity(self.allocator, 1) catch return error.OutOfMemory;
+        var saved = try file.save();
+        self.chargeBytes(saved.data.items.len) catch |err| {
+            saved.data.deinit(self.allocator);
+            return err;
+        };
+        self.journal.appendAssumeCapacity(.{ .content = .{ .file = file, .saved = saved } });
+        file.snapshot_gen = self.generation;
+    }
+
+    /// Free what a journal entry owns once it can no longer be undone
+    fn dropEntry(self: *VirtualFileSystem, entry: JournalEntry) void {
+        switch (entry) {
+            .added => |added| self.allocator.free(added.name),
+            .removed => |removed| {
+                self.allocator.free(removed.name);
+                self.releaseNode(removed.node);
+            },
+            .content => |content| {
+                var data = content.saved.data;
+                self.refundBytes(data.items.len);
+                data.deinit(self.allocator);
+            },
+            .renamed => |renamed| {
+                self.allocator.free(renamed.from_name);
+                self.allocator.free(renamed.to_name);
+            },
+        }
+    }
+
     /// Open a file or directory
     pub fn open(self: *VirtualFileSystem, dir_fd: i32, path: []const u8, flags: OpenFlags) VfsError!i32 {
         self.debugLog("open(fd={}, path=\"{s}\", flags={{read={},write={},create={}}})", .{ dir_fd, path, flags.read, flags.write, flags.create });
+        if (flags.write or flags.create or flags.truncate) {
+            try self.checkWritable();
+        }
 
         // Check if this path matches a mount point
         for (self.mounts.items) |mount| {
@@ -368,7 +1011,7 @@ pub const VirtualFileSystem = struct {
         }
 
         // Look up the file/directory
-        if (resolved.dir.lookup(resolved.name)) |node| {
+        if (try resolved.dir.lookup(resolved.name)) |node| {
             switch (node) {
                 .file => |file| {
                     if (flags.directory) {
@@ -378,7 +1021,10 @@ pub const VirtualFileSystem = struct {
                         return error.FileExists;
                     }
                     if (flags.truncate) {
+                        try self.recordContent(file);
+                        const before = file.ownedBytes();
                         try file.truncate(0);
+                        self.refundBytes(before);
                     }
                     return try self.fd_table.openMemoryFile(file, flags, path);
                 },
@@ -392,6 +1038,7 @@ pub const VirtualFileSystem = struct {
         } else if (flags.create) {
             // Create new file
             const file = try resolved.dir.createFile(resolved.name, self.nextInode());
+            try self.nodeAdded(resolved.dir, resolved.name, .{ .file = file });
             return try self.fd_table.openMemoryFile(file, flags, path);
         } else {
             return error.FileNotFound;
@@ -411,7 +1058,46 @@ pub const VirtualFileSystem = struct {
     /// Close a file descriptor
     pub fn close(self: *VirtualFileSystem, fd: i32) VfsError!void {
         self.debugLog("close(fd={})", .{fd});
-        return self.fd_table.close(fd);
+        const changed = if (self.fd_table.get(fd)) |desc|
+            desc.kind == .memory_file and desc.resource.memory_file.dirty
+        else
+            false;
+        try self.fd_table.close(fd);
+        self.freeOrphans();
+        self.flushDue(changed);
+    }
+
+    /// Remember the open fds for restoreFds(). Until the next checkpoint,
+    /// the nodes they refer to stay alive even once closed and unlinked.
+    pub fn checkpointFds(self: *VirtualFileSystem) VfsError!void {
+        try self.fd_table.checkpoint();
+        self.freeOrphans();
+    }
+
+    /// Put the fds back as checkpointFds() found them: close the ones
+    /// opened since, and reopen the others at their old position
+    pub fn restoreFds(self: *VirtualFileSystem) VfsError!void {
+        var changed = false;
+        var iter = self.fd_table.fds.valueIterator();
+        while (iter.next()) |desc| {
+            if (desc.kind == .memory_file and desc.resource.memory_file.dirty) changed = true;
+        }
+        try self.fd_table.restore();
+        self.freeOrphans();
+        self.flushDue(changed);
+    }
+
+    /// Free the orphans no fd refers to any more
+    fn freeOrphans(self: *VirtualFileSystem) void {
+        var i: usize = 0;
+        while (i < self.orphans.items.len) {
+            const node = self.orphans.items[i];
+            if (self.fd_table.references(node)) {
+                i += 1;
+            } else {
+                self.freeNode(self.orphans.swapRemove(i));
+            }
+        }
     }
 
     /// Read from a file descriptor
@@ -447,9 +1133,21 @@ pub const VirtualFileSystem = struct {
 
         switch (desc.kind) {
             .memory_file => {
+                try self.checkWritable();
                 const file = desc.resource.memory_file;
-                const bytes_written = try file.pwrite(data, desc.position);
+                try self.recordContent(file);
+
+                // Charge the growth up front so a write over quota
+                // allocates nothing
+                const before = file.ownedBytes();
+                const after = @max(file.size(), desc.position + data.len);
+                try self.chargeBytes(after - before);
+                const bytes_written = file.pwrite(data, desc.position) catch |err| {
+                    self.refundBytes(after - before);
+                    return err;
+                };
                 desc.position += bytes_written;
+                self.flushDue(false);
                 return bytes_written;
             },
             .stdio => {
@@ -537,7 +1235,7 @@ pub const VirtualFileSystem = struct {
             return resolved.dir.stat();
         }
 
-        const node = resolved.dir.lookup(resolved.name) orelse return error.FileNotFound;
+        const node = (try resolved.dir.lookup(resolved.name)) orelse return error.FileNotFound;
         return node.stat();
     }
 
@@ -560,36 +1258,291 @@ pub const VirtualFileSystem = struct {
     }
 
     // ========================================================================
-    // Preopen Management
+    // Persistent Mounts
     // ========================================================================
 
-    /// Add a preopen directory backed by in-memory VFS
-    pub fn addPreopen(self: *VirtualFileSystem, guest_path: []const u8) VfsError!i32 {
-        self.debugLog("addPreopen(guest_path=\"{s}\")", .{guest_path});
+    /// Keep the subtree at guest_path in step with the host directory
+    /// host_path, which is created if missing. What the host directory
+    /// already holds is loaded now, host files replacing VFS files of the
+    /// same name: directories eagerly, content lazily, as read-only
+    /// mappings paged in on first read and copied on first write. Files
+    /// the guest changes are written back as options.flush says, and
+    /// always when the VFS is freed; files it removes are deleted from the
+    /// host. Directories reach the host with the files in them. Nothing
+    /// else may change the host directory while it is mounted.
+    pub fn mountPersistent(self: *VirtualFileSystem, guest_path: []const u8, host_path: []const u8, options: PersistOptions) VfsError!void {
+        self.debugLog("mountPersistent(guest_path=\"{s}\", host_path=\"{s}\")", .{ guest_path, host_path });
+        try self.checkWritable();
+
+        const dir = try self.ensureDirectory(guest_path);
+        fs.cwd().makePath(host_path) catch return error.IO;
+        var host_dir = fs.cwd().openDir(host_path, .{ .iterate = true }) catch return error.IO;
+        defer host_dir.close();
+        try self.loadHostTree(dir, host_dir);
+
+        self.persistent.ensureUnusedCapacity(self.allocator, 1) catch return error.OutOfMemory;
+        const guest_copy = try self.pathOf(dir, "");
+        errdefer self.allocator.free(guest_copy);
+        const host_copy = self.allocator.dupe(u8, host_path) catch return error.OutOfMemory;
+        errdefer self.allocator.free(host_copy);
+        if (self.writer == null) {
+            self.writer = persist.Writer.init(self.allocator) catch return error.IO;
+        }
 
-        // Create the directory in the VFS if it doesn't exist
-        try self.mkdirp(guest_path);
+        self.persistent.appendAssumeCapacity(.{
+            .guest_path = guest_copy,
+            .host_path = host_copy,
+            .options = options,
+            .last_flush_ns = std.time.nanoTimestamp(),
+        });
+    }
 
-        // Get or create the directory
-        const resolved = self.resolvePath(3, guest_path) catch |err| return @as(VfsError, @errorCast(err));
-        var dir: *MemoryDirectory = undefined;
+    /// Hand every persistent mount's changed files and removals to the
+    /// writer now. The host writes finish in the background; see
+    /// syncPersistent.
+    pub fn flushPersistent(self: *VirtualFileSystem) VfsError!void {
+        for (self.persistent.items) |*mount| try self.flushMount(mount);
+    }
 
-        if (resolved.name.len == 0) {
-            dir = resolved.dir;
-        } else if (resolved.dir.lookup(resolved.name)) |node| {
-            switch (node) {
-                .directory => |d| {
-                    dir = d;
+    /// Write back every persistent mount and wait for the host writes
+    pub fn syncPersistent(self: *VirtualFileSystem) VfsError!void {
+        try self.flushPersistent();
+        if (self.writer) |writer| writer.wait();
+    }
+
+    /// Write back the mounts whose policy calls for it now: after an fd to
+    /// a changed file was closed, or once their interval has passed
+    fn flushDue(self: *VirtualFileSystem, closed_changed: bool) void {
+        if (self.persistent.items.len == 0) return;
+
+        const now = std.time.nanoTimestamp();
+        for (self.persistent.items) |*mount| {
+            const due = switch (mount.options.flush) {
+                .on_close => closed_changed,
+                .periodic => now - mount.last_flush_ns >= @as(i128, mount.options.interval_ms) * std.time.ns_per_ms,
+                .at_exit => false,
+            };
+            if (!due) continue;
+            self.flushMount(mount) catch |err| {
+                std.debug.print("Warning: write-back of {s} failed: {}\n", .{ mount.guest_path, err });
+            };
+        }
+    }
+
+    fn flushMount(self: *VirtualFileSystem, mount: *PersistentMount) VfsError!void {
+        const writer = self.writer.?;
+
+        // Removals first, so that a path removed and created again is
+        // written rather than deleted
+        var i: usize = 0;
+        while (i < self.removed_paths.items.len) {
+            const path = self.removed_paths.items[i];
+            const sub_path = subPath(mount.guest_path, path) orelse {
+                i += 1;
+                continue;
+            };
+            if (try self.lookupPath(path) == null) {
+                const host = fs.path.join(self.allocator, &.{ mount.host_path, sub_path }) catch return error.OutOfMemory;
+                writer.delete(host) catch {
+                    self.allocator.free(host);
+                    return error.OutOfMemory;
+                };
+            }
+            self.allocator.free(self.removed_paths.orderedRemove(i));
+        }
+
+        // A removed mount root was deleted from the host above
+        if (try self.lookupPath(mount.guest_path)) |node| {
+            if (node == .directory) try self.writeBack(node.directory, mount.host_path);
+        }
+        mount.last_flush_ns = std.time.nanoTimestamp();
+    }
+
+    /// Queue a copy of every changed file under dir
+    fn writeBack(self: *VirtualFileSystem, dir: *MemoryDirectory, host_path: []const u8) VfsError!void {
+        // Entries still only in an overlay's lower layer are unchanged
+        var iter = dir.children.iterator();
+        while (iter.next()) |entry| {
+            switch (entry.value_ptr.*) {
+                .directory => |child| {
+                    const host = fs.path.join(self.allocator, &.{ host_path, entry.key_ptr.* }) catch return error.OutOfMemory;
+                    defer self.allocator.free(host);
+                    try self.writeBack(child, host);
+                },
+                .file => |file| {
+                    if (!file.dirty) continue;
+                    const host = fs.path.join(self.allocator, &.{ host_path, entry.key_ptr.* }) catch return error.OutOfMemory;
+                    const content = self.allocator.dupe(u8, file.getContent()) catch {
+                        self.allocator.free(host);
+                        return error.OutOfMemory;
+                    };
+                    self.writer.?.write(host, content) catch {
+                        self.allocator.free(host);
+                        self.allocator.free(content);
+                        return error.OutOfMemory;
+                    };
+                    file.dirty = false;
                 },
-                .file => return error.FileExists,
             }
-        } else {
-            dir = try resolved.dir.createDirectory(resolved.name, self.nextInode());
         }
+    }
+
+    /// Load what a host directory holds into dir
+    fn loadHostTree(self: *VirtualFileSystem, dir: *MemoryDirectory, host_dir: fs.Dir) VfsError!void {
+        var iter = host_dir.iterate();
+        while (iter.next() catch return error.IO) |entry| {
+            // Left behind by a write-back that was interrupted
+            if (std.mem.endsWith(u8, entry.name, persist.temp_suffix)) continue;
+
+            switch (entry.kind) {
+                .directory => {
+                    const child = if (try dir.lookup(entry.name)) |node| switch (node) {
+                        .directory => |d| d,
+                        .file => continue,
+                    } else blk: {
+                        const d = try dir.createDirectory(entry.name, self.nextInode());
+                        try self.nodeAdded(dir, entry.name, .{ .directory = d });
+                        break :blk d;
+                    };
+                    var sub_dir = host_dir.openDir(entry.name, .{ .iterate = true }) catch return error.IO;
+                    defer sub_dir.close();
+                    try self.loadHostTree(child, sub_dir);
+                },
+                .file => try self.loadHostFile(dir, host_dir, entry.name),
+                else => {},
+            }
+        }
+    }
 
+    fn loadHostFile(self: *VirtualFileSystem, dir: *MemoryDirectory, host_dir: fs.Dir, name: []const u8) VfsError!void {
+        if (try dir.lookup(name)) |node| switch (node) {
+            // The host copy is what the guest wrote last time
+            .file => try self.removeNode(dir, name),
+            .directory => return,
+        };
+
+        const host_file = host_dir.openFile(name, .{}) catch return error.IO;
+        defer host_file.close();
+        const host_stat = host_file.stat() catch return error.IO;
+
+        const file = try dir.createFile(name, self.nextInode());
+        try self.nodeAdded(dir, name, .{ .file = file });
+        file.dirty = false;
+        file.mtime = @intCast(@max(0, host_stat.mtime));
+        if (host_stat.size == 0) return;
+
+        // Mapped pages belong to the host's page cache, so the content is
+        // not charged against the byte quota until the guest writes it
+        const mapping = posix.mmap(null, @intCast(host_stat.size), posix.PROT.READ, .{ .TYPE = .PRIVATE }, host_file.handle, 0) catch return error.IO;
+        file.mapping = mapping;
+        file.shared = mapping;
+    }
+
+    /// Remember a removal under a persistent mount for the next write-back
+    fn noteRemoved(self: *VirtualFileSystem, dir: *MemoryDirectory, name: []const u8) VfsError!void {
+        const path = try self.removedPath(dir, name) orelse return;
+        self.removed_paths.append(self.allocator, path) catch {
+            self.allocator.free(path);
+            return error.OutOfMemory;
+        };
+    }
+
+    /// Path noteRemoved would record for name in dir, or null if it is not
+    /// under a persistent mount. The caller owns the path.
+    fn removedPath(self: *VirtualFileSystem, dir: *MemoryDirectory, name: []const u8) VfsError!?[]u8 {
+        if (self.persistent.items.len == 0) return null;
+
+        const path = try self.pathOf(dir, name);
+        for (self.persistent.items) |mount| {
+            if (subPath(mount.guest_path, path) != null) return path;
+        }
+        self.allocator.free(path);
+        return null;
+    }
+
+    /// Absolute path of name in dir, or of dir itself when name is empty
+    fn pathOf(self: *VirtualFileSystem, dir: *MemoryDirectory, name: []const u8) VfsError![]u8 {
+        var parts: std.ArrayListUnmanaged([]const u8) = .empty;
+        defer parts.deinit(self.allocator);
+        if (name.len > 0) parts.append(self.allocator, name) catch return error.OutOfMemory;
+        var current = dir;
+        while (current.parent) |parent| : (current = parent) {
+            parts.append(self.allocator, current.name) catch return error.OutOfMemory;
+        }
+        if (parts.items.len == 0) return self.allocator.dupe(u8, "/") catch error.OutOfMemory;
+
+        var path: std.ArrayListUnmanaged(u8) = .empty;
+        errdefer path.deinit(self.allocator);
+        var i = parts.items.len;
+        while (i > 0) {
+            i -= 1;
+            path.append(self.allocator, '/') catch return error.OutOfMemory;
+            path.appendSlice(self.allocator, parts.items[i]) catch return error.OutOfMemory;
+        }
+        return path.toOwnedSlice(self.allocator) catch error.OutOfMemory;
+    }
+
+    /// The node at an absolute path, or null if there is none
+    fn lookupPath(self: *VirtualFileSystem, path: []const u8) VfsError!?Node {
+        const resolved = self.resolvePath(3, path) catch |err| switch (err) {
+            error.FileNotFound, error.NotADirectory => return null,
+            else => |e| return @as(VfsError, @errorCast(e)),
+        };
+        if (resolved.name.len == 0) return .{ .directory = resolved.dir };
+        return resolved.dir.lookup(resolved.name);
+    }
+
+    /// Path of path below mount_path ("" for mount_path itself), or null
+    /// if it is not below it
+    fn subPath(mount_path: []const u8, path: []const u8) ?[]const u8 {
+        if (std.mem.eql(u8, mount_path, "/")) return path[1..];
+        if (!std.mem.startsWith(u8, path, mount_path)) return null;
+        const rest = path[mount_path.len..];
+        if (rest.len == 0) return rest;
+        if (rest[0] != '/') return null;
+        return rest[1..];
+    }
+
+    fn markDirty(node: Node) void {
+        switch (node) {
+            .file => |file| file.dirty = true,
+            .directory => |dir| {
+                var iter = dir.children.valueIterator();
+                while (iter.next()) |child| markDirty(child.*);
+            },
+        }
+    }
+
+    // ========================================================================
+    // Preopen Management
+    // ========================================================================
+
+    /// Add a preopen directory backed by in-memory VFS
+    pub fn addPreopen(self: *VirtualFileSystem, guest_path: []const u8) VfsError!i32 {
+        self.debugLog("addPreopen(guest_path=\"{s}\")", .{guest_path});
+        const dir = try self.ensureDirectory(guest_path);
         return try self.fd_table.addVfsPreopen(guest_path, dir);
     }
 
+    /// Get the directory at path, creating it and its parents if needed
+    fn ensureDirectory(self: *VirtualFileSystem, path: []const u8) VfsError!*MemoryDirectory {
+        try self.mkdirp(path);
+
+        const resolved = self.resolvePath(3, path) catch |err| return @as(VfsError, @errorCast(err));
+        if (resolved.name.len == 0) {
+            return resolved.dir;
+        }
+        if (try resolved.dir.lookup(resolved.name)) |node| {
+            return switch (node) {
+                .directory => |d| d,
+                .file => error.FileExists,
+            };
+        }
+        const dir = try resolved.dir.createDirectory(resolved.name, self.nextInode());
+        try self.nodeAdded(resolved.dir, resolved.name, .{ .directory = dir });
+        return dir;
+    }
+
     /// Add a preopen that passes through to real filesystem
     pub fn addRealPreopen(self: *VirtualFileSystem, guest_path: []const u8, host_path: []const u8) VfsError!i32 {
         self.debugLog("addRealPreopen(guest_path=\"{s}\", host_path=\"{s}\")", .{ guest_path, host_path });
@@ -674,3 +1627,273 @@ test "vfs directory operations" {
     try std.testing.expect(file_stat.filetype == .regular_file);
     try std.testing.expectEqual(@as(u64, 6), file_stat.size);
 }
+
+
+test "vfs overlay" {
+    const allocator = std.testing.allocator;
+
+    var base = try VirtualFileSystem.init(allocator);
+    defer base.deinit();
+    _ = try base.addPreopen("/");
+    try base.createFile("/lib/mod.py", "x = 1");
+    try base.createFile("/lib/old.py", "");
+    base.freeze();
+    try std.testing.expectError(error.ReadOnly, base.createFile("/lib/new.py", ""));
+
+    var vfs_inst = try VirtualFileSystem.initOverlay(allocator, base);
+    defer vfs_inst.deinit();
+    const preopen_fd = try vfs_inst.addPreopen("/");
+
+    // Writes go to a private copy; the base is unchanged
+    const fd = try vfs_inst.open(preopen_fd, "lib/mod.py", .{ .read = true, .write = true });
+    _ = try vfs_inst.write(fd, "y");
+    try vfs_inst.close(fd);
+
+    var buf: [8]u8 = undefined;
+    const fd2 = try vfs_inst.open(preopen_fd, "lib/mod.py", .{ .read = true });
+    const n = try vfs_inst.read(fd2, &buf);
+    try std.testing.expectEqualSlices(u8, "y = 1", buf[0..n]);
+    try vfs_inst.close(fd2);
+
+    const base_file = (try base.root.lookup("lib")).?.directory.children.get("mod.py").?.file;
+    try std.testing.expectEqualSlices(u8, "x = 1", base_file.getContent());
+
+    // Deleting a base file hides it in the overlay only
+    try vfs_inst.unlink(preopen_fd, "lib/old.py");
+    try std.testing.expectError(error.FileNotFound, vfs_inst.stat(preopen_fd, "lib/old.py"));
+    _ = try base.stat(3, "lib/old.py");
+}
+
+test "vfs unlink while open" {
+    const allocator = std.testing.allocator;
+
+    var vfs_inst = try VirtualFileSystem.init(allocator);
+    defer vfs_inst.deinit();
+    const preopen_fd = try vfs_inst.addPreopen("/");
+    try vfs_inst.createFile("/tmp/scratch", "data");
+
+    // The open fd keeps the content readable after the name is gone
+    const fd = try vfs_inst.open(preopen_fd, "tmp/scratch", .{ .read = true });
+    try vfs_inst.unlink(preopen_fd, "tmp/scratch");
+    var buf: [8]u8 = undefined;
+    try std.testing.expectEqual(@as(usize, 4), try vfs_inst.read(fd, &buf));
+    try vfs_inst.close(fd);
+    try std.testing.expectEqual(@as(usize, 0), vfs_inst.orphans.items.len);
+
+    try vfs_inst.createFile("/tmp/other", "");
+    try std.testing.expectError(error.NotEmpty, vfs_inst.rmdir(preopen_fd, "tmp"));
+    try vfs_inst.unlink(preopen_fd, "tmp/other");
+    try vfs_inst.rmdir(preopen_fd, "tmp");
+}
+
+test "vfs snapshot and rollback" {
+    const allocator = std.testing.allocator;
+
+    var vfs_inst = try VirtualFileSystem.init(allocator);
+    defer vfs_inst.deinit();
+    const preopen_fd = try vfs_inst.addPreopen("/");
+    try vfs_inst.createFile("/app/keep.txt", "original");
+    try vfs_inst.createFile("/app/gone.txt", "deleted by the job");
+
+    const snap = vfs_inst.snapshot();
+    defer vfs_inst.release(snap);
+
+    // A job modifies, creates and deletes files
+    try vfs_inst.createFile("/app/keep.txt", "modified");
+    try vfs_inst.createFile("/tmp/new/file.txt", "created");
+    try vfs_inst.unlink(preopen_fd, "app/gone.txt");
+
+    try vfs_inst.rollback(snap);
+
+    var buf: [32]u8 = undefined;
+    const fd = try vfs_inst.open(preopen_fd, "app/keep.txt", .{ .read = true });
+    const n = try vfs_inst.read(fd, &buf);
+    try std.testing.expectEqualSlices(u8, "original", buf[0..n]);
+    try vfs_inst.close(fd);
+
+    try std.testing.expectError(error.FileNotFound, vfs_inst.stat(preopen_fd, "tmp"));
+    const gone = try vfs_inst.stat(preopen_fd, "app/gone.txt");
+    try std.testing.expectEqual(@as(u64, 18), gone.size);
+
+    // The snapshot stays usable
+    try vfs_inst.createFile("/app/keep.txt", "again");
+    try vfs_inst.rollback(snap);
+    try std.testing.expectEqual(@as(u64, 8), (try vfs_inst.stat(preopen_fd, "app/keep.txt")).size);
+}
+
+test "vfs quotas" {
+    const allocator = std.testing.allocator;
+
+    var vfs_inst = try VirtualFileSystem.init(allocator);
+    defer vfs_inst.deinit();
+    const preopen_fd = try vfs_inst.addPreopen("/");
+    vfs_inst.setLimits(.{ .max_bytes = 10, .max_inodes = 3 });
+
+    try vfs_inst.createFile("/a.txt", "12345678");
+    try std.testing.expectError(error.NoSpace, vfs_inst.createFile("/b.txt", "abc"));
+
+    const fd = try vfs_inst.open(preopen_fd, "a.txt", .{ .write = true });
+    try std.testing.expectError(error.NoSpace, vfs_inst.write(fd, "12345678901"));
+    try vfs_inst.close(fd);
+
+    try vfs_inst.unlink(preopen_fd, "a.txt");
+    const used = vfs_inst.usage();
+    try std.testing.expectEqual(@as(u64, 0), used.bytes);
+    try std.testing.expectEqual(@as(u64, 8), used.peak_bytes);
+
+    try vfs_inst.mkdir(preopen_fd, "d1");
+    try vfs_inst.mkdir(preopen_fd, "d2");
+    try std.testing.expectError(error.NoSpace, vfs_inst.mkdir(preopen_fd, "d3"));
+}
+
+test "vfs persistent mount" {
+    const allocator = std.testing.allocator;
+
+    var tmp = std.testing.tmpDir(.{});
+    defer tmp.cleanup();
+    const host_path = try tmp.dir.realpathAlloc(allocator, ".");
+    defer allocator.free(host_path);
+    try tmp.dir.makePath("old");
+    try tmp.dir.writeFile(.{ .sub_path = "old/stale.txt", .data = "stale" });
+
+    {
+        var vfs_inst = try VirtualFileSystem.init(allocator);
+        defer vfs_inst.deinit();
+        const preopen_fd = try vfs_inst.addPreopen("/");
+        try vfs_inst.mountPersistent("/cache", host_path, .{ .flush = .at_exit });
+
+        try std.testing.expectEqual(@as(u64, 5), (try vfs_inst.stat(preopen_fd, "cache/old/stale.txt")).size);
+        try vfs_inst.createFile("/cache/new/result.txt", "computed");
+        try vfs_inst.unlink(preopen_fd, "cache/old/stale.txt");
+    }
+
+    var buf: [16]u8 = undefined;
+    try std.testing.expectEqualSlices(u8, "computed", try tmp.dir.readFile("new/result.txt", &buf));
+    try std.testing.expectError(error.FileNotFound, tmp.dir.access("old/stale.txt", .{}));
+
+    // The next run sees what the last one wrote
+    var vfs_inst = try VirtualFileSystem.init(allocator);
+    defer vfs_inst.deinit();
+    const preopen_fd = try vfs_inst.addPreopen("/");
+    try vfs_inst.mountPersistent("/cache", host_path, .{});
+
+    const fd = try vfs_inst.open(preopen_fd, "cache/new/result.txt", .{ .read = true, .write = true });
+    var read_buf: [16]u8 = undefined;
+    const n = try vfs_inst.read(fd, &read_buf);
+    try std.testing.expectEqualSlices(u8, "computed", read_buf[0..n]);
+    _ = try vfs_inst.seek(fd, 0, .set);
+    _ = try vfs_inst.write(fd, "C");
+    try vfs_inst.close(fd);
+    try vfs_inst.syncPersistent();
+    try std.testing.expectEqualSlices(u8, "Computed", try tmp.dir.readFile("new/result.txt", &buf));
+}
+
+test "vfs mapped file" {
+    const allocator = std.testing.allocator;
+
+    var tmp = std.testing.tmpDir(.{});
+    defer tmp.cleanup();
+    try tmp.dir.writeFile(.{ .sub_path = "lib.zpack", .data = "packed" });
+    const host_path = try tmp.dir.realpathAlloc(allocator, "lib.zpack");
+    defer allocator.free(host_path);
+
+    var vfs_inst = try VirtualFileSystem.init(allocator);
+    defer vfs_inst.deinit();
+    const preopen_fd = try vfs_inst.addPreopen("/");
+    try vfs_inst.mapFile("/site-packages/lib.zpack", host_path);
+    try std.testing.expectError(error.FileNotFound, vfs_inst.mapFile("/site-packages/missing.zpack", "/nonexistent/missing.zpack"));
+
+    const file = (try vfs_inst.lookupPath("site-packages/lib.zpack")).?.file;
+    try std.testing.expect(file.mapping != null);
+    try std.testing.expectEqualSlices(u8, "packed", file.getContent());
+    try std.testing.expectEqual(@as(u64, 0), vfs_inst.usage().bytes);
+
+    // Written, the content is copied out of the mapping
+    const fd = try vfs_inst.open(preopen_fd, "site-packages/lib.zpack", .{ .read = true, .write = true });
+    _ = try vfs_inst.write(fd, "P");
+    try vfs_inst.close(fd);
+    try std.testing.expectEqualSlices(u8, "Packed", file.getContent());
+    var buf: [16]u8 = undefined;
+    try std.testing.expectEqualSlices(u8, "packed", try tmp.dir.readFile("lib.zpack", &buf));
+}
+
+test "vfs rename" {
+    const allocator = std.testing.allocator;
+
+    var vfs_inst = try VirtualFileSystem.init(allocator);
+    defer vfs_inst.deinit();
+    const preopen_fd = try vfs_inst.addPreopen("/");
+    try vfs_inst.createFile("/cache/mod.pyc.tmp", "bytecode");
+    try vfs_inst.createFile("/cache/mod.pyc", "stale");
+
+    // Replacing an existing file, as CPython's atomic .pyc writes do
+    try vfs_inst.rename(preopen_fd, "cache/mod.pyc.tmp", preopen_fd, "cache/mod.pyc");
+    try std.testing.expectError(error.FileNotFound, vfs_inst.stat(preopen_fd, "cache/mod.pyc.tmp"));
+    try std.testing.expectEqual(@as(u64, 8), (try vfs_inst.stat(preopen_fd, "cache/mod.pyc")).size);
+
+    const snap = vfs_inst.snapshot();
+    defer vfs_inst.release(snap);
+    try vfs_inst.rename(preopen_fd, "cache", preopen_fd, "moved");
+    try std.testing.expectError(error.InvalidArgument, vfs_inst.rename(preopen_fd, "moved", preopen_fd, "moved/sub"));
+    _ = try vfs_inst.stat(preopen_fd, "moved/mod.pyc");
+
+    try vfs_inst.rollback(snap);
+    try std.testing.expectError(error.FileNotFound, vfs_inst.stat(preopen_fd, "moved"));
+    try std.testing.expectEqualSlices(u8, "cache", (try vfs_inst.root.lookup("cache")).?.directory.name);
+}
+
+test "vfs rename out of memory" {
+    // Fail each allocation rename makes in turn: every failure must leave
+    // both paths as they were
+    var fail_index: usize = 0;
+    while (true) : (fail_index += 1) {
+        var failing = std.testing.FailingAllocator.init(std.testing.allocator, .{});
+        var vfs_inst = try VirtualFileSystem.init(failing.allocator());
+        defer vfs_inst.deinit();
+        const preopen_fd = try vfs_inst.addPreopen("/");
+        try vfs_inst.createFile("/cache/mod.pyc.tmp", "bytecode");
+        try vfs_inst.createFile("/cache/mod.pyc", "stale");
+        const snap = vfs_inst.snapshot();
+        defer vfs_inst.release(snap);
+
+        failing.fail_index = failing.alloc_index + fail_index;
+        const result = vfs_inst.rename(preopen_fd, "cache/mod.pyc.tmp", preopen_fd, "cache/mod.pyc");
+        failing.fail_index = std.math.maxInt(usize);
+        if (result) |_| {
+            try std.testing.expectEqual(@as(u64, 8), (try vfs_inst.stat(preopen_fd, "cache/mod.pyc")).size);
+            break;
+        } else |err| {
+            try std.testing.expectEqual(error.OutOfMemory, err);
+            try std.testing.expectEqual(@as(u64, 8), (try vfs_inst.stat(preopen_fd, "cache/mod.pyc.tmp")).size);
+            try std.testing.expectEqual(@as(u64, 5), (try vfs_inst.stat(preopen_fd, "cache/mod.pyc")).size);
+        }
+    }
+}
+
+test "vfs rollback rename out of memory" {
+    // Fail each allocation undoing a directory rename makes in turn: the
+    // entry must stay whole, so a second rollback still restores the tree
+    var fail_index: usize = 0;
+    while (true) : (fail_index += 1) {
+        var failing = std.testing.FailingAllocator.init(std.testing.allocator, .{});
+        var vfs_inst = try VirtualFileSystem.init(failing.allocator());
+        defer vfs_inst.deinit();
+        const preopen_fd = try vfs_inst.addPreopen("/");
+        try vfs_inst.createFile("/build/out/mod.pyc", "bytecode");
+        const snap = vfs_inst.snapshot();
+        try vfs_inst.rename(preopen_fd, "build/out", preopen_fd, "build/done");
+
+        failing.fail_index = failing.alloc_index + fail_index;
+        const result = vfs_inst.rollback(snap);
+        failing.fail_index = std.math.maxInt(usize);
+        if (result) |_| {} else |err| {
+            try std.testing.expectEqual(error.OutOfMemory, err);
+            try std.testing.expectEqual(@as(u64, 8), (try vfs_inst.stat(preopen_fd, "build/done/mod.pyc")).size);
+            try vfs_inst.rollback(snap);
+        }
+        vfs_inst.release(snap);
+        try std.testing.expectEqual(@as(u64, 8), (try vfs_inst.stat(preopen_fd, "build/out/mod.pyc")).size);
+        try std.testing.expectError(error.FileNotFound, vfs_inst.stat(preopen_fd, "build/done"));
+        if (result) |_| break else |_| {}
+    }
+}
@@ -66,6 +66,15 @@ pub const MemoryDirectory = struct {
     /// Directory name (for debugging)
     name: []const u8,
 
+    /// Directory of a shared base layer this one overlays (see
+    /// VirtualFileSystem.initOverlay). Its entries show through until
+    /// looked up, which copies them here, or removed, which whites them
+    /// out. Never modified through this pointer; other threads read it.
+    lower: ?*const MemoryDirectory,
+
+    /// Names removed from this directory that still exist in lower
+    whiteouts: std.StringHashMapUnmanaged(void),
+
     pub fn init(allocator: Allocator, inode: u64, name: []const u8) !*MemoryDirectory {
         const dir = try allocator.create(MemoryDirectory);
         const now = getCurrentTimestamp();
@@ -79,6 +88,8 @@ pub const MemoryDirectory = struct {
             .mtime = now,
             .ctime = now,
             .name = try allocator.dupe(u8, name),
+            .lower = null,
+            .whiteouts = .empty,
         };
 
         return dir;
@@ -100,6 +111,9 @@ pub const MemoryDirectory = struct {
             }
         }
         self.children.deinit();
+        var whiteout_iter = self.whiteouts.keyIterator();
+        while (whiteout_iter.next()) |key| self.allocator.free(key.*);
+        self.whiteouts.deinit(self.allocator);
         self.allocator.free(self.name);
         self.allocator.destroy(self);
     }
@@ -137,7 +151,7 @@ pub const MemoryDirectory = struct {
 
     /// Create a new file in this directory
     pub fn createFile(self: *MemoryDirectory, name: []const u8, inode: u64) VfsError!*MemoryFile {
-        if (self.children.contains(name)) {
+        if (try self.lookup(name) != null) {
             return error.FileExists;
         }
 
@@ -155,7 +169,7 @@ pub const MemoryDirectory = struct {
 
     /// Create a new subdirectory in this directory
     pub fn createDirectory(self: *MemoryDirectory, name: []const u8, inode: u64) VfsError!*MemoryDirectory {
-        if (self.children.contains(name)) {
+        if (try self.lookup(name) != null) {
             return error.FileExists;
         }
 
@@ -169,15 +183,92 @@ pub const MemoryDirectory = struct {
         return dir;
     }
 
-    /// Look up a child by name
-    pub fn lookup(self: *MemoryDirectory, name: []const u8) ?Node {
+    /// Look up a child by name, copying it up from the lower layer if it
+    /// only exists there
+    pub fn lookup(self: *MemoryDirectory, name: []const u8) VfsError!?Node {
         self.atime = getCurrentTimestamp();
-        return self.children.get(name);
+        if (self.children.get(name)) |node| return node;
+        return self.copyUp(name);
     }
 
-    /// Remove a child by name
+    /// Bring a lower-layer entry into this directory. Files borrow the
+    /// lower file's content until written; directories overlay the lower
+    /// directory in turn. Both keep the lower inode and times.
+    fn copyUp(self: *MemoryDirectory, name: []const u8) VfsError!?Node {
+        const lower = self.lower orelse return null;
+        if (self.whiteouts.contains(name)) return null;
+        const lower_node = lower.children.get(name) orelse return null;
+
+        const node: Node = switch (lower_node) {
+            .file => |lower_file| blk: {
+                const file = self.allocator.create(MemoryFile) catch return error.OutOfMemory;
+                file.* = MemoryFile.initShared(self.allocator, lower_file.inode, lower_file.getContent());
+                file.atime = lower_file.atime;
+                file.mtime = lower_file.mtime;
+                file.ctime = lower_file.ctime;
+                file.read_only = lower_file.read_only;
+                break :blk .{ .file = file };
+            },
+            .directory => |lower_dir| blk: {
+                const dir = MemoryDirectory.init(self.allocator, lower_dir.inode, name) catch return error.OutOfMemory;
+                dir.parent = self;
+                dir.lower = lower_dir;
+                dir.atime = lower_dir.atime;
+                dir.mtime = lower_dir.mtime;
+                dir.ctime = lower_dir.ctime;
+                break :blk .{ .directory = dir };
+            },
+        };
+        errdefer switch (node) {
+            .file => |f| {
+                f.deinit();
+                self.allocator.destroy(f);
+            },
+            .directory => |d| d.deinit(),
+        };
+
+        // Not a modification, so mtime stays as it was
+        const owned_name = self.allocator.dupe(u8, name) catch return error.OutOfMemory;
+        self.children.put(owned_name, node) catch {
+            self.allocator.free(owned_name);
+            return error.OutOfMemory;
+        };
+        return node;
+    }
+
+    /// Copy up every lower entry and detach from the lower layer, so
+    /// children holds the complete listing
+    pub fn copyUpAll(self: *MemoryDirectory) VfsError!void {
+        const lower = self.lower orelse return;
+        var iter = lower.children.keyIterator();
+        while (iter.next()) |name| {
+            if (!self.children.contains(name.*)) _ = try self.copyUp(name.*);
+        }
+
+        self.lower = null;
+        var whiteout_iter = self.whiteouts.keyIterator();
+        while (whiteout_iter.next()) |key| self.allocator.free(key.*);
+        self.whiteouts.clearAndFree(self.allocator);
+    }
+
+    /// Remove a child by name. A name that also exists in the lower layer
+    /// is whited out so it does not show through again.
     pub fn remove(self: *MemoryDirectory, name: []const u8) VfsError!Node {
-        const kv = self.children.fetchRemove(name) orelse return error.FileNotFound;
+        if (try self.lookup(name) == null) return error.FileNotFound;
+
+        if (self.lower) |lower| {
+            if (lower.children.contains(name)) {
+                const gop = self.whiteouts.getOrPut(self.allocator, name) catch return error.OutOfMemory;
+                if (!gop.found_existing) {
+                    gop.key_ptr.* = self.allocator.dupe(u8, name) catch {
+                        self.whiteouts.removeByPtr(gop.key_ptr);
+                        return error.OutOfMemory;
+                    };
+                }
+            }
+        }
+
+        const kv = self.children.fetchRemove(name).?;
 
         // Free the owned key
         self.allocator.free(kv.key);
@@ -186,6 +277,41 @@ pub const MemoryDirectory = struct {
         return kv.value;
     }
 
+    /// Add now the whiteout remove() would add for name, so that a remove
+    /// which follows cannot fail. Returns whether one was added; undo with
+    /// clearWhiteout if the remove does not happen.
+    pub fn reserveWhiteout(self: *MemoryDirectory, name: []const u8) VfsError!bool {
+        const lower = self.lower orelse return false;
+        if (!lower.children.contains(name) or self.whiteouts.contains(name)) return false;
+
+        const owned_name = self.allocator.dupe(u8, name) catch return error.OutOfMemory;
+        self.whiteouts.put(self.allocator, owned_name, {}) catch {
+            self.allocator.free(owned_name);
+            return error.OutOfMemory;
+        };
+        return true;
+    }
+
+    /// Take a child out without recording a whiteout (for rollback)
+    pub fn detach(self: *MemoryDirectory, name: []const u8) ?Node {
+        const kv = self.children.fetchRemove(name) orelse return null;
+        self.allocator.free(kv.key);
+        return kv.value;
+    }
+
+    /// Put a child back (for rollback); takes ownership of owned_name,
+    /// which must come from this directory's allocator
+    pub fn attach(self: *MemoryDirectory, owned_name: []u8, node: Node) VfsError!void {
+        self.children.put(owned_name, node) catch return error.OutOfMemory;
+        if (node == .directory) node.directory.parent = self;
+    }
+
+    /// Drop a whiteout so the lower entry shows through again
+    pub fn clearWhiteout(self: *MemoryDirectory, name: []const u8) void {
+        const kv = self.whiteouts.fetchRemove(name) orelse return;
+        self.allocator.free(kv.key);
+    }
+
     /// Check if directory is empty
     pub fn isEmpty(self: *const MemoryDirectory) bool {
         return self.children.count() == 0;
@@ -212,6 +338,7 @@ pub const MemoryDirectory = struct {
 
     /// List directory entries
     pub fn readdir(self: *MemoryDirectory, allocator: Allocator) VfsError![]DirEntry {
+        try self.copyUpAll();
         self.atime = getCurrentTimestamp();
 
         // Count entries: children + . + ..
@@ -266,7 +393,8 @@ pub const MemoryDirectory = struct {
         return count_val;
     }
 
-    fn updateModTime(self: *MemoryDirectory) void {
+    /// Mark the directory as modified now
+    pub fn updateModTime(self: *MemoryDirectory) void {
         const now = getCurrentTimestamp();
         self.mtime = now;
         self.ctime = now;
@@ -290,7 +418,7 @@ test "memory directory basic operations" {
     _ = try file.write("Hello!");
 
     // Look it up
-    const found = dir.lookup("test.txt");
+    const found = try dir.lookup("test.txt");
     try std.testing.expect(found != null);
     try std.testing.expect(found.?.getType() == .regular_file);
 }
@@ -308,12 +436,12 @@ test "memory directory subdirectories" {
     _ = try subdir.createFile("nested.txt", 3);
 
     // Verify structure
-    const sub_node = root.lookup("subdir");
+    const sub_node = try root.lookup("subdir");
     try std.testing.expect(sub_node != null);
     try std.testing.expect(sub_node.?.getType() == .directory);
 
     const sub = sub_node.?.directory;
-    const file_node = sub.lookup("nested.txt");
+    const file_node = try sub.lookup("nested.txt");
     try std.testing.expect(file_node != null);
 }
 
@@ -337,3 +465,34 @@ test "memory directory readdir" {
     try std.testing.expectEqualSlices(u8, ".", entries[0].name);
     try std.testing.expectEqualSlices(u8, "..", entries[1].name);
 }
+
+test "memory directory overlays a lower directory" {
+    const allocator = std.testing.allocator;
+
+    var base = try MemoryDirectory.init(allocator, 1, "base");
+    defer base.deinit();
+    var base_file = try base.createFile("a.py", 2);
+    _ = try base_file.write("base");
+    _ = try base.createFile("b.py", 3);
+
+    var upper = try MemoryDirectory.init(allocator, 1, "upper");
+    defer upper.deinit();
+    upper.lower = base;
+
+    // Lower entries show through without being copied
+    try std.testing.expectEqual(@as(usize, 0), upper.count());
+    const found = (try upper.lookup("a.py")).?;
+    try std.testing.expectEqualSlices(u8, "base", found.file.getContent());
+    try std.testing.expectEqual(@as(usize, 1), upper.count());
+
+    // Removing a lower entry whites it out; the base is untouched
+    const removed = try upper.remove("b.py");
+    removed.file.deinit();
+    allocator.destroy(removed.file);
+    try std.testing.expect((try upper.lookup("b.py")) == null);
+    try std.testing.expect(base.children.contains("b.py"));
+
+    const entries = try upper.readdir(allocator);
+    defer MemoryDirectory.freeReaddir(allocator, entries);
+    try std.testing.expectEqual(@as(usize, 3), entries.len); // . .. a.py
+}
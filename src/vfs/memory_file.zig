@@ -22,6 +22,19 @@ pub const MemoryFile = struct {
     /// File content
     data: ArrayListUnmanaged(u8),
 
+    /// Content borrowed from a shared base layer (see
+    /// VirtualFileSystem.initOverlay). Used instead of data until the
+    /// first write, which copies it.
+    shared: ?[]const u8,
+
+    /// Host file mapped read-only (see
+    /// VirtualFileSystem.mountPersistent); the content borrows it until
+    /// the first write, and it is unmapped with the file
+    mapping: ?[]align(std.heap.page_size_min) const u8,
+
+    /// Changed since it was last written back to the host
+    dirty: bool,
+
     /// Inode number (unique identifier)
     inode: u64,
 
@@ -33,16 +46,32 @@ pub const MemoryFile = struct {
     /// Whether the file is read-only
     read_only: bool,
 
+    /// Snapshot generation the content was last saved for (see
+    /// VirtualFileSystem.snapshot)
+    snapshot_gen: u64,
+
+    /// Content and times as they were at some point, for rollback
+    pub const Saved = struct {
+        shared: ?[]const u8,
+        data: ArrayListUnmanaged(u8),
+        mtime: u64,
+        ctime: u64,
+    };
+
     pub fn init(allocator: Allocator, inode: u64) MemoryFile {
         const now = getCurrentTimestamp();
         return .{
             .allocator = allocator,
             .data = .empty,
+            .shared = null,
+            .mapping = null,
+            .dirty = false,
             .inode = inode,
             .atime = now,
             .mtime = now,
             .ctime = now,
             .read_only = false,
+            .snapshot_gen = 0,
         };
     }
 
@@ -52,21 +81,30 @@ pub const MemoryFile = struct {
         return file;
     }
 
+    /// A file whose content is borrowed; content must outlive the file
+    pub fn initShared(allocator: Allocator, inode: u64, content: []const u8) MemoryFile {
+        var file = init(allocator, inode);
+        file.shared = content;
+        return file;
+    }
+
     pub fn deinit(self: *MemoryFile) void {
         self.data.deinit(self.allocator);
+        if (self.mapping) |mapping| std.posix.munmap(mapping);
     }
 
     /// Read up to buf.len bytes from a specific offset
     pub fn pread(self: *MemoryFile, buf: []u8, offset: u64) usize {
+        const content = self.getContent();
         const off = @as(usize, @intCast(@min(offset, std.math.maxInt(usize))));
-        if (off >= self.data.items.len) {
+        if (off >= content.len) {
             return 0;
         }
 
-        const available = self.data.items.len - off;
+        const available = content.len - off;
         const to_read = @min(buf.len, available);
 
-        @memcpy(buf[0..to_read], self.data.items[off..][0..to_read]);
+        @memcpy(buf[0..to_read], content[off..][0..to_read]);
         self.atime = getCurrentTimestamp();
 
         return to_read;
@@ -77,6 +115,7 @@ pub const MemoryFile = struct {
         if (self.read_only) {
             return error.NotOpenForWriting;
         }
+        try self.unshare();
 
         const off = @as(usize, @intCast(@min(offset, std.math.maxInt(usize))));
         const end_pos = off + data.len;
@@ -95,6 +134,7 @@ pub const MemoryFile = struct {
         const now = getCurrentTimestamp();
         self.mtime = now;
         self.ctime = now;
+        self.dirty = true;
 
         return data.len;
     }
@@ -104,6 +144,7 @@ pub const MemoryFile = struct {
         if (self.read_only) {
             return error.NotOpenForWriting;
         }
+        try self.unshare();
 
         const new_size = @as(usize, @intCast(@min(new_len, std.math.maxInt(usize))));
 
@@ -117,6 +158,7 @@ pub const MemoryFile = struct {
         const now = getCurrentTimestamp();
         self.mtime = now;
         self.ctime = now;
+        self.dirty = true;
     }
 
     /// Get file statistics
@@ -126,7 +168,7 @@ pub const MemoryFile = struct {
             .ino = self.inode,
             .filetype = .regular_file,
             .nlink = 1,
-            .size = @intCast(self.data.items.len),
+            .size = @intCast(self.getContent().len),
             .atim = self.atime,
             .mtim = self.mtime,
             .ctim = self.ctime,
@@ -135,12 +177,45 @@ pub const MemoryFile = struct {
 
     /// Get file size
     pub fn size(self: *const MemoryFile) u64 {
-        return @intCast(self.data.items.len);
+        return @intCast(self.getContent().len);
     }
 
     /// Get a slice of the file's content (for reading without copying)
     pub fn getContent(self: *const MemoryFile) []const u8 {
-        return self.data.items;
+        return self.shared orelse self.data.items;
+    }
+
+    /// Bytes of content this file holds itself (borrowed content is
+    /// owned by the overlay base)
+    pub fn ownedBytes(self: *const MemoryFile) u64 {
+        return if (self.shared != null) 0 else self.data.items.len;
+    }
+
+    /// Take a private copy of borrowed content before modifying it
+    fn unshare(self: *MemoryFile) VfsError!void {
+        const content = self.shared orelse return;
+        self.data.appendSlice(self.allocator, content) catch return error.OutOfMemory;
+        self.shared = null;
+    }
+
+    /// Capture the current content. Borrowed content costs nothing to
+    /// save; private content is copied.
+    pub fn save(self: *const MemoryFile) VfsError!Saved {
+        var data: ArrayListUnmanaged(u8) = .empty;
+        if (self.shared == null) {
+            data.appendSlice(self.allocator, self.data.items) catch return error.OutOfMemory;
+        }
+        return .{ .shared = self.shared, .data = data, .mtime = self.mtime, .ctime = self.ctime };
+    }
+
+    /// Put back content captured by save, taking ownership of it
+    pub fn restore(self: *MemoryFile, saved: Saved) void {
+        self.data.deinit(self.allocator);
+        self.data = saved.data;
+        self.shared = saved.shared;
+        self.mtime = saved.mtime;
+        self.ctime = saved.ctime;
+        self.dirty = true;
     }
 
     /// Set the entire content of the file
@@ -149,12 +224,14 @@ pub const MemoryFile = struct {
             return error.NotOpenForWriting;
         }
 
+        self.shared = null;
         self.data.clearRetainingCapacity();
         self.data.appendSlice(self.allocator, content) catch return error.OutOfMemory;
 
         const now = getCurrentTimestamp();
         self.mtime = now;
         self.ctime = now;
+        self.dirty = true;
     }
 };
 
@@ -219,3 +296,30 @@ test "memory file truncate" {
     try std.testing.expectEqual(@as(u64, 8), file.size());
     try std.testing.expectEqualSlices(u8, "Hello\x00\x00\x00", file.getContent());
 }
+
+test "memory file copies shared content on write" {
+    const allocator = std.testing.allocator;
+
+    const image = "shared bytes";
+    var file = MemoryFile.initShared(allocator, 1, image);
+    defer file.deinit();
+
+    try std.testing.expectEqual(image.ptr, file.getContent().ptr);
+    try std.testing.expectEqual(@as(u64, 12), file.size());
+
+    _ = try file.pwrite("S", 0);
+    try std.testing.expectEqualSlices(u8, "Shared bytes", file.getContent());
+    try std.testing.expectEqualSlices(u8, "shared bytes", image);
+}
+
+test "memory file save and restore" {
+    const allocator = std.testing.allocator;
+
+    var file = try MemoryFile.initWithContent(allocator, 1, "before");
+    defer file.deinit();
+
+    const saved = try file.save();
+    try file.setContent("after");
+    file.restore(saved);
+    try std.testing.expectEqualSlices(u8, "before", file.getContent());
+}
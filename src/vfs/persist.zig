@@ -0,0 +1,175 @@
+// Write-Back to Host Storage
+//
+// Persistent mounts (see VirtualFileSystem.mountPersistent) hand changed
+// files to a Writer, which writes them to the host on its own thread so the
+// guest never waits for disk I/O. Files are written to a temporary name and
+// renamed into place: a reader never sees a half-written file, and content
+// the VFS still maps from the previous version stays valid.
+
+const std = @import("std");
+const Allocator = std.mem.Allocator;
+
+/// Ends the temporary name a host file's new content is written under
+pub const temp_suffix = ".writeback";
+
+/// When a persistent mount writes its changed files back. Every mount is
+/// also written back when the VFS is freed.
+pub const FlushPolicy = enum {
+    /// Whenever an fd to a changed file is closed
+    on_close,
+    /// At most every interval_ms, checked as the guest writes and closes
+    periodic,
+    /// Only when the VFS is freed (or flushPersistent is called)
+    at_exit,
+};
+
+pub const PersistOptions = struct {
+    flush: FlushPolicy = .on_close,
+    interval_ms: u64 = 1000,
+};
+
+const Op = union(enum) {
+    /// Replace the host file at path with content
+    write: struct { path: []u8, content: []u8 },
+    /// Remove the host file or directory tree at path
+    delete: []u8,
+};
+
+/// Background thread applying writes and deletes to the host in order
+pub const Writer = struct {
+    allocator: Allocator,
+    thread: std.Thread,
+    mutex: std.Thread.Mutex = .{},
+    /// Signalled when ops are queued, the queue drains, or on stop
+    cond: std.Thread.Condition = .{},
+    queue: std.ArrayListUnmanaged(Op) = .empty,
+    /// An op taken off the queue is being applied
+    busy: bool = false,
+    stopping: bool = false,
+
+    pub fn init(allocator: Allocator) !*Writer {
+        const self = try allocator.create(Writer);
+        errdefer allocator.destroy(self);
+        self.* = .{ .allocator = allocator, .thread = undefined };
+        self.thread = try std.Thread.spawn(.{}, run, .{self});
+        return self;
+    }
+
+    /// Apply everything queued, then stop the thread
+    pub fn deinit(self: *Writer) void {
+        self.mutex.lock();
+        self.stopping = true;
+        self.cond.broadcast();
+        self.mutex.unlock();
+        self.thread.join();
+        self.queue.deinit(self.allocator);
+        self.allocator.destroy(self);
+    }
+
+    /// Queue writing content to the host file at path; takes ownership of
+    /// both, which must come from the writer's allocator
+    pub fn write(self: *Writer, path: []u8, content: []u8) error{OutOfMemory}!void {
+        try self.push(.{ .write = .{ .path = path, .content = content } });
+    }
+
+    /// Queue removing the host file or directory at path; takes ownership
+    pub fn delete(self: *Writer, path: []u8) error{OutOfMemory}!void {
+        try self.push(.{ .delete = path });
+    }
+
+    /// Block until every queued op has been applied
+    pub fn wait(self: *Writer) void {
+        self.mutex.lock();
+        defer self.mutex.unlock();
+        while (self.queue.items.len > 0 or self.busy) self.cond.wait(&self.mutex);
+    }
+
+    fn push(self: *Writer, op: Op) error{OutOfMemory}!void {
+        self.mutex.lock();
+        defer self.mutex.unlock();
+        try self.queue.append(self.allocator, op);
+        self.cond.broadcast();
+    }
+
+    fn run(self: *Writer) void {
+        self.mutex.lock();
+        defer self.mutex.unlock();
+        while (true) {
+            if (self.queue.items.len == 0) {
+                self.busy = false;
+                self.cond.broadcast();
+                if (self.stopping) return;
+                self.cond.wait(&self.mutex);
+                continue;
+            }
+            const op = self.queue.orderedRemove(0);
+            self.busy = true;
+
+            self.mutex.unlock();
+            apply(op) catch |err| {
+                const path = switch (op) {
+                    .write => |w| w.path,
+                    .delete => |p| p,
+                };
+                std.debug.print("Warning: write-back of {s} failed: {}\n", .{ path, err });
+            };
+            self.free(op);
+            self.mutex.lock();
+        }
+    }
+
+    fn free(self: *Writer, op: Op) void {
+        switch (op) {
+            .write => |w| {
+                self.allocator.free(w.path);
+                self.allocator.free(w.content);
+            },
+            .delete => |path| self.allocator.free(path),
+        }
+    }
+};
+
+fn apply(op: Op) !void {
+    const cwd = std.fs.cwd();
+    switch (op) {
+        .write => |w| {
+            if (std.fs.path.dirname(w.path)) |parent| try cwd.makePath(parent);
+
+            var tmp_buf: [std.fs.max_path_bytes]u8 = undefined;
+            // Unique, so that writers in other threads or processes sharing
+            // the directory never write the same temporary file
+            const tmp = try std.fmt.bufPrint(&tmp_buf, "{s}.{x}" ++ temp_suffix, .{ w.path, std.crypto.random.int(u64) });
+            {
+                const file = try cwd.createFile(tmp, .{});
+                defer file.close();
+                try file.writeAll(w.content);
+            }
+            try cwd.rename(tmp, w.path);
+        },
+        .delete => |path| try cwd.deleteTree(path),
+    }
+}
+
+test "writer applies ops in order" {
+    const allocator = std.testing.allocator;
+
+    var tmp = std.testing.tmpDir(.{});
+    defer tmp.cleanup();
+    const root = try tmp.dir.realpathAlloc(allocator, ".");
+    defer allocator.free(root);
+
+    const writer = try Writer.init(allocator);
+    defer writer.deinit();
+
+    const path = try std.fs.path.join(allocator, &.{ root, "sub", "out.txt" });
+    try writer.write(try allocator.dupe(u8, path), try allocator.dupe(u8, "first"));
+    try writer.write(try allocator.dupe(u8, path), try allocator.dupe(u8, "second"));
+    writer.wait();
+
+    var buf: [16]u8 = undefined;
+    try std.testing.expectEqualSlices(u8, "second", try tmp.dir.readFile("sub/out.txt", &buf));
+
+    try writer.delete(path);
+    writer.wait();
+    try std.testing.expectError(error.FileNotFound, tmp.dir.access("sub/out.txt", .{}));
+}
@@ -118,6 +118,8 @@ pub const VfsError = error{
     NotEmpty,
     InvalidArgument,
     IO,
+    /// The VFS is frozen (see VirtualFileSystem.freeze)
+    ReadOnly,
 };
 
 /// Convert VFS error to WASI errno
@@ -140,6 +142,7 @@ pub fn toWasiErrno(err: VfsError) wasi.errno_t {
         error.NotEmpty => .NOTEMPTY,
         error.InvalidArgument => .INVAL,
         error.IO => .IO,
+        error.ReadOnly => .ROFS,
     };
 }
 
@@ -149,6 +152,10 @@ pub const MemoryDirectory = @import("memory_directory.zig").MemoryDirectory;
 pub const FileDescriptor = @import("fd_table.zig").FileDescriptor;
 pub const FdTable = @import("fd_table.zig").FdTable;
 pub const VirtualFileSystem = @import("filesystem.zig").VirtualFileSystem;
+pub const Limits = @import("filesystem.zig").Limits;
+pub const Usage = @import("filesystem.zig").Usage;
+pub const PersistOptions = @import("persist.zig").PersistOptions;
+pub const FlushPolicy = @import("persist.zig").FlushPolicy;
 pub const WasiVfsHooks = @import("wasi_hooks.zig").WasiVfsHooks;
 pub const WasiResult = @import("wasi_hooks.zig").WasiResult;
 
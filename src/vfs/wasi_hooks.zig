@@ -321,6 +321,36 @@ pub const WasiVfsHooks = struct {
         };
         return .{ .result = {} };
     }
+
+    /// path_unlink_file - Remove a file
+    pub fn path_unlink_file(self: *WasiVfsHooks, dir_fd: i32, path: []const u8) WasiResult(void) {
+        self.debugLog("path_unlink_file(dir_fd={}, path=\"{s}\")", .{ dir_fd, path });
+
+        self.vfs.unlink(dir_fd, path) catch |err| {
+            return .{ .err = toWasiErrno(err) };
+        };
+        return .{ .result = {} };
+    }
+
+    /// path_remove_directory - Remove an empty directory
+    pub fn path_remove_directory(self: *WasiVfsHooks, dir_fd: i32, path: []const u8) WasiResult(void) {
+        self.debugLog("path_remove_directory(dir_fd={}, path=\"{s}\")", .{ dir_fd, path });
+
+        self.vfs.rmdir(dir_fd, path) catch |err| {
+            return .{ .err = toWasiErrno(err) };
+        };
+        return .{ .result = {} };
+    }
+
+    /// path_rename - Move a file or directory
+    pub fn path_rename(self: *WasiVfsHooks, old_fd: i32, old_path: []const u8, new_fd: i32, new_path: []const u8) WasiResult(void) {
+        self.debugLog("path_rename(old_fd={}, old_path=\"{s}\", new_fd={}, new_path=\"{s}\")", .{ old_fd, old_path, new_fd, new_path });
+
+        self.vfs.rename(old_fd, old_path, new_fd, new_path) catch |err| {
+            return .{ .err = toWasiErrno(err) };
+        };
+        return .{ .result = {} };
+    }
 };
 
 // ============================================================================
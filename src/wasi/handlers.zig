@@ -21,11 +21,12 @@ const makeZwarePassthrough = hooks.makeZwarePassthrough;
 const debug_print = hooks.debug_print;
 
 // Global VFS instance for WASI hooks
-// This is necessary because zware's exposeHostFunction doesn't support user data
-var global_vfs: ?*VirtualFileSystem = null;
-var global_vfs_hooks: ?*WasiVfsHooks = null;
+// This is necessary because zware's exposeHostFunction doesn't support user data.
+// Thread-local so each worker thread (see pool.zig) runs against its own VFS.
+threadlocal var global_vfs: ?*VirtualFileSystem = null;
+threadlocal var global_vfs_hooks: ?*WasiVfsHooks = null;
 
-/// Set the global VFS instance used by all WASI handlers
+/// Set the VFS instance used by all WASI handlers on the calling thread
 pub fn setVfs(vfs: *VirtualFileSystem, vfs_hooks: *WasiVfsHooks) void {
     global_vfs = vfs;
     global_vfs_hooks = vfs_hooks;
@@ -94,10 +95,10 @@ pub fn addWasiImports(store: *zware.Store) !void {
     try store.exposeHostFunction("wasi_snapshot_preview1", "path_filestat_set_times", makeStub("path_filestat_set_times"), 0, &.{ .I32, .I32, .I32, .I32, .I64, .I64, .I32 }, i32_result);
     try store.exposeHostFunction("wasi_snapshot_preview1", "path_link", makeStub("path_link"), 0, &.{ .I32, .I32, .I32, .I32, .I32, .I32, .I32 }, i32_result);
     try store.exposeHostFunction("wasi_snapshot_preview1", "path_readlink", pathReadlinkHandler, 0, &.{ .I32, .I32, .I32, .I32, .I32, .I32 }, i32_result);
-    try store.exposeHostFunction("wasi_snapshot_preview1", "path_remove_directory", makeStub("path_remove_directory"), 0, &.{ .I32, .I32, .I32 }, i32_result);
-    try store.exposeHostFunction("wasi_snapshot_preview1", "path_rename", makeStub("path_rename"), 0, &.{ .I32, .I32, .I32, .I32, .I32, .I32 }, i32_result);
+    try store.exposeHostFunction("wasi_snapshot_preview1", "path_remove_directory", pathRemoveDirectoryHandler, 0, &.{ .I32, .I32, .I32 }, i32_result);
+    try store.exposeHostFunction("wasi_snapshot_preview1", "path_rename", pathRenameHandler, 0, &.{ .I32, .I32, .I32, .I32, .I32, .I32 }, i32_result);
     try store.exposeHostFunction("wasi_snapshot_preview1", "path_symlink", makeStub("path_symlink"), 0, &.{ .I32, .I32, .I32, .I32, .I32 }, i32_result);
-    try store.exposeHostFunction("wasi_snapshot_preview1", "path_unlink_file", makeStub("path_unlink_file"), 0, &.{ .I32, .I32, .I32 }, i32_result);
+    try store.exposeHostFunction("wasi_snapshot_preview1", "path_unlink_file", pathUnlinkFileHandler, 0, &.{ .I32, .I32, .I32 }, i32_result);
 
     try store.exposeHostFunction("wasi_snapshot_preview1", "path_open", pathOpenHandler, 0, &.{ .I32, .I32, .I32, .I32, .I32, .I64, .I64, .I32, .I32 }, i32_result);
 
@@ -593,6 +594,107 @@ fn pathCreateDirectoryHandler(vm: *zware.VirtualMachine, _: usize) zware.WasmErr
     try zware.wasi.path_create_directory(vm);
 }
 
+fn pathUnlinkFileHandler(vm: *zware.VirtualMachine, _: usize) zware.WasmError!void {
+    // path_unlink_file(fd, path, path_len) -> errno
+    const path_len = vm.popOperand(u32);
+    const path_ptr = vm.popOperand(u32);
+    const fd = vm.popOperand(u32);
+
+    const mem = try vm.inst.getMemory(0);
+    const mem_data = mem.memory();
+    const path = mem_data[path_ptr..][0..path_len];
+
+    debug_print("[WASI] path_unlink_file(fd={}, path=\"{s}\")\n", .{ fd, path });
+
+    if (global_vfs) |vfs| {
+        const is_vfs_fd = vfs.isVfsFd(@intCast(fd));
+        const is_vfs_path = VirtualFileSystem.isVfsPath(path);
+
+        if (is_vfs_fd or is_vfs_path) {
+            const vfs_path = VirtualFileSystem.stripVfsPrefix(path);
+            const vfs_fd: i32 = if (is_vfs_fd) @intCast(fd) else 3; // Use first VFS preopen
+
+            const errno = global_vfs_hooks.?.path_unlink_file(vfs_fd, vfs_path).errno();
+            debug_print("[WASI-VFS] path_unlink_file -> errno={}\n", .{@intFromEnum(errno)});
+            try vm.pushOperand(u32, @intFromEnum(errno));
+            return;
+        }
+    }
+
+    // Real filesystem removal is not supported
+    try vm.pushOperand(u32, @intFromEnum(std.os.wasi.errno_t.NOSYS));
+}
+
+fn pathRemoveDirectoryHandler(vm: *zware.VirtualMachine, _: usize) zware.WasmError!void {
+    // path_remove_directory(fd, path, path_len) -> errno
+    const path_len = vm.popOperand(u32);
+    const path_ptr = vm.popOperand(u32);
+    const fd = vm.popOperand(u32);
+
+    const mem = try vm.inst.getMemory(0);
+    const mem_data = mem.memory();
+    const path = mem_data[path_ptr..][0..path_len];
+
+    debug_print("[WASI] path_remove_directory(fd={}, path=\"{s}\")\n", .{ fd, path });
+
+    if (global_vfs) |vfs| {
+        const is_vfs_fd = vfs.isVfsFd(@intCast(fd));
+        const is_vfs_path = VirtualFileSystem.isVfsPath(path);
+
+        if (is_vfs_fd or is_vfs_path) {
+            const vfs_path = VirtualFileSystem.stripVfsPrefix(path);
+            const vfs_fd: i32 = if (is_vfs_fd) @intCast(fd) else 3; // Use first VFS preopen
+
+            const errno = global_vfs_hooks.?.path_remove_directory(vfs_fd, vfs_path).errno();
+            debug_print("[WASI-VFS] path_remove_directory -> errno={}\n", .{@intFromEnum(errno)});
+            try vm.pushOperand(u32, @intFromEnum(errno));
+            return;
+        }
+    }
+
+    // Real filesystem removal is not supported
+    try vm.pushOperand(u32, @intFromEnum(std.os.wasi.errno_t.NOSYS));
+}
+
+fn pathRenameHandler(vm: *zware.VirtualMachine, _: usize) zware.WasmError!void {
+    // path_rename(fd, old_path, old_path_len, new_fd, new_path, new_path_len) -> errno
+    const new_path_len = vm.popOperand(u32);
+    const new_path_ptr = vm.popOperand(u32);
+    const new_fd = vm.popOperand(u32);
+    const old_path_len = vm.popOperand(u32);
+    const old_path_ptr = vm.popOperand(u32);
+    const fd = vm.popOperand(u32);
+
+    const mem = try vm.inst.getMemory(0);
+    const mem_data = mem.memory();
+    const old_path = mem_data[old_path_ptr..][0..old_path_len];
+    const new_path = mem_data[new_path_ptr..][0..new_path_len];
+
+    debug_print("[WASI] path_rename(fd={}, old_path=\"{s}\", new_fd={}, new_path=\"{s}\")\n", .{ fd, old_path, new_fd, new_path });
+
+    if (global_vfs) |vfs| {
+        const old_in_vfs = vfs.isVfsFd(@intCast(fd)) or VirtualFileSystem.isVfsPath(old_path);
+        const new_in_vfs = vfs.isVfsFd(@intCast(new_fd)) or VirtualFileSystem.isVfsPath(new_path);
+
+        if (old_in_vfs != new_in_vfs) {
+            try vm.pushOperand(u32, @intFromEnum(std.os.wasi.errno_t.XDEV));
+            return;
+        }
+        if (old_in_vfs) {
+            const old_fd: i32 = if (vfs.isVfsFd(@intCast(fd))) @intCast(fd) else 3; // Use first VFS preopen
+            const to_fd: i32 = if (vfs.isVfsFd(@intCast(new_fd))) @intCast(new_fd) else 3;
+
+            const errno = global_vfs_hooks.?.path_rename(old_fd, VirtualFileSystem.stripVfsPrefix(old_path), to_fd, VirtualFileSystem.stripVfsPrefix(new_path)).errno();
+            debug_print("[WASI-VFS] path_rename -> errno={}\n", .{@intFromEnum(errno)});
+            try vm.pushOperand(u32, @intFromEnum(errno));
+            return;
+        }
+    }
+
+    // Real filesystem renames are not supported
+    try vm.pushOperand(u32, @intFromEnum(std.os.wasi.errno_t.NOSYS));
+}
+
 fn pathFilestatGetHandler(vm: *zware.VirtualMachine, _: usize) zware.WasmError!void {
     // path_filestat_get(fd, flags, path, path_len, buf) -> errno
     const buf_ptr = vm.popOperand(u32);